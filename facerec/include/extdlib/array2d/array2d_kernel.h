@@ -359,6 +359,12 @@ namespace dlib
     {
         try
         {
+            if (item.size() != 0 && ser_helper::serialize_bulk(&item[0][0], item.nr(), item.nc(), out))
+            {
+                item.reset();
+                return;
+            }
+
             // The reason the serialization is a little funny is because we are trying to
             // maintain backwards compatibility with an older serialization format used by
             // dlib while also encoding things in a way that lets the array2d and matrix
@@ -388,6 +394,15 @@ namespace dlib
     {
         try
         {
+            ser_helper::bulk_header header;
+            if (ser_helper::deserialize_bulk_header(header, in))
+            {
+                item.set_size(header.nr,header.nc);
+                if (item.size() != 0)
+                    ser_helper::deserialize_bulk(&item[0][0], header, in);
+                return;
+            }
+
             long nr, nc;
             deserialize(nr,in);
             deserialize(nc,in);
@@ -21,6 +21,8 @@
 #include "image_processing/scan_fhog_pyramid.h"
 #include "image_processing/shape_predictor.h"
 #include "image_processing/correlation_tracker.h"
+#include "image_processing/landmark_flow.h"
+#include "image_processing/tiled_object_detection.h"
 
 #endif // DLIB_IMAGE_PROCESSInG_H_h_
 
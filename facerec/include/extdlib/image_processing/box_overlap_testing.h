@@ -6,6 +6,8 @@
 #include "box_overlap_testing_abstract.h"
 #include "../geometry.h"
 #include <vector>
+#include <map>
+#include <algorithm>
 
 namespace dlib
 {
@@ -184,6 +186,119 @@ namespace dlib
         return overlaps_any_box(test_box_overlap(),rects,rect);
     }
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        class box_overlap_grid
+        {
+            /*
+                This object holds a set of rectangles, each with a tag, bucketed by the
+                cells of a coarse grid they touch.  test_box_overlap never reports boxes
+                that don't intersect as overlapping, so to check a new box against the set
+                we only have to look at the boxes sharing a grid cell with it.  This keeps
+                non-max suppression from being quadratic in the number of kept boxes.
+            */
+        public:
+            explicit box_overlap_grid (
+                long cell_size_ = 64
+            ) : cell_size(std::max(cell_size_,1L)) {}
+
+            void clear (
+            ) 
+            { 
+                boxes.clear(); 
+                cells.clear(); 
+            }
+
+            void add (
+                const rectangle& rect,
+                unsigned long tag = 0
+            )
+            {
+                const unsigned long idx = boxes.size();
+                boxes.push_back(std::make_pair(rect, tag));
+                const rectangle area = cell_area(rect);
+                for (long r = area.top(); r <= area.bottom(); ++r)
+                    for (long c = area.left(); c <= area.right(); ++c)
+                        cells[std::make_pair(r,c)].push_back(idx);
+            }
+
+            bool overlaps_any_box (
+                const test_box_overlap& tester,
+                const rectangle& rect,
+                unsigned long tag = 0
+            ) const
+            /*!
+                ensures
+                    - returns true if rect overlaps, according to tester, any of the
+                      rectangles added with the same tag.
+            !*/
+            {
+                const rectangle area = cell_area(rect);
+                for (long r = area.top(); r <= area.bottom(); ++r)
+                {
+                    for (long c = area.left(); c <= area.right(); ++c)
+                    {
+                        std::map<std::pair<long,long>, std::vector<unsigned long> >::const_iterator i;
+                        i = cells.find(std::make_pair(r,c));
+                        if (i == cells.end())
+                            continue;
+                        for (unsigned long j = 0; j < i->second.size(); ++j)
+                        {
+                            const std::pair<rectangle,unsigned long>& box = boxes[i->second[j]];
+                            if (box.second == tag && tester(box.first, rect))
+                                return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+        private:
+            long to_cell (long x) const
+            {
+                // floor division, so negative coordinates land in the right cell
+                return x >= 0 ? x/cell_size : -((-x + cell_size - 1)/cell_size);
+            }
+
+            rectangle cell_area (
+                const rectangle& rect
+            ) const
+            {
+                return rectangle(to_cell(rect.left()), to_cell(rect.top()),
+                                 to_cell(rect.right()), to_cell(rect.bottom()));
+            }
+
+            long cell_size;
+            std::vector<std::pair<rectangle,unsigned long> > boxes;
+            std::map<std::pair<long,long>, std::vector<unsigned long> > cells;
+        };
+
+        template <typename T>
+        long typical_box_width (
+            const std::vector<T>& dets
+        )
+        /*!
+            requires
+                - T has a rectangle member named rect
+            ensures
+                - returns the median width of the rects in dets, or 1 if dets is empty.
+                  This is the grid cell size to use for a box_overlap_grid holding
+                  them.  The best scoring box can be of any size, and the largest box can
+                  be many times the size of most, which would put most boxes in one cell.
+        !*/
+        {
+            if (dets.size() == 0)
+                return 1;
+            std::vector<long> widths(dets.size());
+            for (unsigned long i = 0; i < dets.size(); ++i)
+                widths[i] = dets[i].rect.width();
+            std::nth_element(widths.begin(), widths.begin() + widths.size()/2, widths.end());
+            return widths[widths.size()/2];
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 
 }
@@ -35,6 +35,13 @@ namespace dlib
             regularizer_scale(regularizer_scale), nu_scale(nu_scale),
             scale_pyramid_alpha(scale_pyramid_alpha)
         {
+            DLIB_CASSERT(filter_size > 0 && num_scale_levels > 0,
+                "\t correlation_tracker::correlation_tracker()"
+                << "\n\t filter_size and num_scale_levels must be at least 1."
+                << "\n\t filter_size:      " << filter_size
+                << "\n\t num_scale_levels: " << num_scale_levels
+            );
+
             // Create the cosine mask used for space filtering.
             mask = make_cosine_mask();
 
@@ -63,8 +70,6 @@ namespace dlib
             B.set_size(0,0);
 
             point_transform_affine tform = inv(make_chip(img, p, F));
-            for (unsigned long i = 0; i < F.size(); ++i)
-                fft_inplace(F[i]);
             make_target_location_image(tform(center(p)), G);
             A.resize(F.size());
             for (unsigned long i = 0; i < F.size(); ++i)
@@ -77,16 +82,9 @@ namespace dlib
 
             // now do the scale space stuff
             make_scale_space(img, Fs);
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-                fft_inplace(Fs[i]);
             make_scale_target_location_image(get_num_scale_levels()/2, Gs);
-            Bs.set_size(0);
-            As.resize(Fs.size());
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-            {
-                As[i] = pointwise_multiply(Gs, Fs[i]);
-                Bs += squared(real(Fs[i]))+squared(imag(Fs[i]));
-            }
+            As = scale_rows(Fs, Gs);
+            Bs = sum_cols(squared(real(Fs))+squared(imag(Fs)));
         }
 
 
@@ -132,31 +130,29 @@ namespace dlib
 
 
             const point_transform_affine tform = make_chip(img, guess, F);
-            for (unsigned long i = 0; i < F.size(); ++i)
-                fft_inplace(F[i]);
 
             // use the current filter to predict the object's location
             G = 0;
             for (unsigned long i = 0; i < F.size(); ++i)
                 G += pointwise_multiply(F[i],conj(A[i]));
             G = pointwise_multiply(G, reciprocal(B+get_regularizer_space()));
-            ifft_inplace(G);
-            const dlib::vector<double,2> pp = max_point_interpolated(real(G));
+            impl::ifftr(G, response, fft_buf);
+            const dlib::vector<double,2> pp = max_point_interpolated(response);
 
 
             // Compute the peak to side lobe ratio.
             const point p = pp;
             running_stats<double> rs;
             const rectangle peak = centered_rect(p, 8,8);
-            for (long r = 0; r < G.nr(); ++r)
+            for (long r = 0; r < response.nr(); ++r)
             {
-                for (long c = 0; c < G.nc(); ++c)
+                for (long c = 0; c < response.nc(); ++c)
                 {
                     if (!peak.contains(point(c,r)))
-                        rs.add(G(r,c).real());
+                        rs.add(response(r,c));
                 }
             }
-            const double psr = (G(p.y(),p.x()).real()-rs.mean())/rs.stddev();
+            const double psr = (response(p.y(),p.x())-rs.mean())/rs.stddev();
 
             // update the position of the object
             position = translate_rect(guess, tform(pp)-center(guess));
@@ -183,14 +179,9 @@ namespace dlib
 
             // Now predict the scale change
             make_scale_space(img, Fs);
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-                fft_inplace(Fs[i]);
-            Gs = 0;
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-                Gs += pointwise_multiply(Fs[i],conj(As[i]));
-            Gs = pointwise_multiply(Gs, reciprocal(Bs+get_regularizer_scale()));
-            ifft_inplace(Gs);
-            const double pos = max_point_interpolated(real(Gs)).y();
+            Gs = pointwise_multiply(sum_cols(pointwise_multiply(Fs,conj(As))), reciprocal(Bs+get_regularizer_scale()));
+            impl::ifftr_columns(Gs, scale_response, fft_buf);
+            const double pos = max_point_interpolated(scale_response).y();
 
             // update the rectangle's scale
             position *= std::pow(get_scale_pyramid_alpha(), pos-(double)get_num_scale_levels()/2);
@@ -199,12 +190,8 @@ namespace dlib
 
             // Now update the scale filters
             make_scale_target_location_image(pos, Gs);
-            Bs *= (1-get_nu_scale());
-            for (unsigned long i = 0; i < Fs.size(); ++i)
-            {
-                As[i] = get_nu_scale()*pointwise_multiply(Gs, Fs[i]) + (1-get_nu_scale())*As[i];
-                Bs += get_nu_scale()*(squared(real(Fs[i]))+squared(imag(Fs[i])));
-            }
+            As = get_nu_scale()*scale_rows(Fs, Gs) + (1-get_nu_scale())*As;
+            Bs = get_nu_scale()*sum_cols(squared(real(Fs))+squared(imag(Fs))) + (1-get_nu_scale())*Bs;
 
 
             return psr;
@@ -231,8 +218,8 @@ namespace dlib
         template <typename image_type>
         void make_scale_space(
             const image_type& img,
-            std::vector<matrix<std::complex<double>,0,1> >& Fs
-        ) const
+            matrix<std::complex<double> >& Fs
+        )
         {
             typedef typename image_traits<image_type>::pixel_type pixel_type;
 
@@ -270,25 +257,27 @@ namespace dlib
                 assign_image(hogs[i][31], mat(hogs[i][31])/255.0);
             }
 
-            // Now copy the hog features into the Fs outputs and also apply the cosine
-            // windowing.
-            Fs.resize(hogs[0].size()*hogs[0][0].size());
-            unsigned long i = 0; 
+            // Now copy the hog features into the columns of scale_features, one row per
+            // scale level, and also apply the cosine windowing.  Then transform all the
+            // columns at once.  They are real, so only the first half of each transform is
+            // kept.
+            scale_features.set_size(hogs.size(), hogs[0].size()*hogs[0][0].size());
+            long i = 0; 
             for (long r = 0; r < hogs[0][0].nr(); ++r)
             {
                 for (long c = 0; c < hogs[0][0].nc(); ++c)
                 {
                     for (unsigned long j = 0; j < hogs[0].size(); ++j)
                     {
-                        Fs[i].set_size(hogs.size());
                         for (unsigned long k = 0; k < hogs.size(); ++k)
                         {
-                            Fs[i](k) = hogs[k][j][r][c]*scale_cos_mask[k];
+                            scale_features(k,i) = hogs[k][j][r][c]*scale_cos_mask[k];
                         }
                         ++i;
                     }
                 }
             } 
+            impl::fftr_columns(scale_features, Fs, fft_buf);
         }
 
         template <typename image_type>
@@ -296,7 +285,7 @@ namespace dlib
             const image_type& img,
             drectangle p,
             std::vector<matrix<std::complex<double> > >& chip
-        ) const
+        )
         {
             typedef typename image_traits<image_type>::pixel_type pixel_type;
             array2d<pixel_type> temp;
@@ -305,14 +294,20 @@ namespace dlib
             extract_image_chip(img, details, temp);
 
 
+            // The channels are real, so their transforms are Hermitian and only the
+            // first get_filter_size()/2+1 columns of each are kept.
             chip.resize(32);
             dlib::array<array2d<float> > hog;
             extract_fhog_features(temp, hog, 1, 3,3 );
             for (unsigned long i = 0; i < hog.size(); ++i)
-                assign_image(chip[i], pointwise_multiply(matrix_cast<double>(mat(hog[i])), mask));
+            {
+                channel = pointwise_multiply(matrix_cast<double>(mat(hog[i])), mask);
+                impl::fftr(channel, chip[i], fft_buf);
+            }
 
-            assign_image(chip[31], temp);
-            assign_image(chip[31], pointwise_multiply(mat(chip[31]), mask)/255.0);
+            assign_image(channel, temp);
+            channel = pointwise_multiply(channel, mask)/255.0;
+            impl::fftr(channel, chip[31], fft_buf);
 
             return inv(get_mapping_to_chip(details));
         }
@@ -320,20 +315,20 @@ namespace dlib
         void make_target_location_image (
             const dlib::vector<double,2>& p,
             matrix<std::complex<double> >& g
-        ) const
+        )
         {
-            g.set_size(get_filter_size(), get_filter_size());
-            g = 0;
-            rectangle area = centered_rect(p, 21,21).intersect(get_rect(g));
+            channel.set_size(get_filter_size(), get_filter_size());
+            channel = 0;
+            rectangle area = centered_rect(p, 21,21).intersect(get_rect(channel));
             for (long r = area.top(); r <= area.bottom(); ++r)
             {
                 for (long c = area.left(); c <= area.right(); ++c)
                 {
                     double dist = length(point(c,r)-p);
-                    g(r,c) = std::exp(-dist/3.0);
+                    channel(r,c) = std::exp(-dist/3.0);
                 }
             }
-            fft_inplace(g);
+            impl::fftr(channel, g, fft_buf);
             g = conj(g);
         }
 
@@ -341,15 +336,15 @@ namespace dlib
         void make_scale_target_location_image (
             const double scale,
             matrix<std::complex<double>,0,1>& g
-        ) const
+        )
         {
-            g.set_size(get_num_scale_levels());
-            for (long i = 0; i < g.size(); ++i)
+            scale_response.set_size(get_num_scale_levels(), 1);
+            for (long i = 0; i < scale_response.size(); ++i)
             {
                 double dist = std::pow((i-scale),2.0);
-                g(i) = std::exp(-dist/1.000);
+                scale_response(i) = std::exp(-dist/1.000);
             }
-            fft_inplace(g);
+            impl::fftr_columns(scale_response, g, fft_buf);
             g = conj(g);
         }
 
@@ -374,20 +369,25 @@ namespace dlib
         }
 
 
+        // All the spectra are of real signals, so only their first halves are stored.
+        // A, F, and B are get_filter_size() by get_filter_size()/2+1.  As and Fs hold one
+        // column per scale feature and get_num_scale_levels()/2+1 rows.
         std::vector<matrix<std::complex<double> > > A, F;
         matrix<double> B;
 
-        std::vector<matrix<std::complex<double>,0,1> > As, Fs;
+        matrix<std::complex<double> > As, Fs;
         matrix<double,0,1> Bs;
         drectangle position;
 
         matrix<double> mask;
         std::vector<double> scale_cos_mask;
 
-        // G and Gs do not logically contribute to the state of this object.  They are
+        // G, Gs, and the rest of these do not logically contribute to the state of this object.  They are
         // here just so we can void reallocating them over and over.
         matrix<std::complex<double> > G;
         matrix<std::complex<double>,0,1> Gs;
+        matrix<double> channel, response, scale_features, scale_response;
+        impl::fft_buffers<double> fft_buf;
 
         unsigned long filter_size;
         unsigned long num_scale_levels;
@@ -36,7 +36,8 @@ namespace dlib
         );
         /*!
             requires
-                - p.is_empty() == false
+                - filter_size > 0
+                - num_scale_levels > 0
             ensures
                 - Initializes correlation_tracker. Higher value of filter_size and 
                   num_scale_levels increases tracking precision but requires more CPU 
@@ -0,0 +1,3658 @@
+// Generated by tools/generate_detector_tables.cpp from object_detector.dat.  Do not edit.
+#ifndef DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_
+#define DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_
+
+#include "../align.h"
+
+namespace dlib
+{
+    namespace frontal_face_tables
+    {
+        const unsigned long num_detectors = 5;
+        const long num_planes = 31;
+        const long filter_rows = 10;
+        const long filter_cols = 10;
+
+        const unsigned long cell_size = 8;
+        const unsigned long padding = 0;
+        const unsigned long window_width = 80;
+        const unsigned long window_height = 80;
+        const unsigned long max_pyramid_levels = 1000;
+        const unsigned long min_pyramid_layer_width = 64;
+        const unsigned long min_pyramid_layer_height = 64;
+        const double nuclear_norm_regularization_strength = 9;
+
+        const double iou_thresh = 0.33008212188056446;
+        const double percent_covered_thresh = 0.78857142857142859;
+
+        // The detection threshold of each detector.
+        static const double biases[5] = {3.2744957766996508, 3.9868216360740241, 3.8959356750348184, 3.5148690352596796, 3.5580290258303688};
+
+        // How many separable filters each plane of each detector was decomposed into.
+        static const unsigned char num_separable_filters[155] = {
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 3, 2, 2, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 2,
+            2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1,
+            2, 2, 1, 1, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2, 1, 2, 2, 1, 3, 3, 2, 3, 3, 1, 1, 2, 2, 1, 1, 2, 1,
+            2, 1, 2, 3, 2, 1, 2, 3, 1, 3, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2, 1, 2, 3, 2, 2, 2, 2, 2,
+            3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        };
+
+        // The full filter of each plane of each detector, stored row major.
+        static const float DM_ALIGNED(32) filters[15500] = {
+             -3.09682526e-02f,   4.37799990e-02f,   6.64510131e-02f,   7.48079866e-02f,  -7.68586621e-03f,  -1.19334487e-02f,
+             -4.14505973e-02f,  -3.37229893e-02f,   2.30944380e-02f,   2.44957116e-02f,  -2.56331451e-02f,   4.05638590e-02f,
+              5.88561930e-02f,   6.42030388e-02f,  -4.01401566e-03f,  -8.92981235e-03f,  -3.64145190e-02f,  -3.03787235e-02f,
+              1.93521101e-02f,   2.14631855e-02f,   4.08291491e-03f,  -3.31529591e-04f,  -3.91534995e-03f,  -6.99209096e-03f,
+              3.96583695e-03f,   2.76525202e-03f,   2.81782704e-03f,   1.34561339e-03f,  -2.74763862e-03f,  -1.73615280e-03f,
+              6.88156765e-03f,   1.32687660e-02f,   5.71658649e-03f,  -4.48861299e-03f,   1.41883250e-02f,   7.69008603e-03f,
+             -1.97852217e-03f,  -5.61220478e-03f,  -3.87571822e-03f,   8.69426760e-04f,   8.89243092e-03f,   1.10100349e-02f,
+              1.92190206e-03f,  -9.03795101e-03f,   1.50043443e-02f,   8.59291386e-03f,   4.28825966e-04f,  -3.75530543e-03f,
+             -5.34340879e-03f,  -5.60837449e-04f,   8.65747407e-03f,   4.25712299e-03f,  -3.88436927e-03f,  -1.22088892e-02f,
+              1.11010252e-02f,   6.95015630e-03f,   3.56160686e-03f,   2.65471899e-05f,  -5.55519853e-03f,  -2.31982628e-03f,
+             -3.90068744e-03f,  -1.09940320e-02f,  -6.33351877e-03f,   7.11786037e-04f,  -9.92708839e-03f,  -5.11982990e-03f,
+              2.81123118e-03f,   5.16033219e-03f,   2.00717896e-03f,  -1.44611718e-03f,   8.37275852e-03f,  -1.69439968e-02f,
+             -2.25150567e-02f,  -2.29204837e-02f,  -6.93733979e-04f,   2.10745772e-03f,   1.36918407e-02f,   1.20281884e-02f,
+             -6.52292790e-03f,  -8.02476984e-03f,   1.65587142e-02f,  -2.74897646e-02f,  -3.91657986e-02f,  -4.21529822e-02f,
+              1.89511769e-03f,   5.48681896e-03f,   2.41490565e-02f,   2.03571711e-02f,  -1.25714839e-02f,  -1.42179690e-02f,
+              1.29656552e-03f,  -4.89983754e-03f,  -5.51370531e-03f,  -4.75029554e-03f,  -1.34257774e-03f,  -1.72275482e-04f,
+              3.22763505e-03f,   3.15968017e-03f,  -1.13442994e-03f,  -1.86742702e-03f,   4.86615971e-02f,   1.13364711e-01f,
+              1.24041945e-01f,   9.93268117e-02f,   1.50996670e-02f,   5.95619623e-03f,  -4.42327745e-02f,  -5.81120364e-02f,
+             -3.24801579e-02f,  -1.15423584e-02f,   4.08976115e-02f,   9.08181295e-02f,   9.69951004e-02f,   7.65777975e-02f,
+              1.95992161e-02f,   1.03459749e-02f,  -3.65382954e-02f,  -4.46484983e-02f,  -2.52792835e-02f,  -9.25756898e-03f,
+              2.46693213e-02f,   3.93096320e-02f,   3.33320946e-02f,   2.22464483e-02f,   3.57927345e-02f,   2.47687157e-02f,
+             -1.98292583e-02f,  -1.23881651e-02f,  -8.24447069e-03f,  -4.04641079e-03f,   6.48691654e-02f,   6.95528835e-02f,
+              3.26274112e-02f,   6.16541272e-03f,   1.46507099e-01f,   1.05624177e-01f,  -4.73107919e-02f,  -7.89599027e-04f,
+             -6.37194095e-03f,  -7.27947662e-03f,   1.23751024e-02f,  -5.17687667e-03f,  -2.37897895e-02f,  -2.73715053e-02f,
+              5.65272570e-02f,   4.22393866e-02f,  -6.39005192e-03f,   1.71885751e-02f,   7.13460939e-03f,   4.44597419e-04f,
+              3.58174182e-03f,  -1.74206402e-03f,  -7.28207547e-03f,  -8.29936098e-03f,   1.67383496e-02f,   1.25172604e-02f,
+             -1.81465992e-03f,   5.20400843e-03f,   2.17530737e-03f,   1.52903216e-04f,  -1.84055138e-02f,  -3.35333534e-02f,
+             -3.17107737e-02f,  -2.31056008e-02f,  -2.01898813e-02f,  -1.34441340e-02f,   1.53951738e-02f,   1.31953442e-02f,
+              8.05462990e-03f,   3.43690603e-03f,  -3.45155112e-02f,  -7.17203245e-02f,  -7.38441497e-02f,  -5.70045672e-02f,
+             -2.41720732e-02f,  -1.46301193e-02f,   3.01327202e-02f,   3.30509059e-02f,   1.91046484e-02f,   7.32336426e-03f,
+             -4.28014323e-02f,  -8.79976526e-02f,  -9.00417119e-02f,  -6.92342967e-02f,  -3.14314552e-02f,  -1.92681178e-02f,
+              3.72321717e-02f,   4.01014984e-02f,   2.32653953e-02f,   8.98799952e-03f,  -1.30858701e-02f,  -1.33816842e-02f,
+             -5.52576268e-03f,  -2.39257555e-04f,  -3.05600017e-02f,  -2.20844969e-02f,   9.45114065e-03f,  -4.50810592e-04f,
+              9.91585315e-04f,   1.40396168e-03f,   4.18628938e-03f,   4.55303900e-02f,   4.39198576e-02f,   1.29497377e-02f,
+             -5.75179271e-02f,  -4.03924398e-02f,  -7.34055508e-03f,  -4.69697341e-02f,  -1.94749963e-02f,  -3.70965302e-02f,
+              1.70936380e-02f,   5.42611033e-02f,   5.13954982e-02f,   8.96942895e-03f,  -6.03142641e-02f,  -3.94447185e-02f,
+             -3.91650666e-03f,  -3.11210919e-02f,  -7.23668234e-03f,  -2.81751994e-02f,   8.77253059e-03f,   1.35676924e-03f,
+              6.32760406e-04f,  -4.23176447e-03f,   4.16788133e-03f,   5.00694243e-03f,   3.23308376e-03f,   1.63575280e-02f,
+              1.08309332e-02f,   1.03501529e-02f,   3.99132492e-03f,  -6.10304289e-02f,  -5.96222840e-02f,  -2.24858411e-02f,
+              8.36303234e-02f,   6.10397942e-02f,   1.36725353e-02f,   8.26779008e-02f,   3.87763530e-02f,   6.24460578e-02f,
+             -9.19259991e-03f,  -2.45029815e-02f,  -2.30937544e-02f,  -3.26355151e-03f,   2.62342021e-02f,   1.67540144e-02f,
+              1.18042657e-03f,   1.10277962e-02f,   1.32349192e-03f,   1.07712587e-02f,  -1.68773718e-02f,  -6.32434245e-03f,
+             -4.82674828e-03f,   6.90274360e-03f,  -3.09433811e-03f,  -6.09260192e-03f,  -5.48499078e-03f,  -2.69373730e-02f,
+             -1.87982507e-02f,  -1.64340828e-02f,  -1.37765864e-02f,  -2.26061121e-02f,  -2.08920073e-02f,  -1.83204495e-04f,
+              2.06014458e-02f,   1.16538489e-02f,  -1.02474133e-03f,  -6.99834549e-04f,  -5.76685788e-03f,   2.92237662e-03f,
+             -1.12566389e-02f,  -6.26618275e-03f,  -5.20961313e-03f,   3.92083824e-03f,   6.51546463e-04f,  -2.11137929e-03f,
+             -3.25294468e-03f,  -1.54668465e-02f,  -1.14132864e-02f,  -9.04284511e-03f,   6.56801974e-03f,  -1.11202430e-03f,
+             -1.59411831e-03f,  -3.87800275e-03f,   5.94164804e-03f,   5.77694084e-03f,   2.84176972e-03f,   1.48437712e-02f,
+              9.27747134e-03f,   9.74204671e-03f,   1.60273686e-02f,  -1.15789054e-02f,  -1.25054466e-02f,  -1.24198785e-02f,
+              2.62527522e-02f,   2.25472730e-02f,   8.68918281e-03f,   4.70413081e-02f,   2.75066346e-02f,   3.20756063e-02f,
+             -2.38252943e-03f,   1.34643875e-02f,   1.84146520e-02f,   1.51611371e-02f,  -1.35139085e-03f,  -1.94224250e-02f,
+             -2.21140850e-02f,  -4.21267189e-03f,  -2.20530271e-03f,  -3.04075540e-03f,  -3.37862672e-04f,   1.40442175e-03f,
+              1.76915876e-03f,   4.65268677e-04f,  -1.16595242e-03f,  -7.62101728e-04f,  -2.21821968e-03f,  -2.69346870e-03f,
+             -5.60204091e-04f,  -6.42162922e-04f,   2.90641584e-03f,  -7.69383181e-03f,  -7.90099800e-03f,   1.06362579e-02f,
+              1.84958931e-02f,  -1.07542984e-02f,   1.11075211e-02f,   4.13832888e-02f,   6.96940999e-03f,   7.35716242e-03f,
+              8.79609305e-03f,  -2.06166059e-02f,  -1.94614045e-02f,   4.10926715e-02f,   6.11253753e-02f,  -4.30746190e-02f,
+              2.87665203e-02f,   1.36320546e-01f,   2.24002525e-02f,   2.33807974e-02f,   3.59180639e-03f,  -6.93733571e-03f,
+             -5.47627220e-03f,   2.17220057e-02f,   2.78182048e-02f,  -2.34332476e-02f,   9.05430410e-03f,   6.18142337e-02f,
+              9.87292081e-03f,   1.01661980e-02f,  -1.78360508e-03f,  -5.19091613e-04f,  -3.89219518e-03f,  -2.40123067e-02f,
+             -2.14626361e-02f,   2.72757094e-02f,   2.70852656e-03f,  -4.71505672e-02f,  -6.84543047e-03f,  -6.70440355e-03f,
+              1.20810431e-03f,  -1.09709492e-02f,  -1.62485894e-02f,  -2.15125754e-02f,  -7.31005101e-03f,   2.61963252e-02f,
+              1.87444203e-02f,  -1.50644612e-02f,  -9.12550313e-04f,  -1.89270970e-04f,   4.47641796e-04f,  -3.70275765e-03f,
+             -5.41628944e-03f,  -6.76219771e-03f,  -2.00946489e-03f,   8.27705674e-03f,   6.28686277e-03f,  -4.07777354e-03f,
+             -1.60547905e-04f,   8.12478975e-05f,  -9.36714350e-05f,   1.35767437e-03f,   2.10552942e-03f,   3.35967983e-03f,
+              1.54513912e-03f,  -4.03156457e-03f,  -2.37490819e-03f,   3.27279116e-03f,   3.19253682e-04f,   2.26507022e-04f,
+              1.78455142e-03f,  -7.25894375e-03f,  -9.07921232e-03f,  -1.92683726e-03f,   6.46532001e-03f,   3.39783193e-03f,
+              1.14273038e-02f,   1.48868216e-02f,   3.03688366e-03f,   3.45827872e-03f,  -3.65629932e-03f,  -1.89205271e-03f,
+              8.50594137e-03f,   1.19434316e-02f,   8.20526481e-03f,   3.30775045e-03f,   1.32825831e-02f,   1.26123764e-02f,
+              2.01014313e-03f,  -1.59554044e-03f,  -1.85444877e-02f,  -1.52191753e-02f,   6.35730922e-02f,   8.06881860e-02f,
+              1.23139163e-02f,  -4.16562259e-02f,   5.57455793e-02f,   9.02893618e-02f,   1.50717609e-02f,  -1.25725279e-02f,
+             -1.48793403e-02f,  -2.72641983e-02f,   1.05706163e-01f,   1.18583001e-01f,  -6.85663149e-02f,  -1.89854994e-01f,
+              1.36125674e-02f,   1.42907023e-01f,   2.51478255e-02f,  -2.20813360e-02f,  -3.84631753e-02f,  -4.59971242e-02f,
+              1.84294820e-01f,   2.18973026e-01f,  -4.96648811e-02f,  -2.36367524e-01f,   8.57922956e-02f,   2.54820555e-01f,
+              4.37758379e-02f,  -3.75748090e-02f,  -1.25075411e-02f,  -2.33256202e-02f,   9.03367102e-02f,   1.01137795e-01f,
+             -5.97597733e-02f,  -1.63825378e-01f,   1.06005874e-02f,   1.22034341e-01f,   2.14925241e-02f,  -1.88861191e-02f,
+              3.53229195e-02f,   2.96682566e-02f,  -1.23560183e-01f,  -1.56121835e-01f,  -1.99151654e-02f,   8.64045173e-02f,
+             -1.04778200e-01f,  -1.75159842e-01f,  -2.92972997e-02f,   2.44889557e-02f,   5.72813442e-03f,   2.61926688e-02f,
+             -9.77308601e-02f,  -1.01795875e-01f,   1.08197480e-01f,   2.36210629e-01f,   2.72056330e-02f,  -1.28491178e-01f,
+             -2.32943799e-02f,   2.10072752e-02f,  -1.24909235e-02f,   1.13290129e-02f,  -3.55947651e-02f,  -2.28400026e-02f,
+              1.20756224e-01f,   1.96204543e-01f,   8.21557790e-02f,  -4.02002782e-02f,  -8.56381096e-03f,   8.72584805e-03f,
+             -8.62786896e-04f,   6.45002536e-03f,  -2.30525415e-02f,  -2.18493864e-02f,   3.78764234e-02f,   7.24496245e-02f,
+              1.73898302e-02f,  -2.93061752e-02f,  -5.50673436e-03f,   5.11837844e-03f,   1.63102541e-02f,   1.10949334e-02f,
+             -4.75903563e-02f,  -6.27736300e-02f,  -2.27677189e-02f,   1.28329331e-02f,  -5.37642725e-02f,  -6.86888918e-02f,
+             -1.12693338e-02f,   9.23269335e-03f,  -5.05305035e-03f,   3.77577642e-04f,   1.56839099e-02f,   3.39156091e-02f,
+              1.60909607e-03f,   8.99758469e-03f,   2.69436054e-02f,   1.75839402e-02f,   3.47237126e-03f,  -7.77309434e-03f,
+             -9.50378459e-03f,   7.77423708e-03f,   6.89242557e-02f,   8.93705562e-02f,  -6.01668879e-02f,  -2.18261015e-02f,
+              7.47668445e-02f,   6.61335811e-02f,   2.48715524e-02f,  -2.18523853e-02f,  -7.53429160e-03f,   1.69994682e-02f,
+              1.15120254e-01f,   1.10092886e-01f,  -1.44636780e-01f,  -7.67436028e-02f,   9.62287113e-02f,   1.03145130e-01f,
+              4.78519909e-02f,  -2.84188744e-02f,  -1.77383851e-02f,   2.20253952e-02f,   1.70587301e-01f,   1.94021568e-01f,
+             -1.79526955e-01f,  -8.19603205e-02f,   1.65178448e-01f,   1.58608004e-01f,   6.59333989e-02f,  -4.84810434e-02f,
+             -6.17385888e-03f,   1.83674116e-02f,   1.19099773e-01f,   1.06283829e-01f,  -1.58216596e-01f,  -8.72272402e-02f,
+              9.39865857e-02f,   1.05289094e-01f,   5.07326908e-02f,  -2.78308094e-02f,   1.30388616e-02f,  -1.28612528e-02f,
+             -1.06813870e-01f,  -1.30563289e-01f,   1.02185115e-01f,   4.19864058e-02f,  -1.10064231e-01f,  -1.01007372e-01f,
+             -3.98225524e-02f,   3.22283916e-02f,  -1.17605245e-02f,  -2.60140169e-02f,  -1.13590576e-01f,  -1.84545536e-02f,
+              2.44320124e-01f,   1.68456599e-01f,  -2.90059838e-02f,  -8.49398598e-02f,  -6.17409572e-02f,   9.44365282e-03f,
+             -2.20839959e-02f,  -2.41254941e-02f,  -7.53131956e-02f,   5.48812151e-02f,   2.37614065e-01f,   1.80711046e-01f,
+              2.98501085e-02f,  -4.37871329e-02f,  -5.17464168e-02f,  -7.58071290e-03f,  -7.15458859e-03f,  -1.03126504e-02f,
+             -3.83337252e-02f,   8.73844884e-03f,   9.93147492e-02f,   7.22403079e-02f,   1.15596270e-03f,  -2.58708447e-02f,
+             -2.32465658e-02f,   1.00344841e-04f,   9.49327648e-03f,  -6.21800637e-03f,  -6.02104217e-02f,  -8.36671069e-02f,
+              4.62556705e-02f,   1.33126993e-02f,  -6.94061443e-02f,  -5.88171408e-02f,  -2.08258796e-02f,   2.02436410e-02f,
+             -2.23106705e-03f,  -3.69747356e-03f,  -2.14361548e-02f,  -2.15768889e-02f,   9.64407250e-03f,  -9.69429500e-03f,
+             -3.95060342e-05f,   1.70417260e-02f,   1.94657855e-02f,   7.07990164e-03f,  -3.01848934e-03f,  -2.65974551e-03f,
+             -2.14492064e-02f,  -1.64274182e-02f,   1.48880510e-02f,  -7.64068682e-03f,  -6.86203968e-03f,   6.78306213e-03f,
+              7.11642206e-03f,   1.67101528e-03f,   5.69399260e-03f,   5.42829977e-03f,   4.17862833e-02f,   3.32278125e-02f,
+             -2.77615227e-02f,   1.53737878e-02f,   1.17497742e-02f,  -1.56505611e-02f,  -1.67963263e-02f,  -4.53956798e-03f,
+              1.28602991e-02f,   9.92095936e-03f,   8.68359506e-02f,   6.23015016e-02f,  -6.45389631e-02f,   2.92558074e-02f,
+              3.33363004e-02f,  -1.90985762e-02f,  -1.87444668e-02f,  -2.35694041e-03f,   5.07520698e-03f,   4.33677854e-03f,
+              3.56281064e-02f,   2.68837027e-02f,  -2.51386091e-02f,   1.25307655e-02f,   1.19307153e-02f,  -1.04653863e-02f,
+             -1.08558005e-02f,  -2.35308520e-03f,  -7.10782176e-03f,  -4.19252785e-03f,  -4.38326411e-02f,  -2.74008550e-02f,
+              3.66842598e-02f,  -1.31529849e-02f,  -2.21760757e-02f,   1.58972852e-03f,  -2.29247569e-04f,  -3.05413269e-03f,
+             -5.40137477e-03f,  -2.74584512e-03f,  -3.18903439e-02f,  -1.84242502e-02f,   2.82228403e-02f,  -8.96657258e-03f,
+             -1.81312226e-02f,  -1.84931990e-03f,  -3.78512731e-03f,  -3.80656286e-03f,  -4.17784380e-04f,   2.05441873e-04f,
+             -1.11963274e-03f,   8.51549616e-04f,   2.51118722e-03f,   2.82949652e-04f,  -2.61674193e-03f,  -3.04542994e-03f,
+             -3.72062996e-03f,  -1.70477887e-03f,  -1.38313754e-03f,  -9.44561034e-04f,  -8.94453656e-03f,  -6.03340240e-03f,
+              7.03741377e-03f,  -2.86032050e-03f,  -3.94122163e-03f,   1.20350043e-03f,   1.01142225e-03f,  -1.59823743e-04f,
+              1.56787306e-03f,   1.50757621e-03f,   1.15475580e-02f,   9.21955425e-03f,  -7.63418712e-03f,   4.26332140e-03f,
+              3.19798174e-03f,  -4.39882372e-03f,  -4.73049376e-03f,  -1.29341485e-03f,  -2.03681402e-02f,  -1.52968308e-02f,
+             -4.65811640e-02f,  -3.32916938e-02f,  -1.47689367e-02f,  -4.76789586e-02f,  -9.32301767e-03f,   3.19948941e-02f,
+              2.61402503e-02f,   6.20646751e-04f,  -2.05175448e-02f,  -3.30757746e-03f,  -2.77281981e-02f,  -2.12724265e-02f,
+             -1.60385054e-02f,  -5.35263754e-02f,  -1.82453003e-02f,   2.81641278e-02f,   3.47331502e-02f,   4.24107956e-03f,
+              9.69535764e-03f,   6.58091763e-03f,   2.10618768e-02f,   1.51372040e-02f,   7.09731877e-03f,   2.30136942e-02f,
+              4.95030126e-03f,  -1.49944434e-02f,  -1.29291993e-02f,  -5.04728931e-04f,   4.21926342e-02f,   1.15650110e-02f,
+              6.45759478e-02f,   4.85720076e-02f,   3.25247869e-02f,   1.07908629e-01f,   3.40349749e-02f,  -5.95174059e-02f,
+             -6.81190789e-02f,  -7.29818363e-03f,   8.81099422e-03f,  -3.48491990e-03f,   4.12698044e-03f,   4.16418072e-03f,
+              7.35823484e-03f,   2.52146889e-02f,   1.14241280e-02f,  -1.04467915e-02f,  -1.83211043e-02f,  -3.28697055e-03f,
+              7.90506136e-04f,  -2.21575871e-02f,  -3.42789218e-02f,  -2.17637792e-02f,   2.75637023e-03f,   1.21863438e-02f,
+              1.70075465e-02f,   6.40148250e-03f,  -1.68090705e-02f,  -6.82210037e-03f,   9.56716761e-03f,  -1.36248320e-02f,
+             -1.11278053e-02f,  -5.45102032e-03f,   8.93404055e-03f,   3.18493359e-02f,   1.96044985e-02f,  -8.03734921e-03f,
+             -2.67252214e-02f,  -6.50947494e-03f,  -2.96504307e-03f,  -8.13575182e-03f,  -1.61533877e-02f,  -1.08344192e-02f,
+             -1.58293918e-03f,  -4.25631879e-03f,   2.96604331e-03f,   6.64267829e-03f,  -2.96849961e-04f,  -1.67522847e-03f,
+             -3.73681867e-03f,  -9.57102224e-04f,  -5.61268535e-03f,  -4.23375238e-03f,  -2.88702408e-03f,  -9.58751049e-03f,
+             -3.06346756e-03f,   5.24863601e-03f,   6.07963651e-03f,   6.66435924e-04f,   1.32936668e-02f,   1.46999229e-02f,
+              3.78825963e-02f,   2.65077632e-02f,   9.18668322e-03f,   2.89760698e-02f,   2.63433577e-03f,  -2.24664733e-02f,
+             -1.37868728e-02f,   1.00409298e-03f,  -4.76647355e-02f,  -4.33883816e-03f,  -6.50989711e-02f,  -8.00016969e-02f,
+             -3.10397404e-03f,   5.18845441e-03f,   7.53885806e-02f,   1.43908039e-01f,   1.44214779e-01f,   9.61841941e-02f,
+             -3.54520977e-02f,  -4.02072538e-03f,  -4.60376181e-02f,  -5.96779436e-02f,   2.40116869e-03f,   1.13145551e-02f,
+              5.90945147e-02f,   1.08626567e-01f,   1.09442234e-01f,   7.64640868e-02f,  -1.02366591e-02f,  -4.85609751e-03f,
+             -2.20326567e-03f,  -1.80431418e-02f,   2.26235855e-02f,   3.79817076e-02f,   3.11343577e-02f,   3.87717001e-02f,
+              4.17428426e-02f,   4.50069420e-02f,  -2.66044168e-04f,  -1.09706856e-02f,   3.24894898e-02f,  -2.85011157e-03f,
+              6.49489835e-02f,   1.02867886e-01f,   4.21049148e-02f,   2.27433667e-02f,   3.08490973e-02f,   6.84595555e-02f,
+              1.54464999e-02f,  -4.85395518e-04f,   2.67730486e-02f,   2.55104750e-02f,   1.22315576e-02f,   1.60883591e-02f,
+             -1.72281545e-02f,  -4.28445563e-02f,  -4.15436514e-02f,  -1.94334779e-02f,   5.72196255e-03f,   1.23236957e-03f,
+              5.67947142e-03f,   9.76011623e-03f,  -3.85012478e-03f,  -7.30727986e-03f,  -1.17595261e-02f,  -1.87016744e-02f,
+             -1.92652512e-02f,  -1.59614366e-02f,   1.59457941e-02f,  -6.46248343e-04f,   2.80741304e-02f,   2.63032056e-02f,
+              1.34884603e-02f,   1.79721639e-02f,  -1.72322597e-02f,  -4.39385176e-02f,  -4.24880944e-02f,  -1.91609133e-02f,
+              2.43284460e-02f,   3.09299282e-03f,   3.05906832e-02f,   4.10263538e-02f,  -3.62903392e-03f,  -1.09007023e-02f,
+             -4.18239199e-02f,  -7.52123818e-02f,  -7.60192648e-02f,  -5.45437112e-02f,   3.24668959e-02f,   4.53613885e-03f,
+              3.95981073e-02f,   5.48403487e-02f,  -7.26723904e-03f,  -1.83846653e-02f,  -5.73704615e-02f,  -1.01191431e-01f,
+             -1.02570638e-01f,  -7.53244236e-02f,   4.90752794e-03f,   1.87299144e-03f,   2.42199027e-03f,   8.55009258e-03f,
+             -8.14518798e-03f,  -1.39335757e-02f,  -1.31931808e-02f,  -1.76753569e-02f,  -1.87628493e-02f,  -1.87530313e-02f,
+              7.07985274e-03f,   1.84250262e-03f,  -2.10083891e-02f,  -2.10238416e-02f,  -2.39822944e-03f,   1.22442869e-02f,
+              2.28115730e-02f,   3.39872167e-02f,   3.73438783e-02f,   1.55666666e-02f,   6.58113090e-03f,   1.71271234e-03f,
+             -1.95285063e-02f,  -1.95428710e-02f,  -2.22929241e-03f,   1.13817705e-02f,   2.12046709e-02f,   3.15930732e-02f,
+              3.47132869e-02f,   1.44701134e-02f,  -1.07492192e-03f,  -2.79744039e-04f,   3.18966783e-03f,   3.19201406e-03f,
+              3.64119100e-04f,  -1.85902929e-03f,  -3.46344220e-03f,  -5.16022136e-03f,  -5.66985784e-03f,  -2.36346060e-03f,
+              1.33250526e-03f,   3.46779037e-04f,  -3.95400729e-03f,  -3.95691581e-03f,  -4.51372878e-04f,   2.30450812e-03f,
+              4.29338589e-03f,   6.39676396e-03f,   7.02852430e-03f,   2.92981602e-03f,   3.28001892e-03f,   8.53611506e-04f,
+             -9.73295886e-03f,  -9.74011794e-03f,  -1.11107377e-03f,   5.67264576e-03f,   1.05683543e-02f,   1.57459099e-02f,
+              1.73010156e-02f,   7.21186819e-03f,   3.40155768e-03f,   8.85241490e-04f,  -1.00936070e-02f,  -1.01010315e-02f,
+             -1.15224381e-03f,   5.88284153e-03f,   1.09599577e-02f,   1.63293630e-02f,   1.79420915e-02f,   7.47909863e-03f,
+             -4.75452887e-03f,  -1.23734667e-03f,   1.41083430e-02f,   1.41187217e-02f,   1.61054928e-03f,  -8.22274480e-03f,
+             -1.53192859e-02f,  -2.28243750e-02f,  -2.50785667e-02f,  -1.04539134e-02f,  -4.54254169e-03f,  -1.18217780e-03f,
+              1.34793026e-02f,   1.34892175e-02f,   1.53874059e-03f,  -7.85612129e-03f,  -1.46362530e-02f,  -2.18067169e-02f,
+             -2.39604022e-02f,  -9.98781063e-03f,  -5.50534390e-03f,  -1.43274327e-03f,   1.63362734e-02f,   1.63482893e-02f,
+              1.86488032e-03f,  -9.52124503e-03f,  -1.77384429e-02f,  -2.64287032e-02f,  -2.90388688e-02f,  -1.21047515e-02f,
+             -1.52669312e-03f,  -3.97315627e-04f,   4.53023007e-03f,   4.53356234e-03f,   5.17152075e-04f,  -2.64034723e-03f,
+             -4.91906703e-03f,  -7.32897315e-03f,  -8.05280078e-03f,  -3.35678202e-03f,   1.22733898e-02f,   3.44490772e-03f,
+             -4.39336430e-03f,   7.53288204e-03f,   9.47344932e-04f,  -1.60537381e-02f,   3.67929414e-03f,   4.61545847e-02f,
+              4.06959578e-02f,   1.72947980e-02f,   2.04954646e-03f,   5.75268758e-04f,  -7.33652560e-04f,   1.25792401e-03f,
+              1.58198134e-04f,  -2.68083066e-03f,   6.14409219e-04f,   7.70740304e-03f,   6.79586083e-03f,   2.88807671e-03f,
+             -2.15392709e-02f,  -6.04566466e-03f,   7.71016534e-03f,  -1.32198846e-02f,  -1.66254956e-03f,   2.81736199e-02f,
+             -6.45700283e-03f,  -8.09993148e-02f,  -7.14196563e-02f,  -3.03516276e-02f,  -8.47428758e-03f,  -2.37857178e-03f,
+              3.03344312e-03f,  -5.20115532e-03f,  -6.54103991e-04f,   1.10844672e-02f,  -2.54040607e-03f,  -3.18679065e-02f,
+             -2.80989390e-02f,  -1.19413706e-02f,   1.35265803e-02f,   3.79665452e-03f,  -4.84195445e-03f,   8.30203667e-03f,
+              1.04407477e-03f,  -1.76929254e-02f,   4.05497337e-03f,   5.08672595e-02f,   4.48512696e-02f,   1.90607067e-02f,
+              1.99218281e-02f,   5.59167890e-03f,  -7.13118771e-03f,   1.22271664e-02f,   1.53770414e-03f,  -2.60579847e-02f,
+              5.97212883e-03f,   7.49168471e-02f,   6.60565570e-02f,   2.80724391e-02f,   2.61982176e-02f,   7.35334260e-03f,
+             -9.37787443e-03f,   1.60793457e-02f,   2.02215929e-03f,  -3.42675745e-02f,   7.85365328e-03f,   9.85194668e-02f,
+              8.68677273e-02f,   3.69166881e-02f,   2.11127792e-02f,   5.92595665e-03f,  -7.55749876e-03f,   1.29581215e-02f,
+              1.62962999e-03f,  -2.76157632e-02f,   6.32914994e-03f,   7.93954730e-02f,   7.00054988e-02f,   2.97506452e-02f,
+             -2.44565378e-03f,  -6.86448591e-04f,   8.75442522e-04f,  -1.50103774e-03f,  -1.88772421e-04f,   3.19894380e-03f,
+             -7.33153545e-04f,  -9.19698086e-03f,  -8.10926873e-03f,  -3.44624324e-03f,  -1.36734135e-02f,  -3.83786787e-03f,
+              4.89451457e-03f,  -8.39215703e-03f,  -1.05540839e-03f,   1.78849846e-02f,  -4.09899047e-03f,  -5.14194332e-02f,
+             -4.53381389e-02f,  -1.92676131e-02f,   2.71102823e-02f,  -3.99873173e-03f,  -1.98942386e-02f,  -7.84516931e-02f,
+             -5.45848608e-02f,  -2.92544793e-02f,  -1.06723951e-02f,  -6.13492972e-04f,  -7.76260742e-04f,  -9.37967096e-03f,
+              7.88867846e-03f,  -3.49750952e-03f,  -5.07738115e-03f,  -7.35142827e-02f,  -4.62190174e-02f,  -8.06653779e-03f,
+             -1.10992203e-02f,  -4.10937667e-02f,  -2.21810061e-02f,  -5.52476442e-04f,  -2.15267818e-02f,   4.92543774e-03f,
+              1.22303367e-02f,  -6.50120825e-02f,  -2.92612594e-02f,   4.85029630e-02f,   4.65069152e-02f,  -3.92661579e-02f,
+             -3.80350240e-02f,   7.03874975e-03f,   7.15251733e-03f,  -3.77307204e-03f,  -3.30541213e-03f,  -1.89715456e-02f,
+             -1.46868210e-02f,  -1.66098718e-02f,  -2.38992460e-02f,  -2.19255686e-02f,  -5.51808113e-03f,  -3.89070890e-04f,
+             -4.91964538e-03f,  -1.97575591e-03f,   6.94925431e-03f,   9.26820934e-02f,   5.38786538e-02f,  -1.54140200e-02f,
+             -3.38874348e-02f,   1.11734876e-02f,   2.04416513e-02f,   3.20707704e-03f,  -1.40360836e-02f,  -6.98065967e-04f,
+              1.36268111e-02f,   1.15824021e-01f,   7.03341067e-02f,  -5.28728217e-03f,  -3.01821046e-02f,   9.44528263e-03f,
+              1.94776468e-02f,   6.43687416e-03f,   2.12004855e-02f,  -8.25665891e-03f,  -1.05686514e-02f,   1.39331156e-02f,
+             -1.68154540e-03f,  -5.08146472e-02f,  -6.20933622e-02f,  -1.08649423e-02f,   1.33785056e-02f,  -3.93204624e-03f,
+              1.92782097e-02f,  -7.08137522e-04f,  -1.46685708e-02f,  -2.36635073e-03f,  -6.99598249e-03f,  -2.23026965e-02f,
+             -1.64125499e-03f,   4.00005803e-02f,   2.18847170e-02f,  -8.71372595e-03f,  -1.26251336e-02f,   1.09736808e-02f,
+              1.65176275e-03f,  -2.91351713e-02f,  -8.16225819e-03f,   5.27060330e-02f,   8.72508362e-02f,   4.77272682e-02f,
+             -1.79209840e-03f,  -2.17999658e-03f,   8.07687640e-03f,   2.33297105e-04f,  -6.70917192e-03f,  -1.13930674e-02f,
+             -8.68079625e-03f,  -6.05119625e-03f,   5.37388818e-03f,   1.67139601e-02f,   6.84926519e-03f,  -3.98290809e-03f,
+             -8.89948162e-04f,  -4.44203522e-03f,   4.06056782e-03f,   1.84699864e-04f,   9.96245630e-03f,   2.14025322e-02f,
+              1.19449263e-02f,   7.91809242e-03f,   9.67587158e-03f,  -4.15616715e-03f,  -4.62664384e-03f,  -1.76640935e-02f,
+              1.88785307e-02f,   5.94229111e-03f,   3.53092439e-02f,   7.78236687e-02f,   4.32044417e-02f,   2.66991835e-02f,
+              3.45674008e-02f,  -1.51107926e-02f,  -2.93586180e-02f,  -4.33137789e-02f,   9.15268362e-02f,   1.00819446e-01f,
+              1.52476365e-02f,   7.01780170e-02f,   3.48018892e-02f,  -1.38225276e-02f,   2.00162996e-02f,  -1.35932993e-02f,
+             -2.37033274e-02f,  -1.72661971e-02f,   6.66194186e-02f,   9.76453125e-02f,  -4.14415859e-02f,  -5.23987859e-02f,
+             -3.35170329e-02f,  -5.83309084e-02f,  -3.51521447e-02f,   1.02092111e-02f,  -2.90464647e-02f,  -4.18995135e-02f,
+              9.01616737e-02f,   1.00622699e-01f,   1.21898614e-02f,   6.35568053e-02f,   3.11126187e-02f,  -1.62166879e-02f,
+              1.70392320e-02f,  -1.23075722e-02f,  -2.82066446e-02f,  -5.18581048e-02f,   9.21459571e-02f,   8.74630138e-02f,
+              4.57511172e-02f,   1.30527258e-01f,   6.90877438e-02f,   1.40136760e-02f,   4.89212200e-02f,  -2.53173374e-02f,
+             -8.75341985e-03f,  -1.25130974e-02f,   2.71243174e-02f,   3.04279253e-02f,   3.32829403e-03f,   1.84529796e-02f,
+              8.98034032e-03f,  -5.19001298e-03f,   4.80536418e-03f,  -3.57294176e-03f,   2.39028898e-03f,   7.58843496e-03f,
+             -9.12138913e-03f,  -4.48088115e-03f,  -1.35740647e-02f,  -3.07355989e-02f,  -1.69701651e-02f,  -9.69731901e-03f,
+             -1.34026399e-02f,   5.96710388e-03f,   1.52670294e-02f,   9.71377548e-03f,  -4.23303917e-02f,  -6.41834959e-02f,
+              3.09644043e-02f,   4.24177200e-02f,   2.64852662e-02f,   4.13195267e-02f,   2.67195627e-02f,  -8.25940166e-03f,
+              1.00724483e-02f,  -3.95641755e-03f,  -2.36672629e-02f,  -5.18568866e-02f,   5.18986285e-02f,   9.18347985e-02f,
+              5.35469986e-02f,   5.48774451e-02f,   4.76699360e-02f,  -1.78516153e-02f,  -1.56725273e-02f,  -1.95857938e-02f,
+              1.25694862e-02f,   2.36197971e-02f,  -1.24737229e-02f,   1.33641006e-04f,   3.16553861e-02f,   6.18995260e-03f,
+             -8.39898735e-03f,  -8.76680075e-04f,  -6.42552301e-02f,  -7.71941394e-02f,   3.65926214e-02f,   9.30771455e-02f,
+              9.40941088e-03f,   8.78212675e-02f,   1.67982459e-01f,   3.33347023e-02f,  -2.64251120e-02f,  -9.77290329e-03f,
+             -8.09598565e-02f,  -1.02772944e-01f,   7.26209655e-02f,   1.23949066e-01f,  -9.56033766e-02f,  -4.42329459e-02f,
+              1.43859819e-01f,   2.78798826e-02f,  -4.75096814e-02f,  -1.34827709e-03f,  -4.07760665e-02f,  -6.06584102e-02f,
+              7.93823823e-02f,   7.32030198e-02f,  -2.21633390e-01f,  -2.72325546e-01f,  -3.69899310e-02f,  -8.75496492e-03f,
+             -4.68769409e-02f,   1.70233622e-02f,   3.43142636e-02f,   4.22361679e-02f,  -2.44117975e-02f,  -5.09319715e-02f,
+              1.47127304e-02f,  -1.84505116e-02f,  -7.72557259e-02f,  -1.52080739e-02f,   1.67227294e-02f,   3.20496340e-03f,
+              1.47143072e-02f,   2.21906919e-02f,  -3.00974324e-02f,  -2.67812237e-02f,   8.58615339e-02f,   1.06750861e-01f,
+              1.70599502e-02f,   3.93244857e-03f,   1.76941473e-02f,  -6.74337335e-03f,  -2.51979884e-02f,  -2.55719405e-02f,
+             -8.26621335e-03f,   3.08077428e-02f,   9.53470990e-02f,   1.66549027e-01f,   1.23699628e-01f,   2.51168236e-02f,
+              1.76173961e-03f,  -1.31853595e-02f,   2.00132243e-02f,   3.09976060e-02f,  -4.48606685e-02f,  -3.74135599e-02f,
+              1.32687107e-01f,   1.68118730e-01f,   3.32377665e-02f,   7.43865687e-03f,   2.61701029e-02f,  -1.07947849e-02f,
+              1.96983330e-02f,   2.61982344e-02f,  -2.34078225e-02f,  -3.16024981e-02f,   4.65174988e-02f,   4.42825779e-02f,
+             -2.03306489e-02f,  -3.72739835e-03f,   1.46359280e-02f,  -2.04506284e-03f,   1.25437472e-02f,   1.72529649e-02f,
+             -1.76493078e-02f,  -2.08147857e-02f,   4.07401733e-02f,   4.42239419e-02f,  -5.93217462e-03f,  -9.12561896e-04f,
+              1.07907681e-02f,  -2.43680133e-03f,  -5.28784608e-03f,  -9.54519492e-04f,   2.52451748e-03f,   1.22622978e-02f,
+              3.13131809e-02f,   3.86334434e-02f,   5.85625786e-03f,  -1.06277093e-02f,  -9.59060900e-03f,   4.64149896e-04f,
+              1.50194308e-02f,  -2.36519612e-02f,   2.95238663e-02f,   1.70707360e-01f,   1.55010372e-01f,   3.92156579e-02f,
+              9.79912356e-02f,   1.10978469e-01f,  -3.69287878e-02f,  -9.16978344e-02f,   4.85998988e-02f,  -3.12598124e-02f,
+              3.25183012e-02f,   1.99408278e-01f,   8.26469287e-02f,  -1.28894731e-01f,   1.20235227e-01f,   2.20361039e-01f,
+             -9.29615088e-03f,  -1.41507968e-01f,   2.93847136e-02f,  -1.36691751e-03f,  -4.74327104e-03f,  -1.61307380e-02f,
+             -1.12276234e-01f,  -1.76995575e-01f,  -3.53743113e-03f,   7.95029178e-02f,   3.70571278e-02f,  -2.54498720e-02f,
+             -8.78544711e-03f,   3.84734734e-03f,  -3.36807803e-03f,  -2.19863337e-02f,   1.74867862e-03f,   3.34900841e-02f,
+             -1.38934627e-02f,  -3.43078487e-02f,  -2.70940550e-03f,   1.93976164e-02f,  -9.58434679e-03f,  -6.93156337e-03f,
+              1.18155926e-02f,   6.27783090e-02f,   1.04887724e-01f,   9.94117931e-02f,   3.32302600e-02f,  -3.32266861e-03f,
+             -3.00439391e-02f,  -1.69906709e-02f,  -1.50184091e-02f,  -1.34332739e-02f,   2.20942218e-02f,   1.18421838e-01f,
+              1.88153446e-01f,   1.70305401e-01f,   6.32525012e-02f,   2.67464970e-03f,  -5.33377267e-02f,  -3.54403630e-02f,
+             -1.99013688e-02f,  -7.41416542e-03f,   1.48206912e-02f,   7.59460628e-02f,   1.53214857e-01f,   1.66993409e-01f,
+              3.86572666e-02f,  -2.82865297e-02f,  -4.53976169e-02f,  -1.13549698e-02f,  -1.89490505e-02f,   5.87760145e-03f,
+             -3.89528018e-03f,  -2.85495836e-02f,   2.61708684e-02f,   8.59099329e-02f,  -1.94416791e-02f,  -6.65793344e-02f,
+             -1.17357783e-02f,   3.35396118e-02f,  -8.02494679e-03f,  -5.32467989e-03f,   9.22631286e-03f,   4.88288701e-02f,
+              8.33888575e-02f,   8.05303603e-02f,   2.57405136e-02f,  -4.25029499e-03f,  -2.39895489e-02f,  -1.25837717e-02f,
+              5.23296371e-03f,  -4.90858976e-04f,  -5.86753618e-03f,   2.73508648e-03f,  -1.22042364e-02f,  -6.20371616e-03f,
+             -1.34806335e-02f,  -1.64358746e-02f,   1.87527286e-04f,   9.90213943e-04f,  -5.68498857e-03f,   7.52838387e-04f,
+              7.05087651e-03f,   1.96007993e-02f,   3.75108309e-02f,   9.54693835e-03f,  -7.15013826e-03f,   2.60441378e-03f,
+             -5.89377480e-03f,  -1.12447487e-02f,  -6.83618803e-03f,   2.52160220e-03f,  -5.41935489e-03f,  -1.84072554e-03f,
+              9.54895094e-02f,   6.88913185e-03f,   3.22120972e-02f,   8.77880752e-02f,  -7.63886468e-03f,  -3.12024504e-02f,
+              2.54499577e-02f,  -2.03515548e-04f,  -4.99186926e-02f,  -4.74701636e-02f,  -8.97078402e-03f,  -3.98598164e-02f,
+              1.73520073e-02f,   6.16209991e-02f,   5.87177649e-03f,  -1.11802612e-02f,  -1.53891789e-02f,   2.08378746e-03f,
+              1.26603507e-02f,  -8.87121074e-03f,   6.20275959e-02f,   1.76432934e-02f,   4.61051427e-02f,   7.23730251e-02f,
+             -2.76321499e-03f,  -1.26728881e-02f,  -2.89087649e-02f,   3.03997053e-03f,   3.26934159e-02f,   1.12058697e-02f,
+              9.87087935e-02f,   3.74889523e-02f,   4.96934950e-02f,   7.56354555e-02f,  -7.93955475e-03f,  -1.84557699e-02f,
+              2.61585205e-03f,  -3.29466711e-04f,  -2.92625162e-03f,  -4.57939412e-03f,  -1.35841509e-02f,  -3.82055133e-03f,
+             -1.22599176e-03f,  -5.14864037e-03f,   1.69077446e-03f,   3.58428992e-03f,   1.32814404e-02f,  -1.13042071e-03f,
+             -1.75218452e-02f,  -1.14901057e-02f,  -3.84934023e-02f,  -1.82638988e-02f,  -1.38432477e-02f,  -1.85885038e-02f,
+              4.02207673e-03f,   6.21051760e-03f,  -1.49508128e-02f,   9.76733791e-05f,   3.00415866e-02f,   3.35910134e-02f,
+              8.17329902e-03f,   2.41848659e-02f,  -1.63772013e-02f,  -4.28560711e-02f,  -4.59850114e-03f,   5.20755537e-03f,
+             -3.53260078e-02f,   8.93215474e-04f,   6.38137013e-02f,   5.40072024e-02f,   2.99621634e-02f,   5.32920435e-02f,
+             -6.26742933e-03f,  -5.11996225e-02f,  -7.86626153e-03f,   9.51950252e-03f,  -8.32373276e-03f,   4.63817595e-03f,
+             -1.14290044e-02f,   1.14482688e-02f,  -2.05967091e-02f,  -3.69278416e-02f,  -1.01687126e-01f,  -5.82292527e-02f,
+              2.26592924e-03f,  -1.85981870e-03f,  -4.25175950e-03f,  -8.54468532e-03f,  -5.42457141e-02f,  -2.29887813e-02f,
+             -4.70898254e-03f,  -2.06441693e-02f,  -8.89412910e-02f,  -4.27301116e-02f,   7.15885661e-04f,  -7.75430398e-03f,
+              1.31701771e-03f,  -2.84313485e-02f,  -8.40857029e-02f,  -2.90407501e-02f,   5.04631326e-02f,   1.81642957e-02f,
+             -5.84044270e-02f,  -5.96756069e-03f,   4.53966204e-04f,  -1.23872394e-02f,  -3.80079931e-04f,  -5.12262108e-03f,
+             -4.11132760e-02f,  -3.46242599e-02f,  -1.29684703e-02f,  -1.02729835e-02f,  -3.16175371e-02f,  -1.71506051e-02f,
+             -9.97952535e-04f,  -5.51198004e-03f,   6.32464280e-03f,   3.29886121e-03f,   1.11020086e-02f,  -2.52948422e-02f,
+             -1.24371359e-02f,   1.64824482e-02f,   8.57756883e-02f,   3.89690213e-02f,  -2.90218857e-03f,   2.21115537e-03f,
+              9.34010278e-03f,   4.39882139e-03f,   2.90465578e-02f,  -2.02653017e-02f,  -5.16287191e-03f,   3.09852902e-02f,
+              1.32812753e-01f,   6.40804768e-02f,  -3.53356707e-03f,   4.80102981e-03f,  -2.62868335e-03f,   1.55697996e-02f,
+              1.29522886e-02f,  -1.63146406e-02f,  -5.44129536e-02f,  -3.03237699e-02f,  -8.44856724e-03f,  -2.37325914e-02f,
+             -1.11987733e-03f,   2.49744277e-03f,  -8.36710446e-03f,   2.67359894e-02f,   7.90286139e-02f,   6.06428869e-02f,
+             -3.89477015e-02f,  -3.68847363e-02f,  -3.12639698e-02f,  -3.58211324e-02f,   2.78428337e-03f,   1.09753655e-02f,
+             -7.33122462e-03f,   3.48702352e-03f,   4.82702777e-02f,   8.43389407e-02f,   3.57381366e-02f,  -4.82716318e-03f,
+             -5.95663227e-02f,  -2.26604007e-02f,   5.16169658e-03f,   5.55840041e-03f,  -4.55339346e-03f,   3.39325611e-03f,
+              1.53106544e-02f,   3.06151565e-02f,   3.87898088e-03f,  -1.19645651e-02f,  -4.33963649e-02f,  -2.22891178e-02f,
+              2.20346102e-03f,   1.72121543e-03f,   4.46428033e-03f,   6.35509845e-03f,   2.65309624e-02f,   1.85309555e-02f,
+             -1.07535673e-02f,  -7.48458365e-03f,   8.27211794e-03f,   2.51364848e-03f,   1.46960681e-02f,   1.17491810e-02f,
+             -5.08005777e-03f,  -7.86846131e-03f,  -2.41406523e-02f,  -1.44541012e-02f,   8.99479631e-03f,   6.06826181e-03f,
+             -8.80845077e-03f,  -1.60935265e-03f,  -1.15822256e-02f,  -9.90964938e-03f,  -2.35607140e-02f,  -3.95123959e-02f,
+             -8.32750797e-02f,  -3.55852693e-02f,   2.63439957e-02f,   1.65329091e-02f,  -3.79853733e-02f,  -1.53207476e-03f,
+             -2.93403100e-02f,  -2.95528695e-02f,  -6.23031473e-03f,  -9.26463213e-03f,  -3.32688056e-02f,  -2.17419099e-02f,
+              1.29939299e-02f,   8.92451964e-03f,  -1.11689344e-02f,  -2.73101451e-03f,  -1.73166469e-02f,  -1.42479436e-02f,
+              2.24691425e-02f,   4.22774553e-02f,   3.57546732e-02f,  -1.39337135e-02f,  -1.72524725e-03f,   1.90557912e-03f,
+              3.18614990e-02f,  -7.56759010e-03f,  -9.12163500e-03f,   3.21148266e-03f,   3.34382989e-02f,   5.94142787e-02f,
+              8.64859819e-02f,   1.57474335e-02f,  -2.03999877e-02f,  -1.06328996e-02f,   5.07418253e-02f,  -4.38096048e-03f,
+              1.47023145e-02f,   2.38113552e-02f,   2.61531658e-02f,   4.40459736e-02f,   9.06717554e-02f,   3.75642702e-02f,
+             -2.82961484e-02f,  -1.76371466e-02f,   4.19884734e-02f,   1.33540668e-03f,   3.10677588e-02f,   3.17944288e-02f,
+              1.62061173e-02f,   2.72643436e-02f,   5.64638227e-02f,   2.35819370e-02f,  -1.76830199e-02f,  -1.10415881e-02f,
+              2.60464363e-02f,   8.84987065e-04f,   1.94877386e-02f,   1.98607929e-02f,  -6.39844174e-03f,  -1.12767359e-02f,
+             -1.74253937e-02f,  -3.97397205e-03f,   4.37312154e-03f,   2.38927524e-03f,  -9.79706366e-03f,   6.57106866e-04f,
+             -3.55789531e-03f,  -5.05747646e-03f,  -2.03533284e-02f,  -3.61585580e-02f,  -5.26987650e-02f,  -9.64681711e-03f,
+              1.24472482e-02f,   6.49481500e-03f,  -3.08913123e-02f,   2.65499507e-03f,  -8.99680983e-03f,  -1.45257162e-02f,
+              2.35128831e-02f,   6.33628294e-02f,   8.06991085e-02f,  -6.92417175e-02f,  -7.84150064e-02f,  -8.75095651e-02f,
+             -1.16407052e-01f,   4.40849178e-02f,   8.61187354e-02f,   3.92911769e-02f,   3.99134830e-02f,   7.77967349e-02f,
+              7.12313950e-02f,  -8.30744505e-02f,  -4.98128645e-02f,  -4.72686663e-02f,  -1.19926132e-01f,   3.01599577e-02f,
+              8.90242606e-02f,   5.45414239e-02f,   4.03864793e-02f,   5.70635945e-02f,   2.42315196e-02f,  -5.89828566e-02f,
+              1.02036903e-02f,   2.58618612e-02f,  -6.48303777e-02f,  -1.98773318e-03f,   4.84874249e-02f,   4.63431813e-02f,
+              6.04445040e-02f,   5.80170229e-02f,  -2.42424868e-02f,  -5.65629415e-02f,   9.19212922e-02f,   1.31903321e-01f,
+             -2.55511533e-02f,  -4.40843701e-02f,   1.99673399e-02f,   5.81738092e-02f,   6.62966594e-02f,   7.79830068e-02f,
+              5.11228340e-03f,  -7.86549225e-02f,   6.06622957e-02f,   9.58458632e-02f,  -6.54736459e-02f,  -2.68143658e-02f,
+              4.94596884e-02f,   6.96666241e-02f,   4.30244654e-02f,   4.43843603e-02f,  -1.04337903e-02f,  -4.38371375e-02f,
+              5.67877926e-02f,   8.33814368e-02f,  -2.62460429e-02f,  -2.67444272e-02f,   2.01433189e-02f,   4.26693223e-02f,
+              1.51395472e-02f,   5.15850857e-02f,   7.57928714e-02f,  -5.70744686e-02f,  -8.06796104e-02f,  -9.30527672e-02f,
+             -1.03104778e-01f,   4.45769876e-02f,   7.61681348e-02f,   2.97045931e-02f,   1.03593478e-02f,   3.37314457e-02f,
+              4.84018922e-02f,  -3.72401997e-02f,  -5.08227125e-02f,  -5.83429486e-02f,  -6.64630681e-02f,   2.81514600e-02f,
+              4.91108112e-02f,   1.96859725e-02f,  -1.26438471e-03f,   8.37177783e-03f,   2.16847379e-02f,  -9.91645921e-03f,
+             -2.87497919e-02f,  -3.53775546e-02f,  -2.44821291e-02f,   1.53101925e-02f,   1.79924909e-02f,   2.69807363e-03f,
+             -1.82701554e-02f,  -2.00156178e-02f,   1.85014680e-03f,   1.99677590e-02f,  -2.08457969e-02f,  -3.14329825e-02f,
+              1.41935721e-02f,   9.60370898e-03f,  -1.07970741e-02f,  -1.85963884e-02f,   2.75158957e-02f,   2.78158132e-02f,
+              1.94901451e-02f,   1.40736660e-03f,  -1.65571030e-02f,  -1.26469629e-02f,  -5.29996725e-03f,  -1.02001093e-02f,
+             -5.56457555e-03f,  -5.88663272e-04f,   2.91790236e-02f,   2.26458395e-03f,  -1.54434713e-02f,  -7.25846412e-03f,
+              2.10097898e-02f,   8.14330485e-03f,  -3.79533917e-02f,  -2.14976836e-02f,   2.95835193e-02f,   1.23152370e-02f,
+              2.80581880e-02f,  -5.05281670e-04f,  -2.11256146e-02f,  -1.74402702e-03f,   4.05551791e-02f,   2.49955878e-02f,
+             -3.92247364e-02f,  -2.83212010e-02f,   2.09973529e-02f,   8.36067554e-03f,   4.01340500e-02f,  -1.60982423e-02f,
+             -5.15980385e-02f,  -5.21062780e-03f,   8.58242437e-02f,   5.34110852e-02f,  -7.41953924e-02f,  -4.89477292e-02f,
+              4.60753441e-02f,   1.75293088e-02f,   3.77678610e-02f,  -2.99611688e-02f,  -6.53751343e-02f,  -1.59955695e-02f,
+              8.45516771e-02f,   4.63654138e-02f,  -8.78810585e-02f,  -4.50205058e-02f,   7.40261599e-02f,   2.84730904e-02f,
+              2.25853976e-02f,  -1.73614100e-02f,  -3.83929797e-02f,  -9.30850022e-03f,   4.99885008e-02f,   2.74805222e-02f,
+             -5.18879145e-02f,  -2.67894734e-02f,   4.34034131e-02f,   1.67019349e-02f,   1.89672399e-03f,  -7.87722878e-03f,
+             -6.88576000e-03f,  -1.37279080e-02f,  -1.62548255e-02f,  -1.94579810e-02f,  -1.27932280e-02f,   7.00705312e-03f,
+              3.15454714e-02f,   1.29418438e-02f,  -1.82923172e-02f,  -1.92544833e-02f,  -8.66161566e-03f,  -1.30873919e-02f,
+             -2.02343930e-02f,  -2.03594044e-02f,   1.72701909e-03f,   1.93633568e-02f,   2.60660537e-02f,   1.00410441e-02f,
+             -1.19146174e-02f,  -1.09785199e-02f,  -4.16229432e-03f,  -6.69184560e-03f,  -1.17814532e-02f,  -1.12162698e-02f,
+              3.07991682e-03f,   1.17858844e-02f,   1.25535801e-02f,   4.75992495e-03f,   1.49185047e-03f,   3.05640791e-03f,
+              4.96523920e-03f,  -3.58911860e-03f,  -1.43911354e-02f,  -1.21801225e-02f,   1.23952073e-03f,   4.55805846e-03f,
+              5.15347300e-03f,   2.47953879e-03f,   1.03870695e-02f,  -4.24095849e-03f,  -4.07215580e-03f,   1.66291017e-02f,
+              1.33781638e-02f,  -3.12471129e-02f,  -5.10856472e-02f,  -4.40917201e-02f,  -1.36227692e-02f,  -6.16624858e-03f,
+              5.78513974e-03f,  -2.31260364e-03f,  -1.20232475e-03f,   1.05557414e-02f,   7.89604429e-03f,  -1.04563581e-02f,
+             -2.10986119e-02f,  -2.39696801e-02f,  -8.57200287e-03f,  -3.40631371e-03f,   5.82292909e-04f,  -1.04376250e-05f,
+              4.67301439e-03f,   6.88386988e-03f,   2.79659615e-03f,   3.01984623e-02f,   3.09579000e-02f,   2.30110454e-04f,
+             -5.29260421e-03f,  -2.16829809e-04f,   3.29196977e-04f,  -8.77601851e-05f,   8.76790029e-04f,   1.74842903e-03f,
+              8.44003749e-04f,   5.56652667e-03f,   5.32187102e-03f,  -8.42917769e-04f,  -1.36117497e-03f,  -1.68984698e-04f,
+              7.83969928e-03f,  -3.27781960e-03f,  -4.73231915e-03f,   1.05365813e-02f,   9.40456800e-03f,  -3.43974158e-02f,
+             -5.00040948e-02f,  -3.41929160e-02f,  -8.74905568e-03f,  -4.69761901e-03f,   1.56258419e-02f,  -5.99269150e-03f,
+              2.22333171e-03f,   3.51546444e-02f,   2.36119106e-02f,   7.41995126e-03f,  -1.92360468e-02f,  -6.17270097e-02f,
+             -2.82084439e-02f,  -9.05673951e-03f,   8.54687206e-03f,  -3.42338136e-03f,  -1.92245375e-03f,   1.54174017e-02f,
+              1.16044562e-02f,  -1.64008196e-02f,  -3.21793258e-02f,  -3.54929864e-02f,  -1.25290835e-02f,  -5.03627490e-03f,
+             -1.31114130e-03f,   3.01229651e-04f,  -4.53370716e-03f,  -8.22852645e-03f,  -3.79647128e-03f,  -2.89604329e-02f,
+             -2.83837393e-02f,   2.78303260e-03f,   6.38380414e-03f,   6.45658816e-04f,  -1.59945376e-02f,   6.40243292e-03f,
+              3.51030147e-03f,  -2.89580654e-02f,  -2.17529517e-02f,   3.01228631e-02f,   5.96172549e-02f,   6.63730949e-02f,
+              2.35275365e-02f,   9.42254253e-03f,  -1.21513736e-02f,   4.81489394e-03f,   1.60675542e-03f,  -2.32872982e-02f,
+             -1.69688184e-02f,   1.59745142e-02f,   3.79772000e-02f,   4.98405993e-02f,   1.88538954e-02f,   7.13062799e-03f,
+             -1.11436129e-04f,  -1.93554480e-02f,  -1.60620343e-02f,   8.68957397e-03f,   1.82354208e-02f,   4.31653159e-03f,
+             -4.21229713e-02f,  -4.45497409e-02f,  -7.59905064e-03f,  -1.21218916e-02f,  -1.22882901e-02f,  -1.46169197e-02f,
+              2.33818330e-02f,   1.15696229e-02f,  -2.10154373e-02f,   4.42406796e-02f,   8.94432440e-02f,   6.49151485e-03f,
+             -2.06994619e-02f,  -1.48830935e-02f,  -2.20938195e-02f,  -6.44466607e-03f,   5.88326007e-02f,   1.19432583e-02f,
+             -5.67984767e-02f,   7.55026489e-02f,   2.05118418e-01f,   5.77026829e-02f,  -2.95690540e-02f,  -1.43899657e-02f,
+             -1.43937976e-03f,   1.53371943e-02f,   1.71727538e-02f,  -6.25877781e-03f,  -1.88041739e-02f,   1.70947565e-03f,
+              4.85563390e-02f,   4.03250344e-02f,   4.14871238e-03f,   8.88822787e-03f,   7.19010364e-03f,  -6.93776412e-04f,
+             -2.15091296e-02f,  -2.64029345e-03f,   2.11596061e-02f,  -2.40027178e-02f,  -7.29866028e-02f,  -2.52554901e-02f,
+              8.54670722e-03f,   2.94254022e-03f,  -7.46763404e-03f,  -3.00192367e-02f,  -3.68489791e-03f,   1.64701343e-02f,
+              7.48910941e-03f,   3.11903041e-02f,   7.14688934e-03f,  -4.51043695e-02f,  -2.07282491e-02f,  -2.22246982e-02f,
+             -8.05541314e-03f,  -3.17210481e-02f,  -3.41532798e-03f,   1.74713042e-02f,   7.44497264e-03f,   3.35106663e-02f,
+              9.18577798e-03f,  -4.71206084e-02f,  -2.21049245e-02f,  -2.35618204e-02f,   2.59763305e-03f,  -2.13200357e-02f,
+             -2.56081056e-02f,   8.45538918e-03f,   2.78404653e-02f,  -4.38024523e-03f,  -7.34267309e-02f,  -5.80178536e-02f,
+             -5.03550377e-03f,  -1.20752752e-02f,  -5.86659042e-03f,  -5.65936277e-03f,   1.22794108e-02f,   4.93446784e-03f,
+             -1.12973135e-02f,   2.08524354e-02f,   4.56472225e-02f,   6.15987694e-03f,  -9.37367789e-03f,  -6.28292141e-03f,
+             -3.59495031e-03f,   1.29714822e-02f,   2.14422308e-02f,  -4.31784801e-03f,  -2.26807483e-02f,   9.42962989e-03f,
+              6.46891594e-02f,   4.19240184e-02f,   5.94150741e-04f,   6.40116399e-03f,  -4.46967557e-02f,  -1.81011096e-01f,
+             -1.53431773e-01f,  -5.31518608e-02f,  -5.70302494e-02f,  -6.55570030e-02f,  -5.72941452e-02f,  -1.60468683e-01f,
+             -1.55438602e-01f,  -7.39117265e-02f,  -3.72311510e-02f,  -1.16431087e-01f,  -8.71468186e-02f,  -2.69967206e-02f,
+             -3.01736966e-02f,  -2.99324561e-02f,  -2.24902239e-02f,  -9.71674919e-02f,  -9.87257212e-02f,  -5.12340590e-02f,
+             -1.73559561e-02f,  -1.30686036e-03f,   2.20782515e-02f,   1.40605457e-02f,   1.26622291e-02f,   2.41004881e-02f,
+              2.84326933e-02f,   1.09925969e-02f,   1.40125258e-03f,  -7.94881862e-03f,   1.16183877e-03f,  -4.74880375e-02f,
+             -5.77960014e-02f,  -2.48733982e-02f,  -2.48540584e-02f,  -3.57922241e-02f,  -3.68572362e-02f,  -5.12927547e-02f,
+             -4.26884852e-02f,  -1.37800463e-02f,   3.52622638e-03f,  -4.00373377e-02f,  -5.21946065e-02f,  -2.31304485e-02f,
+             -2.29092650e-02f,  -3.38506326e-02f,  -3.53873447e-02f,  -4.50618528e-02f,  -3.63681093e-02f,  -1.05093475e-02f,
+             -6.54908083e-03f,  -9.79345217e-02f,  -1.07016325e-01f,  -4.37108539e-02f,  -4.43906002e-02f,  -6.09091483e-02f,
+             -6.08617626e-02f,  -9.93997231e-02f,  -8.67111832e-02f,  -3.23127136e-02f,  -6.60145329e-03f,  -1.00957215e-01f,
+             -1.10523179e-01f,  -4.51869629e-02f,  -4.58756424e-02f,  -6.30051345e-02f,  -6.29938543e-02f,  -1.02574475e-01f,
+             -8.94096643e-02f,  -3.32448334e-02f,   6.27548853e-03f,  -6.81596026e-02f,  -8.92269909e-02f,  -3.96083258e-02f,
+             -3.92098650e-02f,  -5.80203906e-02f,  -6.07048310e-02f,  -7.69076943e-02f,  -6.19534664e-02f,  -1.77725200e-02f,
+             -2.83790077e-03f,  -8.63646343e-02f,  -9.83720794e-02f,  -4.10378948e-02f,  -4.14010175e-02f,  -5.79512902e-02f,
+             -5.86463287e-02f,  -8.97522718e-02f,  -7.69024044e-02f,  -2.72165332e-02f,  -1.26722381e-02f,  -3.12517658e-02f,
+             -1.97449233e-02f,  -4.97461157e-03f,  -6.04287023e-03f,  -4.16950975e-03f,  -1.49995275e-03f,  -2.41700970e-02f,
+             -2.61025168e-02f,  -1.49181597e-02f,  -8.00519530e-03f,  -2.99510248e-02f,  -2.19655465e-02f,   2.20508762e-02f,
+              6.02650736e-03f,  -1.01829390e-03f,   3.08625586e-02f,   7.35575706e-03f,  -3.90443355e-02f,  -3.20828930e-02f,
+             -1.02537069e-02f,  -2.87865531e-02f,  -4.48752195e-03f,   6.93169534e-02f,   1.23753371e-02f,  -1.81536060e-02f,
+              4.09977883e-02f,   3.94022837e-02f,  -3.37995812e-02f,  -4.17730324e-02f,  -1.71648040e-02f,  -2.98448782e-02f,
+              3.77827287e-02f,   1.94707334e-01f,   2.96347234e-02f,  -6.26624525e-02f,   7.14396462e-02f,   1.23384327e-01f,
+             -2.55291648e-02f,  -7.12283477e-02f,  -8.03725421e-03f,  -1.65761467e-02f,   1.12676499e-02f,   8.00127834e-02f,
+              1.26113752e-02f,  -2.47640908e-02f,   3.30525562e-02f,   4.96295355e-02f,  -1.63575504e-02f,  -3.31676342e-02f,
+             -5.12258010e-03f,  -7.60293240e-03f,   1.44950775e-02f,   6.36990592e-02f,   9.47791897e-03f,  -2.09945235e-02f,
+              2.15197466e-02f,   4.09037247e-02f,  -5.41176694e-03f,  -2.13494301e-02f,   3.81706818e-03f,   6.40793098e-03f,
+             -8.96723289e-03f,  -4.42802124e-02f,  -6.70138327e-03f,   1.43374372e-02f,  -1.59216281e-02f,  -2.81544663e-02f,
+              5.28964493e-03f,   1.58558097e-02f,   1.35756435e-03f,  -3.23964143e-03f,  -1.68158319e-02f,  -3.94157544e-02f,
+             -5.06637944e-03f,   1.48082972e-02f,  -6.50767703e-03f,  -2.72889882e-02f,  -7.46033154e-03f,   6.03027781e-03f,
+              2.38730502e-03f,   3.40600009e-03f,  -7.09408754e-03f,  -3.02745905e-02f,  -4.48376872e-03f,   1.00256419e-02f,
+             -1.00499848e-02f,  -1.94922052e-02f,   2.28976971e-03f,   9.95932054e-03f,  -2.64176726e-03f,  -7.82926101e-03f,
+             -2.17516557e-03f,   1.60889942e-02f,   2.98774987e-03f,  -3.95104988e-03f,   1.04994858e-02f,   8.85973312e-03f,
+             -9.40670166e-03f,  -1.07331704e-02f,  -3.72622511e-03f,  -9.22708400e-03f,   1.41626236e-03f,   3.04821990e-02f,
+              5.09717548e-03f,  -8.76812171e-03f,   1.50876706e-02f,   1.81819126e-02f,  -1.01939794e-02f,  -1.52678797e-02f,
+             -1.40566519e-02f,  -2.11347658e-02f,  -4.00034823e-02f,  -4.73506227e-02f,  -4.20774147e-02f,  -6.23872457e-03f,
+             -3.64687853e-03f,  -2.92978925e-03f,  -3.38154361e-02f,  -1.54096466e-02f,  -1.43665969e-02f,  -2.38565784e-02f,
+             -3.92100401e-02f,  -9.29120276e-03f,   2.95994487e-02f,  -1.05755432e-02f,  -2.00961381e-02f,  -3.44694313e-03f,
+             -3.86784486e-02f,  -1.97286215e-02f,  -2.12920108e-03f,  -5.30972471e-03f,  -4.49342839e-03f,   2.93757711e-02f,
+              6.14864156e-02f,  -4.86983638e-03f,  -1.58515591e-02f,  -8.66762304e-04f,  -8.97044223e-03f,  -6.05330244e-03f,
+              3.18563217e-03f,   5.77373756e-03f,   8.33503623e-03f,  -6.32643979e-03f,  -2.21351180e-02f,   3.24563752e-03f,
+              7.96677638e-03f,   8.61381588e-04f,   9.45958402e-03f,   5.22803282e-03f,  -7.61560723e-03f,  -1.08931614e-02f,
+             -2.20869519e-02f,  -3.53128947e-02f,  -4.07313965e-02f,  -2.34271819e-03f,   2.06760783e-03f,  -1.47551100e-03f,
+             -1.73034407e-02f,  -7.36569567e-03f,  -1.27622858e-02f,  -2.14157589e-02f,  -3.46656665e-02f,  -4.38396027e-03f,
+              3.34790796e-02f,  -9.81013756e-03f,  -1.94718800e-02f,  -3.10680945e-03f,  -3.47667001e-02f,  -1.79193188e-02f,
+             -2.65241358e-02f,  -4.16261330e-02f,  -7.41875470e-02f,  -5.90819754e-02f,  -2.32018474e-02f,  -1.50223533e-02f,
+             -1.95509326e-02f,  -5.87862777e-03f,  -6.69947341e-02f,  -3.21570560e-02f,  -1.84379239e-02f,  -2.76664067e-02f,
+             -5.25134727e-02f,  -6.30762130e-02f,  -5.69879003e-02f,  -8.07940401e-03f,  -4.37876023e-03f,  -3.83177423e-03f,
+             -4.42534350e-02f,  -2.01142225e-02f,  -9.99266934e-03f,  -1.59444101e-02f,  -2.77545489e-02f,  -1.77127626e-02f,
+             -3.00878019e-04f,  -6.14765845e-03f,  -9.26844217e-03f,  -2.26731529e-03f,  -2.57181525e-02f,  -1.25773838e-02f,
+              1.74797587e-02f,   2.69726124e-02f,   4.92319278e-02f,   4.69022058e-02f,   3.00817825e-02f,   9.04443301e-03f,
+              9.54956561e-03f,   3.78189725e-03f,   4.33116034e-02f,   2.03812625e-02f,   7.41871074e-03f,   8.18181131e-03f,
+             -3.33274789e-02f,  -6.95933551e-02f,  -5.97370639e-02f,  -1.69103907e-03f,   4.51810211e-02f,  -1.00686476e-02f,
+             -1.10796811e-02f,   7.22746272e-03f,   1.81586901e-03f,   2.00265227e-03f,  -8.15752801e-03f,  -1.70342829e-02f,
+             -1.46217700e-02f,  -4.13913629e-04f,   1.10589052e-02f,  -2.46449094e-03f,  -2.71196035e-03f,   1.76905736e-03f,
+             -6.02293061e-03f,  -6.64245849e-03f,   2.70571392e-02f,   5.64998351e-02f,   4.84979376e-02f,   1.37288147e-03f,
+             -3.66805159e-02f,   8.17429926e-03f,   8.99511389e-03f,  -5.86766424e-03f,   5.64402253e-05f,   6.22457519e-05f,
+             -2.53549486e-04f,  -5.29453799e-04f,  -4.54468885e-04f,  -1.28651227e-05f,   3.43729131e-04f,  -7.66004669e-05f,
+             -8.42922309e-05f,   5.49852411e-05f,   9.80585534e-03f,   1.08145010e-02f,  -4.40513790e-02f,  -9.19866487e-02f,
+             -7.89588615e-02f,  -2.23517069e-03f,   5.97190745e-02f,  -1.33084711e-02f,  -1.46448286e-02f,   9.55306832e-03f,
+              5.68329310e-03f,   6.26788521e-03f,  -2.55313665e-02f,  -5.33137657e-02f,  -4.57631014e-02f,  -1.29546365e-03f,
+              3.46120745e-02f,  -7.71334441e-03f,  -8.48787278e-03f,   5.53678209e-03f,   7.59815937e-03f,   8.37971829e-03f,
+             -3.41336280e-02f,  -7.12767243e-02f,  -6.11820221e-02f,  -1.73194299e-03f,   4.62738872e-02f,  -1.03121940e-02f,
+             -1.13476841e-02f,   7.40228500e-03f,   4.01828112e-03f,   4.43160813e-03f,  -1.80515442e-02f,  -3.76946442e-02f,
+             -3.23560685e-02f,  -9.15936835e-04f,   2.44719144e-02f,  -5.45359682e-03f,  -6.00121450e-03f,   3.91469337e-03f,
+             -1.10613033e-02f,  -1.21990861e-02f,   4.96912934e-02f,   1.03763737e-01f,   8.90680030e-02f,   2.52134050e-03f,
+             -6.73649311e-02f,   1.50123602e-02f,   1.65198129e-02f,  -1.07761519e-02f,  -6.82307035e-03f,  -7.52490200e-03f,
+              3.06516513e-02f,   6.40057772e-02f,   5.49408346e-02f,   1.55526737e-03f,  -4.15534824e-02f,   9.26024653e-03f,
+              1.01901051e-02f,  -6.64717704e-03f,   3.31624506e-05f,   2.95538176e-02f,  -6.73238610e-05f,  -4.22452576e-02f,
+              3.68149090e-03f,   3.39876749e-02f,   4.91501251e-03f,  -1.45345749e-02f,  -1.07100606e-02f,   2.39774976e-02f,
+             -4.13635746e-03f,   2.91864593e-02f,   1.48083558e-02f,  -3.28784660e-02f,  -4.28923639e-03f,   1.45608177e-02f,
+             -7.32751563e-03f,  -1.47870155e-02f,  -8.66959989e-03f,   1.15879457e-02f,   1.26483923e-04f,   3.70996222e-02f,
+             -3.87262524e-04f,  -5.32114506e-02f,   4.78276238e-03f,   4.30523492e-02f,   6.41786447e-03f,  -1.82367899e-02f,
+             -1.34834182e-02f,   3.03456336e-02f,   6.45925058e-03f,   5.43100685e-02f,  -2.29520649e-02f,  -9.12019834e-02f,
+              1.89277586e-02f,   9.16239545e-02f,   2.77269408e-02f,  -2.60450169e-02f,  -2.26086974e-02f,   6.26194254e-02f,
+             -2.63445661e-03f,   7.45180473e-02f,   9.52798594e-03f,  -1.00754321e-01f,   4.11591586e-03f,   7.33077154e-02f,
+              4.45113285e-03f,  -3.69303636e-02f,  -2.57612318e-02f,   5.25745898e-02f,  -3.23400076e-04f,   4.23487239e-02f,
+              1.22692343e-03f,  -5.97481132e-02f,   4.57026716e-03f,   4.70113643e-02f,   5.95913222e-03f,  -2.08656471e-02f,
+             -1.51771363e-02f,   3.32824513e-02f,  -1.36303054e-02f,   4.20372263e-02f,   4.87037189e-02f,  -3.10828425e-02f,
+             -2.07626745e-02f,  -1.40032228e-02f,  -3.29721943e-02f,  -2.20948029e-02f,  -8.97661131e-03f,  -5.56277717e-03f,
+             -2.37853136e-02f,   3.54408473e-02f,   8.49241018e-02f,  -1.33109832e-04f,  -4.08737399e-02f,  -6.78458959e-02f,
+             -6.37188256e-02f,  -1.99048836e-02f,  -1.94368849e-03f,  -4.03452516e-02f,  -1.24528930e-02f,   6.40033279e-03f,
+              4.44413722e-02f,   1.72759648e-02f,  -2.28877980e-02f,  -4.94372211e-02f,  -3.53418253e-02f,  -4.44209902e-03f,
+              3.38095590e-03f,  -3.09447944e-02f,  -4.77582216e-03f,  -3.01676570e-03f,   1.70343164e-02f,   1.44334622e-02f,
+             -9.44761652e-03f,  -2.52239499e-02f,  -1.44459698e-02f,   9.87862004e-04f,   3.27660260e-03f,  -1.62888728e-02f,
+              1.48894184e-03f,   1.39255403e-02f,  -1.39065729e-02f,   2.43109856e-02f,  -1.13047110e-02f,  -1.19549163e-01f,
+             -1.34810194e-01f,  -7.57703185e-02f,  -3.17237875e-03f,   2.92035434e-02f,   2.09347787e-03f,   1.95795484e-02f,
+             -1.95528809e-02f,   3.41816656e-02f,  -1.58946179e-02f,  -1.68088183e-01f,  -1.89545453e-01f,  -1.06534362e-01f,
+             -4.46041906e-03f,   4.10606824e-02f,   5.49627875e-04f,   5.14047267e-03f,  -5.13347099e-03f,   8.97415541e-03f,
+             -4.17302037e-03f,  -4.41303663e-02f,  -4.97638248e-02f,  -2.79698484e-02f,  -1.17105164e-03f,   1.07801938e-02f,
+             -9.23046493e-04f,  -8.63292348e-03f,   8.62116460e-03f,  -1.50712198e-02f,   7.00818095e-03f,   7.41126537e-02f,
+              8.35734978e-02f,   4.69726361e-02f,   1.96666713e-03f,  -1.81042850e-02f,  -6.46608358e-04f,  -6.04749657e-03f,
+              6.03925949e-03f,  -1.05576226e-02f,   4.90933936e-03f,   5.19170612e-02f,   5.85445277e-02f,   3.29050571e-02f,
+              1.37768080e-03f,  -1.26823317e-02f,  -1.47573929e-03f,  -1.38020618e-02f,   1.37832621e-02f,  -2.40954179e-02f,
+              1.12044718e-02f,   1.18489109e-01f,   1.33614823e-01f,   7.50984550e-02f,   3.14424909e-03f,  -2.89445929e-02f,
+             -1.32655585e-03f,  -1.24068027e-02f,   1.23899039e-02f,  -2.16595978e-02f,   1.00718047e-02f,   1.06510974e-01f,
+              1.20107621e-01f,   6.75067082e-02f,   2.82639498e-03f,  -2.60185674e-02f,  -1.37643958e-03f,  -1.28733469e-02f,
+              1.28558120e-02f,  -2.24740840e-02f,   1.04505438e-02f,   1.10516205e-01f,   1.24624133e-01f,   7.00452179e-02f,
+              2.93267844e-03f,  -2.69969665e-02f,  -8.97028600e-04f,  -8.38958751e-03f,   8.37816019e-03f,  -1.46464072e-02f,
+              6.81064138e-03f,   7.20236450e-02f,   8.12178105e-02f,   4.56486195e-02f,   1.91123283e-03f,  -1.75939798e-02f,
+              7.88847683e-04f,   7.37780984e-03f,  -7.36776087e-03f,   1.28800636e-02f,  -5.98928379e-03f,  -6.33376539e-02f,
+             -7.14230090e-02f,  -4.01434340e-02f,  -1.68073969e-03f,   1.54721607e-02f,  -3.15418132e-02f,   3.23095918e-02f,
+              5.65937720e-02f,   3.53612825e-02f,  -1.48882251e-02f,  -6.12648353e-02f,  -5.37893325e-02f,  -6.39601937e-03f,
+              6.47721827e-05f,   1.10900234e-02f,  -2.23692860e-02f,  -5.75501695e-02f,  -8.83088168e-03f,   9.92662981e-02f,
+              1.12321995e-01f,   3.52647379e-02f,   4.60090488e-03f,  -3.50994663e-03f,   1.18702799e-02f,  -1.36271473e-02f,
+             -1.91314556e-02f,  -4.29221205e-02f,  -3.71998223e-03f,   7.90912732e-02f,   8.64460319e-02f,   2.39993986e-02f,
+              5.89027361e-04f,  -3.08221322e-03f,   9.22662113e-03f,  -9.97248571e-03f,  -1.19748926e-02f,  -4.23077159e-02f,
+             -1.17255310e-02f,   6.37426078e-02f,   7.76905715e-02f,   3.01275384e-02f,   8.57233629e-03f,  -1.73232879e-03f,
+              8.04436672e-03f,  -1.03665404e-02f,   3.57883759e-02f,  -4.41475734e-02f,  -6.87700510e-02f,  -3.32180336e-02f,
+              2.83280611e-02f,   7.68382326e-02f,   6.50093108e-02f,   7.35262036e-03f,   1.02689245e-03f,  -1.45831825e-02f,
+              7.93152303e-02f,  -1.19539447e-01f,  -1.65614843e-01f,  -5.36127947e-02f,   9.59180743e-02f,   1.91517368e-01f,
+              1.55603155e-01f,   1.65717881e-02f,   5.46444021e-03f,  -3.81153449e-02f,   7.85087198e-02f,  -9.49567780e-02f,
+             -1.49710566e-01f,  -7.46122748e-02f,   5.92575818e-02f,   1.66711167e-01f,   1.41606674e-01f,   1.61052998e-02f,
+              1.97502645e-03f,  -3.14863473e-02f,   5.74217960e-02f,  -9.93443653e-03f,  -7.32794702e-02f,  -1.09447487e-01f,
+             -4.75509651e-02f,   6.37108982e-02f,   7.19522089e-02f,   1.10205552e-02f,  -7.30168307e-03f,  -7.13202404e-03f,
+              3.05985231e-02f,   4.44629304e-02f,  -8.76885932e-03f,  -1.04197614e-01f,  -1.01324670e-01f,  -1.47244306e-02f,
+              1.19071780e-02f,   5.23805851e-03f,  -1.12027219e-02f,   9.48968716e-03f,  -1.57732761e-03f,   1.26470337e-02f,
+              9.54329316e-03f,  -8.40260740e-03f,  -1.75910052e-02f,  -1.38550233e-02f,  -8.55046511e-03f,  -4.60520270e-04f,
+             -1.61783479e-03f,   3.50107648e-03f,   3.70888300e-02f,   9.93253663e-03f,  -5.46007715e-02f,  -1.55513465e-01f,
+             -1.76046103e-01f,  -4.00162749e-02f,   2.03629490e-02f,  -1.65952146e-02f,  -6.99454220e-04f,  -5.72043122e-04f,
+              5.21153398e-02f,   1.39566958e-02f,  -7.67222270e-02f,  -2.18519613e-01f,  -2.47371033e-01f,  -5.62288351e-02f,
+              2.86129806e-02f,  -2.33187526e-02f,  -9.82837519e-04f,  -8.03805946e-04f,   1.36074470e-02f,   3.64412856e-03f,
+             -2.00323667e-02f,  -5.70560247e-02f,  -6.45892024e-02f,  -1.46814911e-02f,   7.47092161e-03f,  -6.08858513e-03f,
+             -2.56621366e-04f,  -2.09875754e-04f,  -2.53385119e-02f,  -6.78575458e-03f,   3.73023935e-02f,   1.06244370e-01f,
+              1.20271951e-01f,   2.73384955e-02f,  -1.39116496e-02f,   1.13375923e-02f,   4.77856200e-04f,   3.90810950e-04f,
+             -2.75038071e-02f,  -7.36562908e-03f,   4.04900610e-02f,   1.15323454e-01f,   1.30549759e-01f,   2.96746977e-02f,
+             -1.51004652e-02f,   1.23064425e-02f,   5.18691260e-04f,   4.24207567e-04f,  -3.87294888e-02f,  -1.03719113e-02f,
+              5.70160821e-02f,   1.62392735e-01f,   1.83833659e-01f,   4.17864285e-02f,  -2.12637223e-02f,   1.73293184e-02f,
+              7.30395201e-04f,   5.97347971e-04f,  -2.51887180e-02f,  -6.74563879e-03f,   3.70818749e-02f,   1.05616286e-01f,
+              1.19560942e-01f,   2.71768775e-02f,  -1.38294073e-02f,   1.12705678e-02f,   4.75031266e-04f,   3.88500572e-04f,
+             -3.18669863e-02f,  -8.53410549e-03f,   4.69133668e-02f,   1.33618265e-01f,   1.51260048e-01f,   3.43822651e-02f,
+             -1.74959898e-02f,   1.42587265e-02f,   6.00975996e-04f,   4.91503510e-04f,  -1.92465931e-02f,  -5.15431399e-03f,
+              2.83341017e-02f,   8.07009563e-02f,   9.13560092e-02f,   2.07657367e-02f,  -1.05669918e-02f,   8.61179270e-03f,
+              3.62969382e-04f,   2.96851649e-04f,   2.19459068e-02f,   5.87720098e-03f,  -3.23079303e-02f,  -9.20191780e-02f,
+             -1.04168586e-01f,  -2.36781090e-02f,   1.20490007e-02f,  -9.81958769e-03f,  -4.13875445e-04f,  -3.38484766e-04f,
+              7.28369877e-03f,   5.96533203e-03f,  -2.81500909e-03f,  -1.84738636e-02f,  -4.76816744e-02f,  -2.69267354e-02f,
+              1.75181439e-03f,   3.31562757e-02f,   2.36683525e-02f,  -5.77480998e-03f,  -1.43888108e-02f,  -4.30382462e-03f,
+              3.23096775e-02f,   6.61544595e-03f,   1.16533134e-02f,   6.60316646e-02f,   7.74985924e-02f,   2.36112960e-02f,
+             -4.65425896e-03f,  -1.62654500e-02f,  -1.18071437e-02f,  -3.18486779e-03f,   2.77525317e-02f,   4.04345617e-03f,
+              5.73632913e-03f,   5.47792539e-02f,   6.73464611e-02f,   2.35055834e-02f,  -1.86757010e-03f,  -1.46298558e-02f,
+             -8.44275486e-03f,  -2.99237971e-03f,   1.72878318e-02f,   5.74728241e-03f,   1.19913947e-02f,   3.79430242e-02f,
+              4.04179879e-02f,   8.29019304e-03f,  -5.35971066e-03f,  -7.81600364e-03f,  -3.35474638e-03f,  -6.05114549e-03f,
+             -1.05163613e-02f,   2.17042230e-02f,   5.84135652e-02f,   6.73222356e-03f,  -3.65605541e-02f,  -5.46248779e-02f,
+             -2.94946209e-02f,   1.48810986e-02f,  -1.96306445e-02f,  -1.72231179e-02f,   3.49025009e-03f,   5.43658771e-02f,
+              1.41150489e-01f,   7.06053078e-02f,  -1.71204787e-02f,  -1.03008583e-01f,  -7.02377409e-02f,   1.98022183e-02f,
+             -1.90324783e-02f,  -1.52331935e-02f,   8.62279255e-03f,   4.68572378e-02f,   1.20683320e-01f,   7.09683672e-02f,
+             -7.42426841e-04f,  -8.24168846e-02f,  -5.98515533e-02f,   1.37788011e-02f,   1.59016563e-04f,  -3.61091085e-03f,
+             -1.34388581e-02f,   1.45397643e-02f,   4.02389392e-02f,  -7.00852973e-03f,  -4.04506549e-02f,  -4.38417867e-02f,
+             -2.05391590e-02f,   1.37138311e-02f,   9.32457857e-03f,   1.99334999e-03f,  -2.37833709e-02f,  -1.10880367e-03f,
+              1.22810854e-03f,  -4.41570431e-02f,  -5.88342026e-02f,  -2.47799717e-02f,  -1.46228308e-03f,   1.34843793e-02f,
+             -1.53637619e-03f,  -9.12105548e-04f,   1.83164363e-03f,   2.51401425e-03f,   6.23786869e-03f,   6.27388107e-03f,
+              3.37708183e-03f,  -2.86993384e-03f,  -3.04406439e-03f,  -6.25603134e-05f,  -3.87430168e-03f,  -2.48990982e-05f,
+             -3.36296228e-03f,  -1.48858083e-02f,  -3.66170099e-03f,  -5.26381982e-03f,  -5.14043961e-03f,   2.06992612e-03f,
+              1.68906618e-03f,  -4.70363582e-03f,  -1.11814579e-02f,   2.07729060e-02f,   4.93945330e-02f,   9.74955969e-03f,
+              1.76198967e-02f,   1.03608500e-02f,  -1.41405677e-02f,  -2.78698411e-02f,  -2.46027894e-02f,  -1.66430902e-02f,
+             -1.13969231e-02f,   1.69962123e-02f,   3.85035388e-02f,  -6.25047949e-04f,   1.23110143e-02f,   5.44014946e-03f,
+             -1.45523287e-02f,  -2.16250941e-02f,  -1.91700179e-02f,  -1.63489915e-02f,  -3.87942675e-03f,  -2.93193175e-03f,
+             -1.16094975e-02f,  -2.22565271e-02f,  -7.59759685e-03f,  -8.83432571e-03f,  -5.24416892e-03f,   6.79249736e-03f,
+              5.80222113e-03f,  -4.28197812e-03f,  -9.90025606e-03f,   1.15762847e-02f,   2.44085230e-02f,  -8.60444270e-03f,
+              6.38333336e-03f,   8.17792199e-04f,  -1.27475848e-02f,  -1.36092557e-02f,  -1.21443458e-02f,  -1.37327770e-02f,
+             -1.64909493e-02f,   2.80248784e-02f,   6.54437393e-02f,   7.77407270e-03f,   2.24545393e-02f,   1.20787630e-02f,
+             -2.09422782e-02f,  -3.68629098e-02f,  -3.25916260e-02f,  -2.41615679e-02f,  -6.39957236e-03f,   2.63853068e-03f,
+              2.04257597e-03f,  -1.78122371e-02f,  -2.42477236e-03f,  -5.40992059e-03f,  -8.40162951e-03f,  -9.31616232e-04f,
+             -9.99427866e-04f,  -8.16388335e-03f,  -4.04144448e-05f,  -9.25386604e-03f,  -2.62714159e-02f,  -2.35551838e-02f,
+             -1.25515815e-02f,  -1.13984328e-02f,  -3.62169521e-04f,   1.50458375e-02f,   1.31035643e-02f,   1.31296634e-03f,
+             -1.11155119e-03f,  -4.25955979e-03f,  -1.30215315e-02f,  -1.50240194e-02f,  -6.80097518e-03f,  -6.72302907e-03f,
+             -1.61660102e-03f,   7.49813346e-03f,   6.49813376e-03f,  -7.23579840e-04f,  -3.40062950e-04f,  -2.35151080e-03f,
+             -6.95611769e-03f,  -7.24740466e-03f,  -3.49832699e-03f,  -3.34194466e-03f,  -5.29531622e-04f,   3.99607327e-03f,
+              3.47054377e-03f,  -6.70613299e-05f,  -4.64690290e-02f,  -2.22733039e-02f,   1.00814559e-01f,   1.01129018e-01f,
+              7.26777688e-02f,   2.26322142e-03f,   7.78111676e-03f,  -2.08832184e-03f,  -4.19899300e-02f,  -4.16038781e-02f,
+             -5.15508316e-02f,  -2.55337320e-02f,   1.02060311e-01f,   9.71673504e-02f,   8.81493613e-02f,   4.08341922e-03f,
+              4.62536467e-03f,  -4.90600709e-03f,  -4.76372652e-02f,  -4.17718217e-02f,   1.34319440e-03f,   2.87600490e-03f,
+              2.35568341e-02f,   3.77365649e-02f,  -2.24661510e-02f,  -4.32247389e-03f,   1.06206005e-02f,   7.06924545e-03f,
+              4.07044124e-03f,  -1.06583592e-02f,  -8.27137530e-02f,  -4.56422977e-02f,   1.08338490e-01f,   7.07826689e-02f,
+              1.84072390e-01f,   1.54642416e-02f,  -1.52841993e-02f,  -2.25451812e-02f,  -8.24150816e-02f,  -4.21917960e-02f,
+             -1.30422354e-01f,  -7.11155534e-02f,   1.80940792e-01f,   1.27144113e-01f,   2.82462925e-01f,   2.27574222e-02f,
+             -1.99563224e-02f,  -3.28712165e-02f,  -1.28859967e-01f,  -7.10592940e-02f,  -7.75273964e-02f,  -4.47114445e-02f,
+              7.86458701e-02f,   3.11703794e-02f,   1.90148354e-01f,   1.81773026e-02f,  -2.37081163e-02f,  -2.71948092e-02f,
+             -7.97187537e-02f,  -2.92855762e-02f,   6.09917799e-03f,  -2.42460077e-03f,  -7.66528398e-02f,  -1.10688604e-01f,
+              3.92535701e-02f,   9.90227237e-03f,  -2.70056743e-02f,  -1.65182333e-02f,  -1.33301958e-03f,   3.38777862e-02f,
+              4.81250063e-02f,   2.21997555e-02f,  -1.14692047e-01f,  -1.20530561e-01f,  -6.73550665e-02f,  -6.89861539e-04f,
+             -1.22722611e-02f,  -5.60450484e-04f,   4.23763543e-02f,   4.76948582e-02f,   6.50665835e-02f,   3.27979214e-02f,
+             -1.22063130e-01f,  -1.12266168e-01f,  -1.16458096e-01f,  -6.24046987e-03f,  -3.07016121e-03f,   7.98102282e-03f,
+              6.08560108e-02f,   4.96966429e-02f,   2.26398092e-02f,   1.08764758e-02f,  -4.88220863e-02f,  -4.88171764e-02f,
+             -3.56357023e-02f,  -1.15008478e-03f,  -3.67011921e-03f,   1.09553838e-03f,   2.04894170e-02f,   2.01373249e-02f,
+              1.32416692e-02f,  -2.41261395e-03f,   5.09554427e-03f,   2.02861968e-02f,   8.49411264e-03f,   4.82265232e-03f,
+             -2.37911139e-02f,  -9.77975223e-03f,  -4.58106622e-02f,  -8.26388523e-02f,   2.72767589e-04f,  -1.75903796e-03f,
+             -2.35272478e-03f,   3.06030689e-03f,  -4.51212330e-03f,   7.38568045e-03f,  -1.67873055e-02f,  -1.75790470e-02f,
+             -2.35280115e-02f,  -2.97385920e-02f,   6.99652825e-04f,  -5.29101002e-04f,  -3.08222370e-04f,   1.69272872e-03f,
+             -6.52471092e-04f,   1.96680776e-03f,  -5.08624036e-03f,  -4.59976029e-03f,  -7.72690866e-03f,  -1.09537933e-02f,
+              3.97851830e-03f,   1.97489094e-03f,   5.41270990e-03f,   1.92156550e-03f,   9.95500106e-03f,  -1.00592244e-02f,
+              1.85920782e-02f,   2.45082043e-02f,   2.19062306e-02f,   1.94519758e-02f,   1.64106898e-02f,   2.73290440e-03f,
+              1.45434188e-02f,   1.62942186e-02f,   2.62194425e-02f,  -1.84180066e-02f,   2.50786468e-02f,   4.60603125e-02f,
+              1.88387595e-02f,  -8.54997151e-03f,   1.01667605e-02f,  -2.55900132e-03f,   2.89628981e-03f,   1.66678112e-02f,
+              4.58403723e-03f,   6.71489304e-03f,  -2.50036530e-02f,  -1.46925496e-02f,  -4.45090011e-02f,  -7.50389546e-02f,
+             -8.64521042e-03f,  -3.52376746e-03f,  -1.06579913e-02f,  -5.36214933e-03f,  -1.95271019e-02f,   1.85863301e-02f,
+             -3.30814458e-02f,  -4.54518646e-02f,  -3.74596417e-02f,  -2.96782926e-02f,   1.10931750e-02f,  -3.84137966e-03f,
+              1.65166985e-03f,   1.98085420e-02f,   2.12479313e-03f,   1.17991390e-02f,  -3.72853130e-02f,  -2.66977716e-02f,
+             -6.24270737e-02f,  -9.90853980e-02f,  -3.03781535e-02f,   3.58798285e-03f,  -1.44890742e-02f,  -4.35296111e-02f,
+             -2.48250552e-02f,  -2.76493817e-03f,   3.60180475e-02f,   2.64362246e-03f,   7.93730244e-02f,   1.57652244e-01f,
+             -6.56909049e-02f,   9.21280496e-03f,  -2.92411651e-02f,  -9.63778570e-02f,  -4.96957004e-02f,  -1.21769644e-02f,
+              9.17496905e-02f,   2.04985160e-02f,   1.90850183e-01f,   3.64761800e-01f,  -2.17047334e-03f,  -1.53808040e-03f,
+              1.59136485e-03f,  -1.04089873e-02f,   4.76866728e-03f,   9.27391648e-03f,  -5.02692424e-02f,  -2.55453698e-02f,
+              1.53163448e-02f,   1.11442506e-02f,  -3.04372353e-03f,  -2.14541331e-03f,   2.23208708e-03f,  -1.30466763e-02f,
+              6.04046462e-03f,   1.06714917e-02f,  -6.83471411e-02f,  -3.35702673e-02f,   2.21720226e-02f,   1.56961046e-02f,
+              4.99737868e-03f,   3.63392429e-03f,  -3.66026233e-03f,   3.64628769e-02f,  -1.61936786e-02f,  -4.01651748e-02f,
+              1.33050010e-01f,   7.69777969e-02f,  -2.96748262e-02f,  -2.51093861e-02f,   1.15795350e-02f,   8.70817620e-03f,
+             -8.46959464e-03f,   1.23350576e-01f,  -5.37371784e-02f,  -1.51569396e-01f,   3.62116814e-01f,   2.34843120e-01f,
+             -5.13765477e-02f,  -5.64725511e-02f,   6.09421730e-03f,   5.42022428e-03f,  -4.42352472e-03f,   1.77911386e-01f,
+             -7.54261091e-02f,  -2.49867812e-01f,   3.47075492e-01f,   2.87804544e-01f,   2.35050581e-02f,  -2.47521568e-02f,
+              9.78044234e-04f,   6.87140157e-04f,  -7.17331190e-04f,   3.88879725e-03f,  -1.81435619e-03f,  -2.97218538e-03f,
+              2.15417258e-02f,   1.03461035e-02f,  -7.26033654e-03f,  -5.05700009e-03f,   4.10215789e-03f,   1.76321378e-03f,
+             -3.05404211e-03f,  -1.34694993e-01f,   5.53950071e-02f,   2.14855626e-01f,  -1.18792810e-01f,  -1.76056698e-01f,
+             -9.79996026e-02f,  -2.78508142e-02f,   1.63848419e-02f,   1.04585765e-02f,  -1.20599084e-02f,  -7.69537389e-02f,
+              2.88944505e-02f,   1.64125532e-01f,   1.64069399e-01f,  -3.31859961e-02f,  -1.85194910e-01f,  -9.09671560e-02f,
+              1.23389447e-02f,   7.90068135e-03f,  -9.08096414e-03f,  -5.46267964e-02f,   2.03723367e-02f,   1.18593015e-01f,
+              1.28160745e-01f,  -2.01595854e-02f,  -1.37977600e-01f,  -6.83584884e-02f,  -1.32474164e-02f,  -8.39868933e-03f,
+              9.75295715e-03f,   6.99442774e-02f,  -2.65851635e-02f,  -1.44328684e-01f,  -1.21952362e-01f,   3.80592048e-02f,
+              1.53189108e-01f,   7.38881975e-02f,  -6.28533831e-04f,  -7.80161098e-03f,  -1.39409176e-03f,   1.45213036e-02f,
+             -5.99852856e-03f,  -1.12658767e-02f,   4.69904300e-03f,   5.87057928e-03f,  -9.36214419e-05f,  -3.15997982e-03f,
+             -1.15349633e-03f,  -4.49501537e-03f,  -1.76759472e-03f,   4.05058870e-03f,  -7.59991212e-03f,  -1.18260533e-02f,
+             -6.74988888e-03f,   3.01892054e-04f,   2.43440247e-03f,   3.97896348e-03f,  -2.53777090e-03f,  -2.05285884e-02f,
+             -4.74544521e-03f,   3.33895236e-02f,  -2.04124022e-02f,  -3.56030948e-02f,   1.80153153e-03f,   1.20066665e-02f,
+              2.53296504e-03f,  -1.83713739e-03f,  -1.19071323e-02f,  -7.93487132e-02f,  -2.08990723e-02f,   1.17617585e-01f,
+             -8.98850337e-02f,  -1.51759461e-01f,  -1.81085635e-02f,   3.82424109e-02f,   1.63873844e-02f,   8.27417802e-03f,
+             -1.21530071e-02f,  -1.08174235e-01f,  -2.35195812e-02f,   1.82596102e-01f,  -1.01175658e-01f,  -1.79386169e-01f,
+              2.40685903e-02f,   6.80161342e-02f,   9.51230340e-03f,  -1.86190307e-02f,  -8.85315984e-03f,  -5.94543032e-02f,
+             -1.55756315e-02f,   8.85025188e-02f,  -6.69897273e-02f,  -1.13247655e-01f,  -1.27485218e-02f,   2.89212745e-02f,
+              1.20630087e-02f,   5.69690391e-03f,   1.86016795e-03f,   3.94045338e-02f,   5.43949287e-03f,  -8.05134922e-02f,
+              2.34146919e-02f,   4.80404049e-02f,  -3.94426100e-02f,  -3.47680002e-02f,   4.60600201e-03f,   2.55936757e-02f,
+              2.09425017e-02f,   9.96274352e-02f,   3.35425399e-02f,  -1.14994213e-01f,   1.44233987e-01f,   2.30941966e-01f,
+              9.43492875e-02f,  -2.46893801e-02f,  -3.94176990e-02f,  -5.43048382e-02f,   1.46869970e-02f,   5.79872839e-02f,
+              2.25667767e-02f,  -5.33094443e-02f,   9.70282555e-02f,   1.51255667e-01f,   8.47633258e-02f,  -4.64780489e-03f,
+             -3.07961684e-02f,  -4.99118306e-02f,  -6.68075588e-03f,  -1.82935651e-02f,  -9.61423945e-03f,   5.65143162e-03f,
+             -4.13306355e-02f,  -6.15200847e-02f,  -5.12083434e-02f,  -6.50356058e-03f,   1.61531828e-02f,   3.07505447e-02f,
+              1.73763558e-02f,  -4.96055558e-03f,  -2.33769207e-03f,   5.14244847e-03f,  -2.33664121e-02f,   3.20362556e-03f,
+              5.12514524e-02f,   5.09032570e-02f,   3.59730758e-02f,   1.02750445e-02f,   9.54253692e-03f,  -1.45392248e-03f,
+             -2.74039828e-03f,  -2.66255625e-03f,  -1.60215851e-02f,  -3.03277979e-03f,   2.65402962e-02f,   2.82696988e-02f,
+              2.35750768e-02f,   9.38547775e-03f,  -2.99685588e-03f,   1.61632732e-03f,  -4.69232298e-04f,  -4.17300453e-03f,
+              2.11965851e-03f,  -3.42265493e-03f,  -9.80070233e-03f,  -8.59033410e-03f,  -3.91638279e-03f,   4.69534047e-04f,
+              2.92232406e-04f,  -1.12439843e-03f,   1.15437771e-03f,   4.58276691e-03f,   2.22082227e-03f,   3.98100493e-03f,
+              2.17752461e-03f,   5.97722596e-04f,  -2.52534915e-03f,  -2.89437850e-03f,   1.32795079e-02f,  -7.21627520e-03f,
+              2.14126403e-03f,   1.87248327e-02f,  -9.25670005e-03f,   1.53703485e-02f,   4.34967093e-02f,   3.80516052e-02f,
+              1.71914082e-02f,  -2.23995163e-03f,   5.76051977e-03f,  -2.18979619e-03f,  -1.49681015e-04f,   4.06011008e-03f,
+             -6.37711352e-03f,   3.11921793e-03f,   1.76797677e-02f,   1.67398471e-02f,   1.02858255e-02f,   1.79963035e-03f,
+             -1.24016479e-02f,   3.44478735e-03f,   1.77805719e-03f,  -3.25727486e-03f,   1.69168469e-02f,  -1.92579150e-03f,
+             -3.64577621e-02f,  -3.63538004e-02f,  -2.59617642e-02f,  -7.61506939e-03f,  -6.39185868e-03f,  -1.61199004e-03f,
+              4.80083330e-03f,   1.29526155e-02f,   1.72246043e-02f,   1.17867710e-02f,  -1.45094013e-02f,  -1.95776243e-02f,
+             -2.35672835e-02f,  -1.39058083e-02f,  -8.07829015e-03f,  -1.28933229e-03f,   5.20978821e-03f,   1.31393448e-02f,
+              1.98910721e-02f,   1.20748552e-02f,  -1.92828514e-02f,  -2.45573577e-02f,  -2.75360569e-02f,  -1.53708728e-02f,
+             -9.06710979e-03f,   4.45591705e-03f,  -9.21611441e-04f,  -1.07495161e-02f,   7.50372326e-03f,  -8.71678255e-03f,
+             -2.91034933e-02f,  -2.60982085e-02f,  -1.31553141e-02f,   1.40807999e-04f,   4.49516485e-03f,   1.07580388e-03f,
+              2.30877311e-03f,  -1.08168891e-03f,   3.08945170e-03f,  -1.97925884e-02f,  -1.27361882e-02f,   2.69730464e-02f,
+              4.07031476e-02f,   3.90582047e-02f,   3.17108614e-04f,   7.24710524e-04f,  -1.50535000e-03f,  -2.76638870e-03f,
+              6.52478484e-04f,  -1.26882941e-02f,  -7.09265331e-03f,   9.88716818e-03f,   1.27262929e-02f,   8.17588437e-03f,
+              2.06843237e-04f,   1.47571380e-03f,  -3.56078963e-03f,  -5.96302003e-03f,   1.09734014e-03f,  -2.57325247e-02f,
+             -1.42019028e-02f,   1.87921301e-02f,   2.35356800e-02f,   1.37125123e-02f,   1.17849349e-03f,  -9.54317860e-04f,
+              3.78417829e-03f,   4.84251697e-03f,  -1.80721472e-05f,   1.63286105e-02f,   8.46433733e-03f,  -8.14316887e-03f,
+             -8.10798723e-03f,  -8.93027755e-05f,   1.32188329e-03f,  -3.95681569e-03f,   1.16659831e-02f,   1.73990186e-02f,
+             -1.95337692e-03f,   6.85499758e-02f,   3.70501429e-02f,  -4.46538515e-02f,  -5.29358312e-02f,  -2.42144316e-02f,
+             -7.90930353e-04f,  -1.40449638e-03f,   2.71826866e-03f,   5.22872293e-03f,  -1.35745725e-03f,   2.46319976e-02f,
+              1.38423741e-02f,  -1.97003018e-02f,  -2.56195739e-02f,  -1.70247778e-02f,  -5.20125730e-04f,   8.18156812e-04f,
+             -2.69081700e-03f,  -3.78312380e-03f,   2.73840269e-04f,  -1.41154742e-02f,  -7.52554415e-03f,   8.47909693e-03f,
+              9.60803498e-03f,   3.35589959e-03f,  -1.83656474e-03f,  -6.44462125e-04f,  -4.16381634e-04f,   1.29159156e-03f,
+             -1.39948644e-03f,   1.16530946e-02f,   7.15996418e-03f,  -1.35420617e-02f,  -1.97424982e-02f,  -1.76698547e-02f,
+             -2.26165960e-03f,   4.88819904e-04f,  -3.81015241e-03f,  -3.72665143e-03f,  -8.64515197e-04f,  -7.96942413e-03f,
+             -3.42616485e-03f,  -8.94679106e-04f,  -4.83297557e-03f,  -1.10455351e-02f,  -2.77723256e-03f,   2.15341031e-04f,
+             -3.68905184e-03f,  -2.98029743e-03f,  -1.31937978e-03f,  -3.08715482e-03f,  -5.32502367e-04f,  -5.83535712e-03f,
+             -1.17811356e-02f,  -1.67792384e-02f,   7.56901398e-04f,   3.32837515e-02f,   5.68662770e-03f,  -2.78497580e-02f,
+              7.44299381e-04f,   3.90028208e-02f,  -3.47516090e-02f,  -3.80200036e-02f,   6.04736656e-02f,   1.60916507e-01f,
+              4.79805254e-04f,   2.10988093e-02f,   3.60479439e-03f,  -1.76541619e-02f,   4.71816747e-04f,   2.47241687e-02f,
+             -2.20292956e-02f,  -2.41011549e-02f,   3.83346938e-02f,   1.02006137e-01f,   1.02780527e-03f,   4.51963954e-02f,
+              7.72193819e-03f,  -3.78175117e-02f,   1.01069291e-03f,   5.29623851e-02f,  -4.71896194e-02f,  -5.16278110e-02f,
+              8.21179003e-02f,   2.18510404e-01f,   1.05583703e-03f,   4.64290567e-02f,   7.93254189e-03f,  -3.88489254e-02f,
+              1.03825796e-03f,   5.44068515e-02f,  -4.84766401e-02f,  -5.30358776e-02f,   8.43575373e-02f,   2.24469930e-01f,
+              3.49693903e-04f,   1.53773334e-02f,   2.62726308e-03f,  -1.28667895e-02f,   3.43871681e-04f,   1.80195849e-02f,
+             -1.60554945e-02f,  -1.75655168e-02f,   2.79392693e-02f,   7.43445903e-02f,   2.86689574e-05f,   1.26068003e-03f,
+              2.15390915e-04f,  -1.05485797e-03f,   2.81916346e-05f,   1.47729961e-03f,  -1.31627766e-03f,  -1.44007383e-03f,
+              2.29054526e-03f,   6.09499263e-03f,  -7.96857857e-05f,  -3.50407860e-03f,  -5.98682207e-04f,   2.93199345e-03f,
+             -7.83590658e-05f,  -4.10617609e-03f,   3.65861319e-03f,   4.00270661e-03f,  -6.36660447e-03f,  -1.69411227e-02f,
+             -3.18810635e-04f,  -1.40192816e-02f,  -2.39523593e-03f,   1.17304567e-02f,  -3.13502620e-04f,  -1.64281819e-02f,
+              1.46375513e-02f,   1.60142146e-02f,  -2.54718084e-02f,  -6.77788332e-02f,  -2.23952811e-04f,  -9.84803308e-03f,
+             -1.68256566e-03f,   8.24021641e-03f,  -2.20224116e-04f,  -1.15401968e-02f,   1.02823442e-02f,   1.12494007e-02f,
+             -1.78930145e-02f,  -4.76121530e-02f,  -4.67739628e-05f,  -2.05682404e-03f,  -3.51414492e-04f,   1.72102149e-03f,
+             -4.59952025e-05f,  -2.41024327e-03f,   2.14753277e-03f,   2.34950846e-03f,  -3.73706943e-03f,  -9.94409900e-03f,
+              1.23534119e-02f,  -4.46889142e-04f,  -1.51437689e-02f,  -3.79096456e-02f,  -3.02394629e-02f,  -3.67342792e-02f,
+              1.07896337e-02f,   3.29533890e-02f,   4.42724489e-03f,  -2.34490894e-02f,   7.55556719e-03f,  -4.52628499e-03f,
+             -8.44834838e-03f,  -4.50281166e-02f,  -4.06072550e-02f,  -4.04656585e-03f,   1.20506983e-03f,   5.70336496e-03f,
+              2.02940442e-02f,   4.29116748e-02f,  -2.53260843e-02f,  -1.48246735e-02f,   3.40588652e-02f,  -3.12056602e-03f,
+             -1.98460724e-02f,   1.43488109e-01f,  -4.20843884e-02f,  -1.21045955e-01f,   5.60130291e-02f,   2.59977818e-01f,
+             -4.98715825e-02f,  -1.48461051e-02f,   6.43226504e-02f,   6.75333887e-02f,   3.55098695e-02f,   2.20415697e-01f,
+             -6.46761134e-02f,  -1.89612418e-01f,   5.09766750e-02f,   3.18811804e-01f,  -4.55308557e-02f,  -1.46883363e-02f,
+              5.89412153e-02f,   5.58294393e-02f,   2.65210755e-02f,   2.06144571e-01f,  -6.04856089e-02f,  -1.76963627e-01f,
+              5.12306094e-02f,   3.06334496e-01f,  -1.14604933e-02f,  -4.69381874e-03f,   1.50267109e-02f,   8.93427897e-03f,
+              1.49376492e-03f,   5.62050380e-02f,  -1.64887793e-02f,  -4.79297936e-02f,   1.70163512e-02f,   9.05237868e-02f,
+              6.78377692e-03f,   6.80282572e-03f,  -9.66483727e-03f,   1.53797865e-02f,   2.00398602e-02f,  -5.07002249e-02f,
+              1.48643693e-02f,   4.20459099e-02f,  -2.67137066e-02f,  -1.07760526e-01f,   3.11816577e-03f,   9.86901391e-03f,
+             -5.73262060e-03f,   4.16946560e-02f,   4.42652516e-02f,  -5.25062941e-02f,   1.53834634e-02f,   4.22359854e-02f,
+             -4.01579551e-02f,  -1.40294567e-01f,  -2.03431328e-03f,   8.05857778e-03f,   9.65802814e-04f,   4.72512655e-02f,
+              4.64957729e-02f,  -2.85359770e-02f,   8.35062563e-03f,   2.17062645e-02f,  -3.37474942e-02f,  -1.03632778e-01f,
+              4.49410843e-04f,   3.48728942e-03f,  -1.22136530e-03f,   1.66140143e-02f,   1.71157718e-02f,  -1.65112298e-02f,
+              4.83609829e-03f,   1.31038455e-02f,  -1.43263331e-02f,  -4.80179936e-02f,   3.73076461e-02f,   3.34399901e-02f,
+              3.31634320e-02f,  -5.96249336e-03f,  -4.91749607e-02f,  -4.00880910e-02f,   4.70985798e-03f,   2.58331262e-02f,
+              9.55789257e-03f,   4.76091681e-03f,   3.30061428e-02f,   4.89245169e-02f,   4.51606847e-02f,  -4.68010455e-02f,
+             -8.85381028e-02f,  -3.26654688e-02f,   3.23531553e-02f,   5.17486595e-02f,   2.69491114e-02f,   3.83781046e-02f,
+              2.94978712e-02f,   2.03280468e-02f,   2.12214962e-02f,   8.40858743e-03f,  -2.46497765e-02f,  -3.25812884e-02f,
+             -5.18343737e-03f,   1.12943538e-02f,   1.71292340e-03f,  -7.03277811e-03f,  -1.67676900e-02f,  -1.59455575e-02f,
+             -1.56545527e-02f,   4.64694016e-03f,   2.42346395e-02f,   1.78846773e-02f,  -3.45203513e-03f,  -1.29792811e-02f,
+             -5.17178047e-03f,  -3.75825190e-03f,  -8.21665768e-03f,  -1.50393788e-02f,  -1.35819959e-02f,   1.77915338e-02f,
+              2.87002828e-02f,   7.71771604e-03f,  -1.22222006e-02f,  -1.71552356e-02f,  -9.44351591e-03f,  -1.46063408e-02f,
+             -3.48645239e-03f,  -1.72571074e-02f,  -1.46597596e-02f,   3.09008714e-02f,   3.75016890e-02f,   1.69989618e-03f,
+             -2.10363101e-02f,  -2.35274434e-02f,  -1.44064687e-02f,  -2.54105926e-02f,   3.06973830e-02f,  -2.46233481e-04f,
+              4.57769912e-03f,   5.47013916e-02f,   2.41793208e-02f,  -3.70051377e-02f,  -3.65839824e-02f,  -2.02192534e-02f,
+             -1.86812151e-02f,  -4.51254845e-02f,   3.71496305e-02f,   1.67294918e-03f,   7.15218345e-03f,   6.19671233e-02f,
+              2.46722661e-02f,  -4.44978029e-02f,  -4.14010771e-02f,  -2.15245411e-02f,  -2.07231659e-02f,  -5.11285141e-02f,
+              2.13383548e-02f,  -6.35997253e-03f,  -1.88063388e-03f,   5.13122939e-02f,   3.12180109e-02f,  -2.66191680e-02f,
+             -3.44498456e-02f,  -2.33008657e-02f,  -1.89034939e-02f,  -4.23007347e-02f,   3.12092956e-02f,  -6.14675088e-03f,
+             -1.69451232e-04f,   6.82740510e-02f,   3.83121818e-02f,  -3.84760648e-02f,  -4.57875133e-02f,  -2.93656513e-02f,
+             -2.46309619e-02f,  -5.62945716e-02f,  -3.05843167e-03f,   6.03491860e-03f,   7.11096637e-03f,   8.82515335e-04f,
+             -1.06950840e-02f,  -2.37772018e-02f,  -3.90385836e-03f,   1.90667529e-02f,   4.12243642e-02f,   4.23971713e-02f,
+             -6.59188954e-03f,   1.30071621e-02f,   1.53263863e-02f,   1.90210028e-03f,  -2.30512954e-02f,  -5.12474068e-02f,
+             -8.41405150e-03f,   4.10948955e-02f,   8.88515711e-02f,   9.13793445e-02f,  -3.47408233e-03f,   6.85508316e-03f,
+              8.07736907e-03f,   1.00245199e-03f,  -1.21485805e-02f,  -2.70086005e-02f,  -4.43440536e-03f,   2.16579866e-02f,
+              4.68268879e-02f,   4.81590852e-02f,   7.27871375e-04f,  -1.43624085e-03f,  -1.69232779e-03f,  -2.10028447e-04f,
+              2.54530646e-03f,   5.65869920e-03f,   9.29073140e-04f,  -4.53766668e-03f,  -9.81092174e-03f,  -1.00900363e-02f,
+             -2.49190442e-03f,   4.91704326e-03f,   5.79376984e-03f,   7.19043019e-04f,  -8.71398486e-03f,  -1.93728432e-02f,
+             -3.18072899e-03f,   1.55349318e-02f,   3.35881896e-02f,   3.45437527e-02f,   4.62121010e-04f,  -9.11860436e-04f,
+             -1.07444846e-03f,  -1.33345762e-04f,   1.61599927e-03f,   3.59267299e-03f,   5.89862757e-04f,  -2.88093649e-03f,
+             -6.22889353e-03f,  -6.40610186e-03f,  -3.70735908e-03f,   7.31538655e-03f,   8.61974619e-03f,   1.06976437e-03f,
+             -1.29643306e-02f,  -2.88221668e-02f,  -4.73216549e-03f,   2.31122710e-02f,   4.99712080e-02f,   5.13928570e-02f,
+             -6.47323439e-03f,   1.27730304e-02f,   1.50505081e-02f,   1.86786219e-03f,  -2.26363689e-02f,  -5.03249429e-02f,
+             -8.26259796e-03f,   4.03551795e-02f,   8.72522220e-02f,   8.97345021e-02f,  -2.71464372e-03f,   5.35655348e-03f,
+              6.31164666e-03f,   7.83314754e-04f,  -9.49288625e-03f,  -2.11044867e-02f,  -3.46503872e-03f,   1.69235244e-02f,
+              3.65904719e-02f,   3.76314484e-02f,   4.79997648e-03f,  -9.47134756e-03f,  -1.11601222e-02f,  -1.38504093e-03f,
+              1.67851243e-02f,   3.73165160e-02f,   6.12680987e-03f,  -2.99238246e-02f,  -6.46985173e-02f,  -6.65391460e-02f,
+              6.81672245e-03f,  -2.66575976e-03f,  -6.37910888e-03f,  -6.25617709e-03f,   5.32613415e-03f,   5.45490021e-03f,
+              1.51432501e-02f,  -8.26314464e-03f,  -2.06393693e-02f,  -9.93868429e-03f,  -8.36747512e-03f,   1.13209977e-03f,
+              7.04717170e-03f,  -5.30288380e-04f,  -7.95764755e-03f,  -6.83845207e-03f,  -1.77016500e-02f,   5.81558375e-03f,
+              2.29118709e-02f,   2.02622022e-02f,   1.28964579e-03f,  -1.21601978e-02f,  -5.47213852e-03f,  -4.58969958e-02f,
+             -6.72549149e-03f,   2.55330669e-04f,   7.69358827e-03f,  -2.51318943e-02f,  -1.71002988e-02f,   4.20316346e-02f,
+             -3.50878923e-03f,   8.41292436e-04f,   3.08927475e-03f,   1.18380750e-03f,  -3.09373671e-03f,  -2.84318812e-03f,
+             -7.57480552e-03f,   3.17988871e-03f,   1.00227697e-02f,   7.11571239e-03f,  -1.78574380e-02f,   1.43342642e-02f,
+              1.94009915e-02f,   4.45880070e-02f,  -9.07562766e-03f,  -1.38001209e-02f,  -4.27152887e-02f,   3.65103632e-02f,
+              6.23898879e-02f,  -1.65765092e-03f,  -2.69579235e-02f,   2.94776261e-02f,   3.21564265e-02f,   9.73798186e-02f,
+             -8.50034878e-03f,  -2.03106217e-02f,  -6.77309856e-02f,   7.09661692e-02f,   1.03058718e-01f,  -3.20323706e-02f,
+             -1.28426207e-02f,   1.50907366e-02f,   1.57025661e-02f,   5.04105352e-02f,  -3.35439481e-03f,  -9.60606430e-03f,
+             -3.27007510e-02f,   3.59265059e-02f,   5.02828062e-02f,  -1.92072894e-02f,  -1.26463715e-02f,  -1.84742827e-03f,
+              9.34873987e-03f,  -1.44521436e-02f,  -1.43878404e-02f,  -1.05725601e-02f,  -2.52796300e-02f,   1.59418711e-03f,
+              3.05998567e-02f,   4.40297276e-02f,  -3.37271392e-02f,   2.15695053e-02f,   3.46285254e-02f,   6.31009042e-02f,
+             -2.07923241e-02f,  -2.64308434e-02f,  -7.83959627e-02f,   5.78285083e-02f,   1.11604623e-01f,   1.76027380e-02f,
+             -1.24745341e-02f,   1.69581547e-02f,   1.60941370e-02f,   5.77885583e-02f,  -1.73234986e-03f,  -9.17748827e-03f,
+             -3.27162966e-02f,   3.95473652e-02f,   5.14453873e-02f,  -2.73214914e-02f,  -2.61487961e-02f,  -2.80592572e-02f,
+             -7.62282545e-03f,  -2.14925520e-02f,  -6.32385090e-02f,  -2.27069240e-02f,  -3.05723455e-02f,  -7.48883113e-02f,
+             -1.10218581e-02f,   2.06928682e-02f,   5.27210813e-03f,   5.53478952e-03f,   5.60295349e-03f,   8.32214544e-04f,
+              1.44427558e-02f,   2.59219501e-02f,   1.58823431e-02f,   8.39773938e-03f,   5.20554895e-04f,  -3.46899289e-03f,
+              2.46782950e-03f,   2.10875645e-03f,   1.86217446e-02f,  -1.33865774e-02f,   1.34207122e-02f,   9.61173102e-02f,
+              4.56741601e-02f,  -2.24369746e-02f,  -6.45204540e-03f,   1.14272407e-03f,  -1.45332525e-02f,  -1.59795228e-02f,
+              8.52365140e-03f,  -2.29327716e-02f,  -2.98354123e-02f,   5.43623120e-02f,   1.35070318e-02f,  -6.26524240e-02f,
+             -1.14661371e-02f,   1.37073994e-02f,  -4.63293344e-02f,  -4.95379269e-02f,  -1.93567984e-02f,  -3.30415443e-02f,
+             -1.14479020e-01f,  -7.09446818e-02f,  -6.81514218e-02f,  -1.23040989e-01f,  -1.70793813e-02f,   3.56510095e-02f,
+              5.30001968e-02f,   5.69619685e-02f,   1.24792848e-02f,   4.61209677e-02f,   1.26939341e-01f,   3.04273758e-02f,
+              5.48646376e-02f,   1.56685621e-01f,   2.35833302e-02f,  -4.24555168e-02f,   5.82050532e-02f,   6.25667050e-02f,
+              1.33458748e-02f,   5.09593114e-02f,   1.39255941e-01f,   3.15313488e-02f,   5.93946986e-02f,   1.72664404e-01f,
+              2.60495339e-02f,  -4.66869026e-02f,  -1.91284996e-02f,  -2.05191839e-02f,  -5.80415549e-03f,  -1.55261336e-02f,
+             -4.63554151e-02f,  -1.78068224e-02f,  -2.29090694e-02f,  -5.44071309e-02f,  -7.96740130e-03f,   1.50979497e-02f,
+             -1.47023983e-02f,  -1.59283597e-02f,   7.51962594e-04f,  -1.64223704e-02f,  -3.34591940e-02f,   1.36785107e-02f,
+             -5.14819939e-03f,  -5.04096597e-02f,  -8.30556359e-03f,   1.25059113e-02f,   8.57801512e-02f,   9.21173319e-02f,
+              2.26834808e-02f,   7.25056827e-02f,   2.06484586e-01f,   6.22955821e-02f,   9.47393775e-02f,   2.49496698e-01f,
+              3.71289514e-02f,  -6.82838634e-02f,  -2.41124220e-02f,  -2.37019733e-02f,  -2.39380039e-02f,  -2.29174346e-02f,
+             -2.82909796e-02f,  -3.98925394e-02f,  -7.77450874e-02f,  -5.78130782e-02f,  -2.34516151e-03f,   3.98146883e-02f,
+             -4.40977467e-03f,  -5.03681600e-03f,  -8.30888283e-03f,  -6.63118204e-03f,  -5.77975111e-03f,   3.72389425e-03f,
+             -3.59866396e-03f,  -1.65722948e-02f,   1.38287887e-03f,   9.32830106e-03f,   3.73196565e-02f,   3.08254082e-02f,
+              4.24598856e-03f,   1.51090650e-02f,   3.87317613e-02f,   1.53700173e-01f,   2.08948493e-01f,   3.94167528e-02f,
+              1.87486764e-02f,  -4.45420630e-02f,   1.70933679e-02f,   1.39196338e-02f,   8.29470460e-04f,   6.22808142e-03f,
+              1.75682753e-02f,   7.35251233e-02f,   9.87168178e-02f,   1.63518023e-02f,   9.10141319e-03f,  -1.98206902e-02f,
+             -4.70406562e-02f,  -4.13153283e-02f,  -1.91282164e-02f,  -2.75954902e-02f,  -5.09435683e-02f,  -1.55117646e-01f,
+             -2.26158604e-01f,  -7.07082823e-02f,  -1.72829572e-02f,   6.33174926e-02f,  -2.07362603e-03f,  -9.45715932e-04f,
+              4.05877596e-03f,   1.82617526e-03f,  -1.49025617e-03f,  -2.05793064e-02f,  -2.32121814e-02f,   4.36410494e-03f,
+             -3.02114454e-03f,   2.38725916e-04f,   1.37730129e-02f,   1.21276090e-02f,   5.77361928e-03f,   8.18709936e-03f,
+              1.49424160e-02f,   4.49316464e-02f,   6.57493025e-02f,   2.09667832e-02f,   4.98049892e-03f,  -1.86288189e-02f,
+              1.57542266e-02f,   9.28183552e-03f,  -1.90963913e-02f,  -6.58737030e-03f,   1.31312814e-02f,   1.23440012e-01f,
+              1.44637495e-01f,  -1.52394529e-02f,   1.75421145e-02f,  -7.92653114e-03f,  -6.28977316e-03f,  -7.92694837e-03f,
+             -1.60100739e-02f,  -1.20396288e-02f,  -8.88471026e-03f,   1.69699378e-02f,   6.10246649e-03f,  -2.99844965e-02f,
+              3.88924265e-03f,   1.54706892e-02f,   2.97523625e-02f,   2.84749288e-02f,   2.52205264e-02f,   2.55985633e-02f,
+              3.42430808e-02f,   6.13240562e-02f,   1.07591219e-01f,   6.47479594e-02f,   4.88319807e-03f,  -4.68797982e-02f,
+              6.75584481e-04f,  -2.41376620e-04f,   1.58035103e-03f,  -1.93138346e-02f,  -4.88422578e-03f,   2.16940115e-03f,
+             -1.41014019e-02f,  -1.41664054e-02f,   4.10225941e-03f,   5.38518699e-03f,   4.71919263e-03f,   7.16810208e-03f,
+              1.25150597e-02f,  -1.19895590e-02f,  -2.03780923e-02f,  -1.33343525e-02f,  -1.49626434e-02f,  -1.21457372e-02f,
+              6.70844456e-03f,   8.06301739e-03f,  -2.32084263e-02f,  -3.29150185e-02f,  -6.11580797e-02f,   9.14061293e-02f,
+              1.03843354e-01f,   5.80579378e-02f,   9.56330150e-02f,   8.26430991e-02f,  -3.87837812e-02f,  -4.74531278e-02f,
+             -2.64888387e-02f,  -3.75695638e-02f,  -6.98028728e-02f,   1.04296207e-01f,   1.18517846e-01f,   6.62710816e-02f,
+              1.09130092e-01f,   9.43033099e-02f,  -4.42603864e-02f,  -5.41532636e-02f,   8.51857290e-03f,   1.41117331e-02f,
+              2.27862727e-02f,  -5.36208041e-03f,  -3.49645913e-02f,  -2.78427377e-02f,  -1.59447752e-02f,  -1.04267905e-02f,
+              9.20264423e-03f,   1.06402813e-02f,  -2.73860414e-02f,  -4.31377999e-02f,  -7.28831440e-02f,   4.81906161e-02f,
+              1.15866065e-01f,   8.23372230e-02f,   7.22957253e-02f,   5.53797930e-02f,  -3.51115465e-02f,  -4.16488200e-02f,
+             -4.69960570e-02f,  -7.43267387e-02f,  -1.25121713e-01f,   7.85365477e-02f,   1.98367834e-01f,   1.42259941e-01f,
+              1.21235594e-01f,   9.20961276e-02f,  -5.95104918e-02f,  -7.04713091e-02f,  -4.20329459e-02f,  -6.72743320e-02f,
+             -1.12040825e-01f,   5.91775030e-02f,   1.76182002e-01f,   1.29800677e-01f,   1.00912362e-01f,   7.45557919e-02f,
+             -5.12501858e-02f,  -6.03687093e-02f,   1.15975793e-02f,   1.65313855e-02f,   3.05754393e-02f,  -4.45206687e-02f,
+             -5.17627522e-02f,  -2.92803440e-02f,  -4.70033623e-02f,  -4.04813476e-02f,   1.91743616e-02f,   2.34350022e-02f,
+             -8.03915504e-03f,  -1.23220896e-02f,  -2.13379674e-02f,   1.88802648e-02f,   3.45415473e-02f,   2.30729245e-02f,
+              2.44395956e-02f,   1.95999034e-02f,  -1.11521836e-02f,  -1.33641539e-02f,  -2.06544735e-02f,  -1.81388855e-02f,
+             -3.14402133e-02f,  -3.00087500e-02f,  -6.33823201e-02f,  -5.10497317e-02f,  -3.21046710e-02f,  -4.27902974e-02f,
+             -1.84147637e-02f,   2.35849153e-02f,  -3.00143883e-02f,  -2.45915316e-02f,  -3.70854922e-02f,   9.20476858e-03f,
+             -4.83072810e-02f,  -6.71551302e-02f,  -1.09576033e-02f,  -3.33162048e-03f,  -4.04786691e-02f,   5.81921730e-03f,
+             -5.27781248e-02f,  -3.79318930e-02f,  -3.93628441e-02f,   1.74882337e-01f,   4.66632880e-02f,  -9.69670936e-02f,
+              8.79943818e-02f,   1.70979589e-01f,  -1.12402946e-01f,  -7.52676353e-02f,  -5.89771271e-02f,  -3.94883081e-02f,
+             -2.98759304e-02f,   2.82049805e-01f,   1.23984374e-01f,  -9.68274102e-02f,   1.56880543e-01f,   2.87591517e-01f,
+             -1.48107946e-01f,  -1.30779758e-01f,  -3.69654894e-02f,  -2.83380691e-02f,  -3.61889452e-02f,   6.95693195e-02f,
+             -1.12019768e-02f,  -7.49577507e-02f,   2.58641094e-02f,   6.07865565e-02f,  -6.49801940e-02f,  -2.42069736e-02f,
+             -8.21551960e-03f,  -4.17687884e-03f,   2.28217477e-03f,   7.88505152e-02f,   5.00792302e-02f,  -8.22304282e-03f,
+              4.85926270e-02f,   8.41449350e-02f,  -3.09080910e-02f,  -3.95317450e-02f,  -1.52062196e-02f,  -9.14317556e-03f,
+             -2.64952169e-03f,   1.03746295e-01f,   5.76962084e-02f,  -2.08362881e-02f,   6.14184178e-02f,   1.08721755e-01f,
+             -4.62462381e-02f,  -5.04343323e-02f,   1.39232306e-02f,   9.48357116e-03f,   7.83786457e-03f,  -6.17677756e-02f,
+             -2.52743438e-02f,   2.35000942e-02f,  -3.37795690e-02f,  -6.25252649e-02f,   3.37135084e-02f,   2.82784477e-02f,
+             -5.38565405e-03f,  -6.54519349e-03f,  -1.70349795e-02f,  -6.20773546e-02f,  -6.15190081e-02f,  -2.05314960e-02f,
+             -4.50404808e-02f,  -7.16120973e-02f,   9.29139555e-03f,   3.53792347e-02f,   9.41979699e-03f,   9.18822177e-03f,
+              1.87960155e-02f,   4.10500802e-02f,   5.15997745e-02f,   2.69238222e-02f,   3.31371799e-02f,   5.00074700e-02f,
+              1.29003904e-03f,  -2.54991390e-02f,  -2.12667231e-03f,  -7.22046755e-03f,  -2.76882295e-03f,   9.39548016e-03f,
+              9.85942315e-03f,   2.01957813e-03f,   2.79780314e-03f,   3.05224606e-03f,  -3.86571838e-03f,  -4.42059478e-03f,
+             -4.16284101e-03f,  -1.29444338e-02f,  -6.24273252e-03f,   2.12650355e-02f,   2.33333465e-02f,   6.57578814e-04f,
+              3.39049590e-03f,   5.92367351e-03f,  -1.08532319e-02f,  -1.12564582e-02f,  -1.52541762e-02f,  -4.75316159e-02f,
+             -2.28075273e-02f,   7.76849389e-02f,   8.51679295e-02f,   2.68247491e-03f,   1.25967367e-02f,   2.17107274e-02f,
+             -3.94981280e-02f,  -4.10322398e-02f,  -6.58637751e-03f,  -1.14653036e-02f,  -1.61154512e-02f,   5.54314889e-02f,
+              6.74988404e-02f,  -2.39428226e-02f,  -1.04493285e-02f,   8.98627844e-03f,  -4.20843437e-02f,  -3.75453457e-02f,
+              1.13639291e-02f,   4.33520451e-02f,   1.14950305e-02f,  -3.86793911e-02f,  -3.65057215e-02f,  -2.40085367e-02f,
+             -2.33160574e-02f,  -1.65139940e-02f,   7.47709582e-03f,   1.31808659e-02f,  -6.89068204e-03f,  -2.99896151e-02f,
+             -4.40813974e-03f,   1.45062879e-02f,   9.57623404e-03f,   2.48183999e-02f,   2.06326339e-02f,   1.01720504e-02f,
+              5.69760101e-03f,   1.12882633e-04f,  -1.56879909e-02f,  -6.32251576e-02f,  -1.35319363e-02f,   4.52354439e-02f,
+              3.89398634e-02f,   4.25033756e-02f,   3.81122492e-02f,   2.29423232e-02f,  -9.89262946e-04f,  -1.08027980e-02f,
+             -9.12895426e-03f,  -3.55085731e-02f,  -8.76186043e-03f,   2.94223893e-02f,   2.70102061e-02f,   2.11786255e-02f,
+              1.99279543e-02f,   1.32953757e-02f,  -4.11999365e-03f,  -9.09402594e-03f,  -1.23984274e-02f,  -4.21396121e-02f,
+             -1.61113273e-02f,   5.46677075e-02f,   5.73290363e-02f,   1.18974838e-02f,   1.63892135e-02f,   1.77963991e-02f,
+             -2.24139430e-02f,  -2.56744288e-02f,  -2.54649669e-02f,  -8.73405784e-02f,  -3.25437747e-02f,   1.10370733e-01f,
+              1.15065530e-01f,   2.66269911e-02f,   3.50483768e-02f,   3.65856439e-02f,  -4.38509956e-02f,  -5.10016568e-02f,
+             -1.18479962e-02f,   1.35619217e-03f,  -3.63592356e-02f,  -3.18069197e-02f,  -1.85534416e-03f,  -2.57559717e-02f,
+             -4.47552949e-02f,  -4.43519540e-02f,  -6.98389038e-02f,  -4.00455967e-02f,  -1.14429090e-02f,   1.30982348e-03f,
+             -3.51160988e-02f,  -3.07194293e-02f,  -1.79190922e-03f,  -2.48753652e-02f,  -4.32250947e-02f,  -4.28355411e-02f,
+             -6.74510896e-02f,  -3.86764221e-02f,  -9.18045081e-03f,   1.05084898e-03f,  -2.81730480e-02f,  -2.46456731e-02f,
+             -1.43761816e-03f,  -1.99570805e-02f,  -3.46787572e-02f,  -3.43662240e-02f,  -5.41148596e-02f,  -3.10294349e-02f,
+             -1.97307877e-02f,   2.25850334e-03f,  -6.05500154e-02f,  -5.29689193e-02f,  -3.08975461e-03f,  -4.28921133e-02f,
+             -7.45322034e-02f,  -7.38605037e-02f,  -1.16304614e-01f,  -6.66890144e-02f,  -2.06690263e-02f,   2.36589974e-03f,
+             -6.34292886e-02f,  -5.54876961e-02f,  -3.23667866e-03f,  -4.49317172e-02f,  -7.80763552e-02f,  -7.73727149e-02f,
+             -1.21835127e-01f,  -6.98602051e-02f,  -3.85287730e-03f,   4.41023265e-04f,  -1.18237445e-02f,  -1.03433654e-02f,
+             -6.03343651e-04f,  -8.37564375e-03f,  -1.45540778e-02f,  -1.44229140e-02f,  -2.27110758e-02f,  -1.30225196e-02f,
+              1.93917751e-02f,  -2.21969816e-03f,   5.95096536e-02f,   5.20588122e-02f,   3.03666689e-03f,   4.21551466e-02f,
+              7.32515976e-02f,   7.25914389e-02f,   1.14306286e-01f,   6.55431673e-02f,   2.33845189e-02f,  -2.67673121e-03f,
+              7.17626214e-02f,   6.27776608e-02f,   3.66191287e-03f,   5.08348383e-02f,   8.83340165e-02f,   8.75379294e-02f,
+              1.37841806e-01f,   7.90384263e-02f,   4.81172558e-03f,  -5.50778757e-04f,   1.47662656e-02f,   1.29174720e-02f,
+              7.53495027e-04f,   1.04600526e-02f,   1.81760862e-02f,   1.80122796e-02f,   2.83630788e-02f,   1.62633751e-02f,
+             -1.50447581e-02f,   1.72211253e-03f,  -4.61694859e-02f,  -4.03888896e-02f,  -2.35594297e-03f,  -3.27053070e-02f,
+             -5.68309277e-02f,  -5.63187525e-02f,  -8.86824578e-02f,  -5.08504808e-02f,   4.90813963e-02f,   3.50898579e-02f,
+              5.28936796e-02f,  -1.17495283e-02f,  -3.52368653e-02f,  -7.99906626e-02f,  -9.32747498e-02f,   1.52220372e-02f,
+              4.58937995e-02f,  -3.07524893e-02f,   4.16392274e-02f,   4.00128812e-02f,   7.17228949e-02f,  -1.35403741e-02f,
+              5.07691689e-03f,  -1.61775127e-02f,  -9.45227370e-02f,  -3.97555903e-02f,   2.08727252e-02f,   1.68950073e-02f,
+              5.23571149e-02f,   5.08468486e-02f,   9.15857777e-02f,  -1.72121245e-02f,   8.20912886e-03f,  -1.76437553e-02f,
+             -1.19656160e-01f,  -5.27378917e-02f,   2.53025200e-02f,   2.34874841e-02f,   1.77440345e-02f,   2.80171465e-02f,
+              5.93069643e-02f,  -9.59444232e-03f,   3.96008343e-02f,   4.84357215e-02f,  -5.67563772e-02f,  -7.33256936e-02f,
+             -1.04415352e-02f,   5.32158539e-02f,   4.14247736e-02f,   5.52513786e-02f,   1.11834936e-01f,  -1.88568402e-02f,
+              5.77770062e-02f,   6.18311502e-02f,  -1.17241450e-01f,  -1.18961722e-01f,  -6.46757428e-03f,   8.16166103e-02f,
+              6.77767769e-02f,   8.77638906e-02f,   1.76070765e-01f,  -2.99334545e-02f,   8.55351314e-02f,   8.78687799e-02f,
+             -1.87864229e-01f,  -1.81088999e-01f,  -5.93537278e-03f,   1.22478589e-01f,   3.52832451e-02f,   3.51871178e-02f,
+              6.41349554e-02f,  -1.19205946e-02f,   8.67846329e-03f,  -7.23996805e-03f,  -8.20205584e-02f,  -4.02785838e-02f,
+              1.54261850e-02f,   1.96954831e-02f,   3.39197777e-02f,   1.07190479e-02f,   1.08787220e-03f,  -3.40105523e-03f,
+             -7.05463812e-02f,  -1.23552799e-01f,  -4.41306569e-02f,   8.00932124e-02f,   5.55760227e-02f,  -7.80328661e-02f,
+              2.89492449e-03f,  -8.80477205e-03f,  -2.53829844e-02f,   3.09938565e-03f,  -3.92026156e-02f,  -5.95848486e-02f,
+              1.08373584e-02f,   5.68106212e-02f,   2.18813848e-02f,  -4.74452600e-02f,   1.50077334e-02f,   1.27222268e-02f,
+              2.13964954e-02f,  -4.28762939e-03f,  -3.97151569e-03f,  -1.44047029e-02f,  -3.15149054e-02f,  -5.59142046e-03f,
+              1.05193742e-02f,  -1.04140257e-03f,  -2.38433247e-04f,   7.54302274e-03f,   3.14580575e-02f,   2.15718560e-02f,
+             -8.65567289e-03f,  -2.27464382e-02f,  -5.26608492e-04f,   1.01767853e-02f,   1.09782713e-02f,   1.46877449e-02f,
+             -1.12881344e-02f,   6.97806990e-03f,   3.44220102e-02f,   2.25569513e-02f,   2.68302765e-02f,  -1.11860491e-03f,
+             -1.16630308e-02f,   7.63769681e-03f,   1.54885948e-02f,   2.19058413e-02f,   1.21786613e-02f,  -9.89269000e-04f,
+             -1.09791150e-02f,  -1.92490667e-02f,  -7.91049153e-02f,  -7.42339417e-02f,  -3.69194848e-03f,   9.09875426e-03f,
+              3.34906043e-03f,   1.05664572e-02f,  -3.82428244e-02f,  -1.45670038e-03f,   1.22606475e-02f,   3.90422810e-03f,
+              1.19323052e-01f,   6.95378482e-02f,  -3.96575257e-02f,  -7.53259566e-03f,   1.70557145e-02f,   2.74188872e-02f,
+             -7.34492093e-02f,   3.14407935e-03f,   4.76536676e-02f,   1.66343246e-02f,   1.97571591e-01f,   8.34214613e-02f,
+             -8.56219903e-02f,  -1.53475697e-03f,   4.74434234e-02f,   7.65424520e-02f,  -4.49826457e-02f,  -7.41802331e-04f,
+              1.79114416e-02f,   4.27568666e-05f,   1.16472080e-01f,   4.89368103e-02f,  -5.53331450e-02f,  -2.96606729e-03f,
+              2.72040498e-02f,   4.57892902e-02f,  -2.96378620e-02f,  -4.33693826e-03f,  -5.17140329e-03f,  -2.40886863e-02f,
+              4.08520401e-02f,  -9.54776444e-03f,  -5.18366694e-02f,   1.05170417e-03f,   2.26900969e-02f,   4.37124334e-02f,
+             -9.50504560e-03f,  -3.27089801e-03f,  -1.04200598e-02f,  -2.57881749e-02f,  -2.38785949e-02f,  -4.91046496e-02f,
+             -3.15581672e-02f,   5.73344808e-03f,   1.45322708e-02f,   3.06461994e-02f,  -7.38716824e-03f,  -4.72490327e-04f,
+              8.81953223e-04f,  -9.04999673e-03f,  -5.38205821e-03f,  -2.37589609e-02f,  -1.85925923e-02f,   4.07636166e-03f,
+              1.02828220e-02f,   1.96871962e-02f,   1.47350067e-02f,   2.18371558e-03f,   2.66081328e-03f,   1.17252478e-02f,
+             -2.13646200e-02f,   3.31825064e-03f,   2.53813248e-02f,  -2.79601139e-04f,  -1.09827453e-02f,  -2.11544409e-02f,
+              1.44497044e-02f,  -9.35506728e-03f,  -8.47576279e-03f,   2.06168983e-02f,   1.92099232e-02f,   1.89451054e-02f,
+              7.75053399e-03f,   4.03929874e-03f,  -1.19445911e-02f,  -5.14147468e-02f,  -9.37361550e-03f,   6.07406860e-03f,
+              3.08980234e-03f,  -1.81216393e-02f,  -1.56642646e-02f,  -1.46925906e-02f,  -9.22542624e-03f,  -8.13657884e-03f,
+              4.46072826e-03f,   3.81137319e-02f,  -2.47961301e-02f,   1.60730314e-02f,   5.83168725e-03f,  -5.25532737e-02f,
+             -4.45508584e-02f,  -4.12027352e-02f,  -2.84855179e-02f,  -2.68873274e-02f,   8.60323105e-03f,   1.05451539e-01f,
+              6.96334010e-03f,  -4.50864714e-03f,  -3.89528833e-03f,   1.03082480e-02f,   9.50888358e-03f,   9.31843184e-03f,
+              4.06473968e-03f,   2.37987493e-03f,  -5.49784815e-03f,  -2.51508374e-02f,  -6.96243485e-03f,   4.46649780e-03f,
+              2.25114655e-02f,   2.63882317e-02f,   1.52478125e-02f,   9.25541762e-03f,   2.83817798e-02f,   4.02591564e-02f,
+              3.09106894e-02f,  -1.16506135e-02f,   1.69887654e-02f,  -1.10187121e-02f,  -1.09684188e-03f,   4.17197682e-02f,
+              3.43779661e-02f,   3.11213620e-02f,   2.45684329e-02f,   2.50604860e-02f,  -1.93744060e-03f,  -7.79784098e-02f,
+              1.16146738e-02f,  -7.48279924e-03f,  -2.32979767e-02f,  -1.59218479e-02f,  -6.48013316e-03f,  -1.21807866e-03f,
+             -2.25011911e-02f,  -3.45099904e-02f,  -3.21048833e-02f,  -8.74222163e-03f,  -3.94437201e-02f,   2.55888216e-02f,
+             -1.82370888e-04f,  -1.02242030e-01f,  -8.34459811e-02f,  -7.49786273e-02f,  -6.17979988e-02f,  -6.44345507e-02f,
+              7.72957865e-04f,   1.86440751e-01f,  -4.93833795e-02f,   3.19484882e-02f,   3.94635238e-02f,  -4.97704484e-02f,
+             -5.16939610e-02f,  -5.42749986e-02f,  -8.19411408e-03f,   1.02364291e-02f,   5.51509187e-02f,   1.54967219e-01f,
+             -4.30084281e-02f,   2.78019886e-02f,   4.43281680e-02f,  -2.37153918e-02f,  -3.17777507e-02f,  -3.73331122e-02f,
+              1.02207176e-02f,   3.17246616e-02f,   6.16264567e-02f,   1.15277082e-01f,  -1.27815856e-02f,  -1.81864128e-02f,
+             -1.49782216e-02f,  -9.22367536e-03f,   3.45639139e-02f,   4.65996899e-02f,  -9.61503480e-03f,  -3.64228413e-02f,
+             -2.77755782e-02f,   2.01318692e-02f,  -6.72118086e-03f,  -2.00846046e-02f,  -1.89038124e-02f,  -1.48949521e-02f,
+              2.45231725e-02f,   1.59359947e-02f,  -2.88604330e-02f,  -5.41874506e-02f,  -3.99279296e-02f,   4.73744469e-03f,
+             -1.58844143e-02f,  -1.87803507e-02f,  -1.46095008e-02f,  -7.81492610e-03f,   4.06492874e-02f,   6.10238574e-02f,
+             -3.30427312e-03f,  -3.25414911e-02f,  -2.53222194e-02f,   2.71431338e-02f,   3.49106570e-03f,   1.83308385e-02f,
+              1.80975627e-02f,   1.52774630e-02f,  -1.75031051e-02f,  -1.84481801e-03f,   3.28610986e-02f,   5.44470735e-02f,
+              3.97491492e-02f,   1.93022727e-03f,   1.92827657e-02f,   3.30817550e-02f,   2.85133719e-02f,   1.93045251e-02f,
+             -5.55501990e-02f,  -6.57047331e-02f,   2.72775274e-02f,   7.37461597e-02f,   5.54895401e-02f,  -2.72335336e-02f,
+             -1.02602197e-02f,  -8.61456711e-03f,  -5.75130759e-03f,  -1.69095385e-03f,   2.41351612e-02f,   4.22807001e-02f,
+              5.82110509e-03f,  -9.31096449e-03f,  -7.89369643e-03f,   1.94872599e-02f,  -2.13236120e-02f,  -3.52305211e-02f,
+             -3.01135555e-02f,  -2.00564098e-02f,   6.06134944e-02f,   7.37602562e-02f,  -2.71044225e-02f,  -7.70475343e-02f,
+             -5.81072159e-02f,   3.08677536e-02f,  -2.34650099e-03f,  -1.11362319e-02f,  -1.09224329e-02f,  -9.13759042e-03f,
+              1.10498313e-02f,   2.20482098e-03f,  -1.94069371e-02f,  -3.26512717e-02f,  -2.38657948e-02f,  -6.38784608e-04f,
+             -1.75194927e-02f,  -9.34820250e-03f,  -4.20118077e-03f,   2.23111594e-03f,   3.79765593e-02f,   7.65611604e-02f,
+              2.20695641e-02f,   1.95383327e-03f,  -5.75262413e-04f,   3.62552069e-02f,   1.20371738e-02f,   5.41676432e-02f,
+              5.29284962e-02f,   4.40489948e-02f,  -5.48983514e-02f,  -1.37205021e-02f,   9.28587690e-02f,   1.57641247e-01f,
+              1.15305059e-01f,   1.63168740e-03f,  -7.98223700e-05f,  -8.58988147e-04f,  -4.53070644e-03f,  -5.56150358e-03f,
+              1.03193559e-02f,   5.75394789e-03f,  -5.03684441e-03f,  -1.41132774e-03f,  -3.94409103e-03f,   2.39481218e-04f,
+              6.28435984e-02f,   1.38781536e-02f,  -4.76654805e-02f,  -2.36361939e-03f,  -3.30433398e-02f,  -8.95520020e-03f,
+             -2.14251503e-02f,  -1.05974540e-01f,  -9.93221998e-02f,  -1.00970916e-01f,   2.00544447e-02f,   3.33322748e-03f,
+             -2.11890545e-02f,  -7.99973495e-03f,   2.83735595e-03f,   4.61956952e-03f,  -1.34309623e-02f,  -3.58311869e-02f,
+             -3.69951874e-02f,  -3.20766754e-02f,   3.20232622e-02f,   1.27743483e-02f,   6.82894513e-03f,   3.65098380e-02f,
+             -8.64944384e-02f,  -4.34844568e-02f,   2.34047808e-02f,  -4.35237326e-02f,  -2.30249800e-02f,  -5.22057116e-02f,
+              4.18030806e-02f,   2.12445147e-02f,   3.38467620e-02f,   7.78772756e-02f,  -1.68719798e-01f,  -8.79489034e-02f,
+              5.80523461e-02f,  -4.84207347e-02f,  -7.95371644e-03f,  -6.87532127e-02f,   3.57759073e-02f,  -2.51818052e-03f,
+             -8.39899629e-02f,  -7.02524036e-02f,   1.08456671e-01f,   6.60138354e-02f,  -7.49066621e-02f,  -7.94734284e-02f,
+             -1.06945626e-01f,  -5.61038069e-02f,   5.05430587e-02f,  -1.72164128e-03f,  -1.08639605e-01f,  -8.71078447e-02f,
+              1.30797461e-01f,   8.07311535e-02f,  -9.47752744e-02f,  -1.08904079e-01f,  -1.42207533e-01f,  -7.95043856e-02f,
+              3.75021398e-02f,   4.46579978e-03f,  -4.92684133e-02f,  -2.66486239e-02f,   2.68949233e-02f,   2.07017139e-02f,
+             -3.57538536e-02f,  -7.02523440e-02f,  -7.77317062e-02f,  -5.97502552e-02f,   5.08024618e-02f,   9.33585595e-03f,
+             -4.88089174e-02f,  -1.43655054e-02f,  -3.70869809e-03f,   5.61398594e-03f,  -2.86546275e-02f,  -8.91294926e-02f,
+             -8.94018263e-02f,  -8.13754424e-02f,   2.40741018e-02f,   1.05673699e-02f,   1.03943255e-02f,   3.38226371e-02f,
+             -7.67994076e-02f,  -3.92699651e-02f,   2.33972594e-02f,  -3.09485067e-02f,  -1.26458863e-02f,  -3.93740870e-02f,
+              5.99434078e-02f,  -1.19963130e-02f,  -1.19582243e-01f,  -7.31455609e-02f,  -2.69702915e-02f,   5.67636639e-02f,
+              1.00865223e-01f,  -1.29873389e-02f,   1.88917648e-02f,   5.76417781e-02f,   3.42513137e-02f,  -7.66671496e-03f,
+             -6.78436980e-02f,  -3.76062728e-02f,  -1.84202194e-02f,   3.31541486e-02f,   6.13844581e-02f,  -5.78691997e-03f,
+              9.60453320e-03f,   3.32151018e-02f,  -1.51994238e-02f,  -4.14078720e-02f,   5.68623766e-02f,   2.47813359e-01f,
+             -1.57888576e-01f,   2.50006393e-02f,   1.79715768e-01f,   9.27281156e-02f,  -6.99307173e-02f,   6.51151757e-04f,
+             -4.75450717e-02f,  -5.17350361e-02f,   1.31420791e-01f,   3.73937517e-01f,  -2.05596402e-01f,   9.26025491e-03f,
+              2.02881500e-01f,   1.33539394e-01f,  -1.04745567e-01f,  -2.46821549e-02f,  -2.63151284e-02f,  -4.27558944e-02f,
+              8.11704844e-02f,   2.79804170e-01f,  -1.66127011e-01f,   1.76407937e-02f,   1.77511662e-01f,   1.02324650e-01f,
+             -7.86695108e-02f,  -8.81068595e-03f,  -1.67632680e-02f,  -9.80255846e-03f,   4.12975661e-02f,   8.83193389e-02f,
+             -4.12178598e-02f,  -4.21327306e-03f,   3.25602479e-02f,   3.01051699e-02f,  -2.45650373e-02f,  -1.16005093e-02f,
+              1.98318437e-02f,   3.29370387e-02f,  -6.15993254e-02f,  -2.14556202e-01f,   1.27847701e-01f,  -1.39282476e-02f,
+             -1.37079969e-01f,  -7.85533488e-02f,   6.03353865e-02f,   6.39442541e-03f,   2.38021705e-02f,  -1.06411409e-02f,
+             -4.39738594e-02f,   1.27192843e-03f,  -3.24915238e-02f,   2.77486909e-02f,   6.71974197e-02f,   6.66920235e-03f,
+             -1.11217005e-03f,   2.49070283e-02f,   1.86023079e-02f,  -3.25915962e-03f,  -3.73869501e-02f,  -2.50909030e-02f,
+             -6.65139593e-03f,   1.72046032e-02f,   2.91601568e-02f,  -4.96330298e-03f,   6.54220534e-03f,   1.77287851e-02f,
+              3.48908715e-02f,  -2.11529410e-03f,  -7.25107193e-02f,  -6.76804483e-02f,   2.33950885e-03f,   2.87263673e-02f,
+              3.62301804e-02f,  -1.73527524e-02f,   1.81292072e-02f,   3.18794176e-02f,  -5.01414668e-03f,  -1.61169153e-02f,
+             -7.28780637e-03f,   7.91373104e-03f,  -1.78938229e-02f,  -2.72997804e-02f,  -2.17643753e-02f,   2.51412275e-03f,
+              2.50892825e-02f,   2.46526878e-02f,  -7.09508196e-04f,  -1.49206687e-02f,  -4.27259468e-02f,  -3.41066495e-02f,
+             -5.76944789e-03f,  -1.68421753e-02f,  -1.87334735e-02f,  -1.13526843e-02f,   4.09550825e-03f,   4.63117473e-03f,
+             -3.65915778e-03f,  -4.60313028e-03f,   1.82945300e-02f,   2.57249437e-02f,  -1.12248566e-02f,  -1.25719616e-02f,
+             -7.01772422e-03f,   8.46555084e-03f,   1.80004835e-02f,   1.73435193e-02f,  -5.56615600e-03f,   6.27366174e-03f,
+              7.16203153e-02f,   7.61296153e-02f,  -1.36745237e-02f,  -5.49201760e-03f,   5.76591678e-03f,   2.51746662e-02f,
+              2.68088058e-02f,   2.51819734e-02f,   4.06073267e-03f,   1.16048856e-02f,   1.12739776e-03f,  -1.04429340e-02f,
+              1.41206691e-02f,   2.06225533e-02f,   1.58333983e-02f,  -3.37686692e-03f,  -2.02562362e-02f,  -1.98342409e-02f,
+              7.02454057e-03f,   1.35615785e-02f,  -1.95347741e-02f,  -3.62168923e-02f,   2.27586869e-02f,   2.89862268e-02f,
+              1.93234254e-02f,  -1.18748248e-02f,  -3.47596481e-02f,  -3.37217897e-02f,   6.80625159e-03f,   1.55170891e-03f,
+             -5.71534149e-02f,  -6.73870370e-02f,   1.90833658e-02f,   1.61861312e-02f,   4.37156577e-03f,  -2.22400986e-02f,
+             -3.31795141e-02f,  -3.16261724e-02f,   1.02418717e-02f,  -8.66750255e-03f,  -1.22295797e-01f,  -1.32064849e-01f,
+              2.58981455e-02f,   1.30588179e-02f,  -7.04748789e-03f,  -4.36578356e-02f,  -4.94529903e-02f,  -4.65955175e-02f,
+              2.64056143e-03f,  -1.63822975e-02f,  -7.81977996e-02f,  -7.34767541e-02f,   3.05349869e-03f,  -1.11603746e-02f,
+             -1.93377342e-02f,  -2.43607257e-02f,  -1.21395960e-02f,  -1.07341828e-02f,   7.86665827e-03f,   5.39268646e-03f,
+             -5.41854389e-02f,  -6.78552613e-02f,   2.29783859e-02f,   2.24036984e-02f,   9.51000862e-03f,  -2.23711506e-02f,
+             -3.85041311e-02f,  -3.68789025e-02f,   3.21472846e-02f,  -3.75855975e-02f,  -1.41973242e-01f,  -1.26380086e-01f,
+             -1.77358150e-01f,  -1.25143409e-01f,   1.11730047e-01f,   7.79136270e-02f,   5.61444163e-02f,   1.94007948e-01f,
+              1.67318638e-02f,  -2.61361059e-02f,  -8.07996541e-02f,  -6.39255941e-02f,  -9.10037830e-02f,  -7.82094374e-02f,
+              4.51635718e-02f,   4.14409935e-02f,   3.55011821e-02f,   1.04672313e-01f,   4.89446986e-03f,  -2.34894808e-02f,
+             -4.02809530e-02f,  -1.42358029e-02f,  -2.34712902e-02f,  -5.43925241e-02f,  -1.80950612e-02f,   1.42648704e-02f,
+              2.55196001e-02f,   3.95272411e-02f,  -1.35999983e-02f,   2.34599621e-03f,   4.58221510e-02f,   5.72843961e-02f,
+              7.77262598e-02f,   2.59814765e-02f,  -7.40506202e-02f,  -3.11287455e-02f,  -1.08042443e-02f,  -7.44546652e-02f,
+             -6.47409866e-03f,   2.92104539e-02f,   5.13271205e-02f,   1.93542633e-02f,   3.14160809e-02f,   6.82474896e-02f,
+              2.02598833e-02f,  -1.86171792e-02f,  -3.19790430e-02f,  -5.12384251e-02f,   1.13478824e-02f,   4.61895093e-02f,
+              1.23471841e-02f,  -6.13633990e-02f,  -7.44257346e-02f,   7.40871653e-02f,   1.56922475e-01f,   1.94636118e-02f,
+             -3.69762182e-02f,   3.50552313e-02f,   1.29985390e-02f,   6.83382945e-03f,  -3.42607051e-02f,  -5.73081188e-02f,
+             -7.60929659e-02f,  -6.77979970e-03f,   8.87092799e-02f,   2.85248347e-02f,   1.65671925e-03f,   6.60590157e-02f,
+              2.00641202e-03f,  -1.27369387e-03f,  -7.73464376e-03f,  -8.18984304e-03f,  -1.12825930e-02f,  -5.67806279e-03f,
+              9.09187552e-03f,   4.71785944e-03f,   2.48001073e-03f,   1.15058431e-02f,  -1.29443025e-02f,  -2.30378844e-02f,
+              1.70644615e-02f,   6.16424233e-02f,   7.90021867e-02f,  -2.55356710e-02f,  -1.20413318e-01f,  -2.62108892e-02f,
+              1.38559779e-02f,  -5.66568486e-02f,  -3.24166231e-02f,   5.62061975e-03f,   1.09250776e-01f,   1.36533588e-01f,
+              1.85260713e-01f,   6.19860180e-02f,  -1.76448435e-01f,  -7.42016062e-02f,  -2.57802065e-02f,  -1.77484497e-01f,
+             -3.35575693e-04f,   7.46114785e-03f,   6.53330376e-03f,  -7.65228793e-02f,  -4.80906852e-02f,  -3.08318473e-02f,
+             -3.58606759e-03f,   7.63029680e-02f,   1.08232222e-01f,   1.19743146e-01f,   1.04759261e-02f,   4.64391662e-03f,
+             -9.14680120e-03f,  -4.76796515e-02f,  -3.06807328e-02f,  -1.33295292e-02f,   9.87011939e-03f,   4.27864753e-02f,
+              5.64128608e-02f,   5.31765260e-02f,  -2.82462481e-02f,  -4.46002511e-03f,   2.70826500e-02f,   4.32738336e-03f,
+              5.12424111e-03f,  -1.67441741e-03f,  -3.40298451e-02f,  -1.62837226e-02f,   1.40322407e-03f,   4.13208902e-02f,
+             -5.64170182e-02f,  -1.29676657e-02f,   4.84360978e-02f,   2.71964334e-02f,   2.21829023e-02f,   1.08300056e-02f,
+             -6.84205368e-02f,  -6.46262169e-02f,  -3.53756510e-02f,   4.88827080e-02f,  -2.95581128e-02f,  -1.24223437e-02f,
+              8.90509412e-03f,  -4.55886871e-02f,  -2.45593842e-02f,   1.60564762e-02f,  -4.46136333e-02f,  -4.37729508e-02f,
+              4.60379664e-03f,   9.43746343e-02f,  -2.68307384e-02f,  -1.03570186e-02f,   1.33480504e-02f,  -6.07938785e-03f,
+             -6.45117951e-04f,   1.56455170e-02f,  -3.66364233e-02f,  -4.84379344e-02f,  -2.22987495e-02f,   3.99972387e-02f,
+             -2.72862725e-02f,   1.54006751e-02f,   6.73266351e-02f,   4.99528423e-02f,   3.06907017e-02f,  -5.57166673e-02f,
+             -1.77552029e-02f,   8.52001905e-02f,   6.59320578e-02f,   2.00297553e-02f,  -1.29808001e-02f,   3.66935842e-02f,
+              9.14656594e-02f,   7.31322765e-02f,   4.13437374e-02f,  -1.09155394e-01f,   1.22878766e-02f,   1.98535845e-01f,
+              1.44330949e-01f,   5.30249951e-03f,  -1.89805571e-02f,   1.00125978e-02f,   5.30516915e-02f,   1.09286308e-01f,
+              6.73888102e-02f,  -2.85832901e-02f,  -5.64143574e-03f,   2.48848125e-02f,  -2.41479669e-02f,  -8.81023780e-02f,
+             -1.99291520e-02f,  -2.40724292e-02f,  -1.34447217e-02f,   6.50390014e-02f,   4.44592610e-02f,   6.82374984e-02f,
+             -2.95400731e-02f,  -1.63360849e-01f,  -1.65889859e-01f,  -9.89022106e-02f,  -9.01773293e-03f,   2.27201311e-03f,
+              1.61154885e-02f,   6.28597243e-03f,  -2.28043087e-03f,  -1.04578491e-02f,  -1.40363965e-02f,   8.51848221e-04f,
+              3.59160006e-02f,   6.08649962e-02f,   3.43725868e-02f,   2.66859680e-02f,   2.36401297e-02f,  -2.22453028e-02f,
+             -8.61506611e-02f,  -1.17797375e-01f,  -1.41478881e-01f,  -1.82049707e-01f,  -1.10206775e-01f,   1.00608887e-02f,
+              3.02858632e-02f,   2.59303711e-02f,   2.66469456e-02f,  -1.94831863e-02f,  -8.23938474e-02f,  -1.14573769e-01f,
+             -1.37991995e-01f,  -1.72632784e-01f,  -9.52782929e-02f,   2.54183970e-02f,  -1.94400288e-02f,  -2.12753024e-02f,
+             -2.82496121e-02f,   1.22812968e-02f,   6.53135106e-02f,   9.41994041e-02f,   1.14121042e-01f,   1.34236783e-01f,
+              5.76603897e-02f,  -4.80297431e-02f,  -3.07943374e-02f,  -3.08432281e-02f,  -3.78702767e-02f,   1.95930786e-02f,
+              9.57914963e-02f,   1.36469007e-01f,   1.65008187e-01f,   1.98181167e-01f,   9.34965685e-02f,  -5.65080978e-02f,
+             -3.56695466e-02f,  -4.34713550e-02f,  -6.25059232e-02f,   2.23192219e-02f,   1.31739080e-01f,   1.92621008e-01f,
+              2.33856440e-01f,   2.68736184e-01f,   1.02449410e-01f,  -1.18494846e-01f,  -1.24698170e-02f,  -3.19479108e-02f,
+             -6.21651337e-02f,   6.99002622e-03f,   9.10013840e-02f,   1.42054111e-01f,   1.74156606e-01f,   1.78683415e-01f,
+              2.31656674e-02f,  -1.56136960e-01f,  -1.89874638e-02f,  -5.63544594e-02f,  -1.13208458e-01f,   1.02695869e-02f,
+              1.59248576e-01f,   2.50684083e-01f,   3.07704747e-01f,   3.11069518e-01f,   2.94525940e-02f,  -2.90533155e-01f,
+              1.33119514e-02f,  -3.31724808e-02f,  -9.55534801e-02f,  -1.07259015e-02f,   8.33773240e-02f,   1.48441613e-01f,
+              1.85209468e-01f,   1.49583310e-01f,  -7.55377486e-02f,  -2.94052601e-01f,   8.32551941e-02f,   3.03498581e-02f,
+             -2.52589900e-02f,  -5.55445850e-02f,  -1.16667174e-01f,  -1.32385373e-01f,  -1.53541580e-01f,  -2.67503321e-01f,
+             -2.92829573e-01f,  -2.10437834e-01f,   3.12751755e-02f,   4.57529426e-02f,   3.44235934e-02f,  -4.81733568e-02f,
+             -7.18653947e-02f,  -4.78606038e-02f,  -4.55713421e-02f,  -6.80743679e-02f,   4.34298739e-02f,   7.97893107e-02f,
+              5.89264976e-03f,   8.62044934e-03f,   6.48585241e-03f,  -9.07648634e-03f,  -1.35403732e-02f,  -9.01755877e-03f,
+             -8.58623255e-03f,  -1.28260953e-02f,   8.18275288e-03f,   1.50333429e-02f,  -6.98141381e-02f,  -1.02132186e-01f,
+             -7.68422037e-02f,   1.07535161e-01f,   1.60421804e-01f,   1.06837012e-01f,   1.01726800e-01f,   1.51959270e-01f,
+             -9.69465077e-02f,  -1.78110003e-01f,  -6.63978681e-02f,  -9.71344709e-02f,  -7.30820224e-02f,   1.02273054e-01f,
+              1.52571753e-01f,   1.01609074e-01f,   9.67489257e-02f,   1.44523337e-01f,  -9.22025442e-02f,  -1.69394404e-01f,
+             -4.61325943e-02f,  -6.74880892e-02f,  -5.07766828e-02f,   7.10583329e-02f,   1.06005378e-01f,   7.05970004e-02f,
+              6.72202185e-02f,   1.00413412e-01f,  -6.40614405e-02f,  -1.17693596e-01f,  -6.04795180e-02f,  -8.84764269e-02f,
+             -6.65678829e-02f,   9.31569859e-02f,   1.38972327e-01f,   9.25521925e-02f,   8.81252438e-02f,   1.31641299e-01f,
+             -8.39841068e-02f,  -1.54295504e-01f,  -8.01537484e-02f,  -1.17258169e-01f,  -8.82226899e-02f,   1.23461336e-01f,
+              1.84180588e-01f,   1.22659795e-01f,   1.16792746e-01f,   1.74464747e-01f,  -1.11304477e-01f,  -2.04488456e-01f,
+             -5.45275472e-02f,  -7.97691941e-02f,  -6.00167364e-02f,   8.39891285e-02f,   1.25295639e-01f,   8.34438503e-02f,
+              7.94525743e-02f,   1.18686087e-01f,  -7.57189766e-02f,  -1.39110819e-01f,  -1.57899708e-02f,  -2.30993945e-02f,
+             -1.73795186e-02f,   2.43213922e-02f,   3.62828448e-02f,   2.41634920e-02f,   2.30077077e-02f,   3.43688652e-02f,
+             -2.19265409e-02f,  -4.02834117e-02f,  -4.23913337e-02f,  -6.20149449e-02f,  -4.66587953e-02f,   6.52956441e-02f,
+              9.74085554e-02f,   6.48717284e-02f,   6.17687926e-02f,   9.22700912e-02f,  -5.88661842e-02f,  -1.08148880e-01f,
+             -2.27091927e-03f,   5.04179439e-03f,   2.10875249e-03f,   1.34434190e-03f,   2.33185085e-04f,  -4.63206228e-03f,
+             -8.88693612e-03f,  -1.20926332e-02f,  -6.29731547e-03f,   8.74079205e-03f,  -2.07965896e-02f,   4.61716689e-02f,
+              1.93115007e-02f,   1.23111941e-02f,   2.13545887e-03f,  -4.24194261e-02f,  -8.13846514e-02f,  -1.10741735e-01f,
+             -5.76694608e-02f,   8.00462887e-02f,  -3.58491540e-02f,   7.95907080e-02f,   3.32891606e-02f,   2.12220326e-02f,
+              3.68110323e-03f,  -7.31225908e-02f,  -1.40290827e-01f,  -1.90896556e-01f,  -9.94106010e-02f,   1.37983769e-01f,
+             -1.85810886e-02f,   4.12529111e-02f,   1.72542110e-02f,   1.09996591e-02f,   1.90796435e-03f,  -3.79004031e-02f,
+             -7.27145895e-02f,  -9.89442021e-02f,  -5.15258238e-02f,   7.15188086e-02f,  -1.22235781e-02f,   2.71382481e-02f,
+              1.13506904e-02f,   7.23613054e-03f,   1.25515519e-03f,  -2.49327980e-02f,  -4.78353240e-02f,  -6.50904924e-02f,
+             -3.38962860e-02f,   4.70486805e-02f,  -2.02944111e-02f,   4.50567529e-02f,   1.88451838e-02f,   1.20139141e-02f,
+              2.08389363e-03f,  -4.13951203e-02f,  -7.94194415e-02f,  -1.08067639e-01f,  -5.62769063e-02f,   7.81133994e-02f,
+             -4.11551073e-02f,   9.13707465e-02f,   3.82162109e-02f,   2.43630558e-02f,   4.22593486e-03f,  -8.39453042e-02f,
+             -1.61054954e-01f,  -2.19150722e-01f,  -1.14124134e-01f,   1.58406436e-01f,  -2.04358008e-02f,   4.53706570e-02f,
+              1.89764760e-02f,   1.20976130e-02f,   2.09841179e-03f,  -4.16835137e-02f,  -7.99727440e-02f,  -1.08820528e-01f,
+             -5.66689819e-02f,   7.86576048e-02f,  -1.02968551e-02f,   2.28606202e-02f,   9.56155453e-03f,   6.09554630e-03f,
+              1.05731317e-03f,  -2.10028030e-02f,  -4.02953513e-02f,  -5.48307002e-02f,  -2.85534337e-02f,   3.96327004e-02f,
+             -1.81788597e-02f,   4.03598957e-02f,   1.68807022e-02f,   1.07615460e-02f,   1.86666206e-03f,  -3.70799638e-02f,
+             -7.11405128e-02f,  -9.68023315e-02f,  -5.04104272e-02f,   6.99706152e-02f,  -4.11966676e-03f,   1.17887128e-02f,
+             -9.44655668e-03f,   7.35725102e-04f,   3.70992124e-02f,  -1.42114740e-02f,  -5.76614887e-02f,  -6.02409542e-02f,
+             -2.82642394e-02f,   5.64171337e-02f,   1.85309188e-03f,  -5.30275097e-03f,   4.24921187e-03f,  -3.30940878e-04f,
+             -1.66878160e-02f,   6.39254786e-03f,   2.59370562e-02f,   2.70973425e-02f,   1.27137052e-02f,  -2.53773276e-02f,
+              2.37977528e-03f,  -6.80989167e-03f,   5.45691745e-03f,  -4.25000471e-04f,  -2.14308053e-02f,   8.20942968e-03f,
+              3.33088525e-02f,   3.47989127e-02f,   1.63271781e-02f,  -3.25900391e-02f,  -2.99717416e-03f,   8.57662130e-03f,
+             -6.87263720e-03f,   5.35260828e-04f,   2.69907247e-02f,  -1.03392489e-02f,  -4.19503637e-02f,  -4.38269973e-02f,
+             -2.05630325e-02f,   4.10450622e-02f,  -3.58103169e-03f,   1.02473702e-02f,  -8.21144506e-03f,   6.39531005e-04f,
+              3.22485901e-02f,  -1.23533625e-02f,  -5.01224026e-02f,  -5.23646139e-02f,  -2.45687664e-02f,   4.90407497e-02f,
+             -5.60825411e-03f,   1.60484072e-02f,  -1.28599452e-02f,   1.00156956e-03f,   5.05045168e-02f,  -1.93466023e-02f,
+             -7.84967020e-02f,  -8.20082277e-02f,  -3.84771451e-02f,   7.68027157e-02f,  -8.92561115e-03f,   2.55412553e-02f,
+             -2.04667747e-02f,   1.59401144e-03f,   8.03786218e-02f,  -3.07903774e-02f,  -1.24928549e-01f,  -1.30517200e-01f,
+             -6.12368956e-02f,   1.22232556e-01f,  -9.99648217e-03f,   2.86056269e-02f,  -2.29223240e-02f,   1.78525655e-03f,
+              9.00222287e-02f,  -3.44845206e-02f,  -1.39917135e-01f,  -1.46176293e-01f,  -6.85839280e-02f,   1.36897683e-01f,
+             -1.02241170e-02f,   2.92570181e-02f,  -2.34442987e-02f,   1.82590948e-03f,   9.20721665e-02f,  -3.52697857e-02f,
+             -1.43103257e-01f,  -1.49504945e-01f,  -7.01456890e-02f,   1.40015051e-01f,  -7.68898928e-04f,   2.20025750e-03f,
+             -1.76311529e-03f,   1.37316500e-04f,   6.92423526e-03f,  -2.65244441e-03f,  -1.07620005e-02f,  -1.12434346e-02f,
+             -5.27526718e-03f,   1.05297528e-02f,   3.79723683e-03f,   2.36611385e-02f,   3.62362154e-02f,   9.57294647e-03f,
+             -4.34714109e-02f,  -7.91679323e-02f,  -3.64038870e-02f,   3.24085765e-02f,   1.74086560e-02f,   6.84047118e-02f,
+              1.79562028e-02f,   4.95183617e-02f,   5.36037646e-02f,   1.88052095e-02f,  -4.56335805e-02f,  -1.06066547e-01f,
+             -6.64077848e-02f,   4.19711843e-02f,   1.88023169e-02f,   9.44816321e-02f,   4.35410067e-03f,   2.00376175e-02f,
+              2.81584281e-02f,   7.96712469e-03f,  -3.16570140e-02f,  -6.02635592e-02f,  -2.97167469e-02f,   2.45050192e-02f,
+              1.27374632e-02f,   5.23929335e-02f,   1.22338114e-02f,   2.94196210e-03f,  -2.16186289e-02f,  -2.54113169e-04f,
+              4.78774905e-02f,   6.02111779e-02f,   6.96444372e-03f,  -2.63507273e-02f,  -1.85529254e-02f,  -4.86935377e-02f,
+             -2.47127749e-03f,  -1.13594914e-02f,  -1.59568023e-02f,  -4.51627281e-03f,   1.79334786e-02f,   3.41466293e-02f,
+              1.68438349e-02f,  -1.38846040e-02f,  -7.21586263e-03f,  -2.96878777e-02f,  -4.47093882e-03f,  -1.27676148e-02f,
+             -1.41737303e-02f,  -4.86816280e-03f,   1.24854473e-02f,   2.82937102e-02f,   1.72774736e-02f,  -1.12319030e-02f,
+             -5.12765907e-03f,  -2.51331124e-02f,  -2.30619106e-02f,  -2.80095637e-02f,  -1.65645208e-03f,  -9.05216392e-03f,
+             -3.26506644e-02f,  -1.68700777e-02f,   2.49549318e-02f,   9.59337503e-03f,   1.20963212e-02f,   9.31718480e-03f,
+             -2.45159958e-02f,  -2.74986029e-02f,   2.53790431e-03f,  -8.65679886e-03f,  -4.05481867e-02f,  -2.77289171e-02f,
+              2.26680841e-02f,   1.42609356e-02f,   1.51779810e-02f,   1.82645973e-02f,  -1.75577905e-02f,  -2.28916388e-02f,
+             -4.21955157e-03f,  -7.55659351e-03f,  -2.08397154e-02f,  -6.10270211e-03f,   2.16556713e-02f,   4.50780522e-03f,
+              7.61340698e-03f,   1.34014583e-03f,  -2.48718373e-02f,  -2.81662531e-02f,   2.06780108e-03f,  -8.89637973e-03f,
+             -4.04481776e-02f,  -2.69762892e-02f,   2.34523322e-02f,   1.39888320e-02f,   1.51248174e-02f,   1.75438467e-02f,
+              1.92555171e-02f,   3.30081731e-02f,   1.27562424e-02f,  -2.34591449e-03f,   1.85739959e-03f,  -2.51926873e-02f,
+             -4.71299961e-02f,  -1.16367936e-02f,  -5.93214622e-03f,   4.46818909e-03f,   1.00017294e-01f,   1.28796414e-01f,
+             -6.14873460e-03f,  -2.60273237e-02f,   3.30314152e-02f,  -1.29506197e-02f,  -1.03804350e-01f,  -1.33280782e-03f,
+              2.13176142e-02f,   6.85516745e-03f,   1.72167867e-01f,   2.04786524e-01f,  -3.93080860e-02f,  -5.02940677e-02f,
+              6.61358684e-02f,   2.44798157e-02f,  -1.22753002e-01f,   2.11549439e-02f,   5.73757105e-02f,   5.31294942e-03f,
+              1.70639530e-01f,   1.88640177e-01f,  -6.32818118e-02f,  -5.44973761e-02f,   7.34036937e-02f,   6.38686568e-02f,
+             -7.42997900e-02f,   4.08234335e-02f,   7.43777379e-02f,  -2.27605982e-04f,   1.52944878e-01f,   1.67414963e-01f,
+             -5.95443398e-02f,  -4.93861921e-02f,   6.67042136e-02f,   6.18452169e-02f,  -6.10948429e-02f,   3.88961248e-02f,
+              6.86986595e-02f,  -8.41954898e-04f,   7.98759889e-03f,   9.33688506e-03f,  -2.10211519e-03f,  -2.38658604e-03f,
+              3.15824710e-03f,   1.58913399e-03f,  -5.15281549e-03f,   1.20878255e-03f,   2.86237313e-03f,   1.83601936e-04f,
+             -7.68447965e-02f,  -9.24896002e-02f,   1.57013014e-02f,   2.20956858e-02f,  -2.89235562e-02f,  -7.92462099e-03f,
+              5.83786629e-02f,  -7.93738384e-03f,  -2.42817476e-02f,  -2.78768851e-03f,  -8.83208737e-02f,  -1.16049081e-01f,
+              1.50055590e-03f,   2.22324524e-02f,  -2.78996937e-02f,   1.78341605e-02f,   9.93162319e-02f,   4.38455865e-03f,
+             -1.59958340e-02f,  -6.94090780e-03f,  -8.58759433e-02f,  -1.12155527e-01f,   2.61508604e-03f,   2.18380112e-02f,
+             -2.75007114e-02f,   1.54579682e-02f,   9.43157077e-02f,   3.31940409e-03f,  -1.63853560e-02f,  -6.48766337e-03f,
+             -3.30807343e-02f,  -4.24487889e-02f,   2.28941254e-03f,   8.65742657e-03f,  -1.10077281e-02f,   3.86701757e-03f,
+              3.38353440e-02f,   2.32066159e-04f,  -7.23491050e-03f,  -2.20959261e-03f,   5.69222048e-02f,   3.39479633e-02f,
+             -2.07911301e-02f,  -2.67831609e-02f,   3.21514942e-02f,   2.99100094e-02f,  -1.57593153e-02f,   8.49680416e-03f,
+              8.11896287e-03f,   5.15007460e-03f,   1.87574383e-02f,   1.11867916e-02f,  -6.85125170e-03f,  -8.82579200e-03f,
+              1.05948057e-02f,   9.85617470e-03f,  -5.19312965e-03f,   2.79993168e-03f,   2.67542270e-03f,   1.69709185e-03f,
+              1.00168578e-01f,   5.97397648e-02f,  -3.65870930e-02f,  -4.71315421e-02f,   5.65784387e-02f,   5.26339971e-02f,
+             -2.77323797e-02f,   1.49522107e-02f,   1.42873069e-02f,   9.06281918e-03f,   1.43613517e-01f,   8.56499895e-02f,
+             -5.24555780e-02f,  -6.75733462e-02f,   8.11175331e-02f,   7.54623190e-02f,  -3.97604182e-02f,   2.14372557e-02f,
+              2.04839725e-02f,   1.29935285e-02f,   1.43950671e-01f,   8.58510658e-02f,  -5.25787286e-02f,  -6.77319914e-02f,
+              8.13079700e-02f,   7.56394789e-02f,  -3.98537628e-02f,   2.14875843e-02f,   2.05320623e-02f,   1.30240340e-02f,
+              4.90404628e-02f,   2.92473510e-02f,  -1.79122817e-02f,  -2.30746269e-02f,   2.76996307e-02f,   2.57685147e-02f,
+             -1.35771986e-02f,   7.32029276e-03f,   6.99476944e-03f,   4.43696883e-03f,  -9.65614058e-03f,  -5.75884711e-03f,
+              3.52695514e-03f,   4.54342831e-03f,  -5.45409881e-03f,  -5.07385889e-03f,   2.67337076e-03f,  -1.44137652e-03f,
+             -1.37728057e-03f,  -8.73645768e-04f,  -2.09374465e-02f,  -1.24869309e-02f,   7.64751015e-03f,   9.85153299e-03f,
+             -1.18261436e-02f,  -1.10016679e-02f,   5.79667976e-03f,  -3.12534231e-03f,  -2.98636267e-03f,  -1.89432944e-03f,
+             -5.92136495e-02f,  -3.53145637e-02f,   2.16280930e-02f,   2.78613381e-02f,  -3.34457755e-02f,  -3.11140586e-02f,
+              1.63937174e-02f,  -8.83884914e-03f,  -8.44579842e-03f,  -5.35739446e-03f,   3.21506225e-02f,   1.91743840e-02f,
+             -1.17431814e-02f,  -1.51275825e-02f,   1.81597080e-02f,   1.68936793e-02f,  -8.90112761e-03f,   4.79913875e-03f,
+              4.58572758e-03f,   2.90884916e-03f,   1.84579957e-02f,   5.77908941e-02f,   4.27763648e-02f,   1.20333750e-02f,
+             -2.31962204e-02f,  -3.72990146e-02f,  -1.08419443e-02f,  -1.67559609e-02f,  -1.03253983e-02f,   7.10030273e-03f,
+              8.62008613e-03f,   2.69889813e-02f,   1.99770313e-02f,   5.61971776e-03f,  -1.08328890e-02f,  -1.74190477e-02f,
+             -5.06330654e-03f,  -7.82521721e-03f,  -4.82207444e-03f,   3.31591931e-03f,   1.49337808e-02f,   4.67567854e-02f,
+              3.46090049e-02f,   9.73582268e-03f,  -1.87673289e-02f,  -3.01774535e-02f,  -8.77187401e-03f,  -1.35567188e-02f,
+             -8.35395325e-03f,   5.74463047e-03f,  -1.79783907e-04f,  -5.62892761e-04f,  -4.16648807e-04f,  -1.17207041e-04f,
+              2.25935000e-04f,   3.63298517e-04f,   1.05602310e-04f,   1.63205812e-04f,   1.00571073e-04f,  -6.91581154e-05f,
+             -1.75027270e-02f,  -5.48000038e-02f,  -4.05625328e-02f,  -1.14106033e-02f,   2.19957326e-02f,   3.53686549e-02f,
+              1.02808336e-02f,   1.58887785e-02f,   9.79102124e-03f,  -6.73283637e-03f,  -8.26052018e-03f,  -2.58631986e-02f,
+             -1.91437379e-02f,  -5.38530480e-03f,   1.03810215e-02f,   1.66924540e-02f,   4.85210260e-03f,   7.49880727e-03f,
+              4.62093297e-03f,  -3.17760347e-03f,   5.58510888e-04f,   1.74866454e-03f,   1.29434781e-03f,   3.64111620e-04f,
+             -7.01882411e-04f,  -1.12861150e-03f,  -3.28060734e-04f,  -5.07009914e-04f,  -3.12430871e-04f,   2.14844375e-04f,
+             -8.93956516e-03f,  -2.79892515e-02f,  -2.07174234e-02f,  -5.82799688e-03f,   1.12343803e-02f,   1.80646367e-02f,
+              5.25096385e-03f,   8.11523758e-03f,   5.00079105e-03f,  -3.43881454e-03f,  -1.08087540e-03f,  -3.38415685e-03f,
+             -2.50492641e-03f,  -7.04658160e-04f,   1.35833945e-03f,   2.18418008e-03f,   6.34889584e-04f,   9.81206540e-04f,
+              6.04641391e-04f,  -4.15784161e-04f,   1.93574314e-03f,   6.06069760e-03f,   4.48608072e-03f,   1.26197468e-03f,
+             -2.43265461e-03f,  -3.91165493e-03f,  -1.13702589e-03f,  -1.75724598e-03f,  -1.08285423e-03f,   7.44629186e-04f,
+              3.58184730e-03f,   7.93141406e-03f,   3.96521762e-02f,   4.31307442e-02f,   4.02267054e-02f,  -3.38150337e-02f,
+             -1.05599221e-02f,   2.49763504e-02f,  -1.07922656e-02f,   7.31210224e-03f,   4.03285585e-03f,   8.93009827e-03f,
+              4.46449853e-02f,   4.85615544e-02f,   4.52918522e-02f,  -3.80728580e-02f,  -1.18895750e-02f,   2.81212498e-02f,
+             -1.21511742e-02f,   8.23280681e-03f,   7.25489459e-04f,   1.60647754e-03f,   8.03139620e-03f,   8.73596687e-03f,
+              8.14776495e-03f,  -6.84910547e-03f,  -2.13887170e-03f,   5.05886413e-03f,  -2.18593189e-03f,   1.48103829e-03f,
+              1.63185818e-03f,   3.61348246e-03f,   1.80651825e-02f,   1.96499862e-02f,   1.83269326e-02f,  -1.54058319e-02f,
+             -4.81100753e-03f,   1.13790054e-02f,  -4.91686119e-03f,   3.33132944e-03f,   5.65140462e-03f,   1.25141088e-02f,
+              6.25628233e-02f,   6.80512711e-02f,   6.34693056e-02f,  -5.33530377e-02f,  -1.66613441e-02f,   3.94074470e-02f,
+             -1.70279332e-02f,   1.15369651e-02f,   1.48901972e-03f,   3.29719018e-03f,   1.64839178e-02f,   1.79300010e-02f,
+              1.67227555e-02f,  -1.40573420e-02f,  -4.38989466e-03f,   1.03829885e-02f,  -4.48648259e-03f,   3.03973444e-03f,
+             -6.16668770e-03f,  -1.36551186e-02f,  -6.82671741e-02f,  -7.42560476e-02f,  -6.92563057e-02f,   5.82176559e-02f,
+              1.81804895e-02f,  -4.30005342e-02f,   1.85805038e-02f,  -1.25888810e-02f,  -3.21902684e-03f,  -7.12800724e-03f,
+             -3.56356390e-02f,  -3.87618467e-02f,  -3.61519717e-02f,   3.03897653e-02f,   9.49026179e-03f,  -2.24463902e-02f,
+              9.69907083e-03f,  -6.57142838e-03f,  -3.36437277e-03f,  -7.44985184e-03f,  -3.72446626e-02f,  -4.05120254e-02f,
+             -3.77843082e-02f,   3.17619294e-02f,   9.91876796e-03f,  -2.34598927e-02f,   1.01370048e-02f,  -6.86814263e-03f,
+             -5.64515870e-03f,  -1.25002796e-02f,  -6.24936856e-02f,  -6.79760650e-02f,  -6.33991659e-02f,   5.32940738e-02f,
+              1.66429300e-02f,  -3.93638946e-02f,   1.70091148e-02f,  -1.15242153e-02f,  -8.92704166e-03f,  -1.08655961e-02f,
+             -4.03617416e-03f,   1.91632956e-02f,   4.86593172e-02f,   2.95042582e-02f,   9.87240858e-03f,   8.04003980e-03f,
+              5.72871789e-03f,   6.18509529e-03f,  -9.88662592e-04f,   6.68879226e-03f,  -4.29656077e-03f,  -2.74860840e-02f,
+             -2.89521255e-02f,  -1.80895778e-03f,  -1.76689327e-02f,  -1.56186745e-02f,   1.70089910e-03f,   2.31880322e-03f,
+              1.90360856e-03f,  -6.66692900e-03f,   5.24276635e-03f,   2.96179149e-02f,   2.87155677e-02f,  -5.12711646e-04f,
+              1.92525946e-02f,   1.70784406e-02f,  -2.43557221e-03f,  -3.17873736e-03f,   5.92278093e-02f,   1.46469492e-02f,
+              5.47973663e-02f,   8.83610770e-02f,  -7.28880912e-02f,  -1.58801273e-01f,   7.10601658e-02f,   6.68175742e-02f,
+             -4.57701236e-02f,  -5.29275239e-02f,   4.96119671e-02f,   1.19112502e-03f,   5.13042696e-02f,   1.15575276e-01f,
+             -1.28514469e-02f,  -1.25893638e-01f,   8.58590528e-02f,   7.91425630e-02f,  -3.98361087e-02f,  -4.66278568e-02f,
+              3.40439752e-02f,   8.79407860e-03f,   3.13144289e-02f,   4.93826270e-02f,  -4.35278378e-02f,  -9.15197656e-02f,
+              3.99535485e-02f,   3.76219973e-02f,  -2.62578558e-02f,  -3.03449463e-02f,  -1.00636575e-02f,   5.46584977e-03f,
+             -1.31908702e-02f,  -4.48564328e-02f,  -2.22280156e-02f,   2.18659360e-02f,  -3.09848543e-02f,  -2.79929619e-02f,
+              8.85188766e-03f,   1.06398817e-02f,  -6.10569008e-02f,  -4.78287861e-02f,  -4.05251458e-02f,   3.16990502e-02f,
+              2.17554942e-01f,   1.84758276e-01f,   4.55439184e-03f,  -4.16208670e-04f,   4.27609459e-02f,   4.77864854e-02f,
+             -5.07821329e-02f,  -4.09608446e-02f,  -3.31295505e-02f,   3.07945125e-02f,   1.86082304e-01f,   1.54426336e-01f,
+              6.59507466e-03f,   2.12382665e-03f,   3.54054980e-02f,   3.95004451e-02f,   2.00675130e-02f,   1.82370562e-02f,
+              1.20915370e-02f,  -1.98621526e-02f,  -8.24567303e-02f,  -6.23434968e-02f,  -7.48115638e-03f,  -5.12881391e-03f,
+             -1.37140527e-02f,  -1.51848309e-02f,   2.37872917e-02f,   3.91234905e-02f,   2.72540543e-02f,  -4.02381681e-02f,
+             -5.57826012e-02f,  -1.77241154e-02f,   5.36853680e-03f,   6.79511903e-03f,   1.10741332e-03f,  -1.82997417e-02f,
+              1.43090589e-02f,   2.98041161e-02f,  -1.13656549e-02f,  -6.98116794e-02f,  -2.90799234e-02f,   2.50607580e-02f,
+             -1.90666448e-02f,  -8.38169269e-03f,  -5.43452334e-03f,  -1.73804220e-02f,   5.55676967e-03f,   5.05980430e-03f,
+              2.44294778e-02f,   2.02755034e-02f,  -1.59431640e-02f,  -2.73842383e-02f,   1.57616232e-02f,   9.70080402e-03f,
+              4.22826456e-03f,  -1.28519678e-04f,  -1.29204569e-02f,  -6.00720197e-02f,   1.57085195e-01f,   3.04249644e-01f,
+              2.58623785e-03f,  -2.11564437e-01f,   1.35139540e-01f,   7.35177919e-02f,   3.71734649e-02f,   4.93969880e-02f,
+              1.26351789e-02f,  -2.42254604e-02f,   2.13752091e-01f,   3.06013554e-01f,  -6.17587045e-02f,  -2.65848279e-01f,
+              1.62903354e-01f,   9.31196064e-02f,   4.43818346e-02f,   3.60235013e-02f,  -9.53304931e-04f,  -2.10202509e-03f,
+              1.27259362e-03f,   5.49774710e-03f,   1.85428269e-03f,  -2.33282358e-03f,   1.68420852e-03f,   7.89909158e-04f,
+              4.75324690e-04f,   1.27623393e-03f,  -3.35776471e-02f,  -2.67187096e-02f,  -1.64691776e-01f,  -1.50566667e-01f,
+              9.90916416e-02f,   1.87443390e-01f,  -1.08954445e-01f,  -6.62873760e-02f,  -2.93019507e-02f,  -3.14248865e-03f,
+             -6.60273954e-02f,  -1.00858219e-01f,  -1.09913848e-01f,   5.53995445e-02f,   1.60362333e-01f,   9.32890400e-02f,
+             -4.24211249e-02f,  -3.42519730e-02f,  -1.06038097e-02f,   4.29301262e-02f,  -5.07409200e-02f,  -7.71314800e-02f,
+             -8.61331746e-02f,   3.98361087e-02f,   1.23504348e-01f,   7.38352314e-02f,  -3.39381993e-02f,  -2.70705055e-02f,
+             -8.51503108e-03f,   3.26085724e-02f,   4.76914831e-02f,   7.31252730e-02f,   7.81706050e-02f,  -4.20193188e-02f,
+             -1.15632765e-01f,  -6.58126026e-02f,   2.96608526e-02f,   2.41921525e-02f,   7.39100389e-03f,  -3.12884152e-02f,
+             -9.66528580e-02f,  -3.48386094e-02f,   3.57219425e-04f,  -2.15854011e-02f,  -3.14671844e-02f,   9.04153101e-03f,
+              5.47584258e-02f,   2.55677123e-02f,   2.30071899e-02f,   1.37619376e-02f,   4.31783050e-02f,  -6.98015019e-02f,
+             -2.47322395e-02f,  -1.68442726e-02f,   2.93804780e-02f,   1.29764117e-02f,   1.95302460e-02f,  -2.73080636e-02f,
+              7.30903237e-04f,  -4.41143801e-03f,   1.25268370e-01f,  -6.26478717e-02f,  -2.22843364e-02f,   3.88023583e-03f,
+              4.73469608e-02f,   1.01974709e-02f,   4.38800361e-03f,  -4.90149744e-02f,  -7.83496536e-03f,  -1.31376684e-02f,
+              1.94728047e-01f,  -1.04898691e-01f,  -3.14017311e-02f,   9.18629486e-03f,   6.74489886e-02f,   1.76006295e-02f,
+              2.23085601e-02f,  -7.51374513e-02f,  -6.47035241e-03f,  -1.87997557e-02f,   7.84325376e-02f,  -2.98515074e-02f,
+              3.89428586e-02f,   5.63162230e-02f,  -4.17328663e-02f,   6.85053039e-03f,   1.05857022e-01f,  -6.14121091e-03f,
+              3.79338674e-02f,   5.24162687e-03f,   9.07956064e-02f,  -1.35616899e-01f,  -4.90529053e-02f,  -3.22197229e-02f,
+              6.01372644e-02f,   2.50499304e-02f,   3.47593166e-02f,  -5.54639399e-02f,  -1.29712527e-04f,  -9.57389176e-03f,
+              9.77115780e-02f,  -1.78972706e-01f,  -1.06869839e-01f,  -9.01887491e-02f,   1.32533550e-01f,   3.14683169e-02f,
+             -4.14214544e-02f,  -8.60835686e-02f,  -3.49942483e-02f,  -2.17592996e-02f,  -6.85228929e-02f,  -6.15761504e-02f,
+             -2.63961051e-02f,  -4.30290997e-02f,   6.57267077e-03f,   1.30150979e-02f,   2.33473852e-02f,   3.97984218e-03f,
+              6.99691288e-03f,   6.14412082e-03f,   2.98657089e-01f,  -8.16456303e-02f,  -2.65460834e-02f,   3.74629460e-02f,
+              9.08819363e-02f,   1.11443410e-02f,  -9.18824505e-03f,  -1.01035781e-01f,  -2.11904049e-02f,  -3.07702161e-02f,
+              2.44329050e-01f,   2.27448538e-01f,   1.11809514e-01f,   1.71533912e-01f,  -4.62602973e-02f,  -4.72629219e-02f,
+             -5.41583002e-02f,  -5.71802724e-03f,  -1.24356365e-02f,  -1.78729575e-02f,   7.47483131e-03f,  -4.11140174e-02f,
+              1.08593062e-03f,   1.75726544e-02f,  -1.12190526e-02f,   3.60764191e-02f,   4.72172312e-02f,   3.20582353e-02f,
+              2.91370023e-02f,  -3.59757952e-02f,   5.32128196e-03f,  -2.92687919e-02f,   7.73066713e-04f,   1.25098545e-02f,
+             -7.98676815e-03f,   2.56825592e-02f,   3.36136296e-02f,   2.28220411e-02f,   2.07424369e-02f,  -2.56109275e-02f,
+              5.49942907e-03f,  -3.02486606e-02f,   7.98947643e-04f,   1.29286638e-02f,  -8.25415179e-03f,   2.65423674e-02f,
+              3.47389542e-02f,   2.35860832e-02f,   2.14368571e-02f,  -2.64683366e-02f,   1.68172289e-02f,  -9.25002620e-02f,
+              2.44317832e-03f,   3.95357944e-02f,  -2.52411570e-02f,   8.11664388e-02f,   1.06231563e-01f,   7.21261352e-02f,
+              6.55538142e-02f,  -8.09400529e-02f,   3.19325738e-02f,  -1.75639600e-01f,   4.63910960e-03f,   7.50706047e-02f,
+             -4.79279347e-02f,   1.54118925e-01f,   2.01712608e-01f,   1.36953175e-01f,   1.24473646e-01f,  -1.53689057e-01f,
+              9.49576497e-03f,  -5.22298105e-02f,   1.37952843e-03f,   2.23236885e-02f,  -1.42522929e-02f,   4.58302237e-02f,
+              5.99831231e-02f,   4.07256596e-02f,   3.70146334e-02f,  -4.57023941e-02f,  -9.06738732e-03f,   4.98735942e-02f,
+             -1.31729443e-03f,  -2.13166103e-02f,   1.36093367e-02f,  -4.37627099e-02f,  -5.72771356e-02f,  -3.88884246e-02f,
+             -3.53448093e-02f,   4.36406471e-02f,  -1.32170636e-02f,   7.26981759e-02f,  -1.92015234e-03f,  -3.10721286e-02f,
+              1.98376309e-02f,  -6.37906492e-02f,  -8.34899321e-02f,  -5.66856600e-02f,  -5.15203103e-02f,   6.36127293e-02f,
+             -1.05952984e-02f,   5.82776070e-02f,  -1.53926678e-03f,  -2.49085929e-02f,   1.59025956e-02f,  -5.11370003e-02f,
+             -6.69286922e-02f,  -4.54413705e-02f,  -4.13006321e-02f,   5.09943701e-02f,  -3.33815743e-03f,   1.83609575e-02f,
+             -4.84961784e-04f,  -7.84770772e-03f,   5.01027564e-03f,  -1.61112361e-02f,  -2.10865699e-02f,  -1.43167693e-02f,
+             -1.30121876e-02f,   1.60662998e-02f,   6.12557982e-04f,  -9.09166760e-04f,  -1.52085407e-03f,  -1.17623562e-03f,
+              6.81321981e-05f,   9.14706034e-04f,   1.18267385e-03f,   2.06282828e-03f,   2.32829689e-03f,  -8.04505398e-05f,
+              9.92215239e-03f,  -1.47265913e-02f,  -2.46346388e-02f,  -1.90525446e-02f,   1.10359839e-03f,   1.48163149e-02f,
+              1.91568304e-02f,   3.34134810e-02f,   3.77135165e-02f,  -1.30312971e-03f,   7.12568127e-03f,  -1.05760312e-02f,
+             -1.76915824e-02f,  -1.36827528e-02f,   7.92558945e-04f,   1.06404675e-02f,   1.37576470e-02f,   2.39961855e-02f,
+              2.70842947e-02f,  -9.35854099e-04f,  -5.59331058e-03f,   8.30166694e-03f,   1.38870263e-02f,   1.07402913e-02f,
+             -6.22119987e-04f,  -8.35224614e-03f,  -1.07990792e-02f,  -1.88358314e-02f,  -2.12598443e-02f,   7.34599656e-04f,
+              2.85747461e-03f,  -4.24110238e-03f,  -7.09451502e-03f,  -5.48693119e-03f,   3.17824655e-04f,   4.26694192e-03f,
+              5.51696401e-03f,   9.62272845e-03f,   1.08610932e-02f,  -3.75287549e-04f,   1.36932535e-02f,  -2.03237105e-02f,
+             -3.39974985e-02f,  -2.62938235e-02f,   1.52304186e-03f,   2.04475354e-02f,   2.64377464e-02f,   4.61129062e-02f,
+              5.20472527e-02f,  -1.79840880e-03f,   2.50400719e-03f,  -3.71648115e-03f,  -6.21692883e-03f,  -4.80820192e-03f,
+              2.78509979e-04f,   3.73912440e-03f,   4.83451970e-03f,   8.43240414e-03f,   9.51758400e-03f,  -3.28864757e-04f,
+             -6.88716210e-03f,   1.02220187e-02f,   1.70993898e-02f,   1.32247480e-02f,  -7.66029523e-04f,  -1.02842981e-02f,
+             -1.32971350e-02f,  -2.31929589e-02f,  -2.61776987e-02f,   9.04528133e-04f,  -3.61626199e-03f,   5.36730466e-03f,
+              8.97842553e-03f,   6.94395648e-03f,  -4.02221311e-04f,  -5.40000573e-03f,  -6.98196469e-03f,  -1.21779935e-02f,
+             -1.37451990e-02f,   4.74943168e-04f,  -3.50328023e-03f,   5.19961538e-03f,   8.69791582e-03f,   6.72700815e-03f,
+             -3.89654830e-04f,  -5.23129478e-03f,  -6.76382938e-03f,  -1.17975194e-02f,  -1.33157615e-02f,   4.60104668e-04f,
+             -3.11900247e-02f,  -2.67276596e-02f,  -3.61194126e-02f,  -1.89245604e-02f,  -9.30492859e-03f,   2.55237776e-03f,
+              8.33847094e-03f,  -3.96241695e-02f,  -8.01355951e-03f,   5.43243368e-04f,  -3.72050926e-02f,  -3.18821520e-02f,
+             -4.30851243e-02f,  -2.25742068e-02f,  -1.10994056e-02f,   3.04460945e-03f,   9.94656421e-03f,  -4.72657792e-02f,
+             -9.55899246e-03f,   6.48009125e-04f,  -5.54559045e-02f,  -4.75218147e-02f,  -6.42203614e-02f,  -3.36478949e-02f,
+             -1.65441763e-02f,   4.53813095e-03f,   1.48258125e-02f,  -7.04518259e-02f,  -1.42481187e-02f,   9.65887448e-04f,
+             -8.53703171e-02f,  -7.31563643e-02f,  -9.88625586e-02f,  -5.17984778e-02f,  -2.54685506e-02f,   6.98612072e-03f,
+              2.28232555e-02f,  -1.08455434e-01f,  -2.19339393e-02f,   1.48691318e-03f,  -7.96988904e-02f,  -6.82963505e-02f,
+             -9.22947973e-02f,  -4.83573377e-02f,  -2.37765927e-02f,   6.52201055e-03f,   2.13070326e-02f,  -1.01250388e-01f,
+             -2.04767957e-02f,   1.38813269e-03f,   4.34880704e-02f,   3.72662209e-02f,   5.03610857e-02f,   2.63864044e-02f,
+              1.29738078e-02f,  -3.55876517e-03f,  -1.16262818e-02f,   5.52477427e-02f,   1.11732585e-02f,  -7.57441041e-04f,
+              1.11501418e-01f,   9.55488756e-02f,   1.29123509e-01f,   6.76535293e-02f,   3.32642496e-02f,  -9.12451092e-03f,
+             -2.98092533e-02f,   1.41652688e-01f,   2.86477227e-02f,  -1.94204412e-03f,   1.06456853e-01f,   9.12260413e-02f,
+              1.23281687e-01f,   6.45927414e-02f,   3.17593031e-02f,  -8.71169847e-03f,  -2.84606181e-02f,   1.35244012e-01f,
+              2.73516383e-02f,  -1.85418199e-03f,   4.13462818e-02f,   3.54308598e-02f,   4.78808023e-02f,   2.50868760e-02f,
+              1.23348478e-02f,  -3.38349608e-03f,  -1.10536879e-02f,   5.25267944e-02f,   1.06229763e-02f,  -7.20137148e-04f,
+             -7.59667084e-02f,  -6.50981292e-02f,  -8.79727677e-02f,  -4.60928343e-02f,  -2.26631686e-02f,   6.21659448e-03f,
+              2.03092564e-02f,  -9.65089872e-02f,  -1.95178986e-02f,   1.32312858e-03f,   3.92539334e-03f,  -1.12582361e-02f,
+              3.57204862e-03f,   3.12564187e-02f,   2.27212086e-02f,   9.69717465e-03f,  -1.25715127e-02f,  -7.45310076e-03f,
+             -2.09109411e-02f,  -3.41380797e-02f,   6.96653326e-04f,  -1.16873868e-02f,   4.86240402e-04f,   1.37953470e-02f,
+              2.06674542e-02f,   3.42438258e-02f,   3.72200483e-03f,   2.54400889e-04f,  -3.07948254e-02f,  -2.97503658e-02f,
+             -5.17735956e-03f,  -1.30224647e-02f,  -5.13618812e-03f,  -1.74995176e-02f,   1.78827755e-02f,   8.07619244e-02f,
+              3.37052085e-02f,   1.43668046e-02f,  -5.03259301e-02f,  -2.31232475e-02f,  -3.37824924e-03f,   1.90420896e-02f,
+             -2.93157808e-03f,  -3.48616354e-02f,  -3.56119387e-02f,  -3.97396944e-02f,   5.07270219e-03f,   4.89184773e-03f,
+              4.41400334e-02f,   5.22492826e-02f,   1.01260897e-02f,   1.55439340e-02f,   9.89425555e-03f,   4.26758230e-02f,
+             -1.79346427e-02f,  -1.24640502e-01f,  -5.98235428e-02f,  -2.64835432e-02f,   7.06845075e-02f,   2.09551509e-02f,
+              9.99835040e-03f,  -1.54481726e-02f,   9.29998886e-03f,   6.83529153e-02f,   3.51633839e-02f,  -1.96996294e-02f,
+             -4.01478633e-02f,  -2.11368073e-02f,  -1.62882693e-02f,  -5.46096154e-02f,   4.48683510e-03f,  -2.28107087e-02f,
+              3.93139338e-03f,   4.41903919e-02f,   4.30401750e-02f,   4.44557816e-02f,  -8.26110784e-03f,  -6.90081390e-03f,
+             -5.16923293e-02f,  -6.33308738e-02f,   5.24498010e-03f,  -2.24232413e-02f,   4.66034701e-03f,   4.80463952e-02f,
+              4.30302061e-02f,   3.77296321e-02f,  -1.22631583e-02f,  -8.75728857e-03f,  -4.85701039e-02f,  -6.36601448e-02f,
+             -3.02355946e-03f,  -1.03904791e-02f,  -3.04197590e-03f,  -7.84854870e-03f,   1.52255688e-02f,   5.65140396e-02f,
+              2.13950668e-02f,   8.84354115e-03f,  -3.71759348e-02f,  -2.03145873e-02f,  -9.96678509e-03f,  -3.32994275e-02f,
+             -1.00129889e-02f,  -2.66817212e-02f,   4.85556349e-02f,   1.83097750e-01f,   6.99415728e-02f,   2.89967544e-02f,
+             -1.19886227e-01f,  -6.46379888e-02f,   2.06421688e-02f,   3.33382376e-02f,  -3.42738181e-02f,  -8.27132240e-02f,
+             -1.67138018e-02f,  -2.92489752e-02f,  -9.29221287e-02f,  -1.12790093e-02f,   3.54305282e-02f,   1.88995004e-02f,
+              3.14190867e-03f,   4.97465534e-03f,  -5.07013407e-03f,  -1.23368762e-02f,  -2.80516804e-03f,  -4.98935487e-03f,
+             -1.39343049e-02f,  -1.39985257e-03f,   5.55142527e-03f,   2.70974590e-03f,  -4.92165275e-02f,  -8.67281631e-02f,
+              9.23667476e-02f,   2.15567604e-01f,   2.08812151e-02f,   3.07070911e-02f,   2.36745730e-01f,   4.99077030e-02f,
+             -7.29571506e-02f,  -5.71837984e-02f,  -6.81567490e-02f,  -1.26863882e-01f,   1.37853876e-01f,   3.15662771e-01f,
+              1.12082623e-02f,   6.08692458e-03f,   3.42038393e-01f,   9.06003118e-02f,  -9.02800262e-02f,  -9.05069932e-02f,
+             -9.24249459e-03f,  -2.36299112e-02f,   2.81448215e-02f,   5.90980425e-02f,  -1.53155280e-02f,  -3.38149443e-02f,
+              5.98677918e-02f,   3.27127576e-02f,  -2.01931712e-03f,  -2.30321214e-02f,  -3.01977415e-02f,  -5.04870489e-02f,
+              5.26633859e-02f,   1.25352934e-01f,   1.99552812e-02f,   3.35386992e-02f,   1.39538154e-01f,   2.19548233e-02f,
+             -4.91019338e-02f,  -3.05212997e-02f,  -4.17648330e-02f,  -6.27453476e-02f,   6.24228381e-02f,   1.55418172e-01f,
+              4.61482406e-02f,   8.45520869e-02f,   1.78129673e-01f,   7.85841327e-03f,  -7.91740865e-02f,  -3.03583629e-02f,
+             -5.44947758e-03f,   5.91280125e-03f,  -1.25910323e-02f,  -1.54669965e-02f,   4.29594368e-02f,   8.70355070e-02f,
+             -6.34496054e-03f,  -4.37922515e-02f,  -3.27610597e-02f,   1.96442958e-02f,   1.41250705e-02f,   2.66710166e-02f,
+             -2.91271228e-02f,  -6.63806647e-02f,  -1.32930407e-03f,   7.82816205e-04f,  -7.16812015e-02f,  -1.99818444e-02f,
+              1.81066636e-02f,   1.93919521e-02f,  -2.36300286e-02f,  -3.13535817e-02f,   2.92193219e-02f,   7.74202794e-02f,
+              3.69741097e-02f,   7.01921582e-02f,   9.20815021e-02f,  -8.73531960e-03f,  -5.13928309e-02f,  -1.02336789e-02f,
+              1.10927261e-02f,   2.33898498e-02f,  -2.60385033e-02f,  -3.91296521e-02f,  -1.72105292e-03f,   1.15018114e-02f,
+             -3.03955842e-02f,  -4.29781824e-02f,   1.91751076e-03f,  -2.65272264e-03f,   6.94180001e-03f,   2.13479940e-02f,
+             -1.90650001e-02f,  -3.05306204e-02f,  -2.38398486e-03f,   1.16531027e-03f,  -2.71535218e-02f,  -2.70947069e-02f,
+              7.26216286e-03f,  -1.38696958e-03f,  -1.01313256e-02f,  -1.07204229e-01f,   5.92171624e-02f,   1.13043897e-01f,
+              1.82901490e-02f,   6.66613281e-02f,   1.31784439e-01f,   4.17997278e-02f,  -7.92974606e-02f,  -1.07058801e-03f,
+             -1.28077473e-02f,  -7.56805092e-02f,   5.01570590e-02f,   8.90136883e-02f,   1.14668310e-02f,   3.04752197e-02f,
+              9.40788686e-02f,   5.10668419e-02f,  -4.61846627e-02f,   1.08200451e-03f,  -4.20972053e-03f,   2.49695815e-02f,
+             -4.08998597e-03f,  -1.56306736e-02f,  -5.93862496e-03f,  -3.47905234e-02f,  -2.94796545e-02f,   1.53063135e-02f,
+              2.98476275e-02f,   2.38411315e-03f,   9.26146097e-03f,  -8.19770917e-02f,   2.01616287e-02f,   5.87421544e-02f,
+              1.83320101e-02f,   1.00850284e-01f,   9.76272970e-02f,  -3.28719355e-02f,  -9.00954902e-02f,  -6.34565484e-03f,
+              2.53107324e-02f,  -1.10302046e-01f,   8.15053098e-03f,   5.81126027e-02f,   2.79492252e-02f,   1.73374876e-01f,
+              1.28983229e-01f,  -9.32098702e-02f,  -1.43479720e-01f,  -1.27135925e-02f,   2.64807697e-02f,  -6.16430975e-02f,
+             -1.36639467e-02f,   1.23867104e-02f,   1.87715013e-02f,   1.33064449e-01f,   6.98016733e-02f,  -9.91133675e-02f,
+             -1.01549447e-01f,  -1.11135775e-02f,   1.99140562e-03f,   1.11011513e-01f,  -4.87667248e-02f,  -1.03215888e-01f,
+             -2.11114660e-02f,  -9.39529985e-02f,  -1.34892613e-01f,  -1.08841304e-02f,   9.68347490e-02f,   3.87060503e-03f,
+             -5.86273894e-03f,   2.71713678e-02f,  -2.55749212e-03f,  -1.49214054e-02f,  -6.78979931e-03f,  -4.16170359e-02f,
+             -3.18420567e-02f,   2.15421356e-02f,   3.46995816e-02f,   3.01086693e-03f,   1.76168270e-02f,   5.23418793e-03f,
+             -1.93298631e-03f,  -3.77259403e-02f,  -7.04953745e-02f,  -4.25397530e-02f,   1.85123971e-03f,   3.82445916e-03f,
+             -2.42972164e-03f,  -9.10775457e-03f,  -5.22454502e-03f,  -1.55228016e-03f,   5.73257275e-04f,   1.11882165e-02f,
+              2.09065042e-02f,   1.26158288e-02f,  -5.49014076e-04f,  -1.13420316e-03f,   7.20571901e-04f,   2.70104688e-03f,
+             -6.48468062e-02f,  -1.92668270e-02f,   7.11524207e-03f,   1.38867617e-01f,   2.59490550e-01f,   1.56587064e-01f,
+             -6.81433640e-03f,  -1.40776746e-02f,   8.94370396e-03f,   3.35252620e-02f,  -3.22028287e-02f,  -9.56787821e-03f,
+              3.53341876e-03f,   6.89614564e-02f,   1.28862619e-01f,   7.77609050e-02f,  -3.38398945e-03f,  -6.99095288e-03f,
+              4.44143033e-03f,   1.66485962e-02f,   5.88071682e-02f,   1.74723715e-02f,  -6.45254971e-03f,  -1.25933900e-01f,
+             -2.35322371e-01f,  -1.42003015e-01f,   6.17966941e-03f,   1.27665224e-02f,  -8.11071415e-03f,  -3.04028206e-02f,
+             -2.24147812e-02f,  -6.65972196e-03f,   2.45943642e-03f,   4.80006225e-02f,   8.96948352e-02f,   5.41254841e-02f,
+             -2.35542608e-03f,  -4.86605288e-03f,   3.09145800e-03f,   1.15882568e-02f,  -3.37888189e-02f,  -1.00390967e-02f,
+              3.70743987e-03f,   7.23578110e-02f,   1.35209113e-01f,   8.15906301e-02f,  -3.55065102e-03f,  -7.33525772e-03f,
+              4.66017099e-03f,   1.74685400e-02f,  -6.11684434e-02f,  -1.81739386e-02f,   6.71163807e-03f,   1.30990505e-01f,
+              2.44771242e-01f,   1.47704840e-01f,  -6.42780075e-03f,  -1.32791344e-02f,   8.43638275e-03f,   3.16235796e-02f,
+             -2.09103301e-02f,  -6.21273043e-03f,   2.29436229e-03f,   4.47788872e-02f,   8.36746395e-02f,   5.04926518e-02f,
+             -2.19733291e-03f,  -4.53945016e-03f,   2.88396329e-03f,   1.08104683e-02f,  -4.49886210e-02f,  -1.33667029e-02f,
+              4.93632536e-03f,   9.63418707e-02f,   1.80026174e-01f,   1.08635053e-01f,  -4.72756661e-03f,  -9.76663642e-03f,
+              6.20485330e-03f,   2.32587457e-02f,   1.73732769e-02f,   9.10060364e-04f,  -2.39604395e-02f,  -2.03750022e-02f,
+             -1.28594264e-02f,  -2.49687061e-02f,  -1.09678060e-02f,  -9.01365653e-03f,  -6.18661055e-03f,  -1.42428502e-02f,
+              1.04970334e-03f,  -3.53899575e-03f,  -1.80467349e-02f,  -8.13521910e-03f,   1.15411449e-02f,   5.50095318e-03f,
+             -8.09323974e-03f,   1.70370657e-03f,   3.21236672e-04f,  -6.63218321e-03f,  -1.51035814e-02f,  -9.66045447e-03f,
+             -2.01331805e-02f,   6.74979354e-04f,   4.15782854e-02f,   3.90050672e-02f,  -8.80231243e-03f,   1.33845191e-02f,
+              7.09359255e-03f,  -1.86117843e-03f,   4.54897666e-03f,  -7.60081736e-03f,  -4.24791425e-02f,  -2.03941036e-02f,
+              2.35008970e-02f,   8.75137094e-03f,  -1.90791357e-02f,   2.54385942e-03f,  -1.03893406e-04f,  -1.63182337e-02f,
+              5.40322326e-02f,   1.46354269e-03f,  -8.08315352e-02f,  -6.59935251e-02f,  -3.53091471e-02f,  -7.49888122e-02f,
+             -3.69366147e-02f,  -2.71781180e-02f,  -1.89765096e-02f,  -4.64913510e-02f,  -5.11862710e-02f,   3.55822966e-03f,
+              9.94113609e-02f,   7.20164329e-02f,   1.65017992e-02f,   6.13950975e-02f,   4.52142470e-02f,   2.26533171e-02f,
+              1.70207415e-02f,   5.19833155e-02f,  -2.76374407e-02f,   4.26163059e-03f,   6.44853339e-02f,   4.33804393e-02f,
+              8.88383831e-04f,   2.85849329e-02f,   2.92517021e-02f,   1.07672922e-02f,   8.73754639e-03f,   3.18262801e-02f,
+              1.63510814e-02f,   2.34089582e-03f,  -1.56949665e-02f,  -1.63246524e-02f,  -1.71904229e-02f,  -2.63947006e-02f,
+             -7.25353323e-03f,  -9.41191427e-03f,  -6.10966980e-03f,  -1.10210543e-02f,   1.30295279e-02f,  -1.58290297e-03f,
+             -2.84327473e-02f,  -1.96326990e-02f,  -1.87966507e-03f,  -1.43075045e-02f,  -1.29093518e-02f,  -5.34281833e-03f,
+             -4.20169719e-03f,  -1.43198622e-02f,  -1.02709323e-01f,   5.51263336e-03f,   1.91961288e-01f,   1.41380727e-01f,
+              3.86894159e-02f,   1.26367852e-01f,   8.73616636e-02f,   4.64736447e-02f,   3.44681591e-02f,   1.01695448e-01f,
+             -3.52254212e-02f,  -7.48896785e-03f,   1.64626651e-02f,   7.46567035e-03f,  -1.65036228e-03f,  -5.45836694e-04f,
+              2.29220018e-02f,   1.56900920e-02f,  -3.31330625e-03f,   6.71223411e-03f,   1.44135822e-02f,   1.58969630e-02f,
+              1.44165417e-03f,  -1.15968706e-02f,  -9.42413043e-03f,  -5.39400103e-03f,  -7.39986589e-03f,  -2.20948732e-05f,
+              4.75287298e-03f,  -3.77939246e-03f,   5.11091761e-02f,   1.24517195e-02f,  -2.28753537e-02f,  -1.18876928e-02f,
+              1.14645925e-03f,   9.77761811e-05f,  -3.30133215e-02f,  -2.19743680e-02f,   5.22714853e-03f,  -9.86653939e-03f,
+              6.89360034e-03f,   9.58763342e-03f,   1.95421558e-03f,  -6.86748466e-03f,  -6.06917450e-03f,  -3.44852242e-03f,
+             -3.23302811e-03f,   9.78888012e-04f,   2.79853097e-03f,  -1.96730881e-03f,  -2.95113102e-02f,   1.49850352e-02f,
+              2.73400452e-02f,  -7.89659098e-03f,  -1.81138813e-02f,  -9.76328086e-03f,   2.24828552e-02f,   2.37441659e-02f,
+              2.85202474e-03f,   3.91229708e-03f,  -1.12733163e-01f,   2.86838692e-02f,   8.62391144e-02f,  -1.11546470e-02f,
+             -4.67187613e-02f,  -2.47943327e-02f,   8.14793557e-02f,   7.64639676e-02f,   3.33442912e-03f,   1.72436219e-02f,
+             -6.83428869e-02f,   3.22823226e-02f,   6.17722198e-02f,  -1.66759901e-02f,  -4.00436670e-02f,  -2.15505287e-02f,
+              5.16929217e-02f,   5.37805110e-02f,   5.96405286e-03f,   9.25498269e-03f,   6.76987767e-02f,   4.29496020e-02f,
+             -1.34407254e-02f,  -3.33569348e-02f,  -1.93027332e-02f,  -1.14514008e-02f,  -3.96483876e-02f,  -1.59167312e-02f,
+              1.39274755e-02f,  -1.51985371e-02f,  -1.96882971e-02f,   4.41540927e-02f,   4.00069989e-02f,  -2.80047841e-02f,
+             -3.89664844e-02f,  -2.14653555e-02f,   2.02678964e-02f,   3.28704976e-02f,   1.09449429e-02f,  -1.39156167e-04f,
+             -7.59964883e-02f,   5.34085790e-03f,   4.92170528e-02f,   1.79662753e-03f,  -2.04795841e-02f,  -1.05880508e-02f,
+              5.27686551e-02f,   4.45685498e-02f,  -1.45720423e-03f,   1.27508817e-02f,   3.96493077e-03f,   8.80987477e-03f,
+              4.01943456e-03f,  -4.20216180e-04f,  -4.44341265e-03f,  -3.09173577e-03f,  -5.08508121e-04f,   7.17211515e-04f,
+             -6.39283680e-04f,  -1.85879646e-03f,   3.91621552e-02f,   8.70163217e-02f,   3.97004969e-02f,  -4.15053172e-03f,
+             -4.38881852e-02f,  -3.05374917e-02f,  -5.02260309e-03f,   7.08399480e-03f,  -6.31429115e-03f,  -1.83595829e-02f,
+              2.84615364e-02f,   6.32400885e-02f,   2.88527813e-02f,  -3.01644555e-03f,  -3.18962336e-02f,  -2.21934654e-02f,
+             -3.65023315e-03f,   5.14837308e-03f,  -4.58898209e-03f,  -1.33430334e-02f,  -2.46194704e-03f,  -5.47032105e-03f,
+             -2.49578990e-03f,   2.60925095e-04f,   2.75905104e-03f,   1.91975350e-03f,   3.15748242e-04f,  -4.45338606e-04f,
+              3.96950811e-04f,   1.15418364e-03f,   6.39730599e-03f,   1.42144896e-02f,   6.48524612e-03f,  -6.78007142e-04f,
+             -7.16932351e-03f,  -4.98843007e-03f,  -8.20463756e-04f,   1.15720101e-03f,  -1.03146653e-03f,  -2.99911667e-03f,
+              4.58541140e-03f,   1.01885507e-02f,   4.64844424e-03f,  -4.85976692e-04f,  -5.13877207e-03f,  -3.57556809e-03f,
+             -5.88085619e-04f,   8.29449506e-04f,  -7.39326526e-04f,  -2.14968342e-03f,   3.51157449e-02f,   7.80254006e-02f,
+              3.55984606e-02f,  -3.72168003e-03f,  -3.93534601e-02f,  -2.73822192e-02f,  -4.50364454e-03f,   6.35204418e-03f,
+             -5.66186989e-03f,  -1.64625868e-02f,   5.09796701e-02f,   1.13274239e-01f,   5.16804568e-02f,  -5.40299015e-03f,
+             -5.71318194e-02f,  -3.97524387e-02f,  -6.53821602e-03f,   9.22165066e-03f,  -8.21968168e-03f,  -2.38997433e-02f,
+              1.50891626e-02f,   3.35273519e-02f,   1.52965849e-02f,  -1.59919821e-03f,  -1.69101004e-02f,  -1.17660835e-02f,
+             -1.93520694e-03f,   2.72946036e-03f,  -2.43289373e-03f,  -7.07393978e-03f,  -3.26899327e-02f,  -7.26353675e-02f,
+             -3.31393033e-02f,   3.46458470e-03f,   3.66349034e-02f,   2.54906435e-02f,   4.19253111e-03f,  -5.91324223e-03f,
+              5.27074514e-03f,   1.53253442e-02f,  -4.48734127e-02f,   2.01478954e-02f,   8.19229707e-02f,  -3.10373679e-02f,
+             -6.27121851e-02f,  -7.19510242e-02f,  -4.62631322e-02f,   8.08161944e-02f,   4.09934409e-02f,   9.60504562e-02f,
+              1.28139546e-02f,   3.11537851e-02f,   5.26167303e-02f,  -6.84249625e-02f,  -5.94810434e-02f,  -1.63672511e-02f,
+             -3.84340025e-02f,   7.93889463e-02f,   8.15274715e-02f,   7.64441490e-02f,   2.93265246e-02f,   3.94847197e-03f,
+             -2.36726869e-02f,  -1.09284200e-01f,  -5.80992140e-02f,   2.12005526e-02f,  -3.25423665e-02f,   8.49885866e-02f,
+              1.08640775e-01f,   7.16796666e-02f,   6.88455328e-02f,  -1.29821384e-02f,  -9.22558904e-02f,  -5.07505164e-02f,
+              1.76094957e-02f,   8.68082568e-02f,   2.06928197e-02f,  -1.56218084e-02f,   4.22280021e-02f,  -4.09104340e-02f,
+              1.17616720e-01f,   7.08437804e-03f,  -9.56575051e-02f,  -1.18628271e-01f,  -1.14836674e-02f,   1.21762238e-01f,
+              6.56403648e-03f,   2.62781475e-02f,   1.17191017e-01f,  -1.45566938e-02f,   1.59546182e-01f,   5.67890750e-03f,
+             -1.38736293e-01f,  -1.68037891e-01f,  -1.76855233e-02f,   1.67675659e-01f,   8.04529712e-03f,   3.95204052e-02f,
+              1.64139032e-01f,  -1.66773535e-02f,   5.43962941e-02f,   1.80871058e-02f,  -1.28116133e-02f,  -6.97535574e-02f,
+             -2.54940391e-02f,   4.29978259e-02f,  -1.10087693e-02f,   3.77387106e-02f,   7.57512301e-02f,   2.01060958e-02f,
+             -3.52826193e-02f,   3.96029763e-02f,   1.17911369e-01f,   5.25463792e-03f,  -4.55855913e-02f,  -7.29634911e-02f,
+             -3.67256440e-02f,   5.30101582e-02f,   1.41372308e-02f,   6.92864507e-02f,  -6.00384958e-02f,  -2.67350134e-02f,
+             -3.91392969e-03f,   1.96488556e-02f,  -5.88496914e-03f,  -4.73262332e-02f,  -8.00147001e-03f,   8.44182353e-03f,
+             -3.03630959e-02f,   2.45896745e-02f,  -5.57413250e-02f,  -4.24293391e-02f,  -4.40060012e-02f,  -1.64226145e-02f,
+             -1.67771541e-02f,  -3.29711735e-02f,  -1.24250026e-02f,   2.78647244e-02f,  -2.30115629e-03f,   3.91297452e-02f,
+              5.61369658e-02f,   6.26334995e-02f,   1.75058246e-02f,  -2.16858014e-02f,  -2.07587667e-02f,  -3.53440344e-02f,
+             -4.40534949e-02f,  -2.60643642e-02f,   7.42861303e-03f,  -3.80656831e-02f,   2.50285063e-02f,   2.74678674e-02f,
+              3.88947465e-02f,   2.15448998e-02f,  -3.09538282e-03f,  -3.15001011e-02f,  -1.07699595e-02f,  -7.74873002e-03f,
+             -9.94060002e-03f,   4.20452934e-03f,  -4.67136595e-03f,  -2.16385163e-03f,  -7.62260929e-02f,  -7.67534524e-02f,
+             -1.80038195e-02f,   4.48610559e-02f,  -1.49289668e-02f,  -3.44296044e-04f,   3.45566161e-02f,  -5.40292971e-02f,
+             -4.52805823e-03f,  -2.37739040e-03f,  -9.31695104e-02f,  -9.27480087e-02f,  -1.98502690e-02f,   5.20739295e-02f,
+             -2.07649749e-02f,  -4.70069330e-03f,   4.07608636e-02f,  -6.36925176e-02f,   2.22386364e-02f,   2.70816144e-02f,
+             -4.48978283e-02f,  -6.33300394e-02f,  -2.22963747e-02f,   1.53846079e-02f,  -3.01225893e-02f,  -1.15222931e-02f,
+              2.75921691e-02f,  -5.52335046e-02f,   1.00874873e-02f,   1.36328936e-02f,  -4.65803556e-02f,  -5.67710660e-02f,
+             -1.77378841e-02f,   2.22592428e-02f,  -1.97895654e-02f,  -5.13108959e-03f,   2.53228024e-02f,  -4.60082144e-02f,
+              1.92429516e-02f,   3.00695039e-02f,   5.74880205e-02f,   2.74959393e-02f,  -2.05225833e-02f,  -1.86873116e-02f,
+              1.27450265e-02f,   3.01198196e-02f,  -3.54305585e-03f,  -8.08130205e-03f,   1.34008564e-02f,   2.39636954e-02f,
+              1.03999667e-01f,   7.62665421e-02f,  -1.16193667e-02f,  -3.71421203e-02f,   3.26999016e-02f,   4.27695923e-02f,
+             -2.30158959e-02f,   2.51882840e-02f,  -3.04430798e-02f,  -3.00596301e-02f,  -1.58476066e-02f,  -1.45045086e-03f,
+              3.77578457e-04f,   3.03305648e-02f,   2.74379738e-02f,   2.66458914e-02f,   5.14263054e-03f,   4.04754980e-03f,
+             -6.28471971e-02f,  -7.20907971e-02f,  -1.86880395e-01f,  -1.35732889e-01f,   1.27383042e-03f,   1.15038984e-01f,
+             -4.64104023e-03f,  -7.10840942e-03f,   5.54824546e-02f,  -5.70717677e-02f,   1.18442774e-01f,   1.73116073e-01f,
+              9.04074684e-02f,   2.68610790e-02f,  -5.91250211e-02f,  -2.04958364e-01f,  -1.55403197e-01f,  -1.89305514e-01f,
+             -2.44623143e-02f,   3.18137603e-03f,   7.48310611e-02f,   1.05990790e-01f,   5.50664626e-02f,   2.21277401e-02f,
+             -3.08007132e-02f,  -1.28529429e-01f,  -9.90549922e-02f,  -1.19120032e-01f,  -1.25998827e-02f,   1.87122170e-03f,
+              7.86469597e-03f,   2.71542389e-02f,   1.55038694e-02f,  -2.20922977e-02f,  -3.42684463e-02f,  -1.80603452e-02f,
+             -6.27870811e-03f,  -1.47990305e-02f,  -1.48428539e-02f,   8.53577047e-04f,  -4.87627499e-02f,  -5.09694889e-02f,
+             -2.49029044e-02f,  -4.20138538e-02f,  -1.49974469e-02f,   7.86104575e-02f,   6.92174360e-02f,   7.50469640e-02f,
+             -7.06676999e-03f,  -4.76984336e-04f,  -9.90484003e-03f,  -4.42786999e-02f,  -2.56416984e-02f,   4.31931168e-02f,
+              6.26906529e-02f,   2.56105624e-02f,   5.30659175e-03f,   2.00728774e-02f,   2.72025187e-02f,  -1.48849608e-03f,
+              3.57781276e-02f,  -4.41750661e-02f,  -3.12198158e-02f,   1.55201346e-01f,   1.69064924e-01f,  -3.44919488e-02f,
+             -7.18323737e-02f,  -4.34520058e-02f,   7.40434006e-02f,  -2.99607776e-03f,   1.48030380e-02f,  -1.80761572e-02f,
+             -1.27950599e-02f,   6.39072657e-02f,   6.95602223e-02f,  -1.43280420e-02f,  -2.96684410e-02f,  -1.80066936e-02f,
+              3.04653849e-02f,  -1.23136549e-03f,   1.08755380e-03f,  -5.49477711e-03f,  -3.46808229e-03f,   1.10482918e-02f,
+              1.31843025e-02f,   1.31694615e-04f,  -3.25474306e-03f,  -7.29808642e-04f,   5.75555861e-03f,  -2.61384121e-04f,
+             -6.98882565e-02f,  -3.62717323e-02f,  -1.33768804e-02f,  -1.16293669e-01f,  -9.27612633e-02f,   1.02212802e-01f,
+              1.08693860e-01f,   1.02324270e-01f,  -4.11751419e-02f,   8.25036841e-04f,  -1.28290743e-01f,  -1.25025406e-01f,
+             -6.00138754e-02f,  -1.24365784e-01f,  -5.70338480e-02f,   2.04239219e-01f,   1.84445709e-01f,   1.96151093e-01f,
+             -2.62493230e-02f,  -8.82816210e-04f,   3.57251689e-02f,   5.14820330e-02f,   2.93670930e-02f,   1.04393403e-03f,
+             -2.23397091e-02f,  -4.10252856e-03f,  -1.06506911e-03f,  -5.38089387e-02f,  -4.80216146e-02f,  -8.49193148e-03f,
+              1.30314957e-02f,   1.61053967e-02f,   1.13340560e-02f,   3.63482581e-03f,  -3.88623448e-03f,   1.54269058e-02f,
+             -1.08373920e-02f,  -4.87376489e-02f,  -3.47911604e-02f,  -1.41213799e-03f,   6.39616847e-02f,   1.38788484e-02f,
+              1.78603008e-02f,   3.97509597e-02f,   9.87426937e-03f,  -3.27586792e-02f,   5.16047776e-02f,   7.06327111e-02f,
+             -4.33225511e-03f,  -3.09716240e-02f,   1.08240440e-01f,  -3.15644778e-03f,   1.75714400e-02f,   7.92510360e-02f,
+              3.24934535e-02f,  -7.23387226e-02f,   1.11234568e-01f,   1.92500100e-01f,   2.97599211e-02f,  -5.88098839e-02f,
+              3.34173366e-02f,  -3.84632163e-02f,  -7.56924972e-03f,   4.65427935e-02f,   3.90510447e-02f,   1.22598826e-03f,
+              3.53113487e-02f,   6.94724917e-02f,   7.99232721e-03f,  -2.12404467e-02f,   6.03022194e-03f,  -3.24039795e-02f,
+             -9.10325069e-03f,   2.45735385e-02f,   2.82989219e-02f,   2.69383211e-02f,  -3.63001862e-04f,  -1.60910282e-03f,
+             -1.14527177e-02f,  -4.58815182e-03f,  -1.10675432e-02f,  -5.54319983e-03f,  -1.21336395e-03f,  -1.81127829e-03f,
+              4.92359465e-03f,   3.68385948e-02f,  -2.89938394e-02f,  -6.85073435e-02f,  -3.22735235e-02f,   8.75024125e-03f,
+             -6.95163384e-02f,  -1.67745445e-02f,  -1.53380772e-02f,  -3.71542461e-02f,  -2.82528088e-03f,   8.25283006e-02f,
+             -8.76885578e-02f,  -1.66052029e-01f,  -4.70625572e-02f,   3.92551459e-02f,  -5.29937148e-02f,   2.81710923e-03f,
+             -7.36321742e-03f,  -3.86831723e-02f,  -1.57617405e-02f,   4.24804986e-02f,  -5.99182732e-02f,  -1.09973036e-01f,
+             -2.33966839e-02f,   2.98804156e-02f,  -2.42396053e-02f,  -1.37500707e-02f,  -7.35293562e-03f,  -7.50679523e-03f,
+              6.17009168e-03f,   4.09658477e-02f,  -3.53563055e-02f,  -6.99190423e-02f,  -2.48082075e-02f,   1.39408903e-02f,
+              3.76149341e-02f,   9.09962431e-02f,   3.33831869e-02f,   2.22123992e-02f,   9.24311578e-03f,   1.85400676e-02f,
+             -6.92175403e-02f,  -9.64747593e-02f,   1.69769898e-02f,  -9.32404213e-03f,  -4.67226282e-02f,  -5.79814799e-02f,
+             -6.15401901e-02f,   1.59693174e-02f,   1.37635879e-02f,  -9.32340696e-02f,  -9.10768509e-02f,  -6.22035041e-02f,
+             -5.62052950e-02f,   4.35478576e-02f,  -7.65907317e-02f,  -1.26532704e-01f,  -5.29634655e-02f,   4.06349264e-02f,
+              5.05561605e-02f,  -1.41376540e-01f,  -2.54660007e-03f,   1.09922975e-01f,  -6.70837983e-02f,   1.64024774e-02f,
+             -5.88893220e-02f,  -1.16348021e-01f,  -3.51960100e-02f,   1.46235004e-02f,   2.84734666e-02f,  -8.32738504e-02f,
+              5.75664416e-02f,   1.43334359e-01f,  -3.96147929e-02f,   2.97777238e-03f,  -7.62870312e-02f,  -1.26382798e-01f,
+             -5.57276830e-02f,   3.68428230e-02f,   4.65811081e-02f,  -1.37923732e-01f,  -5.27781900e-03f,   1.01473741e-01f,
+             -6.70161471e-02f,   1.92582048e-02f,  -3.81058604e-02f,  -7.95712173e-02f,  -4.28761318e-02f,  -1.73388980e-02f,
+             -8.77131801e-03f,  -3.13565359e-02f,   2.39891391e-02f,   4.28393148e-02f,  -2.58522928e-02f,   2.12601554e-02f,
+             -1.76692544e-03f,  -2.51827389e-02f,  -6.93446994e-02f,  -9.90668014e-02f,  -9.78360027e-02f,   8.51802900e-02f,
+             -2.36229841e-02f,  -1.49351269e-01f,   2.26577418e-03f,   6.42455295e-02f,  -3.80888991e-02f,  -5.93731999e-02f,
+             -6.72198683e-02f,  -1.97574757e-02f,  -1.93312801e-02f,  -4.36596535e-02f,  -6.21059723e-02f,  -7.41693377e-02f,
+             -4.10215743e-02f,   5.00929579e-02f,  -4.34888452e-02f,  -7.93510526e-02f,  -7.17657879e-02f,  -3.08761764e-02f,
+             -2.64786799e-02f,  -3.57110091e-02f,  -3.27692330e-02f,  -4.41827588e-02f,  -3.93576436e-02f,   4.97077219e-02f,
+             -5.06451949e-02f,  -8.11435580e-02f,  -6.96826801e-02f,  -7.59127224e-03f,  -4.70590033e-03f,  -7.01317787e-02f,
+             -5.19244820e-02f,  -3.54631692e-02f,  -5.05677946e-02f,   4.62976992e-02f,  -7.16033205e-03f,   2.20304145e-03f,
+             -9.32871178e-03f,  -5.81379468e-03f,   8.89318716e-03f,   2.89058127e-02f,  -1.57066202e-03f,  -1.38861611e-02f,
+              2.76022707e-03f,   3.05563002e-03f,  -1.56181573e-03f,   4.80528688e-04f,  -2.03478406e-03f,  -1.26810826e-03f,
+              1.93978695e-03f,   6.30495232e-03f,  -3.42593703e-04f,  -3.02885752e-03f,   6.02062326e-04f,   6.66495820e-04f,
+             -9.92543902e-03f,   3.05379042e-03f,  -1.29311820e-02f,  -8.05890840e-03f,   1.23274699e-02f,   4.00683768e-02f,
+             -2.17720470e-03f,  -1.92485824e-02f,   3.82614438e-03f,   4.23562340e-03f,   2.09634807e-02f,  -6.44989917e-03f,
+              2.73119006e-02f,   1.70211904e-02f,  -2.60368027e-02f,  -8.46282616e-02f,   4.59846575e-03f,   4.06548567e-02f,
+             -8.08118470e-03f,  -8.94604344e-03f,   4.18139361e-02f,  -1.28650237e-02f,   5.44765480e-02f,   3.39506119e-02f,
+             -5.19332290e-02f,  -1.68800250e-01f,   9.17213969e-03f,   8.10905248e-02f,  -1.61188003e-02f,  -1.78438555e-02f,
+             -1.88310388e-02f,   5.79380384e-03f,  -2.45336853e-02f,  -1.52897649e-02f,   2.33882926e-02f,   7.60197267e-02f,
+             -4.13070200e-03f,  -3.65193747e-02f,   7.25915283e-03f,   8.03603604e-03f,  -2.39258260e-02f,   7.36133335e-03f,
+             -3.11713405e-02f,  -1.94264520e-02f,   2.97160577e-02f,   9.65870619e-02f,  -5.24827419e-03f,  -4.63997871e-02f,
+              9.22313612e-03f,   1.02102077e-02f,  -2.42503826e-02f,   7.46119022e-03f,  -3.15941796e-02f,  -1.96899716e-02f,
+              3.01191583e-02f,   9.78972763e-02f,  -5.31946728e-03f,  -4.70292009e-02f,   9.34824813e-03f,   1.03487093e-02f,
+             -3.46416160e-02f,   1.06582930e-02f,  -4.51322161e-02f,  -2.81270798e-02f,   4.30251472e-02f,   1.39846027e-01f,
+             -7.59884715e-03f,  -6.71811104e-02f,   1.33539513e-02f,   1.47831077e-02f,  -1.13619317e-03f,   3.49576061e-04f,
+             -1.48026913e-03f,  -9.22526175e-04f,   1.41116057e-03f,   4.58674086e-03f,  -2.49230827e-04f,  -2.20343983e-03f,
+              4.37989627e-04f,   4.84863820e-04f,   1.53456936e-02f,  -2.50997711e-02f,  -7.81392306e-02f,  -6.60108253e-02f,
+             -1.65627357e-02f,   2.88311616e-02f,   1.56216277e-02f,  -2.00847629e-02f,  -2.82126870e-02f,  -2.61814408e-02f,
+              1.89615171e-02f,  -3.10138967e-02f,  -9.65507627e-02f,  -8.15646052e-02f,  -2.04653256e-02f,   3.56244929e-02f,
+              1.93024687e-02f,  -2.48172283e-02f,  -3.48602906e-02f,  -3.23504359e-02f,   1.29401609e-02f,  -2.11652257e-02f,
+             -6.58904240e-02f,  -5.56632206e-02f,  -1.39664244e-02f,   2.43116971e-02f,   1.31728407e-02f,  -1.69363525e-02f,
+             -2.37901732e-02f,  -2.20773388e-02f,  -7.66058033e-03f,   1.25298230e-02f,   3.90071571e-02f,   3.29526477e-02f,
+              8.26812908e-03f,  -1.43925352e-02f,  -7.79832713e-03f,   1.00263273e-02f,   1.40837915e-02f,   1.30697927e-02f,
+             -1.11201731e-02f,   1.81884132e-02f,   5.66231683e-02f,   4.78343852e-02f,   1.20020965e-02f,  -2.08923444e-02f,
+             -1.13201272e-02f,   1.45543143e-02f,   2.04441696e-02f,   1.89722385e-02f,   5.71050122e-03f,  -9.34022851e-03f,
+             -2.90774852e-02f,  -2.45642141e-02f,  -6.16339222e-03f,   1.07287681e-02f,   5.81318280e-03f,  -7.47402292e-03f,
+             -1.04986187e-02f,  -9.74274334e-03f,   1.71302166e-02f,  -2.80185789e-02f,  -8.72258991e-02f,  -7.36871064e-02f,
+             -1.84887871e-02f,   3.21838856e-02f,   1.74382385e-02f,  -2.24203840e-02f,  -3.14934887e-02f,  -2.92260349e-02f,
+              8.41003750e-03f,  -1.37556521e-02f,  -4.28233407e-02f,  -3.61765027e-02f,  -9.07702465e-03f,   1.58005990e-02f,
+              8.56126007e-03f,  -1.10072326e-02f,  -1.54616507e-02f,  -1.43484492e-02f,  -3.56732169e-03f,   5.83479414e-03f,
+              1.81645602e-02f,   1.53451422e-02f,   3.85024026e-03f,  -6.70220796e-03f,  -3.63146653e-03f,   4.66898503e-03f,
+              6.55843457e-03f,   6.08624332e-03f,  -3.67794596e-02f,   6.01573363e-02f,   1.87278509e-01f,   1.58210024e-01f,
+              3.96963805e-02f,  -6.91004619e-02f,  -3.74407992e-02f,   4.81377244e-02f,   6.76181465e-02f,   6.27498031e-02f,
+             -4.08652099e-03f,  -6.47185324e-03f,  -1.22723281e-02f,  -1.72149576e-02f,   2.18617334e-03f,  -5.96932194e-04f,
+             -9.88405850e-03f,  -2.13055452e-03f,  -6.46713132e-04f,  -3.73601029e-03f,   2.82984357e-02f,   1.74235348e-02f,
+             -1.53797809e-02f,  -2.46592686e-02f,  -1.78298205e-02f,  -1.74461268e-02f,  -2.03396212e-02f,   1.55185335e-04f,
+              3.76317627e-03f,   1.88165184e-04f,   7.28736296e-02f,   4.07888107e-02f,  -5.45541421e-02f,  -8.49304646e-02f,
+             -4.63158377e-02f,  -4.81411032e-02f,  -6.56021014e-02f,  -1.77471270e-03f,   9.58434120e-03f,  -3.34074069e-03f,
+             -2.47151144e-02f,  -2.05623358e-02f,  -6.15125149e-03f,  -6.53601624e-03f,   1.50470231e-02f,   1.10262092e-02f,
+              4.39813128e-04f,  -2.98409117e-03f,  -3.42621375e-03f,  -5.17577492e-03f,  -4.52991575e-02f,  -1.52008496e-02f,
+              7.11142048e-02f,   1.06123403e-01f,   2.97879837e-02f,   3.79242860e-02f,   7.36898407e-02f,   6.51455624e-03f,
+             -5.69263706e-03f,   1.15968203e-02f,  -5.33252656e-02f,  -3.23661864e-02f,   3.06908041e-02f,   4.89179380e-02f,
+              3.36441509e-02f,   3.32428217e-02f,   3.98398787e-02f,  -4.37988929e-05f,  -7.07910769e-03f,   8.28370030e-05f,
+              1.39461793e-02f,  -4.10366477e-03f,  -5.40753342e-02f,  -7.88038522e-02f,  -1.00336336e-02f,  -1.85952373e-02f,
+             -5.11556491e-02f,  -6.68663951e-03f,   1.52325514e-03f,  -1.18055549e-02f,   1.97733253e-01f,   1.30160004e-01f,
+             -7.66363144e-02f,  -1.28112167e-01f,  -1.23757988e-01f,  -1.15274847e-01f,  -1.14849418e-01f,   5.56859560e-03f,
+              2.65146084e-02f,   9.20388568e-03f,   8.80498216e-02f,   6.79939389e-02f,   2.63800775e-03f,  -4.34730621e-03f,
+             -5.41232154e-02f,  -4.34265994e-02f,  -1.86194219e-02f,   7.82721676e-03f,   1.20688304e-02f,   1.35063333e-02f,
+              9.69292447e-02f,   8.04009959e-02f,   2.32390668e-02f,   2.43643001e-02f,  -5.90360723e-02f,  -4.34336141e-02f,
+             -2.50804261e-03f,   1.15744201e-02f,   1.34308264e-02f,   2.00721249e-02f,   1.16644567e-03f,  -3.70884798e-02f,
+              4.73414175e-03f,   2.95452829e-02f,  -1.17626199e-02f,  -3.80717702e-02f,  -1.55362953e-02f,   1.03659078e-01f,
+              2.72729099e-02f,   1.45456789e-03f,   2.02753115e-03f,  -3.09798867e-02f,   4.70755110e-03f,   2.31358577e-02f,
+             -1.04392534e-02f,  -2.62154844e-02f,  -6.26147399e-03f,   8.77289623e-02f,   2.43932605e-02f,  -5.11854771e-04f,
+             -4.46819374e-03f,  -2.83124484e-02f,  -2.17989509e-04f,   3.04059610e-02f,  -5.85542945e-03f,  -5.74829578e-02f,
+             -4.60303202e-02f,   7.33159557e-02f,   1.26162581e-02f,   9.89648793e-03f,   3.70866619e-03f,   8.20295047e-03f,
+              1.78946310e-03f,  -1.23467939e-02f,   2.89165910e-04f,   2.94578578e-02f,   2.87302844e-02f,  -1.86221469e-02f,
+              4.03047088e-05f,  -6.82550389e-03f,   1.94177572e-02f,   1.02481898e-02f,   1.28078572e-02f,  -3.70882787e-02f,
+             -8.25746451e-03f,   1.15212783e-01f,   1.30169109e-01f,  -7.22199678e-03f,   2.26829648e-02f,  -3.27680893e-02f,
+              1.01908147e-02f,   1.64284594e-02f,   5.55985235e-03f,  -2.87764817e-02f,  -1.03175861e-03f,   7.36520067e-02f,
+              7.51601607e-02f,  -3.42969447e-02f,   4.31087427e-03f,  -1.82005074e-02f,   4.85775946e-03f,   3.95455435e-02f,
+             -6.84646599e-04f,  -4.04428989e-02f,   8.98495503e-03f,   7.29536265e-02f,   5.54727651e-02f,  -1.03905380e-01f,
+             -1.97392963e-02f,  -1.15550281e-02f,  -2.59239739e-03f,   1.77192241e-02f,  -3.71706323e-03f,  -1.11334296e-02f,
+              6.80605136e-03f,   7.39557762e-03f,  -5.55477617e-03f,  -5.17320894e-02f,  -1.61452331e-02f,   2.64189416e-03f,
+             -2.87331408e-03f,   9.05129779e-03f,  -3.00647225e-03f,  -3.41735827e-03f,   4.37970040e-03f,  -4.43781773e-03f,
+             -1.27154142e-02f,  -2.81066429e-02f,  -1.06186587e-02f,   3.88941122e-03f,   1.25645043e-03f,  -2.16516312e-02f,
+              3.17524769e-03f,   1.64047815e-02f,  -7.20231282e-03f,  -1.91734582e-02f,  -5.40005276e-03f,   6.11389279e-02f,
+              1.68024655e-02f,  -9.44463027e-05f,   3.35649177e-02f,  -8.48542340e-03f,  -1.82491913e-02f,  -2.32125092e-02f,
+             -1.74793750e-02f,  -1.13555964e-03f,   7.28194369e-03f,   1.01898471e-02f,   9.06656496e-03f,  -5.14678843e-03f,
+              5.88922240e-02f,  -1.48883257e-02f,  -3.20196040e-02f,  -4.07281294e-02f,  -3.06689050e-02f,  -1.99242658e-03f,
+              1.27767287e-02f,   1.78788677e-02f,   1.59079824e-02f,  -9.03043523e-03f,   1.09584168e-01f,  -2.77035702e-02f,
+             -5.95807321e-02f,  -7.57851824e-02f,  -5.70674054e-02f,  -3.70742334e-03f,   2.37743985e-02f,   3.32682431e-02f,
+              2.96009053e-02f,  -1.68034527e-02f,   8.47534165e-02f,  -2.14261990e-02f,  -4.60802950e-02f,  -5.86129688e-02f,
+             -4.41364609e-02f,  -2.86735571e-03f,   1.83873419e-02f,   2.57299691e-02f,   2.28936151e-02f,  -1.29959472e-02f,
+              8.05568099e-02f,  -2.03652699e-02f,  -4.37986031e-02f,  -5.57107180e-02f,  -4.19510230e-02f,  -2.72537721e-03f,
+              1.74768828e-02f,   2.44559385e-02f,   2.17600260e-02f,  -1.23524461e-02f,   1.26868784e-01f,  -3.20732296e-02f,
+             -6.89783469e-02f,  -8.77387151e-02f,  -6.60685971e-02f,  -4.29219194e-03f,   2.75243130e-02f,   3.85156162e-02f,
+              3.42698283e-02f,  -1.94538459e-02f,   1.70922235e-01f,  -4.32102196e-02f,  -9.29301381e-02f,  -1.18204787e-01f,
+             -8.90100151e-02f,  -5.78259677e-03f,   3.70817557e-02f,   5.18896356e-02f,   4.61695604e-02f,  -2.62089297e-02f,
+              7.25860372e-02f,  -1.83502100e-02f,  -3.94649133e-02f,  -5.01983687e-02f,  -3.78001407e-02f,  -2.45571230e-03f,
+              1.57476161e-02f,   2.20361222e-02f,   1.96069609e-02f,  -1.11302221e-02f,   3.59194838e-02f,  -9.08067264e-03f,
+             -1.95293650e-02f,  -2.48408578e-02f,  -1.87055469e-02f,  -1.21521880e-03f,   7.79276947e-03f,   1.09046604e-02f,
+              9.70258098e-03f,  -5.50783379e-03f,   4.34521250e-02f,  -1.09849712e-02f,  -2.36248486e-02f,  -3.00502107e-02f,
+             -2.26282682e-02f,  -1.47006114e-03f,   9.42698307e-03f,   1.31914662e-02f,   1.17372992e-02f,  -6.66287588e-03f,
+              6.95188120e-02f,  -2.86410917e-02f,  -5.94881959e-02f,  -7.53438324e-02f,  -4.49113511e-02f,   3.65880542e-02f,
+              3.82841341e-02f,  -1.30398283e-02f,   1.13089178e-02f,  -4.09804471e-03f,  -7.14013651e-02f,   2.94166859e-02f,
+              6.10991232e-02f,   7.73841292e-02f,   4.61275391e-02f,  -3.75788510e-02f,  -3.93208601e-02f,   1.33929448e-02f,
+             -1.16151609e-02f,   4.20901878e-03f,  -8.55218843e-02f,   3.52342092e-02f,   7.31822476e-02f,   9.26878154e-02f,
+              5.52498437e-02f,  -4.50105444e-02f,  -4.70970534e-02f,   1.60415675e-02f,  -1.39122056e-02f,   5.04140556e-03f,
+              7.47628286e-02f,  -3.08015775e-02f,  -6.39755726e-02f,  -8.10272470e-02f,  -4.82991524e-02f,   3.93480025e-02f,
+              4.11720201e-02f,  -1.40234632e-02f,   1.21619841e-02f,  -4.40717256e-03f,   1.40860453e-01f,  -5.80331720e-02f,
+             -1.20536208e-01f,  -1.52663231e-01f,  -9.10003036e-02f,   7.41354749e-02f,   7.75720999e-02f,  -2.64215693e-02f,
+              2.29143631e-02f,  -8.30354262e-03f,   1.63293436e-01f,  -6.72753453e-02f,  -1.39732420e-01f,  -1.76975876e-01f,
+             -1.05492719e-01f,   8.59420449e-02f,   8.99259821e-02f,  -3.06293834e-02f,   2.65636295e-02f,  -9.62593779e-03f,
+              1.87538311e-01f,  -7.72640109e-02f,  -1.60479084e-01f,  -2.03252256e-01f,  -1.21155679e-01f,   9.87022296e-02f,
+              1.03277676e-01f,  -3.51770595e-02f,   3.05076465e-02f,  -1.10551426e-02f,   1.64565817e-01f,  -6.77995607e-02f,
+             -1.40821218e-01f,  -1.78354874e-01f,  -1.06314719e-01f,   8.66117105e-02f,   9.06266868e-02f,  -3.08680497e-02f,
+              2.67706141e-02f,  -9.70094372e-03f,   1.76488101e-01f,  -7.27114230e-02f,  -1.51023269e-01f,  -1.91276133e-01f,
+             -1.14016891e-01f,   9.28864554e-02f,   9.71923023e-02f,  -3.31043415e-02f,   2.87100617e-02f,  -1.04037467e-02f,
+              1.60555472e-03f,  -6.61473314e-04f,  -1.37389509e-03f,  -1.74008508e-03f,  -1.03723910e-03f,   8.45010451e-04f,
+              8.84181820e-04f,  -3.01158172e-04f,   2.61182344e-04f,  -9.46453874e-05f,   3.24003585e-02f,   1.75555404e-02f,
+             -2.72209439e-02f,  -3.71631607e-02f,  -3.91082577e-02f,  -2.91116480e-02f,  -4.69812891e-03f,   1.20651620e-02f,
+              4.82337084e-03f,   1.67943502e-03f,   4.11323160e-02f,  -3.18662524e-02f,  -1.60394907e-01f,  -1.66908771e-01f,
+             -1.48009107e-01f,  -1.00825228e-01f,  -4.16618437e-02f,   8.86877999e-03f,   1.67682283e-02f,   2.32776236e-02f,
+              6.78808242e-02f,  -8.61744210e-03f,  -1.62521660e-01f,  -1.78230971e-01f,  -1.64392099e-01f,  -1.14532351e-01f,
+             -3.97687554e-02f,   1.98718477e-02f,   1.90291144e-02f,   2.12452244e-02f,  -4.66380306e-02f,  -1.71314215e-03f,
+              9.39226821e-02f,   1.05576873e-01f,   9.90811139e-02f,   6.96870089e-02f,   2.22912282e-02f,  -1.45620564e-02f,
+             -1.15735037e-02f,  -1.16158519e-02f,  -6.45081475e-02f,   1.58751644e-02f,   1.72306761e-01f,   1.86368674e-01f,
+              1.70184523e-01f,   1.17906496e-01f,   4.28593531e-02f,  -1.79693568e-02f,  -1.95944738e-02f,  -2.31908206e-02f,
+             -1.20684303e-01f,  -1.73003506e-02f,   2.13141546e-01f,   2.44750157e-01f,   2.33018667e-01f,   1.65152058e-01f,
+              4.92004789e-02f,  -3.92140411e-02f,  -2.74191834e-02f,  -2.50337142e-02f,  -9.06032622e-02f,  -3.65013778e-02f,
+              1.05376467e-01f,   1.31758511e-01f,   1.32229522e-01f,   9.62558389e-02f,   2.14372110e-02f,  -3.22394893e-02f,
+             -1.59628149e-02f,  -9.61256772e-03f,  -1.88523442e-01f,  -6.99867234e-02f,   2.33121231e-01f,   2.87343234e-01f,
+              2.85969973e-01f,   2.07318753e-01f,   4.85369638e-02f,  -6.63724542e-02f,  -3.43870595e-02f,  -2.23301556e-02f,
+             -2.06235170e-01f,  -1.46011248e-01f,   9.36404765e-02f,   1.60789639e-01f,   1.86692283e-01f,   1.44888029e-01f,
+              7.31618982e-03f,  -8.08774158e-02f,  -2.39659604e-02f,   2.69035948e-03f,  -6.64243698e-02f,  -1.60549074e-01f,
+             -2.33635634e-01f,  -1.99204326e-01f,  -1.46065578e-01f,  -8.72214809e-02f,  -7.24768192e-02f,  -3.95660028e-02f,
+              1.45961624e-02f,   4.51942421e-02f,   3.18490751e-02f,   3.01642045e-02f,  -2.32836083e-02f,  -2.92110853e-02f,
+             -2.46879794e-02f,  -4.09561284e-02f,  -3.05236168e-02f,   1.17412396e-02f,   2.71125529e-02f,   2.19789837e-02f,
+             -1.44713803e-03f,  -1.37058191e-03f,   1.05794577e-03f,   1.32727472e-03f,   1.12175674e-03f,   1.86093850e-03f,
+              1.38691266e-03f,  -5.33490966e-04f,  -1.23192288e-03f,  -9.98666976e-04f,  -9.83029455e-02f,  -9.31025520e-02f,
+              7.18654245e-02f,   9.01607275e-02f,   7.62000531e-02f,   1.26412079e-01f,   9.42118838e-02f,  -3.62396203e-02f,
+             -8.36835578e-02f,  -6.78386614e-02f,  -8.85719433e-02f,  -8.38863403e-02f,   6.47514760e-02f,   8.12357217e-02f,
+              6.86570182e-02f,   1.13898568e-01f,   8.48858580e-02f,  -3.26522663e-02f,  -7.53997266e-02f,  -6.11233227e-02f,
+             -6.00234680e-02f,  -5.68481274e-02f,   4.38808016e-02f,   5.50518557e-02f,   4.65275124e-02f,   7.71868229e-02f,
+              5.75254820e-02f,  -2.21277997e-02f,  -5.10969162e-02f,  -4.14220765e-02f,  -1.07633293e-01f,  -1.01939306e-01f,
+              7.86864758e-02f,   9.87182558e-02f,   8.34325179e-02f,   1.38410389e-01f,   1.03153929e-01f,  -3.96792777e-02f,
+             -9.16263089e-02f,  -7.42775127e-02f,  -1.58644140e-01f,  -1.50251582e-01f,   1.15978494e-01f,   1.45503983e-01f,
+              1.22973844e-01f,   2.04007477e-01f,   1.52041867e-01f,  -5.84845468e-02f,  -1.35050938e-01f,  -1.09479994e-01f,
+             -1.18635170e-01f,  -1.12359166e-01f,   8.67295191e-02f,   1.08808875e-01f,   9.19606835e-02f,   1.52558193e-01f,
+              1.13697946e-01f,  -4.37351465e-02f,  -1.00992016e-01f,  -8.18698928e-02f,  -4.95443605e-02f,  -4.69233766e-02f,
+              3.62199359e-02f,   4.54407074e-02f,   3.84045728e-02f,   6.37112707e-02f,   4.74824794e-02f,  -1.82646494e-02f,
+             -4.21762355e-02f,  -3.41904610e-02f,  -8.60217810e-02f,  -8.14710855e-02f,   6.28871471e-02f,   7.88967833e-02f,
+              6.66802451e-02f,   1.10619202e-01f,   8.24418291e-02f,  -3.17121409e-02f,  -7.32288212e-02f,  -5.93634583e-02f,
+              4.20151241e-02f,   2.62789931e-02f,  -7.91055616e-03f,  -3.93132605e-02f,  -4.33683880e-02f,  -2.28817333e-02f,
+             -2.82183476e-03f,   7.61126727e-03f,   1.84847210e-02f,   2.80410536e-02f,   3.73061746e-02f,   2.45646611e-02f,
+              6.45607419e-04f,  -1.53475814e-02f,  -2.08350550e-02f,  -1.96624249e-02f,   2.79658916e-03f,   1.77825894e-03f,
+              7.83711020e-03f,   2.01368090e-02f,   4.42693792e-02f,   3.30195352e-02f,   2.48777494e-02f,   4.32792231e-02f,
+              3.08356639e-02f,  -2.12739203e-02f,   1.99875385e-02f,  -1.35458484e-02f,  -1.76610239e-02f,   8.92620068e-03f,
+              4.99552116e-02f,   4.31023128e-02f,   6.44711554e-02f,   1.41663432e-01f,   1.18667126e-01f,  -2.08988339e-02f,
+              4.77176271e-02f,  -3.89194749e-02f,  -6.06287383e-02f,  -1.25243012e-02f,   2.85616182e-02f,   2.47037690e-02f,
+              3.72364745e-02f,   8.19527805e-02f,   6.87124059e-02f,  -1.19167399e-02f,   2.75418479e-02f,  -2.24957801e-02f,
+             -3.50839645e-02f,  -7.39378901e-03f,   9.28481109e-03f,   4.01261030e-03f,  -1.29302805e-02f,  -3.72053422e-02f,
+             -3.53504866e-02f,  -6.01123506e-03f,  -8.35408177e-03f,   8.94271675e-03f,   1.65884420e-02f,   1.31388931e-02f,
+             -5.03739761e-03f,  -4.64974763e-03f,  -8.39142874e-03f,  -1.91058107e-02f,  -1.63218677e-02f,   1.94602308e-03f,
+             -6.11855229e-03f,   5.15195075e-03f,   8.22734088e-03f,   2.43645813e-03f,  -1.70865450e-02f,  -1.45216482e-02f,
+             -2.06748880e-02f,  -4.49433327e-02f,  -3.74164172e-02f,   7.26570981e-03f,  -1.53694963e-02f,   1.24180345e-02f,
+              1.91979595e-02f,   3.42911738e-03f,  -1.30797205e-02f,  -1.33764949e-02f,  -2.99089830e-02f,  -7.03180805e-02f,
+             -6.10917509e-02f,   4.35962202e-03f,  -2.15008240e-02f,   1.86498743e-02f,   3.04425247e-02f,   1.13677066e-02f,
+             -6.93235639e-03f,  -7.60068884e-03f,  -1.90360844e-02f,  -4.53894548e-02f,  -3.97160910e-02f,   2.03879713e-03f,
+             -1.35968439e-02f,   1.19520528e-02f,   1.96951330e-02f,   8.00174102e-03f,  -2.13090028e-03f,  -6.24211133e-03f,
+             -7.60688120e-03f,   1.19817269e-03f,   6.66151894e-03f,  -6.66834554e-03f,  -4.95642237e-03f,  -1.33009804e-02f,
+             -8.92243348e-03f,  -3.12859332e-03f,   4.60713729e-03f,   1.34958280e-02f,   1.64465439e-02f,  -2.59052310e-03f,
+             -1.44026130e-02f,   1.44173726e-02f,   1.07160900e-02f,   2.87575368e-02f,   1.92908477e-02f,   6.76421076e-03f,
+              5.81254950e-03f,   1.70268789e-02f,   2.07496192e-02f,  -3.26830777e-03f,  -1.81709137e-02f,   1.81895364e-02f,
+              1.35198496e-02f,   3.62816639e-02f,   2.43381076e-02f,   8.53399932e-03f,  -4.25939308e-03f,  -1.24771697e-02f,
+             -1.52051672e-02f,   2.39499169e-03f,   1.33155109e-02f,  -1.33291567e-02f,  -9.90724470e-03f,  -2.65869331e-02f,
+             -1.78347845e-02f,  -6.25365134e-03f,  -1.35712987e-02f,  -3.97548191e-02f,  -4.84467745e-02f,   7.63093354e-03f,
+              4.24259417e-02f,  -4.24694195e-02f,  -3.15665118e-02f,  -8.47114101e-02f,  -5.68252765e-02f,  -1.99254137e-02f,
+             -8.17722175e-03f,  -2.39537861e-02f,  -2.91910209e-02f,   4.59792698e-03f,   2.55632401e-02f,  -2.55894382e-02f,
+             -1.90200210e-02f,  -5.10418378e-02f,  -3.42393853e-02f,  -1.20058181e-02f,  -1.02820722e-02f,  -3.01195886e-02f,
+             -3.67049091e-02f,   5.78145217e-03f,   3.21433246e-02f,  -3.21762636e-02f,  -2.39158515e-02f,  -6.41802177e-02f,
+             -4.30527441e-02f,  -1.50961643e-02f,  -5.67400688e-03f,  -1.66210420e-02f,  -2.02550516e-02f,   3.19040730e-03f,
+              1.77378096e-02f,  -1.77559871e-02f,  -1.31976027e-02f,  -3.54168862e-02f,  -2.37580072e-02f,  -8.33059102e-03f,
+             -2.41510198e-03f,  -7.07463222e-03f,  -8.62142351e-03f,   1.35797495e-03f,   7.54997646e-03f,  -7.55771343e-03f,
+             -5.61746862e-03f,  -1.50749544e-02f,  -1.01124328e-02f,  -3.54585890e-03f,   1.25512073e-03f,   3.67666339e-03f,
+              4.48052585e-03f,  -7.05735176e-04f,  -3.92369833e-03f,   3.92771931e-03f,   2.91938032e-03f,   7.83440471e-03f,
+              5.25539834e-03f,   1.84277131e-03f,   2.42173448e-02f,   1.45278974e-02f,   5.41642494e-03f,  -9.87151731e-03f,
+              1.04185054e-02f,  -1.33113153e-02f,  -7.09471777e-02f,   9.08597140e-04f,   1.52796283e-02f,   3.22320908e-02f,
+              1.10617178e-02f,   7.05814734e-03f,  -1.13353096e-02f,  -3.64672095e-02f,  -2.05139276e-02f,   4.88641448e-02f,
+              8.47400203e-02f,   1.92984473e-02f,  -1.42654171e-02f,   3.75246815e-03f,   7.32657965e-03f,   5.22732316e-03f,
+             -2.55747996e-02f,  -6.59650117e-02f,  -4.66518998e-02f,   1.04249068e-01f,   2.09391013e-01f,   3.74875627e-02f,
+             -3.72432508e-02f,  -1.18670054e-02f,  -6.15431182e-03f,  -3.46651510e-03f,  -8.74888245e-03f,  -1.45529266e-02f,
+             -1.61400326e-02f,   3.27159576e-02f,   8.05707574e-02f,   9.85041261e-03f,  -1.52248945e-02f,  -1.40477195e-02f,
+             -2.74989363e-02f,  -1.69567373e-02f,   8.90047289e-03f,   4.60404977e-02f,   1.57145802e-02f,  -4.47688811e-02f,
+             -4.71172631e-02f,  -2.16128118e-02f,   5.80450753e-03f,  -2.46433541e-02f,  -1.71938464e-02f,  -1.02832057e-02f,
+             -4.86982893e-03f,   4.63817175e-03f,  -9.27147735e-03f,   1.35261239e-02f,   5.90601452e-02f,   7.55541143e-04f,
+             -1.24240061e-02f,  -2.36978419e-02f,  -6.93670427e-03f,  -3.72749311e-03f,  -1.57384407e-02f,  -3.00045758e-02f,
+             -2.89480984e-02f,   6.02596477e-02f,   1.40671670e-01f,   1.91395525e-02f,  -2.62022410e-02f,  -2.05025282e-02f,
+             -2.28682510e-03f,  -1.18207221e-03f,  -6.71807211e-03f,  -1.34314271e-02f,  -1.23426327e-02f,   2.59516519e-02f,
+              5.93508407e-02f,   8.40133987e-03f,  -1.09912381e-02f,  -7.97416642e-03f,   7.45889451e-03f,   4.61417809e-03f,
+             -2.89758272e-03f,  -1.36068482e-02f,  -5.14713395e-03f,   1.40665518e-02f,   1.68808959e-02f,   6.52333163e-03f,
+             -2.31809379e-03f,   6.30033249e-03f,   1.91428456e-02f,   1.16432747e-02f,  -9.36371449e-04f,  -1.98783875e-02f,
+             -1.31385308e-03f,   1.02385413e-02f,  -1.18173612e-02f,   7.85327516e-03f,   4.05068137e-03f,   2.13331394e-02f,
+             -4.62524872e-03f,   4.42661752e-04f,   3.32892500e-02f,   2.56759971e-02f,  -6.84902864e-03f,  -7.56049678e-02f,
+             -7.94472173e-02f,  -3.07840630e-02f,   1.31987473e-02f,   3.13677005e-02f,  -4.17277031e-03f,  -4.44524398e-04f,
+              1.98647659e-03f,   5.85371396e-03f,  -2.20617861e-03f,   3.44492421e-02f,   4.79434617e-02f,   1.04270494e-02f,
+             -1.22977365e-02f,  -1.73354894e-02f,  -6.05441742e-02f,   4.44503948e-02f,   4.49790545e-02f,  -8.45093429e-02f,
+             -1.28024086e-01f,   6.09697290e-02f,   2.12221265e-01f,  -7.70582724e-03f,  -7.66829625e-02f,  -5.27389231e-04f,
+             -1.14830188e-01f,   7.27861375e-02f,   1.35602280e-01f,  -8.28582495e-02f,  -2.25708783e-01f,   2.97165327e-02f,
+              2.95160055e-01f,  -4.77007143e-02f,  -1.24733627e-01f,   2.27399766e-02f,  -1.15398087e-01f,   4.65213880e-02f,
+              2.48066097e-01f,   9.24560726e-02f,  -1.86909005e-01f,  -1.53456599e-01f,   6.63769171e-02f,  -1.18714206e-01f,
+             -8.10976028e-02f,   7.10860863e-02f,  -2.02887561e-02f,  -1.30371063e-03f,   6.37209639e-02f,   6.45666718e-02f,
+             -1.69552099e-02f,  -2.45946683e-02f,   8.85344390e-03f,  -2.08464134e-02f,  -1.44746127e-02f,   2.50037469e-04f,
+             -6.87943446e-03f,   1.76023468e-02f,  -7.73767456e-02f,  -1.14016838e-01f,  -3.08113992e-02f,   1.95623070e-01f,
+              2.52324134e-01f,   7.06239045e-02f,  -5.37205599e-02f,  -6.72682226e-02f,  -2.94679627e-02f,   3.27947550e-02f,
+             -6.31409436e-02f,  -1.42437577e-01f,  -7.57706761e-02f,   2.37593129e-01f,   3.53171259e-01f,   7.47894198e-02f,
+             -8.68176818e-02f,  -7.74685219e-02f,  -2.07131803e-02f,   1.86778046e-02f,  -1.74673032e-02f,  -6.50602505e-02f,
+             -4.74352017e-02f,   1.07532799e-01f,   1.76071957e-01f,   2.99967173e-02f,  -4.68239859e-02f,  -3.37643735e-02f,
+             -2.21335292e-02f,   1.21878628e-02f,   5.06725349e-02f,   8.35397001e-03f,  -4.21845317e-02f,  -6.46464005e-02f,
+             -2.65401639e-02f,  -3.56014743e-02f,  -7.36067351e-03f,   3.28054577e-02f,   1.31237395e-02f,  -2.50616688e-02f,
+             -6.89203441e-02f,   3.46253859e-03f,   4.56960425e-02f,  -1.11146048e-02f,  -2.11155750e-02f,   1.84310898e-02f,
+              2.33805813e-02f,   5.88813936e-03f,   3.08736903e-03f,  -6.46770466e-03f,  -2.00206116e-02f,  -5.12657920e-03f,
+              1.25517715e-02f,   3.98514280e-03f,  -9.73213639e-04f,   4.76643955e-03f,   4.65942826e-03f,   1.02060125e-03f,
+             -9.51004028e-03f,   1.59828514e-02f,   3.54452617e-02f,  -2.51333043e-02f,  -2.62522232e-02f,   3.31867598e-02f,
+              3.05115599e-02f,  -1.17165660e-02f,  -2.01446805e-02f,  -5.65517507e-03f,  -2.96332370e-02f,   4.83281203e-02f,
+              1.00633167e-01f,  -9.36307311e-02f,  -7.71571323e-02f,   1.20423347e-01f,   1.05370484e-01f,  -3.53989527e-02f,
+             -6.49383739e-02f,  -1.85613539e-02f,  -4.72411886e-02f,   9.61368531e-02f,   2.87517339e-01f,   4.90636490e-02f,
+             -1.83150083e-01f,  -2.83405110e-02f,   3.46440487e-02f,  -7.08043873e-02f,  -7.54542574e-02f,  -1.74196418e-02f,
+             -6.64172368e-03f,   1.67692117e-02f,   6.20772392e-02f,   4.06914018e-02f,  -3.59977968e-02f,  -4.15247083e-02f,
+             -1.78487226e-02f,  -1.24032889e-02f,  -5.82534680e-03f,  -3.75269941e-04f,   2.16814061e-03f,  -1.78396814e-02f,
+             -1.02575637e-01f,  -1.41734883e-01f,   5.07061370e-02f,   1.56248823e-01f,   9.21847150e-02f,   1.33569269e-02f,
+             -1.62785351e-02f,  -7.76012428e-03f,  -3.05829733e-03f,  -3.20779462e-03f,  -4.41675112e-02f,  -9.47971046e-02f,
+              1.78552065e-02f,   1.07001364e-01f,   6.81104437e-02f,   2.51570460e-03f,  -1.87512599e-02f,  -7.14000314e-03f,
+             -6.47759670e-03f,   9.47065465e-03f,   1.47187524e-02f,  -3.18261087e-02f,  -1.34211117e-02f,   3.89421992e-02f,
+              3.06699518e-02f,  -6.91482052e-03f,  -1.58027261e-02f,  -4.75444132e-03f,   5.93703287e-03f,  -1.16713513e-02f,
+             -3.34002897e-02f,  -1.90037838e-03f,   2.17237361e-02f,  -1.17695401e-03f,  -7.22171972e-03f,   8.58923234e-03f,
+              1.00864461e-02f,   2.45098304e-03f,   2.63514183e-03f,  -6.70892373e-03f,  -1.26048680e-02f,  -4.56726691e-03f,
+             -1.86120195e-03f,  -1.56279129e-03f,   1.45810680e-03f,   4.66488535e-03f,   6.85964525e-03f,   3.68207879e-03f,
+              2.23557348e-03f,  -5.69164520e-03f,  -1.06935836e-02f,  -3.87472939e-03f,  -1.57898676e-03f,  -1.32582430e-03f,
+              1.23701314e-03f,   3.95754585e-03f,   5.81951300e-03f,   3.12376278e-03f,   2.92743649e-03f,  -7.45308958e-03f,
+             -1.40030226e-02f,  -5.07387659e-03f,  -2.06764974e-03f,  -1.73613895e-03f,   1.61984260e-03f,   5.18232258e-03f,
+              7.62052927e-03f,   4.09050146e-03f,  -9.27035324e-03f,   2.36018021e-02f,   4.43435647e-02f,   1.60675142e-02f,
+              6.54765544e-03f,   5.49785513e-03f,  -5.12957806e-03f,  -1.64109338e-02f,  -2.41320357e-02f,  -1.29534481e-02f,
+             -1.69846211e-02f,   4.32418957e-02f,   8.12437907e-02f,   2.94380002e-02f,   1.19962469e-02f,   1.00728618e-02f,
+             -9.39812511e-03f,  -3.00671924e-02f,  -4.42133620e-02f,  -2.37325802e-02f,  -7.55198067e-03f,   1.92269199e-02f,
+              3.61239463e-02f,   1.30892051e-02f,   5.33396751e-03f,   4.47876053e-03f,  -4.17874800e-03f,  -1.33689670e-02f,
+             -1.96588691e-02f,  -1.05523681e-02f,   6.68657711e-03f,  -1.70236509e-02f,  -3.19843963e-02f,  -1.15892757e-02f,
+             -4.72273305e-03f,  -3.96552635e-03f,   3.69989336e-03f,   1.18369786e-02f,   1.74061023e-02f,   9.34314262e-03f,
+              4.81113605e-03f,  -1.22488830e-02f,  -2.30134614e-02f,  -8.33873264e-03f,  -3.39810783e-03f,  -2.85328156e-03f,
+              2.66215275e-03f,   8.51695985e-03f,   1.25240646e-02f,   6.72259135e-03f,   6.59753056e-03f,  -1.67969428e-02f,
+             -3.15584540e-02f,  -1.14349378e-02f,  -4.65983897e-03f,  -3.91271664e-03f,   3.65062105e-03f,   1.16793420e-02f,
+              1.71743017e-02f,   9.21871699e-03f,   1.35536334e-02f,  -3.45067941e-02f,  -6.48320913e-02f,  -2.34913602e-02f,
+             -9.57293808e-03f,  -8.03808775e-03f,   7.49965152e-03f,   2.39934511e-02f,   3.52820195e-02f,   1.89384669e-02f,
+             -3.06660533e-02f,  -1.04147112e-02f,   1.45499445e-02f,   2.18098871e-02f,   2.90562809e-02f,   2.50677615e-02f,
+              3.53725292e-02f,   5.16766906e-02f,   4.92240973e-02f,   2.13482939e-02f,  -1.52964722e-02f,  -1.05200121e-02f,
+             -3.52833862e-03f,  -1.10328977e-03f,   1.93717666e-02f,   1.13798846e-02f,  -6.79931790e-03f,   7.33262533e-03f,
+              1.54402256e-02f,   8.83808546e-03f,  -1.17703779e-02f,  -1.31840762e-02f,  -1.30230123e-02f,  -1.23002380e-02f,
+              1.95683427e-02f,   7.68232625e-03f,  -2.85922326e-02f,  -1.19844871e-02f,   3.17167095e-03f,   5.07037668e-03f,
+             -2.02162992e-02f,  -1.72179416e-02f,  -1.13764293e-02f,  -8.91597476e-03f,   2.86386013e-02f,   1.43403551e-02f,
+             -2.41999552e-02f,  -1.78872922e-03f,   1.47341974e-02f,   1.05537530e-02f,   3.80293839e-03f,   1.77693565e-03f,
+             -8.21190653e-04f,  -1.61246315e-03f,  -4.04797401e-03f,  -3.00622103e-03f,  -2.15851702e-03f,  -4.72726906e-03f,
+             -5.27366064e-03f,  -2.48238863e-03f,   7.13683339e-03f,   5.62827382e-03f,   3.10453190e-03f,   2.13482603e-03f,
+             -9.69780143e-03f,  -5.15749492e-03f,   6.47722976e-03f,  -9.27412184e-04f,  -5.97175444e-03f,  -3.87875643e-03f,
+              5.91218565e-03f,  -2.07838393e-03f,  -1.10818725e-02f,  -1.33995079e-02f,  -1.85843639e-03f,  -5.69548178e-03f,
+             -2.55765337e-02f,  -2.41162162e-02f,  -1.64831299e-02f,  -5.50518977e-03f,   1.41515965e-02f,   5.56471618e-03f,
+             -5.17788855e-03f,  -8.35774932e-03f,  -1.41036715e-02f,  -1.14079909e-02f,  -1.28413765e-02f,  -2.12199725e-02f,
+             -2.14174259e-02f,  -9.59375501e-03f,   6.68113539e-03f,   2.12888839e-03f,  -3.45381093e-03f,  -5.06699830e-03f,
+             -6.20203884e-03f,  -5.49103320e-03f,  -8.34979396e-03f,  -1.17440587e-02f,  -1.09641580e-02f,  -4.69874823e-03f,
+             -8.64629401e-04f,   5.23993373e-03f,   1.16185313e-02f,   1.30663356e-02f,  -4.25003003e-03f,   1.87491614e-03f,
+              2.63978373e-02f,   2.06233319e-02f,   1.08578503e-02f,   2.48342426e-03f,  -6.43835366e-02f,  -1.25574648e-01f,
+             -7.44757578e-02f,   5.06001934e-02f,   1.27762437e-01f,   1.84690312e-01f,   7.07936957e-02f,   1.02425009e-01f,
+              7.21440092e-02f,   1.64660923e-02f,  -7.15837628e-02f,  -7.84445778e-02f,  -4.95799147e-02f,  -7.97799043e-03f,
+              1.18609136e-02f,  -1.44195987e-03f,   3.62836868e-02f,   4.56940308e-02f,   4.36387137e-02f,   3.79932448e-02f,
+             -4.48979102e-02f,  -6.77157342e-02f,  -3.29394452e-02f,   4.73477952e-02f,   4.98541594e-02f,   2.85550412e-02f,
+              1.29250716e-02f,   4.72104363e-02f,   6.23694621e-02f,   4.75513972e-02f,   2.81068459e-02f,  -2.36753728e-02f,
+             -5.92384022e-03f,   7.71503299e-02f,   1.12817824e-01f,   1.67789131e-01f,   1.19517278e-02f,   4.17131335e-02f,
+              2.76605394e-02f,  -1.72847677e-02f,   7.62039572e-02f,   6.71205297e-02f,   3.27152573e-02f,  -1.90347731e-02f,
+              1.81543231e-02f,   1.01958409e-01f,   3.56029230e-03f,  -2.75420640e-02f,  -6.91864341e-02f,  -8.60634893e-02f,
+              5.36905527e-02f,   5.67262955e-02f,   2.23526061e-02f,  -4.66479659e-02f,  -9.42503661e-03f,   6.34228513e-02f,
+              1.20366663e-02f,  -2.84434985e-02f,  -7.13503808e-02f,  -7.86398128e-02f,   2.40611658e-02f,   3.94746810e-02f,
+              1.24418745e-02f,  -5.65294921e-02f,  -3.60413715e-02f,   1.92350056e-03f,   1.00243986e-02f,  -2.70879231e-02f,
+             -5.55505864e-02f,  -4.95392643e-02f,   5.08303791e-02f,   4.97279465e-02f,   3.25844809e-02f,   1.44361360e-02f,
+              4.52062488e-03f,   1.87044293e-02f,  -2.33418327e-02f,  -2.59459000e-02f,  -2.55991630e-02f,  -2.66482327e-02f,
+              4.43184301e-02f,   2.44488623e-02f,   1.92642678e-02f,   3.69449370e-02f,   4.45944443e-02f,   7.56921843e-02f,
+             -1.03398319e-02f,  -1.83163816e-03f,  -7.74076302e-03f,  -2.52580196e-02f,   4.30459790e-02f,   3.71386595e-02f,
+              3.05440184e-02f,   4.00913619e-02f,   1.64857227e-02f,   9.86056775e-03f,  -3.19177210e-02f,  -1.78639404e-02f,
+             -2.24062428e-03f,  -3.74688837e-03f,  -8.16234678e-04f,  -5.92791475e-03f,  -6.83226390e-03f,  -5.63861162e-04f,
+              2.62338854e-03f,   7.61263218e-05f,  -3.49400006e-03f,   6.59520319e-03f,   4.75241430e-03f,   4.95148683e-03f,
+             -3.77465785e-03f,  -2.74135005e-02f,  -3.15956399e-02f,  -2.60756235e-03f,   1.21317981e-02f,   3.52044357e-04f,
+             -1.61579195e-02f,   3.04993596e-02f,   2.19774265e-02f,   2.28980333e-02f,  -7.21774437e-03f,  -5.24189621e-02f,
+             -6.04158752e-02f,  -4.98607289e-03f,   2.31979229e-02f,   6.73164672e-04f,  -3.08965072e-02f,   5.83196133e-02f,
+              4.20243256e-02f,   4.37846705e-02f,  -5.30547928e-03f,  -3.85311097e-02f,  -4.44093272e-02f,  -3.66506539e-03f,
+              1.70518775e-02f,   4.94816748e-04f,  -2.27108020e-02f,   4.28684466e-02f,   3.08904219e-02f,   3.21843848e-02f,
+             -1.61401520e-03f,  -1.17218057e-02f,  -1.35100577e-02f,  -1.11497403e-03f,   5.18746534e-03f,   1.50531516e-04f,
+             -6.90900488e-03f,   1.30412960e-02f,   9.39738192e-03f,   9.79102589e-03f,  -1.78338320e-03f,  -1.29518425e-02f,
+             -1.49277458e-02f,  -1.23197469e-03f,   5.73181594e-03f,   1.66327649e-04f,  -7.63400644e-03f,   1.44097945e-02f,
+              1.03835035e-02f,   1.08184554e-02f,  -1.06817298e-03f,  -7.75761949e-03f,  -8.94110370e-03f,  -7.37902010e-04f,
+              3.43312137e-03f,   9.96234085e-05f,  -4.57245484e-03f,   8.63087270e-03f,   6.21929020e-03f,   6.47980860e-03f,
+              5.61111374e-03f,   4.07507829e-02f,   4.69676293e-02f,   3.87619995e-03f,  -1.80341899e-02f,  -5.23321854e-04f,
+              2.40191109e-02f,  -4.53379825e-02f,  -3.26699391e-02f,  -3.40384394e-02f,   3.74500547e-03f,   2.71981508e-02f,
+              3.13474350e-02f,   2.58707837e-03f,  -1.20364949e-02f,  -3.49278824e-04f,   1.60309896e-02f,  -3.02597675e-02f,
+             -2.18047798e-02f,  -2.27181539e-02f,  -1.53415327e-04f,  -1.11418078e-03f,  -1.28415762e-03f,  -1.05980478e-04f,
+              4.93078842e-04f,   1.43083180e-05f,  -6.56714546e-04f,   1.23960094e-03f,   8.93239689e-04f,   9.30656388e-04f,
+              2.05868836e-02f,   1.25787361e-03f,  -1.01354504e-02f,  -2.20236387e-02f,  -1.33199245e-02f,   1.51546672e-02f,
+              2.91286521e-02f,  -2.83966847e-02f,  -6.68757781e-02f,  -3.21594700e-02f,   3.17170215e-03f,  -1.30672865e-02f,
+             -1.40676117e-02f,  -5.88761596e-03f,  -5.02291881e-03f,  -6.21173158e-03f,  -7.24259159e-03f,  -1.03011923e-02f,
+             -2.05270350e-02f,  -6.80523086e-03f,  -1.47320656e-02f,  -2.86444575e-02f,  -1.65926553e-02f,   1.67092625e-02f,
+              1.02198739e-02f,  -3.09809744e-02f,  -5.48402034e-02f,   9.61017422e-03f,   3.05586755e-02f,   4.36501019e-03f,
+             -1.27495769e-02f,  -1.70267038e-02f,  -8.43306910e-03f,   1.22124618e-02f,   6.43298496e-03f,  -2.04525758e-02f,
+             -3.49092111e-02f,   1.07712187e-02f,   2.99711376e-02f,   1.37454709e-02f,  -1.51596991e-02f,  -8.62575695e-03f,
+              8.32380203e-04f,   1.64449289e-02f,   9.95898526e-03f,  -1.67344492e-02f,  -3.08285877e-02f,   1.79283954e-02f,
+              4.44213338e-02f,   1.85928177e-02f,  -3.13723162e-02f,  -6.79877028e-03f,   1.20593412e-02f,   3.58826220e-02f,
+              2.28299182e-02f,  -2.74249576e-02f,  -5.36722355e-02f,   4.19784896e-02f,   1.00297049e-01f,   4.05664705e-02f,
+             -2.79795956e-02f,  -1.14079788e-02f,   5.81407640e-03f,   3.12602520e-02f,   1.94585975e-02f,  -2.79998649e-02f,
+             -5.29992506e-02f,   3.51224840e-02f,   8.55049342e-02f,   3.48024555e-02f,  -1.59664266e-02f,   4.45781508e-03f,
+              1.35702454e-02f,   1.96600668e-02f,   1.32905757e-02f,  -8.82114470e-03f,  -2.01718025e-02f,   2.48777550e-02f,
+              5.70884719e-02f,   2.19692364e-02f,   7.22579705e-03f,   4.23758337e-03f,   3.01982020e-03f,   9.55692260e-04f,
+              5.09735756e-03f,   4.85058594e-03f,   1.36331993e-03f,  -6.08878210e-03f,  -1.52574731e-02f,  -2.98554599e-02f,
+              2.60921195e-02f,  -9.13219620e-03f,  -1.89751852e-02f,  -1.93285309e-02f,  -7.41846906e-03f,   8.41723010e-03f,
+              1.11793820e-02f,  -3.78822386e-02f,  -8.59952420e-02f,  -6.76559508e-02f,   5.76175982e-03f,   6.01490401e-03f,
+             -2.99586300e-02f,  -4.42902558e-02f,  -2.51442641e-02f,   1.15514053e-02f,   1.19223855e-02f,   1.54552078e-02f,
+             -1.06030423e-02f,  -2.64893584e-02f,  -9.86070931e-03f,  -1.52793005e-02f,  -1.40255271e-03f,   2.12540589e-02f,
+              2.15296783e-02f,  -6.26876205e-03f,  -2.39474233e-02f,  -1.49370672e-03f,   1.95367169e-02f,   9.32016037e-03f,
+             -2.10288074e-02f,  -3.39423493e-02f,  -1.73385777e-02f,   3.04690599e-02f,   4.00569923e-02f,  -9.69138928e-03f,
+             -5.20350896e-02f,   3.61226406e-03f,   4.20424975e-02f,   1.00664487e-02f,   6.07318187e-04f,  -4.28590784e-03f,
+             -5.51401861e-02f,  -5.84968738e-02f,  -2.38703992e-02f,   1.45407179e-02f,  -2.24018609e-03f,   2.62578409e-02f,
+              2.54736777e-04f,  -3.83331850e-02f,  -1.28053827e-03f,  -1.25244807e-03f,   7.54946657e-03f,   1.07662892e-02f,
+              5.95207047e-03f,  -2.79569672e-03f,  -2.58977036e-03f,  -3.85714113e-03f,   2.33297376e-03f,   6.49654539e-03f,
+             -1.63463820e-02f,  -1.91574655e-02f,   6.28810152e-02f,   1.02755204e-01f,   6.23085536e-02f,  -2.71042883e-02f,
+             -3.53119113e-02f,  -3.33702005e-02f,   3.06651164e-02f,   6.00325726e-02f,  -2.58294493e-02f,  -3.72360423e-02f,
+              2.57731527e-02f,   8.61663446e-02f,   6.84162751e-02f,  -2.39678975e-02f,  -6.07477203e-02f,  -1.78644024e-02f,
+              5.03976718e-02f,   4.45468612e-02f,  -1.44155230e-02f,  -2.15135943e-02f,   6.64992956e-03f,   4.00809534e-02f,
+              3.50261927e-02f,  -1.13943061e-02f,  -3.44238319e-02f,  -6.30581612e-03f,   2.83313338e-02f,   1.95738282e-02f,
+             -7.48701161e-03f,  -1.31151360e-02f,  -1.70605015e-02f,  -4.25907929e-04f,   9.81733669e-03f,  -6.60045538e-04f,
+             -1.92587562e-02f,   6.44442020e-03f,   1.52560705e-02f,  -3.85980797e-03f,   3.52402520e-03f,   3.98602942e-03f,
+             -1.50778620e-02f,  -2.37281565e-02f,  -1.40539352e-02f,   6.23327447e-03f,   7.51033286e-03f,   7.91506004e-03f,
+             -6.57074852e-03f,  -1.39824916e-02f,   5.43741276e-03f,  -1.12263560e-02f,  -3.05851307e-02f,   4.24634432e-03f,
+              1.91152431e-02f,  -4.74303216e-03f,  -1.98015235e-02f,  -1.84678845e-02f,  -1.41909171e-03f,  -1.05305007e-02f,
+              1.20158885e-02f,  -3.71669568e-02f,  -5.94725236e-02f,   3.10005788e-02f,   4.00648192e-02f,  -5.88430092e-04f,
+             -5.12183644e-03f,  -2.57926527e-02f,   7.65085034e-03f,   1.06504979e-02f,  -1.12060783e-02f,   1.36525435e-02f,
+              2.32596765e-03f,  -6.58393418e-03f,   3.94613110e-02f,   3.73649709e-02f,  -2.61961222e-02f,   9.71663091e-03f,
+              4.31734807e-04f,  -8.37474689e-03f,  -3.32744345e-02f,   1.02973409e-01f,   1.02483496e-01f,  -9.93312821e-02f,
+             -3.61397266e-02f,   2.01643594e-02f,  -7.57554993e-02f,   3.43297645e-02f,  -3.12357079e-02f,  -8.17503482e-02f,
+             -3.74471992e-02f,   8.43114778e-02f,   1.04538716e-01f,  -6.33515716e-02f,  -8.29831790e-03f,   5.73902540e-02f,
+             -3.20741348e-02f,   5.82247153e-02f,  -1.26668606e-02f,  -3.17667797e-02f,  -1.13743469e-02f,   5.74867334e-03f,
+              3.97081003e-02f,   1.44002512e-02f,   1.01717051e-04f,   3.48504223e-02f,   4.50015217e-02f,   3.87904979e-02f,
+              1.26687232e-02f,   4.05992307e-02f,   6.80269813e-03f,  -3.51407006e-02f,  -1.79450884e-02f,   4.36051078e-02f,
+              1.24203358e-02f,   9.02154669e-03f,   5.05149364e-02f,   6.38279039e-03f,   1.76779479e-02f,   5.01483940e-02f,
+              5.89184556e-03f,  -3.86196524e-02f,  -1.94391310e-02f,   5.00843525e-02f,   2.04697344e-02f,   1.71350800e-02f,
+              5.59494905e-02f,   9.95150767e-03f,   2.09624395e-02f,   5.81257306e-02f,   1.92937010e-03f,  -2.17344631e-02f,
+             -9.50379297e-04f,   3.21779102e-02f,   5.76755870e-03f,   1.30513255e-02f,   4.59348522e-02f,   1.39735341e-02f,
+              1.47077199e-02f,   4.35150787e-02f,   5.24868770e-03f,  -1.32992426e-02f,  -5.18805441e-03f,   1.33011322e-02f,
+             -9.31310747e-03f,  -9.39444080e-03f,   2.13898830e-02f,  -1.30230701e-03f,   4.43525566e-03f,   1.56378560e-02f,
+              1.39054805e-02f,  -2.81981416e-02f,  -4.93386462e-02f,   4.90436424e-03f,   5.94786368e-02f,   1.04913618e-02f,
+             -5.66526540e-02f,  -1.48460306e-02f,   1.83748435e-02f,   6.39485568e-02f,  -1.99063253e-02f,  -2.30066981e-02f,
+             -6.11089617e-02f,  -9.89292003e-03f,   1.10507399e-01f,   1.95678741e-01f,   4.30082008e-02f,   3.99685901e-04f,
+             -2.75263693e-02f,   5.33875711e-02f,  -4.86322604e-02f,   3.34407538e-02f,   4.36370596e-02f,  -1.82793960e-02f,
+             -1.56385358e-02f,   1.44035816e-01f,   1.08012207e-01f,   1.84851941e-02f,  -4.48656008e-02f,  -4.98388223e-02f,
+             -6.69074133e-02f,   9.89893377e-02f,   1.94892198e-01f,  -1.58774275e-02f,  -2.18352333e-01f,  -1.13256134e-01f,
+             -1.11425733e-02f,  -2.22517853e-03f,   1.69722736e-02f,  -9.66479331e-02f,  -3.01962774e-02f,   2.77891438e-02f,
+              5.18955067e-02f,  -8.19768663e-03f,  -4.51214164e-02f,   1.02783376e-02f,  -7.74113275e-03f,  -4.81021311e-03f,
+              4.31882450e-03f,  -8.61432869e-03f,  -1.83921009e-02f,  -9.43542807e-04f,  -2.49635112e-02f,  -1.12016574e-02f,
+              5.38272448e-02f,   1.71972364e-01f,   1.35105804e-01f,   2.66247429e-02f,  -5.87559082e-02f,  -3.75330299e-02f,
+             -2.63692867e-02f,   1.40167668e-03f,  -3.84492315e-02f,  -1.82654299e-02f,   7.99526200e-02f,   2.83284426e-01f,
+              2.60344207e-01f,   5.43727912e-02f,  -1.10533014e-01f,  -9.16848257e-02f,  -1.11735733e-02f,  -1.52485408e-02f,
+             -5.81748188e-02f,  -1.09449262e-02f,   9.48329121e-02f,   2.21682981e-01f,   1.70159742e-01f,   3.41517478e-02f,
+             -7.52648041e-02f,  -3.63213271e-02f,  -1.05158426e-02f,   1.22750271e-02f,   1.71248857e-02f,  -4.50113602e-03f,
+             -1.51910800e-02f,   2.96772700e-02f,   4.80609685e-02f,   1.07576447e-02f,  -1.83911026e-02f,  -3.28427032e-02f,
+             -2.13548653e-02f,   5.11218496e-02f,   8.56706500e-02f,  -8.94229021e-03f,  -1.06931582e-01f,  -7.35204853e-03f,
+              1.40920803e-01f,   3.69553752e-02f,  -4.80227247e-02f,  -1.39999241e-01f,   1.06963022e-02f,  -1.31386956e-02f,
+             -5.37533090e-02f,  -3.32481042e-02f,   3.41874436e-02f,  -8.63651105e-04f,  -6.60359487e-02f,   9.60402284e-03f,
+             -2.91114952e-03f,   1.75272301e-03f,  -2.00212114e-02f,  -3.50561854e-03f,   2.36450043e-02f,   5.35571715e-03f,
+              1.70879364e-02f,   5.27547933e-02f,   6.49817213e-02f,   7.86145404e-03f,  -2.43218951e-02f,  -2.61831023e-02f,
+             -2.50314362e-02f,   3.82392295e-02f,   1.46316305e-01f,   9.29728076e-02f,  -1.01624183e-01f,  -1.16142677e-02f,
+              1.70168281e-01f,  -2.93647163e-02f,   1.47507181e-02f,   2.00492330e-03f,  -8.75468180e-03f,   4.64324728e-02f,
+              1.41730219e-01f,   9.94347110e-02f,  -1.30934507e-01f,  -6.42271638e-02f,   1.28487706e-01f,  -4.06693220e-02f,
+              4.01851237e-02f,   2.76463050e-02f,  -4.01144242e-03f,  -1.21939899e-02f,  -2.67413091e-02f,  -2.21885517e-02f,
+              3.65833528e-02f,   3.14842425e-02f,  -1.09559326e-02f,   1.21423053e-02f,  -1.70487352e-02f,  -1.46125620e-02f,
+             -8.04469734e-03f,  -2.32507754e-02f,  -5.03312685e-02f,  -4.20615785e-02f,   6.98928386e-02f,   6.09493367e-02f,
+             -1.94604825e-02f,   2.32439395e-02f,  -3.29150259e-02f,  -2.83236280e-02f,  -2.07639318e-02f,  -5.72545035e-03f,
+              1.87976342e-02f,   1.32419693e-03f,   2.37520244e-02f,   5.85151538e-02f,   6.30322844e-02f,   1.00747654e-02f,
+             -2.74383295e-02f,  -2.88577415e-02f,  -4.98567987e-03f,  -1.93128958e-02f,  -4.46241908e-02f,  -3.59929204e-02f,
+              5.74645922e-02f,   4.66970019e-02f,  -2.22906172e-02f,   1.89142246e-02f,  -2.55941432e-02f,  -2.15500444e-02f,
+             -2.09782203e-03f,   7.33005814e-04f,   5.49162785e-03f,   2.78847851e-03f,  -1.38456922e-03f,   3.52509436e-03f,
+              9.10445768e-03f,  -1.88088161e-04f,  -1.38262950e-03f,  -1.84661720e-03f,  -1.54234385e-02f,  -9.87751223e-03f,
+             -1.44466385e-03f,  -1.04019586e-02f,   3.38732116e-02f,   5.37016913e-02f,   3.50852944e-02f,   1.26557183e-02f,
+             -2.63406187e-02f,  -2.60200296e-02f,   1.10236462e-03f,   1.03763063e-02f,   1.19009223e-02f,  -3.42610735e-03f,
+             -1.88450422e-02f,  -2.79334728e-02f,  -4.19748388e-02f,  -1.46250585e-02f,   6.03224942e-03f,  -1.88196055e-03f,
+             -8.82038265e-04f,  -2.88868137e-02f,  -5.24918316e-03f,   5.18572591e-02f,  -1.00432124e-04f,   5.13050705e-03f,
+              1.19003788e-01f,   2.31501386e-02f,  -2.95417812e-02f,  -1.42998135e-04f,   5.61817957e-04f,  -3.23169008e-02f,
+              1.38717797e-02f,   8.79826695e-02f,  -3.73344645e-02f,  -4.56950441e-02f,   1.34656474e-01f,   1.34607349e-02f,
+             -4.20772880e-02f,  -3.97132430e-03f,  -3.60970444e-04f,  -4.39274311e-02f,   4.51663695e-03f,   9.78288203e-02f,
+             -2.37158537e-02f,  -2.47584954e-02f,   1.81929410e-01f,   2.73298547e-02f,  -5.06382957e-02f,  -2.63019302e-03f,
+             -1.71406695e-03f,  -3.44869867e-02f,  -1.46948528e-02f,   4.91185896e-02f,   1.57687180e-02f,   2.80805677e-02f,
+              1.41424954e-01f,   3.29475775e-02f,  -3.14153880e-02f,   1.45618967e-03f,  -1.38749578e-03f,  -1.31241092e-02f,
+             -1.49658732e-02f,   4.46482282e-03f,   2.36722492e-02f,   3.51050980e-02f,   5.30970879e-02f,   1.84434447e-02f,
+             -7.66927283e-03f,   2.36361660e-03f,   6.52129995e-04f,   1.09833246e-03f,   8.08653608e-03f,   9.99907032e-03f,
+             -1.48647521e-02f,  -2.07409635e-02f,  -3.91682191e-03f,  -5.84876025e-03f,  -2.48290738e-03f,  -1.51702564e-03f,
+              7.96357577e-04f,  -9.37569700e-03f,   1.20997280e-02f,   3.77819389e-02f,  -2.60549933e-02f,  -3.42934318e-02f,
+              3.96886431e-02f,  -1.18199596e-03f,  -1.58996098e-02f,  -2.71096779e-03f,  -1.93302531e-03f,  -1.73112750e-02f,
+             -2.10520588e-02f,   3.89883365e-03f,   3.36970314e-02f,   4.97214645e-02f,   6.99362978e-02f,   2.51538642e-02f,
+             -9.51648876e-03f,   3.37086408e-03f,  -2.17196555e-03f,  -1.45613011e-02f,  -2.46693753e-02f,  -7.28669623e-03f,
+              4.14680615e-02f,   5.99581115e-02f,   5.82900010e-02f,   2.55436171e-02f,  -4.82173823e-03f,   4.17921040e-03f,
+              1.25451963e-02f,  -1.33373998e-02f,  -2.09279675e-02f,  -6.26153313e-03f,  -6.00795820e-02f,  -6.08824380e-02f,
+             -1.27356751e-02f,  -1.28345182e-02f,  -3.06440680e-03f,  -2.34902278e-03f,   3.13274153e-02f,  -3.93258892e-02f,
+             -7.73365200e-02f,  -3.00717279e-02f,  -8.13093260e-02f,  -6.88978285e-02f,   3.36951651e-02f,  -1.30984867e-02f,
+             -5.31691033e-03f,  -5.43844607e-03f,   1.06776441e-02f,  -1.84110273e-02f,  -2.01566014e-02f,   1.48922310e-03f,
+             -4.25088257e-02f,  -5.03495894e-02f,  -7.36067863e-03f,  -1.89522337e-02f,  -9.56953876e-03f,   3.28559591e-03f,
+              4.41392660e-02f,  -6.51735291e-02f,  -1.31506845e-01f,  -4.98742796e-02f,  -5.13100065e-02f,  -2.65615359e-02f,
+              1.04584381e-01f,  -7.98498467e-03f,  -1.02024730e-02f,  -3.76403308e-03f,   5.02034947e-02f,  -7.24106431e-02f,
+             -1.54101297e-01f,  -6.28577992e-02f,  -4.69044559e-02f,  -1.24825044e-02f,   1.31918386e-01f,  -1.43114303e-03f,
+             -8.08385946e-03f,  -6.46771444e-03f,   3.34417149e-02f,  -2.98788976e-02f,  -9.28655639e-02f,  -5.63634336e-02f,
+             -6.34873137e-02f,  -2.52277944e-02f,   6.88295811e-02f,   1.57976896e-02f,   1.13937734e-02f,  -1.73981935e-02f,
+             -2.98431087e-02f,   5.37842922e-02f,   1.06636308e-01f,   3.70522700e-02f,  -1.57305170e-02f,  -3.54977883e-02f,
+             -1.14779018e-01f,   2.48222204e-04f,   1.12869628e-02f,  -2.16929335e-03f,  -1.36083364e-02f,   1.42140575e-02f,
+              5.02864979e-02f,   3.13178897e-02f,  -8.09222460e-03f,  -3.20825353e-02f,  -6.10351451e-02f,  -1.72984041e-02f,
+             -6.84443302e-03f,   7.62952585e-03f,  -2.26160008e-02f,   2.14851787e-03f,   4.20401022e-02f,   4.26020697e-02f,
+              1.04268961e-01f,   7.32160807e-02f,   2.36489368e-03f,  -1.47130471e-02f,  -2.02199183e-02f,   2.26749685e-02f,
+             -2.15334613e-02f,   7.85643049e-03f,   5.33195250e-02f,   4.49207872e-02f,   6.19643964e-02f,   2.81861033e-02f,
+             -3.14001106e-02f,  -2.01022699e-02f,  -1.75947454e-02f,   1.92479659e-02f,  -1.67944133e-02f,  -2.44617090e-03f,
+             -2.42758151e-02f,  -1.84871461e-02f,  -2.79553439e-02f,  -2.86252052e-02f,  -9.26064909e-04f,   1.50352130e-02f,
+              1.99074913e-02f,   4.10552733e-02f,  -5.09794056e-03f,   3.04800039e-03f,  -1.86795392e-03f,  -5.07885963e-03f,
+             -2.25931834e-02f,  -2.67018881e-02f,  -9.88492463e-03f,   7.39508355e-03f,   1.05346730e-02f,   2.83818934e-02f,
+              1.15956916e-02f,   1.28226727e-02f,   3.29188816e-02f,   1.43297222e-02f,  -2.21349224e-02f,  -3.31434272e-02f,
+             -2.75693275e-02f,  -2.06529023e-03f,  -5.51737845e-04f,   1.84130371e-02f,   1.23481895e-03f,   2.75680656e-03f,
+              5.52465953e-03f,   1.72157050e-03f,  -7.53527833e-03f,  -1.01410449e-02f,  -6.46095211e-03f,   8.19249370e-04f,
+              1.58995879e-03f,   7.80412043e-03f,  -2.25361809e-02f,  -1.79958846e-02f,  -5.39279990e-02f,  -2.68761851e-02f,
+              1.72464233e-02f,   3.15066837e-02f,   3.60356607e-02f,   9.18610767e-03f,   9.27829463e-03f,  -6.70218980e-03f,
+             -1.12622930e-02f,  -7.14680552e-03f,  -2.42704079e-02f,  -1.31715797e-02f,   1.74657570e-03f,   6.97059184e-03f,
+              1.33301923e-02f,   5.96984569e-03f,   6.82485942e-03f,   4.40563122e-03f,   3.30132432e-02f,   2.47195698e-02f,
+              7.66153187e-02f,   3.91399860e-02f,  -1.91509835e-02f,  -3.83484811e-02f,  -4.86268960e-02f,  -1.46835800e-02f,
+             -1.55382371e-02f,   2.91942572e-03f,   1.65240131e-02f,   9.05836280e-03f,   3.35379764e-02f,   1.91246346e-02f,
+              2.74988380e-03f,  -3.44412285e-03f,  -1.59414858e-02f,  -9.82508156e-03f,  -1.17048984e-02f,  -1.24588273e-02f,
+              1.39663070e-02f,   7.36358017e-03f,   2.79220007e-02f,   1.61232390e-02f,   3.41345044e-03f,  -1.52027339e-03f,
+             -1.27324453e-02f,  -8.52287374e-03f,  -1.02399336e-02f,  -1.17594935e-02f,  -1.75709312e-03f,   3.42349173e-03f,
+              2.79988442e-03f,  -1.41690520e-03f,  -1.66185908e-02f,  -2.04795618e-02f,  -9.41917859e-03f,   4.32119425e-03f,
+              6.44288165e-03f,   1.97482593e-02f,   2.31248010e-02f,   1.31662488e-02f,  -2.24364884e-02f,  -5.10361344e-02f,
+             -6.92789853e-02f,  -4.56404164e-02f,   9.60505847e-03f,   4.91231270e-02f,   1.34862754e-02f,   1.01762246e-02f,
+              7.16347843e-02f,   4.01910283e-02f,  -1.86644197e-02f,  -9.50295385e-03f,  -2.23032571e-02f,  -3.71348560e-02f,
+              1.49437264e-02f,   3.29832733e-02f,   3.77791598e-02f,   2.83454601e-02f,   8.99785161e-02f,   5.02909608e-02f,
+             -7.03831762e-03f,   3.60151529e-02f,   3.40427980e-02f,  -1.30032143e-02f,   1.39910979e-02f,   2.96731014e-03f,
+              4.61632460e-02f,   3.45784500e-02f,   8.44321325e-02f,   4.71084267e-02f,   4.51281812e-04f,   5.44182807e-02f,
+              5.86341470e-02f,   2.26668641e-03f,   1.10731684e-02f,  -1.37574850e-02f,   4.27628234e-02f,   3.20059359e-02f,
+              7.99209774e-02f,   4.44470197e-02f,   1.27744945e-02f,   8.76005590e-02f,   1.02207601e-01f,   2.74647344e-02f,
+              6.88447803e-03f,  -4.19701748e-02f,   3.95070389e-02f,   2.95240413e-02f,   5.63751087e-02f,   3.14738378e-02f,
+             -1.37979386e-03f,   3.14212404e-02f,   3.27907130e-02f,  -1.93379459e-03f,   7.88327120e-03f,  -5.24454052e-03f,
+              2.86848266e-02f,   2.14753635e-02f,   4.48944494e-02f,   2.51919907e-02f,  -1.20180808e-02f,  -6.89342245e-03f,
+             -1.51914069e-02f,  -2.39308178e-02f,   9.45889670e-03f,   2.14232542e-02f,   2.37019192e-02f,   1.77845228e-02f,
+             -1.53551577e-03f,  -7.14240305e-04f,  -1.21895894e-02f,  -3.65944542e-02f,  -4.71448712e-02f,  -2.50201002e-02f,
+              3.34733399e-03f,   2.88089011e-02f,   1.80242074e-04f,   1.79389492e-04f,  -1.86674222e-02f,  -1.03154229e-02f,
+             -8.64513405e-03f,  -3.70086506e-02f,  -4.52881865e-02f,  -1.80240776e-02f,   4.12490554e-05f,   2.30759028e-02f,
+             -8.78258981e-03f,  -6.54214155e-03f,  -4.21204045e-02f,  -2.34488491e-02f,  -4.66985442e-03f,  -4.01389077e-02f,
+             -4.60637063e-02f,  -1.02450307e-02f,  -4.22918843e-03f,   1.72836129e-02f,  -2.09834296e-02f,  -1.56888645e-02f,
+              4.86496873e-02f,  -2.26438534e-03f,  -3.96498330e-02f,  -2.66675856e-02f,   8.21395684e-03f,  -4.42389362e-02f,
+             -3.85241956e-02f,   6.35271892e-03f,   2.58162264e-02f,   5.81237487e-03f,   5.37737086e-02f,  -3.99818458e-03f,
+             -4.61255908e-02f,  -2.81873904e-02f,   1.18086198e-02f,  -4.90827374e-02f,  -4.34148945e-02f,   6.66012196e-03f,
+              3.41084488e-02f,   8.73867329e-03f,   2.82364320e-02f,  -4.76026675e-03f,  -2.83125527e-02f,  -1.25074843e-02f,
+              1.10577615e-02f,  -2.61012428e-02f,  -2.42795870e-02f,   2.85358937e-03f,   2.78274175e-02f,   8.70652031e-03f,
+              2.34275218e-02f,  -5.56760514e-03f,  -2.59791054e-02f,  -8.98258667e-03f,   1.21281268e-02f,  -2.18554493e-02f,
+             -2.10460965e-02f,   1.97621062e-03f,   2.91188005e-02f,   9.72780120e-03f,   4.70368043e-02f,  -1.00899795e-02f,
+             -5.04858606e-02f,  -1.89730898e-02f,   2.23635305e-02f,  -4.37462777e-02f,  -4.16490361e-02f,   4.23103105e-03f,
+              5.44068478e-02f,   1.78466402e-02f,   3.77153791e-02f,  -1.14208935e-02f,  -4.56029102e-02f,  -1.23422621e-02f,
+              2.40111388e-02f,  -3.54875326e-02f,  -3.52509692e-02f,   2.58695288e-03f,   5.60378693e-02f,   1.94641165e-02f,
+              7.72687644e-02f,  -1.90015398e-02f,  -8.66662711e-02f,  -2.90760752e-02f,   4.11664471e-02f,  -7.21624494e-02f,
+             -6.97700530e-02f,   6.36351667e-03f,   9.84192789e-02f,   3.30723152e-02f,   4.94870134e-02f,  -1.09284921e-02f,
+             -5.35969697e-02f,  -1.96916927e-02f,   2.40996685e-02f,  -4.60636579e-02f,  -4.39929366e-02f,   4.37574089e-03f,
+              5.84072284e-02f,   1.92605536e-02f,   3.42314243e-02f,  -3.08921677e-03f,  -3.01994532e-02f,  -1.74746495e-02f,
+              8.51025898e-03f,  -3.13123018e-02f,  -2.79403049e-02f,   4.10812348e-03f,   2.37405468e-02f,   6.40484039e-03f,
+              2.90766153e-02f,  -8.73827259e-04f,  -2.29601599e-02f,  -1.63518619e-02f,   4.03391710e-03f,  -2.63813119e-02f,
+             -2.27576979e-02f,   3.91284376e-03f,   1.36423949e-02f,   2.73177843e-03f,   4.24389429e-02f,   2.46174950e-02f,
+              1.04088821e-02f,  -1.72219332e-02f,  -3.19015756e-02f,  -3.61697860e-02f,  -4.50509191e-02f,  -1.03634186e-02f,
+              6.01023901e-04f,  -1.09157739e-02f,   7.96318706e-03f,   1.71587779e-03f,   6.61120052e-03f,  -1.79425751e-05f,
+             -4.57152445e-03f,  -3.45349521e-03f,  -4.07725805e-03f,  -1.29482606e-02f,  -6.72416342e-03f,  -8.67958367e-03f,
+             -2.15490498e-02f,  -1.32284071e-02f,  -4.11649561e-03f,   9.55103710e-03f,   1.65534392e-02f,   1.92021709e-02f,
+              2.39733309e-02f,   2.50121392e-03f,  -2.02066242e-03f,   3.87875689e-03f,  -5.34562918e-04f,  -1.07717537e-03f,
+              1.09961512e-03f,   1.06599031e-03f,   7.75547815e-04f,   1.33631029e-03f,   1.72366679e-03f,  -2.77677178e-03f,
+             -1.81397493e-03f,  -1.61459309e-03f,   4.33609774e-03f,  -2.73679523e-03f,   9.48987901e-03f,   4.05363925e-03f,
+             -7.00770295e-04f,   2.33439775e-03f,   3.31317447e-03f,  -2.09642556e-02f,  -1.23064499e-02f,  -1.31112691e-02f,
+             -6.31588511e-03f,  -1.98231563e-02f,   2.43773013e-02f,   2.04492956e-02f,   1.26203168e-02f,   2.39359476e-02f,
+              3.10611017e-02f,  -5.97028658e-02f,  -3.81430276e-02f,  -3.52848545e-02f,   2.75068288e-03f,  -4.65421379e-03f,
+              1.07018538e-02f,   5.80139691e-03f,   9.77090443e-04f,   4.83117113e-03f,   6.50005881e-03f,  -2.43586879e-02f,
+             -1.46785220e-02f,  -1.49824526e-02f,   1.07394597e-02f,   1.92173868e-02f,  -1.82035826e-02f,  -1.87337343e-02f,
+             -1.44003220e-02f,  -2.40645185e-02f,  -3.09763048e-02f,   4.66016084e-02f,   3.07366196e-02f,   2.69025881e-02f,
+              3.38727864e-03f,   1.69729386e-02f,  -2.32482441e-02f,  -1.79863907e-02f,  -9.85791441e-03f,  -2.01179869e-02f,
+             -2.62167603e-02f,   5.60540780e-02f,   3.53900976e-02f,   3.34081985e-02f,  -4.98483947e-04f,   4.67851199e-03f,
+             -8.09240621e-03f,  -5.29621355e-03f,  -2.04544817e-03f,  -5.27863065e-03f,  -6.95837475e-03f,   1.89493820e-02f,
+              1.16911614e-02f,   1.14746904e-02f,   1.95485521e-02f,   8.75360623e-04f,  -1.66357961e-02f,  -2.55561080e-02f,
+             -2.04132684e-02f,  -2.60922890e-02f,  -1.07902912e-02f,   2.35431083e-02f,   2.17161123e-02f,   1.37851974e-02f,
+             -2.62760390e-02f,   8.57577106e-05f,   1.49482824e-02f,   3.50013003e-02f,   3.32430750e-02f,   4.80448902e-02f,
+              1.76337603e-02f,  -3.38309295e-02f,  -2.75595803e-02f,  -1.63123515e-02f,  -3.69968042e-02f,   4.60088486e-03f,
+             -5.26002748e-03f,   5.15897647e-02f,   6.74074292e-02f,   1.13689110e-01f,   3.59370522e-02f,  -5.53909652e-02f,
+             -3.30192856e-02f,  -1.51000498e-02f,  -4.55752481e-03f,  -3.82052688e-03f,   2.51141600e-02f,   4.09526611e-03f,
+             -1.18703656e-02f,  -3.10825054e-02f,  -6.45144144e-03f,   7.72643078e-04f,  -9.73242149e-03f,  -9.56491567e-03f,
+             -4.78713661e-02f,  -5.20668132e-03f,   5.87247126e-02f,   6.10051379e-02f,   3.59040722e-02f,   3.24174017e-02f,
+              1.88288093e-02f,  -5.23500852e-02f,  -5.71344085e-02f,  -3.91370207e-02f,  -6.85110241e-02f,  -4.57946723e-03f,
+              6.71790466e-02f,   8.87868181e-02f,   6.45906553e-02f,   7.59098604e-02f,   3.40681821e-02f,  -7.98933804e-02f,
+             -7.80593976e-02f,  -5.09670824e-02f,  -7.54107162e-03f,   9.06117202e-04f,  -8.86113092e-04f,   1.04992399e-02f,
+              1.35939931e-02f,   2.28476916e-02f,   7.24650361e-03f,  -1.12355044e-02f,  -6.77124131e-03f,  -3.13348812e-03f,
+              3.58165316e-02f,   4.25953278e-03f,  -4.60741222e-02f,  -4.54555005e-02f,  -2.51891017e-02f,  -2.05135383e-02f,
+             -1.31848827e-02f,   3.85372341e-02f,   4.32169549e-02f,   2.99208593e-02f,   4.24541160e-02f,   4.81252093e-03f,
+             -5.32245487e-02f,  -5.40011674e-02f,  -3.09442133e-02f,  -2.67445538e-02f,  -1.62144806e-02f,   4.60883193e-02f,
+              5.09207658e-02f,   3.50506976e-02f,   3.02053131e-02f,   1.23700849e-03f,  -2.50261854e-02f,  -3.95473652e-02f,
+             -3.20727527e-02f,  -4.15038019e-02f,  -1.69590525e-02f,   3.65775339e-02f,   3.34053077e-02f,   2.10971814e-02f,
+              4.52460013e-02f,   5.70972962e-03f,  -4.00954522e-02f,  -2.35437229e-02f,  -1.17516192e-03f,  -4.27401178e-02f,
+             -6.82091713e-02f,  -3.40808332e-02f,  -8.98123626e-03f,  -1.84472054e-02f,  -8.08016434e-02f,   1.12166684e-02f,
+              7.19237104e-02f,   4.66930382e-02f,   6.26848731e-03f,   8.87149274e-02f,   1.81613117e-02f,  -3.02503258e-02f,
+             -3.69197282e-04f,   6.18246794e-02f,  -1.02286682e-01f,   1.10946875e-02f,   7.12397173e-02f,   5.61989024e-02f,
+              3.52214910e-02f,   1.25389367e-01f,   7.86556825e-02f,  -2.16022017e-03f,   1.71430912e-02f,   7.86134452e-02f,
+             -8.31996724e-02f,  -6.21083239e-03f,   1.12916462e-01f,   4.86502014e-02f,  -5.22205196e-02f,   5.16115762e-02f,
+              2.42139455e-02f,  -9.62063670e-04f,  -1.69257447e-02f,   3.07234544e-02f,  -8.05232599e-02f,   6.24224253e-04f,
+              8.65169838e-02f,   4.59383391e-02f,  -1.69765949e-02f,   7.10090026e-02f,   3.83398309e-02f,  -2.63878657e-03f,
+             -3.84134101e-03f,   4.39339243e-02f,  -2.77597681e-02f,   4.72224085e-03f,   3.53686996e-02f,   1.74346603e-02f,
+             -1.27023179e-02f,   2.29642615e-02f,  -1.98578145e-02f,  -2.64384355e-02f,  -8.99792742e-03f,   1.99677702e-02f,
+              3.08678132e-02f,  -8.67302122e-04f,  -1.34630883e-02f,  -1.55161321e-02f,  -2.14343183e-02f,  -4.24274243e-02f,
+             -5.21924533e-02f,  -1.91821381e-02f,  -1.32391229e-02f,  -2.22139694e-02f,   8.73036310e-02f,  -1.28368603e-03f,
+             -6.85038492e-02f,  -4.70749736e-02f,  -1.74290743e-02f,  -9.63964090e-02f,  -9.06722173e-02f,  -2.39134114e-02f,
+             -1.48758087e-02f,  -5.42617626e-02f,   6.73698038e-02f,  -7.37805804e-03f,  -4.88892831e-02f,  -3.72525863e-02f,
+             -2.04357076e-02f,  -8.11457038e-02f,  -4.74182703e-02f,   4.00542887e-03f,  -9.72076226e-03f,  -5.14214709e-02f,
+              5.51960953e-02f,  -1.25475246e-02f,  -3.90920676e-02f,  -3.18125784e-02f,  -1.95054561e-02f,  -7.10430369e-02f,
+             -9.55431815e-03f,   2.97206119e-02f,  -3.79857072e-03f,  -5.11434823e-02f,  -1.20538816e-01f,  -1.76401306e-02f,
+              1.30417058e-02f,  -2.59594433e-02f,  -7.33162556e-03f,   4.82173190e-02f,  -4.06343192e-02f,  -1.18873663e-01f,
+             -5.46728782e-02f,   5.21313287e-02f,  -1.53001353e-01f,  -3.56730446e-02f,   2.26246323e-02f,  -4.15513776e-02f,
+             -4.14122008e-02f,   5.54165654e-02f,  -4.19284515e-02f,  -1.45716757e-01f,  -9.15277228e-02f,   3.87141220e-02f,
+             -1.02956004e-01f,  -3.00184637e-02f,   1.79729071e-02f,  -3.18544358e-02f,  -4.24032137e-02f,   3.46704945e-02f,
+             -2.38452144e-02f,  -9.57128927e-02f,  -7.16099367e-02f,   1.36195673e-02f,  -7.34382272e-02f,  -4.04759981e-02f,
+              2.15331893e-02f,  -3.50662991e-02f,  -7.63278231e-02f,   1.64253842e-02f,  -3.15930508e-03f,  -6.08498342e-02f,
+             -8.28434080e-02f,  -2.96938233e-02f,  -1.15647651e-01f,  -5.46309650e-02f,   2.97463294e-02f,  -4.93225716e-02f,
+             -9.81794521e-02f,   2.98343115e-02f,  -1.15926331e-02f,  -9.93702486e-02f,  -1.15281075e-01f,  -2.79305782e-02f,
+             -4.97389622e-02f,  -3.10270954e-02f,   1.62355844e-02f,  -2.60896776e-02f,  -6.04297593e-02f,   9.55073256e-03f,
+              4.85065044e-04f,  -3.98063287e-02f,  -6.21291585e-02f,  -2.75802985e-02f,  -6.15414642e-02f,  -3.59330662e-02f,
+              1.89654045e-02f,  -3.06898467e-02f,  -6.88313693e-02f,   1.28871249e-02f,  -1.18435256e-03f,  -5.02082482e-02f,
+             -7.27788508e-02f,  -2.90469378e-02f,  -4.25136015e-02f,  -4.24820818e-02f,   2.11726222e-02f,  -3.26358601e-02f,
+             -9.02354941e-02f,   1.20960595e-03f,   1.20106777e-02f,  -2.78095081e-02f,  -7.97000378e-02f,  -5.65705523e-02f,
+             -3.80606800e-02f,  -3.63575257e-02f,   1.81894470e-02f,  -2.81329565e-02f,  -7.67354295e-02f,   1.81257748e-03f,
+              9.53586958e-03f,  -2.55487897e-02f,  -6.85613900e-02f,  -4.71828878e-02f,   3.00993659e-02f,  -9.81517881e-03f,
+              3.24267009e-03f,  -2.72577582e-03f,  -3.25422511e-02f,  -1.82349943e-02f,   2.04771422e-02f,   3.52196619e-02f,
+             -1.00412061e-02f,  -4.24129926e-02f,  -3.77023862e-05f,  -2.83801019e-05f,  -1.72610526e-04f,  -7.18054289e-05f,
+             -1.68948856e-04f,  -2.15567052e-04f,  -2.12233819e-04f,  -1.66130179e-04f,   4.63350443e-06f,  -3.21340030e-06f,
+             -1.09001878e-03f,  -8.20501009e-04f,  -4.99036629e-03f,  -2.07597646e-03f,  -4.88450332e-03f,  -6.23228820e-03f,
+             -6.13592099e-03f,  -4.80301213e-03f,   1.33959882e-04f,  -9.29030575e-05f,   5.43204090e-03f,   4.08891588e-03f,
+              2.48691812e-02f,   1.03455000e-02f,   2.43416186e-02f,   3.10582221e-02f,   3.05779818e-02f,   2.39355136e-02f,
+             -6.67580753e-04f,   4.62976604e-04f,   1.39829488e-02f,   1.05255283e-02f,   6.40172809e-02f,   2.66309846e-02f,
+              6.26592487e-02f,   7.99488723e-02f,   7.87126496e-02f,   6.16138689e-02f,  -1.71846035e-03f,   1.19177636e-03f,
+              7.10457144e-03f,   5.34789683e-03f,   3.25264260e-02f,   1.35308895e-02f,   3.18364277e-02f,   4.06210758e-02f,
+              3.99929695e-02f,   3.13052796e-02f,  -8.73129466e-04f,   6.05527544e-04f,   7.04395818e-03f,   5.30227087e-03f,
+              3.22489254e-02f,   1.34154493e-02f,   3.15648131e-02f,   4.02745157e-02f,   3.96517664e-02f,   3.10381968e-02f,
+             -8.65680282e-04f,   6.00361440e-04f,   5.38498955e-03f,   4.05349815e-03f,   2.46537682e-02f,   1.02558890e-02f,
+              2.41307765e-02f,   3.07892002e-02f,   3.03131193e-02f,   2.37281863e-02f,  -6.61798229e-04f,   4.58966359e-04f,
+             -4.08821926e-03f,  -3.07736709e-03f,  -1.87168438e-02f,  -7.78614730e-03f,  -1.83197949e-02f,  -2.33747903e-02f,
+             -2.30133552e-02f,  -1.80141535e-02f,   5.02429262e-04f,  -3.48441739e-04f,  -7.94223684e-04f,  -5.97844075e-04f,
+             -3.63614573e-03f,  -1.51262502e-03f,  -3.55901034e-03f,  -4.54105111e-03f,  -4.47083451e-03f,  -3.49963317e-03f,
+              9.76075899e-05f,  -6.76922282e-05f,   1.48088429e-02f,   1.11472113e-02f,   6.77984208e-02f,   2.82039270e-02f,
+              6.63601831e-02f,   8.46709982e-02f,   8.33617672e-02f,   6.52530491e-02f,  -1.81996019e-03f,   1.26216793e-03f,
+             -3.44756735e-03f,  -4.38582571e-03f,  -3.43763921e-03f,   3.44041944e-03f,  -4.95430501e-03f,  -8.90988391e-03f,
+             -6.95126457e-03f,   3.27635277e-03f,   5.08081540e-03f,   4.40401630e-03f,  -7.42834806e-03f,   3.13211116e-03f,
+             -5.86271472e-03f,  -8.81072879e-03f,  -1.93680376e-02f,  -1.49169080e-02f,  -6.31169230e-03f,   1.19060110e-02f,
+              6.80778595e-03f,  -3.44686443e-03f,   8.77764542e-03f,  -3.65822501e-02f,   2.89200712e-03f,   5.28090224e-02f,
+              4.56042625e-02f,   6.43902319e-03f,  -1.51888598e-02f,  -2.67343577e-02f,   2.77396245e-03f,   3.78791615e-02f,
+              1.73162278e-02f,  -3.91292907e-02f,   9.76021867e-03f,   6.15785792e-02f,   6.71393573e-02f,   2.39437334e-02f,
+             -7.20843859e-03f,  -4.00141440e-02f,  -5.39782224e-03f,   4.07583676e-02f,   1.08690083e-03f,   1.31073436e-02f,
+              2.52277497e-03f,  -1.62027050e-02f,  -6.53882651e-03f,   6.79814443e-03f,   1.02668731e-02f,   3.48336413e-03f,
+             -5.45935985e-03f,  -1.34429047e-02f,  -1.25672901e-02f,   5.04333824e-02f,  -4.37904615e-03f,  -7.31035694e-02f,
+             -6.39510304e-02f,  -9.88001563e-03f,   2.04083472e-02f,   3.75282317e-02f,  -3.33237532e-03f,  -5.22355624e-02f,
+             -6.67016162e-03f,   1.85892247e-02f,  -3.32798855e-03f,  -2.82544605e-02f,  -2.82916576e-02f,  -8.02653469e-03f,
+              5.19882794e-03f,   1.67679656e-02f,   9.22177453e-04f,  -1.93156693e-02f,  -5.57373837e-03f,  -6.43246633e-04f,
+             -4.76637809e-03f,  -2.75124959e-03f,  -1.24643147e-02f,  -1.22111132e-02f,  -6.79756794e-03f,   7.78044295e-03f,
+              6.09296700e-03f,   4.91283427e-04f,   1.75910704e-02f,  -2.75874175e-02f,   1.14079313e-02f,   4.68727536e-02f,
+              5.98014221e-02f,   2.84620523e-02f,   1.05439918e-03f,  -3.59641351e-02f,  -9.48525220e-03f,   2.89001968e-02f,
+              1.64574273e-02f,  -3.10421586e-02f,   1.00305425e-02f,   5.05991131e-02f,   5.95628470e-02f,   2.48475149e-02f,
+             -2.61751050e-03f,  -3.56620252e-02f,  -7.15239532e-03f,   3.24175358e-02f,  -7.00555369e-02f,  -2.11482085e-02f,
+             -3.61917503e-02f,  -7.22953677e-02f,  -4.31794859e-02f,   8.02880898e-03f,   3.37342881e-02f,   3.84114087e-02f,
+              3.33281830e-02f,   4.81968746e-02f,  -5.51439635e-02f,  -1.40181836e-02f,  -1.79016162e-02f,  -5.25340997e-02f,
+             -4.27845456e-02f,  -6.31614355e-03f,   2.40642410e-02f,   3.40985134e-02f,   2.43666954e-02f,   3.44994664e-02f,
+              5.26338890e-02f,   1.05586164e-02f,   3.13444845e-02f,   7.93268308e-02f,   2.74668653e-02f,  -3.40586901e-02f,
+             -4.35088128e-02f,  -2.37286780e-02f,  -2.12691240e-02f,  -2.35930514e-02f,   6.16445802e-02f,  -4.96633118e-03f,
+             -5.61356246e-02f,   3.36092934e-02f,   1.10681564e-01f,   9.16744396e-02f,  -1.36687076e-02f,  -6.49216473e-02f,
+             -1.25818681e-02f,  -1.00346962e-02f,   8.27443413e-03f,  -1.74412243e-02f,  -9.23272297e-02f,  -4.61803712e-02f,
+              8.63320008e-02f,   1.29027650e-01f,   2.96646543e-02f,  -4.20868173e-02f,   1.02395648e-02f,   1.67999957e-02f,
+             -3.35838529e-03f,  -6.40363619e-03f,  -4.12926190e-02f,  -3.60345691e-02f,   3.18586044e-02f,   6.36724010e-02f,
+              2.28936151e-02f,  -1.51119186e-02f,   5.43814478e-03f,   5.42829791e-03f,   2.00877711e-02f,   1.66371055e-02f,
+              4.91848290e-02f,   3.33265923e-02f,  -1.96373779e-02f,  -4.52217385e-02f,  -1.62659213e-02f,   2.61407276e-03f,
+             -1.70658380e-02f,  -2.84831133e-02f,   4.93500456e-02f,   2.05771830e-02f,   5.28766327e-02f,   6.63361922e-02f,
+              7.39903050e-03f,  -4.23964784e-02f,  -3.32265124e-02f,  -1.64309274e-02f,  -2.75156181e-02f,  -4.03884314e-02f,
+              6.42601326e-02f,   1.26711270e-02f,   1.24996817e-02f,   6.35815710e-02f,   5.64240739e-02f,   1.15799597e-02f,
+             -3.03676520e-02f,  -4.18840051e-02f,  -2.57954672e-02f,  -3.39995362e-02f,  -1.46540720e-02f,  -7.55067682e-03f,
+             -1.61172561e-02f,  -1.49733443e-02f,  -2.17178953e-03f,   8.23666435e-03f,   6.35150168e-03f,   5.48708066e-03f,
+              9.19052213e-03f,   1.50639163e-02f,  -1.10155856e-02f,  -5.61331352e-03f,   4.89936164e-03f,  -9.17922705e-03f,
+              6.69088494e-03f,   2.97115576e-02f,   1.88797172e-02f,   1.55563967e-03f,   6.87278109e-04f,  -8.26221425e-04f,
+             -1.81671474e-02f,   4.94462112e-03f,   2.02883556e-02f,  -5.06921962e-04f,  -6.36755079e-02f,  -4.58487347e-02f,
+              3.69061939e-02f,  -3.01207043e-03f,  -3.77626643e-02f,  -1.22733759e-02f,   2.92276889e-02f,   1.28400289e-02f,
+             -1.47649301e-02f,   2.22393759e-02f,  -6.94904616e-03f,  -6.51174933e-02f,  -5.09279184e-02f,  -3.32099362e-03f,
+              3.80123896e-03f,   3.77002708e-03f,   5.46218716e-02f,  -2.39183032e-03f,  -5.02762198e-02f,   1.43761449e-02f,
+              1.25825346e-01f,   5.45369722e-02f,  -1.05895609e-01f,   4.15692152e-03f,   7.93731064e-02f,   2.73178052e-02f,
+              4.65948246e-02f,  -1.33788716e-02f,  -5.26343919e-02f,   5.82089007e-04f,   1.66980430e-01f,   1.22246943e-01f,
+             -9.49395820e-02f,   7.99903926e-03f,   9.87619609e-02f,   3.20140198e-02f,   2.60051135e-02f,  -1.29253259e-02f,
+             -3.40679251e-02f,  -5.29859914e-03f,   1.21907547e-01f,   1.04681574e-01f,  -5.52042574e-02f,   6.60805358e-03f,
+              7.00693801e-02f,   2.20607910e-02f,   1.86780542e-02f,   1.94027042e-03f,  -1.48211364e-02f,   7.75751192e-03f,
+              2.85170134e-02f,   2.28612364e-04f,  -3.50907631e-02f,   3.38249403e-04f,   1.95879098e-02f,   7.22243870e-03f,
+              2.96923169e-03f,   4.54054493e-03f,   1.28181116e-03f,   5.59327425e-03f,  -1.77294966e-02f,  -2.82277986e-02f,
+             -3.85914231e-03f,  -1.60831038e-03f,  -8.47674161e-03f,  -2.10313802e-03f,   3.81185813e-03f,   4.60451143e-03f,
+              5.92925760e-04f,   5.91896242e-03f,  -1.63190383e-02f,  -2.80601028e-02f,  -5.45177097e-03f,  -1.58379599e-03f,
+             -7.52852950e-03f,  -1.75920688e-03f,   9.84995626e-03f,   1.84147456e-03f,  -7.11261434e-03f,   4.93396539e-03f,
+              1.07341269e-02f,  -5.34422603e-03f,  -1.81728713e-02f,  -1.42981080e-04f,   8.08876380e-03f,   3.18016042e-03f,
+              4.62077409e-02f,  -2.51230877e-02f,  -6.87696934e-02f,  -1.22497618e-01f,  -1.23670354e-01f,  -5.86436577e-02f,
+              1.59083717e-02f,   3.65914218e-02f,   1.81890819e-02f,   3.31037212e-03f,   5.16028441e-02f,  -2.84344461e-02f,
+             -5.72421327e-02f,  -1.07161649e-01f,  -1.31707415e-01f,  -4.01732661e-02f,   7.25238919e-02f,   8.11122805e-02f,
+              3.06323562e-02f,  -3.12371016e-03f,   2.53871325e-02f,  -1.42566226e-02f,  -1.43138105e-02f,  -3.17343399e-02f,
+             -6.02629595e-02f,  -1.83754705e-03f,   7.44522810e-02f,   6.84037209e-02f,   2.23772228e-02f,  -6.36623614e-03f,
+              1.11922342e-02f,  -6.63213385e-03f,   1.16364928e-02f,   1.32080289e-02f,  -2.06923634e-02f,   2.24231109e-02f,
+              8.30733404e-02f,   6.70916960e-02f,   1.93352774e-02f,  -9.06572118e-03f,  -1.43448059e-02f,   7.53102265e-03f,
+              3.52249071e-02f,   5.90572990e-02f,   4.29350138e-02f,   3.61685492e-02f,   3.39130312e-02f,   1.71974059e-02f,
+              1.67522766e-03f,  -5.86698577e-03f,   2.00977293e-03f,  -1.40555913e-03f,   1.31930383e-02f,   1.91990603e-02f,
+             -8.07266915e-05f,   1.84005313e-02f,   4.60063666e-02f,   3.48987319e-02f,   9.33095627e-03f,  -5.50032267e-03f,
+              1.99811552e-02f,  -1.11634722e-02f,  -1.42311575e-02f,  -2.94707641e-02f,  -4.84012403e-02f,  -5.28506096e-03f,
+              5.02955057e-02f,   4.77349758e-02f,   1.60474610e-02f,  -3.97641631e-03f,   2.66157556e-02f,  -1.52598098e-02f,
+              1.19737757e-03f,  -8.71314667e-03f,  -5.78747094e-02f,   1.90503336e-02f,   1.23425275e-01f,   1.05062082e-01f,
+              3.20104547e-02f,  -1.23255383e-02f,   4.40348778e-03f,  -2.47595576e-03f,  -2.32271501e-03f,  -5.26185334e-03f,
+             -1.04004219e-02f,  -1.11515248e-04f,   1.33621842e-02f,   1.21942852e-02f,   3.96586955e-03f,  -1.16007007e-03f,
+             -4.88963397e-03f,   3.31764668e-03f,  -2.68222243e-02f,  -3.87149416e-02f,   1.92345073e-03f,  -3.79377753e-02f,
+             -9.71591771e-02f,  -7.40490630e-02f,  -1.99178439e-02f,   1.15420334e-02f,   3.73714119e-02f,  -3.60659808e-02f,
+             -7.28670359e-02f,  -7.89370611e-02f,  -3.10860537e-02f,   3.92880477e-02f,   7.46220052e-02f,   4.19675820e-02f,
+              3.68369967e-02f,  -2.79498473e-03f,   1.69920940e-02f,  -3.18910293e-02f,  -4.70302962e-02f,  -4.51507494e-02f,
+             -7.18667218e-03f,   3.88657600e-02f,   5.58042228e-02f,   2.74103172e-02f,   2.22753268e-02f,  -2.79210322e-03f,
+             -2.68178014e-03f,   4.35719043e-02f,   4.19973210e-02f,   3.01596485e-02f,  -1.61483809e-02f,  -5.83784990e-02f,
+             -6.32228702e-02f,  -2.50436086e-02f,  -1.72624830e-02f,   4.22494533e-03f,  -2.88271196e-02f,   6.30453154e-02f,
+              8.78093615e-02f,   8.19428489e-02f,   8.18212423e-03f,  -7.80581087e-02f,  -1.07297994e-01f,  -5.13087474e-02f,
+             -4.09798175e-02f,   5.61487395e-03f,  -2.81589963e-02f,  -5.19358702e-02f,  -1.60695668e-02f,   1.21952808e-02f,
+              5.89003563e-02f,   7.76430070e-02f,   5.54758944e-02f,   1.09063266e-02f,   4.62910131e-04f,  -5.66228107e-03f,
+              4.17660140e-02f,  -1.71499804e-01f,  -1.99134424e-01f,  -1.66630477e-01f,   2.40916349e-02f,   2.21757829e-01f,
+              2.68637478e-01f,   1.17429040e-01f,   8.79656225e-02f,  -1.60060376e-02f,   8.82676095e-02f,  -1.41089261e-01f,
+             -2.22259581e-01f,  -2.19854772e-01f,  -4.83517200e-02f,   1.68581381e-01f,   2.55186111e-01f,   1.29176617e-01f,
+              1.06946848e-01f,  -1.20910294e-02f,   8.74630064e-02f,  -2.24474836e-02f,  -1.14948638e-01f,  -1.47709787e-01f,
+             -1.00538947e-01f,   7.95289688e-03f,   8.71570110e-02f,   6.49112239e-02f,   6.41108304e-02f,  -4.57151153e-04f,
+              5.62494248e-02f,   1.12180719e-02f,  -5.09102196e-02f,  -7.96623230e-02f,  -7.61635974e-02f,  -2.96635889e-02f,
+              1.98291186e-02f,   2.79545300e-02f,   3.20800543e-02f,   2.22512754e-03f,  -1.27238752e-02f,   1.09148799e-02f,
+              2.35849153e-02f,   2.60602161e-02f,   1.11958170e-02f,  -1.15266200e-02f,  -2.34799329e-02f,  -1.35551933e-02f,
+             -1.20551884e-02f,   8.17621243e-04f,  -7.36162858e-03f,  -1.38451485e-02f,  -3.99073772e-02f,  -2.93372460e-02f,
+             -3.77558544e-02f,  -3.68835591e-02f,  -3.97255737e-03f,   2.22810842e-02f,   3.72473039e-02f,   1.40421642e-02f,
+              1.72200741e-03f,  -2.59235688e-02f,  -1.10037878e-01f,  -5.79840615e-02f,   5.04410267e-02f,   2.94484794e-02f,
+             -3.33967023e-02f,  -4.96644489e-02f,   2.92342920e-02f,   7.49020055e-02f,   7.13943504e-03f,  -2.02465672e-02f,
+             -9.91380736e-02f,  -4.64271046e-02f,   8.46629217e-02f,   5.98122813e-02f,  -3.57838273e-02f,  -7.29383230e-02f,
+              7.69472774e-03f,   7.66645595e-02f,   4.85666888e-03f,   5.55601961e-04f,  -8.78704619e-03f,   2.79161875e-04f,
+              3.71484756e-02f,   3.04577984e-02f,  -7.47660594e-03f,  -2.77757160e-02f,  -1.34104649e-02f,   1.37356045e-02f,
+              2.23358590e-02f,   3.33429426e-02f,   8.56152102e-02f,   6.97450414e-02f,   1.26917481e-01f,   1.18094288e-01f,
+              1.85435754e-03f,  -8.08103681e-02f,  -1.01737127e-01f,  -1.93747934e-02f,   3.57670374e-02f,   4.41714078e-02f,
+              9.93503034e-02f,   9.11791176e-02f,   2.16394067e-01f,   1.95691571e-01f,  -7.88501184e-03f,  -1.43460542e-01f,
+             -1.50914997e-01f,  -6.30143564e-03f,   3.30127329e-02f,   3.14258225e-02f,   5.34504205e-02f,   6.33797050e-02f,
+              2.13062659e-01f,   1.87293366e-01f,  -1.82764716e-02f,  -1.46656513e-01f,  -1.27134606e-01f,   1.92362573e-02f,
+              1.62069835e-02f,   1.46982996e-02f,   2.32538506e-02f,   2.94926614e-02f,   1.05640158e-01f,   9.24690962e-02f,
+             -9.83130373e-03f,  -7.31104463e-02f,  -6.14649393e-02f,   1.13998614e-02f,   1.13528920e-02f,   6.47109933e-03f,
+              6.31995499e-04f,   1.21540278e-02f,   7.94578418e-02f,   6.75049275e-02f,  -1.13890273e-02f,  -5.70438989e-02f,
+             -3.80786024e-02f,   1.82406567e-02f,  -4.67175012e-03f,  -1.39205391e-02f,  -4.63423394e-02f,  -3.00345384e-02f,
+             -1.66344400e-02f,  -1.97409000e-02f,  -8.56444426e-03f,   6.31344551e-03f,   3.03184055e-02f,   2.26768255e-02f,
+             -1.09433746e-02f,  -1.43515393e-02f,  -4.59881723e-02f,  -2.31405105e-02f,   7.29652345e-02f,   7.44084343e-02f,
+             -1.73773114e-02f,  -6.90325722e-02f,  -4.62697260e-02f,   7.43897445e-03f,  -1.20806908e-02f,   3.63571243e-03f,
+             -4.01788987e-02f,  -6.61641592e-03f,   1.12178095e-01f,   9.02039930e-02f,  -3.86774801e-02f,  -1.10638894e-01f,
+             -6.34279102e-02f,   1.36506259e-02f,  -9.06091183e-03f,   2.19022278e-02f,  -1.97117291e-02f,   1.36716198e-02f,
+              1.15274265e-01f,   7.55928233e-02f,  -4.81998771e-02f,  -1.16878331e-01f,  -5.97301051e-02f,   1.55922305e-02f,
+             -1.04471352e-02f,   1.79055855e-02f,  -2.67215073e-02f,   8.62314552e-03f,   1.20979160e-01f,   8.41165259e-02f,
+             -4.82206792e-02f,  -1.21771641e-01f,  -6.42099157e-02f,   1.59262437e-02f,  -1.05210803e-02f,   7.25851487e-03f,
+             -3.27673070e-02f,  -1.78556051e-03f,   1.04340859e-01f,   8.02524984e-02f,  -3.77796479e-02f,  -1.03589058e-01f,
+             -5.78338243e-02f,   1.30308857e-02f,  -9.16936249e-03f,  -5.28021576e-03f,  -3.48666087e-02f,  -1.28347790e-02f,
+              7.20892549e-02f,   6.51379675e-02f,  -2.13104635e-02f,  -6.97644055e-02f,  -4.30452190e-02f,   8.11623130e-03f,
+             -1.44076115e-02f,  -8.74257274e-03f,  -5.50274998e-02f,  -2.06003021e-02f,   1.12548172e-01f,   1.02165252e-01f,
+             -3.30384076e-02f,  -1.08831048e-01f,  -6.73532858e-02f,   1.26283569e-02f,  -7.67549966e-03f,   1.05773285e-03f,
+             -2.62084845e-02f,  -5.42064384e-03f,   6.92392811e-02f,   5.67930415e-02f,  -2.33206246e-02f,  -6.80812076e-02f,
+             -3.95051874e-02f,   8.32333602e-03f,  -5.47360117e-03f,   3.33476724e-04f,  -1.89187191e-02f,  -4.27454757e-03f,
+              4.86930236e-02f,   4.03264314e-02f,  -1.62093975e-02f,  -4.78066280e-02f,  -2.79053897e-02f,   5.81809599e-03f,
+              3.65821575e-03f,  -7.15306669e-04f,   1.23764127e-02f,   2.37830891e-03f,  -3.33430134e-02f,  -2.71555092e-02f,
+              1.13261780e-02f,   3.28214429e-02f,   1.89624336e-02f,  -4.02594311e-03f,   5.36028342e-03f,  -1.07194856e-02f,
+             -1.58883128e-02f,   9.58175492e-03f,   2.46776827e-02f,  -3.05965636e-03f,  -1.36520220e-02f,  -2.50498718e-03f,
+              7.04894029e-03f,   7.44421966e-03f,   1.13197947e-02f,   2.04362664e-02f,   1.21925231e-02f,  -2.08861753e-02f,
+             -3.71664278e-02f,   4.35205555e-04f,   1.19050760e-02f,  -8.32638238e-03f,  -1.96876209e-02f,  -1.48543306e-02f,
+             -6.34403946e-03f,   1.78620145e-02f,   1.45900697e-02f,  -3.38363424e-02f,  -6.06707111e-02f,   3.71804321e-03f,
+              2.52304692e-02f,  -6.30806061e-03f,  -2.46758424e-02f,  -2.12005023e-02f,   1.93733163e-02f,   5.21164238e-02f,
+              4.81170975e-02f,  -3.57545391e-02f,  -7.98180699e-02f,   4.17095283e-03f,   3.26923095e-02f,  -7.15979794e-03f,
+             -3.61063331e-02f,  -2.94691119e-02f,   2.97084842e-02f,   3.42247002e-02f,   3.22391987e-02f,   1.41648506e-03f,
+             -1.27761550e-02f,  -3.94026458e-04f,   3.91447311e-03f,  -1.35349901e-03f,  -9.93412733e-03f,  -6.48764754e-03f,
+              1.68718677e-02f,   4.32442762e-02f,   4.75136638e-02f,  -1.48363691e-02f,  -4.82308678e-02f,   3.88350734e-03f,
+              2.30512563e-02f,   1.14936964e-03f,  -1.98341757e-02f,  -1.70647707e-02f,   3.34709324e-02f,   7.54933283e-02f,
+              7.71644935e-02f,  -3.07401959e-02f,  -8.74957889e-02f,   5.59151871e-03f,   3.86435091e-02f,  -2.64495448e-03f,
+             -3.88095528e-02f,  -3.20746638e-02f,   4.51127859e-03f,   1.95548888e-02f,   3.07709128e-02f,   5.72071411e-03f,
+             -9.00570117e-03f,   3.03983339e-03f,   9.59972758e-03f,   8.53112433e-03f,   2.95892823e-04f,  -1.63750083e-03f,
+             -5.10104373e-02f,  -2.80840248e-02f,  -1.01780538e-02f,  -8.95382743e-03f,  -1.47619294e-02f,   6.53794408e-03f,
+              1.68746356e-02f,   1.17142675e-02f,   8.22657067e-03f,   6.66023057e-04f,  -6.24441132e-02f,  -5.61009794e-02f,
+             -4.94826622e-02f,  -1.54506080e-02f,  -2.84551899e-03f,   3.47391097e-03f,   6.11881027e-03f,   3.07048764e-03f,
+              1.00044124e-02f,   3.70869343e-03f,  -2.91130394e-02f,  -2.42447313e-02f,  -4.19561472e-03f,   4.40104529e-02f,
+              5.90407290e-02f,   1.69438198e-02f,   5.65468275e-04f,  -1.11163789e-02f,  -2.02699957e-04f,  -7.64604704e-03f,
+              7.50782155e-03f,   5.19113243e-03f,   1.07593918e-02f,   5.23208128e-03f,   1.26334047e-03f,   8.26493837e-03f,
+             -3.90841626e-03f,  -9.69231501e-03f,  -8.74830224e-03f,  -6.41583186e-03f,   5.80819249e-02f,   4.40610424e-02f,
+              4.76589017e-02f,  -2.04842966e-02f,  -5.08465916e-02f,   1.74899492e-02f,  -1.64035466e-02f,  -2.88097262e-02f,
+             -3.53242867e-02f,  -1.87979843e-02f,   3.32594588e-02f,   2.45640986e-02f,   3.33695263e-02f,  -1.31455704e-03f,
+             -1.87591184e-02f,   1.79512948e-02f,  -1.17565356e-02f,  -2.43859570e-02f,  -2.57555973e-02f,  -1.60327591e-02f,
+             -6.31321594e-03f,  -5.90274855e-03f,   4.97412495e-03f,   1.96255893e-02f,   2.28285957e-02f,   1.13561898e-02f,
+             -2.16506678e-03f,  -1.00466339e-02f,  -5.39478706e-03f,  -6.75781816e-03f,   1.32377213e-02f,   9.45369527e-03f,
+              1.62284039e-02f,   4.52610059e-03f,  -2.44528940e-03f,   1.09922020e-02f,  -5.82501199e-03f,  -1.35303158e-02f,
+             -1.29309511e-02f,  -8.93538352e-03f,   1.41862705e-02f,   1.08217159e-02f,   1.10934582e-02f,  -5.94051648e-03f,
+             -1.33511443e-02f,   3.55766062e-03f,  -3.79381189e-03f,  -6.32673362e-03f,  -8.13034363e-03f,  -4.11720434e-03f,
+             -3.71583626e-02f,  -2.68340539e-02f,  -4.28405181e-02f,  -8.05670768e-03f,   1.14860535e-02f,  -2.73135547e-02f,
+              1.52961379e-02f,   3.44591998e-02f,   3.38303372e-02f,   2.27305070e-02f,  -2.90712360e-02f,  -2.10921038e-02f,
+             -3.26212347e-02f,  -4.76886984e-03f,   1.05120409e-02f,  -2.01999210e-02f,   1.16189253e-02f,   2.57973708e-02f,
+              2.56531630e-02f,   1.70073062e-02f,   6.41599996e-03f,   5.31831151e-03f,   1.15078688e-03f,  -9.31163505e-03f,
+             -1.26262084e-02f,  -3.43886833e-03f,  -2.12545725e-04f,   2.15636590e-03f,  -1.60985714e-04f,   1.48904650e-03f,
+             -6.96112365e-02f,   1.10507265e-01f,   1.09757900e-01f,   1.33378893e-01f,   1.21244192e-01f,   1.53383061e-01f,
+              6.20062426e-02f,  -5.10192923e-02f,  -1.53351307e-01f,  -1.45992279e-01f,  -1.37147410e-02f,   6.36560470e-02f,
+              4.99999486e-02f,   6.12349175e-02f,   3.15692388e-02f,   2.74748057e-02f,   1.21780960e-02f,  -1.49872527e-02f,
+             -7.51196146e-02f,  -7.68717900e-02f,  -2.64940802e-02f,   4.50024605e-02f,   4.44469005e-02f,   6.08221143e-02f,
+              4.10767198e-02f,   5.05262092e-02f,   6.72853924e-03f,  -3.43238115e-02f,  -7.27875233e-02f,  -7.39423931e-02f,
+             -5.57929836e-02f,  -4.28651879e-03f,   2.46403441e-02f,   2.46896427e-02f,   8.36233571e-02f,   1.33768931e-01f,
+              6.02415018e-02f,  -2.09225882e-02f,  -1.63664520e-02f,  -1.05610862e-03f,  -2.45874636e-02f,  -7.12609813e-02f,
+             -3.60360444e-02f,  -4.58619632e-02f,   2.32758615e-02f,   6.23319708e-02f,   2.40462534e-02f,  -3.25974636e-03f,
+              6.54522926e-02f,   7.69356191e-02f,  -3.88011448e-02f,  -8.01754594e-02f,  -3.32366899e-02f,  -2.57057510e-02f,
+              2.80964989e-02f,   7.63749555e-02f,  -5.85792586e-03f,  -4.67303470e-02f,   3.94422673e-02f,   4.54144962e-02f,
+             -1.07879108e-02f,  -3.84710245e-02f,  -1.92149337e-02f,  -9.59609356e-03f,  -3.31241917e-03f,   1.11570964e-02f,
+             -2.61451453e-02f,  -3.22586931e-02f,   1.19293826e-02f,   9.40133631e-03f,   3.60149844e-03f,  -1.02933925e-02f,
+             -9.72490944e-03f,  -2.13132501e-02f,   7.04134756e-04f,   3.03719589e-03f,   2.03037690e-02f,   2.34681200e-02f,
+              2.85407137e-02f,   3.37088816e-02f,  -8.00302159e-03f,  -4.72319638e-03f,  -6.44034997e-04f,  -1.55079830e-02f,
+              2.27671545e-02f,   3.51952128e-02f,   4.33084443e-02f,   2.74008717e-02f,   2.52085645e-02f,   3.53851505e-02f,
+              1.16280783e-02f,  -1.55436229e-02f,  -1.81270223e-02f,  -3.96430790e-02f,  -5.11138234e-03f,  -5.86728519e-03f,
+              3.35700735e-02f,   4.60949540e-02f,   5.18306494e-02f,   6.00943379e-02f,   3.63088259e-03f,   3.21542397e-02f,
+              5.70151843e-02f,   3.74669656e-02f,   2.57989950e-02f,   5.61900996e-02f,   3.71393189e-02f,   1.32437581e-02f,
+              6.82448037e-04f,  -2.74806898e-02f,   2.97153089e-03f,   1.11856665e-02f,   1.26982583e-02f,   4.44239052e-03f,
+              4.21097549e-03f,   1.39149064e-02f,   1.14770625e-02f,   1.59130417e-04f,  -5.81821008e-03f,  -1.03684552e-02f,
+              2.33405153e-03f,   5.95324626e-03f,   3.61501519e-03f,  -1.42006821e-03f,   1.42761637e-04f,   4.92488686e-03f,
+              5.47280628e-03f,  -1.87460508e-03f,  -5.76398149e-03f,  -5.87448571e-03f,   3.07145645e-03f,   1.39295049e-02f,
+              1.84403434e-02f,   8.69519077e-03f,   6.99782046e-03f,   1.94018316e-02f,   1.48235681e-02f,   1.83578790e-03f,
+             -5.01593715e-03f,  -1.26141319e-02f,  -2.61217123e-03f,   1.87724910e-03f,   1.51248127e-02f,   1.63896121e-02f,
+              9.38116759e-03f,   1.25909746e-02f,   4.55331337e-03f,   8.12610332e-03f,   1.00501552e-02f,  -2.67727912e-04f,
+             -3.10649187e-03f,  -6.57627173e-03f,  -1.78722024e-03f,   4.22478560e-03f,   1.31507707e-03f,  -3.69904493e-03f,
+             -5.59950341e-03f,   3.44593194e-03f,   8.23933445e-03f,   6.73925271e-03f,   2.98215513e-04f,  -4.22191387e-03f,
+             -1.07231010e-02f,  -8.81661754e-03f,  -5.54837426e-03f,  -9.93269030e-03f,  -5.53092314e-03f,  -3.75659298e-03f,
+             -2.83647259e-03f,   3.24148173e-03f,  -2.45263334e-04f,  -1.16947964e-02f,  -2.52284370e-02f,  -1.90347042e-02f,
+             -1.23817986e-02f,  -2.39819046e-02f,  -1.44160362e-02f,  -7.61656417e-03f,  -4.05973382e-03f,   9.48603451e-03f,
+              1.89571700e-04f,  -5.74300205e-03f,  -1.36838993e-02f,  -1.09064439e-02f,  -6.94482354e-03f,  -1.27989035e-02f,
+             -7.34113995e-03f,  -4.54743672e-03f,  -3.09248315e-03f,   4.51160921e-03f,  -1.83974928e-03f,   6.32908056e-03f,
+              2.18921266e-02f,   2.02206373e-02f,   1.22010112e-02f,   1.94814447e-02f,   9.46756173e-03f,   9.25750285e-03f,
+              9.18861758e-03f,  -4.20015259e-03f,   5.34116384e-03f,   8.05598404e-03f,   1.28639201e-02f,   1.49653126e-02f,
+              4.28921496e-03f,  -4.55415528e-03f,   8.00376851e-03f,  -1.81070305e-02f,  -1.29976831e-02f,   6.77905325e-03f,
+              8.49631673e-04f,  -1.01533262e-02f,  -1.98297594e-02f,  -2.58271843e-02f,  -4.06999886e-03f,   1.54441819e-02f,
+             -2.60848105e-02f,  -2.47557294e-02f,  -5.57768950e-03f,  -2.71207299e-02f,   2.72718607e-03f,  -8.78898986e-03f,
+             -1.81153435e-02f,  -2.41866857e-02f,  -3.17214173e-03f,   1.59183647e-02f,  -2.67824139e-02f,  -3.39283049e-02f,
+             -1.05971936e-02f,  -2.83567980e-02f,  -1.27256860e-03f,  -1.14434548e-02f,  -2.12854967e-02f,  -2.70598438e-02f,
+             -4.98012407e-03f,   1.45519143e-02f,  -2.46934406e-02f,  -1.39059145e-02f,   1.73207285e-04f,  -2.51021963e-02f,
+             -2.36348994e-02f,  -2.46812552e-02f,  -3.59426476e-02f,  -3.91688310e-02f,  -1.44221652e-02f,   4.64541279e-03f,
+             -9.17865708e-03f,   1.01104625e-01f,   6.08818233e-02f,  -2.95255613e-03f,  -2.65145930e-03f,  -1.09051820e-02f,
+             -1.95979048e-02f,  -2.44650934e-02f,  -4.99939034e-03f,   1.20257810e-02f,  -2.04960331e-02f,  -4.22291970e-03f,
+              4.33237804e-03f,  -2.03960426e-02f,   1.21257864e-02f,   1.90071121e-03f,  -2.14848295e-03f,  -6.45239744e-03f,
+              2.92659644e-03f,   1.28338328e-02f,  -2.10389756e-02f,  -7.24593997e-02f,  -3.45387235e-02f,  -2.50248536e-02f,
+              8.09169002e-03f,   9.33044776e-03f,   1.39899356e-02f,   1.55820241e-02f,   5.30354585e-03f,  -2.83545931e-03f,
+              5.24909468e-03f,  -3.29298861e-02f,  -2.05733273e-02f,   3.18228244e-03f,   3.18641844e-03f,  -3.26218759e-03f,
+             -7.76104396e-03f,  -1.09749371e-02f,  -7.94288411e-04f,   8.69139563e-03f,  -1.45284608e-02f,  -2.62371562e-02f,
+             -1.02308048e-02f,  -1.58525649e-02f,   1.29453186e-02f,   1.46834701e-02f,   2.19153762e-02f,   2.43275315e-02f,
+              8.38350505e-03f,  -4.19173576e-03f,   7.81472120e-03f,  -5.31482883e-02f,  -3.29885930e-02f,   4.49025352e-03f,
+             -1.09882234e-03f,   1.31206622e-03f,  -4.81338659e-03f,  -5.39701851e-03f,  -1.80755765e-03f,  -8.22863169e-03f,
+             -3.51234386e-03f,   1.37771964e-02f,   1.00795152e-02f,  -1.88806164e-03f,   5.30297810e-04f,  -1.34062162e-02f,
+             -8.29871837e-03f,   1.82321295e-02f,   5.22208549e-02f,   3.24263871e-02f,  -1.70663837e-02f,   4.73497523e-04f,
+              1.71814524e-02f,  -3.93333752e-03f,  -3.08599276e-03f,  -8.06206185e-03f,  -2.32866164e-02f,  -7.85153825e-04f,
+              4.21472080e-02f,   3.05963587e-03f,  -2.71185972e-02f,   4.52429317e-02f,   4.85827848e-02f,  -9.75789782e-03f,
+             -2.10413476e-03f,  -3.50591280e-02f,  -4.04606834e-02f,   3.56332958e-02f,   1.47579595e-01f,   6.79435432e-02f,
+             -6.19123392e-02f,   4.73325290e-02f,   8.41488987e-02f,  -1.78655516e-02f,  -1.21647548e-02f,  -2.55414960e-03f,
+             -6.74906522e-02f,  -3.88522819e-02f,   4.86506857e-02f,  -5.30474633e-02f,  -6.39714226e-02f,   1.62047416e-01f,
+              1.41066581e-01f,  -2.73801554e-02f,  -6.46074163e-03f,  -1.03261583e-02f,  -4.33034189e-02f,  -9.66041256e-03f,
+              6.18972220e-02f,  -8.19146819e-03f,  -4.71503735e-02f,   9.10655484e-02f,   9.04022977e-02f,  -1.79436821e-02f,
+              7.21733598e-03f,  -4.54886518e-02f,   9.54854244e-04f,   8.05594251e-02f,   1.60095587e-01f,   1.36186734e-01f,
+             -3.10870614e-02f,  -6.99322969e-02f,  -2.56689498e-03f,  -1.58300134e-03f,   5.90492925e-03f,  -3.93118970e-02f,
+             -9.60874138e-04f,   6.84735477e-02f,   1.39405504e-01f,   1.16089448e-01f,  -2.85112914e-02f,  -5.60475737e-02f,
+              1.51568756e-03f,  -2.08971347e-03f,   1.68767525e-03f,  -1.17887929e-02f,  -7.34604604e-04f,   2.02470385e-02f,
+              4.20668721e-02f,   3.44115496e-02f,  -8.96122865e-03f,  -1.57103948e-02f,   1.38790719e-03f,  -8.07052013e-04f,
+              6.22423482e-04f,   3.99256172e-03f,   6.66466681e-03f,  -2.73700105e-03f,  -1.80143211e-02f,  -5.88910235e-03f,
+              8.94563552e-03f,  -1.04447883e-02f,  -1.38833299e-02f,   2.86566303e-03f,   1.11564053e-02f,   4.94274907e-02f,
+             -1.27468556e-02f,  -1.14067838e-01f,  -1.27775505e-01f,  -1.34785967e-02f,   7.24699646e-02f,   2.86783222e-02f,
+             -3.23684351e-03f,   3.57936919e-02f,   1.33559189e-03f,  -1.81802884e-02f,  -6.44106092e-03f,   4.06397693e-02f,
+              5.19204624e-02f,  -9.82132368e-03f,  -3.20023522e-02f,   3.13417194e-03f,   9.39704478e-03f,  -2.15384383e-02f,
+              1.69247724e-02f,  -7.72432312e-02f,  -5.03866486e-02f,   1.69944882e-01f,   2.30777770e-01f,  -7.22968876e-02f,
+             -1.47028446e-01f,   4.16171104e-02f,   5.68997413e-02f,  -1.08829528e-01f,   3.26279551e-02f,  -6.20908141e-02f,
+             -7.94281214e-02f,   1.32003710e-01f,   2.02723354e-01f,  -1.09804101e-01f,  -1.36886448e-01f,   8.13078806e-02f,
+              7.44400695e-02f,  -1.16765112e-01f,   8.68771225e-02f,   1.90259330e-02f,  -1.73888385e-01f,  -6.38941303e-02f,
+              2.55535431e-02f,  -2.29579508e-01f,  -5.32831699e-02f,   2.18783066e-01f,   1.23354077e-01f,  -1.13348871e-01f,
+              3.78770232e-02f,  -1.94365513e-02f,  -8.14688131e-02f,   3.46266739e-02f,   8.84947926e-02f,  -1.09538451e-01f,
+             -7.00431988e-02f,   9.50417146e-02f,   6.50404915e-02f,  -7.91360885e-02f,  -4.23597582e-02f,  -1.01487041e-01f,
+              6.59771636e-02f,   2.38917828e-01f,   2.44750276e-01f,   8.05316493e-02f,  -1.29676878e-01f,  -1.07819147e-01f,
+             -2.27042306e-02f,  -4.35479544e-02f,  -5.27983494e-02f,  -1.11983262e-01f,   8.51958618e-02f,   2.65093744e-01f,
+              2.64581293e-01f,   1.05319992e-01f,  -1.37134045e-01f,  -1.34208575e-01f,  -3.41919884e-02f,  -3.87269370e-02f,
+             -2.26842239e-03f,  -2.79996842e-02f,  -1.06930430e-03f,   6.36366233e-02f,   7.60488585e-02f,  -3.37314187e-03f,
+             -4.50353660e-02f,  -6.05390128e-03f,   7.94640742e-03f,  -2.65131742e-02f,   2.58396231e-02f,   1.73549019e-02f,
+             -4.93335426e-02f,  -4.53569181e-02f,  -2.50244811e-02f,  -6.42994568e-02f,   3.89583781e-03f,   6.52171895e-02f,
+              3.19397934e-02f,  -2.11792402e-02f,   8.14159513e-02f,   3.99485324e-03f,   4.44638915e-02f,  -3.14736664e-02f,
+             -4.55478616e-02f,   3.83166298e-02f,  -4.97289449e-02f,  -5.70485592e-02f,   3.60226855e-02f,   7.49903470e-02f,
+              1.77488253e-02f,  -2.95596011e-02f,  -1.86820906e-02f,   8.49564746e-02f,   1.26875758e-01f,   8.27049185e-03f,
+             -4.22538333e-02f,  -2.77002808e-02f,   1.47595085e-04f,   2.33447161e-02f,   3.35784853e-02f,  -4.46077287e-02f,
+             -2.47930791e-02f,   1.26585320e-01f,   1.89163104e-01f,   1.56774186e-02f,  -6.82583079e-02f,  -4.67297696e-02f,
+              3.14440043e-03f,   4.15635556e-02f,  -7.77608436e-03f,  -1.96951628e-02f,  -2.22559981e-02f,   6.12809546e-02f,
+              9.11778286e-02f,  -3.71206948e-03f,  -1.51874470e-02f,  -4.23875079e-03f,  -8.33101850e-03f,  -2.72171665e-03f,
+             -1.03412502e-01f,   1.74211396e-03f,  -5.01209982e-02f,   1.94103364e-02f,   2.72100568e-02f,  -4.86503206e-02f,
+              7.02007785e-02f,   7.58806244e-02f,  -4.40291390e-02f,  -9.68180820e-02f,  -5.29680587e-02f,  -1.50541058e-02f,
+             -4.05415036e-02f,   5.80570772e-02f,   8.56267959e-02f,  -2.49620620e-02f,   1.94957610e-02f,   3.08676362e-02f,
+             -2.65896507e-02f,  -4.59239259e-02f,   7.61392293e-04f,  -3.01619098e-02f,  -2.77438760e-02f,   9.08258036e-02f,
+              1.35339841e-01f,   2.76357488e-04f,  -3.16392109e-02f,  -1.56811271e-02f,  -7.30998861e-03f,   7.64482422e-03f,
+              4.16957960e-03f,  -2.07154024e-02f,  -1.72299743e-02f,   6.15099445e-02f,   9.17166173e-02f,   1.90553430e-03f,
+             -2.41421070e-02f,  -1.34148793e-02f,  -3.45238764e-03f,   8.65050219e-03f,   1.71715859e-02f,  -1.26153193e-02f,
+             -3.17101437e-03f,   3.39682475e-02f,   5.08955419e-02f,   8.04489944e-03f,  -2.43807472e-02f,  -1.87825393e-02f,
+              4.18989081e-03f,   1.89106334e-02f,   5.41048981e-02f,  -7.21247867e-04f,   2.64004227e-02f,  -1.07293315e-02f,
+             -1.50913177e-02f,   2.54541170e-02f,  -3.65323350e-02f,  -3.96049470e-02f,   2.30839886e-02f,   5.06109931e-02f,
+              2.67280415e-02f,  -2.22078268e-03f,  -1.67735778e-02f,  -1.89065021e-02f,  -1.82632431e-02f,  -7.98384752e-03f,
+              6.50974130e-03f,  -1.29428674e-02f,  -2.14514658e-02f,  -1.32592872e-03f,   8.91775079e-03f,   7.91623257e-03f,
+              3.09999008e-02f,   1.27667105e-02f,   8.49159621e-03f,   9.29698581e-04f,  -1.70278382e-02f,  -1.72189146e-03f,
+              1.50047643e-02f,   4.31965850e-03f,   8.60710512e-04f,   1.17826210e-02f,   4.95705940e-02f,   2.55099740e-02f,
+              1.93829723e-02f,   4.66340268e-03f,  -2.60803066e-02f,   3.13850259e-03f,   2.96552330e-02f,   6.47789380e-03f,
+             -5.54847764e-03f,  -9.12475586e-03f,  -3.70396934e-02f,  -1.71959996e-02f,  -1.23582240e-02f,  -2.32156389e-03f,
+              1.99078247e-02f,  -1.88154590e-04f,  -2.00859979e-02f,  -4.99758357e-03f,  -1.06812986e-02f,  -2.25345995e-02f,
+             -9.23085064e-02f,  -4.40514721e-02f,  -3.21615264e-02f,  -6.53163809e-03f,   4.93436977e-02f,  -1.85241469e-03f,
+             -5.13868034e-02f,  -1.23538831e-02f,   7.85564422e-04f,  -7.03637302e-03f,  -2.99617909e-02f,  -1.59154590e-02f,
+             -1.22812456e-02f,  -3.12827015e-03f,   1.56517401e-02f,  -2.47117877e-03f,  -1.84761696e-02f,  -3.87355709e-03f,
+             -8.98291357e-03f,  -1.62831787e-02f,  -6.63513169e-02f,  -3.11678573e-02f,  -2.25522909e-02f,  -4.38549556e-03f,
+              3.55800688e-02f,  -7.57594535e-04f,  -3.63853090e-02f,  -8.92180111e-03f,   1.48820691e-02f,  -7.73430988e-03f,
+             -3.68074216e-02f,  -2.48439647e-02f,  -2.11159606e-02f,  -7.14252423e-03f,   1.80353001e-02f,  -9.15535539e-03f,
+             -2.85781175e-02f,  -4.31250222e-03f,   5.64766377e-02f,   6.75253151e-03f,   1.29387584e-02f,  -1.47321466e-02f,
+             -1.93085019e-02f,  -1.21192504e-02f,  -1.16275614e-02f,  -2.39158086e-02f,  -1.60283465e-02f,   3.49387527e-03f,
+              5.84277436e-02f,   1.17052365e-02f,   3.33360843e-02f,  -4.84255655e-03f,  -1.20245693e-02f,  -1.05789620e-02f,
+             -2.24959347e-02f,  -2.33265813e-02f,  -4.50057723e-03f,   6.21058745e-03f,   2.31954306e-02f,   8.66183173e-03f,
+              1.36294309e-02f,   9.73688997e-03f,  -9.70446970e-03f,  -5.19410037e-02f,  -3.93206403e-02f,  -1.79378837e-02f,
+              1.91020425e-02f,   3.62003632e-02f,   3.12341731e-02f,   4.16854070e-03f,   9.29051545e-03f,   1.65078808e-02f,
+             -1.00653889e-02f,  -4.90628257e-02f,  -2.55402587e-02f,  -9.92916711e-03f,   3.44363786e-02f,   5.47903553e-02f,
+              1.98611561e-02f,  -1.04277292e-02f,  -9.90543421e-03f,   1.64236315e-02f,  -1.16159942e-03f,   5.23419678e-03f,
+              3.15831900e-02f,   1.85082313e-02f,   3.71028967e-02f,   4.53865901e-02f,  -5.33962343e-03f,  -3.85861024e-02f,
+             -4.73809689e-02f,   1.43406475e-02f,   1.68915540e-02f,   1.13890700e-01f,   1.42857745e-01f,   7.35788122e-02f,
+              3.81462537e-02f,   2.11748369e-02f,  -2.95993465e-04f,  -2.16644220e-02f,  -2.62346752e-02f,   9.64311138e-03f,
+              8.75759590e-03f,   6.07049465e-02f,   7.93176442e-02f,   4.11367789e-02f,   2.48157121e-02f,   1.69192981e-02f,
+             -1.54985860e-03f,   1.03865741e-02f,   1.23474747e-02f,  -5.61964605e-03f,  -3.74391465e-03f,  -2.70753000e-02f,
+             -3.74695249e-02f,  -1.96129270e-02f,  -1.40251145e-02f,  -1.12613570e-02f,  -4.43712203e-03f,   4.56615770e-03f,
+              4.91712568e-03f,  -4.68266103e-03f,  -6.36368582e-04f,  -7.39960140e-03f,  -1.52342021e-02f,  -8.37965589e-03f,
+             -1.08893327e-02f,  -1.19432406e-02f,   6.46705786e-03f,   1.26462011e-02f,   1.61705259e-02f,  -1.92166260e-03f,
+             -6.80395775e-03f,  -4.29823883e-02f,  -4.83752713e-02f,  -2.44193990e-02f,  -6.56945864e-03f,   1.84238597e-03f,
+              1.26147701e-03f,   2.50591170e-02f,   3.04705743e-02f,  -1.06127821e-02f,  -1.03769135e-02f,  -7.13191107e-02f,
+             -9.20492932e-02f,  -4.76420522e-02f,  -2.75482498e-02f,  -1.78592689e-02f,   6.94829272e-04f,   7.96088949e-03f,
+              9.72004328e-03f,  -3.19830352e-03f,  -3.37563013e-03f,  -2.30095722e-02f,  -2.93395724e-02f,  -1.51541308e-02f,
+             -8.38178955e-03f,  -5.12609538e-03f,   4.30701347e-03f,  -2.10519531e-03f,   2.56410111e-02f,   2.86371894e-02f,
+             -1.13829095e-02f,  -5.90071715e-02f,  -5.16344123e-02f,  -4.15855832e-02f,  -1.56521779e-02f,   9.96656623e-03f,
+              1.56573728e-02f,   2.90606637e-02f,   3.80287319e-02f,   1.71978101e-02f,  -1.25142662e-02f,  -2.34880429e-02f,
+             -1.30485510e-02f,  -3.74306962e-02f,  -2.35165330e-03f,   7.30345622e-02f,   2.02035364e-02f,   5.10972291e-02f,
+              2.86302026e-02f,  -9.99919977e-03f,  -5.45579661e-03f,   4.04464118e-02f,   4.78562601e-02f,  -6.16735313e-03f,
+              1.71704274e-02f,   1.07872114e-01f,   1.95918065e-02f,   5.64307459e-02f,   1.74209811e-02f,  -2.59841122e-02f,
+              1.19329721e-04f,   7.50219002e-02f,   7.91407600e-02f,   1.53369922e-02f,   2.68737748e-02f,   1.11503296e-01f,
+              1.46932667e-02f,   4.62894179e-02f,   7.10081402e-03f,  -2.88803540e-02f,   3.20938579e-03f,   7.69100040e-02f,
+              7.82305151e-02f,   2.37960815e-02f,   2.60502342e-02f,   8.76018181e-02f,   1.45474775e-02f,   3.97981443e-02f,
+              1.60970539e-02f,  -1.43150846e-02f,  -1.56511820e-03f,   4.47624177e-02f,   4.87582088e-02f,   4.87172836e-03f,
+              1.68294776e-02f,   8.06859806e-02f,   1.53833581e-02f,   2.75373831e-02f,   3.88884060e-02f,   1.92988012e-02f,
+             -1.30930683e-02f,  -2.83564795e-02f,  -1.76474471e-02f,  -3.99193689e-02f,  -3.81813222e-03f,   7.07392469e-02f,
+              7.80785829e-03f,   5.46402251e-03f,   3.25332806e-02f,   2.99459938e-02f,  -1.33384988e-02f,  -5.86837493e-02f,
+             -4.94543798e-02f,  -4.66349684e-02f,  -1.45859290e-02f,   2.73705479e-02f,  -4.18502977e-03f,  -1.93661321e-02f,
+              7.26921670e-03f,   2.28589717e-02f,  -5.77448215e-03f,  -5.40693700e-02f,  -5.16903885e-02f,  -2.59298068e-02f,
+             -1.66045036e-02f,  -3.11480090e-02f,  -2.09609256e-03f,  -1.02930842e-02f,   4.53285733e-03f,   1.28538506e-02f,
+             -3.35878832e-03f,  -3.01686972e-02f,  -2.87126731e-02f,  -1.48257297e-02f,  -9.19820834e-03f,  -1.61955357e-02f,
+              3.67105938e-02f,   2.36458667e-02f,   1.78751163e-02f,  -3.79658304e-04f,  -8.08115955e-03f,  -1.74926426e-02f,
+             -1.29735479e-02f,  -2.10543722e-02f,  -1.35741765e-02f,  -3.38909822e-03f,   3.13348770e-02f,   1.39158303e-02f,
+              5.20523591e-03f,  -5.27860783e-03f,  -1.32036302e-02f,  -2.04600878e-02f,  -5.15878806e-03f,  -1.62319187e-03f,
+              2.78586545e-03f,   8.58622883e-03f,   2.61926651e-02f,   3.33629292e-03f,  -8.95469077e-03f,  -1.09704174e-02f,
+             -1.93835329e-02f,  -2.44208891e-02f,   3.51712247e-03f,   2.02822331e-02f,   2.13525165e-02f,   2.23713592e-02f,
+              1.67396683e-02f,   5.60810231e-03f,  -1.47965140e-04f,  -4.26341128e-03f,  -8.89079645e-03f,  -1.25409970e-02f,
+             -1.03262078e-03f,   3.89579311e-03f,   5.67556033e-03f,   7.93128368e-03f,   7.21996243e-04f,   1.35078523e-02f,
+              2.12708432e-02f,   1.03031248e-02f,   1.29637457e-02f,   1.11619821e-02f,  -1.25644431e-02f,  -3.44350524e-02f,
+             -3.01762726e-02f,  -2.39549745e-02f,   1.29028945e-03f,   6.46986440e-03f,   9.67226177e-03f,   4.44421312e-03f,
+              5.38926804e-03f,   4.35954751e-03f,  -5.77763887e-03f,  -1.54482285e-02f,  -1.34077296e-02f,  -1.04467077e-02f,
+              1.26031451e-02f,  -1.05677880e-02f,  -2.38331370e-02f,  -1.49017312e-02f,  -2.15744562e-02f,  -2.24894173e-02f,
+              1.31808473e-02f,   4.15116847e-02f,   3.81891765e-02f,   3.30599025e-02f,  -4.49028052e-03f,  -1.06950598e-02f,
+             -1.47012807e-02f,  -6.12182822e-03f,  -6.86213328e-03f,  -4.74379817e-03f,   8.95084627e-03f,   2.29281764e-02f,
+              1.95534453e-02f,   1.47056226e-02f,  -2.64739944e-03f,  -1.31579749e-02f,  -1.96580719e-02f,  -9.02623963e-03f,
+             -1.09401057e-02f,  -8.84181634e-03f,   1.17442450e-02f,   3.13917883e-02f,   2.72419434e-02f,   2.12204792e-02f,
+              3.85606177e-02f,   1.47862351e-02f,   2.65476038e-03f,  -8.34451150e-03f,  -1.86012257e-02f,  -2.72411406e-02f,
+             -4.14135912e-03f,   4.10240144e-03f,   8.79096240e-03f,   1.48493238e-02f,  -1.27518466e-02f,  -8.37830361e-03f,
+              4.58673341e-03f,  -9.37903859e-03f,  -4.89909835e-02f,  -4.77268249e-02f,  -2.25334428e-02f,  -1.22009777e-03f,
+              5.90786221e-05f,   1.04887160e-02f,  -2.49818899e-02f,  -6.87860185e-03f,   1.38082663e-02f,   1.68475155e-02f,
+             -1.10830208e-02f,  -5.85489869e-02f,  -5.02590761e-02f,  -2.89886687e-02f,  -3.85681875e-02f,   1.66739020e-02f,
+             -4.35142167e-04f,  -1.91559514e-03f,  -6.67714514e-04f,  -6.33995468e-03f,  -1.61813907e-02f,  -7.60236150e-03f,
+              2.76085426e-04f,   4.50440915e-03f,   6.61364757e-03f,   1.02009391e-03f,  -3.01667582e-02f,  -2.69535394e-05f,
+              2.08614115e-02f,   5.09267971e-02f,   6.03293888e-02f,  -4.03524190e-02f,  -6.59990385e-02f,  -5.81001900e-02f,
+             -8.01616088e-02f,   1.67704523e-02f,  -2.43397020e-02f,   2.28262786e-03f,   1.79972462e-02f,   4.96017970e-02f,
+              6.91925660e-02f,  -2.41110697e-02f,  -5.47282025e-02f,  -5.33055365e-02f,  -7.40262643e-02f,   1.25947325e-02f,
+             -1.49116861e-02f,   8.22799094e-03f,   1.44800860e-02f,   5.56160174e-02f,   1.03196055e-01f,   1.02624530e-02f,
+             -3.79084870e-02f,  -5.17086126e-02f,  -7.30593726e-02f,   4.94116358e-03f,   3.08963377e-03f,  -1.24087278e-02f,
+             -8.41380563e-03f,  -5.10624498e-02f,  -1.16681784e-01f,  -4.13621701e-02f,   1.47181703e-02f,   4.05724496e-02f,
+              5.85631244e-02f,   3.32543696e-03f,   9.69588012e-03f,  -5.05055301e-03f,  -9.26379394e-03f,  -3.50565128e-02f,
+             -6.44340441e-02f,  -5.57519076e-03f,   2.44568456e-02f,   3.27866599e-02f,   4.62898090e-02f,  -3.33451875e-03f,
+              4.10247780e-02f,   1.89851858e-02f,  -1.87867545e-02f,   7.36637798e-04f,   8.66601020e-02f,   1.24333501e-01f,
+              7.76038766e-02f,   2.61553526e-02f,   3.21407355e-02f,  -3.05058733e-02f,   3.61836739e-02f,   6.66654017e-03f,
+             -2.16670223e-02f,  -3.65784019e-02f,  -1.32961711e-02f,   7.27189928e-02f,   7.49088153e-02f,   5.11824079e-02f,
+              6.92354366e-02f,  -2.28110235e-02f,   7.01252418e-03f,   1.17123581e-03f,  -3.89554836e-02f,  -2.53945775e-02f,
+             -3.56010571e-02f,  -7.59321526e-02f,   1.42580681e-02f,   2.49205567e-02f,   1.97792053e-02f,  -4.49084491e-03f,
+              1.27311423e-02f,  -2.32116133e-02f,  -3.80186085e-03f,   5.87469861e-02f,   3.15807760e-02f,  -5.23348711e-02f,
+              4.31476068e-03f,   2.00729910e-02f,  -4.00803052e-02f,  -2.88924631e-02f,   1.83978695e-02f,  -2.14565787e-02f,
+             -3.74168344e-02f,   3.48800197e-02f,  -2.58307671e-04f,  -1.16423681e-01f,   1.65248662e-02f,   4.10141759e-02f,
+             -2.16720589e-02f,  -3.18596289e-02f,   2.64640003e-02f,  -4.34754118e-02f,  -2.05121059e-02f,   1.02360487e-01f,
+              4.75178473e-02f,  -1.24900959e-01f,   1.30333221e-02f,   4.64678667e-02f,  -6.89964145e-02f,  -5.61505556e-02f,
+              8.06575269e-03f,  -3.24073955e-02f,   4.43443656e-02f,   1.10470243e-01f,   8.72255415e-02f,   2.65893172e-02f,
+             -1.23361843e-02f,  -4.86725522e-03f,  -7.84807652e-02f,  -3.27937789e-02f,  -6.05289638e-03f,  -1.33012526e-03f,
+              3.44675966e-02f,   2.32401993e-02f,   3.19411866e-02f,   6.66184574e-02f,  -1.25786364e-02f,  -2.18273588e-02f,
+             -1.80297121e-02f,   3.61505430e-03f,   2.06607557e-03f,   7.35547626e-03f,  -2.99928058e-02f,  -3.64914872e-02f,
+             -3.71090844e-02f,  -4.60326225e-02f,   1.01688541e-02f,   1.43061662e-02f,   2.68518291e-02f,   4.41496214e-03f,
+              1.19466921e-02f,  -8.18960462e-03f,  -3.94654982e-02f,  -1.11666904e-03f,  -2.19762102e-02f,  -9.49841961e-02f,
+              1.56197753e-02f,   3.23378108e-02f,   3.15139652e-03f,  -1.59871876e-02f,   6.59636594e-03f,  -2.09229439e-02f,
+              2.15267055e-02f,   6.72522560e-02f,   5.01443408e-02f,   2.91013718e-03f,  -5.33798477e-03f,   1.56303414e-03f,
+             -4.74471003e-02f,  -2.22517587e-02f,  -2.92971474e-03f,  -3.52175650e-03f,   2.42840480e-02f,   2.31578723e-02f,
+              2.63883602e-02f,   4.19580303e-02f,  -8.53833370e-03f,  -1.34237139e-02f,  -1.73577592e-02f,  -6.05879002e-04f,
+             -2.92803184e-03f,   1.44913862e-03f,   2.90087285e-03f,  -2.30093580e-02f,  -3.03077400e-02f,   3.62533843e-03f,
+             -1.02677839e-02f,  -2.64896303e-02f,  -1.10401930e-02f,   1.02896374e-02f,   5.29643893e-03f,  -1.10814171e-02f,
+             -4.12645238e-03f,   7.10646585e-02f,   9.79086906e-02f,   2.66839489e-02f,   4.31044437e-02f,   6.10861368e-02f,
+              2.22361926e-02f,  -2.89521907e-02f,   1.13170948e-02f,  -1.35379443e-02f,  -1.01605831e-02f,   1.16555870e-01f,
+              1.57563239e-01f,   1.71736684e-02f,   6.27000704e-02f,   1.14739977e-01f,   4.47970442e-02f,  -4.94704321e-02f,
+              1.11094210e-02f,   2.43409304e-03f,  -1.20573156e-02f,   5.96942715e-02f,   7.45943412e-02f,  -4.49231826e-02f,
+              1.59565881e-02f,   8.81576985e-02f,   3.97637300e-02f,  -2.93459874e-02f,  -1.90200284e-03f,  -2.53836717e-03f,
+              2.34537851e-03f,  -2.83612567e-03f,  -1.96591113e-03f,   1.60275269e-02f,   3.42012267e-03f,  -1.17904292e-02f,
+             -6.23956090e-03f,   2.43125716e-03f,  -7.61920679e-03f,  -2.09199134e-02f,   1.08197611e-02f,   2.60571651e-02f,
+              4.68802676e-02f,   1.06449597e-01f,   4.48761731e-02f,  -3.04943901e-02f,  -2.21153852e-02f,  -3.40062915e-03f,
+              2.56638112e-03f,  -2.48542801e-02f,   5.82028297e-04f,   1.02247037e-01f,   1.46674097e-01f,   8.94899443e-02f,
+              7.73852021e-02f,   5.99309281e-02f,   1.59931444e-02f,  -3.78421172e-02f,  -7.53091532e-04f,  -1.55382156e-02f,
+              2.85410811e-03f,   4.94566709e-02f,   7.32363835e-02f,   6.34501874e-02f,   4.34952006e-02f,   1.79552063e-02f,
+              1.42189790e-03f,  -1.67990793e-02f,  -2.02232297e-03f,  -3.04157590e-03f,   2.53914110e-03f,  -1.82307838e-03f,
+             -3.45309498e-04f,   1.83877051e-02f,   4.62999055e-03f,  -1.20029170e-02f,  -6.54250616e-03f,   2.16630916e-03f,
+              1.58430962e-03f,  -1.91371311e-02f,   8.61934270e-04f,   7.63238668e-02f,   1.09867707e-01f,   7.01516792e-02f,
+              5.87730072e-02f,   4.29030284e-02f,   1.08891763e-02f,  -2.79977396e-02f,   6.57952055e-02f,   1.79155730e-02f,
+             -1.49620278e-03f,  -2.80801766e-02f,  -4.93155345e-02f,   1.51208788e-02f,   5.14483005e-02f,  -9.75191873e-03f,
+             -5.89947812e-02f,   2.02468596e-02f,   4.60932516e-02f,  -3.68142128e-02f,   4.52973554e-03f,   8.91461298e-02f,
+              1.50887713e-01f,   1.16718397e-01f,   1.46392500e-02f,  -1.64916273e-02f,  -2.97050606e-02f,  -3.15120257e-02f,
+              2.41080802e-02f,  -1.22664738e-02f,   2.62439670e-03f,   2.53311358e-02f,   4.98209484e-02f,   3.22905555e-02f,
+             -2.33713519e-02f,   8.74406938e-03f,   3.38879824e-02f,  -2.70975232e-02f,  -7.83885941e-02f,   1.40117984e-02f,
+              2.51930859e-03f,  -7.11564720e-02f,  -8.69485289e-02f,  -1.56215087e-01f,  -2.00202182e-01f,   9.10047665e-02f,
+              2.93238401e-01f,  -6.87642843e-02f,  -3.27028595e-02f,  -1.54345799e-02f,   3.72274546e-03f,   1.57168973e-02f,
+              4.29353341e-02f,  -2.29350030e-02f,  -1.01458497e-01f,   3.78944017e-02f,   1.40407294e-01f,  -5.27554713e-02f,
+              1.85440592e-02f,  -3.43158729e-02f,   2.87822215e-03f,   8.53324160e-02f,   1.37100667e-01f,   1.03978992e-01f,
+              3.48556824e-02f,  -2.80346945e-02f,  -6.34735674e-02f,  -1.19603081e-02f,  -1.63709801e-02f,  -8.62707198e-02f,
+              7.47309439e-03f,   1.99414283e-01f,   3.25433582e-01f,   2.00292081e-01f,   2.15960294e-02f,  -4.64107320e-02f,
+             -7.08249509e-02f,  -4.57212105e-02f,  -6.64111087e-03f,  -5.67694865e-02f,   4.20313049e-03f,   1.36153355e-01f,
+              2.17313722e-01f,   1.44994169e-01f,   4.13233154e-02f,  -4.28225063e-02f,  -8.65871683e-02f,  -1.76317133e-02f,
+             -6.53443933e-02f,  -2.16941498e-02f,   5.31123311e-04f,   4.43550535e-02f,   6.74344599e-02f,   1.17131379e-02f,
+             -7.29480479e-03f,  -1.24529321e-02f,  -8.70689005e-03f,  -8.98707076e-04f,  -3.42356354e-01f,  -4.42210659e-02f,
+             -2.64602806e-03f,   6.56893030e-02f,   8.58745053e-02f,  -1.19689129e-01f,  -8.69141668e-02f,  -1.46309137e-02f,
+              5.61948158e-02f,   2.00405270e-02f,  -1.98678789e-03f,   1.43149635e-02f,  -5.20645268e-03f,  -4.48636115e-02f,
+             -3.70865851e-03f,   2.74192169e-02f,   6.46950956e-03f,  -2.33564489e-02f,  -5.00511639e-02f,  -5.85876126e-03f,
+              3.13479616e-03f,   3.84855643e-03f,  -1.60118639e-02f,  -7.60597736e-02f,   4.09701429e-02f,   1.57042995e-01f,
+              5.66140451e-02f,  -2.44999640e-02f,  -2.72452142e-02f,  -2.16480326e-02f,   5.27750561e-03f,  -1.19328704e-02f,
+             -1.29993381e-02f,  -3.94435711e-02f,   5.10013513e-02f,   1.52456373e-01f,   5.86722232e-02f,  -2.51435698e-03f,
+              2.44877487e-02f,  -1.88620165e-02f,  -3.86465117e-02f,  -4.60683107e-02f,  -4.42330679e-03f,  -1.01468889e-02f,
+             -5.72156161e-02f,  -2.90409345e-02f,  -1.35971690e-02f,   2.38157436e-02f,   8.11380222e-02f,  -5.17876958e-03f,
+              9.21197701e-03f,  -2.89210323e-02f,   3.40783037e-03f,   6.36806712e-02f,   3.67239155e-02f,   2.81299762e-02f,
+              1.85342971e-02f,   4.00109775e-02f,   9.84723046e-02f,   1.72533048e-03f,   9.44843329e-03f,  -2.88074464e-02f,
+             -3.01509420e-03f,   3.37184072e-02f,   5.15382290e-02f,   8.94852504e-02f,   4.06125784e-02f,   3.11993957e-02f,
+              9.04457048e-02f,  -6.95202267e-03f,   2.80955303e-02f,   1.33700846e-02f,   4.72310046e-03f,   3.97717431e-02f,
+              5.25230803e-02f,   2.87742708e-02f,   1.65081285e-02f,   6.16446603e-03f,   8.20278132e-04f,   4.44483571e-03f,
+              3.36117484e-02f,   3.02792192e-02f,   3.53125227e-03f,   1.96651760e-02f,   5.74105233e-02f,   3.89048271e-02f,
+              1.86088439e-02f,  -1.07311793e-02f,  -4.27794494e-02f,   3.42020742e-03f,   2.61514653e-02f,   2.26743706e-02f,
+              8.33363086e-03f,   4.26002033e-02f,   3.28719169e-02f,  -2.15926003e-02f,  -3.96981975e-03f,   2.51938734e-04f,
+             -2.37971172e-02f,   1.01344865e-02f,   6.07195823e-03f,   1.08203781e-03f,   1.27496198e-02f,   6.58531487e-02f,
+             -1.34510426e-02f,  -1.02726586e-01f,  -3.51956598e-02f,   1.93395447e-02f,   1.99556444e-02f,   1.66553184e-02f,
+             -5.26056625e-02f,  -3.35743763e-02f,   9.68637969e-03f,   3.03607807e-02f,  -3.73932952e-03f,  -1.98319592e-02f,
+             -4.93769236e-02f,  -3.08964588e-02f,   7.05679832e-03f,   1.40178958e-02f,  -2.08266526e-02f,  -6.42442668e-04f,
+              1.95912309e-02f,  -4.49896604e-02f,  -4.98680696e-02f,   1.72416046e-02f,   2.67976448e-02f,  -1.93713866e-02f,
+             -2.54451986e-02f,  -2.87085660e-02f,  -7.85654224e-03f,   9.78032313e-03f,   1.98746733e-02f,  -6.21417649e-02f,
+             -5.71507476e-02f,   2.63860356e-02f,   4.68301401e-02f,  -1.29643194e-02f,  -3.19732875e-02f,  -3.79735678e-02f,
+             -3.67874429e-02f,  -6.14372641e-03f,   2.83661373e-02f,  -5.68938702e-02f,  -6.89249411e-02f,   2.05187537e-02f,
+              2.89826095e-02f,  -3.13898884e-02f,  -3.37635987e-02f,  -3.71444188e-02f,  -4.30331146e-03f,  -1.00571988e-02f,
+             -8.31379090e-03f,   3.54314297e-02f,   2.76590493e-02f,  -1.61245074e-02f,  -3.08241993e-02f,   1.59870274e-03f,
+              1.68975797e-02f,   2.09457707e-02f,   7.44105354e-02f,   5.18863723e-02f,  -8.22631177e-03f,  -6.27549440e-02f,
+             -1.15245171e-02f,   3.67716141e-02f,   8.59478563e-02f,   4.12221216e-02f,  -1.97943281e-02f,  -3.17323618e-02f,
+              7.36654177e-02f,   6.21812902e-02f,   5.32651739e-03f,  -1.10865168e-01f,  -5.27767278e-02f,   5.78560084e-02f,
+              1.24709383e-01f,   3.47056873e-02f,  -4.37382162e-02f,  -6.07027039e-02f,   3.29477750e-02f,   2.11941227e-02f,
+             -5.86003205e-03f,  -1.97633412e-02f,   1.70721719e-03f,   1.27502661e-02f,   3.15335691e-02f,   1.92572903e-02f,
+             -4.79024695e-03f,  -9.22906026e-03f,  -3.35863978e-02f,  -2.08001714e-02f,   6.97601121e-03f,   1.65195558e-02f,
+             -4.81865276e-03f,  -1.14010191e-02f,  -2.91963164e-02f,  -2.00847499e-02f,   3.08657647e-03f,   7.22848997e-03f,
+             -5.44507615e-02f,  -3.15814503e-02f,   1.39753018e-02f,   1.71367880e-02f,  -1.59983709e-02f,  -1.42382123e-02f,
+             -3.94926071e-02f,  -3.37695554e-02f,   2.26486663e-04f,   5.92306769e-03f,   4.11080010e-03f,   2.89654883e-04f,
+              2.96128611e-03f,   5.62322559e-04f,  -6.39915615e-02f,  -3.20686586e-02f,   3.67007474e-03f,  -2.28255894e-02f,
+             -1.68872427e-03f,   3.78898941e-02f,   8.60444270e-03f,  -2.36272141e-02f,  -7.82132521e-03f,   1.63641367e-02f,
+             -6.89427480e-02f,  -5.32938465e-02f,  -1.55568859e-02f,  -1.62092187e-02f,   2.18633711e-02f,   3.77007574e-02f,
+             -4.98448557e-04f,   9.76749323e-03f,   5.31199109e-03f,  -6.21147687e-03f,  -1.85337290e-02f,  -1.70591485e-03f,
+              8.95525608e-03f,  -1.00016780e-02f,  -1.00689372e-02f,   1.22363362e-02f,  -7.69276638e-03f,   7.08096921e-02f,
+              3.57371457e-02f,  -4.57684025e-02f,  -7.16312602e-02f,   1.92914307e-02f,   6.15550838e-02f,  -5.02314344e-02f,
+             -7.16204941e-02f,   5.16020432e-02f,   1.03040482e-03f,   1.17620872e-02f,   7.50492699e-03f,  -7.18484167e-03f,
+             -4.73939441e-02f,  -1.47094484e-02f,   1.21296188e-02f,  -2.09486987e-02f,  -1.26745375e-02f,   2.95676794e-02f,
+             -8.80292151e-03f,   5.56179807e-02f,   2.61938944e-02f,  -3.64486463e-02f,  -1.38118807e-02f,   3.65770981e-02f,
+              4.60707955e-02f,  -2.43796408e-02f,  -5.53246439e-02f,   1.54204387e-02f,  -1.23890154e-02f,   9.66912434e-02f,
+              4.75186817e-02f,  -6.28381446e-02f,  -6.88342005e-02f,   4.09677774e-02f,   8.24988931e-02f,  -5.83007038e-02f,
+             -9.71634239e-02f,   5.33214994e-02f,  -8.79956991e-04f,   1.91661865e-02f,   1.04900952e-02f,  -1.21706668e-02f,
+             -3.78765203e-02f,  -4.10891138e-03f,   1.76533498e-02f,  -2.01615263e-02f,  -1.97907537e-02f,   2.49031689e-02f,
+              3.35528457e-04f,   2.01614555e-02f,   1.18919313e-02f,  -1.25744594e-02f,  -5.92374317e-02f,  -1.41101256e-02f,
+              1.96108092e-02f,  -2.80955378e-02f,  -2.12434139e-02f,   3.76682691e-02f,   4.88391554e-04f,   1.31376265e-02f,
+              7.93235749e-03f,  -8.14496912e-03f,  -4.27485481e-02f,  -1.12879789e-02f,   1.30014196e-02f,  -1.97807159e-02f,
+             -1.39335487e-02f,   2.69991662e-02f,  -1.42582161e-02f,   1.07627911e-02f,   9.74143948e-03f,  -2.49260827e-03f,
+             -7.11621810e-03f,  -1.48825627e-03f,   1.49402171e-04f,  -1.47347329e-02f,  -6.92560757e-03f,   1.59605499e-02f,
+             -9.68130957e-03f,  -1.74680538e-02f,  -1.00399032e-02f,   4.00928780e-03f,  -1.03790648e-02f,  -2.79928874e-02f,
+             -1.93574727e-02f,   5.72479283e-03f,   8.80950131e-03f,  -6.94361562e-03f,  -1.54795833e-02f,   1.08468868e-02f,
+              1.00126956e-02f,  -2.51330948e-03f,  -7.91338645e-03f,  -2.52820598e-03f,  -4.95843764e-04f,  -1.54649876e-02f,
+             -7.06192339e-03f,   1.67264454e-02f,   4.03932808e-03f,   7.55464137e-02f,   5.00718951e-02f,  -1.73812527e-02f,
+              1.96129754e-02f,   8.60163197e-02f,   6.16861545e-02f,  -4.57240231e-02f,  -4.09013145e-02f,   5.18835075e-02f,
+              1.88344084e-02f,   6.31070584e-02f,   3.91090922e-02f,  -1.45022199e-02f,   2.67125051e-02f,   8.61760899e-02f,
+              6.05326444e-02f,  -2.96273585e-02f,  -3.30216065e-02f,   3.44096199e-02f,   4.19897214e-03f,   7.28984401e-02f,
+              4.82638665e-02f,  -1.67716909e-02f,   1.91267729e-02f,   8.32804367e-02f,   5.96994199e-02f,  -4.39544134e-02f,
+             -3.94453742e-02f,   4.98909317e-02f,  -3.25013176e-02f,   2.19715480e-02f,   2.04832330e-02f,  -5.09224553e-03f,
+             -1.67948939e-02f,  -6.18262496e-03f,  -1.67163590e-03f,  -3.19609642e-02f,  -1.43895447e-02f,   3.45430858e-02f,
+             -3.31787765e-02f,   2.59185350e-03f,   7.57537223e-03f,  -6.33089396e-04f,  -2.15864796e-02f,  -2.79157832e-02f,
+             -1.72868799e-02f,  -2.00327132e-02f,  -3.87068628e-03f,   2.10263357e-02f,  -2.62117013e-02f,  -1.78771913e-02f,
+             -7.40872696e-03f,   4.08519898e-03f,  -2.15146411e-02f,  -4.37530279e-02f,  -2.93057039e-02f,  -3.17636575e-03f,
+              7.80841103e-03f,   2.31181062e-03f,  -8.32570437e-03f,   8.13205447e-03f,   6.93007605e-03f,  -1.88064179e-03f,
+             -3.74170393e-03f,   1.14290102e-03f,   1.53818540e-03f,  -9.77682881e-03f,  -5.05153881e-03f,   1.06455553e-02f,
+              2.96170004e-02f,   4.34147455e-02f,   5.30934669e-02f,   1.40006263e-02f,   5.56936080e-04f,  -1.94591098e-02f,
+             -4.87018339e-02f,  -3.41853797e-02f,  -9.20642633e-03f,  -4.73509915e-02f,   1.23246871e-02f,   2.11399216e-02f,
+              2.68877447e-02f,   1.31000802e-02f,  -1.13951201e-02f,  -3.30756530e-02f,  -3.26280743e-02f,  -1.09192207e-02f,
+              6.00418495e-03f,  -3.00218761e-02f,   2.93474644e-03f,  -3.33176227e-03f,  -6.64510438e-03f,  -1.66790802e-02f,
+              2.89331321e-02f,   6.01102822e-02f,   2.58766934e-02f,  -1.15999309e-02f,  -2.53404342e-02f,   2.09336597e-02f,
+             -2.57554883e-03f,  -1.96133312e-02f,  -2.93190926e-02f,  -3.87003906e-02f,   5.98654486e-02f,   1.30405173e-01f,
+              6.79346547e-02f,  -1.40658896e-02f,  -4.98812012e-02f,   5.72840162e-02f,   1.73980836e-02f,   8.44731461e-03f,
+              4.58709290e-03f,  -3.21413465e-02f,   6.48492426e-02f,   1.27181783e-01f,   3.99896130e-02f,  -3.84309366e-02f,
+             -5.99881150e-02f,   2.94398386e-02f,   1.38841281e-02f,   7.21998047e-03f,   4.40739607e-03f,  -2.45164800e-02f,
+              4.99401204e-02f,   9.76032391e-02f,   2.99870372e-02f,  -3.01537924e-02f,  -4.63399105e-02f,   2.18864735e-02f,
+             -2.82795019e-02f,  -3.36035080e-02f,  -3.84513400e-02f,   5.21138869e-03f,  -3.02302819e-02f,  -4.52209339e-02f,
+              1.49275176e-02f,   4.10874300e-02f,   3.39129493e-02f,   1.88588239e-02f,  -2.62113009e-02f,  -3.85286361e-02f,
+             -4.71538343e-02f,  -1.26420408e-02f,  -9.11013922e-05f,   1.80846490e-02f,   4.35287245e-02f,   3.01400907e-02f,
+              7.80788669e-03f,   4.22625765e-02f,  -2.18222626e-02f,  -3.69942002e-02f,  -4.69271168e-02f,  -2.21622884e-02f,
+              1.85253434e-02f,   5.50173372e-02f,   5.60163893e-02f,   1.98032502e-02f,  -9.23448149e-03f,   5.16920760e-02f,
+              1.40128797e-02f,   2.05609333e-02f,   2.51513924e-02f,   6.67115627e-03f,   1.88458420e-04f,  -9.36803874e-03f,
+             -2.31224000e-02f,  -1.61530022e-02f,  -4.29241080e-03f,  -2.24700719e-02f,   8.47545732e-03f,   5.55330329e-03f,
+              3.11590196e-03f,  -1.64158355e-05f,  -9.98368487e-03f,   3.11447284e-03f,   8.02053977e-03f,   7.56083475e-03f,
+             -1.11021129e-02f,  -6.91812718e-03f,   7.17176183e-04f,   2.75504217e-03f,   1.34678576e-02f,  -1.01809367e-03f,
+             -1.25837764e-02f,  -9.60825291e-03f,  -1.25241252e-02f,  -1.05856778e-03f,  -1.88306859e-03f,  -1.04443636e-02f,
+              2.20154002e-02f,   4.98573482e-03f,  -4.64490727e-02f,   4.15707612e-03f,   2.25572810e-02f,   4.88675609e-02f,
+              7.53707662e-02f,   2.66550276e-02f,  -2.49403957e-02f,   2.27544177e-02f,   3.81763317e-02f,   9.12411604e-03f,
+             -7.77813047e-02f,   6.99579017e-03f,   3.66579741e-02f,   8.26729089e-02f,   1.27933949e-01f,   4.58661728e-02f,
+             -4.34460752e-02f,   3.73934768e-02f,   1.53423660e-03f,   9.69586079e-04f,   3.57879966e-04f,   1.29027239e-05f,
+             -1.62397081e-03f,   7.17918738e-04f,   1.65802904e-03f,   1.39518781e-03f,  -1.99498329e-03f,  -1.09839381e-03f,
+             -3.35892960e-02f,  -2.04144754e-02f,  -3.13832611e-03f,  -6.44128420e-04f,   3.13782468e-02f,  -1.92289613e-02f,
+             -4.09958102e-02f,  -3.11491899e-02f,   4.33408432e-02f,   2.05404330e-02f,  -3.01870308e-03f,  -4.08314960e-03f,
+             -1.32744526e-02f,   9.42508748e-04f,   1.43706845e-02f,   7.98533019e-03f,   9.30670742e-03f,  -1.12829870e-03f,
+              4.82357945e-03f,   1.15468223e-02f,   1.39656814e-03f,   1.14412847e-04f,  -4.11296217e-03f,   3.53520882e-04f,
+              2.46793032e-03f,   3.97200650e-03f,   5.94751490e-03f,   1.84091472e-03f,  -1.49876042e-03f,   2.31436081e-03f,
+              2.31805351e-02f,   9.18593083e-04f,  -7.39331990e-02f,   6.30404055e-03f,   4.59999442e-02f,   7.01637864e-02f,
+              1.04382902e-01f,   3.12845856e-02f,  -2.44718716e-02f,   4.26443294e-02f,   2.75163203e-02f,   9.21608415e-03f,
+             -4.08093482e-02f,   3.86788859e-03f,   1.28614893e-02f,   4.81845364e-02f,   7.69594312e-02f,   3.10970452e-02f,
+             -3.24046351e-02f,   1.55633390e-02f,   1.34691391e-02f,   2.38248776e-03f,  -4.95460741e-02f,  -3.73290107e-02f,
+             -2.88809277e-02f,  -5.55785485e-02f,   1.29106045e-02f,  -3.69072296e-02f,  -3.98736484e-02f,  -5.31755760e-02f,
+              3.87368491e-03f,  -2.59107705e-02f,  -7.51562193e-02f,  -4.98218499e-02f,  -3.70798595e-02f,  -8.07076618e-02f,
+             -3.03552039e-02f,  -5.62669970e-02f,  -5.08956499e-02f,  -7.22069740e-02f,   1.94514152e-02f,   1.43968938e-02f,
+             -4.64611463e-02f,  -3.78070027e-02f,  -2.98549104e-02f,  -5.36007062e-02f,   3.26792561e-02f,  -3.44928317e-02f,
+             -4.13409546e-02f,  -5.33476323e-02f,   6.20145525e-04f,  -7.11197685e-03f,  -1.88194104e-02f,  -1.23318592e-02f,
+             -9.14275553e-03f,  -2.01334637e-02f,  -8.65621120e-03f,  -1.40954452e-02f,  -1.25418762e-02f,  -1.79022681e-02f,
+             -3.20335142e-02f,  -7.03783482e-02f,  -3.03610452e-02f,  -6.32341811e-03f,  -1.32387923e-03f,  -2.53002476e-02f,
+             -1.13598496e-01f,  -2.33037341e-02f,  -1.10360759e-03f,  -1.20132547e-02f,  -2.74813268e-02f,  -6.75889850e-02f,
+             -4.25623469e-02f,  -1.60236042e-02f,  -8.93818960e-03f,  -3.92556302e-02f,  -1.06693469e-01f,  -3.23714912e-02f,
+             -1.16382968e-02f,  -2.57391222e-02f,  -1.90150586e-03f,  -1.97992250e-02f,  -3.75768952e-02f,  -2.33332347e-02f,
+             -1.69793405e-02f,  -3.95181812e-02f,  -2.67537385e-02f,  -2.81980969e-02f,  -2.32242495e-02f,  -3.41423713e-02f,
+             -2.55465694e-02f,  -8.74623805e-02f,  -9.59747508e-02f,  -5.10951020e-02f,  -3.49577479e-02f,  -9.64355022e-02f,
+             -1.30734265e-01f,  -7.23735690e-02f,  -4.73352484e-02f,  -7.66377375e-02f,  -1.65868197e-02f,  -5.16390800e-02f,
+             -5.05242459e-02f,  -2.56088339e-02f,  -1.71274152e-02f,  -5.00846170e-02f,  -7.82881081e-02f,  -3.81533727e-02f,
+             -2.31014472e-02f,  -3.87421101e-02f,  -2.82283733e-03f,   1.75453518e-02f,   5.17075285e-02f,   3.43422666e-02f,
+              2.55750772e-02f,   5.55612072e-02f,   2.04086415e-02f,   3.87090370e-02f,   3.51075865e-02f,   4.97589894e-02f,
+             -6.76181726e-03f,  -1.48606263e-02f,  -3.44923697e-02f,  -2.77646817e-02f,   1.09171728e-02f,   1.87525768e-02f,
+              4.02982021e-03f,   2.36484539e-02f,   2.04635095e-02f,  -6.44547585e-03f,  -3.60654201e-03f,  -1.04455231e-02f,
+             -5.56741050e-03f,   5.52107056e-04f,   6.06219657e-02f,   1.53130256e-02f,  -1.92480665e-02f,   6.12745807e-02f,
+              3.91349010e-02f,  -3.49799469e-02f,  -3.16141685e-03f,  -1.18738580e-02f,   8.95884633e-03f,   1.70534030e-02f,
+              1.12250298e-01f,   1.91518944e-02f,  -3.99533249e-02f,   1.06201626e-01f,   6.47453442e-02f,  -6.46863654e-02f,
+             -4.27774433e-03f,  -1.60741787e-02f,   1.21607222e-02f,   2.31211260e-02f,   1.52051076e-01f,   2.59305220e-02f,
+             -5.41253127e-02f,   1.43848181e-01f,   8.76920670e-02f,  -8.76222104e-02f,  -1.21962130e-02f,  -3.15125883e-02f,
+             -3.82346250e-02f,  -2.13691778e-02f,   1.22111037e-01f,   4.37500812e-02f,  -3.27234305e-02f,   1.33602619e-01f,
+              8.96537378e-02f,  -7.05780834e-02f,  -5.76461526e-03f,  -1.56964436e-02f,  -1.39885200e-02f,  -5.21136681e-03f,
+              7.51573965e-02f,   2.23690681e-02f,  -2.22770777e-02f,   7.86354765e-02f,   5.13570458e-02f,  -4.33980525e-02f,
+             -2.97456607e-03f,  -6.12091413e-03f,  -1.72937792e-02f,  -1.47525547e-02f,  -4.25409758e-03f,   7.37163192e-03f,
+              5.30909374e-03f,   2.36087386e-03f,   4.33806423e-03f,   2.37755454e-03f,   1.01844431e-03f,   2.70608184e-03f,
+              2.81275553e-03f,   1.32943178e-03f,  -1.18200639e-02f,  -3.81066394e-03f,   3.36637557e-03f,  -1.25978608e-02f,
+             -8.32243729e-03f,   6.82791974e-03f,   4.40950645e-03f,   1.01855863e-02f,   1.99738629e-02f,   1.50895882e-02f,
+             -1.78796574e-02f,  -1.32717704e-02f,   1.57368893e-03f,  -2.49767303e-02f,  -1.88859813e-02f,   1.03968373e-02f,
+              5.17751090e-03f,   9.69615486e-03f,   3.49794105e-02f,   3.15185450e-02f,   2.82396954e-02f,  -1.08117359e-02f,
+             -1.73764508e-02f,   1.43920602e-02f,   3.17877415e-03f,  -1.61309205e-02f,  -2.18014177e-02f,  -4.50736955e-02f,
+             -5.35928719e-02f,  -1.14027113e-01f,  -3.54150757e-02f,  -7.51969144e-02f,  -5.77072129e-02f,  -2.25205980e-02f,
+              6.45779015e-04f,  -1.92292836e-02f,   3.98078337e-02f,  -2.81619816e-03f,  -9.92688816e-03f,  -1.19235395e-02f,
+              3.61342542e-02f,   4.96275397e-03f,   4.30000108e-03f,   2.21483093e-02f,   5.78167709e-03f,  -4.24698219e-02f,
+              9.79917347e-02f,  -6.38382696e-03f,  -2.37415563e-02f,  -2.79324893e-02f,   8.91326591e-02f,   1.30693493e-02f,
+              1.12363547e-02f,   5.46429828e-02f,   1.41874254e-02f,  -1.04044519e-01f,   2.01724730e-02f,  -2.46449336e-02f,
+             -3.44309658e-02f,  -6.60876036e-02f,   1.05283493e-02f,  -3.35844159e-02f,  -2.53900308e-02f,   6.04831940e-03f,
+              4.82857320e-03f,  -4.26835194e-02f,   5.11270538e-02f,  -1.65104736e-02f,  -2.90764961e-02f,  -4.86588106e-02f,
+              4.20870371e-02f,  -1.36730205e-02f,  -9.78715252e-03f,   2.55721416e-02f,   8.48009344e-03f,  -6.62978590e-02f,
+              4.31063399e-03f,  -3.46230492e-02f,  -4.45316583e-02f,  -9.00437608e-02f,  -7.59048620e-03f,  -5.28206453e-02f,
+             -4.02839407e-02f,  -5.25114732e-03f,   3.43257235e-03f,  -3.58784087e-02f,  -1.98954940e-02f,  -6.24134429e-02f,
+             -7.58545920e-02f,  -1.59092903e-01f,  -3.94520722e-02f,  -1.01709642e-01f,  -7.79305845e-02f,  -2.52951533e-02f,
+              2.32959446e-03f,  -3.69442217e-02f,  -8.95866081e-02f,  -6.46950826e-02f,  -6.76080957e-02f,  -1.56869799e-01f,
+             -1.05129309e-01f,  -1.21611029e-01f,  -9.40220356e-02f,  -6.56774789e-02f,  -7.20253726e-03f,   3.08338329e-02f,
+             -8.55340511e-02f,  -1.72779560e-02f,  -8.21173564e-03f,  -3.47132124e-02f,  -8.54605511e-02f,  -4.69355285e-02f,
+             -3.69403958e-02f,  -5.27895354e-02f,  -1.05151134e-02f,   6.99903294e-02f,  -7.94330463e-02f,  -2.20788475e-02f,
+             -1.52659221e-02f,  -4.78403457e-02f,  -8.13871324e-02f,  -5.29683158e-02f,  -4.14694846e-02f,  -5.03689647e-02f,
+             -9.27169062e-03f,   5.94989322e-02f,  -1.11104539e-02f,  -1.18223466e-02f,  -1.36676589e-02f,  -9.09136701e-03f,
+             -1.28849018e-02f,  -7.96926487e-03f,   6.49546925e-03f,   1.48551520e-02f,   3.27053778e-02f,   4.07859311e-03f,
+             -7.72099616e-03f,  -1.03921304e-02f,  -1.29526136e-02f,  -4.85068886e-03f,   1.40052382e-02f,   1.09905042e-02f,
+              3.74222873e-03f,   1.22590987e-02f,   1.04026338e-02f,  -3.54639022e-03f,  -3.98727041e-03f,  -6.55157911e-03f,
+             -8.56969319e-03f,  -1.70622778e-03f,   1.97320767e-02f,   1.46741839e-02f,   1.51244563e-03f,   7.38471840e-03f,
+             -1.33802590e-03f,  -5.30521339e-03f,  -1.94842909e-02f,  -2.20272336e-02f,  -2.60235462e-02f,  -1.50707802e-02f,
+             -8.94021802e-03f,  -4.14464250e-03f,   1.09320590e-02f,   2.72027161e-02f,   5.00241481e-02f,   3.35741765e-03f,
+             -2.13088244e-02f,  -2.61989813e-02f,  -3.18080932e-02f,  -1.50602330e-02f,   1.24716992e-02f,   1.14845177e-02f,
+              1.12079503e-02f,   3.16259228e-02f,   4.27644290e-02f,  -2.51152739e-03f,  -1.74363367e-02f,  -2.21230667e-02f,
+             -2.71152537e-02f,  -1.18613541e-02f,   1.74341947e-02f,   1.46016208e-02f,   8.92814156e-03f,   2.64879987e-02f,
+              3.11120134e-02f,  -4.06414457e-03f,   1.19863031e-03f,   4.08451218e-04f,   9.83883874e-05f,   1.56525907e-03f,
+              1.05359610e-02f,   7.44394213e-03f,  -1.00814842e-03f,  -8.31491663e-04f,  -8.43817648e-03f,  -2.98178592e-03f,
+              1.21016689e-02f,   1.43409139e-02f,   1.72105059e-02f,   8.91563576e-03f,  -1.40784355e-03f,  -2.43675173e-03f,
+             -6.55593956e-03f,  -1.74824484e-02f,  -2.73332559e-02f,  -1.50837921e-04f,   2.39364598e-02f,   2.85817645e-02f,
+              3.43846306e-02f,   1.74889099e-02f,  -5.06535685e-03f,  -6.46166876e-03f,  -1.28906444e-02f,  -3.47716548e-02f,
+             -5.28393649e-02f,   3.35494202e-04f,   1.70486141e-02f,   2.07192078e-02f,   2.50648558e-02f,   1.22123491e-02f,
+             -7.42655341e-03f,  -7.35145435e-03f,  -9.05294251e-03f,  -2.50879005e-02f,  -3.55845094e-02f,   1.30024715e-03f,
+              7.10169226e-03f,  -2.50479300e-03f,  -1.34003330e-02f,  -9.54742450e-03f,  -7.85184503e-02f,  -5.65771684e-02f,
+             -4.36961055e-02f,  -2.93048099e-03f,   4.77825180e-02f,   5.96606173e-02f,  -2.70638242e-03f,  -8.39875638e-03f,
+             -1.77340303e-02f,  -1.02204336e-02f,   3.90492554e-04f,  -5.28136594e-03f,  -7.46983755e-03f,   3.80955823e-03f,
+              6.91022631e-03f,   8.96150526e-03f,  -7.24569289e-03f,  -5.81441028e-03f,  -6.76745735e-03f,  -2.66085914e-03f,
+              5.36831878e-02f,   3.37039754e-02f,   2.29960997e-02f,   5.39959176e-03f,  -2.62725782e-02f,  -3.25051621e-02f,
+              2.84130452e-03f,   6.27260329e-03f,   1.24035887e-02f,   6.95922086e-03f,  -8.44508596e-03f,  -1.75863865e-03f,
+              1.27909705e-03f,  -3.26682208e-03f,  -4.20137803e-04f,  -7.83956610e-04f,  -4.42380272e-03f,  -1.06998961e-02f,
+             -2.15919893e-02f,  -1.22187007e-02f,   1.02006402e-02f,   5.86000788e-05f,  -4.39947797e-03f,   5.35512390e-03f,
+              3.16170440e-03f,   4.38479427e-03f,  -1.79070625e-02f,  -3.13985795e-02f,  -5.83094470e-02f,  -3.18077579e-02f,
+              7.89064094e-02f,   3.44266072e-02f,   1.29158357e-02f,   1.82471219e-02f,  -1.91969592e-02f,  -2.26243753e-02f,
+             -1.11372042e-02f,  -1.91588476e-02f,  -3.53633426e-02f,  -1.92354228e-02f,   5.02415672e-02f,   2.24713739e-02f,
+              8.98544304e-03f,   1.12423711e-02f,  -1.29313506e-02f,  -1.53227560e-02f,   1.16197653e-02f,   2.03141049e-02f,
+              3.76895517e-02f,   2.05506124e-02f,  -5.13919108e-02f,  -2.25119703e-02f,  -8.53627361e-03f,  -1.18230917e-02f,
+              1.26184719e-02f,   1.48848416e-02f,   2.08360180e-02f,   4.12401631e-02f,   7.93385878e-02f,   4.39831354e-02f,
+             -7.69542903e-02f,  -2.65524630e-02f,  -2.89198989e-03f,  -2.25865077e-02f,   9.69852321e-03f,   1.03770215e-02f,
+              1.22612230e-02f,   2.60512661e-02f,   5.10417968e-02f,   2.85242647e-02f,  -3.96552347e-02f,  -1.05083566e-02f,
+              2.89638666e-03f,  -1.38046285e-02f,   9.18824400e-04f,   6.41929291e-05f,   4.24264651e-03f,  -8.70652962e-04f,
+             -5.63018909e-03f,  -2.86324555e-03f,   6.41313614e-03f,   1.00014620e-02f,   5.33880014e-03f,  -2.41147610e-03f,
+             -2.03976160e-04f,   1.03782350e-03f,   3.41093056e-02f,   1.76426098e-02f,   2.29187706e-03f,   7.91727449e-04f,
+              8.93091131e-03f,   4.95891087e-03f,  -1.75740160e-02f,  -4.64016423e-02f,  -3.44121754e-02f,  -5.88446064e-03f,
+              5.49700931e-02f,   2.22084410e-02f,  -8.31824075e-03f,  -4.73827310e-03f,   2.51599755e-02f,   2.70486176e-02f,
+             -1.30419983e-02f,  -6.79570064e-02f,  -4.71805893e-02f,  -5.88957174e-03f,   1.83395017e-02f,  -1.25746801e-03f,
+             -1.95009895e-02f,  -9.95528884e-03f,   2.33865846e-02f,   3.55598889e-02f,   1.69255026e-02f,  -1.31712668e-02f,
+             -4.21457971e-03f,   3.03918333e-03f,  -1.85076781e-02f,  -4.46273945e-02f,  -6.88942671e-02f,  -3.43017466e-02f,
+              5.57942875e-02f,   1.04638167e-01f,   9.55931768e-02f,   6.36061728e-02f,   6.52916655e-02f,   2.34329514e-02f,
+             -7.30843283e-03f,  -7.51674995e-02f,  -1.38259307e-01f,  -6.91490769e-02f,   1.21578015e-01f,   2.17508912e-01f,
+              1.79018602e-01f,   8.82008970e-02f,   1.02312580e-01f,   4.24789749e-02f,  -3.37673933e-04f,  -5.49135320e-02f,
+             -1.05661608e-01f,  -5.29003888e-02f,   9.46033671e-02f,   1.67548686e-01f,   1.34555817e-01f,   6.04670905e-02f,
+              7.31388777e-02f,   3.16637978e-02f,   1.13310525e-02f,  -2.24635862e-02f,  -5.39011173e-02f,  -2.71060485e-02f,
+              5.19647487e-02f,   8.83702040e-02f,   6.36973307e-02f,   1.56362336e-02f,   2.62375008e-02f,   1.43993646e-02f,
+              2.09256168e-02f,  -1.29012195e-02f,  -4.43796143e-02f,  -2.24387906e-02f,   4.65199798e-02f,   7.56818727e-02f,
+              4.74618748e-02f,  -2.45846715e-03f,   1.04405200e-02f,   1.00883236e-02f,   2.44733393e-02f,   2.70926245e-02f,
+              2.95003485e-02f,   1.45153021e-02f,  -1.85613744e-02f,  -4.06358615e-02f,  -4.80444655e-02f,  -4.91164997e-02f,
+             -4.38868105e-02f,  -1.25561524e-02f,   2.08185725e-02f,  -1.28851896e-02f,  -3.48443724e-02f,   6.88781776e-03f,
+              6.77709207e-02f,   7.51615241e-02f,  -4.77775233e-03f,  -9.41943303e-02f,  -6.99622557e-02f,  -2.87244655e-02f,
+              6.84331954e-02f,  -3.63380201e-02f,  -1.23116672e-01f,  -6.23589121e-02f,   1.13051884e-01f,   2.32240304e-01f,
+              1.06431425e-01f,  -8.33954141e-02f,  -3.22936699e-02f,  -3.36949937e-02f,   4.34302576e-02f,  -2.12359875e-02f,
+             -8.07370916e-02f,  -6.53623492e-02f,   3.84605788e-02f,   1.42890856e-01f,   1.04598768e-01f,   1.57080386e-02f,
+              3.94770727e-02f,  -2.96127028e-03f,   4.71101701e-02f,  -2.29684878e-02f,  -8.76733959e-02f,  -7.18450621e-02f,
+              4.05002832e-02f,   1.54833496e-01f,   1.14818677e-01f,   1.95527375e-02f,   4.50185090e-02f,  -2.53744237e-03f,
+              1.67557523e-02f,  -8.31863843e-03f,  -3.09699345e-02f,  -2.34428085e-02f,   1.71289947e-02f,   5.54379635e-02f,
+              3.78052518e-02f,   1.33728166e-03f,   1.11036450e-02f,  -2.41024117e-03f,   4.66900170e-02f,  -2.55306438e-02f,
+             -8.29464421e-02f,  -3.21170352e-02f,   9.05935839e-02f,   1.60269797e-01f,   5.76301701e-02f,  -8.46548826e-02f,
+             -4.62865606e-02f,  -3.04396022e-02f,   5.01287133e-02f,  -2.74579823e-02f,  -8.89883637e-02f,  -3.38182040e-02f,
+              9.81231555e-02f,   1.72189429e-01f,   6.09201640e-02f,  -9.26575735e-02f,  -5.12403212e-02f,  -3.31560075e-02f,
+              2.12059300e-02f,  -1.15213217e-02f,  -3.77790444e-02f,  -1.56370495e-02f,   3.97909917e-02f,   7.26091042e-02f,
+              2.76834741e-02f,  -3.56544964e-02f,  -1.85808465e-02f,  -1.30751152e-02f,   9.91685595e-03f,  -4.98379208e-03f,
+             -1.82433426e-02f,  -1.30210221e-02f,   1.12395417e-02f,   3.29597071e-02f,   2.11484861e-02f,  -1.48032198e-03f,
+              4.58659418e-03f,  -2.03629397e-03f,  -9.17293597e-04f,   7.01819488e-04f,   1.34412362e-03f,  -2.19754642e-03f,
+             -5.43096010e-03f,  -3.64205823e-03f,   2.93208845e-03f,   9.19148698e-03f,   7.48756202e-03f,   2.61879526e-03f,
+              7.39291823e-03f,   1.39873866e-02f,   3.57796252e-02f,   6.48405254e-02f,  -2.13365406e-02f,  -1.26163229e-01f,
+             -1.28393799e-01f,  -9.07151550e-02f,  -4.46206890e-02f,   4.56232093e-02f,   3.36414785e-04f,   1.75982825e-02f,
+              5.10172322e-02f,   9.16832611e-02f,  -1.13772359e-02f,  -1.51151136e-01f,  -1.55515492e-01f,  -1.02601439e-01f,
+             -5.05607575e-02f,   6.09751642e-02f,  -1.00063840e-02f,   9.17735137e-03f,   3.34205069e-02f,   5.92873283e-02f,
+              1.16336532e-02f,  -7.02133477e-02f,  -7.42587447e-02f,  -4.04083319e-02f,  -2.00308487e-02f,   3.58572826e-02f,
+             -2.54270751e-02f,   2.19613267e-03f,   2.34149303e-02f,   4.01459821e-02f,   4.25221846e-02f,   2.67637405e-03f,
+             -2.29433575e-03f,   1.99583359e-02f,   9.53979418e-03f,   1.77631844e-02f,  -3.68648618e-02f,  -2.81568570e-03f,
+              1.64777674e-02f,   2.68183295e-02f,   6.53307214e-02f,   5.53145148e-02f,   4.96156961e-02f,   6.37680143e-02f,
+              3.09971143e-02f,   4.91984887e-03f,  -3.06247883e-02f,  -8.24564660e-04f,   1.80985313e-02f,   3.02017387e-02f,
+              5.33430837e-02f,   3.29678655e-02f,   2.78530493e-02f,   4.41814102e-02f,   2.14170124e-02f,   9.34615359e-03f,
+             -2.21811254e-02f,   7.74272811e-03f,   3.73926647e-02f,   6.55037388e-02f,   3.35189998e-02f,  -4.76185642e-02f,
+             -5.34191616e-02f,  -1.64184496e-02f,  -8.34982749e-03f,   3.57294120e-02f,  -6.57961965e-02f,   1.42841609e-02f,
+              8.56347755e-02f,   1.48879975e-01f,   1.04755171e-01f,  -6.68122098e-02f,  -8.18363354e-02f,   1.70898577e-03f,
+              7.57803573e-05f,   7.58326054e-02f,  -1.05630383e-02f,  -4.11150366e-04f,   5.87345846e-03f,   9.75408498e-03f,
+              1.84767451e-02f,   1.24577517e-02f,   1.07254144e-02f,   1.59747805e-02f,   7.74974283e-03f,   2.78354529e-03f,
+              4.84857112e-02f,  -3.00835958e-03f,  -4.12148498e-02f,  -7.03829676e-02f,  -8.18071291e-02f,  -1.52137345e-02f,
+             -6.03171298e-03f,  -4.49044295e-02f,  -2.15652753e-02f,  -2.97765695e-02f,  -1.61347701e-03f,   3.82512212e-02f,
+              5.28959036e-02f,   5.18217720e-02f,   7.81496689e-02f,   1.02630618e-03f,  -8.20022300e-02f,  -1.06622443e-01f,
+             -7.66594112e-02f,   4.46816757e-02f,  -7.23232341e-04f,   1.05054323e-02f,   1.68536101e-02f,   1.77026056e-02f,
+              2.98543088e-02f,   5.10738511e-03f,  -1.95398293e-02f,  -2.71142852e-02f,  -2.30026338e-02f,   6.51319185e-03f,
+              1.38828077e-03f,  -2.17304435e-02f,  -3.39670368e-02f,  -3.52832191e-02f,  -5.85264675e-02f,  -8.70879553e-03f,
+              4.15646918e-02f,   5.69198802e-02f,   4.68314327e-02f,  -1.56870596e-02f,   1.49871060e-03f,  -2.98755486e-02f,
+             -4.32944261e-02f,  -4.34296951e-02f,  -6.81832582e-02f,  -4.91087791e-03f,   6.15076348e-02f,   8.14289525e-02f,
+              6.15331270e-02f,  -2.99943108e-02f,  -2.12537125e-03f,   2.28204858e-03f,   2.00065635e-02f,   2.82298289e-02f,
+              6.54486716e-02f,   3.50181758e-02f,   1.67064257e-02f,   9.35036223e-03f,  -1.86899193e-02f,  -3.90486643e-02f,
+             -5.70456870e-03f,   6.01665638e-02f,   1.09499432e-01f,   1.20743319e-01f,   2.17788622e-01f,   5.61689362e-02f,
+             -9.52765718e-02f,  -1.43190250e-01f,  -1.42610490e-01f,   5.18084317e-03f,  -4.31272760e-03f,   6.88458458e-02f,
+              1.06902741e-01f,   1.10723078e-01f,   1.82858095e-01f,   2.61164866e-02f,  -1.32595256e-01f,  -1.80994853e-01f,
+             -1.47774741e-01f,   5.14588803e-02f,  -9.86215193e-04f,   4.48205285e-02f,   5.44700027e-02f,   4.95177805e-02f,
+              6.44791126e-02f,  -1.43775186e-02f,  -1.05711743e-01f,  -1.31936356e-01f,  -8.35333616e-02f,   7.09471703e-02f,
+              2.50994508e-05f,   2.33894307e-02f,   2.39425860e-02f,   1.91538166e-02f,   1.74787827e-02f,  -1.68015510e-02f,
+             -6.09106198e-02f,  -7.30298162e-02f,  -3.98365483e-02f,   4.81197163e-02f,   5.93927834e-05f,  -7.17597641e-03f,
+             -7.90286623e-03f,  -6.70767576e-03f,  -7.37248780e-03f,   3.99892125e-03f,   1.79734696e-02f,   2.18863524e-02f,
+              1.26887877e-02f,  -1.33840311e-02f,
+        };
+
+        // The row and column parts of the separable filters, in the same order as
+        // num_separable_filters.
+        static const float DM_ALIGNED(32) row_filters[3050] = {
+             -1.01220600e-01f,   1.53492197e-01f,   2.26456404e-01f,   2.49997571e-01f,  -1.94796268e-02f,  -3.67272161e-02f,
+             -1.40540674e-01f,  -1.16149135e-01f,   7.60526806e-02f,   8.29186141e-02f,  -6.72045201e-02f,  -1.03833117e-01f,
+             -3.28945965e-02f,   5.74213974e-02f,  -1.24588184e-01f,  -6.94594607e-02f,   6.79422589e-03f,   4.01345752e-02f,
+              3.92562039e-02f,  -1.42294297e-03f,  -1.73523873e-01f,  -3.28471005e-01f,  -3.19017798e-01f,  -2.36909956e-01f,
+             -1.71251729e-01f,  -1.11989513e-01f,   1.46903828e-01f,   1.35988757e-01f,   8.15168917e-02f,   3.36274765e-02f,
+             -6.92564920e-02f,   2.22178269e-02f,   1.22147709e-01f,   1.42729536e-01f,  -3.05886745e-01f,  -2.28301540e-01f,
+              3.67265530e-02f,  -8.98456424e-02f,  -3.68707851e-02f,  -1.81685505e-03f,  -5.04373759e-03f,  -1.89174131e-01f,
+             -1.83447942e-01f,  -6.03992976e-02f,   2.47381017e-01f,   1.76695809e-01f,   3.54287997e-02f,   2.20513433e-01f,
+              9.72130224e-02f,   1.70492008e-01f,  -1.31325036e-01f,  -1.10723898e-01f,  -9.73371565e-02f,   3.31954919e-02f,
+              5.74784242e-02f,   1.12263281e-02f,  -3.05044763e-02f,  -1.34531647e-01f,  -1.12496920e-01f,  -7.02646449e-02f,
+              2.19262615e-02f,  -4.59409542e-02f,  -3.94208580e-02f,   1.20618522e-01f,   1.62886187e-01f,  -1.28877804e-01f,
+              6.18004501e-02f,   3.62436205e-01f,   5.85090928e-02f,   6.05591610e-02f,   1.47469994e-02f,  -8.45286548e-02f,
+             -1.15963109e-01f,  -9.78088155e-02f,   6.07048906e-03f,   1.24908589e-01f,   1.39039159e-01f,   2.11394690e-02f,
+              1.30673246e-02f,   1.83244552e-02f,  -5.67372628e-02f,  -8.37569237e-02f,   3.29652846e-01f,   3.79902750e-01f,
+             -1.56154484e-01f,  -5.13966799e-01f,   9.36734453e-02f,   4.50344294e-01f,   7.83689246e-02f,  -6.81003854e-02f,
+              6.96629286e-02f,   1.50892092e-02f,  -8.59011337e-02f,  -1.52586490e-01f,  -2.65562922e-01f,  -2.80838281e-01f,
+             -2.96396315e-01f,  -1.42189428e-01f,  -2.01213211e-02f,   1.36995865e-02f,  -1.10034244e-02f,   5.85709736e-02f,
+              3.56459141e-01f,   2.82986522e-01f,  -5.13099730e-01f,  -2.97177404e-01f,   2.55617499e-01f,   3.08568925e-01f,
+              1.57496288e-01f,  -7.60540143e-02f,  -6.42255098e-02f,  -2.16998160e-02f,   5.14511317e-02f,   3.35111976e-01f,
+              2.57503629e-01f,   2.59716511e-01f,   2.52088279e-01f,   9.94747058e-02f,  -2.46652756e-02f,  -7.16663748e-02f,
+             -4.09752093e-02f,  -3.18948478e-02f,  -2.77593344e-01f,  -2.00056046e-01f,   2.05408871e-01f,  -9.38800573e-02f,
+             -1.05387405e-01f,   6.28305003e-02f,   6.20605387e-02f,   8.47129524e-03f,   9.48357023e-03f,  -8.63056909e-03f,
+              1.26259150e-02f,  -4.09455709e-02f,  -6.01193942e-02f,  -1.56942997e-02f,   7.09288046e-02f,   9.66873392e-02f,
+              1.17003292e-01f,   5.20886518e-02f,  -1.15215264e-01f,  -4.07689437e-02f,  -1.90911427e-01f,  -1.41946822e-01f,
+             -8.79336149e-02f,  -2.90491402e-01f,  -8.62165764e-02f,   1.65610775e-01f,   1.79633662e-01f,   1.71836540e-02f,
+              1.22480216e-02f,  -1.12786129e-01f,  -1.65474325e-01f,  -1.03598334e-01f,   2.05864813e-02f,   8.40883851e-02f,
+              9.48549062e-02f,   2.17408650e-02f,  -1.00403972e-01f,  -3.68218534e-02f,  -1.13615893e-01f,  -1.56083638e-02f,
+             -1.39368162e-01f,  -1.91852093e-01f,   2.38550957e-02f,   6.18410073e-02f,   1.99753076e-01f,   3.53580862e-01f,
+              3.58210683e-01f,   2.61945277e-01f,   3.66640650e-02f,  -2.66255960e-02f,   1.40000582e-01f,   5.49587347e-02f,
+              1.80215701e-01f,   2.77503401e-01f,   5.61098307e-02f,  -5.06398007e-02f,  -2.86931414e-02f,   1.11934841e-01f,
+             -3.85744162e-02f,  -1.00388341e-02f,   1.14463732e-01f,   1.14547931e-01f,   1.30666988e-02f,  -6.67127222e-02f,
+             -1.24288335e-01f,  -1.85178578e-01f,  -2.03467280e-01f,  -8.48146304e-02f,  -9.60364938e-02f,  -2.69556232e-02f,
+              3.43770795e-02f,  -5.89430965e-02f,  -7.41275959e-03f,   1.25616863e-01f,  -2.87896432e-02f,  -3.61149192e-01f,
+             -3.18436652e-01f,  -1.35327876e-01f,  -1.70385856e-02f,  -8.02364759e-03f,   2.62617003e-02f,   3.95302415e-01f,
+              2.28906438e-01f,  -6.86420947e-02f,  -1.40780225e-01f,   6.05842620e-02f,   9.30132344e-02f,   1.14690447e-02f,
+              1.04475453e-01f,  -3.90025079e-02f,  -5.57579808e-02f,  -6.70643151e-02f,  -8.57776031e-02f,  -2.24038973e-01f,
+             -2.66819984e-01f,  -9.74141508e-02f,   2.43312754e-02f,  -1.96743086e-02f,   8.86079818e-02f,   4.65149526e-03f,
+             -7.32504576e-02f,  -2.55483985e-02f,  -3.68907228e-02f,  -7.51507059e-02f,   5.56537732e-02f,   2.43047729e-01f,
+              1.12825960e-01f,  -4.60457355e-02f,  -8.75326470e-02f,  -1.45514444e-01f,   2.79617310e-01f,   2.85566539e-01f,
+              9.51760188e-02f,   3.10103655e-01f,   1.60749450e-01f,   2.41653994e-03f,   1.07137628e-01f,  -6.01214916e-02f,
+             -6.00931533e-02f,  -2.68525034e-02f,   1.61939949e-01f,   2.63080329e-01f,  -1.56438276e-01f,  -2.37077519e-01f,
+             -1.43863022e-01f,  -1.92966387e-01f,  -1.38161689e-01f,   4.61297221e-02f,  -7.64550120e-02f,  -1.14226922e-01f,
+              1.51211888e-01f,   1.37852073e-01f,  -4.25167531e-01f,  -5.24454534e-01f,  -7.54159316e-02f,  -1.76777747e-02f,
+             -8.91647637e-02f,   3.28989215e-02f,   1.79359049e-01f,   2.18695149e-01f,  -1.17632344e-01f,  -2.63710171e-01f,
+              3.65092941e-02f,  -1.54660851e-01f,  -4.29295450e-01f,  -8.47999081e-02f,   8.20656568e-02f,   2.08740197e-02f,
+              1.16375310e-03f,  -4.98300828e-02f,   6.90944567e-02f,   3.87432724e-01f,   4.56155032e-01f,   2.74218857e-01f,
+              2.16282308e-01f,   1.55690774e-01f,  -1.19690336e-01f,  -1.71652317e-01f,   1.02435760e-01f,  -3.41446809e-02f,
+              2.43577939e-02f,   1.72821850e-01f,  -1.19533591e-01f,  -4.51019138e-01f,   1.15408815e-01f,   3.67184848e-01f,
+              5.76701276e-02f,  -1.89439356e-01f,  -6.00283295e-02f,   9.52752121e-03f,   4.27659191e-02f,  -1.66298053e-03f,
+              3.22318822e-01f,   7.20895454e-02f,   1.57456502e-01f,   2.99119234e-01f,  -2.31101234e-02f,  -8.11370984e-02f,
+             -1.18592240e-01f,   2.93616299e-03f,   2.16014788e-01f,   1.94974869e-01f,   1.07125588e-01f,   1.80755630e-01f,
+             -3.59445848e-02f,  -1.88192785e-01f,  -2.91237347e-02f,   2.88542286e-02f,  -4.38639596e-02f,   5.05708022e-06f,
+              7.43765160e-02f,  -6.12366349e-02f,  -9.46397781e-02f,   5.01051098e-02f,   1.17356479e-01f,   2.83270814e-02f,
+              2.20363028e-02f,   6.73683286e-02f,  -3.26877795e-02f,  -8.66396166e-03f,  -7.75625631e-02f,   8.15430656e-02f,
+              9.42494068e-03f,  -1.09966926e-01f,  -4.45014924e-01f,  -2.19026268e-01f,   1.23374658e-02f,  -1.33210104e-02f,
+              2.00229250e-02f,  -8.99751708e-02f,  -3.25465500e-01f,  -2.39976808e-01f,   8.85616392e-02f,   7.44314566e-02f,
+             -2.43607741e-02f,   4.46655117e-02f,  -8.81560333e-03f,  -4.50834036e-02f,  -2.43712007e-03f,   5.75563088e-02f,
+             -5.84692881e-03f,  -1.61213264e-01f,  -2.57055074e-01f,  -1.16377488e-01f,   2.85538770e-02f,  -7.12825805e-02f,
+             -1.02318786e-02f,   3.24624428e-03f,  -1.15218684e-01f,  -1.98844880e-01f,  -3.53865385e-01f,  -1.15504436e-01f,
+              1.00227199e-01f,   5.92473932e-02f,  -1.80424765e-01f,   3.54458718e-03f,  -9.81274918e-02f,  -1.13995455e-01f,
+             -5.75715303e-02f,  -1.18813396e-01f,   8.03160295e-03f,   1.44949019e-01f,  -4.89778258e-02f,  -4.52139564e-02f,
+             -7.16777444e-02f,   3.99948880e-02f,   1.08045727e-01f,   4.87617664e-02f,  -1.19305477e-01f,  -2.29780987e-01f,
+             -2.06816956e-01f,   2.45120376e-01f,   1.41167298e-01f,   1.31894022e-01f,   3.51264536e-01f,  -8.60062242e-02f,
+             -2.60798931e-01f,  -1.61902040e-01f,  -1.56027123e-01f,  -1.35579407e-01f,   9.39101651e-02f,   1.29585594e-01f,
+             -2.76969612e-01f,  -3.88744771e-01f,   2.89438032e-02f,   1.35083362e-01f,  -2.43043881e-02f,  -1.44373536e-01f,
+              1.31134674e-01f,  -6.60004243e-02f,  -1.80333599e-01f,  -3.48581821e-02f,   2.62682855e-01f,   1.51756167e-01f,
+             -2.59349853e-01f,  -1.50554404e-01f,   1.92289606e-01f,   7.41937980e-02f,   8.14365149e-02f,   1.07299596e-01f,
+              6.27182648e-02f,   7.52021000e-02f,   8.66755247e-02f,   9.82342660e-02f,   1.86810754e-02f,  -8.85632038e-02f,
+             -1.62119567e-01f,  -6.27583563e-02f,   1.35034859e-01f,   1.03337869e-01f,   6.07129261e-02f,  -2.40530577e-02f,
+             -8.93889070e-02f,  -8.58899355e-02f,  -6.69096783e-02f,  -4.11031246e-02f,   5.23527227e-02f,   2.87063420e-02f,
+             -6.62965998e-02f,   2.65757944e-02f,   1.53696816e-02f,  -1.19034506e-01f,  -8.98226947e-02f,   1.30200893e-01f,
+              2.52766728e-01f,   2.75565147e-01f,   9.67631415e-02f,   3.90775353e-02f,   2.96955705e-02f,  -1.02756554e-02f,
+              2.82228906e-02f,   9.59487557e-02f,   5.48930503e-02f,   1.70534745e-01f,   1.29040867e-01f,  -1.04078062e-01f,
+             -7.57821426e-02f,  -1.65807009e-02f,   4.55597043e-02f,  -8.80905055e-03f,  -1.40027463e-01f,  -1.47593096e-02f,
+              1.38306737e-01f,  -1.51193097e-01f,  -4.72332031e-01f,  -1.70270786e-01f,   5.24543375e-02f,   1.58934258e-02f,
+             -3.81525569e-02f,  -1.55295715e-01f,  -2.04567071e-02f,   8.50068480e-02f,   4.01082188e-02f,   1.59745231e-01f,
+              3.22126560e-02f,  -2.34909669e-01f,  -1.06644250e-01f,  -1.14748076e-01f,  -5.39008789e-02f,  -3.65329325e-01f,
+             -3.59091669e-01f,  -1.38065264e-01f,  -1.42971843e-01f,  -1.84694946e-01f,  -1.77125916e-01f,  -3.49771380e-01f,
+             -3.19096357e-01f,  -1.33367106e-01f,  -1.45405799e-01f,  -1.12714790e-01f,   6.45018220e-02f,   6.66053891e-02f,
+              5.47316223e-02f,   1.28800437e-01f,   1.63437277e-01f,  -1.60489157e-02f,  -7.93723613e-02f,  -9.72084254e-02f,
+             -4.05894667e-02f,  -8.04977790e-02f,   6.48406968e-02f,   4.17863518e-01f,   6.52523264e-02f,  -1.30718112e-01f,
+              1.67413116e-01f,   2.60700107e-01f,  -7.71670416e-02f,  -1.67729840e-01f,  -2.28214450e-02f,  -1.11864969e-01f,
+             -1.28003240e-01f,  -5.06970473e-02f,   4.30698507e-03f,   4.36833277e-02f,   8.39291587e-02f,  -6.19223490e-02f,
+             -1.56131834e-01f,  -8.95864666e-02f,  -9.12250206e-02f,  -1.41274035e-01f,  -2.56559819e-01f,  -2.35992312e-01f,
+             -1.40681580e-01f,  -4.81453948e-02f,  -5.35157658e-02f,  -1.98390000e-02f,  -2.26963773e-01f,  -1.07261673e-01f,
+             -2.96552684e-02f,  -5.61361685e-02f,  -7.58176893e-02f,   1.00289285e-01f,   2.82918632e-01f,  -3.46593149e-02f,
+             -9.14917886e-02f,  -8.49774573e-03f,  -9.24187005e-02f,  -5.28806075e-02f,  -3.82602923e-02f,  -4.21958081e-02f,
+              1.71878800e-01f,   3.58911693e-01f,   3.08080137e-01f,   8.72114487e-03f,  -2.33010709e-01f,   5.19267321e-02f,
+              5.71409054e-02f,  -3.72739732e-02f,  -1.70061905e-02f,  -1.89683035e-01f,   6.03486076e-02f,   3.06754202e-01f,
+             -5.55507354e-02f,  -2.94690996e-01f,  -8.06129947e-02f,   9.15415883e-02f,   7.64223933e-02f,  -2.02598080e-01f,
+              7.04246759e-02f,  -1.83425784e-01f,  -2.51582712e-01f,   1.12404898e-01f,   1.11410782e-01f,   1.11016236e-01f,
+              1.75865427e-01f,   9.75462869e-02f,   3.41591127e-02f,   5.60306385e-02f,  -5.40180644e-03f,  -5.05211614e-02f,
+              5.04523478e-02f,  -8.81990343e-02f,   4.10129242e-02f,   4.33718354e-01f,   4.89084631e-01f,   2.74890900e-01f,
+              1.15092313e-02f,  -1.05948992e-01f,  -1.73870444e-01f,   2.35035315e-01f,   3.46613050e-01f,   1.42432600e-01f,
+             -1.69014215e-01f,  -3.93408984e-01f,  -3.26753706e-01f,  -3.59832868e-02f,  -8.00931174e-03f,   7.63392523e-02f,
+             -1.16269588e-01f,  -1.46208197e-01f,   4.71612960e-02f,   3.74964505e-01f,   3.50284368e-01f,   3.37013565e-02f,
+             -5.73285818e-02f,  -2.01938320e-02f,   3.92263159e-02f,  -2.99843494e-02f,  -1.21086113e-01f,  -3.24273445e-02f,
+              1.78258374e-01f,   5.07714033e-01f,   5.74748158e-01f,   1.30643502e-01f,  -6.64801300e-02f,   5.41793853e-02f,
+              2.28354963e-03f,   1.86758314e-03f,  -5.20433746e-02f,  -4.52835560e-02f,   1.06017180e-02f,   1.42624497e-01f,
+              3.70046586e-01f,   1.87831074e-01f,  -4.13067937e-02f,  -2.68596262e-01f,  -1.84086606e-01f,   5.11029921e-02f,
+             -5.03423326e-02f,  -1.14764161e-02f,   1.25848636e-01f,   8.84039048e-03f,   1.25393015e-03f,   2.37172469e-01f,
+              3.09905827e-01f,   1.25272304e-01f,   3.87308490e-03f,  -7.01572299e-02f,   5.94052859e-02f,  -1.09046146e-01f,
+             -2.58691281e-01f,  -4.84676026e-02f,  -9.18307975e-02f,  -5.34311347e-02f,   7.51704723e-02f,   1.45929754e-01f,
+              1.28848284e-01f,   8.82282183e-02f,   5.80367483e-02f,  -1.56984758e-02f,   4.81021963e-03f,   1.82347834e-01f,
+              3.31190266e-02f,   5.91504350e-02f,   7.64675140e-02f,  -4.91355360e-03f,  -2.57469784e-03f,   7.28256553e-02f,
+             -2.48656914e-01f,  -1.31714150e-01f,   3.90881568e-01f,   3.12923193e-01f,   5.03210247e-01f,   3.60051543e-02f,
+             -1.92383025e-02f,  -5.05151078e-02f,  -2.40723714e-01f,  -1.56048685e-01f,  -4.18400988e-02f,  -4.15463001e-02f,
+             -1.64091706e-01f,  -3.00419629e-01f,   2.61517644e-01f,   4.30250280e-02f,  -9.74154398e-02f,  -6.93623573e-02f,
+             -6.53118566e-02f,   7.67383203e-02f,  -1.01046950e-01f,   1.60468500e-02f,  -4.22826298e-02f,  -1.51149526e-01f,
+             -7.12999925e-02f,  -2.67256480e-02f,   1.59012914e-01f,   5.05984798e-02f,   3.18349540e-01f,   5.91845632e-01f,
+             -7.87139907e-02f,  -1.27539746e-02f,  -6.92480206e-02f,  -7.87032247e-02f,  -1.24789894e-01f,   8.68313238e-02f,
+             -1.16910771e-01f,  -2.17325479e-01f,  -8.56775194e-02f,   4.68231477e-02f,  -1.09228212e-02f,  -9.47303977e-03f,
+              7.93820247e-03f,  -2.86244184e-01f,   1.21573366e-01f,   3.98722321e-01f,  -5.76878130e-01f,  -4.68418151e-01f,
+             -2.75322217e-02f,   4.57988754e-02f,  -3.71510424e-02f,  -2.37998832e-02f,   2.73411814e-02f,   1.62867725e-01f,
+             -6.06681705e-02f,  -3.54650050e-01f,  -3.88101697e-01f,   5.83628751e-02f,   4.14714783e-01f,   2.05748335e-01f,
+             -4.21492346e-02f,  -2.51746356e-01f,  -7.16334134e-02f,   3.49315584e-01f,  -3.08067381e-01f,  -5.10955215e-01f,
+             -1.09700643e-01f,   1.04311250e-01f,   6.57388046e-02f,   5.82920909e-02f,  -1.64591130e-02f,   5.31661361e-02f,
+             -1.57768354e-02f,  -2.12088853e-01f,  -6.77346364e-02f,  -6.30637780e-02f,  -2.79910415e-01f,  -1.20751016e-01f,
+              6.58604950e-02f,   1.73549876e-01f,  -7.84827620e-02f,   2.17522401e-02f,   1.13070980e-02f,  -2.04069130e-02f,
+              1.07176840e-01f,  -1.20068705e-02f,  -2.30659395e-01f,  -2.30073780e-01f,  -1.64440542e-01f,  -4.83321622e-02f,
+              7.89422262e-03f,  -3.15100960e-02f,   3.24866250e-02f,   1.28703997e-01f,   6.28449768e-02f,   1.11827105e-01f,
+              6.02584556e-02f,   1.58646051e-02f,  -7.16350898e-02f,  -8.15349370e-02f,  -4.27345466e-03f,  -1.21330759e-02f,
+              2.63716206e-02f,   4.70931455e-02f,  -1.03780273e-02f,   2.12180600e-01f,   1.18176915e-01f,  -1.62366599e-01f,
+             -2.07450598e-01f,  -1.29952922e-01f,   2.94639524e-02f,  -6.62569003e-03f,   5.02992719e-02f,   4.96170856e-02f,
+              1.10900523e-02f,   1.08304702e-01f,   4.70934287e-02f,   8.48609861e-03f,   5.90500645e-02f,   1.41744912e-01f,
+             -2.69002537e-03f,  -1.18290365e-01f,  -2.02102587e-02f,   9.89779606e-02f,  -2.64523807e-03f,  -1.38615921e-01f,
+              1.23507127e-01f,   1.35123000e-01f,  -2.14923248e-01f,  -5.71896851e-01f,  -8.18886235e-02f,  -3.35922092e-02f,
+              1.07380532e-01f,   6.35633990e-02f,   1.03953220e-02f,   4.01833296e-01f,  -1.17885046e-01f,  -3.42654318e-01f,
+              1.21808030e-01f,   6.47539258e-01f,   5.66122942e-02f,  -2.01951284e-02f,  -6.59270734e-02f,  -2.66927779e-01f,
+             -2.32931033e-01f,  -8.97426158e-02f,   2.64297388e-02f,   8.93524587e-02f,   9.53285247e-02f,   1.36837244e-01f,
+              4.10322659e-02f,  -8.65907222e-02f,  -6.44463897e-02f,   2.58333921e-01f,   2.33177677e-01f,  -6.19547293e-02f,
+             -1.74618676e-01f,  -1.55901000e-01f,  -1.07454941e-01f,  -2.12707117e-01f,   2.04204485e-01f,   1.31277844e-01f,
+              1.39181882e-01f,   7.84937292e-02f,  -1.48645952e-01f,  -2.26917952e-01f,  -4.96511534e-02f,   6.40737265e-02f,
+              2.82486272e-03f,  -6.53744265e-02f,  -2.37361807e-02f,   4.68363985e-02f,   5.51874973e-02f,   6.84911292e-03f,
+             -8.30034763e-02f,  -1.84532478e-01f,  -3.02974526e-02f,   1.47975162e-01f,   3.19938153e-01f,   3.29040200e-01f,
+             -9.16380137e-02f,   8.31975639e-02f,   1.03086308e-01f,   2.65787065e-01f,  -4.01777029e-02f,  -7.01750070e-02f,
+             -2.23192871e-01f,   2.06849039e-01f,   3.31075221e-01f,  -4.48209606e-02f,  -4.54404652e-02f,  -2.91864183e-02f,
+              2.53403336e-02f,  -1.38427094e-01f,  -6.66576177e-02f,  -3.94914001e-02f,  -8.14927518e-02f,  -3.98653597e-02f,
+              8.44233856e-02f,   2.43153691e-01f,  -1.71765938e-01f,  -1.84444696e-01f,  -4.57799360e-02f,  -1.44876406e-01f,
+             -4.13613439e-01f,  -1.26622900e-01f,  -1.90562963e-01f,  -4.99000490e-01f,  -7.41968378e-02f,   1.36669397e-01f,
+             -6.07382040e-03f,  -8.40091892e-03f,   6.07389733e-02f,  -5.88167422e-02f,   1.13328788e-02f,   3.22855949e-01f,
+              1.42304584e-01f,  -1.20416485e-01f,  -2.87208464e-02f,   1.56155834e-02f,  -1.04531512e-01f,  -8.94309655e-02f,
+             -2.91917138e-02f,  -5.30574061e-02f,  -1.11152612e-01f,  -3.82017821e-01f,  -5.38527071e-01f,  -1.36805594e-01f,
+             -4.45417315e-02f,   1.33768603e-01f,  -4.91701216e-02f,  -6.17689863e-02f,  -1.24040149e-01f,  -9.34254378e-02f,
+             -6.92836642e-02f,   1.29527569e-01f,   4.46851701e-02f,  -2.32696518e-01f,   2.98886988e-02f,   1.20359465e-01f,
+             -1.00498691e-01f,  -1.55055776e-01f,  -2.66918391e-01f,   2.21927091e-01f,   4.30233300e-01f,   2.91705370e-01f,
+              2.95941979e-01f,   2.35065103e-01f,  -1.36898041e-01f,  -1.63677767e-01f,  -2.60302424e-02f,  -5.86437955e-02f,
+             -7.22153038e-02f,  -1.99116483e-01f,   8.27536881e-02f,   1.35022819e-01f,  -9.77343544e-02f,  -1.20330118e-01f,
+              1.03556933e-02f,   1.92989241e-02f,   9.87941995e-02f,   6.66254535e-02f,   5.23702726e-02f,  -4.58199918e-01f,
+             -1.95855871e-01f,   1.64097309e-01f,  -2.53150225e-01f,  -4.65851784e-01f,   2.44392931e-01f,   2.11384848e-01f,
+             -1.19013593e-01f,  -9.90293622e-02f,  -1.54443830e-01f,  -8.88136122e-03f,  -2.29183093e-01f,  -2.72324234e-01f,
+             -7.41217062e-02f,  -6.37785792e-02f,  -1.48718432e-01f,   4.75238338e-02f,  -6.96695372e-02f,  -2.38623381e-01f,
+             -8.92658159e-02f,   3.02764118e-01f,   3.15932006e-01f,   7.19300583e-02f,   9.53072757e-02f,   1.00080378e-01f,
+             -1.20887890e-01f,  -1.40261009e-01f,  -2.33881269e-02f,  -1.36704773e-01f,   9.19848680e-03f,  -3.51398513e-02f,
+             -8.59352276e-02f,   1.80995852e-01f,   1.31275848e-01f,   3.60208116e-02f,   1.15822881e-01f,   7.68174082e-02f,
+             -7.02559352e-02f,   8.04191269e-03f,  -2.15602055e-01f,  -1.88607842e-01f,  -1.10017713e-02f,  -1.52727082e-01f,
+             -2.65388787e-01f,  -2.62997061e-01f,  -4.14128929e-01f,  -2.37461329e-01f,  -1.42643899e-01f,  -1.76980957e-01f,
+             -3.50304961e-01f,   6.03032261e-02f,  -1.53635517e-01f,  -1.45937964e-01f,   3.83770049e-01f,   3.41387153e-01f,
+             -1.13492692e-03f,  -2.25341484e-01f,   1.35148600e-01f,   7.75830299e-02f,   9.57432091e-02f,  -2.57132947e-02f,
+             -1.62024140e-01f,  -3.16320181e-01f,  -2.28231475e-01f,   1.39807120e-01f,   1.59942091e-01f,  -1.64570481e-01f,
+              1.64814219e-01f,  -2.44958559e-03f,  -8.80245194e-02f,  -2.72730514e-02f,  -4.58626300e-01f,  -2.13923261e-01f,
+              1.88311145e-01f,   1.16091967e-02f,  -9.74074528e-02f,  -1.57981634e-01f,   6.44790828e-02f,   7.54489703e-03f,
+              6.95453305e-03f,   9.46149454e-02f,   6.08701110e-02f,   2.20798314e-01f,   1.69084996e-01f,  -3.46154533e-02f,
+             -8.94278213e-02f,  -1.74608156e-01f,  -1.31818224e-02f,  -4.54301052e-02f,  -1.84427291e-01f,  -1.53082997e-01f,
+              1.57961324e-02f,   5.48002869e-02f,  -4.30109352e-02f,  -4.70081605e-02f,  -3.82135175e-02f,  -3.50835994e-02f,
+             -1.27501503e-01f,   8.25829133e-02f,   5.88675477e-02f,  -2.13301376e-01f,  -1.90675676e-01f,  -1.83051407e-01f,
+             -9.61370990e-02f,  -7.21066818e-02f,   8.36631581e-02f,   4.85143960e-01f,   7.18211606e-02f,  -4.62648347e-02f,
+             -1.46856621e-01f,  -1.03954442e-01f,  -4.37808186e-02f,  -1.03155086e-02f,  -1.44002065e-01f,  -2.19787866e-01f,
+             -2.02334091e-01f,  -4.85442616e-02f,  -6.14939816e-02f,  -1.41351387e-01f,  -1.28507510e-01f,  -9.57908556e-02f,
+              1.98783353e-01f,   1.80339649e-01f,  -1.68103650e-01f,  -3.54562134e-01f,  -2.63245523e-01f,   6.69193417e-02f,
+              5.92862591e-02f,   1.48346694e-03f,  -1.73848532e-02f,  -3.63353156e-02f,  -1.10322408e-01f,  -2.83638775e-01f,
+             -1.42900229e-01f,  -1.07010663e-01f,  -7.06193298e-02f,  -1.39449418e-01f,   1.32894084e-01f,   3.26770358e-03f,
+             -2.43114904e-01f,  -1.77484572e-01f,   2.48698100e-01f,   1.59068555e-01f,  -2.02280939e-01f,  -2.72022426e-01f,
+             -3.36202502e-01f,  -2.10073277e-01f,  -1.47620514e-01f,  -5.58913387e-02f,  -1.51325483e-02f,  -1.48489892e-01f,
+              3.62127841e-01f,   1.80007383e-01f,  -8.98602009e-02f,   2.06139654e-01f,   1.20632708e-01f,   2.40261301e-01f,
+             -7.07111433e-02f,  -9.33106467e-02f,   2.05228120e-01f,   6.40560746e-01f,  -3.66430700e-01f,   2.82784961e-02f,
+              3.77330184e-01f,   2.31538966e-01f,  -1.79769367e-01f,  -3.10865417e-02f,   1.52302384e-01f,  -4.19216305e-02f,
+             -2.96999067e-01f,  -1.26830712e-01f,  -1.10927619e-01f,   1.54363722e-01f,   3.09119195e-01f,  -9.97642800e-03f,
+              3.12318541e-02f,   1.50384337e-01f,  -3.06436718e-02f,   1.50094545e-02f,   3.29875946e-01f,   3.64694864e-01f,
+             -8.02850649e-02f,  -5.02887443e-02f,   7.55792018e-03f,   1.20505668e-01f,   1.48434594e-01f,   1.40401363e-01f,
+             -2.46698763e-02f,  -1.03395455e-01f,  -1.15350626e-01f,  -2.82259919e-02f,  -9.42110419e-02f,  -1.59062311e-01f,
+             -1.36927083e-01f,  -9.95342433e-03f,   1.24480382e-01f,   1.23471394e-01f,  -6.95306733e-02f,   2.97337063e-02f,
+              2.52904654e-01f,   2.87871301e-01f,   3.93853128e-01f,   1.68116495e-01f,  -3.43535423e-01f,  -1.61545992e-01f,
+             -7.21826628e-02f,  -3.90627116e-01f,  -1.66948885e-03f,  -1.49374202e-01f,  -1.51604161e-01f,   4.91984002e-02f,
+              3.92913334e-02f,  -2.94494241e-01f,  -3.04809898e-01f,   1.64156761e-02f,   1.41635031e-01f,   7.50056580e-02f,
+              1.33961933e-02f,   7.07999915e-02f,   1.11231305e-01f,  -3.46966237e-02f,  -3.11889891e-02f,  -2.08555400e-01f,
+              5.05426005e-02f,   4.37151611e-01f,   3.95222068e-01f,   1.70308307e-01f,   2.75897402e-02f,  -3.98706309e-02f,
+             -1.41604021e-01f,  -3.32804054e-01f,  -2.02008978e-01f,   9.85633880e-02f,  -2.21747123e-02f,  -1.19259268e-01f,
+              5.45314960e-02f,   3.08942258e-01f,   1.90867335e-01f,   2.29913164e-02f,  -2.02514321e-01f,  -9.12923515e-02f,
+             -7.19811693e-02f,   2.60055661e-02f,   2.20142439e-01f,   9.18157697e-02f,   7.51619739e-03f,  -2.10689977e-01f,
+              7.42419437e-02f,   9.91716459e-02f,   1.51015580e-01f,  -4.60331924e-02f,  -2.97519982e-01f,  -4.39684242e-01f,
+             -5.34687877e-01f,  -6.03307903e-01f,  -2.06672847e-01f,   3.06151986e-01f,  -1.08936831e-01f,   1.95696703e-04f,
+              1.29095495e-01f,   7.46143684e-02f,   4.55729812e-02f,  -4.78297751e-03f,  -1.92388538e-02f,   1.48142532e-01f,
+              4.13296133e-01f,   5.48646867e-01f,  -1.74562573e-01f,  -2.55370319e-01f,  -1.92135483e-01f,   2.68879861e-01f,
+              4.01117086e-01f,   2.67134219e-01f,   2.54356682e-01f,   3.79957467e-01f,  -2.42404088e-01f,  -4.45344478e-01f,
+             -9.04099569e-02f,   2.00724185e-01f,   8.39537606e-02f,   5.35210110e-02f,   9.28357709e-03f,  -1.84411898e-01f,
+             -3.53807181e-01f,  -4.81432557e-01f,  -2.50709057e-01f,   3.47988874e-01f,  -2.63791829e-02f,   7.54858628e-02f,
+             -6.04884960e-02f,   4.71101841e-03f,   2.37554848e-01f,  -9.09993649e-02f,  -3.69219869e-01f,  -3.85736823e-01f,
+             -1.80982471e-01f,   3.61252010e-01f,  -8.72260332e-03f,  -8.61103982e-02f,  -1.43195599e-01f,  -3.54648978e-02f,
+              1.81295484e-01f,   3.18474412e-01f,   1.37464672e-01f,  -1.31109953e-01f,  -7.23332316e-02f,  -2.73732722e-01f,
+             -1.42645285e-01f,  -1.88700587e-01f,  -3.94187421e-02f,  -6.25469163e-02f,  -1.62330434e-01f,  -3.78736816e-02f,
+              1.80551454e-01f,   3.17673795e-02f,   5.90823144e-02f,   8.96387268e-04f,  -4.30905551e-01f,  -5.08569181e-01f,
+              1.05128929e-01f,   1.27167076e-01f,  -1.67705506e-01f,  -7.22564682e-02f,   2.94088989e-01f,  -5.84557466e-02f,
+             -1.48459330e-01f,  -1.17733497e-02f,  -3.74811552e-02f,   3.12032066e-02f,   1.37203798e-01f,   3.55424397e-02f,
+             -5.59436977e-02f,  -2.14812443e-01f,  -2.23789692e-01f,  -1.09628446e-01f,  -1.05111055e-01f,   2.78987810e-02f,
+             -4.00259644e-01f,  -2.38711759e-01f,   1.46196902e-01f,   1.88331053e-01f,  -2.26079538e-01f,  -2.10318103e-01f,
+              1.10814713e-01f,  -5.97469434e-02f,  -5.70900813e-02f,  -3.62137593e-02f,  -8.23319778e-02f,  -2.57776529e-01f,
+             -1.90804169e-01f,  -5.36749214e-02f,   1.03466846e-01f,   1.66372418e-01f,   4.83605377e-02f,   7.47400448e-02f,
+              4.60564867e-02f,  -3.16709317e-02f,  -2.30552461e-02f,  -5.10520674e-02f,  -2.55228847e-01f,  -2.77619302e-01f,
+             -2.58926898e-01f,   2.17656955e-01f,   6.79709613e-02f,  -1.60765067e-01f,   6.94664866e-02f,  -4.70657498e-02f,
+             -1.65610820e-01f,  -8.77422690e-02f,  -1.30401269e-01f,  -7.15450421e-02f,   4.07391340e-01f,   4.74129975e-01f,
+             -8.74677002e-02f,  -8.89623091e-02f,   1.21658675e-01f,   1.38308480e-01f,   3.75794582e-02f,  -6.10581972e-02f,
+              6.90837950e-02f,   3.19997013e-01f,   2.59873897e-01f,  -5.55050373e-02f,   2.12336272e-01f,   1.89559162e-01f,
+             -3.85471322e-02f,  -4.81459536e-02f,   4.31321971e-02f,  -6.23448892e-03f,   3.91123801e-01f,   4.88421798e-01f,
+             -1.56239510e-01f,  -4.71855223e-01f,   2.84181535e-01f,   1.65807933e-01f,   7.71026462e-02f,   4.52568531e-02f,
+              1.60483897e-01f,   2.71562934e-01f,   1.50171638e-01f,  -3.26838970e-01f,  -3.70910674e-01f,  -7.62102082e-02f,
+              9.15176515e-03f,   3.07062604e-02f,   6.49860158e-05f,  -1.31197587e-01f,  -6.07156396e-01f,   2.52168149e-01f,
+              9.55329761e-02f,  -3.24007422e-02f,  -2.23494977e-01f,  -3.90560292e-02f,   1.02961492e-02f,   2.29052350e-01f,
+              4.66684997e-02f,   6.53605834e-02f,  -2.85588980e-01f,  -4.52906072e-01f,  -2.30131030e-01f,  -3.04845780e-01f,
+              1.50956169e-01f,   9.04077888e-02f,   6.16494119e-02f,  -4.88391891e-02f,  -1.35400426e-03f,   1.22896126e-02f,
+             -3.35727371e-02f,   1.28171995e-01f,  -8.82028788e-02f,  -9.46813226e-02f,   1.42587930e-01f,  -3.08042318e-02f,
+             -3.30026060e-01f,  -2.34826487e-02f,  -1.23037755e-01f,  -3.30921300e-02f,  -5.86969778e-02f,   3.22852582e-01f,
+             -8.52739625e-03f,  -1.37991309e-01f,   8.80989134e-02f,  -2.83294261e-01f,  -3.70778799e-01f,  -2.51740992e-01f,
+             -2.28801697e-01f,   2.82504112e-01f,  -5.64622357e-02f,   8.38020071e-02f,   1.40183985e-01f,   1.08418941e-01f,
+             -6.28005248e-03f,  -8.43125805e-02f,  -1.09012388e-01f,  -1.90140188e-01f,  -2.14609638e-01f,   7.41548976e-03f,
+             -3.15176576e-01f,  -2.70084202e-01f,  -3.64988267e-01f,  -1.91233531e-01f,  -9.40267146e-02f,   2.57918891e-02f,
+              8.42606202e-02f,  -4.00403976e-01f,  -8.09773728e-02f,   5.48949838e-03f,   1.64328497e-02f,   9.07257944e-02f,
+              1.70551110e-02f,   1.34970872e-02f,  -1.41558930e-01f,  -4.22126323e-01f,  -1.37326524e-01f,  -5.36396094e-02f,
+              2.97796249e-01f,   1.94164634e-01f,  -4.08782549e-02f,   5.58353178e-02f,  -3.81346531e-02f,  -2.73225784e-01f,
+             -1.31190449e-01f,   1.05127133e-01f,   1.68644711e-01f,   8.76100436e-02f,   4.61210348e-02f,   2.05361918e-01f,
+             -1.18969366e-01f,  -2.08270326e-01f,   2.21253321e-01f,   5.17599046e-01f,   5.40765151e-02f,   8.16367269e-02f,
+              5.69392562e-01f,   1.16270840e-01f,  -1.78543478e-01f,  -1.35927066e-01f,   2.42658779e-02f,  -1.43270120e-02f,
+              3.84155884e-02f,   3.84451598e-02f,  -1.59851044e-01f,  -3.22863698e-01f,   3.06814746e-03f,   1.56852230e-01f,
+              1.26787975e-01f,  -6.73803762e-02f,   2.38677263e-02f,  -3.12884539e-01f,   9.39078182e-02f,   2.42900655e-01f,
+              6.70349151e-02f,   3.51252675e-01f,   3.74740571e-01f,  -8.16997737e-02f,  -3.23986173e-01f,  -2.04889644e-02f,
+              8.38541090e-02f,   6.86687380e-02f,  -1.52193055e-01f,  -1.98405534e-01f,   8.05172510e-03f,   1.84161320e-01f,
+             -9.87223163e-02f,  -3.21680307e-01f,  -8.31981376e-02f,  -2.44539510e-02f,  -1.56882301e-01f,  -4.66117673e-02f,
+              1.72137320e-02f,   3.35959047e-01f,   6.27779186e-01f,   3.78827274e-01f,  -1.64857581e-02f,  -3.40577774e-02f,
+              2.16372870e-02f,   8.11068565e-02f,  -2.05022469e-01f,   1.00046135e-02f,   3.78566414e-01f,   2.80296266e-01f,
+              8.06549340e-02f,   2.54197448e-01f,   1.72320113e-01f,   9.33932289e-02f,   6.89966381e-02f,   2.01393709e-01f,
+             -5.09236380e-02f,  -4.63002473e-02f,  -1.31288901e-01f,  -2.40976736e-02f,   1.87240958e-01f,   1.58286706e-01f,
+             -5.80624156e-02f,   5.37160411e-02f,   2.65719406e-02f,  -2.83224583e-02f,  -3.26730400e-01f,   6.65339828e-02f,
+              2.39365324e-01f,  -2.12796610e-02f,  -1.22339316e-01f,  -6.45942762e-02f,   2.33588219e-01f,   2.13336691e-01f,
+              5.26974956e-03f,   5.13126105e-02f,  -1.31418660e-01f,  -2.08371028e-01f,  -5.35650402e-02f,   1.47957280e-01f,
+              1.35844454e-01f,   7.69455358e-02f,   5.76862656e-02f,  -3.14217098e-02f,  -6.01261333e-02f,   3.95644903e-02f,
+             -1.69587836e-01f,  -3.76815557e-01f,  -1.71919063e-01f,   1.79734677e-02f,   1.90053448e-01f,   1.32239580e-01f,
+              2.17498858e-02f,  -3.06765400e-02f,   2.73434129e-02f,   7.95043558e-02f,  -3.18434298e-01f,  -1.27051035e-02f,
+              2.74049819e-01f,   3.37773412e-01f,   3.78488563e-02f,  -3.33333313e-01f,  -1.43380640e-02f,  -8.22212771e-02f,
+             -3.30591828e-01f,   2.98697520e-02f,   6.81942552e-02f,  -7.67107904e-02f,  -2.18838170e-01f,   1.53910458e-01f,
+              1.98843539e-01f,   1.56393096e-01f,   1.39037549e-01f,  -2.60629117e-01f,  -1.88787505e-01f,  -2.85099179e-01f,
+             -1.66489333e-01f,  -1.73978269e-01f,  -2.34587133e-01f,  -5.17630205e-02f,  -1.95776336e-02f,  -6.06615096e-02f,
+             -1.31067215e-02f,   4.99730371e-02f,  -2.62365919e-02f,   7.74768963e-02f,  -8.65342394e-02f,  -1.00707300e-01f,
+             -4.12218779e-01f,  -3.35739970e-01f,  -1.95435025e-02f,   2.29072616e-01f,  -5.58245890e-02f,  -4.20679115e-02f,
+              1.36114299e-01f,  -1.72112629e-01f,   1.95898965e-01f,   2.25487679e-01f,   4.59082052e-02f,  -1.02911487e-01f,
+             -9.23408419e-02f,  -1.01700492e-01f,  -1.48651227e-01f,  -6.94905892e-02f,   4.37412374e-02f,  -1.64715156e-01f,
+              1.49668464e-02f,  -3.14645246e-02f,  -7.07219690e-02f,   6.80023292e-03f,   1.03847809e-01f,  -7.39279687e-02f,
+             -1.02528527e-01f,  -1.88230351e-01f,  -4.93910238e-02f,   9.70190391e-02f,  -2.57846296e-01f,  -2.75248438e-01f,
+             -1.35159448e-01f,  -2.13417783e-01f,  -6.81935400e-02f,   4.17303801e-01f,   3.64526719e-01f,   3.97647321e-01f,
+             -3.25276591e-02f,  -2.75736582e-03f,  -3.58012435e-03f,  -2.06094861e-01f,  -1.24599740e-01f,   3.05446774e-01f,
+              3.90993625e-01f,   6.32879362e-02f,  -4.71266322e-02f,   3.43135856e-02f,   1.70295000e-01f,  -8.33541248e-03f,
+              2.26938128e-01f,  -3.20265070e-04f,   3.51689309e-02f,   1.58269748e-01f,   5.77930361e-02f,  -1.93564132e-01f,
+              2.59232312e-01f,   4.76148129e-01f,   1.05379507e-01f,  -1.27526030e-01f,   1.59334153e-01f,   1.94303557e-01f,
+              1.12333596e-01f,   1.84982028e-02f,  -8.13768432e-02f,  -5.91658689e-02f,   3.96730378e-02f,  -1.07149825e-01f,
+             -1.44196227e-01f,  -4.86605316e-02f,   9.68772322e-02f,  -1.20093688e-01f,  -1.17712840e-02f,   1.54246867e-01f,
+              1.38478011e-01f,   1.38381779e-01f,   1.32806757e-02f,  -4.95519005e-02f,  -1.23057216e-01f,  -4.61037457e-02f,
+             -2.23013133e-01f,  -3.83756340e-01f,  -1.84085086e-01f,   6.78773597e-02f,   9.88852903e-02f,  -3.64183128e-01f,
+             -2.38636811e-03f,   2.65869051e-01f,  -1.90386817e-01f,   7.45755881e-02f,  -6.93469271e-02f,  -1.13538653e-01f,
+             -2.13245049e-01f,  -1.40604228e-01f,  -1.45818681e-01f,   5.73061116e-04f,  -2.11473823e-01f,  -3.91666293e-01f,
+             -8.38679895e-02f,   1.81562155e-01f,  -2.03973092e-02f,  -1.44889474e-01f,  -7.47271627e-02f,  -1.86490148e-01f,
+             -1.55352578e-01f,   1.83838859e-01f,   2.30666026e-01f,   9.77304578e-02f,   3.92825939e-02f,   4.17041890e-02f,
+             -1.18747659e-01f,   3.65354605e-02f,  -1.54708281e-01f,  -9.64165479e-02f,   1.47485495e-01f,   4.79376882e-01f,
+             -2.60480139e-02f,  -2.30289474e-01f,   4.57758792e-02f,   5.06748743e-02f,  -8.13400373e-02f,   1.33041650e-01f,
+              4.14177954e-01f,   3.49891186e-01f,   8.77909809e-02f,  -1.52819917e-01f,  -8.28026310e-02f,   1.06459536e-01f,
+              1.49541691e-01f,   1.38775051e-01f,   3.73264223e-01f,   2.40621626e-01f,  -1.63292721e-01f,  -2.68538266e-01f,
+             -2.34119311e-01f,  -2.21610874e-01f,  -2.33279511e-01f,   7.80278025e-03f,   4.99193259e-02f,   1.26081472e-02f,
+             -1.53815836e-01f,  -1.68799058e-01f,  -1.87871277e-01f,  -2.55110681e-01f,   8.96351710e-02f,   3.64582278e-02f,
+             -1.29594028e-01f,  -4.03303020e-02f,  -2.23892052e-02f,  -7.04914853e-02f,   2.84067206e-02f,   1.26770720e-01f,
+              6.98291976e-03f,  -1.48452923e-01f,   2.13211123e-02f,   3.01934063e-01f,   2.59668410e-01f,  -3.19161355e-01f,
+             -4.36308198e-02f,  -5.80850989e-02f,   4.29151356e-02f,  -8.04540068e-02f,   3.91484201e-02f,   4.91653942e-03f,
+             -4.90587689e-02f,   1.31596908e-01f,   2.23819226e-01f,   2.68685281e-01f,   1.20984457e-01f,  -6.30603731e-02f,
+             -4.35049117e-01f,   1.09983169e-01f,   2.36535504e-01f,   3.00867170e-01f,   2.26557598e-01f,   1.47184702e-02f,
+             -9.43843573e-02f,  -1.32074922e-01f,  -1.17515586e-01f,   6.67097047e-02f,  -4.45290834e-01f,   1.83455601e-01f,
+              3.81041437e-01f,   4.82602000e-01f,   2.87671953e-01f,  -2.34358504e-01f,  -2.45222449e-01f,   8.35243836e-02f,
+             -7.24373311e-02f,   2.62493230e-02f,  -2.72367239e-01f,  -3.73547003e-02f,   4.84956473e-01f,   5.56101978e-01f,
+              5.28958976e-01f,   3.74717414e-01f,   1.12152308e-01f,  -8.82992968e-02f,  -6.22133277e-02f,  -5.71573116e-02f,
+             -3.36196542e-01f,  -3.91145706e-01f,  -2.03171730e-01f,  -7.64372572e-02f,   2.62113679e-02f,   5.55970147e-02f,
+             -8.90123099e-02f,  -1.50075570e-01f,  -8.96857772e-03f,   6.41772300e-02f,  -3.21173877e-01f,  -3.04183215e-01f,
+              2.34797597e-01f,   2.94571728e-01f,   2.48959631e-01f,   4.13011611e-01f,   3.07807624e-01f,  -1.18401527e-01f,
+             -2.73409605e-01f,  -2.21641436e-01f,   1.04900979e-01f,   9.43919122e-02f,   1.59566104e-01f,   3.59152764e-01f,
+              3.04913402e-01f,  -4.18208688e-02f,   1.16920635e-01f,  -9.74294469e-02f,  -1.54355153e-01f,  -4.13132980e-02f,
+             -2.24757060e-01f,  -1.50985017e-01f,  -2.25269031e-02f,   4.49335463e-02f,   8.25787932e-02f,   1.16868310e-01f,
+             -2.97329463e-02f,   1.38807192e-03f,  -2.63762083e-02f,  -1.09746896e-01f,  -4.59579341e-02f,  -1.34625986e-01f,
+             -1.64060488e-01f,   2.58414447e-02f,   1.43671498e-01f,  -1.43818736e-01f,  -1.06897041e-01f,  -2.86867291e-01f,
+             -1.92433491e-01f,  -6.74755573e-02f,   3.21465288e-03f,   3.77369509e-03f,  -5.96261360e-02f,  -1.40963614e-01f,
+             -1.09055772e-01f,   2.38332659e-01f,   5.02497196e-01f,   8.26387554e-02f,  -9.08082128e-02f,  -4.36595157e-02f,
+             -1.50209114e-01f,  -9.14029330e-02f,   8.69078841e-03f,   1.59089476e-01f,   1.27679044e-02f,  -8.56840238e-02f,
+              8.13323632e-02f,  -6.34595826e-02f,  -2.97180898e-02f,  -1.66328669e-01f,   1.23854645e-01f,  -9.68301520e-02f,
+             -1.84688419e-02f,   2.47139171e-01f,   2.66559601e-01f,  -3.32825571e-01f,  -6.81120217e-01f,  -6.23648316e-02f,
+              2.06214949e-01f,   8.45902488e-02f,   1.93159029e-01f,  -8.25598463e-02f,  -4.25391942e-01f,  -1.45430088e-01f,
+              3.22448283e-01f,   3.27098578e-01f,  -3.16977799e-02f,   2.24469945e-01f,   1.19335070e-01f,  -1.55071214e-01f,
+              1.16761809e-03f,   4.92779203e-02f,  -8.80675316e-02f,  -2.39951342e-01f,  -8.32635313e-02f,  -7.93858320e-02f,
+             -6.59570619e-02f,  -2.44443193e-02f,   1.81099847e-02f,   9.32873487e-02f,  -7.97004625e-02f,   1.65807351e-01f,
+              5.09133935e-01f,   1.20329022e-01f,  -3.20380747e-01f,  -8.95308256e-02f,   3.32003236e-02f,  -1.22175135e-01f,
+             -1.21983513e-01f,  -2.70840693e-02f,  -4.31217030e-02f,   5.23274541e-02f,   2.66311672e-02f,  -3.23217899e-01f,
+             -5.55764623e-02f,   3.82935882e-01f,   2.79032111e-01f,  -3.79635915e-02f,  -1.20959297e-01f,  -3.84837240e-02f,
+             -6.33490980e-02f,   1.61283270e-01f,   3.03022414e-01f,   1.09797604e-01f,   4.47435044e-02f,   3.75696756e-02f,
+             -3.50530483e-02f,  -1.12144366e-01f,  -1.64906636e-01f,  -8.85175839e-02f,  -1.07724555e-01f,  -3.59970108e-02f,
+              5.23025952e-02f,   7.79376328e-02f,   1.01530969e-01f,   8.81828666e-02f,   1.26956999e-01f,   1.83568180e-01f,
+              1.73922181e-01f,   7.51928315e-02f,  -8.63144100e-02f,  -8.75611305e-02f,  -7.70271793e-02f,  -6.96780980e-02f,
+              1.35143414e-01f,   5.82612194e-02f,  -1.67808220e-01f,  -5.62954172e-02f,   3.88664789e-02f,   4.02830578e-02f,
+             -1.51562303e-01f,  -2.74890214e-01f,  -1.48489490e-01f,   1.59776211e-01f,   2.62377381e-01f,   3.01904947e-01f,
+              1.09279647e-01f,   2.14063168e-01f,   2.02829123e-01f,   1.01720840e-01f,  -2.28875652e-01f,  -1.64698601e-01f,
+             -9.20528546e-02f,  -3.69987711e-02f,  -1.38119161e-01f,  -3.75156015e-01f,   1.90374744e-03f,   4.51105125e-02f,
+              1.45438582e-01f,   2.20375285e-01f,  -9.81592536e-02f,  -7.00146258e-02f,  -9.62246507e-02f,  -2.45245337e-01f,
+             -8.14899653e-02f,   6.72370419e-02f,   1.57967016e-01f,   3.31538580e-02f,  -1.04309030e-01f,  -1.11563385e-01f,
+             -2.67352872e-02f,  -1.94165364e-01f,  -2.23786786e-01f,  -1.84689406e-02f,   8.59275535e-02f,   2.49347300e-03f,
+             -1.14443921e-01f,   2.16022000e-01f,   1.55662537e-01f,   1.62183046e-01f,  -1.17998436e-01f,  -2.95477994e-02f,
+              3.74092013e-02f,   1.23046957e-01f,   7.24784955e-02f,  -1.01630211e-01f,  -1.88273385e-01f,   1.53057307e-01f,
+              3.66765618e-01f,   1.78779289e-01f,  -2.90442025e-03f,  -1.23871915e-01f,  -9.96473134e-02f,   2.12625526e-02f,
+              2.05312166e-02f,  -9.70045626e-02f,  -1.77016571e-01f,  -3.99348103e-02f,  -5.84479980e-02f,  -1.11962445e-01f,
+             -1.35577191e-02f,  -5.81738055e-02f,  -6.69827536e-02f,  -4.83506545e-02f,  -6.23496659e-02f,  -2.78985780e-02f,
+              9.89621691e-03f,  -2.11763587e-02f,  -3.47124301e-02f,   1.37912288e-01f,  -7.23369196e-02f,  -9.77464244e-02f,
+              1.41229853e-01f,   3.12816799e-01f,   2.19791472e-01f,  -8.48212689e-02f,  -1.65482581e-01f,  -8.27458650e-02f,
+              1.39318749e-01f,   1.71966985e-01f,  -5.79957105e-02f,  -1.07390471e-01f,  -1.93417102e-01f,  -6.67382777e-02f,
+              5.10380641e-02f,   1.05890594e-02f,  -1.53302923e-01f,   7.89456815e-02f,   1.19793579e-01f,  -7.17854127e-02f,
+             -8.94744769e-02f,   2.66456217e-01f,   2.67882645e-01f,  -2.51977593e-01f,  -8.15150216e-02f,   6.69238642e-02f,
+             -1.92081794e-01f,   9.63310376e-02f,  -7.72229806e-02f,  -2.03371316e-01f,  -5.12318425e-02f,   3.27613316e-02f,
+              1.79912508e-01f,   5.40474765e-02f,  -5.03490679e-03f,   1.49808928e-01f,   1.89266369e-01f,   1.69690281e-01f,
+              5.19634746e-02f,   1.68683290e-01f,  -3.23205180e-02f,   8.21281318e-03f,  -5.43990768e-02f,   1.79456323e-02f,
+              2.06461281e-01f,   1.57085851e-01f,  -9.59188491e-02f,   1.73081215e-02f,   1.53197320e-02f,  -6.99515222e-03f,
+              3.78292874e-02f,   3.40958238e-02f,   1.40750632e-01f,   3.07674278e-02f,  -2.40347698e-01f,  -5.84086061e-01f,
+             -4.33430582e-01f,  -8.53370950e-02f,   1.92367464e-01f,   8.86247158e-02f,   1.17518887e-01f,  -1.80184245e-01f,
+             -3.21879685e-01f,   3.69298644e-02f,   3.57851207e-01f,   3.62484902e-02f,  -2.44376987e-01f,  -5.93961589e-02f,
+              7.55402818e-02f,   3.10598582e-01f,   1.47554025e-01f,  -7.48614073e-02f,  -1.36520296e-01f,   4.01532315e-02f,
+              4.52852547e-02f,  -2.00303063e-01f,   1.48804337e-01f,   6.10531271e-02f,  -5.00739887e-02f,  -1.33376688e-01f,
+             -3.29644494e-02f,   1.06134117e-01f,   3.45473766e-01f,   2.35341311e-01f,  -2.94775754e-01f,  -1.16805486e-01f,
+              3.40467334e-01f,  -8.99602920e-02f,   7.85214826e-02f,   4.81020063e-02f,  -8.80565345e-02f,  -3.64411436e-02f,
+              4.64068949e-02f,  -1.89997386e-02f,   1.35818064e-01f,   2.70285010e-01f,   2.41938874e-01f,   5.39076775e-02f,
+             -1.29245833e-01f,  -1.32292747e-01f,  -3.17807239e-03f,  -1.25778198e-01f,  -1.44094117e-02f,   2.38615468e-01f,
+             -1.63606256e-02f,   3.35730205e-04f,   5.18814206e-01f,   9.54787061e-02f,  -1.32491991e-01f,  -2.25310284e-03f,
+              8.93406942e-03f,   1.55257992e-02f,   1.10684760e-01f,   1.35843024e-01f,  -2.03291461e-01f,  -2.83747077e-01f,
+             -5.56467846e-02f,  -8.03933218e-02f,  -3.34404856e-02f,  -2.07446367e-02f,  -1.44324645e-01f,   1.82603329e-01f,
+              4.18444008e-01f,   1.91286489e-01f,   2.08829254e-01f,   9.82509181e-02f,  -3.23076129e-01f,  -6.98496168e-03f,
+              3.79427895e-03f,   3.48887928e-02f,  -1.38686048e-02f,  -4.38065752e-02f,  -5.27905226e-02f,   1.39120948e-02f,
+              2.88163513e-01f,   2.79910862e-01f,   1.95988730e-01f,   1.07426373e-02f,  -3.41048427e-02f,   3.64464857e-02f,
+             -5.94753260e-03f,   1.13801792e-01f,   2.37069894e-02f,  -1.20070897e-01f,  -4.46213782e-02f,   8.42130557e-02f,
+              1.24222161e-02f,   1.52808309e-01f,   1.15294598e-01f,  -8.32246467e-02f,  -1.15935579e-01f,  -8.75123516e-02f,
+             -2.70076275e-01f,  -1.37550160e-01f,   6.98684156e-02f,   1.38009682e-01f,   1.72547102e-01f,   5.10410219e-02f,
+              5.37346750e-02f,  -1.32024074e-02f,   5.65537699e-02f,  -3.87094240e-03f,   6.41748682e-02f,   6.05516173e-02f,
+              1.39200762e-01f,   1.53931499e-01f,   3.37961987e-02f,  -5.96734285e-02f,  -8.13849568e-02f,  -1.89102530e-01f,
+             -3.04981679e-01f,  -1.69994608e-01f,  -1.60078630e-02f,  -2.38591656e-01f,  -2.66182214e-01f,  -3.76703478e-02f,
+             -3.58093940e-02f,   8.34021419e-02f,  -1.53335139e-01f,  -1.14711538e-01f,   1.93044320e-01f,   1.08719945e-01f,
+             -8.54793563e-02f,  -1.28441095e-01f,  -1.93185672e-01f,  -1.72215402e-01f,   5.05201966e-02f,   1.71366632e-01f,
+              1.04575492e-01f,   7.85857141e-02f,  -2.48993903e-01f,   4.64090295e-02f,   2.56481409e-01f,   1.06472716e-01f,
+             -1.05599761e-01f,   2.30711833e-01f,   2.16571212e-01f,  -2.40913779e-02f,  -2.61906147e-01f,  -8.36347714e-02f,
+             -7.84762651e-02f,  -4.32302691e-02f,  -8.14318191e-03f,   8.34303275e-02f,   7.23303482e-02f,   6.55815899e-02f,
+              3.60210799e-02f,  -2.15879176e-02f,   1.33093119e-01f,   6.31795079e-02f,  -5.10836467e-02f,  -9.46809426e-02f,
+              9.18356106e-02f,   9.27299038e-02f,   7.00905547e-02f,   1.18221447e-01f,   1.52272969e-01f,  -2.34063581e-01f,
+             -1.53905362e-01f,  -1.35436684e-01f,   1.48944050e-01f,   6.39949292e-02f,   7.24742785e-02f,  -3.56454886e-02f,
+             -1.01047762e-01f,  -1.01220638e-01f,  -1.24344304e-01f,  -1.21279135e-01f,  -5.06464392e-02f,  -8.94796029e-02f,
+             -1.93082869e-01f,  -9.97572858e-03f,   1.72121346e-01f,   2.51735091e-01f,   1.95509344e-01f,   2.44050741e-01f,
+              1.03279650e-01f,  -2.30235219e-01f,  -2.16208979e-01f,  -1.38492852e-01f,  -3.82441692e-02f,  -2.87325978e-02f,
+              1.91207126e-01f,   3.60789672e-02f,  -8.43103901e-02f,  -2.26634711e-01f,  -4.58872057e-02f,   7.23095320e-04f,
+             -7.73730204e-02f,  -7.44204447e-02f,  -3.31620038e-01f,   1.93129610e-02f,   2.90971339e-01f,   1.85402438e-01f,
+              2.59046983e-02f,   3.51509064e-01f,   2.11720839e-01f,  -6.02796301e-03f,   2.18995083e-02f,   2.18570814e-01f,
+              4.33538221e-02f,   4.33313102e-03f,  -1.64765164e-01f,  -3.70991118e-02f,   1.76945373e-01f,   5.35185374e-02f,
+              1.99933738e-01f,   1.18729539e-01f,   8.96350294e-02f,   9.79152136e-03f,   9.98948701e-03f,   6.31663501e-02f,
+             -9.45971459e-02f,  -1.56668620e-03f,   1.34115964e-01f,   9.16434675e-02f,  -1.36479706e-01f,  -1.70393288e-01f,
+              1.73823945e-02f,   9.93196368e-02f,  -3.84836882e-01f,  -1.48939624e-01f,   8.39699358e-02f,  -1.42854840e-01f,
+             -2.47293010e-01f,   1.13591149e-01f,  -6.24439977e-02f,  -3.43461722e-01f,  -3.28875721e-01f,  -2.50283126e-02f,
+              1.25364244e-01f,  -8.25564861e-02f,   3.25538553e-02f,  -3.83398086e-02f,  -2.36279443e-01f,  -9.41047221e-02f,
+              1.15564145e-01f,   1.62915543e-01f,  -1.11262448e-01f,  -2.62802929e-01f,  -4.61895205e-02f,  -3.47687081e-02f,
+             -2.11466655e-01f,  -8.79694521e-02f,  -2.06980705e-01f,  -2.64093071e-01f,  -2.60009497e-01f,  -2.03527525e-01f,
+              5.67654660e-03f,  -3.93676478e-03f,   6.73905313e-02f,  -1.72540635e-01f,   3.54979374e-02f,   2.65771270e-01f,
+              2.75287271e-01f,   8.62903073e-02f,  -4.20069098e-02f,  -1.63528964e-01f,  -1.43415518e-02f,   1.79450512e-01f,
+              4.78252247e-02f,   6.58741146e-02f,   4.83052395e-02f,  -5.42160235e-02f,   6.52494058e-02f,   1.25311881e-01f,
+              9.98957306e-02f,  -4.35113348e-02f,  -7.21378997e-02f,  -6.62680417e-02f,  -2.41757646e-01f,  -7.66997412e-02f,
+             -1.80539593e-01f,  -3.09446216e-01f,  -1.00358643e-01f,   1.30739897e-01f,   1.56780720e-01f,   1.06512852e-01f,
+              1.17681012e-01f,   1.62228703e-01f,  -1.25790223e-01f,   2.47790627e-02f,   2.04259485e-01f,  -3.58857331e-03f,
+             -3.02218437e-01f,  -3.21812987e-01f,  -1.38171921e-02f,   1.69548765e-01f,   1.52503783e-02f,   8.08908790e-03f,
+             -2.14398205e-02f,  -5.69977202e-02f,  -7.11024776e-02f,   8.35187361e-02f,   2.81249844e-02f,  -5.50745390e-02f,
+             -7.17990324e-02f,   1.00936359e-02f,   4.60056625e-02f,   1.12455003e-01f,   1.22418448e-01f,  -2.82549188e-02f,
+             -1.32358953e-01f,   8.63317214e-03f,   4.02434438e-01f,   2.75128365e-01f,  -2.46633410e-01f,   1.83078293e-02f,
+              2.40592480e-01f,   7.88130388e-02f,   1.14259213e-01f,   4.88912351e-02f,  -5.88411912e-02f,   8.55964869e-02f,
+             -2.03059576e-02f,  -2.45853513e-01f,  -1.99621230e-01f,  -1.24705583e-02f,   1.84315052e-02f,   1.57399029e-02f,
+             -1.33536175e-01f,   7.42661282e-02f,   1.12725049e-01f,   2.23654330e-01f,   3.29237819e-01f,   5.81263825e-02f,
+             -2.86804557e-01f,  -2.82762378e-01f,  -9.79511067e-02f,   2.04308797e-02f,  -3.65538895e-02f,   1.79133546e-02f,
+              1.55845076e-01f,   2.50641614e-01f,   1.31042361e-01f,   1.77714840e-01f,   2.71448523e-01f,   1.79824680e-01f,
+              3.91391590e-02f,  -3.79975513e-02f,  -1.41509399e-01f,   2.65092045e-01f,   3.91222119e-01f,   3.75717580e-01f,
+              6.00722916e-02f,  -3.23001236e-01f,  -4.64036107e-01f,  -2.28005797e-01f,  -1.85331345e-01f,   2.32039019e-02f,
+             -1.78705633e-01f,  -1.43619269e-01f,   6.48699701e-02f,   1.88552141e-01f,   2.90396512e-01f,   2.40622550e-01f,
+              8.94660950e-02f,  -3.07648536e-02f,  -6.34024963e-02f,  -1.76722240e-02f,  -7.35651702e-02f,  -7.83877000e-02f,
+             -1.53324232e-01f,  -1.59821585e-01f,  -4.62859690e-01f,  -4.11394358e-01f,   3.08881849e-02f,   3.14066112e-01f,
+              2.94182003e-01f,  -2.04551127e-02f,  -7.80702394e-04f,  -8.46139789e-02f,  -3.44581962e-01f,  -1.87998295e-01f,
+              1.14630282e-01f,   5.54516837e-02f,  -9.82896611e-02f,  -1.24377847e-01f,   1.12142771e-01f,   2.24411055e-01f,
+             -4.26901057e-02f,   1.56168295e-02f,  -1.40476748e-01f,  -2.06897501e-02f,   4.00905550e-01f,   3.19904268e-01f,
+             -1.39447764e-01f,  -3.95864755e-01f,  -2.25893810e-01f,   4.90110107e-02f,  -1.83643717e-02f,  -1.23664141e-01f,
+             -1.31306157e-01f,  -1.35602728e-01f,  -3.92545424e-02f,   8.36493149e-02f,   7.04979375e-02f,   6.01794347e-02f,
+             -1.45127364e-02f,  -1.53196529e-02f,   1.21149436e-01f,   2.42394328e-01f,   2.35762969e-01f,  -1.01271756e-01f,
+             -2.75728106e-01f,   1.44868819e-02f,   1.15323000e-01f,  -1.72748938e-02f,  -1.29208714e-01f,  -1.03856698e-01f,
+             -2.13127404e-01f,  -1.15325689e-01f,  -8.43478814e-02f,  -1.18807316e-01f,  -1.59728065e-01f,   2.43257713e-02f,
+              9.13247690e-02f,   8.47417861e-03f,  -2.23810244e-02f,  -3.81067321e-02f,   8.80258828e-02f,  -7.81906582e-03f,
+             -1.18066579e-01f,  -6.79608807e-02f,  -1.98650118e-02f,  -2.60099676e-02f,  -4.97029200e-02f,  -8.58357623e-02f,
+             -6.41646236e-02f,  -2.92917006e-02f,  -2.08400398e-01f,  -1.56215101e-01f,  -1.88125819e-01f,   4.41580340e-02f,
+              1.53263181e-01f,  -8.51107538e-02f,   6.55143261e-02f,   1.25593111e-01f,   1.42317191e-01f,   8.22894424e-02f,
+              3.51302326e-02f,   3.64459194e-02f,  -6.05053082e-02f,  -1.65454164e-01f,  -1.82963178e-01f,  -1.06049344e-01f,
+              2.48106346e-02f,   9.85063687e-02f,   5.98718300e-02f,   6.60557598e-02f,  -1.14984892e-01f,   2.16284946e-01f,
+              2.04717994e-01f,   2.54697978e-01f,   2.01876864e-01f,   2.44887471e-01f,   8.86006132e-02f,  -1.00154363e-01f,
+             -2.98701793e-01f,  -2.92176187e-01f,  -1.38890386e-01f,  -1.75439924e-01f,  -4.92787212e-02f,  -6.47521019e-02f,
+              1.69611007e-01f,   3.32411468e-01f,   1.25031933e-01f,  -5.43178134e-02f,   1.19164065e-01f,   1.64326563e-01f,
+             -4.75764647e-02f,  -1.37514263e-01f,  -5.95883541e-02f,   2.22675987e-02f,  -3.65698710e-02f,   9.05840751e-03f,
+             -1.99117377e-01f,  -2.18367636e-01f,  -3.78168002e-02f,  -6.99537247e-02f,  -9.26258415e-03f,  -1.05015367e-01f,
+             -1.97053403e-01f,  -1.35420710e-01f,  -9.14975330e-02f,  -1.92073971e-01f,  -1.23488791e-01f,  -5.00124246e-02f,
+             -1.14299078e-02f,   8.85230079e-02f,  -3.68830301e-02f,  -6.19797818e-02f,   1.49213476e-02f,   7.80623257e-02f,
+              3.36005576e-02f,  -9.79073346e-03f,  -4.63514104e-02f,   5.22775203e-02f,   1.04610279e-01f,   6.71153218e-02f,
+             -7.34520182e-02f,  -6.07347228e-02f,  -8.11510533e-02f,  -8.23348686e-02f,  -3.81841324e-02f,  -8.14315863e-03f,
+              9.68120247e-03f,   3.44760507e-01f,   1.94109187e-01f,   3.02051697e-02f,  -1.08062904e-02f,  -7.68288821e-02f,
+             -1.41826853e-01f,  -1.79595128e-01f,  -3.38341556e-02f,   9.48022828e-02f,  -1.61012262e-01f,  -7.91626945e-02f,
+              7.71629484e-03f,  -1.62986755e-01f,   2.09802040e-03f,  -1.15218706e-01f,  -8.45391527e-02f,   1.48207292e-01f,
+              4.56568748e-01f,   2.66810000e-01f,  -1.58851534e-01f,   3.65457274e-02f,   1.75295502e-01f,  -3.91448773e-02f,
+              3.00433096e-02f,  -3.04752737e-02f,   1.36093765e-01f,   1.40957043e-01f,   2.77190320e-02f,   2.12955683e-01f,
+              1.03961691e-01f,  -3.79697710e-01f,  -2.84905314e-01f,   5.36696985e-02f,  -3.80010679e-02f,  -2.17634007e-01f,
+              3.33683491e-02f,   4.99560088e-01f,   5.72673082e-01f,   2.91281175e-02f,  -3.30024838e-01f,  -9.82959121e-02f,
+              3.10323946e-02f,  -1.74723640e-01f,   1.57836616e-01f,   2.59287916e-02f,  -3.17678601e-01f,  -9.66207609e-02f,
+              7.05174357e-02f,  -4.20037299e-01f,  -1.11383826e-01f,   3.97373468e-01f,   2.27614224e-01f,  -2.15185717e-01f,
+              5.21578081e-03f,  -1.11111030e-01f,  -1.00997046e-01f,   3.34010780e-01f,   4.97750580e-01f,   2.15239031e-03f,
+             -1.18147872e-01f,  -5.95151410e-02f,  -2.58919019e-02f,   3.04100215e-02f,   2.88519412e-01f,  -1.22958142e-02f,
+              1.32903695e-01f,  -3.17199379e-02f,  -4.24888767e-02f,   1.35713518e-01f,  -2.03534544e-01f,  -2.15435341e-01f,
+              1.20957948e-01f,   2.71830648e-01f,   3.29354592e-02f,   7.75757879e-02f,   3.18833560e-01f,   1.53658763e-01f,
+              1.12800352e-01f,   2.34985948e-02f,  -1.70093983e-01f,   8.13852996e-03f,   1.79162323e-01f,   4.25434522e-02f,
+             -2.62271583e-01f,  -2.99727991e-02f,  -5.42304032e-02f,   7.14667365e-02f,   9.20004323e-02f,   5.68555258e-02f,
+              5.09249903e-02f,   1.11477971e-01f,   7.79801309e-02f,  -1.54632078e-02f,  -2.02442128e-02f,  -1.00472972e-01f,
+             -1.24236442e-01f,   3.36065181e-02f,   4.56876308e-02f,   3.04158419e-01f,   3.74072522e-01f,   1.91998795e-01f,
+              9.13532153e-02f,   4.33315299e-02f,   1.23664953e-01f,  -1.37655232e-02f,   1.84461853e-04f,   7.90765211e-02f,
+             -2.77266111e-02f,  -1.09931380e-01f,   9.56670381e-03f,   1.81380138e-02f,   1.71536535e-01f,   2.41340518e-01f,
+              6.14656992e-02f,   1.80370659e-01f,   4.96504717e-02f,  -8.94019902e-02f,   2.99224141e-03f,   2.52691120e-01f,
+              2.64129370e-01f,   5.84325865e-02f,   8.92585590e-02f,   3.53158772e-01f,  -5.48722073e-02f,  -8.16259310e-02f,
+             -1.63665131e-01f,  -1.08132325e-01f,   5.97541705e-02f,   1.87514514e-01f,   1.41917363e-01f,   1.93820238e-01f,
+              3.82826552e-02f,  -2.35686004e-01f,   6.51030391e-02f,  -4.52889539e-02f,  -1.08196333e-01f,  -6.96246624e-02f,
+             -1.02088243e-01f,  -1.07967354e-01f,   5.93100563e-02f,   1.90174788e-01f,   1.75943792e-01f,   1.53741211e-01f,
+              2.14746967e-01f,   1.19297370e-01f,   7.40512535e-02f,  -1.72601398e-02f,  -6.64135888e-02f,  -1.19110107e-01f,
+             -5.79371341e-02f,  -7.35386536e-02f,  -3.57788987e-02f,   1.50186969e-02f,   1.06805377e-01f,  -4.19363473e-03f,
+             -7.60290399e-02f,  -1.96149588e-01f,  -2.51782864e-01f,   1.27145901e-01f,   2.36419812e-01f,   2.17668042e-01f,
+              3.01212728e-01f,  -5.76330386e-02f,   8.53119120e-02f,   5.56785651e-02f,  -3.08749545e-02f,   6.13671131e-02f,
+              3.24431002e-01f,   3.17930549e-01f,   1.50991946e-01f,   9.20490921e-03f,   1.12058537e-03f,  -7.00193867e-02f,
+              6.98893517e-02f,  -1.18555203e-01f,  -4.42928411e-02f,   2.85802633e-01f,   1.39692724e-01f,  -3.17230493e-01f,
+              3.12360246e-02f,   1.19002745e-01f,  -1.93430617e-01f,  -1.51350483e-01f,   1.90106407e-02f,   3.51665542e-02f,
+             -1.90100506e-01f,  -2.01226383e-01f,  -2.17991397e-01f,  -3.13823700e-01f,   6.58876970e-02f,   9.93377492e-02f,
+              1.49563462e-01f,   1.40108010e-02f,  -1.76265463e-02f,   5.80272153e-02f,   1.09309480e-02f,  -3.10105294e-01f,
+             -4.33544427e-01f,  -1.71900600e-01f,  -2.04774052e-01f,  -2.36215875e-01f,  -7.96661973e-02f,   1.22199267e-01f,
+             -3.56527790e-02f,  -5.40127084e-02f,   4.48158756e-02f,  -3.07797622e-02f,  -4.09694063e-03f,   3.25704098e-01f,
+              8.27584043e-02f,  -2.10998341e-01f,  -1.15237191e-01f,   3.77134755e-02f,  -7.80422762e-02f,   1.24575518e-01f,
+             -8.93601496e-03f,  -3.20650846e-01f,  -5.04996598e-01f,  -4.07224268e-01f,  -1.85766295e-01f,   1.28418848e-01f,
+              3.17495257e-01f,   1.66804045e-02f,  -4.50485766e-01f,  -1.07742280e-01f,   5.98515850e-03f,   1.73869997e-01f,
+              2.88609058e-01f,  -1.01791605e-01f,  -2.61918008e-01f,   3.02839652e-02f,   2.74650872e-01f,  -8.27417448e-02f,
+             -3.35931957e-01f,   7.33409636e-03f,  -1.50685664e-02f,  -9.36259609e-03f,  -8.79211649e-02f,  -1.37900010e-01f,
+              1.56425029e-01f,  -1.07663393e-01f,  -2.86267787e-01f,   1.76837415e-01f,   3.38418148e-02f,  -4.01232531e-03f,
+             -3.86319533e-02f,  -1.34538010e-01f,   1.76113367e-01f,   4.75693554e-01f,   1.82087138e-01f,  -3.19458731e-02f,
+              3.83705134e-03f,  -5.57649583e-02f,  -1.25017576e-03f,  -1.22629501e-01f,   1.05979163e-02f,   2.02515423e-01f,
+              6.02375939e-02f,   2.94386726e-02f,   3.37807052e-02f,   1.44405901e-01f,   3.64762276e-01f,   6.17205258e-03f,
+             -1.56950116e-01f,  -1.24573536e-01f,  -4.04325612e-02f,  -2.25235432e-01f,  -2.26762727e-01f,   2.64382455e-02f,
+             -1.54210646e-02f,  -6.17992249e-04f,   1.21591322e-01f,  -4.71274480e-02f,  -1.83386847e-01f,  -1.57005906e-01f,
+             -1.60107668e-02f,   2.85946339e-01f,   1.39832541e-01f,  -1.48410589e-01f,  -3.18549365e-01f,  -8.51519480e-02f,
+              1.13814145e-01f,   1.57097310e-01f,   2.35928357e-01f,   9.88301337e-02f,  -1.07896179e-01f,   9.70440879e-02f,
+              2.14708582e-01f,  -1.37044555e-02f,   3.18613388e-02f,   1.67771026e-01f,   8.38679224e-02f,   7.72713646e-02f,
+              2.51890887e-02f,  -2.35516608e-01f,  -1.19133644e-01f,   1.52156100e-01f,   2.44360909e-01f,  -6.10797927e-02f,
+             -2.05063283e-01f,   1.69242635e-01f,   2.38347307e-01f,  -1.75246179e-01f,   3.42608280e-02f,  -1.04767837e-01f,
+             -3.73270363e-02f,   7.18574449e-02f,  -2.45840564e-01f,  -2.06102580e-01f,  -7.21949488e-02f,  -5.06159998e-02f,
+              9.82583612e-02f,   1.31761283e-01f,   3.13082710e-02f,   2.40958765e-01f,   1.56467393e-01f,  -5.54179698e-02f,
+              7.48660192e-02f,   2.91422516e-01f,   2.07480893e-01f,  -1.35628194e-01f,  -1.29092112e-01f,   1.54841542e-01f,
+             -1.81942269e-01f,   4.37858142e-02f,   6.14198186e-02f,  -1.02773607e-02f,  -1.11752495e-01f,  -1.20875165e-01f,
+             -7.15695769e-02f,  -1.28628373e-01f,  -3.73537131e-02f,   1.36525378e-01f,  -5.65449335e-03f,  -5.72359785e-02f,
+             -8.64783749e-02f,  -1.18514203e-01f,   1.85058147e-01f,   4.01503921e-01f,   2.06161991e-01f,  -4.61316295e-02f,
+             -1.54874951e-01f,   1.73351243e-01f,  -1.36989802e-01f,  -1.77755773e-01f,  -2.09620893e-01f,  -1.01977866e-02f,
+             -8.97872075e-02f,  -9.73500013e-02f,   1.32542878e-01f,   1.82921961e-01f,   1.16356075e-01f,   1.41626880e-01f,
+             -1.09321266e-01f,  -2.63328571e-02f,   2.21548110e-01f,  -1.99417770e-02f,  -1.03919409e-01f,  -2.35854834e-01f,
+             -3.65164727e-01f,  -1.31189317e-01f,   1.24496348e-01f,  -1.06194369e-01f,  -9.55019146e-02f,  -7.22198635e-02f,
+             -9.08415765e-02f,   4.47621569e-03f,   1.62043825e-01f,   6.57217996e-03f,  -3.46503146e-02f,  -7.80276135e-02f,
+              1.29082024e-01f,   1.19565919e-01f,   4.72252704e-02f,   1.98875770e-01f,   2.62593925e-01f,   1.49114296e-01f,
+              1.04861528e-01f,   2.68782884e-01f,   2.89317608e-01f,   1.97632447e-01f,   1.42642081e-01f,   2.21263483e-01f,
+             -1.11823432e-01f,  -1.67066827e-01f,   7.40421861e-02f,   9.34559777e-02f,   8.04275051e-02f,   1.02989323e-01f,
+             -2.95854419e-01f,   5.35896197e-02f,   1.12688221e-01f,   1.26288474e-01f,  -2.10091341e-02f,  -6.20598830e-02f,
+             -2.62609851e-02f,   1.06043806e-02f,   3.79497141e-01f,   9.17571858e-02f,  -1.22417085e-01f,   3.80346686e-01f,
+              2.41545185e-01f,  -2.18939096e-01f,  -3.62736173e-02f,  -7.43259415e-02f,  -2.12500319e-01f,  -1.81828707e-01f,
+             -5.87526411e-02f,   8.92276615e-02f,   6.74269721e-02f,   2.26843469e-02f,   4.93601039e-02f,   3.29509079e-02f,
+             -1.95520878e-01f,  -1.58813462e-01f,  -1.69862539e-01f,  -3.87927800e-01f,  -2.35347927e-01f,  -2.92805821e-01f,
+             -2.26120636e-01f,  -1.47266716e-01f,  -1.42786186e-02f,   5.12362793e-02f,   2.53793120e-01f,  -6.94178939e-02f,
+             -1.28456041e-01f,  -2.09111229e-01f,   2.13121995e-01f,  -4.83757891e-02f,  -3.36935073e-02f,   1.29734397e-01f,
+              4.10694480e-02f,  -3.17671180e-01f,  -1.17376216e-01f,  -1.40954524e-01f,  -1.69879213e-01f,  -8.52207914e-02f,
+              3.32709178e-02f,   3.77561711e-02f,   6.29279092e-02f,   1.71219260e-01f,   2.54579544e-01f,  -3.98855982e-03f,
+             -3.24379839e-03f,  -1.91265568e-02f,  -2.88705267e-02f,   7.91256595e-03f,   1.61595047e-01f,   1.16714850e-01f,
+             -3.66129680e-03f,   1.82790160e-02f,  -7.92204067e-02f,  -4.47642505e-02f,  -7.08239675e-02f,  -1.16850369e-01f,
+             -2.12709963e-01f,  -1.14936009e-01f,   3.35236996e-01f,   1.57206610e-01f,   6.99966922e-02f,   7.00575784e-02f,
+             -9.56213325e-02f,  -1.14334621e-01f,  -2.31821649e-02f,  -9.17088389e-02f,  -2.00176746e-01f,  -1.16834886e-01f,
+             -5.90682589e-02f,  -1.01967424e-01f,  -1.14964075e-01f,   3.83226089e-02f,   1.12279080e-01f,   1.43751547e-01f,
+              1.45136397e-02f,   1.47707582e-01f,   2.71544129e-01f,   1.35808542e-01f,  -2.38730282e-01f,  -4.27151740e-01f,
+             -3.51664841e-01f,  -1.73439562e-01f,  -2.01097772e-01f,  -8.34539235e-02f,  -1.97210044e-01f,  -7.04885945e-02f,
+              4.75704819e-02f,   2.58752704e-02f,  -1.06154568e-01f,  -1.25165150e-01f,   2.42376905e-02f,   2.33731389e-01f,
+              1.57047704e-01f,   1.58253927e-02f,  -1.57867804e-01f,   8.33709687e-02f,   2.84667850e-01f,   1.50308266e-01f,
+             -2.52468348e-01f,  -5.34627199e-01f,  -2.54798055e-01f,   1.75208509e-01f,   5.94900958e-02f,   7.31203482e-02f,
+              1.57157034e-02f,  -5.59562759e-04f,  -3.93738672e-02f,  -1.24300100e-01f,  -1.16000786e-01f,   3.41525823e-02f,
+              1.82471305e-01f,   2.73565203e-01f,   2.48357952e-01f,   7.08335638e-02f,   5.13584390e-02f,  -4.45537046e-02f,
+             -1.64108902e-01f,  -2.90958047e-01f,  -6.12747595e-02f,   3.38516921e-01f,   3.58639389e-01f,   1.92596123e-01f,
+              9.55146849e-02f,  -1.75186291e-01f,   1.80688351e-01f,  -3.04479059e-03f,  -1.29814148e-01f,  -2.19570979e-01f,
+             -3.09875101e-01f,  -1.26703680e-01f,  -9.45380256e-02f,  -2.14752287e-01f,  -1.03730738e-01f,  -8.26093107e-02f,
+             -9.25199036e-03f,   1.47742078e-01f,   2.29386196e-01f,   2.37572104e-01f,   3.92319053e-01f,   5.59929647e-02f,
+             -2.84579784e-01f,  -3.88435662e-01f,  -3.17100942e-01f,   1.10492676e-01f,  -7.77489040e-03f,  -2.50295382e-02f,
+              3.87222692e-02f,   7.54915252e-02f,   2.13404089e-01f,   1.51460513e-01f,   1.47654757e-01f,   1.38143748e-01f,
+             -1.12728141e-02f,  -2.10777462e-01f,
+        };
+
+        static const float DM_ALIGNED(32) col_filters[3050] = {
+              2.95684040e-01f,   2.58705169e-01f,  -2.14267969e-02f,   8.50818120e-03f,  -8.80677160e-03f,  -2.94272397e-02f,
+             -1.60298385e-02f,  -9.64246020e-02f,  -1.71270460e-01f,  -2.22765096e-02f,   1.54593447e-02f,  -8.23083054e-03f,
+             -2.84814406e-02f,  -1.15212053e-01f,  -1.19054563e-01f,  -8.45007375e-02f,   8.21855068e-02f,   2.06444059e-02f,
+              1.15674445e-02f,   1.42591028e-02f,  -3.35752994e-01f,  -2.70575166e-01f,  -1.22934036e-01f,  -2.35236183e-01f,
+              3.14179203e-03f,   1.54377578e-03f,   1.02665968e-01f,   2.15529323e-01f,   2.64822751e-01f,   4.57639731e-02f,
+              1.38608873e-01f,   8.74089822e-02f,  -4.81879935e-02f,  -3.47260863e-01f,  -1.86556920e-01f,  -5.55850267e-02f,
+              8.52654129e-03f,  -4.16418724e-02f,  -4.55067120e-02f,   7.42851421e-02f,  -2.27127641e-01f,  -2.15491131e-01f,
+              3.26603390e-02f,   3.48232031e-01f,   9.05921012e-02f,  -4.27502915e-02f,   5.94342463e-02f,  -1.74377207e-02f,
+              3.59596126e-02f,   1.35690138e-01f,  -2.31541302e-02f,  -1.21886559e-01f,  -6.80545121e-02f,  -4.37671021e-02f,
+              6.65195137e-02f,   1.30157918e-01f,   1.02621838e-01f,   8.63855854e-02f,  -5.13945483e-02f,  -1.27254903e-01f,
+             -2.40894291e-03f,  -6.67406106e-03f,   1.12436250e-01f,   3.73744786e-01f,   1.71191946e-01f,  -1.34722292e-01f,
+             -5.07431217e-02f,  -1.42579442e-02f,   1.02930842e-02f,   3.72462459e-02f,  -1.57978594e-01f,  -1.29874190e-02f,
+              2.99117882e-02f,   4.07721400e-02f,  -1.09712603e-02f,   7.93619975e-02f,   1.57368377e-01f,   5.15538938e-02f,
+             -2.16559526e-02f,   6.56323656e-02f,   1.53928362e-02f,   1.56748027e-01f,   3.36394906e-01f,   5.27035475e-01f,
+              2.88473219e-01f,  -3.08073133e-01f,  -3.49137068e-01f,  -1.96377322e-01f,  -9.28661600e-02f,  -1.05811544e-01f,
+             -3.99488211e-02f,  -1.38539001e-01f,   6.03877343e-02f,  -1.22886389e-01f,   5.54045141e-02f,   2.56143302e-01f,
+             -2.02129722e-01f,  -3.39245498e-01f,  -8.80203992e-02f,   1.47952378e-01f,   3.34707201e-02f,   1.76360622e-01f,
+              3.13782036e-01f,   4.49819177e-01f,   3.28364044e-01f,  -2.77204096e-01f,  -3.53844285e-01f,  -2.67528385e-01f,
+             -1.26753926e-01f,  -1.51319459e-01f,   7.29423240e-02f,   1.17760278e-01f,   6.35513067e-02f,   1.99123919e-01f,
+              3.98709215e-02f,  -1.55524924e-01f,   2.43735299e-01f,   3.89685124e-01f,   1.33114025e-01f,  -1.21886835e-01f,
+              8.27911496e-02f,   7.81494901e-02f,  -1.53360069e-01f,  -3.12563151e-01f,  -1.29443601e-01f,   1.54095635e-01f,
+              1.10738508e-01f,   2.52606790e-03f,   3.18465978e-02f,  -4.24144864e-02f,   1.22455724e-01f,   1.93705894e-02f,
+             -6.22095093e-02f,   5.58421621e-03f,  -2.41229180e-02f,  -8.36942792e-02f,  -9.10881981e-02f,  -3.31392325e-02f,
+             -8.24758690e-03f,  -1.79330669e-02f,   1.84125930e-01f,   1.74492493e-01f,  -8.70092735e-02f,  -3.63152832e-01f,
+             -7.04811662e-02f,   1.35043841e-02f,  -6.75978214e-02f,   3.21670286e-02f,   3.21019106e-02f,  -1.24454081e-01f,
+              6.90706521e-02f,  -3.37479189e-02f,  -2.68972926e-02f,   2.87299957e-02f,   5.63753955e-02f,   1.91575214e-01f,
+              1.45237043e-01f,   6.05068803e-02f,  -3.11792572e-03f,  -8.53479207e-02f,   3.97008538e-01f,   3.03375334e-01f,
+              1.25259027e-01f,   1.13781728e-01f,  -1.09379105e-01f,  -5.49109615e-02f,  -1.11435197e-01f,  -2.11588964e-01f,
+             -2.86533624e-01f,  -5.54121658e-02f,  -6.97755590e-02f,  -2.68338397e-02f,   1.08955652e-01f,   3.45334560e-01f,
+              8.23502466e-02f,  -1.40954331e-02f,   8.95968452e-02f,   7.87079800e-03f,  -2.39685806e-03f,  -3.78619954e-02f,
+             -1.83537513e-01f,  -1.70608684e-01f,   2.78661884e-02f,  -3.45437564e-02f,  -8.50309432e-02f,  -8.81817043e-02f,
+              1.23256020e-01f,   1.17760472e-01f,   1.42720088e-01f,   3.95778641e-02f,  -1.27799228e-01f,  -2.13413276e-02f,
+              2.24282146e-01f,   8.82402807e-02f,  -1.40848339e-01f,  -2.07440183e-01f,  -2.72794396e-01f,  -2.19841212e-01f,
+              2.54658777e-02f,   1.42377272e-01f,  -1.66871488e-01f,  -1.71561897e-01f,  -1.92393124e-01f,  -3.39744762e-02f,
+              2.33882248e-01f,   2.81963408e-01f,   7.02131093e-02f,   1.16588594e-02f,  -1.07082911e-01f,  -2.24720873e-02f,
+              1.48617730e-01f,   1.15420923e-01f,  -1.05286583e-01f,   9.86975729e-02f,   1.12626073e-03f,  -4.60569896e-02f,
+              1.99362203e-01f,   3.67980301e-02f,  -2.44409189e-01f,   7.88789056e-03f,   9.86380875e-02f,  -8.00508782e-02f,
+             -1.55798897e-01f,  -4.21839356e-02f,  -1.18757850e-02f,  -4.98826541e-02f,   1.77000128e-02f,   1.76421672e-01f,
+              1.25102565e-01f,   7.75313079e-02f,   3.80107015e-02f,   1.46584511e-01f,   2.83785254e-01f,   6.27290681e-02f,
+              2.71804333e-01f,   3.68926525e-01f,   8.08420703e-02f,  -6.12810068e-02f,  -2.71777883e-02f,   7.94851407e-02f,
+             -4.05575186e-02f,  -1.36526138e-01f,   7.51856640e-02f,   3.03070903e-01f,   8.74427631e-02f,  -6.80022612e-02f,
+              2.79083382e-02f,   4.94864993e-02f,  -2.14468464e-01f,  -2.83393234e-01f,   2.26645637e-02f,  -5.49037382e-02f,
+              1.93170726e-01f,   5.20827055e-01f,  -1.88667644e-02f,  -2.02308133e-01f,  -2.45300487e-01f,  -3.13993722e-01f,
+             -1.03777647e-01f,  -9.32285041e-02f,  -7.77195618e-02f,  -3.81652832e-01f,  -3.69041800e-01f,  -5.33135375e-03f,
+              1.83273733e-01f,  -4.19919193e-03f,  -2.45052814e-01f,  -2.22635455e-02f,   6.55891746e-02f,   3.01961936e-02f,
+              5.49552180e-02f,   3.77118737e-01f,   3.04600656e-01f,  -1.70458183e-01f,  -1.85856372e-02f,   2.04810828e-01f,
+              3.72947335e-01f,   2.84126759e-01f,   8.87183379e-03f,   1.61797449e-01f,  -5.22454306e-02f,   1.42338559e-01f,
+              4.70982194e-01f,   2.88796455e-01f,  -8.55542868e-02f,  -9.58912820e-02f,  -1.50849938e-01f,  -1.97509363e-01f,
+             -1.85085520e-01f,  -8.01794156e-02f,  -5.11823073e-02f,   5.97379655e-02f,   2.77632505e-01f,   5.33283316e-02f,
+              2.23582461e-01f,   2.95734257e-01f,  -2.96385586e-02f,  -9.99972597e-02f,  -3.90214585e-02f,   5.82744973e-03f,
+             -1.01603416e-03f,   6.27689362e-02f,  -4.18868996e-02f,  -2.42361501e-01f,  -1.59542747e-02f,   7.56443664e-02f,
+             -1.60781574e-02f,  -6.05153330e-02f,   1.59951732e-01f,   2.85257339e-01f,  -4.65092920e-02f,  -1.21851526e-01f,
+             -1.10846475e-01f,   2.07514199e-03f,   8.79982114e-02f,   4.98244390e-02f,   2.43946426e-02f,  -2.32818793e-03f,
+             -3.82051393e-02f,   2.61464696e-02f,   2.34925196e-01f,   1.97638378e-01f,   1.11275539e-01f,   7.09342211e-02f,
+             -1.90432921e-01f,  -2.97253817e-01f,   3.43279541e-02f,   8.88371095e-02f,   1.30984619e-01f,   9.90663543e-02f,
+             -2.23257877e-02f,   1.18379466e-01f,   2.33842924e-01f,   1.07796691e-01f,   1.04628950e-02f,  -1.84576176e-02f,
+             -5.14837056e-02f,  -2.65127689e-01f,  -1.76025957e-01f,  -7.00119361e-02f,   8.10474455e-02f,   6.63499534e-02f,
+             -1.11668110e-01f,   9.01895165e-02f,   4.50056419e-02f,   2.82677007e-03f,   1.95199460e-01f,   6.34293854e-02f,
+             -1.94871709e-01f,  -3.55785936e-02f,  -7.34006092e-02f,   6.71714619e-02f,   2.33989701e-01f,   9.22799706e-02f,
+             -1.05123408e-01f,  -2.46394157e-01f,  -2.54961640e-01f,  -1.58741474e-01f,   4.95163016e-02f,   1.50127903e-01f,
+              6.93544447e-02f,  -4.61920984e-02f,  -5.90443388e-02f,  -7.64624923e-02f,  -1.79897264e-01f,  -8.77010748e-02f,
+              5.59856668e-02f,   3.61961275e-02f,   1.20413387e-02f,   5.30781224e-02f,  -3.40425819e-01f,  -3.41874123e-01f,
+             -1.74210802e-01f,  -4.35641780e-02f,  -1.61561802e-01f,  -5.54936901e-02f,  -3.04729015e-01f,  -1.96095183e-01f,
+             -7.50963762e-02f,   3.28267738e-02f,   1.09607734e-01f,   5.60140703e-03f,  -1.25633135e-01f,  -3.54086250e-01f,
+             -3.01367134e-01f,  -2.33316883e-01f,   1.35978237e-01f,   8.35488141e-02f,   6.55257404e-02f,   9.19951648e-02f,
+             -2.23907661e-02f,   1.18513741e-01f,   1.47014782e-01f,   2.97553152e-01f,   3.37614447e-01f,   1.99238196e-01f,
+              1.62843671e-02f,  -1.83055457e-02f,  -1.59332920e-02f,  -2.22997125e-02f,   6.74537718e-02f,  -7.78154517e-03f,
+              5.51175103e-02f,   5.97500652e-02f,  -6.00355156e-02f,  -3.33780050e-02f,  -1.47175193e-01f,  -1.84556842e-01f,
+             -1.00296170e-01f,  -3.99053358e-02f,   1.84833035e-01f,   1.05687276e-01f,   3.17760557e-02f,  -2.77803950e-02f,
+             -1.19673926e-02f,  -6.09803852e-03f,   8.69902372e-02f,  -6.38471032e-03f,  -1.22741582e-02f,   5.67695461e-02f,
+             -1.77907348e-01f,  -8.54898691e-02f,   5.25603443e-02f,   7.19481800e-03f,  -1.55441016e-01f,  -1.61110386e-01f,
+             -1.28166139e-01f,  -4.19450551e-02f,   2.38734320e-01f,   1.67845994e-01f,  -4.74004149e-02f,   3.95520590e-03f,
+              1.36951908e-01f,   2.71484572e-02f,  -8.30262303e-02f,   1.66515440e-01f,   1.68015773e-03f,  -1.37796834e-01f,
+             -5.63262729e-03f,  -3.44749987e-02f,   9.73045006e-02f,  -1.82241067e-01f,  -4.29774612e-01f,  -1.09114602e-01f,
+              1.54231966e-01f,  -1.94041058e-03f,  -5.49593568e-03f,   1.64183438e-01f,  -9.37940404e-02f,  -1.42103747e-01f,
+              1.19116537e-01f,   1.04460649e-01f,   6.58780113e-02f,  -9.25717652e-02f,  -4.28125681e-03f,   1.93413764e-01f,
+              2.04573974e-01f,   1.27973497e-01f,   4.17628996e-02f,  -7.54668787e-02f,   4.52371508e-01f,   2.70657867e-01f,
+             -3.75433341e-02f,   1.49556935e-01f,   1.32193491e-01f,   2.86999762e-01f,   2.96216667e-01f,   2.25699052e-01f,
+              2.60131687e-01f,   6.62302300e-02f,   1.39702365e-01f,   1.55719057e-01f,   1.33279234e-01f,  -6.34299964e-02f,
+             -7.32541084e-02f,  -6.13487139e-02f,  -6.44051656e-02f,  -1.26823455e-01f,  -7.69118369e-02f,   6.25997782e-02f,
+              7.84087852e-02f,   1.81278497e-01f,   4.58314687e-01f,   1.92640126e-01f,   1.47783518e-01f,  -1.03851207e-01f,
+             -8.35214481e-02f,  -7.00308904e-02f,   4.32209112e-02f,   7.62942284e-02f,   2.11319879e-01f,   1.26885444e-01f,
+             -6.30084425e-02f,   9.55655519e-03f,  -3.83794270e-02f,   1.74483694e-02f,   8.90621394e-02f,   1.99466497e-02f,
+              3.88868265e-02f,   2.75829639e-02f,   1.74266011e-01f,   1.06293194e-01f,  -4.07256931e-02f,  -8.16684123e-03f,
+              1.12153508e-01f,   8.73166025e-02f,   2.73245454e-01f,   2.30358422e-01f,   9.45937485e-02f,  -1.94703043e-01f,
+             -6.20722473e-02f,   1.57476172e-01f,   1.97078079e-01f,  -8.22994336e-02f,  -8.82001445e-02f,   1.61752924e-01f,
+              5.38626797e-02f,  -8.68826285e-02f,   4.59733605e-02f,   9.51032713e-03f,  -1.93901047e-01f,  -4.74609286e-02f,
+              1.57419875e-01f,  -1.47516443e-03f,  -2.56293267e-01f,  -1.48542851e-01f,  -1.98591247e-01f,  -1.05024844e-01f,
+              2.89106578e-01f,   1.78332925e-01f,  -1.26680046e-01f,  -7.86959976e-02f,  -1.59969106e-01f,  -3.04019958e-01f,
+             -2.89158732e-01f,  -1.77395403e-01f,  -2.79351845e-02f,   1.13300100e-01f,   1.11267701e-01f,   6.60566092e-02f,
+             -3.01198773e-02f,  -7.77380541e-02f,  -3.68334129e-02f,   1.83036570e-02f,  -1.07234359e-01f,  -4.74296845e-02f,
+             -2.00290263e-01f,  -3.10381413e-01f,  -1.49956718e-01f,  -5.18632270e-02f,  -2.75637776e-01f,  -3.87551457e-01f,
+             -1.01748906e-01f,   1.70877367e-01f,   1.19702250e-01f,   2.73193687e-01f,   2.45576352e-01f,   2.54810989e-01f,
+              1.66060865e-01f,  -1.46034062e-01f,   1.58644438e-01f,  -6.48501068e-02f,  -4.15813066e-02f,  -6.00634888e-02f,
+             -1.96508452e-01f,  -4.83335495e-01f,  -4.26914513e-01f,  -1.81058541e-01f,   1.31933410e-02f,   3.22488025e-02f,
+              3.40435989e-02f,   2.89368898e-01f,   2.26724938e-01f,   1.92811877e-01f,  -1.39448494e-02f,   4.06170078e-02f,
+             -3.68187763e-02f,  -2.23111391e-01f,  -2.82898158e-01f,  -3.46589796e-02f,  -3.06301296e-01f,  -4.30399001e-01f,
+             -1.12378269e-01f,   2.09260270e-01f,   2.27142543e-01f,   3.19850802e-01f,   2.08023176e-01f,   2.63176233e-01f,
+              1.58949628e-01f,  -1.81242138e-01f,  -1.28814146e-01f,   3.06302551e-02f,   1.47585943e-02f,   3.19487266e-02f,
+              1.58182949e-01f,   3.81454676e-01f,   3.25990945e-01f,   1.09133206e-01f,   3.96031095e-03f,   1.68124624e-02f,
+             -1.15166754e-02f,   2.54154086e-01f,   2.19279796e-01f,   1.34678617e-01f,  -9.68891829e-02f,  -4.40072129e-03f,
+              4.10550945e-02f,  -1.15979463e-01f,  -1.89317554e-01f,   1.31380251e-02f,   1.15389945e-02f,  -1.90889329e-01f,
+             -1.49643049e-01f,   4.28198874e-02f,  -9.57042873e-02f,  -2.53439933e-01f,  -9.76040028e-03f,   9.96455923e-02f,
+              4.90465499e-02f,   2.62805000e-02f,  -7.85671026e-02f,   2.72891182e-03f,  -4.32025306e-02f,  -1.10673919e-01f,
+             -7.26249367e-02f,  -2.47304998e-02f,  -1.00277029e-01f,  -1.02691658e-01f,  -6.93556368e-02f,  -3.27596515e-02f,
+              2.07205787e-01f,   2.22707003e-01f,   1.33879036e-02f,   3.16768110e-01f,   5.06880641e-01f,   2.80143052e-01f,
+             -7.36214742e-02f,  -2.22118512e-01f,  -2.76151717e-01f,  -1.00735165e-01f,  -1.20796084e-01f,  -9.14625973e-02f,
+             -1.11667730e-01f,   9.43394452e-02f,   1.04755469e-01f,   1.88046575e-01f,   2.91761011e-01f,   1.69844165e-01f,
+              8.60525891e-02f,   5.75688258e-02f,  -1.40599445e-01f,  -5.56220450e-02f,  -1.98172983e-02f,   4.10326459e-02f,
+              2.27923482e-03f,  -1.29746765e-01f,  -6.54851347e-02f,  -1.73932776e-01f,   2.62501150e-01f,   6.12492740e-01f,
+              1.22656301e-02f,   6.79379925e-02f,   1.65513735e-02f,  -1.03218518e-01f,  -2.11410955e-01f,   3.73981036e-02f,
+              1.93895429e-01f,   8.23513120e-02f,   4.89520878e-02f,   4.82809693e-02f,   5.96302375e-02f,   7.89819211e-02f,
+             -1.74696103e-01f,  -5.21099389e-01f,  -6.12421989e-01f,  -2.44710147e-02f,   3.49300295e-01f,   1.53343873e-02f,
+              1.59721950e-03f,  -3.55206355e-02f,   4.08909880e-02f,   5.87067790e-02f,  -8.31525624e-02f,  -1.58478975e-01f,
+              1.60199720e-02f,  -1.91314071e-02f,  -2.13116556e-01f,  -4.45541650e-01f,  -3.32598746e-01f,   3.67026061e-01f,
+              2.53466982e-02f,   2.11938787e-02f,   7.40560293e-02f,   3.03717732e-01f,   3.80077630e-01f,   2.26997972e-01f,
+             -1.17075637e-01f,  -4.31238115e-01f,  -2.71797031e-01f,   1.02794684e-01f,  -2.67213769e-02f,   1.58082955e-02f,
+             -3.54596525e-02f,  -5.43369055e-02f,  -2.34944269e-01f,  -4.34185378e-02f,   1.86795056e-01f,  -1.68061584e-01f,
+             -1.96302146e-01f,   1.42658859e-01f,  -2.20907658e-01f,  -1.25672817e-01f,   3.54895890e-02f,  -1.44275808e-04f,
+             -1.57074019e-01f,  -7.13635981e-02f,   1.57991558e-01f,   9.30496380e-02f,   1.15034103e-01f,   1.08865172e-01f,
+              4.92918072e-03f,  -4.06137407e-02f,  -2.67961510e-02f,   3.55841517e-02f,   1.20582402e-01f,   2.02309135e-02f,
+             -2.57606502e-04f,   1.15392469e-01f,   1.20329097e-01f,  -6.62598982e-02f,  -1.59358561e-01f,  -6.07924312e-02f,
+             -1.16253234e-01f,   5.26425280e-02f,   2.79482156e-01f,   1.20845295e-01f,  -5.35505004e-02f,   8.07586089e-02f,
+              1.50980952e-03f,   3.12498491e-02f,   1.29451513e-01f,   1.94525602e-03f,  -9.84116644e-03f,   4.76330854e-02f,
+              8.54005441e-02f,  -9.31658782e-03f,  -2.54199207e-02f,  -5.06193638e-02f,  -7.65412375e-02f,  -8.97261724e-02f,
+             -2.81373322e-01f,  -1.78364575e-01f,  -3.82080108e-01f,  -3.92500758e-01f,  -1.29996508e-01f,  -1.06575042e-02f,
+              2.96226889e-02f,   1.18515842e-01f,   8.32530484e-02f,   1.73879247e-02f,  -6.30517229e-02f,   2.91543249e-02f,
+              3.79898399e-01f,   5.19657969e-01f,   4.92490560e-01f,   1.39833033e-01f,  -1.46850035e-01f,  -1.74850851e-01f,
+             -1.16758071e-01f,  -5.80791272e-02f,   1.27007633e-01f,   1.75632790e-01f,   1.02155730e-01f,  -1.29256532e-01f,
+             -9.18790251e-02f,  -1.72392276e-04f,  -9.25871283e-02f,  -1.97839186e-01f,  -2.04822481e-01f,  -7.60719702e-02f,
+             -8.37028623e-02f,  -2.45249882e-01f,  -1.20795565e-02f,   4.57295626e-02f,   8.63694623e-02f,   1.32918894e-01f,
+              1.76869228e-01f,   1.96598515e-01f,   1.77728400e-01f,   2.32013524e-01f,   1.99516505e-01f,   2.10912615e-01f,
+              1.46879852e-01f,  -9.13010165e-02f,  -5.75922392e-02f,  -4.37816828e-02f,   1.14787087e-01f,   1.42419741e-01f,
+              6.87827989e-02f,   1.06213413e-01f,   1.28851041e-01f,   2.77714819e-01f,   1.46362305e-01f,  -3.06650586e-02f,
+              1.04983382e-01f,  -1.94690563e-02f,   1.56190217e-01f,   2.72715926e-01f,   1.14367329e-01f,  -2.02221945e-01f,
+             -4.95868437e-02f,   4.58023585e-02f,  -9.14320871e-02f,   2.17869971e-02f,   1.81646526e-01f,   3.29394639e-01f,
+              1.64297491e-01f,   4.41748947e-02f,   3.04332435e-01f,   1.75778791e-01f,  -5.00145182e-02f,   9.17736739e-02f,
+              1.56006515e-01f,   3.32802944e-02f,   2.66659372e-02f,  -7.10192174e-02f,  -4.87071276e-02f,   1.89220607e-01f,
+              1.28491625e-01f,  -7.99614340e-02f,   1.52605638e-01f,  -3.30739953e-02f,  -2.45541874e-02f,   7.75808021e-02f,
+              2.73698151e-01f,  -3.07626843e-01f,  -3.37633640e-01f,   1.11764058e-01f,   8.29470456e-02f,  -4.99299854e-01f,
+             -1.04800826e-02f,   6.73180297e-02f,   2.88079530e-01f,   1.98806375e-01f,  -1.12397596e-01f,  -2.64056604e-02f,
+             -3.47548127e-02f,  -1.13206329e-02f,   7.48987496e-02f,  -2.87189637e-03f,   1.57307610e-01f,   1.20061906e-02f,
+             -3.83354247e-01f,  -1.80342108e-01f,   4.24464673e-01f,   3.96143906e-02f,  -1.23540767e-01f,  -2.50905633e-01f,
+             -6.09925482e-04f,  -2.12509364e-01f,   1.55965030e-01f,   6.41598850e-02f,   5.59881590e-02f,   3.57547514e-02f,
+              5.43159954e-02f,  -4.20443527e-02f,  -1.74721852e-02f,   2.13001654e-01f,   1.29215240e-01f,  -1.53313369e-01f,
+             -2.47118697e-02f,  -4.85408604e-02f,   2.71466136e-01f,   3.09806645e-01f,  -7.11874291e-02f,   2.60101110e-01f,
+              4.42148298e-01f,   3.84285271e-01f,  -1.34488329e-01f,   8.11309740e-02f,   6.94548264e-02f,   6.11213548e-03f,
+             -1.56493500e-01f,  -1.78497106e-01f,  -5.24132326e-02f,   4.78758439e-02f,   9.83752459e-02f,   1.31108209e-01f,
+              7.36958757e-02f,  -4.39493405e-03f,   6.11449778e-02f,  -2.45817527e-02f,  -3.84088248e-01f,  -6.15266204e-01f,
+             -1.55352548e-01f,  -1.70679346e-01f,  -2.25273341e-01f,   1.34902313e-01f,   1.32472306e-01f,  -8.66613388e-02f,
+              2.24304155e-01f,   2.31787428e-01f,   1.24628074e-01f,  -1.51882200e-02f,   1.81639418e-01f,  -7.26522952e-02f,
+             -5.92325665e-02f,  -5.00501739e-03f,   1.55218825e-01f,  -1.51087239e-01f,   3.09020355e-02f,   6.75425753e-02f,
+              2.46916756e-01f,   1.60335913e-01f,  -1.36838004e-01f,   6.10133708e-02f,   1.68874130e-01f,   1.05876468e-01f,
+              1.79893687e-01f,   3.64792109e-01f,  -1.12271751e-03f,  -2.32091658e-02f,  -8.33072215e-02f,  -1.96003363e-01f,
+             -7.82657266e-02f,   1.12873890e-01f,   1.67717934e-01f,   7.49350116e-02f,  -5.75858215e-03f,   2.14079046e-03f,
+              1.68640494e-01f,   1.62874609e-01f,   1.30671531e-01f,   2.80841559e-01f,   2.94196129e-01f,   5.48405908e-02f,
+             -2.76016176e-01f,  -3.32847565e-01f,  -6.84885234e-02f,   2.14142159e-01f,  -7.27095306e-02f,  -1.69404760e-01f,
+             -2.18632147e-01f,  -1.87507406e-01f,  -3.30944031e-01f,  -5.13760269e-01f,  -1.57027006e-01f,   9.20429900e-02f,
+              1.10064708e-01f,  -4.31875512e-02f,   2.86424160e-01f,   1.29299685e-01f,   1.56646624e-01f,  -6.66137487e-02f,
+             -4.27853055e-02f,  -4.07550819e-02f,   9.53343213e-02f,   3.48129034e-01f,   1.37589172e-01f,   6.54634386e-02f,
+              5.66532509e-03f,  -6.81734681e-02f,   1.46697313e-01f,  -2.50504851e-01f,  -4.36903089e-01f,  -2.57634878e-01f,
+             -1.08678386e-01f,   2.59384885e-02f,  -2.93507497e-03f,   5.56815118e-02f,  -5.40190451e-02f,  -3.25647034e-02f,
+             -1.89699620e-01f,   5.85112050e-02f,  -3.27999219e-02f,  -3.40729356e-02f,  -1.66808531e-01f,  -2.06284583e-01f,
+             -1.08592972e-01f,   7.84189478e-02f,  -1.75312579e-01f,  -1.55332476e-01f,  -1.76390242e-02f,   5.52892052e-02f,
+             -5.10965064e-02f,   2.45613400e-02f,   7.36208335e-02f,   3.63407396e-02f,  -7.47616123e-03f,  -3.80463451e-02f,
+             -1.04390390e-01f,   7.96512291e-02f,   2.22304448e-01f,  -5.12432866e-02f,  -4.09974605e-02f,  -1.66670278e-01f,
+             -2.23530526e-03f,   4.00487572e-01f,   3.04760396e-01f,   2.16077760e-01f,   1.58696026e-02f,   1.08886482e-02f,
+              4.94007729e-02f,   5.98353520e-03f,  -1.69722587e-01f,  -5.93410656e-02f,   1.57748342e-01f,   1.61777452e-01f,
+             -1.46558091e-01f,  -2.15231687e-01f,   1.27789497e-01f,   1.42450795e-01f,   1.31482273e-01f,  -1.30485192e-01f,
+             -2.33163849e-01f,   5.97788058e-02f,   2.48167500e-01f,   7.92311355e-02f,   6.37268946e-02f,  -3.85275871e-01f,
+             -8.30428749e-02f,   3.43871601e-02f,  -1.31548971e-01f,  -7.64593482e-02f,   8.34020153e-02f,  -1.11057490e-01f,
+             -1.02263235e-01f,   4.26024050e-02f,  -2.29406819e-01f,  -1.96588099e-01f,   1.76153369e-02f,   2.10750252e-01f,
+              9.05391648e-02f,  -1.38127152e-02f,  -1.15142882e-01f,   3.41427416e-01f,   4.43334550e-01f,   2.06875414e-01f,
+              2.10396200e-01f,  -3.08738817e-02f,   1.63987819e-02f,  -2.35984415e-01f,  -5.43442406e-02f,  -2.29364410e-01f,
+             -3.86835724e-01f,   6.50165826e-02f,   5.67230508e-02f,  -6.78064302e-02f,  -1.54734939e-01f,  -1.90874949e-01f,
+             -3.99317630e-02f,  -1.56157259e-02f,   4.04273361e-01f,   5.74794710e-01f,   4.43357259e-01f,   1.27836928e-01f,
+             -3.40466589e-01f,   3.62630412e-02f,  -1.65035650e-02f,  -6.64027631e-02f,   3.75041991e-01f,   2.17640117e-01f,
+              8.78988728e-02f,  -4.53090630e-02f,   3.30603458e-02f,  -5.07134013e-02f,  -2.78586466e-02f,   1.73118576e-01f,
+              1.14478327e-01f,   1.98259920e-01f,   3.41474935e-02f,  -8.32880288e-02f,   7.48245940e-02f,   2.06371307e-01f,
+             -3.77455801e-02f,  -1.10702612e-01f,  -1.88050821e-01f,  -3.59677285e-01f,  -1.91361725e-01f,  -1.92257106e-01f,
+              1.60833478e-01f,   1.32216275e-01f,   5.53816110e-02f,  -3.07183843e-02f,  -1.17717229e-01f,  -1.47232428e-01f,
+             -4.23060097e-02f,   3.16159204e-02f,   1.30663991e-01f,  -8.00650418e-02f,  -4.66160417e-01f,  -2.43676573e-01f,
+             -7.38159195e-02f,   1.95041999e-01f,   9.73415300e-02f,  -1.55041203e-01f,  -1.84964299e-01f,  -2.89230011e-02f,
+              1.81595683e-01f,   4.64901954e-01f,   1.58828765e-01f,   1.26465604e-01f,   1.42559156e-01f,   2.31186189e-02f,
+             -1.76175863e-01f,  -3.40081871e-01f,  -8.25678259e-02f,   2.76959408e-03f,   1.90376908e-01f,   5.49133569e-02f,
+              2.44695380e-01f,   1.25306919e-01f,   2.51298025e-03f,  -8.49271789e-02f,  -1.08207930e-02f,  -6.25820681e-02f,
+              1.87651441e-01f,   4.00121838e-01f,  -1.70367118e-02f,  -3.99583489e-01f,   2.18271121e-01f,   1.22413017e-01f,
+              2.85092592e-02f,   6.85369875e-03f,   1.87831834e-01f,   6.47136793e-02f,  -1.32068902e-01f,  -2.44808301e-01f,
+             -3.12025845e-01f,  -1.38303697e-01f,  -5.04832640e-02f,   2.83964109e-02f,  -1.52286276e-01f,  -2.90612370e-01f,
+             -1.81253582e-01f,  -1.45534649e-01f,  -1.37039378e-01f,  -6.07055835e-02f,  -5.31448610e-02f,  -5.63768148e-02f,
+              2.27160063e-02f,   2.69349068e-01f,   2.61666298e-01f,  -2.14593619e-01f,  -3.11147898e-01f,  -4.38401133e-01f,
+             -3.21940541e-01f,  -5.67831993e-01f,  -3.33805561e-01f,   3.07128668e-01f,   9.82607380e-02f,  -1.31962597e-01f,
+             -9.96839032e-02f,   3.22038159e-02f,   7.06291199e-02f,   2.86569241e-02f,  -1.04938567e-01f,  -2.12687373e-01f,
+             -3.49691868e-01f,  -5.54939628e-01f,  -1.79163128e-01f,  -3.37566622e-02f,   3.99937600e-01f,   3.80367130e-01f,
+              2.64275402e-01f,   3.46463263e-01f,   4.59169149e-01f,   3.12366754e-01f,   9.04545039e-02f,   2.42843196e-01f,
+              2.51180232e-02f,   2.30025440e-01f,   3.96517783e-01f,   2.05520391e-01f,   1.35201693e-01f,   2.24470988e-01f,
+              4.55205470e-01f,   2.26034835e-01f,   1.13890722e-01f,   2.01071426e-01f,   1.56171128e-01f,  -7.02482685e-02f,
+             -9.02141407e-02f,   1.13618918e-01f,   1.35752186e-01f,   2.12601498e-01f,   3.38358134e-01f,   3.78953427e-01f,
+              3.87582779e-01f,   2.91479435e-02f,  -2.49933138e-01f,  -3.45503211e-01f,  -1.91463411e-01f,   1.77570760e-01f,
+              1.08490728e-01f,   9.19004828e-02f,  -3.35013904e-02f,  -6.61481470e-02f,  -4.49184841e-03f,  -6.35074601e-02f,
+             -1.13369962e-02f,  -1.04752950e-01f,  -1.88161898e-02f,  -9.66221243e-02f,   1.06905447e-02f,   2.57234368e-02f,
+              1.63721696e-01f,   1.75911725e-01f,   1.23361737e-01f,   1.78244844e-01f,  -5.65415472e-02f,  -2.44507402e-01f,
+             -4.01380211e-01f,  -3.81296396e-01f,  -3.39838892e-01f,  -1.84326041e-02f,   1.80402681e-01f,   2.18582511e-01f,
+              2.11746395e-01f,   8.06971639e-02f,   1.36296481e-01f,   1.42532989e-01f,   2.10532453e-02f,  -1.69066235e-01f,
+             -1.73591703e-01f,  -1.19759922e-03f,  -2.37911697e-02f,  -1.56546608e-01f,  -1.43185437e-01f,  -4.51459400e-02f,
+             -1.42213196e-01f,  -4.68631759e-02f,  -2.50259012e-01f,  -3.58800888e-01f,  -3.59643221e-01f,  -1.22521624e-01f,
+              2.41246894e-02f,   5.23096584e-02f,   1.47938102e-01f,  -8.03244188e-02f,  -2.24189892e-01f,  -1.04699135e-01f,
+             -1.81384951e-01f,   2.18364620e-03f,   2.12587237e-01f,   1.00331858e-01f,  -6.78364513e-03f,   1.08579509e-01f,
+              1.31282574e-02f,  -2.35114396e-02f,  -1.55359313e-01f,  -1.74921393e-01f,  -3.14674340e-02f,  -7.07803369e-02f,
+             -2.45124429e-01f,  -6.45848513e-02f,   2.67474353e-01f,   1.39622301e-01f,   1.45926550e-01f,   2.44853541e-01f,
+              7.10998327e-02f,  -1.42435906e-02f,   1.00161536e-02f,  -3.10739368e-01f,  -2.29243949e-01f,  -1.79663181e-01f,
+              3.05062924e-02f,   4.12060529e-01f,   3.46027374e-01f,  -1.42486066e-01f,   7.57823810e-02f,  -8.90794024e-02f,
+              9.47962627e-02f,   2.06655726e-01f,   3.09921682e-01f,   1.14152998e-01f,  -1.33357048e-01f,   1.91189095e-01f,
+              1.73598662e-01f,  -9.39268842e-02f,   1.42411422e-02f,  -7.05754012e-02f,   5.48226610e-02f,   4.82306689e-01f,
+              5.75684190e-01f,   6.17123442e-03f,  -3.79947931e-01f,  -1.37212783e-01f,  -1.10196084e-01f,   9.56304669e-02f,
+              1.44394800e-01f,   1.08130045e-01f,   1.98907685e-02f,  -2.10135758e-01f,  -7.59910941e-02f,  -7.59879267e-03f,
+             -1.07111417e-01f,  -3.74549150e-01f,  -2.86557853e-01f,   2.71471053e-01f,   1.18836425e-01f,  -1.06738925e-01f,
+             -2.12508693e-01f,  -3.29631537e-01f,  -7.66812190e-02f,  -2.17696398e-01f,  -2.99862176e-01f,   4.49481830e-02f,
+             -4.56961066e-01f,  -1.39804661e-01f,   1.02605671e-01f,   8.12973380e-02f,   1.51668545e-02f,   2.74943281e-02f,
+             -7.20418170e-02f,   1.54677197e-01f,   2.75652438e-01f,   1.49250478e-01f,  -7.42352903e-02f,  -5.64683318e-01f,
+             -1.43047154e-01f,  -4.73214574e-02f,  -1.70925818e-02f,  -7.27442130e-02f,  -3.36603373e-01f,  -8.32206830e-02f,
+              1.67646885e-01f,  -4.14615385e-02f,  -2.82572379e-04f,   5.42577021e-02f,  -1.27346098e-01f,  -9.06568244e-02f,
+             -9.36918631e-02f,  -2.86509275e-01f,  -5.44024110e-01f,  -1.61776036e-01f,   1.54477909e-01f,   2.25174516e-01f,
+              1.80508420e-01f,   5.68710268e-02f,  -1.08489860e-02f,  -1.75730765e-01f,  -1.26202598e-01f,   9.90628600e-02f,
+             -5.06086014e-02f,  -2.42520571e-01f,  -4.43483554e-02f,   1.21978208e-01f,   6.40474483e-02f,   6.20464310e-02f,
+              9.89604741e-02f,   1.18045233e-01f,   1.75951853e-01f,   2.70865023e-01f,   2.52870589e-01f,  -1.37980014e-01f,
+             -3.53774428e-01f,  -3.37768912e-01f,  -1.31184503e-01f,   2.41029039e-01f,  -5.21030352e-02f,  -9.48635563e-02f,
+             -1.77555457e-01f,   1.27486050e-01f,   2.59563029e-01f,  -1.58299524e-02f,  -1.47406369e-01f,  -1.34832412e-01f,
+             -1.28304049e-01f,  -4.14530784e-01f,  -1.16971605e-01f,  -5.51768169e-02f,   5.52767664e-02f,   1.33890465e-01f,
+             -1.43370360e-01f,  -2.50952065e-01f,  -1.69017538e-01f,  -1.82509288e-01f,   2.23874096e-02f,   7.71770626e-02f,
+             -1.63460627e-01f,  -2.45220866e-02f,   4.15732533e-01f,   5.99991620e-01f,   1.04436606e-01f,   2.45290488e-01f,
+              3.13825130e-01f,  -9.67761409e-03f,  -1.25706300e-01f,   1.62668675e-01f,   4.92609888e-02f,   9.25298315e-03f,
+              1.00102667e-02f,   1.32856146e-01f,   1.31141439e-01f,  -4.18566316e-02f,  -1.82530373e-01f,  -2.72020519e-01f,
+             -3.42096910e-02f,  -1.76273823e-01f,  -4.30344306e-02f,  -4.71176021e-02f,   2.97529131e-01f,   1.96107924e-01f,
+             -8.54825154e-02f,   2.69414246e-01f,   3.94155711e-01f,   2.50664473e-01f,  -3.29033881e-01f,  -9.61778611e-02f,
+              1.44535080e-01f,   9.61955190e-02f,  -2.05507740e-01f,  -2.08557427e-01f,  -2.58716866e-02f,   3.37628797e-02f,
+              1.89652383e-01f,   2.44448096e-01f,   1.17402665e-01f,  -4.25404534e-02f,  -1.12293273e-01f,   3.33023258e-02f,
+              4.13346857e-01f,   2.05267444e-01f,  -3.74848962e-01f,   1.42876416e-01f,   2.15376869e-01f,   3.89900237e-01f,
+              1.33286744e-01f,   2.86766708e-01f,  -7.57887140e-02f,  -2.28772871e-02f,   2.07311325e-02f,  -5.97556792e-02f,
+             -2.42667630e-01f,   2.55060911e-01f,   1.49632946e-01f,  -6.37720674e-02f,  -6.83736503e-02f,   5.03515184e-01f,
+             -3.60321440e-02f,   7.14924335e-02f,   2.13127613e-01f,   1.51251554e-01f,  -8.40457380e-02f,  -2.17373352e-02f,
+             -5.97105026e-02f,  -6.43389747e-02f,   1.94135271e-02f,  -1.02625461e-02f,   8.27304944e-02f,  -1.18999789e-02f,
+             -1.17322333e-01f,  -2.29655416e-03f,   1.05676793e-01f,   3.54831576e-01f,   2.40588188e-01f,  -1.10147595e-01f,
+              1.28931314e-01f,   2.15260193e-01f,   6.23568334e-02f,  -8.00913498e-02f,  -9.72190946e-02f,  -4.67456169e-02f,
+             -3.81719954e-02f,  -2.43580528e-02f,  -7.81060308e-02f,  -2.41291523e-01f,  -1.70732856e-01f,   4.31022495e-02f,
+             -2.33798064e-02f,  -2.30925500e-01f,  -1.67827696e-01f,   1.45172374e-02f,  -3.77226695e-02f,  -2.70385612e-02f,
+             -2.07065225e-01f,  -3.00609231e-01f,  -8.89755040e-02f,   1.92761064e-01f,   5.94604947e-02f,  -7.80280977e-02f,
+             -1.96659818e-01f,  -2.04913139e-01f,  -3.57924968e-01f,  -5.00229359e-01f,  -1.67755514e-01f,   1.17168568e-01f,
+              9.75462422e-02f,   2.08552163e-02f,  -3.24447244e-01f,  -2.88814098e-01f,  -2.44939566e-01f,   1.30709529e-01f,
+              8.56923126e-03f,   6.38010679e-03f,  -1.00928292e-01f,  -2.63376772e-01f,  -3.23313661e-02f,  -6.17989227e-02f,
+              2.29066443e-02f,  -4.60245498e-02f,   9.96654332e-02f,   3.19508277e-02f,  -1.83600895e-02f,   1.07562426e-03f,
+             -4.72097211e-02f,  -1.20059676e-01f,   1.60800785e-01f,   2.69602746e-01f,  -1.88913066e-02f,  -8.98728967e-02f,
+              2.05068216e-01f,   2.47091666e-01f,   1.34197563e-01f,   1.33312836e-01f,  -1.04814075e-01f,  -2.25087076e-01f,
+              4.17868309e-02f,   4.42096204e-01f,   2.75072724e-01f,   8.58032778e-02f,   7.21351653e-02f,   9.09085199e-02f,
+              1.75360680e-01f,   1.13784462e-01f,   6.41752928e-02f,  -1.80121306e-02f,  -1.29054740e-01f,  -1.24372102e-01f,
+              4.11417037e-02f,   2.95753274e-02f,  -7.06326589e-02f,  -6.38112947e-02f,  -3.35176252e-02f,  -4.45414446e-02f,
+             -1.60282806e-01f,  -1.70264661e-01f,  -1.03254788e-01f,  -1.51248872e-02f,  -4.56149936e-01f,  -2.88423538e-01f,
+             -2.92138234e-02f,   1.89190000e-01f,   3.61000821e-02f,  -1.44411594e-01f,  -5.97358383e-02f,  -4.67470987e-03f,
+              2.73677528e-01f,   4.98365819e-01f,  -2.30774850e-01f,  -1.29079685e-01f,  -9.27397162e-02f,  -5.36047341e-03f,
+              1.66633010e-01f,   4.07211185e-01f,   1.67487696e-01f,   3.29046734e-02f,  -1.89512625e-01f,  -5.89485802e-02f,
+             -4.79282662e-02f,  -6.54417649e-02f,   1.79240495e-01f,   4.19968694e-01f,   1.42083257e-01f,  -2.56652391e-04f,
+             -1.23528868e-01f,  -3.41207951e-01f,  -2.31231958e-01f,  -1.39505029e-01f,   2.78791666e-01f,   1.29265919e-01f,
+              1.09237626e-01f,   3.32066268e-02f,  -9.43370536e-02f,  -6.34382889e-02f,   3.94284911e-02f,  -1.80434827e-02f,
+              5.36075188e-03f,  -1.17331371e-02f,   2.25118585e-02f,   7.52111897e-02f,   6.06943332e-02f,   7.88893402e-02f,
+              1.67266786e-01f,   1.67184293e-01f,   1.10279381e-01f,   1.11395605e-01f,  -1.41676106e-02f,   9.58831385e-02f,
+             -1.69648185e-01f,   1.59104869e-01f,   3.62676352e-01f,   2.93902099e-01f,   3.55408669e-01f,   1.51184678e-01f,
+             -1.22120000e-01f,   9.84393805e-02f,   1.24761321e-01f,   1.70464814e-01f,   7.24089593e-02f,   2.18750060e-01f,
+             -4.70452569e-02f,  -1.34100959e-01f,  -2.93258745e-02f,   2.54009049e-02f,   3.53401601e-01f,   2.45399863e-01f,
+              2.10532978e-01f,   1.95178509e-01f,  -2.35447690e-01f,  -1.92647606e-01f,  -5.04190475e-02f,   1.29663467e-01f,
+             -4.60897423e-02f,   1.28850996e-01f,   2.20321909e-01f,  -4.32461314e-02f,   5.22430874e-02f,  -4.44042161e-02f,
+              6.02987222e-02f,   1.31523916e-02f,   8.35842863e-02f,  -1.76538050e-01f,  -3.52124304e-01f,   1.58580288e-01f,
+              2.01484621e-01f,   2.04217762e-01f,   2.91724622e-01f,   9.56813060e-03f,  -1.88661009e-01f,  -2.33114198e-01f,
+             -1.59087226e-01f,   9.41797048e-02f,   1.36712179e-01f,  -7.02052936e-02f,  -2.10600063e-01f,  -1.03393584e-01f,
+              4.38569002e-02f,   4.52169210e-01f,   1.17587941e-02f,   8.06583837e-02f,   2.31851563e-01f,  -3.88177000e-02f,
+             -2.04203740e-01f,  -1.54752314e-01f,   1.14840686e-01f,   5.13806462e-01f,   1.69422716e-01f,   1.53667375e-01f,
+              5.51026352e-02f,   1.17572723e-02f,   8.88612121e-02f,   6.64811581e-02f,  -2.01037765e-01f,  -2.88542192e-02f,
+              1.88015372e-01f,  -3.86676304e-02f,  -1.61299288e-01f,  -2.57260352e-01f,  -1.93871006e-01f,  -1.50972113e-01f,
+             -2.03799367e-01f,   8.41862783e-02f,   2.59136200e-01f,   1.97379962e-01f,   2.70253420e-01f,   7.14298636e-02f,
+              2.03561652e-02f,  -1.07185580e-01f,   1.55508891e-01f,   1.47177771e-01f,   3.07834931e-02f,   3.06933727e-02f,
+              2.80939311e-01f,   1.06813088e-01f,  -6.56936988e-02f,  -1.07688949e-01f,  -8.04277062e-02f,   1.00226678e-01f,
+             -7.71520138e-02f,  -1.35369137e-01f,  -2.51889169e-01f,  -1.94813430e-01f,  -1.85167149e-01f,  -2.91619420e-01f,
+             -3.92880291e-01f,  -1.66845620e-01f,  -8.25642049e-02f,  -9.98786613e-02f,  -1.56120017e-01f,   1.60347715e-01f,
+              1.92058504e-01f,  -1.67896628e-01f,  -3.16333592e-01f,  -3.66711855e-01f,  -4.21159148e-01f,  -3.69569302e-01f,
+             -3.96343440e-01f,  -3.60563165e-03f,  -7.20513165e-02f,  -2.85198748e-01f,  -3.13358873e-01f,   1.87986001e-01f,
+              3.25285375e-01f,   4.40415621e-01f,   2.46523112e-01f,   5.34290016e-01f,   3.36035460e-01f,  -2.97886848e-01f,
+             -3.80013995e-02f,   1.08705692e-01f,   5.19572832e-02f,  -1.35729946e-02f,  -7.16513097e-02f,   2.16992432e-03f,
+              6.97759986e-02f,   1.27902418e-01f,   3.41199577e-01f,   4.38906908e-01f,  -9.91645977e-02f,   4.50577773e-03f,
+              3.06073934e-01f,   2.75775701e-01f,   1.86887771e-01f,   3.35124701e-01f,   4.93950963e-01f,   3.69379908e-01f,
+              1.54260248e-01f,   2.67835557e-01f,  -8.13248381e-02f,  -2.07545385e-02f,   1.37138128e-01f,   3.98949414e-01f,
+              2.30616048e-01f,  -9.29934978e-02f,  -5.29113039e-02f,  -1.27219543e-01f,  -1.91865996e-01f,  -1.23052739e-01f,
+             -2.24892527e-01f,  -1.75671220e-01f,  -1.32958919e-01f,  -3.60612832e-02f,  -1.94421895e-02f,  -8.47133324e-02f,
+             -2.28268676e-03f,   1.66450404e-02f,  -3.13547850e-02f,  -2.65886914e-02f,   4.63663228e-02f,  -1.00246832e-01f,
+             -1.26475424e-01f,   9.26802531e-02f,   2.95298249e-01f,   1.77928403e-01f,   2.23727912e-01f,   1.23460874e-01f,
+              5.25502749e-02f,  -2.73102056e-02f,  -1.14696741e-01f,   1.79933980e-01f,   4.23129857e-01f,   1.53178602e-01f,
+             -1.22971468e-01f,   9.86644551e-02f,   2.71530032e-01f,   1.15248434e-01f,   4.14875597e-02f,  -2.88010691e-03f,
+             -1.63678855e-01f,  -6.97913244e-02f,  -3.97203863e-02f,   4.42498326e-02f,   1.80439293e-01f,   1.16577610e-01f,
+              5.19913808e-02f,   1.76907312e-02f,  -4.87688556e-02f,  -1.27502948e-01f,   1.14405803e-01f,  -6.16525635e-02f,
+             -3.15565497e-01f,  -4.27993834e-01f,  -6.08497001e-02f,   1.06508005e-02f,  -3.76421601e-01f,  -5.21745265e-01f,
+             -2.58287102e-01f,   3.69632207e-02f,  -9.77264196e-02f,   1.85283888e-02f,  -1.11673169e-01f,  -3.20650667e-01f,
+             -5.57743490e-01f,  -1.10711254e-01f,   2.05974117e-01f,   1.82315961e-01f,   5.85649423e-02f,  -1.38816357e-01f,
+              7.00580403e-02f,  -9.91245210e-02f,   9.48583335e-02f,   9.88386571e-02f,  -1.09946147e-01f,  -1.91012442e-01f,
+             -3.73680815e-02f,  -5.42624481e-02f,  -3.03799585e-02f,   8.73892382e-02f,  -1.32232487e-01f,  -3.93855609e-02f,
+              6.42992780e-02f,   1.79017186e-01f,   5.61720133e-01f,   1.26057550e-01f,  -2.20121548e-01f,  -1.00141369e-01f,
+              2.33051069e-02f,  -6.46507666e-02f,  -5.99408150e-02f,   1.19842764e-03f,   1.01697259e-01f,   3.56328338e-01f,
+              5.73222786e-02f,  -7.89653733e-02f,   3.56564015e-01f,   2.56010562e-01f,   1.07142553e-01f,  -1.81889217e-02f,
+             -4.15971428e-02f,  -3.52897421e-02f,  -4.62111756e-02f,   1.46337569e-01f,   2.68111497e-01f,   1.19212113e-01f,
+             -1.05551258e-01f,  -7.59463981e-02f,  -1.04145601e-01f,  -2.13951468e-01f,   2.82386571e-01f,   6.81927055e-02f,
+             -1.69709250e-02f,   4.48990278e-02f,  -2.83956397e-02f,  -2.19918992e-02f,  -1.10201672e-01f,  -1.19962662e-01f,
+             -6.34351298e-02f,   8.34710523e-02f,   2.85102590e-03f,   9.21102613e-02f,   1.57546848e-01f,   1.78180799e-01f,
+             -8.62000789e-03f,  -5.52371964e-02f,   6.90410733e-02f,  -1.42348437e-02f,   1.76546851e-03f,  -9.41586941e-02f,
+              4.78318632e-01f,   1.62848040e-01f,   2.13270590e-01f,   2.64351308e-01f,  -7.37894475e-02f,  -1.08517542e-01f,
+             -1.33049905e-01f,  -7.96437263e-02f,   4.45300080e-02f,  -3.78187485e-02f,  -8.61761868e-02f,   1.55534387e-01f,
+              8.35548416e-02f,  -2.53184944e-01f,  -3.17284197e-01f,  -2.28781104e-01f,  -8.41471404e-02f,  -1.30277485e-01f,
+             -1.82784081e-01f,  -8.80520120e-02f,   1.18298508e-01f,   1.15160815e-01f,  -6.67236149e-02f,  -1.04164079e-01f,
+              7.74086043e-02f,   1.54025614e-01f,   1.56515211e-01f,  -9.10973623e-02f,  -9.40581188e-02f,  -1.74829349e-01f,
+              3.05302385e-02f,   1.41186357e-01f,   2.69970715e-01f,   1.98444813e-01f,   6.03702180e-02f,   6.67052194e-02f,
+              3.99536714e-02f,  -2.09876686e-01f,  -1.40077248e-01f,   5.73830865e-03f,  -1.76914632e-01f,  -3.64708044e-02f,
+              1.16404146e-01f,   1.00673571e-01f,   1.27392814e-01f,   2.70976901e-01f,   2.38346711e-01f,   1.43276751e-01f,
+             -4.77203280e-02f,  -2.16067061e-01f,   2.45089009e-02f,   8.33732858e-02f,   1.87855631e-01f,   9.26124752e-02f,
+              3.87246981e-02f,   1.23631256e-02f,   4.47653309e-02f,  -4.18090709e-02f,   3.60451117e-02f,   1.62249699e-01f,
+              1.60484556e-02f,   6.56190366e-02f,   3.32612544e-02f,   4.43487689e-02f,   1.11179613e-03f,  -4.70906943e-02f,
+             -2.02807654e-02f,  -6.03769645e-02f,  -1.25357613e-01f,  -7.87584484e-02f,  -1.28568426e-01f,   8.23142305e-02f,
+              1.38029873e-01f,  -1.49462238e-01f,   3.09042037e-02f,   3.06939065e-01f,   2.92607158e-01f,   1.43083900e-01f,
+              2.06781104e-02f,  -7.01498240e-02f,   6.10128604e-02f,   6.73558712e-02f,   1.90430492e-01f,   1.75949574e-01f,
+             -1.64663345e-02f,  -1.00984111e-01f,   8.04050490e-02f,   7.00961128e-02f,   1.03304550e-01f,   2.67329644e-02f,
+             -3.24290432e-02f,  -1.32603064e-01f,   4.34148088e-02f,   3.89140993e-01f,   2.93240815e-01f,  -7.08790030e-03f,
+             -1.46849871e-01f,  -1.64309710e-01f,  -9.84255522e-02f,  -5.13706096e-02f,  -9.83163565e-02f,  -9.09483060e-02f,
+              1.13432426e-02f,  -1.63782854e-02f,   1.68525666e-01f,   2.32277006e-01f,   1.20457307e-01f,   1.48057625e-01f,
+              1.38990849e-01f,   2.80876830e-02f,   7.73838833e-02f,   1.39482632e-01f,   2.08549440e-01f,  -2.18024012e-02f,
+              7.96939954e-02f,   3.35869147e-03f,   5.11648878e-03f,   3.78835276e-02f,  -7.53553398e-03f,  -6.47054240e-02f,
+              1.11307949e-02f,  -2.57497847e-01f,  -2.06758201e-01f,   2.20658675e-01f,   2.34520361e-02f,  -2.92067856e-01f,
+             -5.11072040e-01f,  -3.86705279e-01f,  -5.97754717e-02f,  -6.51767924e-02f,   1.80293187e-01f,   1.60785526e-01f,
+             -1.64108023e-01f,  -4.41977859e-01f,  -9.30595472e-02f,  -4.38706167e-02f,  -1.26553982e-01f,   2.57552485e-03f,
+             -8.39836746e-02f,  -3.62974733e-01f,  -5.22076264e-02f,  -1.96949586e-01f,  -1.45878449e-01f,  -1.58003315e-01f,
+             -1.36541158e-01f,  -1.48268174e-02f,   5.31106293e-02f,   2.13653184e-02f,   1.09457504e-02f,   1.61073998e-01f,
+             -1.46650597e-01f,   3.99071388e-02f,   4.05742079e-01f,   4.17908996e-01f,  -8.79466459e-02f,  -1.66323513e-01f,
+              2.39401255e-02f,  -1.44015685e-01f,   1.33679826e-02f,  -2.91770101e-02f,  -6.65713847e-02f,   2.12428227e-01f,
+              1.32373735e-01f,  -5.70253804e-02f,   7.84786195e-02f,   1.53622434e-01f,   2.26840153e-01f,   1.10532142e-01f,
+              1.88192017e-02f,   1.86076388e-01f,  -7.03552961e-02f,   2.27466017e-01f,   2.76854694e-01f,   3.60068411e-01f,
+              2.62011349e-01f,   8.90845880e-02f,   2.90645723e-04f,   8.94731805e-02f,   1.16020061e-01f,   8.96993130e-02f,
+              9.83617231e-02f,  -1.78121310e-02f,   1.61369041e-01f,   8.76815394e-02f,  -9.86533612e-02f,  -1.23614281e-01f,
+              7.30969980e-02f,   1.20965019e-01f,  -1.75094366e-01f,  -2.11202160e-01f,  -6.73722103e-02f,  -1.99089050e-01f,
+             -5.71770445e-02f,  -3.06199014e-01f,  -3.55152637e-01f,  -2.32051402e-01f,   2.26263180e-01f,   1.10245839e-01f,
+              1.37525156e-01f,   1.46064684e-01f,  -1.71285361e-01f,  -1.50925472e-01f,  -1.24337010e-01f,   3.32202464e-02f,
+              8.96651670e-02f,  -3.73787023e-02f,  -2.14372829e-01f,  -1.23381898e-01f,   2.45567247e-01f,   8.88762698e-02f,
+             -7.50290006e-02f,  -8.42086375e-02f,  -1.17898740e-01f,  -6.85868859e-02f,  -3.19034420e-02f,   9.54029635e-02f,
+              2.70377398e-02f,  -9.94899720e-02f,  -1.07261702e-01f,  -1.31123617e-01f,   3.76719013e-02f,  -2.82778740e-02f,
+             -1.42657712e-01f,  -2.97683794e-02f,   2.04702675e-01f,   8.29529539e-02f,  -2.82659531e-01f,  -1.06753461e-01f,
+             -8.71631727e-02f,  -3.46076451e-02f,  -2.19736010e-01f,  -1.48113072e-01f,  -8.74108374e-02f,  -3.91909406e-02f,
+              2.11505461e-02f,  -2.90890336e-02f,   4.29587392e-03f,   7.33370930e-02f,   6.82711974e-02f,  -1.02015316e-01f,
+              8.07460397e-02f,  -8.64282250e-02f,  -2.17168316e-01f,  -2.50492305e-01f,  -3.18850487e-01f,  -1.56123728e-01f,
+             -5.20416163e-02f,   8.51988122e-02f,   1.11954339e-01f,   1.54387340e-01f,   2.47356996e-01f,   2.34535590e-01f,
+              1.23008862e-01f,   4.16306928e-02f,  -8.97336975e-02f,   4.53793891e-02f,   1.50342211e-01f,   1.26647398e-01f,
+              8.01712200e-02f,   2.57189889e-02f,  -1.58324778e-01f,  -1.83145896e-01f,  -1.10664137e-01f,  -1.00631326e-01f,
+             -1.96114242e-01f,  -1.75392270e-01f,  -3.35380554e-01f,  -2.08034664e-01f,  -1.19551182e-01f,  -9.20142457e-02f,
+             -1.17586918e-01f,  -1.04126997e-01f,  -8.68715812e-03f,   2.07586829e-02f,   2.28661075e-02f,   7.58984089e-02f,
+              7.95010999e-02f,   2.94655971e-02f,  -5.68823069e-02f,  -7.85668120e-02f,  -8.77638981e-02f,   2.34498437e-02f,
+              5.45794331e-02f,   1.16522433e-02f,   6.32431731e-02f,   2.35238656e-01f,   8.02401677e-02f,  -2.00778246e-01f,
+             -2.13351339e-01f,  -6.72696754e-02f,   2.54831553e-01f,   6.15069196e-02f,  -1.25959590e-01f,   4.07375541e-04f,
+              5.08028977e-02f,   3.82758714e-02f,   4.59880270e-02f,   3.24265822e-03f,  -5.04315943e-02f,  -2.64184047e-02f,
+             -1.02240957e-01f,   1.46771312e-01f,   2.39819825e-01f,  -2.93507404e-03f,   2.27697372e-01f,   3.47129703e-01f,
+              4.86480221e-02f,  -1.67664781e-01f,  -2.00486705e-01f,  -1.58832297e-01f,   5.03147719e-03f,  -5.39425127e-02f,
+             -2.43391231e-01f,   1.33987412e-01f,   1.02156937e-01f,   3.88616323e-02f,  -4.84264158e-02f,  -9.00355279e-02f,
+             -9.78860334e-02f,   1.20928641e-02f,  -1.44258901e-01f,   2.36107469e-01f,   3.23451400e-01f,   2.18504921e-01f,
+              2.29622081e-01f,   6.86907768e-02f,  -1.08782068e-01f,  -2.75808841e-01f,  -2.10831523e-01f,  -1.67351320e-01f,
+             -9.22626182e-02f,  -8.33496749e-02f,   9.86583531e-02f,  -2.13025108e-01f,  -8.84344354e-02f,  -1.29311442e-01f,
+             -1.26594141e-01f,  -1.12483107e-01f,  -4.74185385e-02f,   2.74733379e-02f,   1.40827850e-01f,   1.11101858e-01f,
+              6.99800327e-02f,  -1.50519118e-01f,  -5.42576872e-02f,   6.26273602e-02f,   2.82136071e-02f,   7.17217848e-02f,
+             -4.90895249e-02f,  -1.49359912e-01f,   2.41120219e-01f,   3.39066923e-01f,   2.43107140e-01f,   2.20786989e-01f,
+              3.25048089e-01f,   1.58516422e-01f,   1.90025702e-01f,   1.75160035e-01f,   1.52650878e-01f,  -2.48684343e-02f,
+             -2.21329957e-01f,  -1.79603770e-01f,  -7.49768242e-02f,   9.19620618e-02f,   7.53232613e-02f,   8.98502171e-02f,
+              9.24301520e-02f,   1.98576897e-01f,   1.64999276e-01f,   1.63755432e-01f,   8.16254120e-04f,   2.35988330e-02f,
+             -1.17603324e-01f,  -3.02729905e-01f,  -1.53813496e-01f,  -1.52501225e-01f,  -1.16584659e-01f,   8.85096714e-02f,
+              1.71948895e-02f,  -3.20610464e-01f,  -1.36728538e-03f,  -5.03605232e-02f,   1.83418036e-01f,   2.37336516e-01f,
+             -4.37522084e-02f,  -2.55285233e-01f,  -1.04673848e-01f,  -2.65069250e-02f,   1.95268601e-01f,   2.02403218e-01f,
+             -7.01601580e-02f,  -8.43597874e-02f,  -7.49184713e-02f,   2.76421737e-02f,   8.43777582e-02f,   9.69471186e-02f,
+              8.02640337e-03f,  -7.91929960e-02f,   9.26669240e-02f,   5.89096546e-02f,   2.49945641e-01f,   1.79876029e-01f,
+             -2.25146309e-01f,  -8.81150141e-02f,   1.43948346e-01f,   9.64265317e-02f,  -1.28970876e-01f,  -2.25107595e-01f,
+             -2.03965932e-01f,   6.10449463e-02f,   6.57641217e-02f,   8.56640637e-02f,  -5.38111851e-03f,  -3.31227005e-01f,
+             -3.36631417e-01f,  -1.44919649e-01f,   1.00873411e-01f,   4.67546172e-02f,  -1.18925318e-01f,  -8.75591859e-03f,
+              6.32835105e-02f,   4.11317199e-02f,   1.15385450e-01f,   6.17083460e-02f,  -3.40537690e-02f,  -8.04107040e-02f,
+             -7.44858682e-02f,  -3.77726182e-02f,   4.58774506e-04f,   4.65208441e-02f,   1.11582270e-02f,  -1.57721937e-01f,
+             -4.13670298e-03f,   3.19508970e-01f,   4.13166255e-01f,   2.98283786e-01f,   7.50522465e-02f,  -4.05520909e-02f,
+             -3.68740074e-02f,   2.94316970e-02f,  -1.08363770e-01f,   9.98544134e-03f,   2.60233700e-01f,   1.35727182e-01f,
+             -3.48711312e-02f,  -9.19866562e-02f,   8.30591694e-02f,   6.94347173e-02f,   7.28686675e-02f,   5.46736978e-02f,
+             -2.80846745e-01f,  -3.56469631e-01f,  -2.05700934e-01f,  -1.29991591e-01f,   5.67966662e-02f,  -4.76602912e-02f,
+             -1.55404195e-01f,  -2.51144320e-01f,  -3.60301137e-02f,   1.04400150e-01f,  -2.38128975e-01f,  -1.09461747e-01f,
+              5.69401197e-02f,   1.68691888e-01f,   1.84943274e-01f,   1.19128220e-01f,   2.10900940e-02f,   1.89339533e-01f,
+              1.11571159e-02f,  -2.47622430e-01f,  -1.74490184e-01f,  -1.20234400e-01f,   1.20710067e-01f,   2.27583215e-01f,
+             -7.73603618e-02f,  -5.41330159e-01f,  -5.59706032e-01f,  -2.44809732e-01f,  -8.97200108e-02f,   5.58067374e-02f,
+             -7.09513649e-02f,   1.24257698e-04f,  -8.05784836e-02f,  -1.89028475e-02f,   2.18830347e-01f,   1.94942355e-01f,
+             -5.07199429e-02f,  -2.95570582e-01f,  -2.43714735e-01f,   2.70092040e-02f,   9.93093625e-02f,  -2.69239843e-02f,
+             -1.00577287e-01f,  -6.66037127e-02f,  -3.02411258e-01f,  -4.85427678e-01f,  -4.49230075e-01f,  -2.20633507e-01f,
+             -1.55036911e-01f,   6.23721965e-02f,   7.16254711e-02f,   3.31317335e-01f,   3.32457930e-01f,   5.51364012e-02f,
+             -1.13901019e-01f,  -7.23267123e-02f,   4.47714366e-02f,   3.06882281e-02f,   6.71506971e-02f,   1.06735624e-01f,
+              1.95785210e-01f,   2.80400276e-01f,   2.73575783e-01f,   2.91188031e-01f,   2.57702321e-01f,   1.86300427e-01f,
+              2.91258514e-01f,   1.74021512e-01f,   1.22710884e-01f,  -8.36370587e-02f,   1.40777141e-01f,   6.01023715e-03f,
+             -1.42562270e-01f,  -1.08019598e-01f,  -2.61516552e-02f,   6.62248433e-02f,   1.07477456e-01f,   1.34229017e-02f,
+              1.27998162e-02f,  -4.77777189e-03f,  -6.51976392e-02f,   1.05898462e-01f,   1.38817549e-01f,   2.47998163e-01f,
+              9.86082554e-02f,   1.77557796e-01f,   3.14566493e-01f,   6.07221425e-02f,  -3.78178917e-02f,  -1.22591555e-01f,
+             -4.66403775e-02f,   3.99757102e-02f,   1.32908791e-01f,   6.66246787e-02f,  -8.86386856e-02f,   1.54036563e-03f,
+              8.69855564e-03f,  -3.41393985e-02f,   1.71620756e-01f,   2.28017300e-01f,   3.77002619e-02f,   7.96376541e-02f,
+              5.86736165e-02f,   4.00793888e-02f,  -1.28278472e-02f,  -4.89726923e-02f,  -3.16352434e-02f,  -1.14979997e-01f,
+             -1.11918643e-01f,   1.14116520e-02f,   9.93268341e-02f,  -4.33048643e-02f,  -2.69979686e-01f,  -1.65709972e-01f,
+              1.07835559e-02f,  -7.13416189e-02f,  -6.49414733e-02f,   1.95297629e-01f,   1.51156232e-01f,  -2.23032702e-02f,
+             -2.39488542e-01f,  -4.31801714e-02f,   5.17516397e-02f,  -3.62811647e-02f,  -1.15738444e-01f,  -4.63959724e-02f,
+              1.85720846e-02f,   1.00817457e-01f,   6.91649690e-02f,   5.03267273e-02f,   5.42309582e-01f,   2.21222326e-01f,
+              2.29176298e-01f,   1.71946153e-01f,  -1.11425318e-01f,  -4.94471975e-02f,  -3.65024991e-02f,  -6.10888638e-02f,
+             -1.68350153e-02f,  -1.21001661e-01f,   6.27424344e-02f,  -7.99688548e-02f,  -1.83787122e-02f,   2.77163863e-01f,
+              2.69629747e-01f,   2.61511087e-01f,   5.63556403e-02f,   5.66904061e-02f,   1.22318938e-01f,   7.62480274e-02f,
+             -3.06978319e-02f,  -1.29387118e-02f,   5.66434525e-02f,  -5.19926101e-02f,  -1.03595585e-03f,   1.71627954e-01f,
+              1.50450230e-01f,  -9.35537070e-02f,  -1.48185268e-01f,  -1.74557611e-01f,  -2.91254461e-01f,  -6.92249611e-02f,
+             -2.27054842e-02f,  -9.80222225e-02f,  -7.00597093e-02f,   1.51592046e-02f,   5.28009012e-02f,   1.26133353e-01f,
+              6.77647516e-02f,  -1.05317578e-01f,  -2.52992697e-02f,  -6.31816015e-02f,  -5.75804152e-02f,  -5.86588867e-02f,
+              8.84175003e-02f,   8.04185122e-02f,  -2.13455427e-02f,  -2.50266157e-02f,  -2.21578423e-02f,   7.63294697e-02f,
+             -6.48296699e-02f,  -3.50910127e-02f,  -6.10603504e-02f,  -5.19183930e-03f,   3.10638696e-01f,   1.72178615e-02f,
+             -1.82692155e-01f,  -1.04442842e-01f,  -5.61591461e-02f,  -1.67618617e-01f,  -5.36070801e-02f,   1.59895197e-01f,
+              1.62666336e-01f,   1.53051555e-01f,   7.56837577e-02f,   1.28330126e-01f,   1.19682156e-01f,  -3.88804339e-02f,
+              8.68553296e-02f,  -5.86133674e-02f,  -1.74590223e-03f,   1.13787554e-01f,   9.89687294e-02f,   3.28882694e-01f,
+              1.31698132e-01f,   1.49259135e-01f,   3.37495506e-01f,   2.94649512e-01f,   8.91043097e-02f,  -4.08870205e-02f,
+             -3.64526883e-02f,   9.70496144e-03f,  -1.09629445e-01f,  -9.30036530e-02f,  -4.14104193e-01f,  -2.25470856e-01f,
+              2.16662660e-01f,   1.75970912e-01f,   4.99523096e-02f,   2.35728119e-02f,  -2.25149989e-01f,   8.70409012e-02f,
+              3.78556490e-01f,   3.19080293e-01f,  -2.24895328e-02f,   1.21380769e-01f,   4.47172254e-01f,   4.88713264e-01f,
+              1.30691424e-01f,  -6.20180033e-02f,   1.64756831e-02f,   2.94180103e-02f,   1.98371723e-01f,   2.83542246e-01f,
+              5.45009792e-01f,   2.69200027e-01f,  -1.60715163e-01f,  -2.16849059e-01f,   1.70935709e-02f,   1.48779631e-01f,
+             -6.73156828e-02f,   2.59748638e-01f,   3.89369667e-01f,   1.80600420e-01f,   2.40331870e-02f,   1.56115398e-01f,
+              2.71708906e-01f,   1.85210019e-01f,   1.07166134e-01f,  -1.42894303e-02f,   2.83402264e-01f,   5.68212457e-02f,
+              1.09343141e-01f,  -3.02165337e-02f,  -3.58859211e-01f,  -1.86407983e-01f,  -2.27292115e-03f,   1.11034624e-02f,
+              5.75789027e-02f,   1.87784329e-01f,  -7.14695901e-02f,   9.34415758e-02f,   1.58297807e-01f,  -1.15031183e-01f,
+             -2.88760096e-01f,  -9.65447426e-02f,  -2.06695691e-01f,  -1.27825707e-01f,   4.04128106e-03f,   6.81194514e-02f,
+             -1.10884778e-01f,  -2.22677942e-02f,   1.65969208e-02f,   6.71011629e-03f,   4.46427194e-03f,  -1.51190991e-02f,
+              8.29405710e-03f,  -7.27950335e-02f,  -2.14828983e-01f,  -2.14221448e-01f,  -1.09453693e-01f,  -7.44240060e-02f,
+              7.99884126e-02f,   3.81405979e-01f,   2.11215094e-01f,  -9.94296819e-02f,  -3.96416821e-02f,  -1.30113259e-01f,
+             -2.45307267e-01f,  -7.82489404e-02f,   1.69648930e-01f,   2.40387574e-01f,   1.73698843e-01f,   1.92588177e-02f,
+              3.21828462e-02f,  -2.88095716e-02f,  -4.23696190e-02f,   3.09951790e-02f,  -2.99565513e-02f,  -7.19087292e-03f,
+             -9.57104862e-02f,   6.48700669e-02f,   2.36608967e-01f,   3.06810796e-01f,   2.74715602e-01f,   2.04166353e-01f,
+              5.23255393e-02f,  -6.91579878e-02f,  -1.47752985e-01f,  -8.06756765e-02f,  -1.85702860e-01f,  -2.12677583e-01f,
+             -1.03152424e-01f,  -1.33668045e-02f,   3.99531983e-02f,  -3.64164263e-02f,  -2.21735790e-01f,  -2.19759747e-01f,
+             -8.92384499e-02f,  -5.21702021e-02f,  -3.99262123e-02f,   4.28638086e-02f,   1.37675375e-01f,   4.53157164e-02f,
+             -1.60907373e-01f,  -7.06285909e-02f,   2.15690643e-01f,   1.00675963e-01f,   1.43480793e-01f,   8.14576969e-02f,
+              1.83052227e-01f,   1.32920682e-01f,   8.02320018e-02f,   6.42126799e-02f,   5.21430224e-02f,   2.74202973e-02f,
+             -6.70077559e-03f,  -5.14307246e-02f,  -5.58258668e-02f,   1.54868200e-01f,   7.55732879e-04f,  -1.27547681e-01f,
+              2.20785402e-02f,  -2.66053200e-01f,  -2.45844379e-01f,  -2.43032411e-01f,   1.95198879e-01f,   1.53972447e-01f,
+              1.05406374e-01f,   2.29345903e-01f,  -1.50419369e-01f,  -1.33148015e-01f,  -3.27416062e-02f,  -2.05228627e-02f,
+              2.24798601e-02f,   1.29471764e-01f,  -2.08161518e-01f,  -7.91121051e-02f,   3.48917425e-01f,   1.37006640e-01f,
+              4.76146974e-02f,   1.88679472e-01f,   2.23893777e-01f,   3.72941524e-01f,   1.90961510e-01f,  -3.98110747e-02f,
+             -1.42575493e-02f,   1.22212477e-01f,   1.33655861e-01f,  -7.65712187e-03f,   1.93826392e-01f,  -2.39625294e-02f,
+              1.44660026e-01f,   2.10071281e-02f,  -2.77761459e-01f,  -1.72036633e-01f,   1.61095381e-01f,   1.79128185e-01f,
+             -1.44379959e-01f,  -1.25959113e-01f,   6.94552958e-02f,  -2.25482732e-01f,  -3.62122625e-01f,  -1.69906184e-01f,
+              4.04929556e-03f,  -1.10669091e-01f,  -3.39218467e-01f,  -1.69918209e-01f,   2.61679903e-04f,  -2.54185021e-01f,
+              4.77879904e-02f,  -3.70786525e-02f,  -1.38393804e-01f,  -2.27599710e-01f,   5.13460003e-02f,   2.68420041e-01f,
+              9.57251787e-02f,   1.05129607e-01f,   5.65933548e-02f,   8.12305436e-02f,  -6.22503972e-03f,  -2.51391828e-01f,
+             -4.88823280e-02f,   4.00051594e-01f,   7.25890249e-02f,  -2.51082182e-01f,  -5.05571246e-01f,  -3.72787744e-01f,
+             -7.69636631e-02f,   5.44653684e-02f,  -1.71095073e-01f,   4.18359600e-02f,   4.87669669e-02f,   3.13449919e-01f,
+              2.13201731e-01f,   2.60265116e-02f,   2.08439335e-01f,   9.44860280e-02f,   1.16213724e-01f,   4.96589571e-01f,
+              3.50264683e-02f,  -1.34909943e-01f,  -1.25805289e-01f,  -2.79928952e-01f,  -2.05418080e-01f,  -3.17731202e-02f,
+             -1.13332599e-01f,  -2.03323737e-02f,   5.65536693e-02f,   3.40542823e-01f,   6.51999414e-02f,   3.33135098e-01f,
+              3.15356851e-01f,  -8.28100443e-02f,   4.42541912e-02f,   1.73748791e-01f,   6.61663488e-02f,   9.58530679e-02f,
+             -3.52900214e-02f,  -2.16470599e-01f,  -1.47198588e-01f,  -9.57381502e-02f,   5.24976887e-02f,   1.47575095e-01f,
+              2.86642909e-01f,   2.54384696e-01f,   5.66190146e-02f,  -5.39339297e-02f,  -6.80770166e-03f,   8.56684372e-02f,
+              2.78897304e-02f,   5.26204705e-02f,   3.39541696e-02f,   2.27203250e-01f,  -5.14347441e-02f,  -2.47625448e-02f,
+             -1.65193409e-01f,  -1.93058044e-01f,  -1.74177840e-01f,  -8.60452801e-02f,   1.43890634e-01f,  -1.00789212e-01f,
+             -1.63015038e-01f,  -1.15563415e-01f,   1.02943301e-01f,  -2.58349925e-01f,  -3.90631497e-01f,  -9.21905860e-02f,
+              8.39413330e-02f,   1.09397583e-01f,  -1.11127004e-01f,  -1.66618675e-01f,  -1.60011947e-01f,  -2.45753646e-01f,
+              6.17778078e-02f,   1.14579514e-01f,   8.59894045e-03f,   6.79919720e-02f,  -7.71109462e-02f,  -1.45759016e-01f,
+             -8.11426267e-02f,  -1.69394333e-02f,  -5.20113558e-02f,  -2.98351347e-01f,  -9.40945297e-02f,  -1.81078687e-01f,
+             -3.71041685e-01f,  -1.03952028e-01f,  -1.33683681e-01f,  -9.23158079e-02f,   1.79642752e-01f,   2.63599336e-01f,
+              2.36909091e-02f,  -5.18281898e-03f,   9.92550552e-02f,  -1.23806544e-01f,  -8.88131931e-02f,   5.07430807e-02f,
+              1.08079664e-01f,   8.21271092e-02f,   2.95035709e-02f,  -7.96718970e-02f,   2.86591388e-02f,   3.07929814e-01f,
+              2.72199273e-01f,   2.97428310e-01f,   5.69425859e-02f,  -2.17022952e-02f,  -9.73275155e-02f,   2.46622674e-02f,
+              8.34436193e-02f,   3.95011045e-02f,   9.00112540e-02f,   3.07868104e-02f,  -5.66790849e-02f,   2.81022843e-02f,
+              1.88433900e-01f,   1.78624332e-01f,   1.27318114e-01f,   5.00039794e-02f,  -9.98861268e-02f,  -1.03160888e-01f,
+              1.43086463e-01f,   3.26086849e-01f,   2.83136308e-01f,   2.16354758e-01f,  -6.19558543e-02f,   9.05286223e-02f,
+              1.73911661e-01f,  -4.76573333e-02f,  -2.12075606e-01f,  -8.57097730e-02f,  -2.73292456e-02f,   5.34122344e-03f,
+             -1.38689727e-01f,  -1.10281974e-01f,   2.08992437e-01f,   1.87600896e-01f,   1.52119935e-01f,  -1.00324273e-01f,
+             -1.51933637e-02f,   3.92759368e-02f,  -2.07013771e-01f,  -3.50484014e-01f,  -3.38362809e-03f,   8.85062814e-02f,
+             -3.19568366e-02f,  -1.67152099e-02f,  -2.94845909e-01f,  -2.05762759e-01f,  -7.13545829e-02f,  -5.24687991e-02f,
+              6.44599739e-03f,   1.45568466e-03f,  -1.21917352e-02f,   2.50399977e-01f,   6.81898817e-02f,   4.51048138e-03f,
+              9.47875157e-02f,  -5.25861122e-02f,  -1.38253629e-01f,  -2.47024000e-01f,  -1.14276506e-01f,  -6.26440272e-02f,
+             -1.75494954e-01f,  -2.06758246e-01f,  -1.32156461e-01f,  -3.84158134e-01f,  -2.09304556e-01f,   1.69597238e-01f,
+             -1.78837344e-01f,  -1.38964251e-01f,  -2.22208828e-01f,  -3.20015810e-02f,   2.12350100e-01f,   1.58438280e-01f,
+             -3.88077758e-02f,   6.62168711e-02f,   5.99369518e-02f,   9.68680084e-02f,   5.28850630e-02f,   1.60723969e-01f,
+              2.83829600e-01f,   3.84449452e-01f,   3.43062848e-01f,   2.04326749e-01f,   1.36346696e-03f,  -3.25726829e-02f,
+             -6.05083555e-02f,   4.80106547e-02f,   1.55781209e-01f,   6.33712392e-03f,  -7.72351399e-02f,  -1.04737461e-01f,
+              1.37531355e-01f,   4.05773409e-02f,   8.12138692e-02f,  -9.21111368e-03f,  -8.65168273e-02f,  -1.70541942e-01f,
+              2.40408033e-01f,  -3.80234718e-02f,  -9.61833969e-02f,   9.00988728e-02f,   1.18992478e-02f,   1.57537237e-01f,
+              3.19630921e-01f,   4.20169771e-01f,   1.91591039e-01f,   2.06344888e-01f,   9.93067622e-02f,   1.27558440e-01f,
+              3.12009543e-01f,   1.48895621e-01f,   2.10618809e-01f,   1.38350695e-01f,   1.67849407e-01f,  -2.92941183e-02f,
+             -1.89422026e-01f,  -1.54016450e-01f,   9.74146351e-02f,   6.37474582e-02f,   3.07705160e-02f,   1.68486267e-01f,
+              1.80436730e-01f,   1.46402285e-01f,  -1.20824706e-02f,  -1.03449397e-01f,  -2.04225138e-01f,  -1.44801438e-01f,
+             -9.97925177e-02f,   7.35437274e-02f,   1.15772821e-01f,  -9.00145844e-02f,   4.00284752e-02f,   7.77453035e-02f,
+              6.76874444e-02f,   1.25870993e-02f,   1.07020680e-02f,  -1.61445327e-02f,  -1.87345728e-01f,   1.41291684e-02f,
+              1.39898583e-01f,  -3.04146595e-02f,   4.16378565e-02f,   2.41486266e-01f,   1.52452394e-01f,  -1.57067344e-01f,
+             -2.52172530e-01f,  -1.37477845e-01f,   2.66018122e-01f,   7.35780522e-02f,  -1.14850335e-01f,  -2.96442397e-02f,
+              6.36197925e-02f,   3.46839167e-02f,   1.46630201e-02f,  -2.13799067e-02f,  -1.28381431e-01f,  -1.08898208e-01f,
+             -1.67492162e-02f,   3.82469445e-02f,   1.79661438e-02f,  -5.48171438e-02f,  -2.66714990e-01f,  -5.09088337e-01f,
+             -3.84457231e-01f,  -1.86034501e-01f,  -1.43002003e-01f,   1.28719792e-01f,  -2.27459930e-02f,  -1.70144483e-01f,
+             -2.77416587e-01f,  -9.70290154e-02f,   7.42186978e-02f,  -4.07138054e-04f,  -2.65818089e-02f,  -7.11479485e-02f,
+             -1.16632476e-01f,  -1.14624716e-01f,  -1.56192064e-01f,  -4.36031103e-01f,  -2.53242850e-01f,  -2.73840606e-01f,
+             -9.93188620e-02f,  -3.06986749e-01f,  -3.30200940e-01f,  -1.38472974e-01f,  -5.95588051e-02f,   8.60654283e-03f,
+             -2.44286016e-01f,  -2.55845897e-02f,   2.19612509e-01f,   2.46858656e-01f,   6.84984475e-02f,  -1.12836689e-01f,
+             -1.27222151e-01f,  -4.16458398e-02f,   3.27340141e-02f,   2.80867107e-02f,  -3.23015034e-01f,  -4.02944684e-01f,
+             -2.06204891e-01f,  -4.04607393e-02f,   7.86686763e-02f,   3.06861587e-02f,  -1.68671221e-01f,  -3.01578134e-01f,
+              1.34852882e-02f,   5.01581840e-02f,   1.32728353e-01f,   1.16393916e-01f,   3.23195662e-03f,  -1.29222915e-01f,
+             -2.26385161e-01f,  -1.78211719e-01f,  -7.48163089e-02f,  -2.78421998e-01f,  -6.22930117e-02f,   2.54082054e-01f,
+              2.44726166e-01f,   7.22917244e-02f,  -1.47581697e-01f,  -1.95465222e-01f,   5.13962395e-02f,   4.42362249e-01f,
+              4.66012537e-01f,   2.70355940e-01f,   1.31296381e-01f,  -4.14989628e-02f,  -8.36959854e-02f,   6.99559832e-03f,
+             -2.93976767e-03f,   3.98374423e-02f,   2.12202817e-01f,   2.07313180e-01f,   1.52269306e-04f,  -1.94872901e-01f,
+             -1.59468785e-01f,   4.17440236e-02f,
+        };
+
+    }
+}
+
+#endif // DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_
+
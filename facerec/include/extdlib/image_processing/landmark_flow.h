@@ -0,0 +1,283 @@
+#ifndef DLIB_LANDMARK_FLOW_Hh_
+#define DLIB_LANDMARK_FLOW_Hh_
+
+#include "landmark_flow_abstract.h"
+#include "full_object_detection.h"
+#include "../array2d.h"
+#include "../geometry.h"
+#include "../image_transforms/assign_image.h"
+#include "../image_transforms/image_pyramid.h"
+#include "../simd/cpu_dispatch.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    class landmark_flow
+    {
+    public:
+
+        explicit landmark_flow (
+            unsigned long window_size = 11,
+            unsigned long num_levels = 3,
+            unsigned long max_iterations = 10,
+            double min_eigenvalue = 1
+        ) :
+            window_size(window_size),
+            num_levels(num_levels),
+            max_iterations(max_iterations),
+            min_eigenvalue(min_eigenvalue)
+        {
+            DLIB_CASSERT(window_size > 0 && num_levels > 0 && max_iterations > 0,
+                "\t landmark_flow::landmark_flow()"
+                << "\n\t Invalid inputs were given to this function."
+                << "\n\t window_size:    " << window_size
+                << "\n\t num_levels:     " << num_levels
+                << "\n\t max_iterations: " << max_iterations
+            );
+        }
+
+        unsigned long get_window_size (
+        ) const { return window_size; }
+
+        unsigned long get_num_levels (
+        ) const { return num_levels; }
+
+        unsigned long get_max_iterations (
+        ) const { return max_iterations; }
+
+        double get_min_eigenvalue (
+        ) const { return min_eigenvalue; }
+
+        template <typename image_type>
+        void next_frame (
+            const image_type& img
+        )
+        {
+            // The pyramid of the last frame becomes the previous one, and its buffers
+            // are reused for the new frame.
+            prev.swap(cur);
+            cur.resize(num_levels);
+            assign_image(cur[0], img);
+            pyramid_down<2> pyr;
+            unsigned long levels = 1;
+            for (; levels < num_levels; ++levels)
+            {
+                // There is no point in levels too small to hold a window.
+                if (std::min(cur[levels-1].nr(), cur[levels-1].nc()) < 2*(long)window_size)
+                    break;
+                pyr(cur[levels-1], cur[levels]);
+            }
+            cur.resize(levels);
+
+            if (prev.size() != 0 && (prev[0].nr() != cur[0].nr() || prev[0].nc() != cur[0].nc()))
+                prev.clear();
+        }
+
+        bool has_previous_frame (
+        ) const { return prev.size() != 0; }
+
+        void clear (
+        )
+        {
+            prev.clear();
+            cur.clear();
+        }
+
+        void track_points (
+            const std::vector<dpoint>& from,
+            std::vector<dpoint>& to,
+            std::vector<double>& errors
+        ) const
+        {
+            DLIB_CASSERT(has_previous_frame(),
+                "\t void landmark_flow::track_points()"
+                << "\n\t next_frame() must be called on two frames of the same size first."
+            );
+
+            const long size = window_size;
+            std::vector<float> scratch(3*size*size + (size+2)*(size+2) + size*size);
+            to.resize(from.size());
+            errors.resize(from.size());
+            for (unsigned long i = 0; i < from.size(); ++i)
+            {
+                dpoint back;
+                errors[i] = std::numeric_limits<double>::infinity();
+                if (!track_point(prev, cur, from[i], to[i], scratch))
+                    to[i] = from[i];
+                else if (track_point(cur, prev, to[i], back, scratch))
+                    errors[i] = length(back - from[i]);
+            }
+        }
+
+        full_object_detection propagate (
+            const full_object_detection& shape,
+            std::vector<double>& errors
+        ) const
+        {
+            std::vector<dpoint> from(shape.num_parts()), to;
+            for (unsigned long i = 0; i < shape.num_parts(); ++i)
+                from[i] = shape.part(i);
+            track_points(from, to, errors);
+
+            std::vector<point> parts(shape.num_parts());
+            dpoint motion;
+            unsigned long num_found = 0;
+            for (unsigned long i = 0; i < parts.size(); ++i)
+            {
+                if (shape.part(i) == OBJECT_PART_NOT_PRESENT)
+                {
+                    parts[i] = OBJECT_PART_NOT_PRESENT;
+                    errors[i] = std::numeric_limits<double>::infinity();
+                    continue;
+                }
+                parts[i] = to[i];
+                if (errors[i] != std::numeric_limits<double>::infinity())
+                {
+                    motion += to[i] - from[i];
+                    ++num_found;
+                }
+            }
+            if (num_found != 0)
+                motion /= num_found;
+            return full_object_detection(translate_rect(shape.get_rect(), point(motion)), parts);
+        }
+
+    private:
+
+        bool sample_patch (
+            const array2d<unsigned char>& img,
+            const dpoint& tl,
+            long size,
+            float* out
+        ) const
+        /*!
+            ensures
+                - Fills out with the size by size patch of img whose top left corner is
+                  at tl, using bilinear interpolation.
+                - returns false, and leaves out alone, if the patch isn't entirely inside
+                  img.
+        !*/
+        {
+            const long x = (long)std::floor(tl.x());
+            const long y = (long)std::floor(tl.y());
+            if (x < 0 || y < 0 || x + size >= img.nc() || y + size >= img.nr())
+                return false;
+
+            const float fx = tl.x() - x;
+            const float fy = tl.y() - y;
+            const float weights[4] = { (1-fx)*(1-fy), fx*(1-fy), (1-fx)*fy, fx*fy };
+            const simd_kernels& k = get_simd_kernels();
+            for (long r = 0; r < size; ++r)
+                k.bilinear_row(&img[y+r][x], &img[y+r+1][x], out + r*size, size, weights);
+            return true;
+        }
+
+        bool track_point (
+            const std::vector<array2d<unsigned char> >& from_pyr,
+            const std::vector<array2d<unsigned char> >& to_pyr,
+            const dpoint& p,
+            dpoint& q,
+            std::vector<float>& scratch
+        ) const
+        /*!
+            ensures
+                - Finds where p in the image of from_pyr moved to in the image of to_pyr
+                  with pyramidal Lucas-Kanade, working from the smallest level to the
+                  full resolution one.  Stores the result in #q.
+                - returns false if p can't be followed, either because the window
+                  around it has too little texture at some level, or because it moves
+                  out of the image.
+        !*/
+        {
+            const long size = window_size;
+            const long area = size*size;
+            const long big = size+2;
+            float* const patch = &scratch[0];
+            float* const grad_x = patch + area;
+            float* const grad_y = grad_x + area;
+            float* const border = grad_y + area;
+            float* const moved = border + big*big;
+            const simd_kernels& k = get_simd_kernels();
+            const pyramid_down<2> pyr;
+            const dpoint half((size-1)/2.0, (size-1)/2.0);
+
+            // The motion found so far, in the coordinates of the current level.  Since
+            // the pyramid halves the image at each level, motion found at one level is
+            // doubled going to the next.
+            dpoint motion;
+            for (long l = (long)std::min(from_pyr.size(), to_pyr.size())-1; l >= 0; --l)
+            {
+                const dpoint pl = pyr.point_down(p, l);
+
+                // Sample the window with a one pixel border, so the gradients of the
+                // whole window can be taken with central differences.
+                if (!sample_patch(from_pyr[l], pl - half - dpoint(1,1), big, border))
+                    return false;
+                double gxx = 0, gxy = 0, gyy = 0;
+                for (long r = 0; r < size; ++r)
+                {
+                    const float* row = border + (r+1)*big + 1;
+                    for (long c = 0; c < size; ++c)
+                    {
+                        const float gx = (row[c+1] - row[c-1])/2;
+                        const float gy = (row[c+big] - row[c-big])/2;
+                        patch[r*size+c] = row[c];
+                        grad_x[r*size+c] = gx;
+                        grad_y[r*size+c] = gy;
+                        gxx += gx*gx;
+                        gxy += gx*gy;
+                        gyy += gy*gy;
+                    }
+                }
+
+                // A window without texture in both directions can't be followed, since
+                // the smaller eigenvalue of the gradient matrix is what pins the motion
+                // down along the weaker direction.
+                const double min_eig = (gxx + gyy - std::sqrt((gxx-gyy)*(gxx-gyy) + 4*gxy*gxy))/2;
+                if (min_eig < min_eigenvalue*area)
+                    return false;
+                const double det = gxx*gyy - gxy*gxy;
+
+                dpoint step;
+                for (unsigned long iter = 0; iter < max_iterations; ++iter)
+                {
+                    if (!sample_patch(to_pyr[l], pl + motion + step - half, size, moved))
+                        return false;
+                    float sums[2];
+                    k.patch_mismatch(patch, moved, grad_x, grad_y, area, sums);
+                    const dpoint delta((gyy*sums[0] - gxy*sums[1])/det, (gxx*sums[1] - gxy*sums[0])/det);
+                    step += delta;
+                    // Stop once the steps are down to a few hundredths of a pixel
+                    if (length_squared(delta) < 0.0009)
+                        break;
+                }
+
+                motion += step;
+                if (l != 0)
+                    motion *= 2;
+            }
+
+            q = p + motion;
+            return true;
+        }
+
+        unsigned long window_size;
+        unsigned long num_levels;
+        unsigned long max_iterations;
+        double min_eigenvalue;
+
+        // The grayscale pyramids of the last two frames given to next_frame()
+        std::vector<array2d<unsigned char> > prev, cur;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_LANDMARK_FLOW_Hh_
+
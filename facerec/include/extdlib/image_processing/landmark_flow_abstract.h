@@ -0,0 +1,183 @@
+#undef DLIB_LANDMARK_FLOW_ABSTRACT_Hh_
+#ifdef DLIB_LANDMARK_FLOW_ABSTRACT_Hh_
+
+#include "full_object_detection_abstract.h"
+#include "../geometry/vector_abstract.h"
+#include <vector>
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    class landmark_flow
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object follows points, such as the landmarks found by a
+                shape_predictor, from one video frame to the next with sparse pyramidal
+                Lucas-Kanade optical flow.  Following 68 landmarks this way costs a small
+                fraction of running a shape_predictor again, so it is meant to carry
+                landmarks across the frames in between predictions.
+
+                Each point is followed from the previous frame to the current one and
+                then back again.  How far the point ends up from where it started, the
+                forward-backward error, is reported for every point so the caller can
+                tell which ones were lost and need the shape_predictor again.
+
+                The implementation follows Bouguet, Jean-Yves. "Pyramidal implementation
+                of the Lucas Kanade feature tracker." Intel Corporation 5 (2001).  The
+                grayscale pyramid of each frame is made once by next_frame() and shared
+                by all the points of all the faces in it, and kept for the next frame.
+
+            THREAD SAFETY
+                track_points() and propagate() don't modify this object, so any number of
+                threads may call them at once, as long as no thread calls next_frame() or
+                clear() meanwhile.
+        !*/
+
+    public:
+
+        explicit landmark_flow (
+            unsigned long window_size = 11,
+            unsigned long num_levels = 3,
+            unsigned long max_iterations = 10,
+            double min_eigenvalue = 1
+        );
+        /*!
+            requires
+                - window_size > 0
+                - num_levels > 0
+                - max_iterations > 0
+            ensures
+                - #get_window_size() == window_size
+                - #get_num_levels() == num_levels
+                - #get_max_iterations() == max_iterations
+                - #get_min_eigenvalue() == min_eigenvalue
+                - #has_previous_frame() == false
+        !*/
+
+        unsigned long get_window_size (
+        ) const;
+        /*!
+            ensures
+                - returns the width and height of the window of pixels compared around
+                  each point, at every pyramid level.
+        !*/
+
+        unsigned long get_num_levels (
+        ) const;
+        /*!
+            ensures
+                - returns the number of pyramid levels used.  Each level halves the image,
+                  so motion of up to about get_window_size()/2 * 2^(get_num_levels()-1)
+                  pixels per frame can be followed.  Fewer levels are used for images
+                  too small to hold them.
+        !*/
+
+        unsigned long get_max_iterations (
+        ) const;
+        /*!
+            ensures
+                - returns the most Lucas-Kanade steps taken per point at each level.
+        !*/
+
+        double get_min_eigenvalue (
+        ) const;
+        /*!
+            ensures
+                - A point is lost if, at any level, the smaller eigenvalue of the matrix of
+                  summed gradient products over its window, divided by the number of
+                  pixels in the window, is less than get_min_eigenvalue().  The gradients
+                  are in pixel values per pixel.  That is, points in windows with too
+                  little texture to pin their motion down are reported as lost rather than
+                  guessed at.
+        !*/
+
+        template <
+            typename image_type
+            >
+        void next_frame (
+            const image_type& img
+        );
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h
+            ensures
+                - Makes the grayscale pyramid of img and makes it the current frame.  The
+                  frame that was current before becomes the previous one.  Points are
+                  followed from the previous frame to the current one.
+                - if (the previous frame has a different size than img) then
+                    - #has_previous_frame() == false
+                - else
+                    - #has_previous_frame() == (next_frame() was called before)
+        !*/
+
+        bool has_previous_frame (
+        ) const;
+        /*!
+            ensures
+                - returns true if there are two frames of the same size to follow points
+                  between, and false otherwise.
+        !*/
+
+        void clear (
+        );
+        /*!
+            ensures
+                - forgets both frames.
+                - #has_previous_frame() == false
+        !*/
+
+        void track_points (
+            const std::vector<dpoint>& from,
+            std::vector<dpoint>& to,
+            std::vector<double>& errors
+        ) const;
+        /*!
+            requires
+                - has_previous_frame() == true
+            ensures
+                - #to.size() == from.size()
+                - #errors.size() == from.size()
+                - for all valid i:
+                    - #to[i] == where the point from[i] in the previous frame moved to in
+                      the current frame.
+                    - #errors[i] == the distance, in pixels, between from[i] and where
+                      #to[i] is followed back to in the previous frame.  Points that move
+                      consistently have errors well under a pixel.
+                    - if (from[i] couldn't be followed, because it has too little texture
+                      around it or moves too close to the edge of the image) then
+                        - #errors[i] == std::numeric_limits<double>::infinity()
+                        - #to[i] == the best guess there is, which is from[i] if the point
+                          was lost going forward.
+        !*/
+
+        full_object_detection propagate (
+            const full_object_detection& shape,
+            std::vector<double>& errors
+        ) const;
+        /*!
+            requires
+                - has_previous_frame() == true
+            ensures
+                - Moves the parts of shape, found in the previous frame, to where they are
+                  in the current frame with track_points().  Returns a full_object_detection
+                  D such that:
+                    - D.num_parts() == shape.num_parts()
+                    - D.part(i) == the part shape.part(i) moved to, rounded to the nearest
+                      pixel.  Parts that aren't present stay that way.
+                    - D.get_rect() == shape.get_rect() moved by the average motion of the
+                      parts that weren't lost.
+                - #errors[i] == the forward-backward error of shape.part(i), as reported by
+                  track_points().  It is infinite for parts that are lost or not present.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_LANDMARK_FLOW_ABSTRACT_Hh_
+
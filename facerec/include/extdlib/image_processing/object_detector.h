@@ -6,6 +6,7 @@
 #include "object_detector_abstract.h"
 #include "../geometry.h"
 #include <vector>
+#include <limits>
 #include "box_overlap_testing.h"
 #include "full_object_detection.h"
 
@@ -94,6 +95,12 @@ namespace dlib
             const std::vector<feature_vector_type>& w_ 
         );
 
+        object_detector (
+            const image_scanner_type& scanner_, 
+            const test_box_overlap& overlap_tester_,
+            const std::vector<processed_weight_vector<image_scanner_type> >& w_ 
+        );
+
         explicit object_detector (
             const std::vector<object_detector>& detectors
         );
@@ -115,6 +122,13 @@ namespace dlib
         const image_scanner_type& get_scanner (
         ) const;
 
+        unsigned long get_max_candidates (
+        ) const { return max_candidates; }
+
+        void set_max_candidates (
+            unsigned long max_candidates_
+        );
+
         object_detector& operator= (
             const object_detector& item 
         );
@@ -191,22 +205,10 @@ namespace dlib
 
     private:
 
-        bool overlaps_any_box (
-            const std::vector<rect_detection>& rects,
-            const dlib::rectangle& rect
-        ) const
-        {
-            for (unsigned long i = 0; i < rects.size(); ++i)
-            {
-                if (boxes_overlap(rects[i].rect, rect))
-                    return true;
-            }
-            return false;
-        }
-
         test_box_overlap boxes_overlap;
         std::vector<processed_weight_vector<image_scanner_type> > w;
         image_scanner_type scanner;
+        unsigned long max_candidates;
     };
 
 // ----------------------------------------------------------------------------------------
@@ -278,7 +280,8 @@ namespace dlib
         >
     object_detector<image_scanner_type>::
     object_detector (
-    )
+    ) :
+        max_candidates(std::numeric_limits<unsigned long>::max())
     {
     }
 
@@ -295,6 +298,7 @@ namespace dlib
         boxes_overlap = item.boxes_overlap;
         w = item.w;
         scanner.copy_configuration(item.scanner);
+        max_candidates = item.max_candidates;
     }
 
 // ----------------------------------------------------------------------------------------
@@ -308,7 +312,8 @@ namespace dlib
         const test_box_overlap& overlap_tester,
         const feature_vector_type& w_ 
     ) :
-        boxes_overlap(overlap_tester)
+        boxes_overlap(overlap_tester),
+        max_candidates(std::numeric_limits<unsigned long>::max())
     {
         // make sure requires clause is not broken
         DLIB_ASSERT(scanner_.get_num_detection_templates() > 0 &&
@@ -338,7 +343,8 @@ namespace dlib
         const test_box_overlap& overlap_tester,
         const std::vector<feature_vector_type>& w_ 
     ) :
-        boxes_overlap(overlap_tester)
+        boxes_overlap(overlap_tester),
+        max_candidates(std::numeric_limits<unsigned long>::max())
     {
         // make sure requires clause is not broken
         DLIB_CASSERT(scanner_.get_num_detection_templates() > 0 && w_.size() > 0,
@@ -370,6 +376,45 @@ namespace dlib
         }
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    object_detector<image_scanner_type>::
+    object_detector (
+        const image_scanner_type& scanner_, 
+        const test_box_overlap& overlap_tester,
+        const std::vector<processed_weight_vector<image_scanner_type> >& w_ 
+    ) :
+        boxes_overlap(overlap_tester),
+        w(w_),
+        max_candidates(std::numeric_limits<unsigned long>::max())
+    {
+        // make sure requires clause is not broken
+        DLIB_CASSERT(scanner_.get_num_detection_templates() > 0 && w_.size() > 0,
+            "\t object_detector::object_detector(scanner_,overlap_tester,w_)"
+            << "\n\t Invalid inputs were given to this function "
+            << "\n\t scanner_.get_num_detection_templates(): " << scanner_.get_num_detection_templates()
+            << "\n\t w_.size():                     " << w_.size()
+            << "\n\t this: " << this
+            );
+
+        for (unsigned long i = 0; i < w_.size(); ++i)
+        {
+            DLIB_CASSERT(w_[i].w.size() == scanner_.get_num_dimensions() + 1, 
+                "\t object_detector::object_detector(scanner_,overlap_tester,w_)"
+                << "\n\t Invalid inputs were given to this function "
+                << "\n\t scanner_.get_num_detection_templates(): " << scanner_.get_num_detection_templates()
+                << "\n\t w_["<<i<<"].w.size():                   " << w_[i].w.size()
+                << "\n\t scanner_.get_num_dimensions(): " << scanner_.get_num_dimensions()
+                << "\n\t this: " << this
+                );
+        }
+
+        scanner.copy_configuration(scanner_);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -412,6 +457,7 @@ namespace dlib
         boxes_overlap = item.boxes_overlap;
         w = item.w;
         scanner.copy_configuration(item.scanner);
+        max_candidates = item.max_candidates;
         return *this;
     }
 
@@ -447,15 +493,22 @@ namespace dlib
             }
         }
 
-        // Do non-max suppression
+        // Do non-max suppression, considering at most the max_candidates best
+        // detections.  With a single weight vector the scanner already sorted them.
         final_dets.clear();
         if (w.size() > 1)
             std::sort(dets_accum.rbegin(), dets_accum.rend());
+        if (dets_accum.size() > max_candidates)
+            dets_accum.resize(max_candidates);
+        if (dets_accum.size() == 0)
+            return;
+        impl::box_overlap_grid kept(impl::typical_box_width(dets_accum));
         for (unsigned long i = 0; i < dets_accum.size(); ++i)
         {
-            if (overlaps_any_box(final_dets, dets_accum[i].rect))
+            if (kept.overlaps_any_box(boxes_overlap, dets_accum[i].rect))
                 continue;
 
+            kept.add(dets_accum[i].rect);
             final_dets.push_back(dets_accum[i]);
         }
     }
@@ -617,6 +670,27 @@ namespace dlib
         return scanner;
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename image_scanner_type
+        >
+    void object_detector<image_scanner_type>::
+    set_max_candidates (
+        unsigned long max_candidates_
+    )
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(max_candidates_ > 0,
+            "\t void object_detector::set_max_candidates()"
+            << "\n\t Invalid inputs were given to this function "
+            << "\n\t max_candidates_: " << max_candidates_
+            << "\n\t this: " << this
+            );
+
+        max_candidates = max_candidates_;
+    }
+
 // ----------------------------------------------------------------------------------------
 
 }
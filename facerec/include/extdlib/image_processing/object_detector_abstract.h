@@ -143,6 +143,35 @@ namespace dlib
                   I.e. the copy is done using copy_configuration())
         !*/
 
+        object_detector (
+            const image_scanner_type& scanner, 
+            const test_box_overlap& overlap_tester,
+            const std::vector<processed_weight_vector<image_scanner_type> >& w 
+        );
+        /*!
+            requires
+                - for all valid i:
+                    - w[i].w.size() == scanner.get_num_dimensions() + 1
+                    - w[i] has already been processed for scanner.  That is, w[i] is what
+                      w[i].init(scanner) would have left it as.
+                - scanner.get_num_detection_templates() > 0
+                - w.size() > 0
+            ensures
+                - This is identical to the above constructor taking a
+                  std::vector<feature_vector_type> except that the processing done by
+                  processed_weight_vector::init() is skipped.  This lets detectors whose
+                  processed form was computed ahead of time (e.g. the precompiled
+                  get_frontal_face_detector()) be constructed without redoing that work.
+                - for all valid i:
+                    - #get_w(i) == w[i].w
+                    - #get_processed_w(i) == w[i]
+                - #num_detectors() == w.size()
+                - #get_overlap_tester() == overlap_tester
+                - #get_scanner() == scanner
+                  (note that only the "configuration" of scanner is copied.
+                  I.e. the copy is done using copy_configuration())
+        !*/
+
         explicit object_detector (
             const std::vector<object_detector>& detectors
         );
@@ -205,6 +234,31 @@ namespace dlib
                 - returns the image scanner used by this object.  
         !*/
 
+        unsigned long get_max_candidates (
+        ) const;
+        /*!
+            ensures
+                - returns the maximum number of detections, per image, that are considered
+                  by non-max suppression.  Only the highest scoring get_max_candidates()
+                  detections found by the scanner are considered, the rest are discarded.
+                  This bounds the cost of non-max suppression when the detection threshold
+                  is lowered.
+                - A default constructed object_detector has a get_max_candidates() of
+                  std::numeric_limits<unsigned long>::max(), i.e. no limit.
+                - This setting is copied along with the object_detector but is not
+                  serialized.  Set it again after deserializing a detector.
+        !*/
+
+        void set_max_candidates (
+            unsigned long max_candidates
+        );
+        /*!
+            requires
+                - max_candidates > 0
+            ensures
+                - #get_max_candidates() == max_candidates
+        !*/
+
         object_detector& operator= (
             const object_detector& item 
         );
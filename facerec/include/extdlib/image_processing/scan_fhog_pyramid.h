@@ -62,11 +62,288 @@ namespace dlib
     inline void serialize   (const default_fhog_feature_extractor&, std::ostream&) {}
     inline void deserialize (default_fhog_feature_extractor&, std::istream&) {}
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        struct fhog_pyramid_buffers
+        {
+            /*
+                The downsampled images of each pyramid level, for the two pixel types the
+                detector is normally run on.  Level i of the pyramid is kept in element i
+                (element 0 is unused since level 0 is the input image).  Keeping these
+                around between calls means that, for a stream of same sized images,
+                building the image pyramid doesn't allocate any memory.
+            */
+            array<array2d<unsigned char> > gray;
+            array<array2d<rgb_pixel> > rgb;
+        };
+
+        template <typename pixel_type>
+        inline array<array2d<pixel_type> >* get_level_buffers (fhog_pyramid_buffers& , const pixel_type*) { return 0; }
+        inline array<array2d<unsigned char> >* get_level_buffers (fhog_pyramid_buffers& b, const unsigned char*) { return &b.gray; }
+        inline array<array2d<rgb_pixel> >* get_level_buffers (fhog_pyramid_buffers& b, const rgb_pixel*) { return &b.rgb; }
+
+    // ------------------------------------------------------------------------------------
+
+        // Quantized FHOG features are scaled so the largest feature of each pyramid level
+        // is this big.  Together with the filter scale picked by
+        // fhog_filterbank::quantize_filters() this keeps a whole window's worth of
+        // products inside a 32 bit accumulator.
+        const int quantized_fhog_feature_max = 4095;
+
+        struct quantized_fhog_image
+        {
+            /*
+                One pyramid level of FHOG features rounded to 16 bit integers.  That is,
+                planes[i][r][c] == round(feats[i][r][c]*scale) where feats is the float
+                image the level was made from.
+            */
+            array<array2d<int16> > planes;
+            float scale;
+        };
+
+        inline void quantize_fhog_image (
+            const array<array2d<float> >& feats,
+            quantized_fhog_image& qfeats
+        )
+        {
+            float max_val = 0;
+            for (unsigned long i = 0; i < feats.size(); ++i)
+            {
+                for (long r = 0; r < feats[i].nr(); ++r)
+                {
+                    const float* row = &feats[i][r][0];
+                    for (long c = 0; c < feats[i].nc(); ++c)
+                        max_val = std::max(max_val, std::abs(row[c]));
+                }
+            }
+
+            qfeats.scale = max_val != 0 ? quantized_fhog_feature_max/max_val : 1;
+            if (qfeats.planes.max_size() < feats.size())
+                qfeats.planes.set_max_size(feats.size());
+            qfeats.planes.set_size(feats.size());
+            for (unsigned long i = 0; i < feats.size(); ++i)
+            {
+                qfeats.planes[i].set_size(feats[i].nr(), feats[i].nc());
+                for (long r = 0; r < feats[i].nr(); ++r)
+                {
+                    const float* row = &feats[i][r][0];
+                    int16* qrow = &qfeats.planes[i][r][0];
+                    for (long c = 0; c < feats[i].nc(); ++c)
+                    {
+                        const float v = row[c]*qfeats.scale;
+                        qrow[c] = static_cast<int16>(v < 0 ? v - 0.5f : v + 0.5f);
+                    }
+                }
+            }
+        }
+
+        struct quantized_fhog_pyramid
+        {
+            /*
+                A FHOG pyramid with every level rounded to 16 bit integers.
+                create_fhog_pyramid() extracts each level into scratch and quantizes it
+                right away, so the float features of only one level exist at a time.
+            */
+            array<quantized_fhog_image> levels;
+            array<array2d<float> > scratch;
+        };
+
+        // The two ways create_fhog_pyramid() can store the levels it makes: as floats, or
+        // quantized through a quantized_fhog_pyramid's scratch level.
+        inline void set_num_fhog_levels (
+            array<array<array2d<float> > >& feats,
+            unsigned long levels
+        )
+        {
+            if (feats.max_size() < levels)
+                feats.set_max_size(levels);
+            feats.set_size(levels);
+        }
+
+        inline void set_num_fhog_levels (
+            quantized_fhog_pyramid& feats,
+            unsigned long levels
+        )
+        {
+            if (feats.levels.max_size() < levels)
+                feats.levels.set_max_size(levels);
+            feats.levels.set_size(levels);
+        }
+
+        template <typename feature_extractor_type, typename image_type>
+        void extract_fhog_level (
+            const feature_extractor_type& fe,
+            const image_type& img,
+            array<array<array2d<float> > >& feats,
+            unsigned long level,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding
+        )
+        {
+            fe(img, feats[level], cell_size,filter_rows_padding,filter_cols_padding);
+            DLIB_ASSERT(feats[level].size() == fe.get_num_planes(), 
+                "Invalid feature extractor used with dlib::scan_fhog_pyramid.  The output does not have the \n"
+                "indicated number of planes.");
+        }
+
+        template <typename feature_extractor_type, typename image_type>
+        void extract_fhog_level (
+            const feature_extractor_type& fe,
+            const image_type& img,
+            quantized_fhog_pyramid& feats,
+            unsigned long level,
+            int cell_size,
+            int filter_rows_padding,
+            int filter_cols_padding
+        )
+        {
+            fe(img, feats.scratch, cell_size,filter_rows_padding,filter_cols_padding);
+            DLIB_ASSERT(feats.scratch.size() == fe.get_num_planes(), 
+                "Invalid feature extractor used with dlib::scan_fhog_pyramid.  The output does not have the \n"
+                "indicated number of planes.");
+            quantize_fhog_image(feats.scratch, feats.levels[level]);
+        }
+
+        inline int32 pack_int16_pair (
+            int16 lo,
+            int16 hi
+        )
+        {
+            return static_cast<int32>((static_cast<uint32>(static_cast<uint16>(hi))<<16) | static_cast<uint16>(lo));
+        }
+
+        template <typename EXP>
+        void pack_filter_taps (
+            const matrix_exp<EXP>& taps,
+            int32* pairs
+        )
+        /*!
+            ensures
+                - packs the row vector or column vector taps into (taps(2k), taps(2k+1))
+                  pairs in the layout the simd_kernels int16_pair_filter kernels expect.
+                  An odd last tap is paired with 0.
+        !*/
+        {
+            for (long k = 0; k < (taps.size()+1)/2; ++k)
+                pairs[k] = pack_int16_pair(taps(2*k), 2*k+1 < taps.size() ? taps(2*k+1) : 0);
+        }
+
+        template <typename EXP>
+        double quantize_filter (
+            const matrix_exp<EXP>& filter,
+            matrix<int16,0,1>& qfilter,
+            double max_input
+        )
+        /*!
+            ensures
+                - #qfilter == round(filter*S), returns S
+                - S is as big as possible while the elements of #qfilter fit in an int16
+                  and the dot product of #qfilter with any vector whose elements have
+                  magnitude <= max_input fits in an int32.
+        !*/
+        {
+            const double max_abs = max(abs(matrix_cast<double>(filter)));
+            const double l1 = sum(abs(matrix_cast<double>(filter)));
+            double scale = 1;
+            if (max_abs != 0)
+                scale = std::min(32767/max_abs, (2147483647.0/max_input - 0.5*filter.size())/l1);
+
+            qfilter.set_size(filter.size());
+            for (long i = 0; i < filter.size(); ++i)
+            {
+                const double v = filter(i)*scale;
+                qfilter(i) = static_cast<int16>(v < 0 ? v - 0.5 : v + 0.5);
+            }
+            return scale;
+        }
+
+        struct quantized_separable_filter
+        {
+            /*
+                One separable component of a quantized fhog filter.  Running row_filter
+                over a quantized feature plane and rounding the sums down by shift bits
+                gives 16 bit values.  Running col_filter over those gives 32 bit sums which,
+                multiplied by scale, equal the float filter's output on the features scaled
+                by quantized_fhog_image::scale.  Both filters are stored as packed pairs
+                of taps, see pack_filter_taps().
+            */
+            matrix<int32,0,1> row_filter;
+            matrix<int32,0,1> col_filter;
+            int shift;
+            double scale;
+        };
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    struct fhog_planar_layout {};
+    struct fhog_interleaved_layout {};
+
+    namespace impl
+    {
+        // The number of planes in an interleaved fhog cell is rounded up to a multiple of
+        // this so every cell and filter row is a whole number of SIMD vectors long.
+        const long interleaved_fhog_plane_multiple = 16;
+
+        inline long interleaved_fhog_num_planes (
+            long num_planes
+        )
+        {
+            const long m = interleaved_fhog_plane_multiple;
+            return (num_planes + m - 1)/m*m;
+        }
+
+        struct interleaved_fhog_image
+        {
+            /*
+                One pyramid level of FHOG features with all the planes of a cell stored
+                next to each other.  That is, cells[r][c*num_planes + i] == feats[i][r][c]
+                where feats is the planar image the level was made from.  Planes past
+                feats.size() are 0.
+            */
+            array2d<float> cells;
+            long num_planes;
+        };
+
+        inline void interleave_fhog_image (
+            const array<array2d<float> >& feats,
+            interleaved_fhog_image& ifeats
+        )
+        {
+            const long num_planes = interleaved_fhog_num_planes(feats.size());
+            const long nr = feats.size() != 0 ? feats[0].nr() : 0;
+            const long nc = feats.size() != 0 ? feats[0].nc() : 0;
+            ifeats.num_planes = num_planes;
+            ifeats.cells.set_size(nr, nc*num_planes);
+            std::vector<const float*> in(feats.size());
+            for (long r = 0; r < nr; ++r)
+            {
+                for (unsigned long i = 0; i < feats.size(); ++i)
+                    in[i] = &feats[i][r][0];
+                // Write each cell in order, so the output is streamed through once.
+                float* out = &ifeats.cells[r][0];
+                for (long c = 0; c < nc; ++c)
+                {
+                    unsigned long i = 0;
+                    for (; i < feats.size(); ++i)
+                        out[i] = in[i][c];
+                    for (; i < (unsigned long)num_planes; ++i)
+                        out[i] = 0;
+                    out += num_planes;
+                }
+            }
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename Feature_extractor_type = default_fhog_feature_extractor
+        typename Feature_extractor_type = default_fhog_feature_extractor,
+        typename Feature_layout_type = fhog_planar_layout
         >
     class scan_fhog_pyramid : noncopyable
     {
@@ -77,6 +354,7 @@ namespace dlib
 
         typedef Pyramid_type pyramid_type;
         typedef Feature_extractor_type feature_extractor_type;
+        typedef Feature_layout_type feature_layout_type;
 
         scan_fhog_pyramid (
         );  
@@ -116,6 +394,7 @@ namespace dlib
             window_width = width;
             window_height = height;
             feats.clear();
+            quantized_feats.levels.clear();
         }
 
         inline unsigned long get_detection_window_width (
@@ -135,6 +414,7 @@ namespace dlib
         {
             padding = new_padding;
             feats.clear();
+            quantized_feats.levels.clear();
         }
 
         unsigned long get_padding (
@@ -153,6 +433,7 @@ namespace dlib
 
             cell_size = new_cell_size;
             feats.clear();
+            quantized_feats.levels.clear();
         }
 
         unsigned long get_cell_size (
@@ -207,6 +488,8 @@ namespace dlib
         {
             friend class scan_fhog_pyramid;
         public:
+            fhog_filterbank() : quantized_scale(1) {}
+
             inline long get_num_dimensions() const
             {
                 unsigned long dims = 0;
@@ -229,8 +512,143 @@ namespace dlib
                 return num;
             }
 
+            void quantize_filters (
+            )
+            {
+                // Pick the scale so that even a window in which every feature is
+                // impl::quantized_fhog_feature_max can't overflow a 32 bit sum.  Rounding
+                // can grow each weight by up to 0.5, which the 0.5*num_values term covers.
+                double max_abs = 0, l1 = 0;
+                long num_values = 0;
+                for (unsigned long i = 0; i < filters.size(); ++i)
+                {
+                    for (long j = 0; j < filters[i].size(); ++j)
+                    {
+                        max_abs = std::max<double>(max_abs, std::abs(filters[i](j)));
+                        l1 += std::abs(filters[i](j));
+                    }
+                    num_values += filters[i].size();
+                }
+
+                quantized_scale = 1;
+                if (max_abs != 0)
+                {
+                    const double sum_limit = 2147483647.0/impl::quantized_fhog_feature_max - 0.5*num_values;
+                    quantized_scale = std::min(32767/max_abs, sum_limit/l1);
+                }
+
+                quantized_filters.resize(filters.size());
+                matrix<int16> taps;
+                for (unsigned long i = 0; i < filters.size(); ++i)
+                {
+                    taps.set_size(filters[i].nr(), filters[i].nc());
+                    for (long j = 0; j < filters[i].size(); ++j)
+                    {
+                        const double v = filters[i](j)*quantized_scale;
+                        taps(j) = static_cast<int16>(v < 0 ? v - 0.5 : v + 0.5);
+                    }
+                    quantized_filters[i].set_size(taps.nr(), (taps.nc()+1)/2);
+                    for (long r = 0; r < taps.nr(); ++r)
+                        impl::pack_filter_taps(rowm(taps,r), &quantized_filters[i](r,0));
+                }
+
+                // The separable filters are quantized one at a time.  The row pass
+                // output is shifted down just enough to be sure it fits in 16 bits again.
+                quantized_separable_filters.resize(row_filters.size());
+                matrix<int16,0,1> row_taps, col_taps;
+                for (unsigned long i = 0; i < row_filters.size(); ++i)
+                {
+                    quantized_separable_filters[i].resize(row_filters[i].size());
+                    for (unsigned long j = 0; j < row_filters[i].size(); ++j)
+                    {
+                        impl::quantized_separable_filter& q = quantized_separable_filters[i][j];
+                        const double row_scale = impl::quantize_filter(row_filters[i][j], row_taps, impl::quantized_fhog_feature_max);
+                        const double row_max = impl::quantized_fhog_feature_max*sum(abs(matrix_cast<double>(row_taps)));
+                        q.shift = 0;
+                        while (row_max/(1<<q.shift) > 32767)
+                            ++q.shift;
+                        const double col_scale = impl::quantize_filter(col_filters[i][j], col_taps, 32768);
+                        q.scale = (1<<q.shift)/(row_scale*col_scale);
+
+                        q.row_filter.set_size((row_taps.size()+1)/2);
+                        q.col_filter.set_size((col_taps.size()+1)/2);
+                        impl::pack_filter_taps(row_taps, &q.row_filter(0));
+                        impl::pack_filter_taps(col_taps, &q.col_filter(0));
+                    }
+                }
+            }
+
             std::vector<matrix<float> > filters;
             std::vector<std::vector<matrix<float,0,1> > > row_filters, col_filters;
+
+            // filters and the separable filters rounded to 16 bit integers for quantized
+            // detection.  Row r of quantized_filters[i] holds round(rowm(filters[i],r)*
+            // quantized_scale) packed into pairs by impl::pack_filter_taps().
+            std::vector<matrix<int32> > quantized_filters;
+            double quantized_scale;
+            std::vector<std::vector<impl::quantized_separable_filter> > quantized_separable_filters;
+
+            void truncate_separable_filters (
+                unsigned long max_rank,
+                double thresh
+            )
+            {
+                // The separable components come from an SVD with each side scaled by the
+                // square root of its singular value, sorted largest first.  So the
+                // singular value of a component is the product of the lengths of its
+                // row and column filters and truncating is just dropping the tail.
+                for (unsigned long i = 0; i < row_filters.size(); ++i)
+                {
+                    if (row_filters[i].size() == 0)
+                        continue;
+
+                    std::vector<double> sv(row_filters[i].size());
+                    for (unsigned long j = 0; j < sv.size(); ++j)
+                        sv[j] = length(row_filters[i][j])*length(col_filters[i][j]);
+                    const double scaled_thresh = *std::max_element(sv.begin(), sv.end())*thresh;
+
+                    unsigned long keep = 0;
+                    while (keep < sv.size() && keep < max_rank && sv[keep] >= scaled_thresh)
+                        ++keep;
+                    if (keep == sv.size())
+                        continue;
+
+                    row_filters[i].resize(keep);
+                    col_filters[i].resize(keep);
+
+                    // Rebuild the full filter from what is left so both ways of running
+                    // the filter bank give the same result.
+                    filters[i] = zeros_matrix<float>(filters[i].nr(), filters[i].nc());
+                    for (unsigned long j = 0; j < keep; ++j)
+                        filters[i] += col_filters[i][j]*trans(row_filters[i][j]);
+                }
+
+                quantize_filters();
+                if (interleaved_filters.size() != 0)
+                    interleave_filters();
+            }
+
+            void interleave_filters (
+            )
+            {
+                const long num_planes = impl::interleaved_fhog_num_planes(filters.size());
+                const long nr = filters.size() != 0 ? filters[0].nr() : 0;
+                const long nc = filters.size() != 0 ? filters[0].nc() : 0;
+                interleaved_filters = zeros_matrix<float>(nr, nc*num_planes);
+                for (unsigned long i = 0; i < filters.size(); ++i)
+                {
+                    for (long r = 0; r < nr; ++r)
+                    {
+                        for (long c = 0; c < nc; ++c)
+                            interleaved_filters(r, c*num_planes + i) = filters[i](r,c);
+                    }
+                }
+            }
+
+            // filters laid out like impl::interleaved_fhog_image, one filter row per row.
+            // Only filled in by build_fhog_filterbank() for fhog_interleaved_layout
+            // scanners.
+            matrix<float> interleaved_filters;
         };
 
         fhog_filterbank build_fhog_filterbank (
@@ -280,6 +698,9 @@ namespace dlib
                     }
                 }
             }
+            temp.quantize_filters();
+            if (is_same_type<feature_layout_type, fhog_interleaved_layout>::value)
+                temp.interleave_filters();
 
             return temp;
         }
@@ -305,6 +726,17 @@ namespace dlib
             const rectangle& rect
         ) const;
 
+        template <
+            typename image_type
+            >
+        void score_window (
+            const image_type& img,
+            const rectangle& rect,
+            const std::vector<const fhog_filterbank*>& w,
+            std::vector<std::pair<double, rectangle> >& scores,
+            const unsigned long search_radius = 0
+        ) const;
+
         double get_nuclear_norm_regularization_strength (
         ) const { return nuclear_norm_regularization_strength; }
 
@@ -323,6 +755,43 @@ namespace dlib
             nuclear_norm_regularization_strength = strength;
         }
 
+        bool get_quantized_detection (
+        ) const { return quantized_detection; }
+
+        void set_quantized_detection (
+            bool enabled
+        )
+        {
+            quantized_detection = enabled;
+            feats.clear();
+            quantized_feats.levels.clear();
+            interleaved_feats.clear();
+        }
+
+        bool get_local_max_detection (
+        ) const { return local_max_detection; }
+
+        void set_local_max_detection (
+            bool enabled
+        ) { local_max_detection = enabled; }
+
+        unsigned long get_max_detections (
+        ) const { return max_detections; }
+
+        void set_max_detections (
+            unsigned long max_dets
+        )
+        {
+            // make sure requires clause is not broken
+            DLIB_ASSERT(max_dets > 0 ,
+                "\t void scan_fhog_pyramid::set_max_detections()"
+                << "\n\t You can't have zero detections. "
+                << "\n\t this: " << this
+            );
+
+            max_detections = max_dets;
+        }
+
         unsigned long get_fhog_window_width (
         ) const 
         {
@@ -339,19 +808,24 @@ namespace dlib
             return height;
         }
 
-        template <typename T, typename U>
+        template <typename T, typename U, typename V>
         friend void serialize (
-            const scan_fhog_pyramid<T,U>& item,
+            const scan_fhog_pyramid<T,U,V>& item,
             std::ostream& out
         );
 
-        template <typename T, typename U>
+        template <typename T, typename U, typename V>
         friend void deserialize (
-            scan_fhog_pyramid<T,U>& item,
+            scan_fhog_pyramid<T,U,V>& item,
             std::istream& in 
         );
 
     private:
+        // Fills quantized_feats or interleaved_feats from feats, whichever detect() is
+        // going to use.  In quantized mode feats is cleared afterwards.
+        void make_detection_feats (
+        );
+
         inline void compute_fhog_window_size(
             unsigned long& width,
             unsigned long& height
@@ -385,6 +859,9 @@ namespace dlib
 
         feature_extractor_type fe;
         array<fhog_image> feats;
+        impl::quantized_fhog_pyramid quantized_feats;
+        array<impl::interleaved_fhog_image> interleaved_feats;
+        impl::fhog_pyramid_buffers level_images;
         int cell_size;
         unsigned long padding; 
         unsigned long window_width;
@@ -393,6 +870,9 @@ namespace dlib
         unsigned long min_pyramid_layer_width;
         unsigned long min_pyramid_layer_height;
         double nuclear_norm_regularization_strength;
+        bool quantized_detection;
+        bool local_max_detection;
+        unsigned long max_detections;
 
         void init()
         {
@@ -404,6 +884,9 @@ namespace dlib
             min_pyramid_layer_width = 64;
             min_pyramid_layer_height = 64;
             nuclear_norm_regularization_strength = 0;
+            quantized_detection = false;
+            local_max_detection = false;
+            max_detections = std::numeric_limits<unsigned long>::max();
         }
 
     };
@@ -436,6 +919,7 @@ namespace dlib
             {
                 saliency_image.clear();
                 array2d<float> scratch;
+                separable_filter_buffers buffers;
 
                 // find the first filter to apply
                 unsigned long i = 0;
@@ -447,9 +931,9 @@ namespace dlib
                     for (unsigned long j = 0; j < w.row_filters[i].size(); ++j)
                     {
                         if (saliency_image.size() == 0)
-                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,false);
+                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,buffers,false);
                         else
-                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,true);
+                            area = float_spatially_filter_image_separable(feats[i], saliency_image, w.row_filters[i][j], w.col_filters[i][j],scratch,buffers,true);
                     }
                 }
                 if (saliency_image.size() == 0)
@@ -460,13 +944,168 @@ namespace dlib
             }
             return area;
         }
+
+        inline void make_fhog_pair_image (
+            const simd_kernels& kernels,
+            const array2d<int16>& plane,
+            const std::vector<int16>& zeros,
+            array2d<int32>& pair_image
+        )
+        {
+            // pmaddwd multiplies two neighbouring 16 bit values by two taps at once.  So
+            // each plane is turned into an image of (x[c], x[c+1]) pairs, one per column,
+            // and a row filter is then one load and one pmaddwd per pair of taps.  The
+            // last column is paired with 0.
+            for (long r = 0; r < plane.nr(); ++r)
+            {
+                kernels.int16_interleave(&plane[r][0], &plane[r][1], &pair_image[r][0], plane.nc()-1);
+                kernels.int16_interleave(&plane[r][plane.nc()-1], &zeros[0], &pair_image[r][plane.nc()-1], 1);
+            }
+        }
+
+        template <typename fhog_filterbank>
+        rectangle apply_filters_to_fhog (
+            const fhog_filterbank& w,
+            const interleaved_fhog_image& feats,
+            array2d<float>& saliency_image
+        )
+        {
+            // With the planes interleaved, a filter row is one contiguous run of
+            // filter_nc*num_planes values and so is the part of a feature row under a
+            // window.  So all the planes of all the windows of an output row are summed in
+            // a single call, with several windows accumulated in registers at a time,
+            // instead of making one pass over the saliency image per plane.  The output
+            // covers the same area as spatially_filter_image().
+            const long filter_nr = w.interleaved_filters.nr();
+            const long filter_nc = w.filters[0].nc();
+            const long first_row = filter_nr/2;
+            const long first_col = filter_nc/2;
+            const long last_row = feats.cells.nr() - ((filter_nr-1)/2);
+            const long last_col = feats.cells.nc()/feats.num_planes - ((filter_nc-1)/2);
+
+            saliency_image.set_size(feats.cells.nr(), feats.cells.nc()/feats.num_planes);
+            assign_all_pixels(saliency_image, 0);
+            if (first_row >= last_row || first_col >= last_col)
+                return rectangle();
+            const rectangle area(first_col, first_row, last_col-1, last_row-1);
+
+            const simd_kernels& kernels = get_simd_kernels();
+            std::vector<const float*> rows(filter_nr);
+            for (long r = area.top(); r <= area.bottom(); ++r)
+            {
+                for (long m = 0; m < filter_nr; ++m)
+                    rows[m] = &feats.cells[r-first_row+m][0];
+                kernels.float_interleaved_filter(&rows[0], &saliency_image[r][first_col], area.width(),
+                    feats.num_planes, &w.interleaved_filters(0,0), filter_nr, w.interleaved_filters.nc(), false);
+            }
+            return area;
+        }
+
+        template <typename fhog_filterbank>
+        rectangle apply_filters_to_fhog (
+            const fhog_filterbank& w,
+            const quantized_fhog_image& feats,
+            array2d<float>& saliency_image
+        )
+        {
+            // This mirrors the float version above, with pmaddwd doing the multiply-adds
+            // on 16 bit features and filters.  The output covers the same area as
+            // spatially_filter_image().
+            const long filter_nr = w.filters[0].nr();
+            const long filter_nc = w.filters[0].nc();
+            const long first_row = filter_nr/2;
+            const long first_col = filter_nc/2;
+            const long last_row = feats.planes[0].nr() - ((filter_nr-1)/2);
+            const long last_col = feats.planes[0].nc() - ((filter_nc-1)/2);
+
+            saliency_image.set_size(feats.planes[0].nr(), feats.planes[0].nc());
+            assign_all_pixels(saliency_image, 0);
+            if (first_row >= last_row || first_col >= last_col)
+                return rectangle();
+            const rectangle area(first_col, first_row, last_col-1, last_row-1);
+
+            const simd_kernels& kernels = get_simd_kernels();
+            const unsigned long num_separable_filters = w.num_separable_filters();
+            const long num_pairs = (filter_nc+1)/2;
+            std::vector<const int32*> pairs(std::max(num_pairs, (filter_nr+1)/2));
+
+            const std::vector<int16> zeros(feats.planes[0].nc(), 0);
+            array2d<int32> pair_image(feats.planes[0].nr(), feats.planes[0].nc());
+
+            // use the separable filters if they would be faster than running the regular filters.
+            if (num_separable_filters > w.filters.size()*std::min(filter_nr,filter_nc)/3.0)
+            {
+                // The full filters all share one scale, so the whole window is summed in
+                // a single 32 bit accumulator.
+                array2d<int32> sums(area.height(), area.width());
+                assign_all_pixels(sums, 0);
+                for (unsigned long i = 0; i < feats.planes.size(); ++i)
+                {
+                    make_fhog_pair_image(kernels, feats.planes[i], zeros, pair_image);
+                    const matrix<int32>& filter = w.quantized_filters[i];
+                    for (long r = 0; r < sums.nr(); ++r)
+                    {
+                        for (long m = 0; m < filter_nr; ++m)
+                        {
+                            for (long k = 0; k < num_pairs; ++k)
+                                pairs[k] = &pair_image[r+m][2*k];
+                            kernels.int16_pair_filter_add(&pairs[0], &sums[r][0], sums.nc(), &filter(m,0), num_pairs);
+                        }
+                    }
+                }
+
+                const float scale = 1/(feats.scale*w.quantized_scale);
+                for (long r = 0; r < sums.nr(); ++r)
+                {
+                    for (long c = 0; c < sums.nc(); ++c)
+                        saliency_image[r+first_row][c+first_col] = sums[r][c]*scale;
+                }
+            }
+            else
+            {
+                // The column pass pairs each row of the row filtered image with the one
+                // below it, the last row with 0.
+                array2d<int16> scratch(feats.planes[0].nr(), area.width());
+                array2d<int32> col_pairs(scratch.nr(), scratch.nc());
+                for (unsigned long i = 0; i < w.quantized_separable_filters.size(); ++i)
+                {
+                    if (w.quantized_separable_filters[i].size() == 0)
+                        continue;
+                    make_fhog_pair_image(kernels, feats.planes[i], zeros, pair_image);
+                    for (unsigned long j = 0; j < w.quantized_separable_filters[i].size(); ++j)
+                    {
+                        const quantized_separable_filter& q = w.quantized_separable_filters[i][j];
+                        for (long r = 0; r < scratch.nr(); ++r)
+                        {
+                            for (long k = 0; k < num_pairs; ++k)
+                                pairs[k] = &pair_image[r][2*k];
+                            kernels.int16_pair_filter_shift(&pairs[0], &scratch[r][0], scratch.nc(), &q.row_filter(0), num_pairs, q.shift);
+                        }
+                        for (long r = 0; r < scratch.nr(); ++r)
+                        {
+                            const int16* below = r+1 < scratch.nr() ? &scratch[r+1][0] : &zeros[0];
+                            kernels.int16_interleave(&scratch[r][0], below, &col_pairs[r][0], scratch.nc());
+                        }
+
+                        const float scale = q.scale/feats.scale;
+                        for (long r = area.top(); r <= area.bottom(); ++r)
+                        {
+                            for (long k = 0; k < q.col_filter.size(); ++k)
+                                pairs[k] = &col_pairs[r-first_row+2*k][0];
+                            kernels.int16_pair_filter(&pairs[0], &saliency_image[r][first_col], area.width(), &q.col_filter(0), q.col_filter.size(), scale, true);
+                        }
+                    }
+                }
+            }
+            return area;
+        }
     }
 
 // ----------------------------------------------------------------------------------------
 
-    template <typename T, typename U>
+    template <typename T, typename U, typename V>
     void serialize (
-        const scan_fhog_pyramid<T,U>& item,
+        const scan_fhog_pyramid<T,U,V>& item,
         std::ostream& out
     )
     {
@@ -487,9 +1126,9 @@ namespace dlib
 
 // ----------------------------------------------------------------------------------------
 
-    template <typename T, typename U>
+    template <typename T, typename U, typename V>
     void deserialize (
-        scan_fhog_pyramid<T,U>& item,
+        scan_fhog_pyramid<T,U,V>& item,
         std::istream& in 
     )
     {
@@ -517,6 +1156,8 @@ namespace dlib
         deserialize(dims, in);
         if (item.get_num_dimensions() != dims)
             throw serialization_error("Number of dimensions in serialized scan_fhog_pyramid doesn't match the expected number.");
+
+        item.make_detection_feats();
     }
 
 // ----------------------------------------------------------------------------------------
@@ -527,9 +1168,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     scan_fhog_pyramid (
     ) 
     {
@@ -540,9 +1182,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     scan_fhog_pyramid (
         const feature_extractor_type& fe_
     ) 
@@ -558,18 +1201,20 @@ namespace dlib
         template <
             typename pyramid_type,
             typename image_type,
-            typename feature_extractor_type
+            typename feature_extractor_type,
+            typename fhog_pyramid_type
             >
         void create_fhog_pyramid (
             const image_type& img,
             const feature_extractor_type& fe,
-            array<array<array2d<float> > >& feats,
+            fhog_pyramid_type& feats,
             int cell_size,
             int filter_rows_padding,
             int filter_cols_padding,
             unsigned long min_pyramid_layer_width,
             unsigned long min_pyramid_layer_height,
-            unsigned long max_pyramid_levels
+            unsigned long max_pyramid_levels,
+            fhog_pyramid_buffers* buffers = 0
         )
         {
             unsigned long levels = 0;
@@ -584,30 +1229,42 @@ namespace dlib
             } while (rect.width() >= min_pyramid_layer_width && rect.height() >= min_pyramid_layer_height &&
                 levels < max_pyramid_levels);
 
-            if (feats.max_size() < levels)
-                feats.set_max_size(levels);
-            feats.set_size(levels);
+            set_num_fhog_levels(feats, levels);
 
 
 
             // build our feature pyramid
-            fe(img, feats[0], cell_size,filter_rows_padding,filter_cols_padding);
-            DLIB_ASSERT(feats[0].size() == fe.get_num_planes(), 
-                "Invalid feature extractor used with dlib::scan_fhog_pyramid.  The output does not have the \n"
-                "indicated number of planes.");
+            extract_fhog_level(fe, img, feats, 0, cell_size,filter_rows_padding,filter_cols_padding);
 
-            if (feats.size() > 1)
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            array<array2d<pixel_type> >* level_imgs = buffers ? get_level_buffers(*buffers, (const pixel_type*)0) : 0;
+            if (levels > 1 && level_imgs)
+            {
+                // Each level gets its own persistent image, so when the input size
+                // doesn't change neither do the sizes of these images.
+                if (level_imgs->max_size() < levels)
+                    level_imgs->set_max_size(levels);
+                level_imgs->set_size(levels);
+
+                pyr(img, (*level_imgs)[1]);
+                extract_fhog_level(fe, (*level_imgs)[1], feats, 1, cell_size,filter_rows_padding,filter_cols_padding);
+                for (unsigned long i = 2; i < levels; ++i)
+                {
+                    pyr((*level_imgs)[i-1], (*level_imgs)[i]);
+                    extract_fhog_level(fe, (*level_imgs)[i], feats, i, cell_size,filter_rows_padding,filter_cols_padding);
+                }
+            }
+            else if (levels > 1)
             {
-                typedef typename image_traits<image_type>::pixel_type pixel_type;
                 array2d<pixel_type> temp1, temp2;
                 pyr(img, temp1);
-                fe(temp1, feats[1], cell_size,filter_rows_padding,filter_cols_padding);
+                extract_fhog_level(fe, temp1, feats, 1, cell_size,filter_rows_padding,filter_cols_padding);
                 swap(temp1,temp2);
 
-                for (unsigned long i = 2; i < feats.size(); ++i)
+                for (unsigned long i = 2; i < levels; ++i)
                 {
                     pyr(temp2, temp1);
-                    fe(temp1, feats[i], cell_size,filter_rows_padding,filter_cols_padding);
+                    extract_fhog_level(fe, temp1, feats, i, cell_size,filter_rows_padding,filter_cols_padding);
                     swap(temp1,temp2);
                 }
             }
@@ -618,43 +1275,87 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
     template <
         typename image_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     load (
         const image_type& img
     )
     {
         unsigned long width, height;
         compute_fhog_window_size(width,height);
+        if (quantized_detection)
+        {
+            // Each level is quantized as soon as it is made, so the float pyramid is
+            // never kept.
+            feats.clear();
+            impl::create_fhog_pyramid<Pyramid_type>(img, fe, quantized_feats, cell_size, height,
+                width, min_pyramid_layer_width, min_pyramid_layer_height,
+                max_pyramid_levels, &level_images);
+            return;
+        }
         impl::create_fhog_pyramid<Pyramid_type>(img, fe, feats, cell_size, height,
             width, min_pyramid_layer_width, min_pyramid_layer_height,
-            max_pyramid_levels);
+            max_pyramid_levels, &level_images);
+        make_detection_feats();
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type,
+        typename feature_layout_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
+    make_detection_feats (
+    )
+    {
+        if (quantized_detection)
+        {
+            // Only float features that were deserialized get here.  load() makes the
+            // quantized levels directly.
+            impl::set_num_fhog_levels(quantized_feats, feats.size());
+            for (unsigned long l = 0; l < feats.size(); ++l)
+                impl::quantize_fhog_image(feats[l], quantized_feats.levels[l]);
+            feats.clear();
+        }
+        else if (is_same_type<feature_layout_type, fhog_interleaved_layout>::value)
+        {
+            if (interleaved_feats.max_size() < feats.size())
+                interleaved_feats.set_max_size(feats.size());
+            interleaved_feats.set_size(feats.size());
+            for (unsigned long l = 0; l < feats.size(); ++l)
+                impl::interleave_fhog_image(feats[l], interleaved_feats[l]);
+        }
     }
 
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    bool scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    bool scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     is_loaded_with_image (
     ) const
     {
-        return feats.size() != 0;
+        return feats.size() != 0 || quantized_feats.levels.size() != 0;
     }
 
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     copy_configuration (
         const scan_fhog_pyramid& item
     )
@@ -667,6 +1368,9 @@ namespace dlib
         min_pyramid_layer_width = item.min_pyramid_layer_width;
         min_pyramid_layer_height = item.min_pyramid_layer_height;
         nuclear_norm_regularization_strength = item.nuclear_norm_regularization_strength;
+        quantized_detection = item.quantized_detection;
+        local_max_detection = item.local_max_detection;
+        max_detections = item.max_detections;
         fe = item.fe;
     }
 
@@ -674,9 +1378,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_num_detection_templates (
     ) const
     {
@@ -687,9 +1392,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_num_movable_components_per_detection_template (
     ) const
     {
@@ -700,9 +1406,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_num_dimensions (
     ) const
     {
@@ -715,9 +1422,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_max_pyramid_levels (
     ) const
     {
@@ -728,9 +1436,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     set_max_pyramid_levels (
         unsigned long max_levels
     )
@@ -758,13 +1467,54 @@ namespace dlib
             return a.first < b.first;
         }
 
+        inline bool compare_pair_rect_greater (
+            const std::pair<double, rectangle>& a,
+            const std::pair<double, rectangle>& b
+        )
+        {
+            return a.first > b.first;
+        }
+
+        inline bool is_local_max (
+            const array2d<float>& img,
+            const rectangle& area,
+            long r,
+            long c
+        )
+        /*!
+            ensures
+                - returns true if no 8-connected neighbor of img[r][c] inside area is
+                  bigger than it.  Ties are broken in favor of the pixel that comes first in
+                  raster order, so a plateau reports exactly one local max.
+        !*/
+        {
+            const float v = img[r][c];
+            const long top    = std::max(r-1, area.top());
+            const long bottom = std::min(r+1, area.bottom());
+            const long left   = std::max(c-1, area.left());
+            const long right  = std::min(c+1, area.right());
+            for (long rr = top; rr <= bottom; ++rr)
+            {
+                for (long cc = left; cc <= right; ++cc)
+                {
+                    const float n = img[rr][cc];
+                    // neighbors before us in raster order must be strictly smaller, the
+                    // ones after us just can't be bigger.
+                    if (n > v || (n == v && (rr < r || (rr == r && cc < c))))
+                        return false;
+                }
+            }
+            return true;
+        }
+
         template <
             typename pyramid_type,
             typename feature_extractor_type,
-            typename fhog_filterbank
+            typename fhog_filterbank,
+            typename fhog_pyramid
             >
         void detect_from_fhog_pyramid (
-            const array<array<array2d<float> > >& feats,
+            const fhog_pyramid& feats,
             const feature_extractor_type& fe,
             const fhog_filterbank& w,
             const double thresh,
@@ -773,7 +1523,9 @@ namespace dlib
             const int cell_size,
             const int filter_rows_padding,
             const int filter_cols_padding,
-            std::vector<std::pair<double, rectangle> >& dets
+            std::vector<std::pair<double, rectangle> >& dets,
+            const bool local_max_only = false,
+            const unsigned long max_dets = std::numeric_limits<unsigned long>::max()
         ) 
         {
             dets.clear();
@@ -781,6 +1533,9 @@ namespace dlib
             array2d<float> saliency_image;
             pyramid_type pyr;
 
+            // dets is kept as a min-heap on the score while it is filled, so that once it
+            // holds max_dets windows, the ones that don't beat the worst of them are
+            // dropped before their rectangles are even computed.
             // for all pyramid levels
             for (unsigned long l = 0; l < feats.size(); ++l)
             {
@@ -791,14 +1546,30 @@ namespace dlib
                 {
                     for (long c = area.left(); c <= area.right(); ++c)
                     {
+                        const float score = saliency_image[r][c];
                         // if we found a detection
-                        if (saliency_image[r][c] >= thresh)
+                        if (score < thresh)
+                            continue;
+                        if (dets.size() >= max_dets && score <= dets[0].first)
+                            continue;
+                        // The windows next to a local maximum overlap it almost entirely
+                        // and would be removed by non-max suppression anyway.
+                        if (local_max_only && !is_local_max(saliency_image, area, r, c))
+                            continue;
+
+                        rectangle rect = fe.feats_to_image(centered_rect(point(c,r),det_box_width,det_box_height), 
+                            cell_size, filter_rows_padding, filter_cols_padding);
+                        rect = pyr.rect_up(rect, l);
+                        if (dets.size() >= max_dets)
+                        {
+                            std::pop_heap(dets.begin(), dets.end(), compare_pair_rect_greater);
+                            dets.back() = std::make_pair(score, rect);
+                        }
+                        else
                         {
-                            rectangle rect = fe.feats_to_image(centered_rect(point(c,r),det_box_width,det_box_height), 
-                                cell_size, filter_rows_padding, filter_cols_padding);
-                            rect = pyr.rect_up(rect, l);
-                            dets.push_back(std::make_pair(saliency_image[r][c], rect));
+                            dets.push_back(std::make_pair(score, rect));
                         }
+                        std::push_heap(dets.begin(), dets.end(), compare_pair_rect_greater);
                     }
                 }
             }
@@ -828,9 +1599,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     detect (
         const fhog_filterbank& w,
         std::vector<std::pair<double, rectangle> >& dets,
@@ -848,20 +1620,50 @@ namespace dlib
             << "\n\t this: " << this
             );
 
+        DLIB_ASSERT(!quantized_detection || w.quantized_filters.size() == w.filters.size(),
+            "\t void scan_fhog_pyramid::detect()"
+            << "\n\t Quantized detection needs a filter bank with quantized filters. "
+            << "\n\t this: " << this
+            );
+
+        DLIB_ASSERT(!is_same_type<feature_layout_type, fhog_interleaved_layout>::value ||
+                    w.interleaved_filters.nr() == w.filters[0].nr(),
+            "\t void scan_fhog_pyramid::detect()"
+            << "\n\t An interleaved scanner needs a filter bank with interleaved filters. "
+            << "\n\t this: " << this
+            );
+
         unsigned long width, height;
         compute_fhog_window_size(width,height);
 
-        impl::detect_from_fhog_pyramid<pyramid_type>(feats, fe, w, thresh,
-            height-2*padding, width-2*padding, cell_size, height, width, dets);
+        if (quantized_detection)
+        {
+            impl::detect_from_fhog_pyramid<pyramid_type>(quantized_feats.levels, fe, w, thresh,
+                height-2*padding, width-2*padding, cell_size, height, width, dets,
+                local_max_detection, max_detections);
+        }
+        else if (is_same_type<feature_layout_type, fhog_interleaved_layout>::value)
+        {
+            impl::detect_from_fhog_pyramid<pyramid_type>(interleaved_feats, fe, w, thresh,
+                height-2*padding, width-2*padding, cell_size, height, width, dets,
+                local_max_detection, max_detections);
+        }
+        else
+        {
+            impl::detect_from_fhog_pyramid<pyramid_type>(feats, fe, w, thresh,
+                height-2*padding, width-2*padding, cell_size, height, width, dets,
+                local_max_detection, max_detections);
+        }
     }
 
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    const rectangle scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    const rectangle scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_best_matching_rect (
         const rectangle& rect
     ) const
@@ -876,9 +1678,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_mapped_rect_and_metadata (
         const unsigned long number_pyramid_levels,
         const rectangle& rect,
@@ -917,13 +1720,296 @@ namespace dlib
         mapped_rect = pyr.rect_up(fe.feats_to_image(shrink_rect(fhog_rect,padding), cell_size,height,width),best_level);
     }
 
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        template <typename pyramid_type>
+        std::vector<rectangle> pyramid_level_rects (
+            const pyramid_type& pyr,
+            const rectangle& img_rect,
+            unsigned long levels
+        )
+        /*!
+            ensures
+                - returns the areas covered by the first levels levels of an image pyramid
+                  of an image covering img_rect.  Only level 0 is exact since pyramids round
+                  the size of each level.
+        !*/
+        {
+            std::vector<rectangle> rects(1, img_rect);
+            for (unsigned long l = 1; l < levels; ++l)
+                rects.push_back(rectangle(pyr.rect_down(rects.back())).intersect(img_rect));
+            return rects;
+        }
+
+        template <unsigned int N>
+        std::vector<rectangle> pyramid_level_rects (
+            const pyramid_down<N>& pyr,
+            const rectangle& img_rect,
+            unsigned long levels
+        )
+        {
+            if (N <= 3)
+                return pyramid_level_rects<pyramid_down<N> >(pyr, img_rect, levels);
+
+            // The same sizes pyramid_down<N>::operator() makes.
+            std::vector<rectangle> rects(1, img_rect);
+            for (unsigned long l = 1; l < levels; ++l)
+                rects.push_back(rectangle(((N-1)*rects.back().width())/N, ((N-1)*rects.back().height())/N));
+            return rects;
+        }
+
+        template <typename pyramid_type>
+        dpoint pyramid_point_up (
+            const pyramid_type& pyr,
+            const point& p,
+            const rectangle& ,
+            const rectangle& 
+        )
+        /*!
+            ensures
+                - returns where the pyramid samples the level below to get the pixel p of
+                  a level covering level_rect, given the level below covers below_rect.
+        !*/
+        {
+            return pyr.point_up(p);
+        }
+
+        template <unsigned int N>
+        dpoint pyramid_point_up (
+            const pyramid_down<N>& pyr,
+            const point& p,
+            const rectangle& level_rect,
+            const rectangle& below_rect
+        )
+        {
+            if (N <= 3)
+                return pyr.point_up(p);
+
+            // pyramid_down<N> resizes each level with resize_image().
+            const double x_scale = (below_rect.width()-1)/(double)std::max<long>(level_rect.width()-1,1);
+            const double y_scale = (below_rect.height()-1)/(double)std::max<long>(level_rect.height()-1,1);
+            return dpoint(p.x()*x_scale, p.y()*y_scale);
+        }
+
+        template <typename pyramid_type, typename image_type, typename pixel_type>
+        void pyramid_sample (
+            const pyramid_type& ,
+            const image_type& below,
+            const dpoint& p,
+            pixel_type& out
+        )
+        /*!
+            ensures
+                - #out == the pixel the pyramid makes from the level below at p, which is in
+                  the coordinates of below.
+        !*/
+        {
+            interpolate_bilinear interp;
+            if (!interp(const_image_view<image_type>(below), p, out))
+                assign_pixel(out, 0);
+        }
+
+        template <unsigned int N, typename image_type, typename pixel_type>
+        void pyramid_sample_bytes (
+            const pyramid_down<N>& pyr,
+            const image_type& below,
+            const dpoint& p,
+            pixel_type& out
+        )
+        {
+            if (N <= 3)
+            {
+                pyramid_sample<pyramid_down<N> >(pyr, below, p, out);
+                return;
+            }
+
+            // resize_image() does 8bit images in 8.8 fixed point, see
+            // resize_image_bilinear_bytes().
+            const_image_view<image_type> in(below);
+            const long left = std::min(static_cast<long>(std::floor(p.x())), in.nc()-1);
+            const long top = std::min(static_cast<long>(std::floor(p.y())), in.nr()-1);
+            if (left < 0 || top < 0)
+            {
+                assign_pixel(out, 0);
+                return;
+            }
+            const long right = std::min(left+1, in.nc()-1);
+            const long bottom = std::min(top+1, in.nr()-1);
+            const uint32 fx = static_cast<uint32>((p.x() - left)*256 + 0.5);
+            const uint32 fy = static_cast<uint32>((p.y() - top)*256 + 0.5);
+            const unsigned char* tl = reinterpret_cast<const unsigned char*>(&in[top][left]);
+            const unsigned char* tr = reinterpret_cast<const unsigned char*>(&in[top][right]);
+            const unsigned char* bl = reinterpret_cast<const unsigned char*>(&in[bottom][left]);
+            const unsigned char* br = reinterpret_cast<const unsigned char*>(&in[bottom][right]);
+            unsigned char* dest = reinterpret_cast<unsigned char*>(&out);
+            for (unsigned long k = 0; k < sizeof(pixel_type); ++k)
+            {
+                const uint32 l = static_cast<uint16>(tl[k]*(256-fy) + bl[k]*fy);
+                const uint32 r = static_cast<uint16>(tr[k]*(256-fy) + br[k]*fy);
+                dest[k] = static_cast<unsigned char>((l*(256-fx) + r*fx + (1<<15)) >> 16);
+            }
+        }
+
+        template <unsigned int N, typename image_type>
+        void pyramid_sample (
+            const pyramid_down<N>& pyr,
+            const image_type& below,
+            const dpoint& p,
+            unsigned char& out
+        ) { pyramid_sample_bytes(pyr, below, p, out); }
+
+        template <unsigned int N, typename image_type>
+        void pyramid_sample (
+            const pyramid_down<N>& pyr,
+            const image_type& below,
+            const dpoint& p,
+            rgb_pixel& out
+        ) { pyramid_sample_bytes(pyr, below, p, out); }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type,
+        typename feature_layout_type
+        >
+    template <
+        typename image_type
+        >
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
+    score_window (
+        const image_type& img,
+        const rectangle& rect,
+        const std::vector<const fhog_filterbank*>& w,
+        std::vector<std::pair<double, rectangle> >& scores,
+        const unsigned long search_radius
+    ) const
+    {
+        // make sure requires clause is not broken
+#ifdef ENABLE_ASSERTS
+        for (unsigned long i = 0; i < w.size(); ++i)
+        {
+            DLIB_ASSERT(w[i]->get_num_dimensions() == get_num_dimensions(), 
+                "\t void scan_fhog_pyramid::score_window()"
+                << "\n\t Invalid inputs were given to this function "
+                << "\n\t i: " << i
+                << "\n\t w[i]->get_num_dimensions(): " << w[i]->get_num_dimensions()
+                << "\n\t get_num_dimensions():       " << get_num_dimensions()
+                << "\n\t this: " << this
+                );
+        }
+#endif
+
+        typedef typename image_traits<image_type>::pixel_type pixel_type;
+        pyramid_type pyr;
+
+        unsigned long width, height;
+        compute_fhog_window_size(width,height);
+
+        rectangle mapped_rect, fhog_rect;
+        unsigned long level;
+        get_mapped_rect_and_metadata(max_pyramid_levels, rect, mapped_rect, fhog_rect, level);
+        const point window_center = center(fhog_rect);
+
+        // Find the part of the image at this pyramid level that the features of every
+        // window we look at depend on.  That's the windows plus a few cells around them,
+        // since each HOG cell is normalized by its neighbors.  The patch is clipped to the
+        // level and starts on a cell boundary, so its cells line up with the ones a full
+        // scan of the level computes, and the parts of windows outside the image get the
+        // same zero padding.
+        const rectangle cells = grow_rect(fhog_rect, search_radius);
+        const rectangle pixels = grow_rect(fe.feats_to_image(cells, cell_size, height, width), 3*cell_size);
+        const std::vector<rectangle> pyramid_rects = impl::pyramid_level_rects(pyr, get_rect(img), level+1);
+        const rectangle level_rect = pyramid_rects[level];
+        const long left = std::max(0L, pixels.left())/cell_size*cell_size;
+        const long top  = std::max(0L, pixels.top())/cell_size*cell_size;
+        const rectangle patch_rect = rectangle(left, top, pixels.right(), pixels.bottom()).intersect(level_rect);
+        if (patch_rect.is_empty())
+        {
+            scores.assign(w.size(), std::make_pair(-std::numeric_limits<double>::infinity(), mapped_rect));
+            return;
+        }
+
+        // Build the patch one pyramid level at a time like the pyramid does, but only
+        // for the pixels each level needs from the one below it.
+        std::vector<rectangle> level_rects(level+1);
+        level_rects[level] = patch_rect;
+        for (unsigned long l = level; l > 0; --l)
+        {
+            const rectangle needed(impl::pyramid_point_up(pyr, level_rects[l].tl_corner(), pyramid_rects[l], pyramid_rects[l-1]),
+                                   impl::pyramid_point_up(pyr, level_rects[l].br_corner(), pyramid_rects[l], pyramid_rects[l-1]));
+            level_rects[l-1] = grow_rect(needed, 2).intersect(pyramid_rects[l-1]);
+        }
+        array2d<pixel_type> patch, prev;
+        const_image_view<image_type> in(img);
+        patch.set_size(level_rects[0].height(), level_rects[0].width());
+        for (long r = 0; r < patch.nr(); ++r)
+        {
+            for (long c = 0; c < patch.nc(); ++c)
+                assign_pixel(patch[r][c], in[level_rects[0].top()+r][level_rects[0].left()+c]);
+        }
+        for (unsigned long l = 1; l <= level; ++l)
+        {
+            swap(patch, prev);
+            patch.set_size(level_rects[l].height(), level_rects[l].width());
+            const point prev_origin = level_rects[l-1].tl_corner();
+            for (long r = 0; r < patch.nr(); ++r)
+            {
+                for (long c = 0; c < patch.nc(); ++c)
+                {
+                    const point p = level_rects[l].tl_corner() + point(c,r);
+                    impl::pyramid_sample(pyr, prev, impl::pyramid_point_up(pyr, p, pyramid_rects[l], pyramid_rects[l-1]) - prev_origin, patch[r][c]);
+                }
+            }
+        }
+
+        fhog_image patch_feats;
+        fe(patch, patch_feats, cell_size, height, width);
+
+        // Map the window centers from the feature coordinates of the whole level into the
+        // coordinates of the patch's features.
+        const point center_pixel = center(fe.feats_to_image(rectangle(window_center, window_center), cell_size, height, width));
+        const point offset = window_center - center(fe.image_to_feats(rectangle(center_pixel - patch_rect.tl_corner(),
+                    center_pixel - patch_rect.tl_corner()), cell_size, height, width));
+
+        scores.clear();
+        array2d<float> saliency_image;
+        for (unsigned long i = 0; i < w.size(); ++i)
+        {
+            const rectangle area = impl::apply_filters_to_fhog(*w[i], patch_feats, saliency_image);
+            double best_score = -std::numeric_limits<double>::infinity();
+            point best_center = window_center;
+            const long radius = search_radius;
+            for (long r = -radius; r <= radius; ++r)
+            {
+                for (long c = -radius; c <= radius; ++c)
+                {
+                    const point p = window_center + point(c,r) - offset;
+                    if (area.contains(p) && saliency_image[p.y()][p.x()] > best_score)
+                    {
+                        best_score = saliency_image[p.y()][p.x()];
+                        best_center = window_center + point(c,r);
+                    }
+                }
+            }
+
+            const rectangle best_rect = pyr.rect_up(fe.feats_to_image(centered_rect(best_center, width-2*padding, height-2*padding),
+                    cell_size, height, width), level);
+            scores.push_back(std::make_pair(best_score, best_rect));
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    full_object_detection scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    full_object_detection scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_full_object_detection (
         const rectangle& rect,
         const feature_vector_type& 
@@ -936,9 +2022,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_feature_vector (
         const full_object_detection& obj,
         feature_vector_type& psi
@@ -962,6 +2049,27 @@ namespace dlib
         rectangle mapped_rect;
         unsigned long best_level;
         rectangle fhog_rect;
+        if (quantized_detection)
+        {
+            // Only the quantized levels are kept in this mode
+            get_mapped_rect_and_metadata(quantized_feats.levels.size(), obj.get_rect(), mapped_rect, fhog_rect, best_level);
+            const impl::quantized_fhog_image& level = quantized_feats.levels[best_level];
+            long i = 0;
+            for (unsigned long ii = 0; ii < level.planes.size(); ++ii)
+            {
+                const rectangle rect = get_rect(level.planes[0]);
+                for (long r = fhog_rect.top(); r <= fhog_rect.bottom(); ++r)
+                {
+                    for (long c = fhog_rect.left(); c <= fhog_rect.right(); ++c)
+                    {
+                        if (rect.contains(c,r))
+                            psi(i) += level.planes[ii][r][c]/level.scale;
+                        ++i;
+                    }
+                }
+            }
+            return;
+        }
         get_mapped_rect_and_metadata(feats.size(), obj.get_rect(), mapped_rect, fhog_rect, best_level);
 
 
@@ -985,9 +2093,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    void scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     set_min_pyramid_layer_size (
         unsigned long width,
         unsigned long height 
@@ -1010,9 +2119,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_min_pyramid_layer_width (
     ) const
     {
@@ -1023,9 +2133,10 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::
+    unsigned long scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::
     get_min_pyramid_layer_height (
     ) const
     {
@@ -1037,10 +2148,11 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
     matrix<unsigned char> draw_fhog (
-        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >& detector,
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
         const unsigned long weight_index = 0,
         const long cell_draw_size = 15
     )
@@ -1061,7 +2173,7 @@ namespace dlib
             << "\n\t detector.get_scanner().get_num_dimensions(): " << detector.get_scanner().get_num_dimensions()
             );
 
-        typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::fhog_filterbank fb = detector.get_scanner().build_fhog_filterbank(detector.get_w(weight_index));
+        typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::fhog_filterbank fb = detector.get_scanner().build_fhog_filterbank(detector.get_w(weight_index));
         return draw_fhog(fb.get_filters(),cell_draw_size);
     }
 
@@ -1069,10 +2181,11 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
     unsigned long num_separable_filters (
-        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >& detector,
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
         const unsigned long weight_index = 0
     )
     {
@@ -1090,7 +2203,7 @@ namespace dlib
             << "\n\t detector.get_scanner().get_num_dimensions(): " << detector.get_scanner().get_num_dimensions()
             );
 
-        typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::fhog_filterbank fb = detector.get_scanner().build_fhog_filterbank(detector.get_w(weight_index));
+        typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::fhog_filterbank fb = detector.get_scanner().build_fhog_filterbank(detector.get_w(weight_index));
         return fb.num_separable_filters();
     }
 
@@ -1098,10 +2211,11 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> > threshold_filter_singular_values (
-        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >& detector,
+    object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> > threshold_filter_singular_values (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
         double thresh,
         const unsigned long weight_index = 0
     )
@@ -1155,7 +2269,7 @@ namespace dlib
             detector_weights.push_back(weights);
         }
         
-        return object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >(detector.get_scanner(), 
+        return object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >(detector.get_scanner(), 
                                                                  detector.get_overlap_tester(),
                                                                  detector_weights);
     }
@@ -1165,10 +2279,62 @@ namespace dlib
     template <
         typename Pyramid_type,
         typename feature_extractor_type,
+        typename feature_layout_type
+        >
+    object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> > truncate_separable_filters (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
+        unsigned long max_rank,
+        double thresh = 0
+    )
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(0 <= thresh && thresh <= 1,
+            "\t object_detector truncate_separable_filters()"
+            << "\n\t Invalid inputs were given to this function."
+            << "\n\t thresh: " << thresh 
+        );
+
+        typedef scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> scanner_type;
+        const unsigned long width = detector.get_scanner().get_fhog_window_width();
+        const unsigned long height = detector.get_scanner().get_fhog_window_height();
+        const long size = width*height;
+
+        // Unlike threshold_filter_singular_values() this works on the filter banks the
+        // detector already has, so there is no SVD to redo and it is cheap enough to
+        // call when a detector is loaded.
+        std::vector<processed_weight_vector<scanner_type> > w;
+        for (unsigned long j = 0; j < detector.num_detectors(); ++j)
+        {
+            w.push_back(detector.get_processed_w(j));
+            typename scanner_type::fhog_filterbank& fb = w.back().fb;
+
+            std::vector<unsigned long> ranks(fb.row_filters.size());
+            for (unsigned long i = 0; i < ranks.size(); ++i)
+                ranks[i] = fb.row_filters[i].size();
+
+            fb.truncate_separable_filters(max_rank, thresh);
+
+            // keep get_w() in sync with the filters that changed.
+            for (unsigned long i = 0; i < ranks.size(); ++i)
+            {
+                if (fb.row_filters[i].size() != ranks[i])
+                    set_rowm(w.back().w, range(i*size, (i+1)*size-1)) = reshape_to_column_vector(matrix_cast<double>(fb.filters[i]));
+            }
+        }
+
+        return object_detector<scanner_type>(detector.get_scanner(), detector.get_overlap_tester(), w);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type,
+        typename feature_layout_type,
         typename svm_struct_prob_type
         >
     void configure_nuclear_norm_regularizer (
-        const scan_fhog_pyramid<Pyramid_type,feature_extractor_type>& scanner,
+        const scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>& scanner,
         svm_struct_prob_type& prob
     )
     { 
@@ -1190,17 +2356,18 @@ namespace dlib
 
     template <
         typename Pyramid_type,
-        typename feature_extractor_type
+        typename feature_extractor_type,
+        typename feature_layout_type
         >
-    struct processed_weight_vector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >
+    struct processed_weight_vector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >
     {
         processed_weight_vector(){}
 
         typedef matrix<double,0,1> feature_vector_type;
-        typedef typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type>::fhog_filterbank fhog_filterbank;
+        typedef typename scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>::fhog_filterbank fhog_filterbank;
 
         void init (
-            const scan_fhog_pyramid<Pyramid_type,feature_extractor_type>& scanner
+            const scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type>& scanner
         ) 
         {
             fb = scanner.build_fhog_filterbank(w);
@@ -1291,7 +2458,8 @@ namespace dlib
                 impl::detect_from_fhog_pyramid<pyramid_type>(feats, scanner.get_feature_extractor(),
                     detectors[i].get_processed_w(d).get_detect_argument(), thresh+adjust_threshold,
                     det_box_height, det_box_width, cell_size, max_filter_height,
-                    max_filter_width, temp_dets);
+                    max_filter_width, temp_dets, scanner.get_local_max_detection(),
+                    scanner.get_max_detections());
 
                 for (unsigned long j = 0; j < temp_dets.size(); ++j)
                 {
@@ -1309,12 +2477,16 @@ namespace dlib
         dets.clear();
         if (detectors.size() > 1)
             std::sort(dets_accum.rbegin(), dets_accum.rend());
+        if (dets_accum.size() == 0)
+            return;
+        impl::box_overlap_grid kept(impl::typical_box_width(dets_accum));
         for (unsigned long i = 0; i < dets_accum.size(); ++i)
         {
             const test_box_overlap tester = detectors[dets_accum[i].weight_index].get_overlap_tester();
-            if (impl::overlaps_any_box(tester, dets, dets_accum[i]))
+            if (kept.overlaps_any_box(tester, dets_accum[i].rect, dets_accum[i].weight_index))
                 continue;
 
+            kept.add(dets_accum[i].rect, dets_accum[i].weight_index);
             dets.push_back(dets_accum[i]);
         }
     }
@@ -1340,6 +2512,43 @@ namespace dlib
         return out_dets;
     }
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type,
+        typename feature_layout_type,
+        typename image_type
+        >
+    void score_detection_window (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
+        const image_type& img,
+        const rectangle& rect,
+        std::vector<rect_detection>& scores,
+        const unsigned long search_radius = 0
+    )
+    {
+        typedef scan_fhog_pyramid<Pyramid_type,feature_extractor_type,feature_layout_type> scanner_type;
+        const scanner_type& scanner = detector.get_scanner();
+
+        std::vector<const typename scanner_type::fhog_filterbank*> w;
+        for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+            w.push_back(&detector.get_processed_w(i).get_detect_argument());
+
+        std::vector<std::pair<double, rectangle> > temp;
+        scanner.score_window(img, rect, w, temp, search_radius);
+
+        scores.clear();
+        for (unsigned long i = 0; i < temp.size(); ++i)
+        {
+            rect_detection det;
+            det.detection_confidence = temp[i].first - detector.get_processed_w(i).w(scanner.get_num_dimensions());
+            det.weight_index = i;
+            det.rect = temp[i].second;
+            scores.push_back(det);
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 // ----------------------------------------------------------------------------------------
 
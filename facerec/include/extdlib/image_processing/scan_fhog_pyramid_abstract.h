@@ -85,6 +85,36 @@ namespace dlib
             - returns the updated detector
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename feature_extractor_type
+        >
+    object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> > truncate_separable_filters (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,feature_extractor_type> >& detector,
+        unsigned long max_rank,
+        double thresh = 0
+    );
+    /*!
+        requires
+            - 0 <= thresh <= 1
+        ensures
+            - Returns a copy of detector in which every plane of every filter keeps at
+              most its max_rank largest separable components, and only those whose
+              singular value is at least thresh times the largest one of that plane.
+              The full filters are rebuilt from the components that are left, so the
+              returned detector scores windows the same way whichever filtering method
+              detect() picks, and get_w() is updated to match.
+            - Fewer separable components make detection faster at some cost in
+              accuracy.  So this lets one detector model be tuned to the CPU budget of
+              the device it runs on.  
+            - Unlike threshold_filter_singular_values(), this works on the detector's
+              existing filter banks rather than redoing their SVDs, so it is cheap enough
+              to use at load time.
+            - The returned detector has the default get_max_candidates().
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
     class default_fhog_feature_extractor
@@ -191,11 +221,34 @@ namespace dlib
         feature extractor.
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    struct fhog_planar_layout {};
+    struct fhog_interleaved_layout {};
+    /*!
+        WHAT THESE OBJECTS REPRESENT
+            These are tags that pick how scan_fhog_pyramid stores the HOG features it
+            scores windows against.
+
+            fhog_planar_layout keeps one image per HOG plane, and detect() filters each
+            plane separately, using the separable filters when there are few enough of
+            them.  This is the default.
+
+            fhog_interleaved_layout also stores a copy of each pyramid level with all the
+            planes of a cell next to each other in memory.  detect() then computes every
+            window's score in one pass, summing all the planes of the filter for several
+            windows at a time in SIMD registers, instead of making one pass over the
+            output per plane.  It always uses the full filters, never the separable ones,
+            so it does the most for filter banks that don't separate well.  It also costs
+            the memory for the extra copy of the pyramid.
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
     template <
         typename Pyramid_type,
-        typename Feature_extractor_type = default_fhog_feature_extractor
+        typename Feature_extractor_type = default_fhog_feature_extractor,
+        typename Feature_layout_type = fhog_planar_layout
         >
     class scan_fhog_pyramid : noncopyable
     {
@@ -209,6 +262,11 @@ namespace dlib
                 - Must be a type with an interface compatible with the
                   default_fhog_feature_extractor.
 
+            REQUIREMENTS ON Feature_layout_type
+                - Must be fhog_planar_layout or fhog_interleaved_layout.  When quantized
+                  detection is enabled (see get_quantized_detection()) the quantized
+                  planar features are used regardless of this setting.
+
             INITIAL VALUE
                 - get_padding()   == 1
                 - get_cell_size() == 8
@@ -218,6 +276,9 @@ namespace dlib
                 - get_min_pyramid_layer_width()  == 64
                 - get_min_pyramid_layer_height() == 64
                 - get_nuclear_norm_regularization_strength() == 0
+                - get_quantized_detection() == false
+                - get_local_max_detection() == false
+                - get_max_detections() == std::numeric_limits<unsigned long>::max()
 
             WHAT THIS OBJECT REPRESENTS
                 This object is a tool for running a fixed sized sliding window classifier
@@ -238,12 +299,18 @@ namespace dlib
                 configuration (via copy_configuration()) of a scan_fhog_pyramid object to
                 many other threads.  In this case, it is safe to copy the configuration of
                 a shared object so long as no other operations are performed on it.
+
+                Note that load() keeps the downscaled images of the pyramid levels inside
+                the object and reuses them on the next call, so even an object that is
+                only used to load() images and detect() in them is modified by load().
+                Each thread needs its own scanner.
         !*/
 
     public:
         typedef matrix<double,0,1> feature_vector_type;
         typedef Pyramid_type pyramid_type;
         typedef Feature_extractor_type feature_extractor_type;
+        typedef Feature_layout_type feature_layout_type;
 
         scan_fhog_pyramid (
         );  
@@ -513,6 +580,7 @@ namespace dlib
                     - FB.get_filters() == the values in weights unpacked into get_feature_extractor().get_num_planes() filters.
                     - FB.num_separable_filters() == the number of separable filters necessary to
                       represent all the filters in FB.get_filters().
+                    - FB.quantize_filters() has been called.
         !*/
 
         class fhog_filterbank 
@@ -547,6 +615,17 @@ namespace dlib
                     - returns the number of separable filters necessary to represent all
                       the filters in get_filters().
             !*/
+
+            void quantize_filters(
+            );
+            /*!
+                ensures
+                    - Rounds the filters and their separable components to 16 bit
+                      integers for use by quantized detection (see
+                      get_quantized_detection()).  The scales are chosen so that no
+                      window sum can overflow a 32 bit integer.
+                    - This must be called again if the filters are modified.
+            !*/
         };
 
         void detect (
@@ -574,8 +653,16 @@ namespace dlib
                 - #dets will be sorted in descending order. (i.e.  #dets[i].first >= #dets[j].first for all i, and j>i)
                 - Elements of w beyond index get_num_dimensions()-1 are ignored.  I.e. only the first
                   get_num_dimensions() are used.
-                - Note that no form of non-max suppression is performed.  If a window has a score >= thresh
-                  then it is reported in #dets.
+                - if (get_local_max_detection() == true) then
+                    - Only windows whose score is a local maximum of their pyramid level
+                      are reported.  That is, a window with a score >= thresh is left out
+                      of #dets if one of the 8 windows right next to it in the same pyramid
+                      level has a larger score.
+                - else
+                    - no form of non-max suppression is performed.  If a window has a score
+                      >= thresh then it is reported in #dets.
+                - #dets.size() <= get_max_detections().  When more windows qualify, only
+                  the get_max_detections() highest scoring ones are kept.
         !*/
 
         void detect (
@@ -639,6 +726,52 @@ namespace dlib
                   candidate object location rectangle.
         !*/
 
+        template <
+            typename image_type
+            >
+        void score_window (
+            const image_type& img,
+            const rectangle& rect,
+            const std::vector<const fhog_filterbank*>& w,
+            std::vector<std::pair<double, rectangle> >& scores,
+            const unsigned long search_radius = 0
+        ) const;
+        /*!
+            requires
+                - image_type == is an implementation of array2d/array2d_kernel_abstract.h
+                - img contains some kind of pixel type. 
+                  (i.e. pixel_traits<typename image_type::type> is defined)
+                - for all valid i:
+                    - w[i]->get_num_dimensions() == get_num_dimensions()
+            ensures
+                - Scores the detection window get_best_matching_rect(rect) of img against
+                  each filter bank in w, without loading img or scanning the rest of it.
+                  Only the patch of the window's pyramid level that its features depend on
+                  is built and turned into HOG features, so this costs about as much as the
+                  window is big rather than as much as the image is.  This makes it cheap
+                  to check that an object tracked from an earlier frame is still there.
+                - #scores.size() == w.size()
+                - for all valid i:
+                    - #scores[i].first == the largest score w[i] gives any window of the
+                      same pyramid level whose center is within search_radius HOG cells of
+                      the center of get_best_matching_rect(rect), in both x and y.  If
+                      search_radius == 0 that is just get_best_matching_rect(rect).
+                    - #scores[i].second == that window, mapped to the original image space
+                      like the rectangles output by detect().
+                    - if (none of those windows lie within img) then
+                        - #scores[i].first == -std::numeric_limits<double>::infinity()
+                - The scores are the ones detect() gives the same windows after load(img)
+                  with the float filters, regardless of get_quantized_detection() and
+                  feature_layout_type.  For unsigned char and rgb_pixel images and
+                  pyramid_down<N> they are identical.  For other pyramids and pixel types,
+                  windows above pyramid level 0 are scored on a patch that can differ from
+                  the pyramid's own resampling by rounding, so their scores may differ
+                  slightly.
+                - This object is not modified, so is_loaded_with_image() and whatever image
+                  is loaded stay the same, and it is safe to call this function from
+                  multiple threads at once.
+        !*/
+
         double get_nuclear_norm_regularization_strength (
         ) const;
         /*!
@@ -672,6 +805,72 @@ namespace dlib
                 - #get_nuclear_norm_regularization_strength() == strength
         !*/
 
+        bool get_quantized_detection (
+        ) const;
+        /*!
+            ensures
+                - returns true if detect() scores windows with 16 bit fixed point
+                  features and filters rather than floats.  In that mode load() rounds
+                  each pyramid level to int16 as soon as it is made, scaled so its largest
+                  feature is 4095, and keeps only the int16 levels.  The filter banks'
+                  quantized filters are used.  The scores differ from the float ones only
+                  by rounding error.
+                - In that mode get_feature_vector() adds the int16 features divided by
+                  their scale, which also differ from the float ones by rounding error,
+                  and serialize() saves the object without the loaded image.
+                - This setting is copied by copy_configuration() but is not serialized.
+        !*/
+
+        void set_quantized_detection (
+            bool enabled
+        );
+        /*!
+            ensures
+                - #get_quantized_detection() == enabled
+                - #is_loaded_with_image() == false
+        !*/
+
+        bool get_local_max_detection (
+        ) const;
+        /*!
+            ensures
+                - returns true if detect() only reports windows whose score is a local
+                  maximum of their pyramid level.  The windows next to a local maximum
+                  overlap it almost entirely, so an object_detector's non-max suppression
+                  removes them anyway, but training and test_object_detection_function()
+                  expect every window above the threshold and should leave this off.
+                - This setting is copied by copy_configuration() but is not serialized.
+        !*/
+
+        void set_local_max_detection (
+            bool enabled
+        );
+        /*!
+            ensures
+                - #get_local_max_detection() == enabled
+        !*/
+
+        unsigned long get_max_detections (
+        ) const;
+        /*!
+            ensures
+                - returns the largest number of windows detect() reports for one filter.
+                  The windows are kept in a heap while the pyramid is scanned, so once it
+                  is full the ones scoring below all of them cost no more than the
+                  threshold test.
+                - This setting is copied by copy_configuration() but is not serialized.
+        !*/
+
+        void set_max_detections (
+            unsigned long max_dets
+        );
+        /*!
+            requires
+                - max_dets > 0
+            ensures
+                - #get_max_detections() == max_dets
+        !*/
+
     };
 
 // ----------------------------------------------------------------------------------------
@@ -775,6 +974,44 @@ namespace dlib
               requiring a mutex lock.
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename pyramid_type,
+        typename feature_extractor_type,
+        typename feature_layout_type,
+        typename image_type
+        >
+    void score_detection_window (
+        const object_detector<scan_fhog_pyramid<pyramid_type,feature_extractor_type,feature_layout_type> >& detector,
+        const image_type& img,
+        const rectangle& rect,
+        std::vector<rect_detection>& scores,
+        const unsigned long search_radius = 0
+    );
+    /*!
+        requires
+            - image_type == is an implementation of array2d/array2d_kernel_abstract.h
+            - img contains some kind of pixel type. 
+              (i.e. pixel_traits<typename image_type::type> is defined)
+        ensures
+            - Uses detector.get_scanner().score_window() to score the window of img closest
+              to rect with each of the detector's weight vectors.  This is meant for
+              verifying tracked objects: it tells you how confident the detector is about a
+              single window in a small fraction of the time it takes to run the detector
+              over the whole image.
+            - #scores.size() == detector.num_detectors()
+            - for all valid i:
+                - #scores[i].weight_index == i
+                - #scores[i].rect == the best window found by detector i within
+                  search_radius HOG cells of rect.  See score_window() for details.
+                - #scores[i].detection_confidence == the score of that window minus the
+                  threshold value stored at the end of detector i's weight vector.  That is,
+                  it is on the same scale as the detection_confidence values output by
+                  evaluate_detectors(), and the window would be detected by detector i if
+                  it is >= 0 (and isn't suppressed by an overlapping detection).
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
 }
@@ -12,7 +12,18 @@
 #include "../console_progress_indicator.h"
 #include "../statistics.h"
 #include "../threads.h"
+#include "../simd/cpu_dispatch.h"
+#include "../mapped_file.h"
 #include <utility>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+#include <thread>
 
 namespace dlib
 {
@@ -282,6 +293,284 @@ namespace dlib
             }
         }
 
+        template <typename image_type, typename feature_type>
+        void extract_feature_pixel_values (
+            const image_type& img_,
+            const rectangle& rect,
+            const matrix<float,0,1>& current_shape,
+            const matrix<float,0,1>& reference_shape,
+            const uint32* reference_pixel_anchor_idx,
+            const float* reference_pixel_deltas,
+            unsigned long num_pixels,
+            std::vector<feature_type>& feature_pixel_values
+        )
+        /*!
+            requires
+                - the same as the above version, with reference_pixel_deltas holding the
+                  num_pixels deltas as consecutive x,y pairs.
+            ensures
+                - does the same thing as the above version.
+        !*/
+        {
+            const matrix<float,2,2> tform = matrix_cast<float>(find_tform_between_shapes(reference_shape, current_shape).get_m());
+            const point_transform_affine tform_to_img = unnormalizing_tform(rect);
+
+            const rectangle area = get_rect(img_);
+
+            const_image_view<image_type> img(img_);
+            feature_pixel_values.resize(num_pixels);
+            for (unsigned long i = 0; i < num_pixels; ++i)
+            {
+                const dlib::vector<float,2> delta(reference_pixel_deltas[2*i], reference_pixel_deltas[2*i+1]);
+                point p = tform_to_img(tform*delta + location(current_shape, reference_pixel_anchor_idx[i]));
+                if (area.contains(p))
+                    feature_pixel_values[i] = get_pixel_intensity(img[p.y()][p.x()]);
+                else
+                    feature_pixel_values[i] = 0;
+            }
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        class memory_streambuf : public std::streambuf
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    This is a read only streambuf over a block of memory that is owned by
+                    someone else.  deserialize(shape_predictor) recognizes it and parses the
+                    cascades straight out of the block instead of copying them.
+            !*/
+        public:
+            memory_streambuf (
+                const char* data,
+                size_t size
+            )
+            {
+                char* p = const_cast<char*>(data);
+                setg(p, p, p + size);
+            }
+
+            const char* current (
+            ) const { return gptr(); }
+
+            size_t remaining (
+            ) const { return egptr() - gptr(); }
+
+            void skip (
+                size_t num
+            )
+            {
+                DLIB_ASSERT(num <= remaining(), "");
+                while (num != 0)
+                {
+                    const int step = static_cast<int>(std::min<size_t>(num, std::numeric_limits<int>::max()));
+                    gbump(step);
+                    num -= step;
+                }
+            }
+        };
+
+    // ------------------------------------------------------------------------------------
+
+        inline void deserialize_forests (
+            std::vector<std::vector<regression_tree> >& forests,
+            const char* data,
+            const std::vector<uint64>& sizes
+        )
+        /*!
+            requires
+                - data points to the sizes.size() serialized cascades stored back to back,
+                  where the i-th one is sizes[i] bytes long.
+            ensures
+                - #forests.size() == sizes.size()
+                - deserializes each cascade into #forests.  The cascades are independent so
+                  they are parsed on as many threads as the hardware has.
+        !*/
+        {
+            std::vector<const char*> starts(sizes.size());
+            for (unsigned long i = 0; i < sizes.size(); ++i)
+                starts[i] = i == 0 ? data : starts[i-1] + sizes[i-1];
+            forests.resize(sizes.size());
+
+            std::atomic<unsigned long> next(0);
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            auto parse_cascades = [&]()
+            {
+                for (unsigned long i = next++; i < forests.size(); i = next++)
+                {
+                    try
+                    {
+                        memory_streambuf buf(starts[i], static_cast<size_t>(sizes[i]));
+                        std::istream in(&buf);
+                        dlib::deserialize(forests[i], in);
+                        if (buf.remaining() != 0)
+                            throw serialization_error("Cascade size does not match its data while deserializing dlib::shape_predictor.");
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error)
+                            error = std::current_exception();
+                        next = forests.size();
+                    }
+                }
+            };
+
+            // The calling thread parses cascades too, so if no threads can be started
+            // this still finishes, just serially.
+            const unsigned long num_threads = std::min<unsigned long>(std::max(std::thread::hardware_concurrency(), 1u), forests.size());
+            std::vector<std::thread> threads;
+            try
+            {
+                for (unsigned long i = 1; i < num_threads; ++i)
+                    threads.push_back(std::thread(parse_cascades));
+            }
+            catch (std::system_error&) {}
+            parse_cascades();
+            for (unsigned long i = 0; i < threads.size(); ++i)
+                threads[i].join();
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        struct flat_split
+        {
+            uint32 idx1;
+            uint32 idx2;
+            float thresh;
+        };
+
+        struct flat_shape_predictor_header
+        {
+            char magic[4];
+            uint32 version;
+            uint32 byte_order;
+            uint32 shape_size;
+            uint32 num_cascades;
+            uint32 num_trees;
+            uint32 num_splits;
+            uint32 num_pixels;
+            // Byte offsets of the sections from the start of the header.
+            uint64 initial_shape;
+            uint64 cascade_trees;
+            uint64 tree_splits;
+            uint64 splits;
+            uint64 leaf_values;
+            uint64 cascade_pixels;
+            uint64 anchor_idx;
+            uint64 deltas;
+            uint64 size;
+        };
+
+        const char flat_shape_predictor_magic[4] = { 'D', 'S', 'P', 'F' };
+        const uint32 flat_shape_predictor_version = 1;
+        const uint32 flat_shape_predictor_byte_order = 0x01020304;
+        const uint64 flat_shape_predictor_alignment = 64;
+
+        struct flat_shape_model
+        {
+            /*!
+                WHAT THIS OBJECT REPRESENTS
+                    This points into a shape_predictor stored in the flat format.  All the
+                    trees are laid out one after another: tree t has the splits
+                    splits[tree_splits[t]] through splits[tree_splits[t+1]-1] and its
+                    leaves start at leaf tree_splits[t]+t, each leaf being shape_size
+                    floats of leaf_values.  Cascade c has the trees cascade_trees[c]
+                    through cascade_trees[c+1]-1 and the feature pixels
+                    cascade_pixels[c] through cascade_pixels[c+1]-1.  owner keeps the
+                    memory alive, if the memory needs an owner.
+            !*/
+
+            flat_shape_model (
+            ) : shape_size(0), num_cascades(0), cascade_trees(0), tree_splits(0), splits(0),
+                leaf_values(0), cascade_pixels(0), anchor_idx(0), deltas(0) {}
+
+            unsigned long shape_size;
+            unsigned long num_cascades;
+            const uint32* cascade_trees;
+            const uint32* tree_splits;
+            const flat_split* splits;
+            const float* leaf_values;
+            const uint32* cascade_pixels;
+            const uint32* anchor_idx;
+            const float* deltas;
+            std::shared_ptr<const void> owner;
+        };
+
+        inline unsigned long flat_leaf_index (
+            const flat_shape_model& model,
+            unsigned long tree,
+            const std::vector<float>& feature_pixel_values
+        )
+        /*!
+            ensures
+                - runs through the given tree and returns the index, among all the leaves
+                  of the model, of the leaf we end up in.
+        !*/
+        {
+            const flat_split* splits = model.splits + model.tree_splits[tree];
+            const unsigned long num_splits = model.tree_splits[tree+1] - model.tree_splits[tree];
+            unsigned long i = 0;
+            while (i < num_splits)
+            {
+                if (feature_pixel_values[splits[i].idx1] - feature_pixel_values[splits[i].idx2] > splits[i].thresh)
+                    i = left_child(i);
+                else
+                    i = right_child(i);
+            }
+            return model.tree_splits[tree] + tree + i - num_splits;
+        }
+
+        inline void unflatten_shape_model (
+            const flat_shape_model& model,
+            std::vector<std::vector<regression_tree> >& forests,
+            std::vector<std::vector<unsigned long> >& anchor_idx,
+            std::vector<std::vector<dlib::vector<float,2> > >& deltas
+        )
+        /*!
+            ensures
+                - copies the trees and feature pixels of model out into the representation
+                  shape_predictor uses when it owns its data.
+        !*/
+        {
+            forests.assign(model.num_cascades, std::vector<regression_tree>());
+            anchor_idx.assign(model.num_cascades, std::vector<unsigned long>());
+            deltas.assign(model.num_cascades, std::vector<dlib::vector<float,2> >());
+            for (unsigned long c = 0; c < model.num_cascades; ++c)
+            {
+                for (unsigned long t = model.cascade_trees[c]; t < model.cascade_trees[c+1]; ++t)
+                {
+                    regression_tree tree;
+                    const unsigned long first_leaf = model.tree_splits[t] + t;
+                    for (unsigned long i = model.tree_splits[t]; i < model.tree_splits[t+1]; ++i)
+                    {
+                        split_feature split;
+                        split.idx1 = model.splits[i].idx1;
+                        split.idx2 = model.splits[i].idx2;
+                        split.thresh = model.splits[i].thresh;
+                        tree.splits.push_back(split);
+                    }
+                    tree.leaf_values.resize(tree.splits.size()+1);
+                    for (unsigned long i = 0; i < tree.leaf_values.size(); ++i)
+                    {
+                        tree.leaf_values[i].set_size(model.shape_size);
+                        std::memcpy(&tree.leaf_values[i](0), model.leaf_values + (first_leaf+i)*model.shape_size,
+                                    model.shape_size*sizeof(float));
+                    }
+                    forests[c].push_back(tree);
+                }
+                for (unsigned long i = model.cascade_pixels[c]; i < model.cascade_pixels[c+1]; ++i)
+                {
+                    anchor_idx[c].push_back(model.anchor_idx[i]);
+                    deltas[c].push_back(dlib::vector<float,2>(model.deltas[2*i], model.deltas[2*i+1]));
+                }
+            }
+        }
+
     } // end namespace impl
 
 // ----------------------------------------------------------------------------------------
@@ -330,6 +619,9 @@ namespace dlib
         unsigned long num_features (
         ) const
         {
+            if (flat.leaf_values)
+                return flat.tree_splits[flat.cascade_trees[flat.num_cascades]] + flat.cascade_trees[flat.num_cascades];
+
             unsigned long num = 0;
             for (unsigned long iter = 0; iter < forests.size(); ++iter)
                 for (unsigned long i = 0; i < forests[iter].size(); ++i)
@@ -337,23 +629,57 @@ namespace dlib
             return num;
         }
 
+        unsigned long num_cascades (
+        ) const
+        {
+            return flat.leaf_values ? flat.num_cascades : forests.size();
+        }
+
         template <typename image_type>
         full_object_detection operator()(
             const image_type& img,
             const rectangle& rect
         ) const
+        {
+            return (*this)(img, rect, num_cascades());
+        }
+
+        template <typename image_type>
+        full_object_detection operator()(
+            const image_type& img,
+            const rectangle& rect,
+            unsigned long max_cascades
+        ) const
         {
             using namespace impl;
+            const simd_kernels& kernels = get_simd_kernels();
             matrix<float,0,1> current_shape = initial_shape;
             std::vector<float> feature_pixel_values;
-            for (unsigned long iter = 0; iter < forests.size(); ++iter)
+            for (unsigned long iter = 0; iter < std::min<unsigned long>(flat.num_cascades, max_cascades); ++iter)
+            {
+                // The same as below, but reading the model straight out of the flat
+                // format's memory.
+                const unsigned long first_pixel = flat.cascade_pixels[iter];
+                extract_feature_pixel_values(img, rect, current_shape, initial_shape,
+                                             flat.anchor_idx + first_pixel, flat.deltas + 2*first_pixel,
+                                             flat.cascade_pixels[iter+1] - first_pixel, feature_pixel_values);
+                for (unsigned long i = flat.cascade_trees[iter]; i < flat.cascade_trees[iter+1]; ++i)
+                {
+                    const float* leaf = flat.leaf_values + flat_leaf_index(flat, i, feature_pixel_values)*flat.shape_size;
+                    kernels.add_to(&current_shape(0), leaf, current_shape.size());
+                }
+            }
+            for (unsigned long iter = 0; iter < std::min<unsigned long>(forests.size(), max_cascades); ++iter)
             {
                 extract_feature_pixel_values(img, rect, current_shape, initial_shape,
                                              anchor_idx[iter], deltas[iter], feature_pixel_values);
                 unsigned long leaf_idx;
                 // evaluate all the trees at this level of the cascade.
                 for (unsigned long i = 0; i < forests[iter].size(); ++i)
-                    current_shape += forests[iter][i](feature_pixel_values, leaf_idx);
+                {
+                    const matrix<float,0,1>& leaf = forests[iter][i](feature_pixel_values, leaf_idx);
+                    kernels.add_to(&current_shape(0), &leaf(0), current_shape.size());
+                }
             }
 
             // convert the current_shape into a full_object_detection
@@ -375,6 +701,21 @@ namespace dlib
             using namespace impl;
             matrix<float,0,1> current_shape = initial_shape;
             std::vector<float> feature_pixel_values;
+            for (unsigned long iter = 0; iter < flat.num_cascades; ++iter)
+            {
+                const unsigned long first_pixel = flat.cascade_pixels[iter];
+                extract_feature_pixel_values(img, rect, current_shape, initial_shape,
+                                             flat.anchor_idx + first_pixel, flat.deltas + 2*first_pixel,
+                                             flat.cascade_pixels[iter+1] - first_pixel, feature_pixel_values);
+                for (unsigned long i = flat.cascade_trees[iter]; i < flat.cascade_trees[iter+1]; ++i)
+                {
+                    // Leaves are numbered across the whole model in the flat format, the
+                    // same way feat_offset+leaf_idx numbers them below.
+                    const unsigned long leaf = flat_leaf_index(flat, i, feature_pixel_values);
+                    current_shape += mat(flat.leaf_values + leaf*flat.shape_size, flat.shape_size);
+                    feats.push_back(std::make_pair(leaf, 1));
+                }
+            }
             unsigned long feat_offset = 0;
             for (unsigned long iter = 0; iter < forests.size(); ++iter)
             {
@@ -403,19 +744,65 @@ namespace dlib
 
         friend void deserialize (shape_predictor& item, std::istream& in);
 
+        friend void deserialize (shape_predictor& item, const char* data, size_t size);
+
+        friend void serialize_flat (const shape_predictor& item, std::ostream& out);
+
+        friend void deserialize_flat (shape_predictor& item, const char* data, size_t size,
+                                      const std::shared_ptr<const void>& owner);
+
     private:
         matrix<float,0,1> initial_shape;
         std::vector<std::vector<impl::regression_tree> > forests;
         std::vector<std::vector<unsigned long> > anchor_idx; 
         std::vector<std::vector<dlib::vector<float,2> > > deltas;
+        // When the model lives in flat format memory, forests, anchor_idx and deltas are
+        // empty and this points at it instead.
+        impl::flat_shape_model flat;
     };
 
     inline void serialize (const shape_predictor& item, std::ostream& out)
     {
-        int version = 1;
+        if (item.flat.leaf_values)
+        {
+            // Write a model that lives in flat format memory the same way as any other.
+            shape_predictor temp;
+            temp.initial_shape = item.initial_shape;
+            impl::unflatten_shape_model(item.flat, temp.forests, temp.anchor_idx, temp.deltas);
+            serialize(temp, out);
+            return;
+        }
+
+        // Version 2 is only written to streams that use bulk serialization.  It stores
+        // the byte size of every cascade ahead of the forests so that deserialize() can
+        // find where each cascade starts and parse them all in parallel.
+        int version = bulk_serialization_enabled(out) ? 2 : 1;
         dlib::serialize(version, out);
         dlib::serialize(item.initial_shape, out);
-        dlib::serialize(item.forests, out);
+        if (version == 1)
+        {
+            dlib::serialize(item.forests, out);
+        }
+        else
+        {
+            std::vector<std::string> cascades(item.forests.size());
+            std::vector<uint64> sizes(item.forests.size());
+            for (unsigned long i = 0; i < item.forests.size(); ++i)
+            {
+                std::ostringstream sout;
+                set_bulk_serialization(sout, true);
+                dlib::serialize(item.forests[i], sout);
+                cascades[i] = sout.str();
+                sizes[i] = cascades[i].size();
+            }
+            dlib::serialize(sizes, out);
+            for (unsigned long i = 0; i < cascades.size(); ++i)
+            {
+                const std::streamsize size = static_cast<std::streamsize>(cascades[i].size());
+                if (out.rdbuf()->sputn(cascades[i].data(), size) != size)
+                    throw serialization_error("Error writing a cascade while serializing dlib::shape_predictor.");
+            }
+        }
         dlib::serialize(item.anchor_idx, out);
         dlib::serialize(item.deltas, out);
     }
@@ -424,13 +811,256 @@ namespace dlib
     {
         int version = 0;
         dlib::deserialize(version, in);
-        if (version != 1)
+        if (version != 1 && version != 2)
             throw serialization_error("Unexpected version found while deserializing dlib::shape_predictor.");
+        item.flat = impl::flat_shape_model();
         dlib::deserialize(item.initial_shape, in);
-        dlib::deserialize(item.forests, in);
+        if (version == 1)
+        {
+            dlib::deserialize(item.forests, in);
+        }
+        else
+        {
+            std::vector<uint64> sizes;
+            dlib::deserialize(sizes, in);
+            uint64 total = 0;
+            for (unsigned long i = 0; i < sizes.size(); ++i)
+            {
+                if (sizes[i] > static_cast<uint64>(std::numeric_limits<std::streamsize>::max()) - total)
+                    throw serialization_error("Invalid cascade size found while deserializing dlib::shape_predictor.");
+                total += sizes[i];
+            }
+
+            // Parse straight out of the caller's memory when we can, otherwise read all
+            // the cascades into a buffer with one call first.
+            impl::memory_streambuf* mem = dynamic_cast<impl::memory_streambuf*>(in.rdbuf());
+            if (mem)
+            {
+                if (total > mem->remaining())
+                    throw serialization_error("Unexpected end of data while deserializing dlib::shape_predictor.");
+                impl::deserialize_forests(item.forests, mem->current(), sizes);
+                mem->skip(static_cast<size_t>(total));
+            }
+            else
+            {
+                std::vector<char> data(static_cast<size_t>(total));
+                const std::streamsize size = static_cast<std::streamsize>(total);
+                if (size != 0 && in.rdbuf()->sgetn(&data[0], size) != size)
+                    throw serialization_error("Unexpected end of data while deserializing dlib::shape_predictor.");
+                impl::deserialize_forests(item.forests, data.empty() ? 0 : &data[0], sizes);
+            }
+        }
         dlib::deserialize(item.anchor_idx, in);
         dlib::deserialize(item.deltas, in);
     }
+
+    inline void deserialize (shape_predictor& item, const char* data, size_t size)
+    {
+        impl::memory_streambuf buf(data, size);
+        std::istream in(&buf);
+        deserialize(item, in);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    inline void serialize_flat (const shape_predictor& item, std::ostream& out)
+    {
+        using namespace impl;
+        if (item.flat.leaf_values)
+        {
+            shape_predictor temp;
+            temp.initial_shape = item.initial_shape;
+            unflatten_shape_model(item.flat, temp.forests, temp.anchor_idx, temp.deltas);
+            serialize_flat(temp, out);
+            return;
+        }
+
+        const unsigned long shape_size = item.initial_shape.size();
+        std::vector<uint32> cascade_trees(1, 0), tree_splits(1, 0), cascade_pixels(1, 0);
+        std::vector<flat_split> splits;
+        std::vector<float> leaf_values;
+        std::vector<uint32> anchor_idx;
+        std::vector<float> deltas;
+        for (unsigned long c = 0; c < item.forests.size(); ++c)
+        {
+            for (unsigned long t = 0; t < item.forests[c].size(); ++t)
+            {
+                const regression_tree& tree = item.forests[c][t];
+                for (unsigned long i = 0; i < tree.splits.size(); ++i)
+                {
+                    flat_split split;
+                    split.idx1 = static_cast<uint32>(tree.splits[i].idx1);
+                    split.idx2 = static_cast<uint32>(tree.splits[i].idx2);
+                    split.thresh = tree.splits[i].thresh;
+                    splits.push_back(split);
+                }
+                for (unsigned long i = 0; i < tree.leaf_values.size(); ++i)
+                    leaf_values.insert(leaf_values.end(), tree.leaf_values[i].begin(), tree.leaf_values[i].end());
+                tree_splits.push_back(static_cast<uint32>(splits.size()));
+            }
+            cascade_trees.push_back(static_cast<uint32>(tree_splits.size()-1));
+            for (unsigned long i = 0; i < item.anchor_idx[c].size(); ++i)
+            {
+                anchor_idx.push_back(static_cast<uint32>(item.anchor_idx[c][i]));
+                deltas.push_back(item.deltas[c][i].x());
+                deltas.push_back(item.deltas[c][i].y());
+            }
+            cascade_pixels.push_back(static_cast<uint32>(anchor_idx.size()));
+        }
+
+        flat_shape_predictor_header h;
+        std::memcpy(h.magic, flat_shape_predictor_magic, 4);
+        h.version = flat_shape_predictor_version;
+        h.byte_order = flat_shape_predictor_byte_order;
+        h.shape_size = static_cast<uint32>(shape_size);
+        h.num_cascades = static_cast<uint32>(item.forests.size());
+        h.num_trees = static_cast<uint32>(tree_splits.size()-1);
+        h.num_splits = static_cast<uint32>(splits.size());
+        h.num_pixels = static_cast<uint32>(anchor_idx.size());
+
+        // Lay the sections out one after another, each starting on a cache line.
+        std::vector<char> buf;
+        uint64 pos = sizeof(h);
+        const auto add_section = [&](const void* section, uint64 size) -> uint64
+        {
+            pos = (pos + flat_shape_predictor_alignment - 1)/flat_shape_predictor_alignment*flat_shape_predictor_alignment;
+            buf.resize(static_cast<size_t>(pos + size));
+            if (size != 0)
+                std::memcpy(&buf[static_cast<size_t>(pos)], section, static_cast<size_t>(size));
+            const uint64 offset = pos;
+            pos += size;
+            return offset;
+        };
+        add_section(0, 0);
+        h.initial_shape  = add_section(shape_size ? &item.initial_shape(0) : 0, shape_size*sizeof(float));
+        h.cascade_trees  = add_section(&cascade_trees[0], cascade_trees.size()*sizeof(uint32));
+        h.tree_splits    = add_section(&tree_splits[0], tree_splits.size()*sizeof(uint32));
+        h.splits         = add_section(splits.empty() ? 0 : &splits[0], splits.size()*sizeof(flat_split));
+        h.leaf_values    = add_section(leaf_values.empty() ? 0 : &leaf_values[0], leaf_values.size()*sizeof(float));
+        h.cascade_pixels = add_section(&cascade_pixels[0], cascade_pixels.size()*sizeof(uint32));
+        h.anchor_idx     = add_section(anchor_idx.empty() ? 0 : &anchor_idx[0], anchor_idx.size()*sizeof(uint32));
+        h.deltas         = add_section(deltas.empty() ? 0 : &deltas[0], deltas.size()*sizeof(float));
+        h.size = buf.size();
+        std::memcpy(&buf[0], &h, sizeof(h));
+
+        const std::streamsize size = static_cast<std::streamsize>(buf.size());
+        if (out.rdbuf()->sputn(&buf[0], size) != size)
+            throw serialization_error("Error writing a flat dlib::shape_predictor.");
+    }
+
+    inline bool is_flat_shape_predictor (
+        const char* data,
+        size_t size
+    )
+    {
+        return size >= sizeof(impl::flat_shape_predictor_header) &&
+            std::memcmp(data, impl::flat_shape_predictor_magic, 4) == 0;
+    }
+
+    inline void deserialize_flat (
+        shape_predictor& item,
+        const char* data,
+        size_t size,
+        const std::shared_ptr<const void>& owner = std::shared_ptr<const void>()
+    )
+    {
+        using namespace impl;
+        if (!is_flat_shape_predictor(data, size))
+            throw serialization_error("Data is not a flat dlib::shape_predictor.");
+        if (reinterpret_cast<std::uintptr_t>(data)%sizeof(uint64) != 0)
+            throw serialization_error("A flat dlib::shape_predictor must be 8 byte aligned in memory.");
+
+        flat_shape_predictor_header h;
+        std::memcpy(&h, data, sizeof(h));
+        if (h.version != flat_shape_predictor_version)
+            throw serialization_error("Unexpected version found while reading a flat dlib::shape_predictor.");
+        if (h.byte_order != flat_shape_predictor_byte_order)
+            throw serialization_error("A flat dlib::shape_predictor must be read on a machine with the byte order it was written with.");
+        if (h.size > size)
+            throw serialization_error("Unexpected end of data while reading a flat dlib::shape_predictor.");
+        if (h.shape_size == 0 || h.shape_size%2 != 0)
+            throw serialization_error("Invalid shape size found in a flat dlib::shape_predictor.");
+
+        // Check every section lies inside the data before looking at any of it.
+        const auto section = [&](uint64 offset, uint64 count, uint64 elem_size) -> const char*
+        {
+            if (offset%sizeof(uint32) != 0 || offset > h.size || count > (h.size - offset)/elem_size)
+                throw serialization_error("Invalid section found in a flat dlib::shape_predictor.");
+            return data + offset;
+        };
+        const uint64 num_leaves = static_cast<uint64>(h.num_splits) + h.num_trees;
+        const float* initial_shape  = reinterpret_cast<const float*>(section(h.initial_shape, h.shape_size, sizeof(float)));
+        const uint32* cascade_trees = reinterpret_cast<const uint32*>(section(h.cascade_trees, h.num_cascades+1ULL, sizeof(uint32)));
+        const uint32* tree_splits   = reinterpret_cast<const uint32*>(section(h.tree_splits, h.num_trees+1ULL, sizeof(uint32)));
+        const flat_split* splits    = reinterpret_cast<const flat_split*>(section(h.splits, h.num_splits, sizeof(flat_split)));
+        const float* leaf_values    = reinterpret_cast<const float*>(section(h.leaf_values, num_leaves, h.shape_size*sizeof(float)));
+        const uint32* cascade_pixels = reinterpret_cast<const uint32*>(section(h.cascade_pixels, h.num_cascades+1ULL, sizeof(uint32)));
+        const uint32* anchor_idx    = reinterpret_cast<const uint32*>(section(h.anchor_idx, h.num_pixels, sizeof(uint32)));
+        const float* deltas         = reinterpret_cast<const float*>(section(h.deltas, 2ULL*h.num_pixels, sizeof(float)));
+
+        // Then check the indices in the model so that evaluating it can never read
+        // outside of it.  Only the leaf values, which are most of the model, aren't
+        // touched here.
+        const auto check_offsets = [&](const uint32* offsets, uint32 num, uint32 last)
+        {
+            if (offsets[0] != 0 || offsets[num] != last)
+                throw serialization_error("Invalid index found in a flat dlib::shape_predictor.");
+            for (uint32 i = 0; i < num; ++i)
+            {
+                if (offsets[i] > offsets[i+1])
+                    throw serialization_error("Invalid index found in a flat dlib::shape_predictor.");
+            }
+        };
+        check_offsets(cascade_trees, h.num_cascades, h.num_trees);
+        check_offsets(tree_splits, h.num_trees, h.num_splits);
+        check_offsets(cascade_pixels, h.num_cascades, h.num_pixels);
+        for (uint32 c = 0; c < h.num_cascades; ++c)
+        {
+            const uint32 num_pixels = cascade_pixels[c+1] - cascade_pixels[c];
+            for (uint32 t = cascade_trees[c]; t < cascade_trees[c+1]; ++t)
+            {
+                const uint64 num_leaves_in_tree = tree_splits[t+1] - tree_splits[t] + 1ULL;
+                if ((num_leaves_in_tree & (num_leaves_in_tree-1)) != 0)
+                    throw serialization_error("Invalid tree found in a flat dlib::shape_predictor.");
+                for (uint32 i = tree_splits[t]; i < tree_splits[t+1]; ++i)
+                {
+                    if (splits[i].idx1 >= num_pixels || splits[i].idx2 >= num_pixels)
+                        throw serialization_error("Invalid split found in a flat dlib::shape_predictor.");
+                }
+            }
+        }
+        for (uint32 i = 0; i < h.num_pixels; ++i)
+        {
+            if (anchor_idx[i] >= h.shape_size/2)
+                throw serialization_error("Invalid feature pixel found in a flat dlib::shape_predictor.");
+        }
+
+        item.initial_shape = mat(initial_shape, h.shape_size);
+        item.forests.clear();
+        item.anchor_idx.clear();
+        item.deltas.clear();
+        item.flat.shape_size = h.shape_size;
+        item.flat.num_cascades = h.num_cascades;
+        item.flat.cascade_trees = cascade_trees;
+        item.flat.tree_splits = tree_splits;
+        item.flat.splits = splits;
+        item.flat.leaf_values = leaf_values;
+        item.flat.cascade_pixels = cascade_pixels;
+        item.flat.anchor_idx = anchor_idx;
+        item.flat.deltas = deltas;
+        item.flat.owner = owner;
+    }
+
+    inline void map_flat_shape_predictor (
+        shape_predictor& item,
+        const std::string& filename,
+        unsigned long flags = 0
+    )
+    {
+        std::shared_ptr<mapped_file> file = std::make_shared<mapped_file>(filename, flags);
+        deserialize_flat(item, file->data(), file->size(), file);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     class shape_predictor_trainer
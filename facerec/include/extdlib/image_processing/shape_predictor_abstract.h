@@ -7,6 +7,8 @@
 #include "../matrix.h"
 #include "../geometry.h"
 #include "../pixel.h"
+#include "../mapped_file.h"
+#include <memory>
 
 namespace dlib
 {
@@ -61,6 +63,14 @@ namespace dlib
                   of leaves on each tree.  
         !*/
 
+        unsigned long num_cascades (
+        ) const;
+        /*!
+            ensures
+                - returns the number of cascade levels in this object.  Each level refines
+                  the shape found by the levels before it.
+        !*/
+
         template <typename image_type, typename T, typename U>
         full_object_detection operator()(
             const image_type& img,
@@ -111,12 +121,116 @@ namespace dlib
                   where the 3d argument is discarded.
         !*/
 
+        template <typename image_type>
+        full_object_detection operator()(
+            const image_type& img,
+            const rectangle& rect,
+            unsigned long max_cascades
+        ) const;
+        /*!
+            requires
+                - image_type == an image object that implements the interface defined in
+                  dlib/image_processing/generic_image.h 
+            ensures
+                - Runs the shape prediction algorithm like (*this)(img, rect) but stops
+                  after the first max_cascades levels of the cascade.  This trades accuracy
+                  for time, since the later levels make smaller and smaller corrections to
+                  the shape.  
+                - if (max_cascades >= num_cascades()) then
+                    - returns (*this)(img, rect)
+        !*/
+
     };
 
     void serialize (const shape_predictor& item, std::ostream& out);
     void deserialize (shape_predictor& item, std::istream& in);
     /*!
-        provides serialization support
+        provides serialization support.  If bulk_serialization_enabled(out) then item is
+        written in a newer format that stores the byte size of each cascade ahead of the
+        cascades, and deserialize() parses the cascades of such data on all the
+        available CPU cores.  deserialize() reads both formats.
+    !*/
+
+    void deserialize (shape_predictor& item, const char* data, size_t size);
+    /*!
+        requires
+            - data points to size bytes holding a serialized shape_predictor
+        ensures
+            - performs deserialize(item, in) where in reads from the given block of memory.
+              The cascades are parsed directly out of data rather than copied first.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    void serialize_flat (
+        const shape_predictor& item,
+        std::ostream& out
+    );
+    /*!
+        ensures
+            - writes item to out in the flat format.  This is a single block of memory
+              holding the trees of all the cascades as plain arrays of splits and leaf
+              values, each section aligned to 64 bytes, which a shape_predictor can be
+              evaluated from in place without parsing or copying any of it.
+            - The flat format is written in the byte order of this machine and can only
+              be read on machines with the same byte order.
+    !*/
+
+    bool is_flat_shape_predictor (
+        const char* data,
+        size_t size
+    );
+    /*!
+        ensures
+            - returns true if the size bytes at data start with the header of the flat
+              format and false otherwise.
+    !*/
+
+    void deserialize_flat (
+        shape_predictor& item,
+        const char* data,
+        size_t size,
+        const std::shared_ptr<const void>& owner = std::shared_ptr<const void>()
+    );
+    /*!
+        requires
+            - data is 8 byte aligned and points to size bytes written by serialize_flat().
+            - data stays valid and unchanged for as long as item, or any copy of item,
+              uses it.  owner is kept alive by item and its copies for exactly that
+              long, so if data is owned by owner then nothing else is required.
+        ensures
+            - #item is the shape_predictor held in data and is evaluated directly out of
+              data.  Only the initial shape is copied.
+            - All the indices in data are checked, so a corrupt model can't make item
+              read outside of data, though the leaf values are not looked at.
+            - #item is unchanged if this function throws.
+            - Serializing #item writes the same data as serializing the shape_predictor
+              that was given to serialize_flat().
+        throws
+            - serialization_error
+                This is thrown if data does not hold a valid model in the flat format or
+                isn't suitably aligned.
+    !*/
+
+    void map_flat_shape_predictor (
+        shape_predictor& item,
+        const std::string& filename,
+        unsigned long flags = 0
+    );
+    /*!
+        ensures
+            - maps the given file, written by serialize_flat(), with
+              mapped_file(filename, flags) and performs
+              deserialize_flat(item, data, size, owner) where owner is the mapping.  So
+              every process that maps the same file shares a single copy of the model
+              in physical memory.
+            - flags can be mapped_file::populate and mapped_file::huge_pages, see
+              mapped_file for what they do.
+        throws
+            - mapped_file_error
+                This is thrown if the file can't be mapped.
+            - serialization_error
+                This is thrown if the file doesn't hold a valid model in the flat format.
     !*/
 
 // ----------------------------------------------------------------------------------------
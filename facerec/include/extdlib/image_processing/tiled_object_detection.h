@@ -0,0 +1,691 @@
+#ifndef DLIB_TILED_OBJECT_DETECTION_Hh_
+#define DLIB_TILED_OBJECT_DETECTION_Hh_
+
+#include "tiled_object_detection_abstract.h"
+#include "scan_fhog_pyramid.h"
+#include "object_detector.h"
+#include "box_overlap_testing.h"
+#include "generic_image.h"
+#include "../array2d.h"
+#include "../geometry.h"
+#include "../pixel.h"
+#include "../simd/cpu_dispatch.h"
+#include "../uintn.h"
+#include "../image_transforms/image_pyramid.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        // Tiles are made grayscale if the image is, and RGB otherwise, like the images
+        // the feature extractor is given by scan_fhog_pyramid.
+        template <typename pixel_type, bool grayscale = pixel_traits<pixel_type>::grayscale>
+        struct tile_pixel
+        {
+            typedef pixel_type type;
+            const static long num_channels = 1;
+
+            static void get (const pixel_type& p, float* c) { assign_pixel(c[0], p); }
+            static void set (type& p, const float* c) { assign_pixel(p, c[0]); }
+        };
+
+        template <typename pixel_type>
+        struct tile_pixel<pixel_type,false>
+        {
+            typedef rgb_pixel type;
+            const static long num_channels = 3;
+
+            static void get (const pixel_type& p, float* c)
+            {
+                rgb_pixel temp;
+                assign_pixel(temp, p);
+                c[0] = temp.red;
+                c[1] = temp.green;
+                c[2] = temp.blue;
+            }
+            static void set (type& p, const float* c)
+            {
+                // Truncated, like the levels pyramid_down makes
+                p.red = (unsigned char)c[0];
+                p.green = (unsigned char)c[1];
+                p.blue = (unsigned char)c[2];
+            }
+        };
+
+    // ------------------------------------------------------------------------------------
+
+        struct pyramid_level
+        {
+            // Pixel p of the level is at scale.x()*p.x() + offset.x(), scale.y()*p.y() +
+            // offset.y() in the image.
+            dpoint scale;
+            dpoint offset;
+            long nr;
+            long nc;
+            // If the level is resized from the one before it, pixel p of the level is at
+            // step.x()*p.x(), step.y()*p.y() in that one.
+            bool resized;
+            dpoint step;
+        };
+
+        template <typename pyramid_type>
+        void find_pyramid_levels (
+            const pyramid_type& pyr,
+            long nr,
+            long nc,
+            unsigned long max_levels,
+            unsigned long min_width,
+            unsigned long min_height,
+            std::vector<pyramid_level>& levels
+        )
+        /*!
+            ensures
+                - #levels == the sizes and positions of the levels of the image pyramid
+                  scan_fhog_pyramid would make of an nr by nc image, as given by the
+                  point_up() of pyr.
+        !*/
+        {
+            levels.clear();
+            for (unsigned long l = 0; l < max_levels; ++l)
+            {
+                pyramid_level level;
+                level.offset = pyr.point_up(dpoint(0,0), l);
+                level.scale = (pyr.point_up(dpoint(1000,1000), l) - level.offset)/1000;
+                level.nr = (long)std::floor((nr-1 - level.offset.y())/level.scale.y()) + 1;
+                level.nc = (long)std::floor((nc-1 - level.offset.x())/level.scale.x()) + 1;
+                level.resized = false;
+                if (level.nr <= 0 || level.nc <= 0 || (l != 0 &&
+                    ((unsigned long)level.nc < min_width || (unsigned long)level.nr < min_height)))
+                    break;
+                levels.push_back(level);
+            }
+        }
+
+        template <unsigned int N>
+        void find_pyramid_levels (
+            const pyramid_down<N>& pyr,
+            long nr,
+            long nc,
+            unsigned long max_levels,
+            unsigned long min_width,
+            unsigned long min_height,
+            std::vector<pyramid_level>& levels
+        )
+        {
+            // pyramid_down<2> and pyramid_down<3> filter the image, and their point_up()
+            // follows.  The others resize each level from the one before it, which spreads
+            // the corners of the level over the corners of the one before.
+            if (N <= 3)
+            {
+                find_pyramid_levels<pyramid_down<N> >(pyr, nr, nc, max_levels, min_width, min_height, levels);
+                return;
+            }
+            levels.clear();
+            pyramid_level level;
+            level.scale = dpoint(1,1);
+            level.nr = nr;
+            level.nc = nc;
+            level.resized = false;
+            for (unsigned long l = 0; l < max_levels; ++l)
+            {
+                if (level.nr <= 1 || level.nc <= 1 || (l != 0 &&
+                    ((unsigned long)level.nc < min_width || (unsigned long)level.nr < min_height)))
+                    break;
+                levels.push_back(level);
+                const long down_nr = ((N-1)*level.nr)/N;
+                const long down_nc = ((N-1)*level.nc)/N;
+                level.step = dpoint((level.nc-1)/(double)std::max(down_nc-1, 1L),
+                                    (level.nr-1)/(double)std::max(down_nr-1, 1L));
+                level.scale = dpoint(level.scale.x()*level.step.x(), level.scale.y()*level.step.y());
+                level.nr = down_nr;
+                level.nc = down_nc;
+                level.resized = true;
+            }
+        }
+
+        inline long block_size (
+            const pyramid_level& level
+        )
+        /*!
+            ensures
+                - returns the largest power of two no bigger than the scale of level.
+        !*/
+        {
+            long block = 1;
+            while (2*block <= std::min(level.scale.x(), level.scale.y()))
+                block *= 2;
+            return block;
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        struct detection_tile
+        {
+            // The tile covers rect of the level first, and the parts of the levels up to
+            // last resized from it.
+            unsigned long first;
+            unsigned long last;
+            rectangle rect;
+        };
+
+        inline void add_tiles (
+            unsigned long first,
+            unsigned long last,
+            const pyramid_level& level,
+            long tile_size,
+            long overlap_x,
+            long overlap_y,
+            std::vector<detection_tile>& tiles
+        )
+        /*!
+            ensures
+                - Covers level with tiles of at most tile_size by tile_size pixels, each
+                  overlapping the next by the given overlap, and adds them to tiles.
+        !*/
+        {
+            std::vector<std::pair<long,long> > cols, rows;
+            for (long x = 0;; x += tile_size - overlap_x)
+            {
+                cols.push_back(std::make_pair(x, std::min(x + tile_size, level.nc) - 1));
+                if (x + tile_size >= level.nc)
+                    break;
+            }
+            for (long y = 0;; y += tile_size - overlap_y)
+            {
+                rows.push_back(std::make_pair(y, std::min(y + tile_size, level.nr) - 1));
+                if (y + tile_size >= level.nr)
+                    break;
+            }
+
+            for (unsigned long r = 0; r < rows.size(); ++r)
+            {
+                for (unsigned long c = 0; c < cols.size(); ++c)
+                {
+                    detection_tile t;
+                    t.first = first;
+                    t.last = last;
+                    t.rect = rectangle(cols[c].first, rows[r].first, cols[c].second, rows[r].second);
+                    tiles.push_back(t);
+                }
+            }
+        }
+
+        inline rectangle resized_rect (
+            const rectangle& rect,
+            const pyramid_level& from,
+            const pyramid_level& to,
+            long cell_size
+        )
+        /*!
+            requires
+                - to.resized == true
+                - to is the level after from
+            ensures
+                - returns the part of to that can be resized from the part rect of from.
+                  Its top left corner is on whole cells of to, so windows are found in it
+                  at the same positions as in the whole level.  Sides of rect on the
+                  edges of from stay on the edges of to.
+        !*/
+        {
+            const dpoint& step = to.step;
+            long left = rect.left() == 0 ? 0 : (long)std::ceil(rect.left()/step.x());
+            long top = rect.top() == 0 ? 0 : (long)std::ceil(rect.top()/step.y());
+            left = ((left + cell_size-1)/cell_size)*cell_size;
+            top = ((top + cell_size-1)/cell_size)*cell_size;
+            const long right = rect.right() == from.nc-1 ? to.nc-1 : (long)std::ceil(rect.right()/step.x()) - 1;
+            const long bottom = rect.bottom() == from.nr-1 ? to.nr-1 : (long)std::ceil(rect.bottom()/step.y()) - 1;
+            return rectangle(left, top, right, bottom);
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <
+            typename scanner_type,
+            typename pixel_type
+            >
+        struct tile_scratch
+        {
+            /*
+                Everything one thread needs to detect objects in tiles.  None of it
+                depends on the size of the image, so a thread that goes from tile to tile
+                keeps reusing the same memory.
+            */
+            typedef tile_pixel<pixel_type> channels;
+            typedef typename channels::type tile_pixel_type;
+
+            scanner_type scanner;
+            // The image under a tile averaged over blocks of a power of two pixels, and
+            // the tile at each level it covers, made one from the other.
+            array2d<tile_pixel_type> blocks;
+            array2d<tile_pixel_type> images[2];
+            std::vector<float> sums;
+            std::vector<unsigned short> row;
+            std::vector<long> col_idx, row_idx;
+            std::vector<float> col_frac, row_frac;
+            std::vector<std::pair<double, rectangle> > dets;
+            std::vector<rect_detection> found;
+            std::exception_ptr error;
+        };
+
+        inline void sample_positions (
+            double scale,
+            double offset,
+            long first,
+            long num,
+            long start,
+            long block_size,
+            long size,
+            std::vector<long>& idx,
+            std::vector<float>& frac
+        )
+        /*!
+            ensures
+                - Finds, for the num pixels of an image starting at first, the two pixels
+                  of another image of size pixels to interpolate between and the weight of
+                  the second one.  Pixel x of the first image is at scale*x + offset in the
+                  image both are taken from, and pixel i of the other one covers the
+                  block_size pixels of that image from start + i*block_size on.  Positions
+                  past the first or last pixel are clamped to it.
+        !*/
+        {
+            idx.resize(num);
+            frac.resize(num);
+            for (long i = 0; i < num; ++i)
+            {
+                const double p = scale*(first + i) + offset;
+                double u = (p - start - (block_size-1)/2.0)/block_size;
+                u = std::max(0.0, std::min(u, size-1.0));
+                idx[i] = std::max(std::min((long)u, size-2), 0L);
+                frac[i] = u - idx[i];
+            }
+        }
+
+        template <typename scratch_type, typename pixel_type>
+        bool interpolate_bytes (
+            const array2d<pixel_type>& ,
+            array2d<pixel_type>& ,
+            scratch_type& 
+        ) { return false; }
+
+        template <long channels, typename scratch_type, typename pixel_type>
+        bool interpolate_bytes_impl (
+            const array2d<pixel_type>& in,
+            array2d<pixel_type>& out,
+            scratch_type& s
+        )
+        {
+            // The 8.8 fixed point arithmetic resize_image() uses for these pixels, so the
+            // levels resized here come out the same as those pyramid_down makes.
+            const simd_kernels& kernels = get_simd_kernels();
+            const long right = in.nc() > 1 ? channels : 0;
+            const long down = in.nr() > 1 ? 1 : 0;
+            s.row.resize(in.nc()*channels);
+            for (long r = 0; r < out.nr(); ++r)
+            {
+                const long top = s.row_idx[r];
+                kernels.blend_rows((const unsigned char*)&in[top][0], (const unsigned char*)&in[top + down][0],
+                                   &s.row[0], s.row.size(), static_cast<int>(s.row_frac[r]*256 + 0.5f));
+
+                unsigned char* o = (unsigned char*)&out[r][0];
+                for (long c = 0; c < out.nc(); ++c)
+                {
+                    const unsigned short* tl = &s.row[s.col_idx[c]*channels];
+                    const uint32 f = static_cast<uint32>(s.col_frac[c]*256 + 0.5f);
+                    for (long k = 0; k < channels; ++k)
+                        *o++ = static_cast<unsigned char>((tl[k]*(256-f) + tl[k+right]*f + (1<<15)) >> 16);
+                }
+            }
+            return true;
+        }
+
+        template <typename scratch_type>
+        bool interpolate_bytes (
+            const array2d<unsigned char>& in,
+            array2d<unsigned char>& out,
+            scratch_type& s
+        ) { return interpolate_bytes_impl<1>(in, out, s); }
+
+        template <typename scratch_type>
+        bool interpolate_bytes (
+            const array2d<rgb_pixel>& in,
+            array2d<rgb_pixel>& out,
+            scratch_type& s
+        ) 
+        { 
+            COMPILE_TIME_ASSERT(sizeof(rgb_pixel) == 3);
+            return interpolate_bytes_impl<3>(in, out, s); 
+        }
+
+        template <typename scratch_type>
+        void interpolate (
+            const array2d<typename scratch_type::tile_pixel_type>& in,
+            array2d<typename scratch_type::tile_pixel_type>& out,
+            scratch_type& s
+        )
+        /*!
+            requires
+                - s.row_idx, s.row_frac, s.col_idx and s.col_frac say where the pixels of out
+                  are in in, as made by sample_positions().
+            ensures
+                - Fills out by interpolating bilinearly between the pixels of in.
+        !*/
+        {
+            typedef typename scratch_type::channels channels;
+            typedef typename scratch_type::tile_pixel_type tile_pixel_type;
+            const long nc = channels::num_channels;
+            out.set_size(s.row_idx.size(), s.col_idx.size());
+            if (interpolate_bytes(in, out, s))
+                return;
+
+            const long right = in.nc() > 1 ? 1 : 0;
+            const long down = in.nr() > 1 ? 1 : 0;
+            float tl[3], tr[3], bl[3], br[3], c[3];
+            for (long r = 0; r < out.nr(); ++r)
+            {
+                const float fy = s.row_frac[r];
+                const tile_pixel_type* top = &in[s.row_idx[r]][0];
+                const tile_pixel_type* bottom = &in[s.row_idx[r] + down][0];
+                for (long col = 0; col < out.nc(); ++col)
+                {
+                    const float fx = s.col_frac[col];
+                    const long x = s.col_idx[col];
+                    channels::get(top[x], tl);
+                    channels::get(top[x+right], tr);
+                    channels::get(bottom[x], bl);
+                    channels::get(bottom[x+right], br);
+                    for (long k = 0; k < nc; ++k)
+                    {
+                        const float t = tl[k] + fx*(tr[k] - tl[k]);
+                        const float b = bl[k] + fx*(br[k] - bl[k]);
+                        c[k] = t + fy*(b - t);
+                    }
+                    channels::set(out[r][col], c);
+                }
+            }
+        }
+
+        template <
+            typename image_type,
+            typename scratch_type
+            >
+        void sample_level (
+            const image_type& img_,
+            const pyramid_level& level,
+            const rectangle& rect,
+            array2d<typename scratch_type::tile_pixel_type>& out,
+            scratch_type& s
+        )
+        /*!
+            ensures
+                - #out == the part rect of the given pyramid level of img_.  The image is
+                  first averaged over square blocks of block_size(level) pixels, and out
+                  interpolated bilinearly from that.  So only the part of img_ under rect
+                  is looked at, and the blocks are fewer than twice the pixels of rect
+                  across.
+                - The first level is copied as it is.
+        !*/
+        {
+            typedef typename scratch_type::channels channels;
+            const long nc = channels::num_channels;
+            const_image_view<image_type> img(img_);
+            const dpoint& scale = level.scale;
+            const dpoint& offset = level.offset;
+
+            if (scale == dpoint(1,1) && offset == dpoint(0,0))
+            {
+                out.set_size(rect.height(), rect.width());
+                for (long r = 0; r < out.nr(); ++r)
+                {
+                    for (long c = 0; c < out.nc(); ++c)
+                        assign_pixel(out[r][c], img[rect.top() + r][rect.left() + c]);
+                }
+                return;
+            }
+
+            // The part of the image under rect, with a block of room on each side for the
+            // interpolation.
+            const long block = block_size(level);
+            const rectangle area = rectangle(
+                (long)std::floor(scale.x()*rect.left() + offset.x()) - block,
+                (long)std::floor(scale.y()*rect.top() + offset.y()) - block,
+                (long)std::ceil(scale.x()*rect.right() + offset.x()) + block,
+                (long)std::ceil(scale.y()*rect.bottom() + offset.y()) + block
+            ).intersect(get_rect(img));
+            const long area_nc = area.width();
+            const long area_nr = area.height();
+
+            s.blocks.set_size(std::max<long>((area_nr + block-1)/block, 1), std::max<long>((area_nc + block-1)/block, 1));
+            float c[3];
+            for (long br = 0; br < s.blocks.nr(); ++br)
+            {
+                s.sums.assign(s.blocks.nc()*nc, 0);
+                const long top = area.top() + br*block;
+                const long bottom = std::min(top + block, area.top() + area_nr);
+                for (long r = top; r < bottom; ++r)
+                {
+                    float* o = &s.sums[0];
+                    for (long col = area.left(); col <= area.right(); col += block, o += nc)
+                    {
+                        const long end = std::min(col + block, area.right() + 1);
+                        for (long x = col; x < end; ++x)
+                        {
+                            channels::get(img[r][x], c);
+                            for (long k = 0; k < nc; ++k)
+                                o[k] += c[k];
+                        }
+                    }
+                }
+                for (long bc = 0; bc < s.blocks.nc(); ++bc)
+                {
+                    // Only the blocks in the last row and column can be partly outside area
+                    const long w = std::min(block, area_nc - bc*block);
+                    const float n = std::max(w*(bottom - top), 1L);
+                    for (long k = 0; k < nc; ++k)
+                        c[k] = s.sums[bc*nc + k]/n;
+                    channels::set(s.blocks[br][bc], c);
+                }
+            }
+
+            sample_positions(scale.x(), offset.x(), rect.left(), rect.width(), area.left(), block, s.blocks.nc(), s.col_idx, s.col_frac);
+            sample_positions(scale.y(), offset.y(), rect.top(), rect.height(), area.top(), block, s.blocks.nr(), s.row_idx, s.row_frac);
+            interpolate(s.blocks, out, s);
+        }
+
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename Feature_extractor_type,
+        typename Feature_layout_type,
+        typename image_type
+        >
+    void detect_objects_in_tiles (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,Feature_extractor_type,Feature_layout_type> >& detector,
+        const image_type& img,
+        std::vector<rect_detection>& dets,
+        unsigned long tile_size = 1024,
+        unsigned long num_threads = 0,
+        const double adjust_threshold = 0
+    )
+    {
+        typedef scan_fhog_pyramid<Pyramid_type,Feature_extractor_type,Feature_layout_type> scanner_type;
+        typedef typename image_traits<image_type>::pixel_type pixel_type;
+        typedef impl::tile_scratch<scanner_type,pixel_type> scratch_type;
+
+        DLIB_CASSERT(detector.num_detectors() > 0,
+            "\t void detect_objects_in_tiles()"
+            << "\n\t You can't detect objects with an empty object_detector."
+        );
+
+        dets.clear();
+        const scanner_type& scanner = detector.get_scanner();
+        const Pyramid_type pyr;
+        std::vector<impl::pyramid_level> levels;
+        impl::find_pyramid_levels(pyr, num_rows(img), num_columns(img), scanner.get_max_pyramid_levels(),
+            scanner.get_min_pyramid_layer_width(), scanner.get_min_pyramid_layer_height(), levels);
+
+        // Levels resized one from the other with the same block size are done together:
+        // a tile of the first is sampled from the image, and the rest are resized from it
+        // the way the pyramid makes them.  So the image is only read once for each group.
+        std::vector<std::pair<unsigned long,unsigned long> > groups;
+        dpoint spread(1,1);
+        for (unsigned long l = 0; l < levels.size(); ++l)
+        {
+            if (l == 0 || !levels[l].resized || impl::block_size(levels[l]) != impl::block_size(levels[l-1]))
+                groups.push_back(std::make_pair(l, l));
+            groups.back().second = l;
+            const impl::pyramid_level& first = levels[groups.back().first];
+            spread = dpoint(std::max(spread.x(), levels[l].scale.x()/first.scale.x()),
+                            std::max(spread.y(), levels[l].scale.y()/first.scale.y()));
+        }
+
+        // The features of a cell depend on the pixels of the cells around it, and the
+        // filters reach past the window by the padding, so windows at least margin
+        // pixels inside a tile score the same as they would in the whole level.  Tiles
+        // overlap enough for every window of every level of a group to be that far inside
+        // one of them.
+        const long cell_size = scanner.get_cell_size();
+        const long margin = (scanner.get_padding() + 2)*cell_size;
+        const long reach_x = scanner.get_detection_window_width() + 2*margin + 2*cell_size + 1;
+        const long reach_y = scanner.get_detection_window_height() + 2*margin + 2*cell_size + 1;
+        const long overlap_x = ((long)std::ceil(spread.x()*reach_x)/cell_size + 1)*cell_size;
+        const long overlap_y = ((long)std::ceil(spread.y()*reach_y)/cell_size + 1)*cell_size;
+        // Tiles start on whole cells, so they share the cell grid of the level
+        const long size = ((std::max<long>(tile_size, 2*std::max(overlap_x, overlap_y)) + cell_size-1)/cell_size)*cell_size;
+
+        std::vector<impl::detection_tile> tiles;
+        for (unsigned long i = 0; i < groups.size(); ++i)
+            impl::add_tiles(groups[i].first, groups[i].second, levels[groups[i].first], size, overlap_x, overlap_y, tiles);
+
+        if (num_threads == 0)
+            num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        num_threads = std::max<unsigned long>(std::min<unsigned long>(num_threads, tiles.size()), 1);
+
+        std::vector<scratch_type> scratch(num_threads);
+        std::atomic<unsigned long> next(0);
+        auto work = [&](scratch_type& s) {
+            try
+            {
+                s.scanner.copy_configuration(scanner);
+                s.scanner.set_max_pyramid_levels(1);
+                const long far = std::numeric_limits<long>::max()/2;
+                for (unsigned long i = next++; i < tiles.size(); i = next++)
+                {
+                    const impl::detection_tile& t = tiles[i];
+                    rectangle rect = t.rect;
+                    unsigned long cur = 0;
+                    impl::sample_level(img, levels[t.first], rect, s.images[cur], s);
+                    for (unsigned long l = t.first;;)
+                    {
+                        // Windows past the edges of the level are kept by the tiles along
+                        // them, and the others by the tile they are well inside of.
+                        const impl::pyramid_level& level = levels[l];
+                        const rectangle keep(
+                            rect.left() == 0 ? -far : rect.left() + margin,
+                            rect.top() == 0 ? -far : rect.top() + margin,
+                            rect.right() == level.nc-1 ? far : rect.right() - margin,
+                            rect.bottom() == level.nr-1 ? far : rect.bottom() - margin);
+
+                        s.scanner.load(s.images[cur]);
+                        for (unsigned long j = 0; j < detector.num_detectors(); ++j)
+                        {
+                            const double thresh = detector.get_processed_w(j).w(s.scanner.get_num_dimensions());
+                            s.scanner.detect(detector.get_processed_w(j).get_detect_argument(), s.dets, thresh + adjust_threshold);
+                            for (unsigned long k = 0; k < s.dets.size(); ++k)
+                            {
+                                const rectangle window = translate_rect(s.dets[k].second, rect.tl_corner());
+                                if (!keep.contains(window))
+                                    continue;
+                                rect_detection temp;
+                                temp.detection_confidence = s.dets[k].first - thresh;
+                                temp.weight_index = j;
+                                temp.rect = pyr.rect_up(window, l);
+                                s.found.push_back(temp);
+                            }
+                        }
+
+                        if (l == t.last)
+                            break;
+                        const rectangle down = impl::resized_rect(rect, level, levels[l+1], cell_size);
+                        if (down.is_empty())
+                            break;
+                        impl::sample_positions(levels[l+1].step.x(), 0, down.left(), down.width(), rect.left(), 1, rect.width(), s.col_idx, s.col_frac);
+                        impl::sample_positions(levels[l+1].step.y(), 0, down.top(), down.height(), rect.top(), 1, rect.height(), s.row_idx, s.row_frac);
+                        impl::interpolate(s.images[cur], s.images[1-cur], s);
+                        cur = 1-cur;
+                        rect = down;
+                        ++l;
+                    }
+                }
+            }
+            catch (...)
+            {
+                // Leave the rest of the tiles to the other threads
+                s.error = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned long i = 1; i < num_threads; ++i)
+        {
+            try
+            {
+                threads.push_back(std::thread(work, std::ref(scratch[i])));
+            }
+            catch (std::system_error&)
+            {
+                // The tiles are handed out as threads ask for them, so the threads there
+                // are just do more of them.
+                break;
+            }
+        }
+        work(scratch[0]);
+        for (unsigned long i = 0; i < threads.size(); ++i)
+            threads[i].join();
+
+        std::vector<rect_detection> dets_accum;
+        for (unsigned long i = 0; i < scratch.size(); ++i)
+        {
+            if (scratch[i].error)
+                std::rethrow_exception(scratch[i].error);
+            dets_accum.insert(dets_accum.end(), scratch[i].found.begin(), scratch[i].found.end());
+        }
+
+        // Non-max suppression over the windows of all the tiles, the way object_detector
+        // does it over the windows of a whole image.
+        std::sort(dets_accum.rbegin(), dets_accum.rend());
+        if (dets_accum.size() > detector.get_max_candidates())
+            dets_accum.resize(detector.get_max_candidates());
+        if (dets_accum.size() == 0)
+            return;
+        impl::box_overlap_grid kept(impl::typical_box_width(dets_accum));
+        for (unsigned long i = 0; i < dets_accum.size(); ++i)
+        {
+            if (kept.overlaps_any_box(detector.get_overlap_tester(), dets_accum[i].rect))
+                continue;
+
+            kept.add(dets_accum[i].rect);
+            dets.push_back(dets_accum[i]);
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_TILED_OBJECT_DETECTION_Hh_
+
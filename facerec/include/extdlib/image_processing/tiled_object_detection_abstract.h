@@ -0,0 +1,71 @@
+#undef DLIB_TILED_OBJECT_DETECTION_ABSTRACT_Hh_
+#ifdef DLIB_TILED_OBJECT_DETECTION_ABSTRACT_Hh_
+
+#include "scan_fhog_pyramid_abstract.h"
+#include "object_detector_abstract.h"
+#include <vector>
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    template <
+        typename Pyramid_type,
+        typename Feature_extractor_type,
+        typename Feature_layout_type,
+        typename image_type
+        >
+    void detect_objects_in_tiles (
+        const object_detector<scan_fhog_pyramid<Pyramid_type,Feature_extractor_type,Feature_layout_type> >& detector,
+        const image_type& img,
+        std::vector<rect_detection>& dets,
+        unsigned long tile_size = 1024,
+        unsigned long num_threads = 0,
+        const double adjust_threshold = 0
+    );
+    /*!
+        requires
+            - detector.num_detectors() > 0
+            - image_type == an image object that implements the interface defined in
+              dlib/image_processing/generic_image.h
+        ensures
+            - Finds the objects in img the way detector(img, dets, adjust_threshold) would,
+              but with memory use that doesn't grow with the size of img.  This is meant
+              for still images of many megapixels, where the FHOG pyramid of the whole
+              image made by scan_fhog_pyramid::load() takes hundreds of megabytes.
+            - Each level of the image pyramid is cut into overlapping tiles of about
+              tile_size by tile_size pixels, made one at a time straight from img, so
+              neither the levels nor their FHOG features ever exist as a whole.  The tiles
+              overlap by a detection window plus the padding and the cells the features
+              of a window depend on, so every window is scored within a tile exactly as
+              it would be within its whole level.  Non-max suppression is then done over
+              the windows of all the tiles together, with detector.get_overlap_tester()
+              and detector.get_max_candidates(), so objects on the edges between tiles are
+              found once.
+            - The tiles are shared out between num_threads threads, counting the calling
+              one.  If num_threads == 0 then one thread per CPU core is used.  Each
+              thread reuses its own tile, feature and scratch buffers for all the tiles it
+              does, so the memory used is about num_threads times that of running
+              detector on one tile_size by tile_size image.
+            - #dets == the objects found, sorted from the most to the least confident,
+              with their detection_confidence and weight_index set as by
+              object_detector::operator().
+            - The levels are grouped into octaves.  Within a tile, each level after the
+              first of its octave is made from the one before it exactly as
+              detector.get_scanner()'s pyramid_type makes it, and the first level of each
+              octave is made by averaging img over blocks of a power of two pixels and
+              interpolating between the blocks, at the same scale and position.  So the
+              first octave is scored exactly as by detector(img), while the windows of
+              smaller levels differ slightly, and objects very close to the detection
+              threshold may be found by one and not the other.
+            - tile_size is raised as needed to at least twice the overlap between tiles,
+              so that most of each tile is its own.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_TILED_OBJECT_DETECTION_ABSTRACT_Hh_
+
@@ -13,6 +13,8 @@
 #include "interpolation.h"
 #include "../simd/simd4i.h"
 #include "../simd/simd4f.h"
+#include "../simd/cpu_dispatch.h"
+#include <vector>
 
 namespace dlib
 {
@@ -376,9 +378,188 @@ namespace dlib
 
             len = (grad_x*grad_x + grad_y*grad_y);
         }
+
+        // ------------------------------------------------------------------------------------
+
+        /*
+            get_gradient_row() computes the gradients of the num pixels img[r][c] through
+            img[r][c+num-1] in one go.  8bit grayscale and rgb_pixel images have contiguous
+            rows of bytes, so they are handed to the runtime dispatched kernels in
+            simd/cpu_dispatch.h.  Any other pixel type goes through get_gradient().
+        */
+
+        template <typename image_type, typename pixel_type>
+        inline void get_gradient_row (
+            int r,
+            int c,
+            long num,
+            const image_type& img,
+            float* grad_x,
+            float* grad_y,
+            float* len,
+            const pixel_type*
+        )
+        {
+            matrix<float,2,1> grad;
+            for (long i = 0; i < num; ++i)
+            {
+                get_gradient(r, c+i, img, grad, len[i]);
+                grad_x[i] = grad(0);
+                grad_y[i] = grad(1);
+            }
+        }
+
+        template <typename image_type>
+        inline void get_gradient_row (
+            int r,
+            int c,
+            long num,
+            const image_type& img,
+            float* grad_x,
+            float* grad_y,
+            float* len,
+            const unsigned char*
+        )
+        {
+            get_simd_kernels().fhog_gradient_gray(&img[r-1][c], &img[r][c], &img[r+1][c], grad_x, grad_y, len, num);
+        }
+
+        template <typename image_type>
+        inline void get_gradient_row (
+            int r,
+            int c,
+            long num,
+            const image_type& img,
+            float* grad_x,
+            float* grad_y,
+            float* len,
+            const rgb_pixel*
+        )
+        {
+            COMPILE_TIME_ASSERT(sizeof(rgb_pixel) == 3);
+            get_simd_kernels().fhog_gradient_rgb((const unsigned char*)&img[r-1][c],
+                                                 (const unsigned char*)&img[r][c],
+                                                 (const unsigned char*)&img[r+1][c],
+                                                 grad_x, grad_y, len, num);
+        }
+
+        template <typename image_type>
+        inline void get_gradient_row (
+            int r,
+            int c,
+            long num,
+            const image_type& img,
+            float* grad_x,
+            float* grad_y,
+            float* len
+        )
+        {
+            get_gradient_row(r, c, num, img, grad_x, grad_y, len, (const typename image_type::pixel_type*)0);
+        }
         
         // ------------------------------------------------------------------------------------
 
+        template <typename pixel_type>
+        struct has_byte_gradients
+        {
+            // True if every gradient component of an image with this pixel type is an
+            // integer in the range [-255, 255].
+            const static bool value = sizeof(typename pixel_traits<pixel_type>::basic_pixel_type) == 1 &&
+                                      pixel_traits<pixel_type>::is_unsigned;
+        };
+
+        class orientation_table
+        {
+            /*
+                For images with byte gradients there are only 511*511 possible gradient
+                vectors, so instead of taking the dot product of each gradient with all 9
+                orientation directions we look up which of the 18 orientations it snaps to.
+                The table is filled in with the same dot products the direct computation
+                uses, so the two agree.
+            */
+        public:
+            explicit orientation_table (
+                const matrix<float,2,1> (&directions)[9]
+            ) : bins(511*511)
+            {
+                for (int o = 0; o < 9; ++o)
+                    dirs[o] = directions[o];
+
+                for (int gy = -255; gy <= 255; ++gy)
+                {
+                    for (int gx = -255; gx <= 255; ++gx)
+                    {
+                        float best_dot = 0;
+                        int best_o = 0;
+                        for (int o = 0; o < 9; o++) 
+                        {
+                            const float dot = directions[o](0)*gx + directions[o](1)*gy;
+                            if (dot > best_dot) 
+                            {
+                                best_dot = dot;
+                                best_o = o;
+                            } 
+                            else if (-dot > best_dot) 
+                            {
+                                best_dot = -dot;
+                                best_o = o+9;
+                            }
+                        }
+                        bins[(gy+255)*511 + gx+255] = best_o;
+                    }
+                }
+            }
+
+            int operator() (
+                int gx,
+                int gy
+            ) const { return bins[(gy+255)*511 + gx+255]; }
+
+            void operator() (
+                const simd8f& grad_x,
+                const simd8f& grad_y,
+                int32* best_o
+            ) const
+            {
+                int32 idx[8];
+                (simd8i(grad_y)*511 + simd8i(grad_x) + (255*511+255)).store(idx);
+                for (int i = 0; i < 8; ++i)
+                    best_o[i] = bins[idx[i]];
+            }
+
+            bool has_directions (
+                const matrix<float,2,1> (&directions)[9]
+            ) const
+            {
+                for (int o = 0; o < 9; ++o)
+                {
+                    if (dirs[o] != directions[o])
+                        return false;
+                }
+                return true;
+            }
+
+        private:
+            std::vector<unsigned char> bins;
+            matrix<float,2,1> dirs[9];
+        };
+
+        inline const orientation_table& get_orientation_table (
+            const matrix<float,2,1> (&directions)[9]
+        )
+        {
+            // There is one table, built from the directions of the first call.  Every
+            // caller uses the same 9 FHOG directions, so that is all it needs.
+            static const orientation_table table(directions);
+            DLIB_ASSERT(table.has_directions(directions),
+                "\t const orientation_table& get_orientation_table()"
+                << "\n\t The orientation table was built for different directions."
+                );
+            return table;
+        }
+
+        // ------------------------------------------------------------------------------------
+
         template <typename T, typename mm1, typename mm2>
         inline void set_hog (
             dlib::array<array2d<T,mm1>,mm2>& hog,
@@ -532,6 +713,11 @@ namespace dlib
             directions[7] = -0.7660, 0.6428;
             directions[8] = -0.9397, 0.3420;
 
+            // 8bit images can look their orientations up rather than compute them.
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            const orientation_table* table = 0;
+            if (has_byte_gradients<pixel_type>::value)
+                table = &get_orientation_table(directions);
 
 
             if (img.nr() <= 2 || img.nc() <= 2)
@@ -557,36 +743,51 @@ namespace dlib
             const int visible_nr = img.nr()-1;
             const int visible_nc = img.nc()-1;
 
+            // The gradients of the current row, computed all at once.
+            std::vector<float> row_grad_x(img.nc()), row_grad_y(img.nc()), row_len(img.nc());
+
             // First populate the gradient histograms
             for (int y = 1; y < visible_nr; y++) 
             {
+                get_gradient_row(y, 1, visible_nc-1, img, &row_grad_x[1], &row_grad_y[1], &row_len[1]);
+
                 int x;
                 for (x = 1; x < visible_nc - 7; x += 8)
                 {
                     // v will be the length of the gradient vectors.
                     simd8f grad_x, grad_y, v;
-                    get_gradient(y, x, img, grad_x, grad_y, v);
+                    grad_x.load(&row_grad_x[x]);
+                    grad_y.load(&row_grad_y[x]);
+                    v.load(&row_len[x]);
 
                     float _vv[8];
                     v.store(_vv);
 
                     // Now snap the gradient to one of 18 orientations
-                    simd8f best_dot = 0;
-                    simd8f best_o = 0;
-                    for (int o = 0; o < 9; o++)
+                    int32 _best_o[8];
+                    if (table)
                     {
-                        simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
-                        simd8f_bool cmp = dot>best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        dot *= -1;
-                        best_o = select(cmp, o, best_o);
-
-                        cmp = dot > best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        best_o = select(cmp, o + 9, best_o);
+                        (*table)(grad_x, grad_y, _best_o);
+                    }
+                    else
+                    {
+                        simd8f best_dot = 0;
+                        simd8f best_o = 0;
+                        for (int o = 0; o < 9; o++)
+                        {
+                            simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
+                            simd8f_bool cmp = dot>best_dot;
+                            best_dot = select(cmp, dot, best_dot);
+                            dot *= -1;
+                            best_o = select(cmp, o, best_o);
+
+                            cmp = dot > best_dot;
+                            best_dot = select(cmp, dot, best_dot);
+                            best_o = select(cmp, o + 9, best_o);
+                        }
+                        simd8i(best_o).store(_best_o);
                     }
 
-                    int32 _best_o[8]; simd8i(best_o).store(_best_o);
 
                     norm[y][x + 0] = _vv[0];
                     norm[y][x + 1] = _vv[1];
@@ -610,24 +811,31 @@ namespace dlib
                 for (; x < visible_nc; x++) 
                 {
                     matrix<float,2,1> grad;
-                    float v;
-                    get_gradient(y,x,img,grad,v);
+                    grad = row_grad_x[x], row_grad_y[x];
+                    float v = row_len[x];
 
                     // snap to one of 18 orientations
-                    float best_dot = 0;
                     int best_o = 0;
-                    for (int o = 0; o < 9; o++) 
+                    if (table)
                     {
-                        const float dot = dlib::dot(directions[o], grad);
-                        if (dot > best_dot) 
-                        {
-                            best_dot = dot;
-                            best_o = o;
-                        } 
-                        else if (-dot > best_dot) 
+                        best_o = (*table)((int)grad(0), (int)grad(1));
+                    }
+                    else
+                    {
+                        float best_dot = 0;
+                        for (int o = 0; o < 9; o++) 
                         {
-                            best_dot = -dot;
-                            best_o = o+9;
+                            const float dot = dlib::dot(directions[o], grad);
+                            if (dot > best_dot) 
+                            {
+                                best_dot = dot;
+                                best_o = o;
+                            } 
+                            else if (-dot > best_dot) 
+                            {
+                                best_dot = -dot;
+                                best_o = o+9;
+                            }
                         }
                     }
 
@@ -775,6 +983,11 @@ namespace dlib
             directions[7] = -0.7660, 0.6428;
             directions[8] = -0.9397, 0.3420;
 
+            // 8bit images can look their orientations up rather than compute them.
+            typedef typename image_traits<image_type>::pixel_type pixel_type;
+            const orientation_table* table = 0;
+            if (has_byte_gradients<pixel_type>::value)
+                table = &get_orientation_table(directions);
 
 
             // First we allocate memory for caching orientation histograms & their norms.
@@ -818,6 +1031,9 @@ namespace dlib
             const int visible_nr = std::min((long)cells_nr*cell_size,img.nr())-1;
             const int visible_nc = std::min((long)cells_nc*cell_size,img.nc())-1;
 
+            // The gradients of the current row, computed all at once.
+            std::vector<float> row_grad_x(img.nc()), row_grad_y(img.nc()), row_len(img.nc());
+
             // First populate the gradient histograms
             for (int y = 1; y < visible_nr; y++) 
             {
@@ -825,13 +1041,17 @@ namespace dlib
                 const int iyp = (int)std::floor(yp);
                 const float vy0 = yp - iyp;
                 const float vy1 = 1.0 - vy0;
+                if (visible_nc > 1)
+                    get_gradient_row(y, 1, visible_nc-1, img, &row_grad_x[1], &row_grad_y[1], &row_len[1]);
                 int x;
                 for (x = 1; x < visible_nc - 7; x += 8)
                 {
                     simd8f xx(x, x + 1, x + 2, x + 3, x + 4, x + 5, x + 6, x + 7);
                     // v will be the length of the gradient vectors.
                     simd8f grad_x, grad_y, v;
-                    get_gradient(y, x, img, grad_x, grad_y, v);
+                    grad_x.load(&row_grad_x[x]);
+                    grad_y.load(&row_grad_y[x]);
+                    v.load(&row_len[x]);
 
                     // We will use bilinear interpolation to add into the histogram bins.
                     // So first we precompute the values needed to determine how much each
@@ -844,19 +1064,28 @@ namespace dlib
                     v = sqrt(v);
 
                     // Now snap the gradient to one of 18 orientations
-                    simd8f best_dot = 0;
-                    simd8f best_o = 0;
-                    for (int o = 0; o < 9; o++)
+                    int32 _best_o[8];
+                    if (table)
                     {
-                        simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
-                        simd8f_bool cmp = dot>best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        dot *= -1;
-                        best_o = select(cmp, o, best_o);
-
-                        cmp = dot > best_dot;
-                        best_dot = select(cmp, dot, best_dot);
-                        best_o = select(cmp, o + 9, best_o);
+                        (*table)(grad_x, grad_y, _best_o);
+                    }
+                    else
+                    {
+                        simd8f best_dot = 0;
+                        simd8f best_o = 0;
+                        for (int o = 0; o < 9; o++)
+                        {
+                            simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
+                            simd8f_bool cmp = dot>best_dot;
+                            best_dot = select(cmp, dot, best_dot);
+                            dot *= -1;
+                            best_o = select(cmp, o, best_o);
+
+                            cmp = dot > best_dot;
+                            best_dot = select(cmp, dot, best_dot);
+                            best_o = select(cmp, o + 9, best_o);
+                        }
+                        simd8i(best_o).store(_best_o);
                     }
 
 
@@ -870,7 +1099,6 @@ namespace dlib
                     simd8f v10 = vy1*vx0;
                     simd8f v00 = vy0*vx0;
 
-                    int32 _best_o[8]; simd8i(best_o).store(_best_o);
                     int32 _ixp[8];    ixp.store(_ixp);
                     float _v11[8];    v11.store(_v11);
                     float _v01[8];    v01.store(_v01);
@@ -921,24 +1149,31 @@ namespace dlib
                 for (; x < visible_nc; x++) 
                 {
                     matrix<float, 2, 1> grad;
-                    float v;
-                    get_gradient(y,x,img,grad,v);
+                    grad = row_grad_x[x], row_grad_y[x];
+                    float v = row_len[x];
 
                     // snap to one of 18 orientations
-                    float best_dot = 0;
                     int best_o = 0;
-                    for (int o = 0; o < 9; o++) 
+                    if (table)
                     {
-                        const float dot = dlib::dot(directions[o], grad);
-                        if (dot > best_dot) 
-                        {
-                            best_dot = dot;
-                            best_o = o;
-                        } 
-                        else if (-dot > best_dot) 
+                        best_o = (*table)((int)grad(0), (int)grad(1));
+                    }
+                    else
+                    {
+                        float best_dot = 0;
+                        for (int o = 0; o < 9; o++) 
                         {
-                            best_dot = -dot;
-                            best_o = o+9;
+                            const float dot = dlib::dot(directions[o], grad);
+                            if (dot > best_dot) 
+                            {
+                                best_dot = dot;
+                                best_o = o;
+                            } 
+                            else if (-dot > best_dot) 
+                            {
+                                best_dot = -dot;
+                                best_o = o+9;
+                            }
                         }
                     }
 
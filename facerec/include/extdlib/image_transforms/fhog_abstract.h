@@ -70,6 +70,11 @@ namespace dlib
             - for all valid r and c:
                 - #hog[r][c] == the FHOG vector describing the cell centered at the pixel location 
                   fhog_to_image(point(c,r),cell_size,filter_rows_padding,filter_cols_padding) in img.
+            - If the pixels of img are 8bit, e.g. unsigned char or rgb_pixel, the
+              orientation bin of each gradient is looked up in a table instead of being
+              computed with 9 dot products.  The features are the same either way.  Only
+              the binning is done this way: the gradients, their magnitudes and the votes
+              into the cells are computed in floating point for every pixel type.
     !*/
 
 // ----------------------------------------------------------------------------------------
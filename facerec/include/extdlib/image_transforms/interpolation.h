@@ -9,6 +9,8 @@
 #include "assign_image.h"
 #include "image_pyramid.h"
 #include "../simd.h"
+#include "../simd/cpu_dispatch.h"
+#include <vector>
 #include "../image_processing/full_object_detection.h"
 
 namespace dlib
@@ -760,6 +762,91 @@ namespace dlib
 
 // ----------------------------------------------------------------------------------------
 
+    namespace impl
+    {
+        /*
+            Bilinear resizing of 8bit grayscale and rgb_pixel images in 8.8 fixed point,
+            done one axis at a time.  Each output row first blends the two input rows it
+            falls between, using the runtime dispatched blend_rows() kernel from
+            simd/cpu_dispatch.h, and then interpolates along that row.  The result is
+            rounded to the nearest level and the interpolation weights are quantized to
+            1/256, so this stays within 1.5 levels of the exact value.  The floating point
+            version truncates instead, so the two can differ by two grey levels.
+
+            These functions return false when the pixel type isn't one of the two they
+            know about.
+        */
+
+        template <typename in_image_type, typename out_image_type, typename pixel_type>
+        bool resize_image_bilinear_bytes (
+            const in_image_type& ,
+            out_image_type& ,
+            const pixel_type*
+        ) { return false; }
+
+        template <long channels, typename in_image_type, typename out_image_type>
+        bool resize_image_bilinear_bytes_impl (
+            const in_image_type& in_img,
+            out_image_type& out_img
+        )
+        {
+            const simd_kernels& kernels = get_simd_kernels();
+            const double x_scale = (in_img.nc()-1)/(double)std::max<long>((out_img.nc()-1),1);
+            const double y_scale = (in_img.nr()-1)/(double)std::max<long>((out_img.nr()-1),1);
+
+            // where each output column lands in the input rows
+            std::vector<long> left(out_img.nc()), right(out_img.nc());
+            std::vector<uint32> lr_frac(out_img.nc());
+            for (long c = 0; c < out_img.nc(); ++c)
+            {
+                const double x = c*x_scale;
+                const long l = std::min(static_cast<long>(std::floor(x)), in_img.nc()-1);
+                left[c] = l*channels;
+                right[c] = std::min(l+1, in_img.nc()-1)*channels;
+                lr_frac[c] = static_cast<uint32>((x - l)*256 + 0.5);
+            }
+
+            std::vector<uint16> row(in_img.nc()*channels);
+            for (long r = 0; r < out_img.nr(); ++r)
+            {
+                const double y = r*y_scale;
+                const long top    = std::min(static_cast<long>(std::floor(y)), in_img.nr()-1);
+                const long bottom = std::min(top+1, in_img.nr()-1);
+                kernels.blend_rows((const unsigned char*)&in_img[top][0], (const unsigned char*)&in_img[bottom][0],
+                                   &row[0], row.size(), static_cast<int>((y - top)*256 + 0.5));
+
+                unsigned char* out = (unsigned char*)&out_img[r][0];
+                for (long c = 0; c < out_img.nc(); ++c)
+                {
+                    const uint16* tl = &row[left[c]];
+                    const uint16* tr = &row[right[c]];
+                    const uint32 f = lr_frac[c];
+                    for (long k = 0; k < channels; ++k)
+                        *out++ = static_cast<unsigned char>((tl[k]*(256-f) + tr[k]*f + (1<<15)) >> 16);
+                }
+            }
+            return true;
+        }
+
+        template <typename in_image_type, typename out_image_type>
+        bool resize_image_bilinear_bytes (
+            const in_image_type& in_img,
+            out_image_type& out_img,
+            const unsigned char*
+        ) { return resize_image_bilinear_bytes_impl<1>(in_img, out_img); }
+
+        template <typename in_image_type, typename out_image_type>
+        bool resize_image_bilinear_bytes (
+            const in_image_type& in_img,
+            out_image_type& out_img,
+            const rgb_pixel*
+        ) 
+        { 
+            COMPILE_TIME_ASSERT(sizeof(rgb_pixel) == 3);
+            return resize_image_bilinear_bytes_impl<3>(in_img, out_img); 
+        }
+    }
+
     template <
         typename image_type
         >
@@ -786,6 +873,9 @@ namespace dlib
         }
 
         typedef typename image_traits<image_type>::pixel_type T;
+        if (impl::resize_image_bilinear_bytes(in_img, out_img, (const T*)0))
+            return;
+
         const double x_scale = (in_img.nc()-1)/(double)std::max<long>((out_img.nc()-1),1);
         const double y_scale = (in_img.nr()-1)/(double)std::max<long>((out_img.nr()-1),1);
         double y = -y_scale;
@@ -887,8 +977,10 @@ namespace dlib
             return;
         }
 
-
         typedef typename image_traits<image_type>::pixel_type T;
+        if (impl::resize_image_bilinear_bytes(in_img, out_img, (const T*)0))
+            return;
+
         const double x_scale = (in_img.nc()-1)/(double)std::max<long>((out_img.nc()-1),1);
         const double y_scale = (in_img.nr()-1)/(double)std::max<long>((out_img.nr()-1),1);
         double y = -y_scale;
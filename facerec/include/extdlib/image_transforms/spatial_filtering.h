@@ -11,7 +11,9 @@
 #include "../matrix.h"
 #include "../geometry/border_enumerator.h"
 #include "../simd.h"
+#include "../simd/cpu_dispatch.h"
 #include <limits>
+#include <vector>
 #include "assign_image.h"
 
 namespace dlib
@@ -549,6 +551,15 @@ namespace dlib
                                   is_same_type<typename EXP2::type,float>::value;
     };
 
+// ----------------------------------------------------------------------------------------
+
+    struct separable_filter_buffers
+    {
+        std::vector<float> row_filter;
+        std::vector<float> col_filter;
+        std::vector<const float*> rows;
+    };
+
 // ----------------------------------------------------------------------------------------
 
     // This overload is optimized to use SIMD instructions when filtering float images with
@@ -565,6 +576,7 @@ namespace dlib
         const matrix_exp<EXP1>& _row_filter,
         const matrix_exp<EXP2>& _col_filter,
         out_image_type& scratch_,
+        separable_filter_buffers& buffers,
         bool add_to = false
     )
     {
@@ -616,105 +628,59 @@ namespace dlib
         image_view<out_image_type> scratch(scratch_);
         scratch.set_size(in_img.nr(), in_img.nc());
 
+        // The inner loops are done by whichever kernels the CPU we are running on can
+        // execute fastest.  See simd/cpu_dispatch.h.
+        const simd_kernels& kernels = get_simd_kernels();
+        std::vector<float>& rfilter = buffers.row_filter;
+        std::vector<float>& cfilter = buffers.col_filter;
+        rfilter.assign(row_filter.begin(), row_filter.end());
+        cfilter.assign(col_filter.begin(), col_filter.end());
+
         // apply the row filter
-        for (long r = 0; r < in_img.nr(); ++r)
+        if (last_col > first_col)
         {
-            long c = first_col;
-            for (; c < last_col-7; c+=8)
-            {
-                simd8f p,p2,p3, temp = 0, temp2=0, temp3=0;
-                long n = 0;
-                for (; n < row_filter.size()-2; n+=3)
-                {
-                    // pull out the current pixel and put it into p
-                    p.load(&in_img[r][c-first_col+n]);
-                    p2.load(&in_img[r][c-first_col+n+1]);
-                    p3.load(&in_img[r][c-first_col+n+2]);
-                    temp += p*row_filter(n);
-                    temp2 += p2*row_filter(n+1);
-                    temp3 += p3*row_filter(n+2);
-                }
-                for (; n < row_filter.size(); ++n)
-                {
-                    // pull out the current pixel and put it into p
-                    p.load(&in_img[r][c-first_col+n]);
-                    temp += p*row_filter(n);
-                }
-                temp += temp2 + temp3;
-                temp.store(&scratch[r][c]);
-            }
-            for (; c < last_col; ++c)
+            for (long r = 0; r < in_img.nr(); ++r)
             {
-                float p;
-                float temp = 0;
-                for (long n = 0; n < row_filter.size(); ++n)
-                {
-                    // pull out the current pixel and put it into p
-                    p = in_img[r][c-first_col+n];
-                    temp += p*row_filter(n);
-                }
-                scratch[r][c] = temp;
+                kernels.float_row_filter(&in_img[r][0], &scratch[r][first_col], last_col-first_col,
+                                         &rfilter[0], rfilter.size());
             }
         }
 
         // apply the column filter 
-        for (long r = first_row; r < last_row; ++r)
+        if (last_col > first_col)
         {
-            long c = first_col;
-            for (; c < last_col-7; c+=8)
-            {
-                simd8f p, p2, p3, temp = 0, temp2 = 0, temp3 = 0;
-                long m = 0;
-                for (; m < col_filter.size()-2; m+=3)
-                {
-                    p.load(&scratch[r-first_row+m][c]);
-                    p2.load(&scratch[r-first_row+m+1][c]);
-                    p3.load(&scratch[r-first_row+m+2][c]);
-                    temp += p*col_filter(m);
-                    temp2 += p2*col_filter(m+1);
-                    temp3 += p3*col_filter(m+2);
-                }
-                for (; m < col_filter.size(); ++m)
-                {
-                    p.load(&scratch[r-first_row+m][c]);
-                    temp += p*col_filter(m);
-                }
-                temp += temp2+temp3;
-
-                // save this pixel to the output image
-                if (add_to == false)
-                {
-                    temp.store(&out_img[r][c]);
-                }
-                else
-                {
-                    p.load(&out_img[r][c]);
-                    temp += p;
-                    temp.store(&out_img[r][c]);
-                }
-            }
-            for (; c < last_col; ++c)
+            std::vector<const float*>& rows = buffers.rows;
+            rows.resize(cfilter.size());
+            for (long r = first_row; r < last_row; ++r)
             {
-                float temp = 0;
-                for (long m = 0; m < col_filter.size(); ++m)
-                {
-                    temp += scratch[r-first_row+m][c]*col_filter(m);
-                }
-
-                // save this pixel to the output image
-                if (add_to == false)
-                {
-                    out_img[r][c] = temp;
-                }
-                else
-                {
-                    out_img[r][c] += temp;
-                }
+                for (unsigned long m = 0; m < rows.size(); ++m)
+                    rows[m] = &scratch[r-first_row+m][first_col];
+                kernels.float_col_filter(&rows[0], &out_img[r][first_col], last_col-first_col,
+                                         &cfilter[0], cfilter.size(), add_to);
             }
         }
         return non_border;
     }
 
+    template <
+        typename in_image_type,
+        typename out_image_type,
+        typename EXP1,
+        typename EXP2
+        >
+    rectangle float_spatially_filter_image_separable (
+        const in_image_type& in_img,
+        out_image_type& out_img,
+        const matrix_exp<EXP1>& row_filter,
+        const matrix_exp<EXP2>& col_filter,
+        out_image_type& scratch,
+        bool add_to = false
+    )
+    {
+        separable_filter_buffers buffers;
+        return float_spatially_filter_image_separable(in_img, out_img, row_filter, col_filter, scratch, buffers, add_to);
+    }
+
 // ----------------------------------------------------------------------------------------
 
     template <
@@ -182,6 +182,48 @@ namespace dlib
               allocated and freed for each call.
     !*/
 
+// ----------------------------------------------------------------------------------------
+
+    struct separable_filter_buffers
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object holds the copies of the filters and the table of row pointers
+                float_spatially_filter_image_separable() works with, so that they can be
+                reused between calls along with the scratch image.
+        !*/
+
+        std::vector<float> row_filter;
+        std::vector<float> col_filter;
+        std::vector<const float*> rows;
+    };
+
+    template <
+        typename in_image_type,
+        typename out_image_type,
+        typename EXP1,
+        typename EXP2
+        >
+    rectangle float_spatially_filter_image_separable (
+        const in_image_type& in_img,
+        out_image_type& out_img,
+        const matrix_exp<EXP1>& row_filter,
+        const matrix_exp<EXP2>& col_filter,
+        out_image_type& scratch,
+        separable_filter_buffers& buffers,
+        bool add_to = false
+    );
+    /*!
+        requires
+            - the same as for the float_spatially_filter_image_separable() above.
+        ensures
+            - This function is identical to the above float_spatially_filter_image_separable()
+              except that it keeps its working buffers in buffers instead of allocating
+              them for each call.  So a loop that applies many filters, like the one over
+              the separable filters of an FHOG detector, allocates nothing once the
+              buffers have grown to fit.
+    !*/
+
 // ----------------------------------------------------------------------------------------
 
     template <
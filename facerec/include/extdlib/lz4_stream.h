@@ -0,0 +1,8 @@
+#ifndef DLIB_LZ4_STReAMh_
+#define DLIB_LZ4_STReAMh_
+
+#include "lz4_stream/lz4_stream.h"
+
+
+#endif // DLIB_LZ4_STReAMh_
+
@@ -0,0 +1,294 @@
+#ifndef DLIB_LZ4_STReAM_Hh_
+#define DLIB_LZ4_STReAM_Hh_
+
+#include "lz4_stream_abstract.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "../algs.h"
+#include "../noncopyable.h"
+#include "../serialize.h"
+#include "../string.h"
+#include "../uintn.h"
+#include "../lz4.h"
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    namespace lz4_stream_impl
+    {
+        const char magic[4] = { 'D', 'L', 'Z', '4' };
+        const int version = 1;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    inline void compress_lz4_stream (
+        const char* data,
+        size_t size,
+        std::ostream& out,
+        unsigned long block_size = 1024*1024
+    )
+    {
+        // make sure requires clause is not broken
+        DLIB_ASSERT(0 < block_size && block_size <= DMLZ4_MAX_OUTPUT_SIZE,
+            "\t void compress_lz4_stream()"
+            << "\n\t Invalid block size."
+            << "\n\t block_size: " << block_size
+            );
+
+        const uint64 total = size;
+        const unsigned long num_blocks = static_cast<unsigned long>((total + block_size - 1)/block_size);
+
+        int max_compressed = 0;
+        if (dmLZ4::MaxCompressedSize(static_cast<int>(block_size), &max_compressed) != dmLZ4::RESULT_OK)
+            throw serialization_error("Invalid block size given to compress_lz4_stream().");
+
+        std::vector<uint32> compressed_sizes(num_blocks);
+        std::vector<char> compressed;
+        std::vector<char> buf(max_compressed);
+        for (unsigned long i = 0; i < num_blocks; ++i)
+        {
+            const uint64 start = static_cast<uint64>(i)*block_size;
+            const uint32 num = static_cast<uint32>(std::min<uint64>(block_size, total - start));
+            int csize = 0;
+            if (dmLZ4::CompressBuffer(data + start, num, &buf[0], &csize) != dmLZ4::RESULT_OK)
+                throw serialization_error("Error compressing a block of an lz4 stream.");
+            compressed_sizes[i] = static_cast<uint32>(csize);
+            compressed.insert(compressed.end(), buf.begin(), buf.begin() + csize);
+        }
+
+        if (out.rdbuf()->sputn(lz4_stream_impl::magic, 4) != 4)
+            throw serialization_error("Error writing lz4 stream header.");
+        serialize(lz4_stream_impl::version, out);
+        serialize(block_size, out);
+        serialize(total, out);
+        serialize(compressed_sizes, out);
+        const std::streamsize csize = static_cast<std::streamsize>(compressed.size());
+        if (csize != 0 && out.rdbuf()->sputn(&compressed[0], csize) != csize)
+            throw serialization_error("Error writing lz4 stream blocks.");
+    }
+
+    inline bool is_lz4_stream (
+        const char* data,
+        size_t size
+    )
+    {
+        return size >= 4 && std::memcmp(data, lz4_stream_impl::magic, 4) == 0;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    class lz4_istreambuf : public std::streambuf, noncopyable
+    {
+    public:
+
+        lz4_istreambuf (
+            const char* data,
+            size_t size,
+            unsigned long num_threads = 0
+        ) :
+            block_size(0),
+            total(0),
+            num_blocks(0),
+            read_block(-1),
+            next_block(0),
+            stop(false)
+        {
+            if (!is_lz4_stream(data, size))
+                throw serialization_error("Data is not an lz4 stream.");
+
+            // Parse the header through our own get area, then leave it empty so the
+            // first read decompresses block 0.
+            char* p = const_cast<char*>(data);
+            setg(p, p + 4, p + size);
+            std::istream in(this);
+            int ver = 0;
+            deserialize(ver, in);
+            if (ver != lz4_stream_impl::version)
+                throw serialization_error("Unexpected version found while reading an lz4 stream.");
+            deserialize(block_size, in);
+            deserialize(total, in);
+            std::vector<uint32> compressed_sizes;
+            deserialize(compressed_sizes, in);
+            const char* blocks = gptr();
+            setg(0, 0, 0);
+
+            if (block_size == 0 || block_size > DMLZ4_MAX_OUTPUT_SIZE)
+                throw serialization_error("Invalid block size found in an lz4 stream.");
+            num_blocks = static_cast<long>((total + block_size - 1)/block_size);
+            if (compressed_sizes.size() != static_cast<unsigned long>(num_blocks))
+                throw serialization_error("Block index does not match the size of an lz4 stream.");
+
+            block_starts.resize(num_blocks);
+            block_sizes.assign(compressed_sizes.begin(), compressed_sizes.end());
+            size_t remaining = size - (blocks - data);
+            for (long i = 0; i < num_blocks; ++i)
+            {
+                if (compressed_sizes[i] > remaining)
+                    throw serialization_error("Unexpected end of data in an lz4 stream.");
+                block_starts[i] = blocks;
+                blocks += compressed_sizes[i];
+                remaining -= compressed_sizes[i];
+            }
+
+            if (num_threads == 0)
+                num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+            num_threads = std::min<unsigned long>(num_threads, std::max<long>(num_blocks, 1));
+
+            // Each thread can have a block in flight while the reader holds another and
+            // the next one is waiting for it.
+            const unsigned long num_slots = num_threads + 2;
+            slots.resize(num_slots);
+            slot_blocks.assign(num_slots, -1);
+            for (unsigned long i = 0; i < num_slots; ++i)
+                slots[i].resize(static_cast<size_t>(std::min<uint64>(block_size, total)));
+
+            try
+            {
+                for (unsigned long i = 0; i < num_threads; ++i)
+                    threads.push_back(std::thread(&lz4_istreambuf::decompress_blocks, this));
+            }
+            catch (std::system_error&) {}
+        }
+
+        ~lz4_istreambuf (
+        )
+        {
+            {
+                std::lock_guard<std::mutex> lock(m);
+                stop = true;
+            }
+            slot_freed.notify_all();
+            for (unsigned long i = 0; i < threads.size(); ++i)
+                threads[i].join();
+        }
+
+        uint64 uncompressed_size (
+        ) const { return total; }
+
+    protected:
+
+        int_type underflow (
+        )
+        {
+            if (gptr() < egptr())
+                return traits_type::to_int_type(*gptr());
+
+            std::unique_lock<std::mutex> lock(m);
+            if (read_block + 1 >= num_blocks)
+                return traits_type::eof();
+            ++read_block;
+            const unsigned long slot = read_block%slots.size();
+
+            if (threads.empty())
+            {
+                // No threads could be started, so decompress on the reader's thread.
+                std::string err;
+                if (!decompress(read_block, slot, err))
+                    throw serialization_error(err);
+                slot_blocks[slot] = read_block;
+            }
+            else
+            {
+                slot_freed.notify_all();
+                block_ready.wait(lock, [&]{ return slot_blocks[slot] == read_block || !error.empty(); });
+                if (slot_blocks[slot] != read_block)
+                    throw serialization_error(error);
+            }
+
+            char* p = &slots[slot][0];
+            setg(p, p, p + uncompressed_block_size(read_block));
+            return traits_type::to_int_type(*gptr());
+        }
+
+    private:
+
+        unsigned long uncompressed_block_size (
+            long block
+        ) const
+        {
+            return static_cast<unsigned long>(std::min<uint64>(block_size, total - static_cast<uint64>(block)*block_size));
+        }
+
+        bool decompress (
+            long block,
+            unsigned long slot,
+            std::string& err
+        )
+        {
+            const unsigned long expected = uncompressed_block_size(block);
+            int num = 0;
+            if (dmLZ4::DecompressBuffer(block_starts[block], block_sizes[block], &slots[slot][0],
+                                        static_cast<uint32>(slots[slot].size()), &num) != dmLZ4::RESULT_OK ||
+                static_cast<unsigned long>(num) != expected)
+            {
+                err = "Error decompressing block " + cast_to_string(block) + " of an lz4 stream.";
+                return false;
+            }
+            return true;
+        }
+
+        void decompress_blocks (
+        )
+        {
+            for (;;)
+            {
+                long block;
+                {
+                    // A slot can be reused once the reader has moved past the block that
+                    // was last decompressed into it.
+                    std::unique_lock<std::mutex> lock(m);
+                    slot_freed.wait(lock, [&]{ return stop || next_block >= num_blocks ||
+                        next_block < read_block + static_cast<long>(slots.size()); });
+                    if (stop || next_block >= num_blocks)
+                        return;
+                    block = next_block++;
+                }
+
+                std::string err;
+                const bool ok = decompress(block, block%slots.size(), err);
+
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    if (ok)
+                        slot_blocks[block%slots.size()] = block;
+                    else if (error.empty())
+                        error = err;
+                }
+                block_ready.notify_all();
+            }
+        }
+
+        unsigned long block_size;
+        uint64 total;
+        long num_blocks;
+        std::vector<const char*> block_starts;
+        std::vector<uint32> block_sizes;
+
+        std::vector<std::vector<char> > slots;
+        std::vector<long> slot_blocks;
+        long read_block;
+        long next_block;
+        bool stop;
+        std::string error;
+        std::mutex m;
+        std::condition_variable slot_freed;
+        std::condition_variable block_ready;
+        std::vector<std::thread> threads;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_LZ4_STReAM_Hh_
+
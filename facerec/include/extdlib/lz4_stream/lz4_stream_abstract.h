@@ -0,0 +1,119 @@
+#undef DLIB_LZ4_STReAM_ABSTRACT_Hh_
+#ifdef DLIB_LZ4_STReAM_ABSTRACT_Hh_
+
+#include <iostream>
+#include <streambuf>
+#include "../uintn.h"
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    /*!
+        LZ4 STREAM FORMAT
+            An lz4 stream is a blob of bytes split into fixed size blocks which are each
+            compressed on their own with dmLZ4, so that they can be decompressed
+            independently and in parallel.  It is laid out as:
+                - the 4 bytes "DLZ4"
+                - the format version, currently 1, as a serialized int
+                - the size of an uncompressed block, as a serialized unsigned long
+                - the total uncompressed size, as a serialized uint64
+                - an index holding the compressed size of every block, as a serialized
+                  std::vector<uint32>
+                - the compressed blocks, back to back.  Every block but the last one
+                  decompresses to exactly the block size.
+    !*/
+
+    void compress_lz4_stream (
+        const char* data,
+        size_t size,
+        std::ostream& out,
+        unsigned long block_size = 1024*1024
+    );
+    /*!
+        requires
+            - data points to size bytes
+            - 0 < block_size <= DMLZ4_MAX_OUTPUT_SIZE
+        ensures
+            - writes the given bytes to out as an lz4 stream with the given uncompressed
+              block size.
+        throws
+            - serialization_error
+                This is thrown if compression fails or out can't be written to.
+    !*/
+
+    bool is_lz4_stream (
+        const char* data,
+        size_t size
+    );
+    /*!
+        ensures
+            - returns true if the size bytes at data start with the header of an lz4
+              stream and false otherwise.
+    !*/
+
+// ----------------------------------------------------------------------------------------
+
+    class lz4_istreambuf : public std::streambuf
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This is a read only streambuf that decompresses an lz4 stream held in
+                memory as it is read.  It is meant to be handed to deserialize() through a
+                std::istream so that a compressed model is loaded without first inflating
+                all of it into another buffer.
+
+                Background threads decompress the blocks ahead of the reader into a small
+                ring of block buffers, so decompression runs in parallel with whatever is
+                parsing the stream, and memory use is bounded by a few blocks no matter
+                how big the stream is.
+
+                If a block fails to decompress, the read that reaches it throws
+                serialization_error, which deserialize() passes on to its caller.
+        !*/
+
+    public:
+
+        lz4_istreambuf (
+            const char* data,
+            size_t size,
+            unsigned long num_threads = 0
+        );
+        /*!
+            requires
+                - data points to size bytes that stay valid for the lifetime of this
+                  object.
+            ensures
+                - This object reads the decompressed contents of the lz4 stream at data.
+                  It does not copy the compressed data.
+                - Up to num_threads threads decompress blocks ahead of the reader.  If
+                  num_threads == 0 then std::thread::hardware_concurrency() threads are
+                  used.
+                - #uncompressed_size() == the size of the decompressed contents.
+            throws
+                - serialization_error
+                    This is thrown if the data does not hold a valid lz4 stream header.
+        !*/
+
+        ~lz4_istreambuf (
+        );
+        /*!
+            ensures
+                - stops and joins the decompression threads.
+        !*/
+
+        uint64 uncompressed_size (
+        ) const;
+        /*!
+            ensures
+                - returns the number of bytes that can be read from this object in total.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_LZ4_STReAM_ABSTRACT_Hh_
+
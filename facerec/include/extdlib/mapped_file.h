@@ -0,0 +1,8 @@
+#ifndef DLIB_MAPPED_FiLEh_
+#define DLIB_MAPPED_FiLEh_
+
+#include "mapped_file/mapped_file.h"
+
+
+#endif // DLIB_MAPPED_FiLEh_
+
@@ -0,0 +1,119 @@
+#ifndef DLIB_MAPPED_FiLE_Hh_
+#define DLIB_MAPPED_FiLE_Hh_
+
+#include "mapped_file_abstract.h"
+
+#include <string>
+#include "../error.h"
+#include "../noncopyable.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_file_error : public error
+    {
+    public:
+        mapped_file_error(const std::string& e):error(e) {}
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_file : noncopyable
+    {
+    public:
+
+        enum flags
+        {
+            populate = 1,
+            huge_pages = 2
+        };
+
+        explicit mapped_file (
+            const std::string& filename,
+            unsigned long flags = 0
+        ) : ptr(0), num(0)
+        {
+#ifndef WIN32
+            const int fd = ::open(filename.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw mapped_file_error("Unable to open " + filename + " for reading.");
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                throw mapped_file_error("Unable to get the size of " + filename);
+            }
+            num = static_cast<size_t>(st.st_size);
+            if (num == 0)
+            {
+                ::close(fd);
+                return;
+            }
+
+            int map_flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+            if (flags & populate)
+                map_flags |= MAP_POPULATE;
+#endif
+            void* p = ::mmap(0, num, PROT_READ, map_flags, fd, 0);
+            // The mapping keeps its own reference to the file.
+            ::close(fd);
+            if (p == MAP_FAILED)
+                throw mapped_file_error("Unable to map " + filename + " into memory.");
+            ptr = static_cast<const char*>(p);
+
+#ifdef MADV_HUGEPAGE
+            if (flags & huge_pages)
+                ::madvise(p, num, MADV_HUGEPAGE);
+#endif
+#ifndef MAP_POPULATE
+            if (flags & populate)
+            {
+                ::madvise(p, num, MADV_WILLNEED);
+                const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+                volatile char sum = 0;
+                for (size_t i = 0; i < num; i += page_size)
+                    sum += ptr[i];
+            }
+#endif
+#else
+            throw mapped_file_error("dlib::mapped_file is not supported on this platform.");
+#endif
+        }
+
+        ~mapped_file (
+        )
+        {
+#ifndef WIN32
+            if (ptr)
+                ::munmap(const_cast<char*>(ptr), num);
+#endif
+        }
+
+        const char* data (
+        ) const { return ptr; }
+
+        size_t size (
+        ) const { return num; }
+
+    private:
+
+        const char* ptr;
+        size_t num;
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_MAPPED_FiLE_Hh_
+
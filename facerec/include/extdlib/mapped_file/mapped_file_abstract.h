@@ -0,0 +1,94 @@
+#undef DLIB_MAPPED_FiLE_ABSTRACT_Hh_
+#ifdef DLIB_MAPPED_FiLE_ABSTRACT_Hh_
+
+#include <string>
+#include "../error.h"
+#include "../noncopyable.h"
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_file_error : public error
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This is the exception thrown when a file can't be opened or mapped.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+    class mapped_file : noncopyable
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object is a read only view of the contents of a file, made with a
+                shared memory mapping of it.  The pages of the mapping come straight from
+                the OS page cache, so every process that maps the same file shares one
+                copy of it in physical memory, and pages that are never touched are never
+                read from disk.
+
+                This is only implemented for POSIX systems.
+        !*/
+
+    public:
+
+        enum flags
+        {
+            populate = 1,
+            huge_pages = 2
+        };
+
+        explicit mapped_file (
+            const std::string& filename,
+            unsigned long flags = 0
+        );
+        /*!
+            ensures
+                - maps the whole of the given file into memory read only.
+                - #data() points to the contents of the file, and is page aligned.
+                - #size() == the size of the file.
+                - if (flags & populate) then
+                    - all the pages of the file are read and mapped before the constructor
+                      returns, using MAP_POPULATE where the OS has it and by touching
+                      every page otherwise.  This moves the page faults of the first
+                      accesses to load time.
+                - if (flags & huge_pages) then
+                    - asks the OS to back the mapping with huge pages where it supports
+                      that for file mappings.  This is only a hint and is ignored where it
+                      isn't supported.
+            throws
+                - mapped_file_error
+                    This is thrown if the file can't be opened or mapped.
+        !*/
+
+        ~mapped_file (
+        );
+        /*!
+            ensures
+                - unmaps the file.  Pointers into data() become invalid.
+        !*/
+
+        const char* data (
+        ) const;
+        /*!
+            ensures
+                - returns a pointer to the first byte of the file.
+        !*/
+
+        size_t size (
+        ) const;
+        /*!
+            ensures
+                - returns the size of the file in bytes.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_MAPPED_FiLE_ABSTRACT_Hh_
+
@@ -1862,6 +1862,10 @@ namespace dlib
     {
         try
         {
+            if (item.size() != 0 && is_same_type<l,row_major_layout>::value &&
+                ser_helper::serialize_bulk(&item(0,0), item.nr(), item.nc(), out))
+                return;
+
             // The reason the serialization is a little funny is because we are trying to
             // maintain backwards compatibility with an older serialization format used by
             // dlib while also encoding things in a way that lets the array2d and matrix
@@ -1896,6 +1900,32 @@ namespace dlib
     {
         try
         {
+            ser_helper::bulk_header header;
+            if (ser_helper::deserialize_bulk_header(header, in))
+            {
+                if (NR != 0 && header.nr != NR)
+                    throw serialization_error("Error while deserializing a dlib::matrix.  Invalid rows");
+                if (NC != 0 && header.nc != NC)
+                    throw serialization_error("Error while deserializing a dlib::matrix.  Invalid columns");
+
+                item.set_size(header.nr,header.nc);
+                if (item.size() == 0)
+                    return;
+                if (is_same_type<l,row_major_layout>::value)
+                {
+                    ser_helper::deserialize_bulk(&item(0,0), header, in);
+                }
+                else
+                {
+                    std::vector<T> temp(item.size());
+                    ser_helper::deserialize_bulk(&temp[0], header, in);
+                    for (long r = 0; r < item.nr(); ++r)
+                        for (long c = 0; c < item.nc(); ++c)
+                            item(r,c) = temp[r*item.nc()+c];
+                }
+                return;
+            }
+
             long nr, nc;
             deserialize(nr,in); 
             deserialize(nc,in); 
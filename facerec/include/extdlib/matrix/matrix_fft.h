@@ -7,6 +7,12 @@
 #include "matrix_utilities.h"
 #include "../hash.h"
 #include "../algs.h"
+#include "../simd/cpu_dispatch.h"
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #ifdef DLIB_USE_MKL_FFT
 #include <mkl_dfti.h>
@@ -39,18 +45,6 @@ namespace dlib
     namespace impl
     {
 
-    // ------------------------------------------------------------------------------------
-
-        /*
-            The next few functions related to doing FFTs are derived from Stefan
-            Gustavson's (stegu@itn.liu.se) public domain 2D Fourier transformation code.
-            The code has a long history, originally a FORTRAN implementation published in:
-            Programming for Digital Signal Processing, IEEE Press 1979, Section 1, by G. D.
-            Bergland and M. T. Dolan.  In 2003 it was cleaned up and turned into modern C
-            by Steven Gustavson.  Davis King then rewrote it in modern C++ in 2014 and also
-            changed the transform so that the outputs are identical to those given from FFTW.
-        */
-
     // ------------------------------------------------------------------------------------
 
         /* Get binary log of integer argument - exact if n is a power of 2 */
@@ -66,338 +60,516 @@ namespace dlib
 
     // ------------------------------------------------------------------------------------
 
-        /* Radix-2 iteration subroutine */
         template <typename T>
-        void R2TX(int nthpo, std::complex<T> *c0, std::complex<T> *c1)
+        inline void fft_radix4 (T* const* re, T* const* im, long num, const T* w, bool inverse)
         {
-            for(int k=0; k<nthpo; k+=2) 
-            {
-                std::complex<T> temp = c0[k] + c1[k];
-                c1[k] = c0[k] - c1[k];
-                c0[k] = temp;
-            }
+            simd_kernels_scalar::complex_radix4(re, im, num, w, inverse);
         }
 
-    // ------------------------------------------------------------------------------------
-
-        /* Radix-4 iteration subroutine */
-        template <typename T>
-        void R4TX(int nthpo, std::complex<T> *c0, std::complex<T> *c1,
-            std::complex<T> *c2, std::complex<T> *c3)
+        inline void fft_radix4 (double* const* re, double* const* im, long num, const double* w, bool inverse)
         {
-            for(int k=0;k<nthpo;k+=4) 
-            {
-                std::complex<T> t1, t2, t3, t4;
-                t1 = c0[k] + c2[k];
-                t2 = c0[k] - c2[k];
-                t3 = c1[k] + c3[k];
-                t4 = c1[k] - c3[k];
-
-                c0[k] = t1 + t3;
-                c1[k] = t1 - t3;
-                c2[k] = std::complex<T>(t2.real()-t4.imag(), t2.imag()+t4.real());
-                c3[k] = std::complex<T>(t2.real()+t4.imag(), t2.imag()-t4.real());
-            }
+            get_simd_kernels().complex_radix4(re, im, num, w, inverse);
         }
 
     // ------------------------------------------------------------------------------------
 
         template <typename T>
-        class twiddles
+        class fft_plan
         {
             /*!
-                The point of this object is to cache the twiddle values so we don't
-                recompute them over and over inside R8TX().
+                WHAT THIS OBJECT REPRESENTS
+                    This object holds everything about a length n transform in one
+                    direction that doesn't depend on the data: the pairs of rows the bit
+                    reversal swaps, the twiddle factors of each radix-4 pass, and the
+                    factors that split the transform of a length 2n real signal out of a
+                    length n complex one.  Making a plan costs about as much as doing a
+                    transform, so plans are made once per size and direction and then
+                    shared through get_fft_plan().
+
+                    The transforms work on columns of complex values, stored as separate
+                    arrays of real and imaginary parts.  Each butterfly is done on whole
+                    rows, so all the columns of a matrix are transformed at once with the
+                    complex_radix4() SIMD kernel.
             !*/
         public:
 
-            twiddles()
+            fft_plan (
+                long n_,
+                bool inverse_
+            ) : n(n_), inverse(inverse_)
             {
-                data.resize(64);
+                const long bits = fastlog2(n);
+                for (long i = 0; i < n; ++i)
+                {
+                    long r = 0;
+                    for (long b = 0; b < bits; ++b)
+                    {
+                        if (i & (1L<<b))
+                            r |= 1L<<(bits-1-b);
+                    }
+                    if (i < r)
+                    {
+                        swaps.push_back(i);
+                        swaps.push_back(r);
+                    }
+                }
+
+                const double twopi = (inverse ? 1 : -1)*6.2831853071795865;
+                for (long m = bits%2 == 1 ? 2 : 1; 4*m <= n; m *= 4)
+                {
+                    for (long k = 0; k < m; ++k)
+                    {
+                        const double arg = twopi*k/(4*m);
+                        twiddles.push_back(std::cos(arg));
+                        twiddles.push_back(std::sin(arg));
+                        twiddles.push_back(std::cos(2*arg));
+                        twiddles.push_back(std::sin(2*arg));
+                    }
+                }
+
+                for (long k = 0; k <= n; ++k)
+                {
+                    const double arg = twopi*k/(2*n);
+                    real_twiddles.push_back(std::cos(arg));
+                    real_twiddles.push_back(std::sin(arg));
+                }
             }
-            
-            const std::complex<T>* get_twiddles (
-                int p 
-            ) 
+
+            long size (
+            ) const { return n; }
+
+            bool is_inverse (
+            ) const { return inverse; }
+
+            void transform_columns (
+                T* re,
+                T* im,
+                long stride,
+                long num
+            ) const
             /*!
                 requires
-                    - 0 <= p <= 64
+                    - re and im hold size() rows of num values, the rows stride values
+                      apart.
                 ensures
-                    - returns a pointer to the twiddle factors needed by R8TX if nxtlt == 2^p
+                    - replaces each of the num columns with its discrete Fourier transform,
+                      or its inverse transform if is_inverse().  The outputs are not
+                      divided by size().
             !*/
             {
-                // Compute the twiddle factors for this p value if we haven't done so
-                // already.
-                if (data[p].size() == 0)
+                for (unsigned long i = 0; i < swaps.size(); i += 2)
+                {
+                    std::swap_ranges(re + swaps[i]*stride, re + swaps[i]*stride + num, re + swaps[i+1]*stride);
+                    std::swap_ranges(im + swaps[i]*stride, im + swaps[i]*stride + num, im + swaps[i+1]*stride);
+                }
+
+                long m = 1;
+                if (fastlog2(n)%2 == 1)
+                {
+                    // A radix-2 pass first, so the radix-4 passes come out even.
+                    for (long j = 0; j < n; j += 2)
+                    {
+                        T* r0 = re + j*stride;
+                        T* i0 = im + j*stride;
+                        T* r1 = r0 + stride;
+                        T* i1 = i0 + stride;
+                        for (long c = 0; c < num; ++c)
+                        {
+                            const T tr = r1[c], ti = i1[c];
+                            r1[c] = r0[c] - tr;
+                            i1[c] = i0[c] - ti;
+                            r0[c] += tr;
+                            i0[c] += ti;
+                        }
+                    }
+                    m = 2;
+                }
+
+                const T* w = twiddles.size() != 0 ? &twiddles[0] : 0;
+                for (; 4*m <= n; w += 4*m, m *= 4)
                 {
-                    const int nxtlt = 0x1 << p;
-                    data[p].reserve(nxtlt*7);
-                    const T twopi = 6.2831853071795865; /* 2.0 * pi */
-                    const T scale = twopi/(nxtlt*8.0);
-                    std::complex<T> cs[7];
-                    for (int j = 0; j < nxtlt; ++j)
+                    for (long g = 0; g < n; g += 4*m)
                     {
-                        const T arg = j*scale;
-                        cs[0] = std::complex<T>(std::cos(arg),std::sin(arg));
-                        cs[1] = cs[0]*cs[0];
-                        cs[2] = cs[1]*cs[0];
-                        cs[3] = cs[1]*cs[1];
-                        cs[4] = cs[2]*cs[1];
-                        cs[5] = cs[2]*cs[2];
-                        cs[6] = cs[3]*cs[2];
-                        data[p].insert(data[p].end(), cs, cs+7);
+                        for (long k = 0; k < m; ++k)
+                        {
+                            T* const r[4] = { re + (g+k)*stride, re + (g+k+m)*stride, re + (g+k+2*m)*stride, re + (g+k+3*m)*stride };
+                            T* const i[4] = { im + (g+k)*stride, im + (g+k+m)*stride, im + (g+k+2*m)*stride, im + (g+k+3*m)*stride };
+                            fft_radix4(r, i, num, w + 4*k, inverse);
+                        }
                     }
                 }
+            }
 
-                return &data[p][0];
+            void split_real_columns (
+                const T* zre,
+                const T* zim,
+                T* xre,
+                T* xim,
+                long stride,
+                long num
+            ) const
+            /*!
+                requires
+                    - is_inverse() == false
+                    - zre and zim hold size() rows and xre and xim hold size()+1 rows of
+                      num values, the rows stride values apart.
+                    - Each column of z is the transform of a length 2*size() real signal
+                      packed into a complex one, with the even samples in the real parts
+                      and the odd samples in the imaginary parts.
+                ensures
+                    - #x == the first size()+1 values of the transforms of the real
+                      signals.  The rest follow from Hermitian symmetry.
+            !*/
+            {
+                for (long k = 0; k <= n; ++k)
+                {
+                    const T* ar = zre + (k%n)*stride;
+                    const T* ai = zim + (k%n)*stride;
+                    const T* br = zre + ((n-k)%n)*stride;
+                    const T* bi = zim + ((n-k)%n)*stride;
+                    T* outr = xre + k*stride;
+                    T* outi = xim + k*stride;
+                    const T wr = real_twiddles[2*k], wi = real_twiddles[2*k+1];
+                    for (long c = 0; c < num; ++c)
+                    {
+                        // The transforms of the even and odd samples
+                        const T er = (ar[c] + br[c])/2, ei = (ai[c] - bi[c])/2;
+                        const T or_ = (ai[c] + bi[c])/2, oi = (br[c] - ar[c])/2;
+                        outr[c] = er + wr*or_ - wi*oi;
+                        outi[c] = ei + wr*oi + wi*or_;
+                    }
+                }
+            }
+
+            void merge_real_columns (
+                const T* xre,
+                const T* xim,
+                T* zre,
+                T* zim,
+                long stride,
+                long num
+            ) const
+            /*!
+                requires
+                    - is_inverse() == true
+                    - xre and xim hold size()+1 rows and zre and zim hold size() rows of
+                      num values, the rows stride values apart.
+                ensures
+                    - This undoes split_real_columns().  #z is such that transforming its
+                      columns with this plan gives, in the real and imaginary parts, the
+                      even and odd samples of the inverse transforms of the length
+                      2*size() Hermitian signals whose first halves are in x, not divided
+                      by 2*size().
+            !*/
+            {
+                for (long k = 0; k < n; ++k)
+                {
+                    const T* ar = xre + k*stride;
+                    const T* ai = xim + k*stride;
+                    const T* br = xre + (n-k)*stride;
+                    const T* bi = xim + (n-k)*stride;
+                    T* outr = zre + k*stride;
+                    T* outi = zim + k*stride;
+                    const T wr = real_twiddles[2*k], wi = real_twiddles[2*k+1];
+                    for (long c = 0; c < num; ++c)
+                    {
+                        const T er = ar[c] + br[c], ei = ai[c] - bi[c];
+                        const T dr = ar[c] - br[c], di = ai[c] + bi[c];
+                        const T or_ = dr*wr - di*wi, oi = dr*wi + di*wr;
+                        outr[c] = er - oi;
+                        outi[c] = ei + or_;
+                    }
+                }
             }
 
         private:
-            std::vector<std::vector<std::complex<T> > > data;
+            long n;
+            bool inverse;
+            std::vector<long> swaps;
+            std::vector<T> twiddles;
+            std::vector<T> real_twiddles;
         };
 
-    // ----------------------------------------------------------------------------------------
+        template <typename T>
+        const fft_plan<T>& get_fft_plan (
+            long n,
+            bool inverse
+        )
+        /*!
+            ensures
+                - returns the plan for length n transforms in the given direction, making
+                  it the first time it is asked for.  Plans are never destroyed, so the
+                  returned reference stays valid, and they are safe to use from any
+                  number of threads at once.
+        !*/
+        {
+            static std::mutex m;
+            static std::map<std::pair<long,bool>, std::unique_ptr<fft_plan<T> > > plans;
+            std::lock_guard<std::mutex> lock(m);
+            std::unique_ptr<fft_plan<T> >& plan = plans[std::make_pair(n, inverse)];
+            if (!plan)
+                plan.reset(new fft_plan<T>(n, inverse));
+            return *plan;
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename T>
+        struct fft_buffers
+        {
+            /*!
+                Scratch space for the transforms below.  Reusing one object for many
+                transforms of the same size saves reallocating it every time.
+            !*/
+            std::vector<T> re, im, re2, im2;
+
+            void set_size (
+                long size1,
+                long size2
+            )
+            {
+                re.resize(size1);
+                im.resize(size1);
+                re2.resize(size2);
+                im2.resize(size2);
+            }
+        };
 
-        /* Radix-8 iteration subroutine */
         template <typename T>
-        void R8TX(int nxtlt, int nthpo, int length, const std::complex<T>* cs,
-            std::complex<T> *cc0, std::complex<T> *cc1, std::complex<T> *cc2, std::complex<T> *cc3,
-            std::complex<T> *cc4, std::complex<T> *cc5, std::complex<T> *cc6, std::complex<T> *cc7)
+        void fft_columns (
+            T* re,
+            T* im,
+            long nr,
+            long nc,
+            bool inverse
+        )
         {
-            const T irt2 = 0.707106781186548;  /* 1.0/sqrt(2.0) */
+            if (nr > 1)
+                get_fft_plan<T>(nr, inverse).transform_columns(re, im, nc, nc);
+        }
 
-            for(int j=0; j<nxtlt; j++) 
+        template <typename T>
+        void transpose_planes (
+            const std::vector<T>& re,
+            const std::vector<T>& im,
+            long nr,
+            long nc,
+            std::vector<T>& re_out,
+            std::vector<T>& im_out
+        )
+        {
+            for (long r = 0; r < nr; ++r)
             {
-                for(int k=j;k<nthpo;k+=length) 
+                for (long c = 0; c < nc; ++c)
                 {
-                    std::complex<T> a0, a1, a2, a3, a4, a5, a6, a7;
-                    std::complex<T> b0, b1, b2, b3, b4, b5, b6, b7;
-                    a0 = cc0[k] + cc4[k];
-                    a1 = cc1[k] + cc5[k];
-                    a2 = cc2[k] + cc6[k];
-                    a3 = cc3[k] + cc7[k];
-                    a4 = cc0[k] - cc4[k];
-                    a5 = cc1[k] - cc5[k];
-                    a6 = cc2[k] - cc6[k];
-                    a7 = cc3[k] - cc7[k];
-
-                    b0 = a0 + a2;
-                    b1 = a1 + a3;
-                    b2 = a0 - a2;
-                    b3 = a1 - a3;
-
-                    b4 = std::complex<T>(a4.real()-a6.imag(), a4.imag()+a6.real());
-                    b5 = std::complex<T>(a5.real()-a7.imag(), a5.imag()+a7.real());
-                    b6 = std::complex<T>(a4.real()+a6.imag(), a4.imag()-a6.real());
-                    b7 = std::complex<T>(a5.real()+a7.imag(), a5.imag()-a7.real());
-
-                    const std::complex<T> tmp0(-b3.imag(), b3.real());
-                    const std::complex<T> tmp1(irt2*(b5.real()-b5.imag()), irt2*(b5.real()+b5.imag()));
-                    const std::complex<T> tmp2(-irt2*(b7.real()+b7.imag()), irt2*(b7.real()-b7.imag()));
-
-                    cc0[k] = b0 + b1;
-                    cc1[k] = b0 - b1;
-                    cc2[k] = b2 + tmp0;
-                    cc3[k] = b2 - tmp0;
-                    cc4[k] = b4 + tmp1;
-                    cc5[k] = b4 - tmp1;
-                    cc6[k] = b6 + tmp2;
-                    cc7[k] = b6 - tmp2;
-                    if(j>0) 
-                    {
-                        cc1[k] *= cs[3];
-                        cc2[k] *= cs[1];
-                        cc3[k] *= cs[5];
-                        cc4[k] *= cs[0];
-                        cc5[k] *= cs[4];
-                        cc6[k] *= cs[2];
-                        cc7[k] *= cs[6];
-                    }
+                    re_out[c*nr+r] = re[r*nc+c];
+                    im_out[c*nr+r] = im[r*nc+c];
                 }
-
-                cs += 7;
             }
         }
 
     // ------------------------------------------------------------------------------------
 
-        template <typename T, long NR, long NC, typename MM, typename layout>
-        void fft1d_inplace(matrix<std::complex<T>,NR,NC,MM,layout>& data, bool do_backward_fft, twiddles<T>& cs)
-        /*!
-            requires
-                - is_vector(data) == true
-                - is_power_of_two(data.size()) == true
-            ensures
-                - This routine replaces the input std::complex<double> vector by its finite
-                  discrete complex fourier transform if do_backward_fft==true.  It replaces
-                  the input std::complex<double> vector by its finite discrete complex
-                  inverse fourier transform if do_backward_fft==false.
-
-                  The implementation is a radix-2 FFT, but with faster shortcuts for
-                  radix-4 and radix-8. It performs as many radix-8 iterations as possible,
-                  and then finishes with a radix-2 or -4 iteration if needed.
-        !*/
+        template < typename T, long NR, long NC, typename MM, typename L >
+        void fft_inplace (
+            matrix<std::complex<T>,NR,NC,MM,L>& data,
+            bool do_backward_fft,
+            fft_buffers<T>& buf
+        )
         {
             if (data.size() == 0)
                 return;
 
-            std::complex<T>* const b = &data(0);
-            int L[16],L1,L2,L3,L4,L5,L6,L7,L8,L9,L10,L11,L12,L13,L14,L15;
-            int j1,j2,j3,j4,j5,j6,j7,j8,j9,j10,j11,j12,j13,j14;
-            int j, ij, ji;
-            int n2pow, n8pow, nthpo, ipass, nxtlt, length;
-
-            n2pow = fastlog2(data.size());
-            nthpo = data.size();
-
-            n8pow = n2pow/3;
+            const long nr = data.nr();
+            const long nc = data.nc();
+            buf.set_size(data.size(), data.size());
 
-            if(n8pow)
+            // Load the data transposed, so the first pass transforms its rows.
+            for (long r = 0; r < nr; ++r)
             {
-                /* Radix 8 iterations */
-                for(ipass=1;ipass<=n8pow;ipass++) 
+                for (long c = 0; c < nc; ++c)
                 {
-                    const int p = n2pow - 3*ipass;
-                    nxtlt = 0x1 << p;
-                    length = 8*nxtlt;
-                    R8TX(nxtlt, nthpo, length, cs.get_twiddles(p),
-                        b, b+nxtlt, b+2*nxtlt, b+3*nxtlt,
-                        b+4*nxtlt, b+5*nxtlt, b+6*nxtlt, b+7*nxtlt);
+                    buf.re[c*nr+r] = data(r,c).real();
+                    buf.im[c*nr+r] = data(r,c).imag();
                 }
             }
+            fft_columns(&buf.re[0], &buf.im[0], nc, nr, do_backward_fft);
+            transpose_planes(buf.re, buf.im, nc, nr, buf.re2, buf.im2);
+            fft_columns(&buf.re2[0], &buf.im2[0], nr, nc, do_backward_fft);
+
+            for (long r = 0; r < nr; ++r)
+            {
+                for (long c = 0; c < nc; ++c)
+                    data(r,c) = std::complex<T>(buf.re2[r*nc+c], buf.im2[r*nc+c]);
+            }
+        }
+
+    // ------------------------------------------------------------------------------------
 
-            if(n2pow%3 == 1) 
+        template <typename EXP, typename T>
+        void fftr (
+            const matrix_exp<EXP>& data,
+            matrix<std::complex<T> >& out,
+            fft_buffers<T>& buf
+        )
+        /*!
+            ensures
+                - #out == fftr(data)
+        !*/
+        {
+            const long nr = data.nr();
+            const long h = data.nc()/2;
+            buf.set_size(nr*(h+1), nr*(h+1));
+
+            // Pack the even and odd samples of each row into the real and imaginary parts
+            // of a length h complex signal, stored as a column so the row transforms are
+            // all done at once.
+            for (long r = 0; r < nr; ++r)
             {
-                /* A final radix 2 iteration is needed */
-                R2TX(nthpo, b, b+1); 
+                for (long j = 0; j < h; ++j)
+                {
+                    buf.re[j*nr+r] = data(r,2*j);
+                    buf.im[j*nr+r] = data(r,2*j+1);
+                }
             }
+            fft_columns(&buf.re[0], &buf.im[0], h, nr, false);
+            get_fft_plan<T>(h, false).split_real_columns(&buf.re[0], &buf.im[0], &buf.re2[0], &buf.im2[0], nr, nr);
 
-            if(n2pow%3 == 2)  
+            transpose_planes(buf.re2, buf.im2, h+1, nr, buf.re, buf.im);
+            fft_columns(&buf.re[0], &buf.im[0], nr, h+1, false);
+
+            out.set_size(nr, h+1);
+            for (long r = 0; r < nr; ++r)
             {
-                /* A final radix 4 iteration is needed */
-                R4TX(nthpo, b, b+1, b+2, b+3); 
+                for (long c = 0; c <= h; ++c)
+                    out(r,c) = std::complex<T>(buf.re[r*(h+1)+c], buf.im[r*(h+1)+c]);
             }
+        }
 
-            for(j=1;j<=15;j++) 
+        template <typename EXP, typename T>
+        void ifftr (
+            const matrix_exp<EXP>& data,
+            matrix<T>& out,
+            fft_buffers<T>& buf
+        )
+        /*!
+            ensures
+                - #out == ifftr(data)
+        !*/
+        {
+            const long nr = data.nr();
+            const long h = data.nc()-1;
+            buf.set_size(nr*(h+1), nr*(h+1));
+
+            for (long r = 0; r < nr; ++r)
             {
-                L[j] = 1;
-                if(j-n2pow <= 0) L[j] = 0x1 << (n2pow + 1 - j);
+                for (long c = 0; c <= h; ++c)
+                {
+                    buf.re[r*(h+1)+c] = data(r,c).real();
+                    buf.im[r*(h+1)+c] = data(r,c).imag();
+                }
             }
+            fft_columns(&buf.re[0], &buf.im[0], nr, h+1, true);
+            transpose_planes(buf.re, buf.im, nr, h+1, buf.re2, buf.im2);
+
+            const fft_plan<T>& plan = get_fft_plan<T>(h, true);
+            plan.merge_real_columns(&buf.re2[0], &buf.im2[0], &buf.re[0], &buf.im[0], nr, nr);
+            plan.transform_columns(&buf.re[0], &buf.im[0], nr, nr);
 
-            L15=L[1];L14=L[2];L13=L[3];L12=L[4];L11=L[5];L10=L[6];L9=L[7];
-            L8=L[8];L7=L[9];L6=L[10];L5=L[11];L4=L[12];L3=L[13];L2=L[14];L1=L[15];
-
-            ij = 0;
-
-            for(j1=0;j1<L1;j1++)
-                for(j2=j1;j2<L2;j2+=L1)
-                    for(j3=j2;j3<L3;j3+=L2)
-                        for(j4=j3;j4<L4;j4+=L3)
-                            for(j5=j4;j5<L5;j5+=L4)
-                                for(j6=j5;j6<L6;j6+=L5)
-                                    for(j7=j6;j7<L7;j7+=L6)
-                                        for(j8=j7;j8<L8;j8+=L7)
-                                            for(j9=j8;j9<L9;j9+=L8)
-                                                for(j10=j9;j10<L10;j10+=L9)
-                                                    for(j11=j10;j11<L11;j11+=L10)
-                                                        for(j12=j11;j12<L12;j12+=L11)
-                                                            for(j13=j12;j13<L13;j13+=L12)
-                                                                for(j14=j13;j14<L14;j14+=L13)
-                                                                    for(ji=j14;ji<L15;ji+=L14) 
-                                                                    {
-                                                                        if(ij<ji)
-                                                                            swap(b[ij], b[ji]);
-                                                                        ij++;
-                                                                    }
-
-
-            // unscramble outputs
-            if(!do_backward_fft) 
+            const T scale = T(1)/(nr*2*h);
+            out.set_size(nr, 2*h);
+            for (long r = 0; r < nr; ++r)
             {
-                for(long i=1, j=data.size()-1; i<data.size()/2; i++,j--)
+                for (long j = 0; j < h; ++j)
                 {
-                    swap(b[j], b[i]);
+                    out(r,2*j) = buf.re[j*nr+r]*scale;
+                    out(r,2*j+1) = buf.im[j*nr+r]*scale;
                 }
             }
         }
 
-    // ------------------------------------------------------------------------------------
-
-        template < typename T, long NR, long NC, typename MM, typename L >
-        void fft2d_inplace(
-            matrix<std::complex<T>,NR,NC,MM,L>& data,
-            bool do_backward_fft
+        template <typename EXP, typename T, long NR, long NC, typename MM, typename L>
+        void fftr_columns (
+            const matrix_exp<EXP>& data,
+            matrix<std::complex<T>,NR,NC,MM,L>& out,
+            fft_buffers<T>& buf
         )
+        /*!
+            requires
+                - data.nr() is an even power of two
+            ensures
+                - #out.nr() == data.nr()/2+1
+                - #out.nc() == data.nc()
+                - colm(#out,i) == the first data.nr()/2+1 values of the 1D transform of
+                  colm(data,i).  That is, this is fftr() done on each column by itself.
+        !*/
         {
-            if (data.size() == 0)
-                return;
+            const long nc = data.nc();
+            const long h = data.nr()/2;
+            buf.set_size(h*nc, (h+1)*nc);
 
-            matrix<std::complex<double> > buff;
-            twiddles<double> cs;
-
-            // Compute transform row by row
-            for(long r=0; r<data.nr(); ++r) 
+            for (long j = 0; j < h; ++j)
             {
-                buff = matrix_cast<std::complex<double> >(rowm(data,r));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_rowm(data,r) = matrix_cast<std::complex<T> >(buff);
+                for (long c = 0; c < nc; ++c)
+                {
+                    buf.re[j*nc+c] = data(2*j,c);
+                    buf.im[j*nc+c] = data(2*j+1,c);
+                }
             }
+            fft_columns(&buf.re[0], &buf.im[0], h, nc, false);
+            get_fft_plan<T>(h, false).split_real_columns(&buf.re[0], &buf.im[0], &buf.re2[0], &buf.im2[0], nc, nc);
 
-            // Compute transform column by column
-            for(long c=0; c<data.nc(); ++c) 
+            out.set_size(h+1, nc);
+            for (long k = 0; k <= h; ++k)
             {
-                buff = matrix_cast<std::complex<double> >(colm(data,c));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_colm(data,c) = matrix_cast<std::complex<T> >(buff);
+                for (long c = 0; c < nc; ++c)
+                    out(k,c) = std::complex<T>(buf.re2[k*nc+c], buf.im2[k*nc+c]);
             }
         }
-        
-    // ----------------------------------------------------------------------------------------
-
-        template <
-            typename EXP, 
-            typename T
-            >
-        void fft2d(
-            const matrix_exp<EXP>& data, 
-            matrix<std::complex<T> >& data_out,
-            bool do_backward_fft
+
+        template <typename EXP, typename T, long NR, long NC, typename MM, typename L>
+        void ifftr_columns (
+            const matrix_exp<EXP>& data,
+            matrix<T,NR,NC,MM,L>& out,
+            fft_buffers<T>& buf
         )
+        /*!
+            requires
+                - data.nr()-1 is a power of two
+            ensures
+                - undoes fftr_columns().  That is, #out.nr() == 2*(data.nr()-1) and each
+                  column of #out is the inverse transform of the corresponding column of
+                  data, divided by #out.nr().
+        !*/
         {
-            // make sure requires clause is not broken
-            DLIB_CASSERT(is_power_of_two(data.nr()) && is_power_of_two(data.nc()),
-                "\t matrix fft(data)"
-                << "\n\t The number of rows and columns must be powers of two."
-                << "\n\t data.nr(): "<< data.nr()
-                << "\n\t data.nc(): "<< data.nc()
-                << "\n\t is_power_of_two(data.nr()): " << is_power_of_two(data.nr())
-                << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
-            );
+            const long nc = data.nc();
+            const long h = data.nr()-1;
+            buf.set_size(h*nc, (h+1)*nc);
 
-            if (data.size() == 0)
-                return;
-
-            matrix<std::complex<double> > buff;
-            data_out.set_size(data.nr(), data.nc());
-            twiddles<double> cs;
-
-            // Compute transform row by row
-            for(long r=0; r<data.nr(); ++r) 
+            for (long k = 0; k <= h; ++k)
             {
-                buff = matrix_cast<std::complex<double> >(rowm(data,r));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_rowm(data_out,r) = matrix_cast<std::complex<T> >(buff);
+                for (long c = 0; c < nc; ++c)
+                {
+                    buf.re2[k*nc+c] = data(k,c).real();
+                    buf.im2[k*nc+c] = data(k,c).imag();
+                }
             }
+            const fft_plan<T>& plan = get_fft_plan<T>(h, true);
+            plan.merge_real_columns(&buf.re2[0], &buf.im2[0], &buf.re[0], &buf.im[0], nc, nc);
+            plan.transform_columns(&buf.re[0], &buf.im[0], nc, nc);
 
-            // Compute transform column by column
-            for(long c=0; c<data_out.nc(); ++c) 
+            const T scale = T(1)/(2*h);
+            out.set_size(2*h, nc);
+            for (long j = 0; j < h; ++j)
             {
-                buff = matrix_cast<std::complex<double> >(colm(data_out,c));
-                fft1d_inplace(buff, do_backward_fft, cs);
-                set_colm(data_out,c) = matrix_cast<std::complex<T> >(buff);
+                for (long c = 0; c < nc; ++c)
+                {
+                    out(2*j,c) = buf.re[j*nc+c]*scale;
+                    out(2*j+1,c) = buf.im[j*nc+c]*scale;
+                }
             }
         }
-        
+
     // ------------------------------------------------------------------------------------
 
     } // end namespace impl
@@ -419,19 +591,10 @@ namespace dlib
             << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
             );
 
-        if (data.nr() == 1 || data.nc() == 1)
-        {
-            matrix<typename EXP::type> temp(data);
-            impl::twiddles<typename EXP::type::value_type> cs;
-            impl::fft1d_inplace(temp, false, cs);
-            return temp;
-        }
-        else
-        {
-            matrix<typename EXP::type> temp;
-            impl::fft2d(data, temp, false);
-            return temp;
-        }
+        matrix<typename EXP::type> temp(data);
+        impl::fft_buffers<typename EXP::type::value_type> buf;
+        impl::fft_inplace(temp, false, buf);
+        return temp;
     }
 
     template <typename EXP>
@@ -449,20 +612,12 @@ namespace dlib
             << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
             );
 
-        matrix<typename EXP::type> temp;
+        matrix<typename EXP::type> temp(data);
         if (data.size() == 0)
             return temp;
 
-        if (data.nr() == 1 || data.nc() == 1)
-        {
-            temp = data;
-            impl::twiddles<typename EXP::type::value_type> cs;
-            impl::fft1d_inplace(temp, true, cs);
-        }
-        else
-        {
-            impl::fft2d(data, temp, true);
-        }
+        impl::fft_buffers<typename EXP::type::value_type> buf;
+        impl::fft_inplace(temp, true, buf);
         temp /= data.size();
         return temp;
     }
@@ -483,15 +638,8 @@ namespace dlib
             << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
             );
 
-        if (data.nr() == 1 || data.nc() == 1)
-        {
-            impl::twiddles<T> cs;
-            impl::fft1d_inplace(data, false, cs);
-        }
-        else
-        {
-            impl::fft2d_inplace(data, false);
-        }
+        impl::fft_buffers<T> buf;
+        impl::fft_inplace(data, false, buf);
     }
 
     template < typename T, long NR, long NC, typename MM, typename L >
@@ -507,15 +655,48 @@ namespace dlib
             << "\n\t is_power_of_two(data.nc()): " << is_power_of_two(data.nc())
             );
 
-        if (data.nr() == 1 || data.nc() == 1)
-        {
-            impl::twiddles<T> cs;
-            impl::fft1d_inplace(data, true, cs);
-        }
-        else
-        {
-            impl::fft2d_inplace(data, true);
-        }
+        impl::fft_buffers<T> buf;
+        impl::fft_inplace(data, true, buf);
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    template <typename EXP>
+    matrix<std::complex<typename EXP::type> > fftr (const matrix_exp<EXP>& data)
+    {
+        // You have to give a real matrix
+        COMPILE_TIME_ASSERT(is_complex<typename EXP::type>::value == false);
+        // make sure requires clause is not broken
+        DLIB_CASSERT(is_power_of_two(data.nr()) && is_power_of_two(data.nc()) && data.nc()%2 == 0,
+            "\t matrix fftr(data)"
+            << "\n\t The number of rows and columns must be powers of two and there must be an even number of columns."
+            << "\n\t data.nr(): "<< data.nr()
+            << "\n\t data.nc(): "<< data.nc()
+            );
+
+        matrix<std::complex<typename EXP::type> > temp;
+        impl::fft_buffers<typename EXP::type> buf;
+        impl::fftr(data, temp, buf);
+        return temp;
+    }
+
+    template <typename EXP>
+    matrix<typename EXP::type::value_type> ifftr (const matrix_exp<EXP>& data)
+    {
+        // You have to give a complex matrix
+        COMPILE_TIME_ASSERT(is_complex<typename EXP::type>::value);
+        // make sure requires clause is not broken
+        DLIB_CASSERT(is_power_of_two(data.nr()) && data.nc() >= 2 && is_power_of_two(data.nc()-1),
+            "\t matrix ifftr(data)"
+            << "\n\t The number of rows and the number of columns minus one must be powers of two."
+            << "\n\t data.nr(): "<< data.nr()
+            << "\n\t data.nc(): "<< data.nc()
+            );
+
+        matrix<typename EXP::type::value_type> temp;
+        impl::fft_buffers<typename EXP::type::value_type> buf;
+        impl::ifftr(data, temp, buf);
+        return temp;
     }
 
 // ----------------------------------------------------------------------------------------
@@ -136,6 +136,27 @@
         then serialize the exponent and mantissa values using dlib's integral serialization
         format.  Therefore, the output is first the exponent and then the mantissa.  Note that
         the mantissa is a signed integer (i.e. there is not a separate sign bit).
+
+    BULK SERIALIZATION FORMAT
+        Writing every value of a large std::vector, dlib::matrix or dlib::array2d in the
+        formats above makes loading big models slow, so a stream can be switched over to
+        writing them as contiguous blocks of raw values with set_bulk_serialization().
+        This applies when the values are float, double or an integral type other than
+        bool, char and wchar_t.  A bulk block is:
+            - the byte 0x7E.  Since an integer control byte never has any of the bits in
+              0x70 set, deserialize() can tell a bulk block from the older format by
+              looking at this first byte, so files in either format can be read.
+            - the bulk format version, currently 1.
+            - 1 if the values are stored in little endian byte order, 0 otherwise.
+            - the kind of value: 0 for unsigned integers, 1 for signed integers and 2 for
+              IEEE floating point.
+            - the size of each value in bytes.
+            - the number of rows and then columns, as serialized longs.  A std::vector is
+              a single column.
+            - the values themselves in row major order.
+        When reading, values stored with the other byte order or with a different size
+        are converted, and a serialization_error is thrown if a value does not fit in the
+        type being deserialized.
 !*/
 
 
@@ -153,6 +174,8 @@
 #include <map>
 #include <set>
 #include <limits>
+#include <algorithm>
+#include <cstring>
 #include "uintn.h"
 #include "interfaces/enumerable.h"
 #include "interfaces/map_pair.h"
@@ -619,6 +642,294 @@ namespace dlib
         deserialize_floating_point(item,in);
     }
 
+// ----------------------------------------------------------------------------------------
+
+    namespace ser_helper
+    {
+        const unsigned char bulk_marker = 0x7E;
+        const unsigned char bulk_version = 1;
+
+        enum bulk_element_kind
+        {
+            bulk_unsigned = 0,
+            bulk_signed = 1,
+            bulk_float = 2
+        };
+
+        template <typename T> struct bulk_type { const static bool value = false; };
+
+        #define DLIB_DEFINE_BULK_TYPE(T, K) \
+            template <> struct bulk_type<T> { const static bool value = true; const static unsigned char kind = K; };
+
+        DLIB_DEFINE_BULK_TYPE(float, bulk_float)
+        DLIB_DEFINE_BULK_TYPE(double, bulk_float)
+        DLIB_DEFINE_BULK_TYPE(signed char, bulk_signed)
+        DLIB_DEFINE_BULK_TYPE(short, bulk_signed)
+        DLIB_DEFINE_BULK_TYPE(int, bulk_signed)
+        DLIB_DEFINE_BULK_TYPE(long, bulk_signed)
+        DLIB_DEFINE_BULK_TYPE(int64, bulk_signed)
+        DLIB_DEFINE_BULK_TYPE(unsigned char, bulk_unsigned)
+        DLIB_DEFINE_BULK_TYPE(unsigned short, bulk_unsigned)
+        DLIB_DEFINE_BULK_TYPE(unsigned int, bulk_unsigned)
+        DLIB_DEFINE_BULK_TYPE(unsigned long, bulk_unsigned)
+        DLIB_DEFINE_BULK_TYPE(uint64, bulk_unsigned)
+
+        #undef DLIB_DEFINE_BULK_TYPE
+
+        inline int bulk_serialization_index (
+        )
+        {
+            static const int index = std::ios_base::xalloc();
+            return index;
+        }
+
+        inline bool host_is_little_endian (
+        )
+        {
+            const unsigned long temp = 1;
+            return *reinterpret_cast<const unsigned char*>(&temp) == 1;
+        }
+
+        inline void flip_bulk_elements (
+            char* data,
+            long num,
+            unsigned char size
+        )
+        {
+            for (long i = 0; i < num; ++i, data += size)
+                std::reverse(data, data + size);
+        }
+
+        struct bulk_header
+        {
+            bool little_endian;
+            unsigned char kind;
+            unsigned char size;
+            long nr;
+            long nc;
+        };
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    inline void set_bulk_serialization (
+        std::ios_base& stream,
+        bool enabled
+    )
+    /*!
+        ensures
+            - #bulk_serialization_enabled(stream) == enabled
+            - When enabled, serialize() writes std::vector, dlib::matrix and dlib::array2d
+              objects that contain float, double or non-char integral values to stream as
+              one contiguous block of raw values, see the BULK SERIALIZATION FORMAT above.
+              Files written this way can only be read by a deserialize() that knows the
+              format, but any deserialize() in this version reads both formats.
+    !*/
+    {
+        stream.iword(ser_helper::bulk_serialization_index()) = enabled ? 1 : 0;
+    }
+
+    inline bool bulk_serialization_enabled (
+        std::ios_base& stream
+    )
+    {
+        return stream.iword(ser_helper::bulk_serialization_index()) != 0;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    namespace ser_helper
+    {
+        template <typename T>
+        typename enable_if_c<bulk_type<T>::value,bool>::type serialize_bulk (
+            const T* data,
+            long nr,
+            long nc,
+            std::ostream& out
+        )
+        /*!
+            requires
+                - data points to nr*nc values stored in row major order
+            ensures
+                - if (bulk_serialization_enabled(out)) then
+                    - writes the values to out as a bulk block and returns true
+                - else
+                    - writes nothing and returns false
+        !*/
+        {
+            if (!bulk_serialization_enabled(out))
+                return false;
+
+            const char header[5] = {
+                static_cast<char>(bulk_marker),
+                static_cast<char>(bulk_version),
+                static_cast<char>(host_is_little_endian() ? 1 : 0),
+                static_cast<char>(bulk_type<T>::kind),
+                static_cast<char>(sizeof(T))
+            };
+            std::streambuf* sbuf = out.rdbuf();
+            if (sbuf->sputn(header, 5) != 5)
+                throw serialization_error("Error writing bulk block header");
+            serialize(nr, out);
+            serialize(nc, out);
+
+            const std::streamsize bytes = static_cast<std::streamsize>(nr*nc*sizeof(T));
+            if (bytes != 0 && sbuf->sputn(reinterpret_cast<const char*>(data), bytes) != bytes)
+                throw serialization_error("Error writing bulk block data");
+            return true;
+        }
+
+        template <typename T>
+        typename disable_if_c<bulk_type<T>::value,bool>::type serialize_bulk (
+            const T* ,
+            long ,
+            long ,
+            std::ostream& 
+        ) { return false; }
+
+    // ------------------------------------------------------------------------------------
+
+        inline bool deserialize_bulk_header (
+            bulk_header& header,
+            std::istream& in
+        )
+        /*!
+            ensures
+                - if (the next thing in in is a bulk block) then
+                    - reads the bulk block header and the dimensions that follow it into
+                      #header, leaving the values themselves in the stream.
+                    - returns true
+                - else
+                    - reads nothing and returns false.  This is always the case for data
+                      in the older element by element format since the integer control
+                      byte that starts it never has any of the bits in 0x70 set.
+        !*/
+        {
+            std::streambuf* sbuf = in.rdbuf();
+            if (sbuf->sgetc() != static_cast<int>(bulk_marker))
+                return false;
+
+            unsigned char buf[5];
+            if (sbuf->sgetn(reinterpret_cast<char*>(buf), 5) != 5)
+                throw serialization_error("Error reading bulk block header");
+            if (buf[1] != bulk_version)
+                throw serialization_error("Unsupported bulk block version found while deserializing");
+
+            header.little_endian = buf[2] != 0;
+            header.kind = buf[3];
+            header.size = buf[4];
+            const bool valid_size = header.kind == bulk_float ?
+                (header.size == 4 || header.size == 8) :
+                (header.size == 1 || header.size == 2 || header.size == 4 || header.size == 8);
+            if (header.kind > bulk_float || !valid_size)
+                throw serialization_error("Invalid element type found in bulk block header");
+
+            deserialize(header.nr, in);
+            deserialize(header.nc, in);
+            if (header.nr < 0 || header.nc < 0 ||
+                (header.nr != 0 && header.nc > std::numeric_limits<long>::max()/header.size/header.nr))
+                throw serialization_error("Invalid dimensions found in bulk block header");
+            return true;
+        }
+
+    // ------------------------------------------------------------------------------------
+
+        template <typename S, typename T>
+        void convert_bulk_elements (
+            const char* src,
+            T* dest,
+            long num,
+            bool flip
+        )
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                S value;
+                std::memcpy(&value, src + i*sizeof(S), sizeof(S));
+                if (flip)
+                    std::reverse(reinterpret_cast<char*>(&value), reinterpret_cast<char*>(&value) + sizeof(S));
+                dest[i] = static_cast<T>(value);
+                if (!is_float_type<T>::value && 
+                    (static_cast<S>(dest[i]) != value || (dest[i] < T()) != (value < S())))
+                    throw serialization_error("Value in bulk block does not fit in the type being deserialized");
+            }
+        }
+
+        template <typename T>
+        typename enable_if_c<bulk_type<T>::value>::type deserialize_bulk (
+            T* data,
+            const bulk_header& header,
+            std::istream& in
+        )
+        /*!
+            requires
+                - header was just read from in by deserialize_bulk_header()
+                - data points to header.nr*header.nc values
+            ensures
+                - reads the values of the bulk block into data, in row major order.  Blocks
+                  written by a host of the other byte order or with a different size of the
+                  same kind of value are converted, as long as every value fits in T.
+        !*/
+        {
+            const long num = header.nr*header.nc;
+            if (num == 0)
+                return;
+            if (header.kind != bulk_type<T>::kind)
+                throw serialization_error("Bulk block holds a different kind of value than the one being deserialized");
+
+            std::streambuf* sbuf = in.rdbuf();
+            const bool flip = header.little_endian != host_is_little_endian();
+            const std::streamsize bytes = static_cast<std::streamsize>(num)*header.size;
+            if (header.size == sizeof(T))
+            {
+                if (sbuf->sgetn(reinterpret_cast<char*>(data), bytes) != bytes)
+                    throw serialization_error("Error reading bulk block data");
+                if (flip)
+                    flip_bulk_elements(reinterpret_cast<char*>(data), num, header.size);
+                return;
+            }
+
+            std::vector<char> buf(static_cast<size_t>(bytes));
+            if (sbuf->sgetn(&buf[0], bytes) != bytes)
+                throw serialization_error("Error reading bulk block data");
+            if (header.kind == bulk_float)
+            {
+                if (header.size == 4) convert_bulk_elements<float>(&buf[0], data, num, flip);
+                else                  convert_bulk_elements<double>(&buf[0], data, num, flip);
+            }
+            else if (header.kind == bulk_signed)
+            {
+                switch (header.size)
+                {
+                    case 1: convert_bulk_elements<signed char>(&buf[0], data, num, flip); break;
+                    case 2: convert_bulk_elements<int16>(&buf[0], data, num, flip); break;
+                    case 4: convert_bulk_elements<int32>(&buf[0], data, num, flip); break;
+                    default: convert_bulk_elements<int64>(&buf[0], data, num, flip); break;
+                }
+            }
+            else
+            {
+                switch (header.size)
+                {
+                    case 1: convert_bulk_elements<uint8>(&buf[0], data, num, flip); break;
+                    case 2: convert_bulk_elements<uint16>(&buf[0], data, num, flip); break;
+                    case 4: convert_bulk_elements<uint32>(&buf[0], data, num, flip); break;
+                    default: convert_bulk_elements<uint64>(&buf[0], data, num, flip); break;
+                }
+            }
+        }
+
+        template <typename T>
+        typename disable_if_c<bulk_type<T>::value>::type deserialize_bulk (
+            T* ,
+            const bulk_header& ,
+            std::istream& 
+        )
+        {
+            throw serialization_error("Found a bulk block while deserializing a type that has no bulk format");
+        }
+    }
+
 // ----------------------------------------------------------------------------------------
 // prototypes
 
@@ -951,6 +1262,9 @@ namespace dlib
     {
         try
         { 
+            if (item.size() != 0 && ser_helper::serialize_bulk(&item[0], item.size(), 1, out))
+                return;
+
             const unsigned long size = static_cast<unsigned long>(item.size());
 
             serialize(size,out); 
@@ -969,6 +1283,15 @@ namespace dlib
     {
         try 
         { 
+            ser_helper::bulk_header header;
+            if (ser_helper::deserialize_bulk_header(header, in))
+            {
+                item.resize(header.nr*header.nc);
+                if (item.size() != 0)
+                    ser_helper::deserialize_bulk(&item[0], header, in);
+                return;
+            }
+
             unsigned long size;
             deserialize(size,in); 
             item.resize(size);
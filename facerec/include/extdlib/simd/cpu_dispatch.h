@@ -0,0 +1,1766 @@
+#ifndef DLIB_SIMD_CPU_DISPATCH_Hh_
+#define DLIB_SIMD_CPU_DISPATCH_Hh_
+
+#include "simd_check.h"
+#include <algorithm>
+
+#ifdef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+// The kernels below are compiled for several instruction sets regardless of the flags
+// given to the compiler.  GCC and clang need to be told, per function, which instructions
+// they are allowed to emit.  MSVC lets any function use any intrinsic.
+#if defined(DLIB_HAVE_RUNTIME_SIMD_DISPATCH) && !defined(_MSC_VER)
+    #define DLIB_TARGET_SSE2   __attribute__((target("sse2")))
+    #define DLIB_TARGET_AVX    __attribute__((target("avx")))
+    #define DLIB_TARGET_AVX2   __attribute__((target("avx2,fma")))
+    #define DLIB_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+    #define DLIB_TARGET_SSE2
+    #define DLIB_TARGET_AVX
+    #define DLIB_TARGET_AVX2
+    #define DLIB_TARGET_AVX512
+#endif
+
+namespace dlib
+{
+
+// ----------------------------------------------------------------------------------------
+
+    enum simd_instruction_set
+    {
+        simd_scalar = 0,
+        simd_sse2,
+        simd_sse41,
+        simd_avx,
+        simd_avx2,
+        simd_avx512
+    };
+
+    struct cpu_features
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This object records which of the instruction sets dlib has kernels for are
+                usable on the CPU we are running on.  "Usable" means the CPU supports them
+                and, for the AVX family, that the operating system saves the wider
+                registers across context switches.
+        !*/
+
+        cpu_features() : sse2(false), sse41(false), avx(false), avx2(false), fma(false), avx512f(false) {}
+
+        bool sse2;
+        bool sse41;
+        bool avx;
+        bool avx2;
+        bool fma;
+        bool avx512f;
+
+        simd_instruction_set best_instruction_set (
+        ) const
+        {
+            if (avx512f && avx2 && fma) return simd_avx512;
+            if (avx2 && fma)            return simd_avx2;
+            if (avx)                    return simd_avx;
+            if (sse41)                  return simd_sse41;
+            if (sse2)                   return simd_sse2;
+            return simd_scalar;
+        }
+    };
+
+    namespace impl
+    {
+        inline cpu_features detect_cpu_features (
+        )
+        {
+            cpu_features f;
+#ifdef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+            unsigned int regs1[4] = {0,0,0,0};
+            unsigned int regs7[4] = {0,0,0,0};
+            unsigned int max_leaf = 0;
+            unsigned long long xcr0 = 0;
+    #if defined(_MSC_VER)
+            int r[4];
+            __cpuid(r, 0);
+            max_leaf = r[0];
+            __cpuid(r, 1);
+            for (int i = 0; i < 4; ++i) regs1[i] = r[i];
+            if (max_leaf >= 7)
+            {
+                __cpuidex(r, 7, 0);
+                for (int i = 0; i < 4; ++i) regs7[i] = r[i];
+            }
+            if (regs1[2] & (1u<<27))
+                xcr0 = _xgetbv(0);
+    #else
+            unsigned int a, b, c, d;
+            max_leaf = __get_cpuid_max(0, 0);
+            if (max_leaf >= 1)
+            {
+                __cpuid(1, a, b, c, d);
+                regs1[0] = a; regs1[1] = b; regs1[2] = c; regs1[3] = d;
+            }
+            if (max_leaf >= 7)
+            {
+                __cpuid_count(7, 0, a, b, c, d);
+                regs7[0] = a; regs7[1] = b; regs7[2] = c; regs7[3] = d;
+            }
+            if (regs1[2] & (1u<<27))
+            {
+                // xgetbv is only legal to execute when the OS has set OSXSAVE.
+                unsigned int lo, hi;
+                __asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a"(lo), "=d"(hi) : "c"(0));
+                xcr0 = ((unsigned long long)hi << 32) | lo;
+            }
+    #endif
+            const bool os_saves_ymm = (xcr0 & 0x6) == 0x6;
+            const bool os_saves_zmm = (xcr0 & 0xe6) == 0xe6;
+
+            f.sse2    = (regs1[3] & (1u<<26)) != 0;
+            f.sse41   = (regs1[2] & (1u<<19)) != 0;
+            f.avx     = (regs1[2] & (1u<<28)) != 0 && os_saves_ymm;
+            f.fma     = (regs1[2] & (1u<<12)) != 0 && f.avx;
+            f.avx2    = (regs7[1] & (1u<<5))  != 0 && f.avx;
+            f.avx512f = (regs7[1] & (1u<<16)) != 0 && f.avx2 && os_saves_zmm;
+#endif
+            return f;
+        }
+    }
+
+    inline const cpu_features& get_cpu_features (
+    )
+    /*!
+        ensures
+            - returns the features of the CPU this program is running on.  They are
+              detected the first time this function is called.
+    !*/
+    {
+        static const cpu_features features = impl::detect_cpu_features();
+        return features;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+    struct simd_kernels
+    {
+        /*!
+            WHAT THIS OBJECT REPRESENTS
+                This is a table of the inner loops that dominate the run time of the HOG
+                object detector and the shape_predictor.  Each one exists in several
+                versions, one per instruction set, and get_simd_kernels() fills this table
+                with the best versions the running CPU can execute.  So one binary built
+                for the baseline x86 target still runs AVX2 or AVX-512 code where it is
+                available.
+
+                All the kernels use unaligned loads and stores, and none of them care
+                about the stride of the images they are working on since they only ever
+                see single rows.
+        !*/
+
+        simd_instruction_set instruction_set;
+
+        void (*float_row_filter)(const float* in, float* out, long num, const float* filter, long filter_size);
+        /*!
+            ensures
+                - for all 0 <= i < num:
+                    - out[i] == sum over n of in[i+n]*filter[n]
+        !*/
+
+        void (*float_col_filter)(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to);
+        /*!
+            ensures
+                - for all 0 <= i < num:
+                    - let S == sum over m of rows[m][i]*filter[m]
+                    - if (add_to) then
+                        - out[i] += S
+                    - else
+                        - out[i] = S
+        !*/
+
+        void (*fhog_gradient_gray)(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                   float* grad_x, float* grad_y, float* len, long num);
+        /*!
+            requires
+                - row[-1] and row[num] are valid pixels.
+            ensures
+                - for all 0 <= i < num:
+                    - grad_x[i] == row[i+1] - row[i-1]
+                    - grad_y[i] == below[i] - above[i]
+                    - len[i] == grad_x[i]^2 + grad_y[i]^2
+        !*/
+
+        void (*fhog_gradient_rgb)(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                  float* grad_x, float* grad_y, float* len, long num);
+        /*!
+            requires
+                - the row pointers point to num interleaved RGB triples.  The pixels just
+                  before and just after each row are valid.
+            ensures
+                - Computes the same gradient as fhog_gradient_gray() for each colour
+                  channel and keeps, for each pixel, the channel with the largest len.
+                  This is the same rule dlib's fhog uses for RGB images.
+        !*/
+
+        void (*blend_rows)(const unsigned char* top, const unsigned char* bottom, unsigned short* out, long num, int frac);
+        /*!
+            requires
+                - 0 <= frac <= 256
+            ensures
+                - for all 0 <= i < num:
+                    - out[i] == top[i]*(256-frac) + bottom[i]*frac
+                  That is, out is the blend of the two rows in 8.8 fixed point.
+        !*/
+
+        void (*add_to)(float* dest, const float* src, long num);
+        /*!
+            ensures
+                - for all 0 <= i < num:
+                    - dest[i] += src[i]
+        !*/
+
+        void (*float_interleaved_filter)(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to);
+        /*!
+            requires
+                - filter_size is a multiple of 16
+                - rows[m] is valid for all 0 <= m < num_rows
+            ensures
+                - Computes num dot products of length num_rows*filter_size, one per output,
+                  with the input window of output i starting i*stride elements further
+                  along each row than the one before.  That is, for all 0 <= i < num:
+                    - let S == sum over m and n of rows[m][i*stride+n]*filter[m*filter_size+n]
+                    - if (add_to) then
+                        - out[i] += S
+                    - else
+                        - out[i] = S
+                - This is a whole filter applied to an image whose planes are stored
+                  interleaved, stride values per pixel.  Several outputs are accumulated
+                  in registers at once, so each filter vector is loaded once per group of
+                  outputs rather than once per output.
+        !*/
+
+        void (*int16_interleave)(const short* a, const short* b, int* out, long num);
+        /*!
+            ensures
+                - for all 0 <= i < num:
+                    - out[i] holds the pair (a[i], b[i]).  That is, a[i] is in the low 16
+                      bits of out[i] and b[i] in the high 16 bits.
+                - This is the layout the int16_pair_filter kernels expect for both their
+                  inputs and their filters.  pmaddwd multiplies such a pair by a pair of
+                  filter taps and adds the two products, so the pairing is done once here
+                  instead of once per tap.
+        !*/
+
+        void (*int16_pair_filter_add)(const int* const* pairs, int* out, long num, const int* filter, long num_pairs);
+        /*!
+            requires
+                - pairs[k] and filter[k] are valid for all 0 <= k < num_pairs and hold
+                  pairs made by int16_interleave().
+            ensures
+                - Let lo(x) and hi(x) denote the low and high half of the pair x and
+                  let S(i) == sum over k of lo(pairs[k][i])*lo(filter[k]) +
+                  hi(pairs[k][i])*hi(filter[k]).  Then for all 0 <= i < num:
+                    - out[i] += S(i)
+                - S(i) is computed in 32 bit integers, so the caller must make sure it
+                  can't overflow.
+        !*/
+
+        void (*int16_pair_filter_shift)(const int* const* pairs, short* out, long num, const int* filter, long num_pairs, int shift);
+        /*!
+            requires
+                - the same as for int16_pair_filter_add()
+                - 0 <= shift < 31
+            ensures
+                - for all 0 <= i < num:
+                    - out[i] == S(i)/2^shift, rounded to the nearest integer and
+                      saturated to the range of a short.
+        !*/
+
+        void (*int16_pair_filter)(const int* const* pairs, float* out, long num, const int* filter, long num_pairs, float scale, bool add_to);
+        /*!
+            requires
+                - the same as for int16_pair_filter_add()
+            ensures
+                - for all 0 <= i < num:
+                    - if (add_to) then
+                        - out[i] += scale*S(i)
+                    - else
+                        - out[i] = scale*S(i)
+        !*/
+
+        void (*complex_radix4)(double* const* re, double* const* im, long num, const double* w, bool inverse);
+        /*!
+            requires
+                - re[k] and im[k] point to num values for all 0 <= k < 4
+                - w points to 4 values
+            ensures
+                - Does num radix-4 FFT butterflies at once, one per column of the four
+                  rows of complex values given as separate real and imaginary parts.  Let
+                  a0..a3 be the values of a column, w1 == (w[0],w[1]), w2 == (w[2],w[3])
+                  and j == -i, or +i if inverse is true.  Then the column is replaced by:
+                    - d0 == a0 + w2*a1, d1 == a0 - w2*a1
+                    - c0 == a2 + w2*a3, c1 == a2 - w2*a3
+                    - row 0 == d0 + w1*c0, row 2 == d0 - w1*c0
+                    - row 1 == d1 + j*w1*c1, row 3 == d1 - j*w1*c1
+                  This merges four transforms of length m, stored in bit reversed order,
+                  into one of length 4m when w1 == W^k and w2 == W^2k for the k-th column
+                  of the pass, where W is the length 4m root of unity.
+        !*/
+
+        void (*bilinear_row)(const unsigned char* top, const unsigned char* bottom, float* out, long num, const float* weights);
+        /*!
+            requires
+                - top and bottom point to num+1 values
+                - weights points to 4 values
+            ensures
+                - for all 0 <= i < num:
+                    - out[i] == weights[0]*top[i] + weights[1]*top[i+1] +
+                                weights[2]*bottom[i] + weights[3]*bottom[i+1]
+                  That is, out is a row of an image sampled with bilinear interpolation at
+                  the same fractional offset from every pixel, as done for the patches
+                  compared by optical flow.
+        !*/
+
+        void (*patch_mismatch)(const float* a, const float* b, const float* grad_x, const float* grad_y, long num, float* sums);
+        /*!
+            ensures
+                - #sums[0] == sum over 0 <= i < num of (a[i]-b[i])*grad_x[i]
+                - #sums[1] == sum over 0 <= i < num of (a[i]-b[i])*grad_y[i]
+                - This is the right hand side of a Lucas-Kanade step, with a and b the
+                  two patches and grad_x and grad_y the gradients of a.
+        !*/
+
+        void (*grouped_abs_diff)(const unsigned char* a, const unsigned char* b, unsigned int* sums, long num_groups);
+        /*!
+            requires
+                - a and b point to 8*num_groups values
+            ensures
+                - for all 0 <= g < num_groups:
+                    - sums[g] += sum over 0 <= i < 8 of |a[8*g+i] - b[8*g+i]|
+                  That is, the sum of absolute differences of each group of 8 values is
+                  added to its own total.  psadbw produces exactly these sums, which makes
+                  comparing images in tiles 8 pixels wide cheap.
+        !*/
+    };
+
+// ----------------------------------------------------------------------------------------
+//                                  scalar kernels
+// ----------------------------------------------------------------------------------------
+
+    namespace simd_kernels_scalar
+    {
+        inline void float_row_filter(const float* in, float* out, long num, const float* filter, long filter_size)
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                float temp = 0;
+                for (long n = 0; n < filter_size; ++n)
+                    temp += in[i+n]*filter[n];
+                out[i] = temp;
+            }
+        }
+
+        inline void float_col_filter(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to)
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                float temp = 0;
+                for (long m = 0; m < filter_size; ++m)
+                    temp += rows[m][i]*filter[m];
+                if (add_to)
+                    out[i] += temp;
+                else
+                    out[i] = temp;
+            }
+        }
+
+        inline void fhog_gradient_stream(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                         long step, float* grad_x, float* grad_y, float* len, long num)
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                const int gx = (int)row[i+step] - (int)row[i-step];
+                const int gy = (int)below[i] - (int)above[i];
+                grad_x[i] = gx;
+                grad_y[i] = gy;
+                len[i] = gx*gx + gy*gy;
+            }
+        }
+
+        inline void fhog_gradient_gray(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                       float* grad_x, float* grad_y, float* len, long num)
+        {
+            fhog_gradient_stream(above, row, below, 1, grad_x, grad_y, len, num);
+        }
+
+        inline void blend_rows(const unsigned char* top, const unsigned char* bottom, unsigned short* out, long num, int frac)
+        {
+            const int inv_frac = 256-frac;
+            for (long i = 0; i < num; ++i)
+                out[i] = top[i]*inv_frac + bottom[i]*frac;
+        }
+
+        inline void add_to(float* dest, const float* src, long num)
+        {
+            for (long i = 0; i < num; ++i)
+                dest[i] += src[i];
+        }
+
+        inline void float_interleaved_filter(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to)
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                float temp = 0;
+                for (long m = 0; m < num_rows; ++m)
+                {
+                    const float* in = rows[m] + i*stride;
+                    const float* f = filter + m*filter_size;
+                    for (long n = 0; n < filter_size; ++n)
+                        temp += in[n]*f[n];
+                }
+                if (add_to)
+                    out[i] += temp;
+                else
+                    out[i] = temp;
+            }
+        }
+
+        inline void int16_interleave(const short* a, const short* b, int* out, long num)
+        {
+            for (long i = 0; i < num; ++i)
+                out[i] = (int)(((unsigned int)(unsigned short)b[i]<<16) | (unsigned short)a[i]);
+        }
+
+        inline int int16_pair_sum(const int* const* pairs, long i, const int* filter, long num_pairs)
+        {
+            int temp = 0;
+            for (long k = 0; k < num_pairs; ++k)
+            {
+                const int p = pairs[k][i];
+                temp += (short)(p&0xFFFF)*(short)(filter[k]&0xFFFF) + (short)(p>>16)*(short)(filter[k]>>16);
+            }
+            return temp;
+        }
+
+        inline short int16_round_shift(int value, int shift)
+        {
+            const int round = shift > 0 ? 1<<(shift-1) : 0;
+            return (short)std::max(-32768, std::min(32767, (value + round)>>shift));
+        }
+
+        inline void int16_pair_filter_add(const int* const* pairs, int* out, long num, const int* filter, long num_pairs)
+        {
+            for (long i = 0; i < num; ++i)
+                out[i] += int16_pair_sum(pairs, i, filter, num_pairs);
+        }
+
+        inline void int16_pair_filter_shift(const int* const* pairs, short* out, long num, const int* filter, long num_pairs, int shift)
+        {
+            for (long i = 0; i < num; ++i)
+                out[i] = int16_round_shift(int16_pair_sum(pairs, i, filter, num_pairs), shift);
+        }
+
+        inline void int16_pair_filter(const int* const* pairs, float* out, long num, const int* filter, long num_pairs, float scale, bool add_to)
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                const float temp = int16_pair_sum(pairs, i, filter, num_pairs)*scale;
+                if (add_to)
+                    out[i] += temp;
+                else
+                    out[i] = temp;
+            }
+        }
+
+        template <typename T>
+        inline void complex_radix4(T* const* re, T* const* im, long num, const T* w, bool inverse)
+        {
+            const T w1r = w[0], w1i = w[1], w2r = w[2], w2i = w[3];
+            for (long i = 0; i < num; ++i)
+            {
+                const T t1r = w2r*re[1][i] - w2i*im[1][i], t1i = w2r*im[1][i] + w2i*re[1][i];
+                const T t3r = w2r*re[3][i] - w2i*im[3][i], t3i = w2r*im[3][i] + w2i*re[3][i];
+                const T d0r = re[0][i] + t1r, d0i = im[0][i] + t1i;
+                const T d1r = re[0][i] - t1r, d1i = im[0][i] - t1i;
+                const T c0r = re[2][i] + t3r, c0i = im[2][i] + t3i;
+                const T c1r = re[2][i] - t3r, c1i = im[2][i] - t3i;
+                const T u0r = w1r*c0r - w1i*c0i, u0i = w1r*c0i + w1i*c0r;
+                const T v1r = w1r*c1r - w1i*c1i, v1i = w1r*c1i + w1i*c1r;
+                const T u1r = inverse ? -v1i : v1i, u1i = inverse ? v1r : -v1r;
+                re[0][i] = d0r + u0r; im[0][i] = d0i + u0i;
+                re[2][i] = d0r - u0r; im[2][i] = d0i - u0i;
+                re[1][i] = d1r + u1r; im[1][i] = d1i + u1i;
+                re[3][i] = d1r - u1r; im[3][i] = d1i - u1i;
+            }
+        }
+
+        inline void bilinear_row(const unsigned char* top, const unsigned char* bottom, float* out, long num, const float* weights)
+        {
+            for (long i = 0; i < num; ++i)
+                out[i] = (weights[0]*top[i] + weights[1]*top[i+1]) + (weights[2]*bottom[i] + weights[3]*bottom[i+1]);
+        }
+
+        inline void patch_mismatch(const float* a, const float* b, const float* grad_x, const float* grad_y, long num, float* sums)
+        {
+            float sx = 0, sy = 0;
+            for (long i = 0; i < num; ++i)
+            {
+                const float d = a[i]-b[i];
+                sx += d*grad_x[i];
+                sy += d*grad_y[i];
+            }
+            sums[0] = sx;
+            sums[1] = sy;
+        }
+
+        inline void grouped_abs_diff(const unsigned char* a, const unsigned char* b, unsigned int* sums, long num_groups)
+        {
+            for (long g = 0; g < num_groups; ++g)
+            {
+                unsigned int sum = 0;
+                for (long i = 8*g; i < 8*g+8; ++i)
+                    sum += a[i] < b[i] ? b[i]-a[i] : a[i]-b[i];
+                sums[g] += sum;
+            }
+        }
+    }
+
+    namespace impl
+    {
+        // Given the per channel gradients of chunk_size RGB pixels, pick the strongest
+        // channel of each pixel.  Ties go to the later channel, like in fhog.h.
+        inline void select_strongest_rgb_channel (
+            const float* cgx,
+            const float* cgy,
+            const float* clen,
+            float* grad_x,
+            float* grad_y,
+            float* len,
+            long num
+        )
+        {
+            for (long i = 0; i < num; ++i)
+            {
+                long best = 3*i;
+                if (!(clen[best] > clen[3*i+1])) best = 3*i+1;
+                if (!(clen[best] > clen[3*i+2])) best = 3*i+2;
+                grad_x[i] = cgx[best];
+                grad_y[i] = cgy[best];
+                len[i] = clen[best];
+            }
+        }
+
+        template <void (*stream)(const unsigned char*, const unsigned char*, const unsigned char*, long, float*, float*, float*, long)>
+        inline void fhog_gradient_rgb_chunked (
+            const unsigned char* above,
+            const unsigned char* row,
+            const unsigned char* below,
+            float* grad_x,
+            float* grad_y,
+            float* len,
+            long num
+        )
+        {
+            const long chunk = 16;
+            float cgx[3*chunk], cgy[3*chunk], clen[3*chunk];
+            for (long i = 0; i < num; i += chunk)
+            {
+                const long n = std::min(chunk, num-i);
+                stream(above+3*i, row+3*i, below+3*i, 3, cgx, cgy, clen, 3*n);
+                select_strongest_rgb_channel(cgx, cgy, clen, grad_x+i, grad_y+i, len+i, n);
+            }
+        }
+    }
+
+#ifdef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+
+// ----------------------------------------------------------------------------------------
+//                                  SSE2 kernels
+// ----------------------------------------------------------------------------------------
+
+    namespace simd_kernels_sse2
+    {
+        DLIB_TARGET_SSE2 inline void float_row_filter(const float* in, float* out, long num, const float* filter, long filter_size)
+        {
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m128 acc0 = _mm_setzero_ps();
+                __m128 acc1 = _mm_setzero_ps();
+                for (long n = 0; n < filter_size; ++n)
+                {
+                    const __m128 f = _mm_set1_ps(filter[n]);
+                    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in+i+n), f));
+                    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in+i+n+4), f));
+                }
+                _mm_storeu_ps(out+i, acc0);
+                _mm_storeu_ps(out+i+4, acc1);
+            }
+            simd_kernels_scalar::float_row_filter(in+i, out+i, num-i, filter, filter_size);
+        }
+
+        DLIB_TARGET_SSE2 inline void float_col_filter(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to)
+        {
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m128 acc0 = _mm_setzero_ps();
+                __m128 acc1 = _mm_setzero_ps();
+                for (long m = 0; m < filter_size; ++m)
+                {
+                    const __m128 f = _mm_set1_ps(filter[m]);
+                    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(rows[m]+i), f));
+                    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(rows[m]+i+4), f));
+                }
+                if (add_to)
+                {
+                    acc0 = _mm_add_ps(acc0, _mm_loadu_ps(out+i));
+                    acc1 = _mm_add_ps(acc1, _mm_loadu_ps(out+i+4));
+                }
+                _mm_storeu_ps(out+i, acc0);
+                _mm_storeu_ps(out+i+4, acc1);
+            }
+            for (; i < num; ++i)
+            {
+                float temp = 0;
+                for (long m = 0; m < filter_size; ++m)
+                    temp += rows[m][i]*filter[m];
+                if (add_to)
+                    out[i] += temp;
+                else
+                    out[i] = temp;
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void fhog_gradient_stream(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                          long step, float* grad_x, float* grad_y, float* len, long num)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                const __m128i l = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(row+i-step)), zero);
+                const __m128i r = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(row+i+step)), zero);
+                const __m128i t = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(above+i)), zero);
+                const __m128i b = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(below+i)), zero);
+                const __m128i gx = _mm_sub_epi16(r,l);
+                const __m128i gy = _mm_sub_epi16(b,t);
+
+                // gx*gx+gy*gy, 4 pixels at a time, straight out of pmaddwd.
+                const __m128i xy_lo = _mm_unpacklo_epi16(gx,gy);
+                const __m128i xy_hi = _mm_unpackhi_epi16(gx,gy);
+                _mm_storeu_ps(len+i,   _mm_cvtepi32_ps(_mm_madd_epi16(xy_lo,xy_lo)));
+                _mm_storeu_ps(len+i+4, _mm_cvtepi32_ps(_mm_madd_epi16(xy_hi,xy_hi)));
+
+                // sign extend the 16 bit gradients to 32 bits.
+                _mm_storeu_ps(grad_x+i,   _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(gx,gx),16)));
+                _mm_storeu_ps(grad_x+i+4, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(gx,gx),16)));
+                _mm_storeu_ps(grad_y+i,   _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(gy,gy),16)));
+                _mm_storeu_ps(grad_y+i+4, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(gy,gy),16)));
+            }
+            simd_kernels_scalar::fhog_gradient_stream(above+i, row+i, below+i, step, grad_x+i, grad_y+i, len+i, num-i);
+        }
+
+        DLIB_TARGET_SSE2 inline void fhog_gradient_gray(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                        float* grad_x, float* grad_y, float* len, long num)
+        {
+            fhog_gradient_stream(above, row, below, 1, grad_x, grad_y, len, num);
+        }
+
+        inline void fhog_gradient_rgb(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                      float* grad_x, float* grad_y, float* len, long num)
+        {
+            impl::fhog_gradient_rgb_chunked<fhog_gradient_stream>(above, row, below, grad_x, grad_y, len, num);
+        }
+
+        DLIB_TARGET_SSE2 inline void blend_rows(const unsigned char* top, const unsigned char* bottom, unsigned short* out, long num, int frac)
+        {
+            // top*(256-frac) + bottom*frac is at most 255*256, so the math fits in 16 bits.
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i f = _mm_set1_epi16((short)frac);
+            const __m128i inv_f = _mm_set1_epi16((short)(256-frac));
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m128i t = _mm_loadu_si128((const __m128i*)(top+i));
+                const __m128i b = _mm_loadu_si128((const __m128i*)(bottom+i));
+                const __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(t,zero), inv_f),
+                                                 _mm_mullo_epi16(_mm_unpacklo_epi8(b,zero), f));
+                const __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(t,zero), inv_f),
+                                                 _mm_mullo_epi16(_mm_unpackhi_epi8(b,zero), f));
+                _mm_storeu_si128((__m128i*)(out+i), lo);
+                _mm_storeu_si128((__m128i*)(out+i+8), hi);
+            }
+            simd_kernels_scalar::blend_rows(top+i, bottom+i, out+i, num-i, frac);
+        }
+
+        DLIB_TARGET_SSE2 inline void add_to(float* dest, const float* src, long num)
+        {
+            long i = 0;
+            for (; i + 4 <= num; i += 4)
+                _mm_storeu_ps(dest+i, _mm_add_ps(_mm_loadu_ps(dest+i), _mm_loadu_ps(src+i)));
+            simd_kernels_scalar::add_to(dest+i, src+i, num-i);
+        }
+
+        // Computes the outputs i through i+3 of float_interleaved_filter().
+        DLIB_TARGET_SSE2 inline __m128 float_interleaved_sums(const float* const* rows, long i, long stride, const float* filter, long num_rows, long filter_size)
+        {
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+            __m128 acc2 = _mm_setzero_ps();
+            __m128 acc3 = _mm_setzero_ps();
+            for (long m = 0; m < num_rows; ++m)
+            {
+                const float* in = rows[m] + i*stride;
+                const float* f = filter + m*filter_size;
+                for (long n = 0; n < filter_size; n += 4)
+                {
+                    const __m128 fv = _mm_loadu_ps(f+n);
+                    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in+n), fv));
+                    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in+stride+n), fv));
+                    acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(in+2*stride+n), fv));
+                    acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(in+3*stride+n), fv));
+                }
+            }
+            _MM_TRANSPOSE4_PS(acc0, acc1, acc2, acc3);
+            return _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3));
+        }
+
+        DLIB_TARGET_SSE2 inline void float_interleaved_filter(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to)
+        {
+            if (num < 4)
+                return simd_kernels_scalar::float_interleaved_filter(rows, out, num, stride, filter, num_rows, filter_size, add_to);
+            long i = 0;
+            for (; i + 4 <= num; i += 4)
+            {
+                __m128 sums = float_interleaved_sums(rows, i, stride, filter, num_rows, filter_size);
+                if (add_to)
+                    sums = _mm_add_ps(sums, _mm_loadu_ps(out+i));
+                _mm_storeu_ps(out+i, sums);
+            }
+            if (i < num)
+            {
+                // Recompute the last 4 outputs, overlapping the previous group, and only
+                // use the ones that weren't done yet.
+                float sums[4];
+                _mm_storeu_ps(sums, float_interleaved_sums(rows, num-4, stride, filter, num_rows, filter_size));
+                for (long j = i-(num-4); i < num; ++i, ++j)
+                    out[i] = add_to ? out[i] + sums[j] : sums[j];
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void int16_interleave(const short* a, const short* b, int* out, long num)
+        {
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                const __m128i x = _mm_loadu_si128((const __m128i*)(a+i));
+                const __m128i y = _mm_loadu_si128((const __m128i*)(b+i));
+                _mm_storeu_si128((__m128i*)(out+i),   _mm_unpacklo_epi16(x,y));
+                _mm_storeu_si128((__m128i*)(out+i+4), _mm_unpackhi_epi16(x,y));
+            }
+            simd_kernels_scalar::int16_interleave(a+i, b+i, out+i, num-i);
+        }
+
+        // Computes the sums for outputs i through i+7, 0-3 in acc0 and 4-7 in acc1.
+        DLIB_TARGET_SSE2 inline void int16_pair_sums(const int* const* pairs, long i, const int* filter, long num_pairs, __m128i& acc0, __m128i& acc1)
+        {
+            acc0 = _mm_setzero_si128();
+            acc1 = _mm_setzero_si128();
+            for (long k = 0; k < num_pairs; ++k)
+            {
+                const __m128i f = _mm_set1_epi32(filter[k]);
+                const int* p = pairs[k]+i;
+                acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_loadu_si128((const __m128i*)p), f));
+                acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(p+4)), f));
+            }
+        }
+
+        // The last few outputs of a row don't fill a whole block.  Rather than falling
+        // back to scalar code for them, the last block is computed over the final 8
+        // outputs, overlapping the previous one, and only the new sums are used.
+        DLIB_TARGET_SSE2 inline long int16_pair_tail(const int* const* pairs, long i, long num, const int* filter, long num_pairs, int* sums)
+        {
+            __m128i acc0, acc1;
+            int16_pair_sums(pairs, num-8, filter, num_pairs, acc0, acc1);
+            _mm_storeu_si128((__m128i*)sums, acc0);
+            _mm_storeu_si128((__m128i*)(sums+4), acc1);
+            return i-(num-8);
+        }
+
+        DLIB_TARGET_SSE2 inline void int16_pair_filter_add(const int* const* pairs, int* out, long num, const int* filter, long num_pairs)
+        {
+            if (num < 8)
+                return simd_kernels_scalar::int16_pair_filter_add(pairs, out, num, filter, num_pairs);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m128i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                _mm_storeu_si128((__m128i*)(out+i),   _mm_add_epi32(acc0, _mm_loadu_si128((const __m128i*)(out+i))));
+                _mm_storeu_si128((__m128i*)(out+i+4), _mm_add_epi32(acc1, _mm_loadu_si128((const __m128i*)(out+i+4))));
+            }
+            if (i < num)
+            {
+                int sums[8];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                    out[i] += sums[j];
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void int16_pair_filter_shift(const int* const* pairs, short* out, long num, const int* filter, long num_pairs, int shift)
+        {
+            if (num < 8)
+                return simd_kernels_scalar::int16_pair_filter_shift(pairs, out, num, filter, num_pairs, shift);
+            const __m128i round = _mm_set1_epi32(shift > 0 ? 1<<(shift-1) : 0);
+            const __m128i count = _mm_cvtsi32_si128(shift);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m128i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                acc0 = _mm_sra_epi32(_mm_add_epi32(acc0, round), count);
+                acc1 = _mm_sra_epi32(_mm_add_epi32(acc1, round), count);
+                _mm_storeu_si128((__m128i*)(out+i), _mm_packs_epi32(acc0, acc1));
+            }
+            if (i < num)
+            {
+                int sums[8];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                    out[i] = simd_kernels_scalar::int16_round_shift(sums[j], shift);
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void int16_pair_filter(const int* const* pairs, float* out, long num, const int* filter, long num_pairs, float scale, bool add_to)
+        {
+            if (num < 8)
+                return simd_kernels_scalar::int16_pair_filter(pairs, out, num, filter, num_pairs, scale, add_to);
+            const __m128 s = _mm_set1_ps(scale);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m128i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                __m128 r0 = _mm_mul_ps(_mm_cvtepi32_ps(acc0), s);
+                __m128 r1 = _mm_mul_ps(_mm_cvtepi32_ps(acc1), s);
+                if (add_to)
+                {
+                    r0 = _mm_add_ps(r0, _mm_loadu_ps(out+i));
+                    r1 = _mm_add_ps(r1, _mm_loadu_ps(out+i+4));
+                }
+                _mm_storeu_ps(out+i, r0);
+                _mm_storeu_ps(out+i+4, r1);
+            }
+            if (i < num)
+            {
+                int sums[8];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                {
+                    if (add_to)
+                        out[i] += sums[j]*scale;
+                    else
+                        out[i] = sums[j]*scale;
+                }
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void complex_radix4(double* const* re, double* const* im, long num, const double* w, bool inverse)
+        {
+            const __m128d w1r = _mm_set1_pd(w[0]), w1i = _mm_set1_pd(w[1]);
+            const __m128d w2r = _mm_set1_pd(w[2]), w2i = _mm_set1_pd(w[3]);
+            // j*v is (v.i, -v.r) going forward and (-v.i, v.r) going backward
+            const __m128d sign = _mm_set1_pd(inverse ? -1.0 : 1.0);
+            long i = 0;
+            for (; i + 2 <= num; i += 2)
+            {
+                const __m128d a1r = _mm_loadu_pd(re[1]+i), a1i = _mm_loadu_pd(im[1]+i);
+                const __m128d a3r = _mm_loadu_pd(re[3]+i), a3i = _mm_loadu_pd(im[3]+i);
+                const __m128d t1r = _mm_sub_pd(_mm_mul_pd(w2r, a1r), _mm_mul_pd(w2i, a1i));
+                const __m128d t1i = _mm_add_pd(_mm_mul_pd(w2r, a1i), _mm_mul_pd(w2i, a1r));
+                const __m128d t3r = _mm_sub_pd(_mm_mul_pd(w2r, a3r), _mm_mul_pd(w2i, a3i));
+                const __m128d t3i = _mm_add_pd(_mm_mul_pd(w2r, a3i), _mm_mul_pd(w2i, a3r));
+                const __m128d a0r = _mm_loadu_pd(re[0]+i), a0i = _mm_loadu_pd(im[0]+i);
+                const __m128d a2r = _mm_loadu_pd(re[2]+i), a2i = _mm_loadu_pd(im[2]+i);
+                const __m128d d0r = _mm_add_pd(a0r, t1r), d0i = _mm_add_pd(a0i, t1i);
+                const __m128d d1r = _mm_sub_pd(a0r, t1r), d1i = _mm_sub_pd(a0i, t1i);
+                const __m128d c0r = _mm_add_pd(a2r, t3r), c0i = _mm_add_pd(a2i, t3i);
+                const __m128d c1r = _mm_sub_pd(a2r, t3r), c1i = _mm_sub_pd(a2i, t3i);
+                const __m128d u0r = _mm_sub_pd(_mm_mul_pd(w1r, c0r), _mm_mul_pd(w1i, c0i));
+                const __m128d u0i = _mm_add_pd(_mm_mul_pd(w1r, c0i), _mm_mul_pd(w1i, c0r));
+                const __m128d v1r = _mm_sub_pd(_mm_mul_pd(w1r, c1r), _mm_mul_pd(w1i, c1i));
+                const __m128d v1i = _mm_add_pd(_mm_mul_pd(w1r, c1i), _mm_mul_pd(w1i, c1r));
+                const __m128d u1r = _mm_mul_pd(sign, v1i);
+                const __m128d u1i = _mm_sub_pd(_mm_setzero_pd(), _mm_mul_pd(sign, v1r));
+                _mm_storeu_pd(re[0]+i, _mm_add_pd(d0r, u0r)); _mm_storeu_pd(im[0]+i, _mm_add_pd(d0i, u0i));
+                _mm_storeu_pd(re[2]+i, _mm_sub_pd(d0r, u0r)); _mm_storeu_pd(im[2]+i, _mm_sub_pd(d0i, u0i));
+                _mm_storeu_pd(re[1]+i, _mm_add_pd(d1r, u1r)); _mm_storeu_pd(im[1]+i, _mm_add_pd(d1i, u1i));
+                _mm_storeu_pd(re[3]+i, _mm_sub_pd(d1r, u1r)); _mm_storeu_pd(im[3]+i, _mm_sub_pd(d1i, u1i));
+            }
+            if (i < num)
+            {
+                double* const r[4] = { re[0]+i, re[1]+i, re[2]+i, re[3]+i };
+                double* const m[4] = { im[0]+i, im[1]+i, im[2]+i, im[3]+i };
+                simd_kernels_scalar::complex_radix4(r, m, num-i, w, inverse);
+            }
+        }
+
+        DLIB_TARGET_SSE2 inline void bilinear_row(const unsigned char* top, const unsigned char* bottom, float* out, long num, const float* weights)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 w0 = _mm_set1_ps(weights[0]), w1 = _mm_set1_ps(weights[1]);
+            const __m128 w2 = _mm_set1_ps(weights[2]), w3 = _mm_set1_ps(weights[3]);
+            long i = 0;
+            // The loads of the pixels to the right read up to top[i+8], which is still
+            // one of the num+1 valid values.
+            for (; i + 8 <= num; i += 8)
+            {
+                const __m128i t0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(top+i)), zero);
+                const __m128i t1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(top+i+1)), zero);
+                const __m128i b0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(bottom+i)), zero);
+                const __m128i b1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(bottom+i+1)), zero);
+                const __m128 lo = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w0, _mm_cvtepi32_ps(_mm_unpacklo_epi16(t0,zero))),
+                                                        _mm_mul_ps(w1, _mm_cvtepi32_ps(_mm_unpacklo_epi16(t1,zero)))),
+                                             _mm_add_ps(_mm_mul_ps(w2, _mm_cvtepi32_ps(_mm_unpacklo_epi16(b0,zero))),
+                                                        _mm_mul_ps(w3, _mm_cvtepi32_ps(_mm_unpacklo_epi16(b1,zero)))));
+                const __m128 hi = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w0, _mm_cvtepi32_ps(_mm_unpackhi_epi16(t0,zero))),
+                                                        _mm_mul_ps(w1, _mm_cvtepi32_ps(_mm_unpackhi_epi16(t1,zero)))),
+                                             _mm_add_ps(_mm_mul_ps(w2, _mm_cvtepi32_ps(_mm_unpackhi_epi16(b0,zero))),
+                                                        _mm_mul_ps(w3, _mm_cvtepi32_ps(_mm_unpackhi_epi16(b1,zero)))));
+                _mm_storeu_ps(out+i, lo);
+                _mm_storeu_ps(out+i+4, hi);
+            }
+            simd_kernels_scalar::bilinear_row(top+i, bottom+i, out+i, num-i, weights);
+        }
+
+        DLIB_TARGET_SSE2 inline void patch_mismatch(const float* a, const float* b, const float* grad_x, const float* grad_y, long num, float* sums)
+        {
+            __m128 sx = _mm_setzero_ps();
+            __m128 sy = _mm_setzero_ps();
+            long i = 0;
+            for (; i + 4 <= num; i += 4)
+            {
+                const __m128 d = _mm_sub_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i));
+                sx = _mm_add_ps(sx, _mm_mul_ps(d, _mm_loadu_ps(grad_x+i)));
+                sy = _mm_add_ps(sy, _mm_mul_ps(d, _mm_loadu_ps(grad_y+i)));
+            }
+            float temp[4];
+            simd_kernels_scalar::patch_mismatch(a+i, b+i, grad_x+i, grad_y+i, num-i, sums);
+            _mm_storeu_ps(temp, sx);
+            sums[0] += (temp[0]+temp[1]) + (temp[2]+temp[3]);
+            _mm_storeu_ps(temp, sy);
+            sums[1] += (temp[0]+temp[1]) + (temp[2]+temp[3]);
+        }
+
+        DLIB_TARGET_SSE2 inline void grouped_abs_diff(const unsigned char* a, const unsigned char* b, unsigned int* sums, long num_groups)
+        {
+            long g = 0;
+            for (; g + 2 <= num_groups; g += 2)
+            {
+                // psadbw leaves the sums of the two groups in the low bits of each half
+                const __m128i sad = _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(a+8*g)), _mm_loadu_si128((const __m128i*)(b+8*g)));
+                sums[g] += _mm_cvtsi128_si32(sad);
+                sums[g+1] += _mm_cvtsi128_si32(_mm_srli_si128(sad, 8));
+            }
+            simd_kernels_scalar::grouped_abs_diff(a+8*g, b+8*g, sums+g, num_groups-g);
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+//                                  AVX kernels
+// ----------------------------------------------------------------------------------------
+
+    namespace simd_kernels_avx
+    {
+        // AVX only widens the floating point registers, so only the float kernels get an
+        // AVX version.  The integer kernels keep using SSE2.
+
+        DLIB_TARGET_AVX inline void float_row_filter(const float* in, float* out, long num, const float* filter, long filter_size)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256 acc0 = _mm256_setzero_ps();
+                __m256 acc1 = _mm256_setzero_ps();
+                for (long n = 0; n < filter_size; ++n)
+                {
+                    const __m256 f = _mm256_set1_ps(filter[n]);
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(in+i+n), f));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(in+i+n+8), f));
+                }
+                _mm256_storeu_ps(out+i, acc0);
+                _mm256_storeu_ps(out+i+8, acc1);
+            }
+            simd_kernels_sse2::float_row_filter(in+i, out+i, num-i, filter, filter_size);
+        }
+
+        DLIB_TARGET_AVX inline void float_col_filter(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256 acc0 = _mm256_setzero_ps();
+                __m256 acc1 = _mm256_setzero_ps();
+                for (long m = 0; m < filter_size; ++m)
+                {
+                    const __m256 f = _mm256_set1_ps(filter[m]);
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(rows[m]+i), f));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(rows[m]+i+8), f));
+                }
+                if (add_to)
+                {
+                    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(out+i));
+                    acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(out+i+8));
+                }
+                _mm256_storeu_ps(out+i, acc0);
+                _mm256_storeu_ps(out+i+8, acc1);
+            }
+            if (i < num)
+            {
+                const float* tail_rows[64];
+                if (filter_size <= 64)
+                {
+                    for (long m = 0; m < filter_size; ++m)
+                        tail_rows[m] = rows[m]+i;
+                    simd_kernels_sse2::float_col_filter(tail_rows, out+i, num-i, filter, filter_size, add_to);
+                }
+                else
+                {
+                    for (; i < num; ++i)
+                    {
+                        float temp = 0;
+                        for (long m = 0; m < filter_size; ++m)
+                            temp += rows[m][i]*filter[m];
+                        if (add_to)
+                            out[i] += temp;
+                        else
+                            out[i] = temp;
+                    }
+                }
+            }
+        }
+
+        DLIB_TARGET_AVX inline void add_to(float* dest, const float* src, long num)
+        {
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+                _mm256_storeu_ps(dest+i, _mm256_add_ps(_mm256_loadu_ps(dest+i), _mm256_loadu_ps(src+i)));
+            simd_kernels_sse2::add_to(dest+i, src+i, num-i);
+        }
+
+        // Returns the horizontal sums of a0 through a7, in that order.
+        DLIB_TARGET_AVX inline __m256 horizontal_sums(__m256 a0, __m256 a1, __m256 a2, __m256 a3, __m256 a4, __m256 a5, __m256 a6, __m256 a7)
+        {
+            // hadd works within 128 bit lanes, so this leaves the sums of the low
+            // halves of a0-a3 in the low lane of u0 and the sums of their high halves in
+            // the high lane.  Likewise for a4-a7 and u1.
+            const __m256 u0 = _mm256_hadd_ps(_mm256_hadd_ps(a0, a1), _mm256_hadd_ps(a2, a3));
+            const __m256 u1 = _mm256_hadd_ps(_mm256_hadd_ps(a4, a5), _mm256_hadd_ps(a6, a7));
+            return _mm256_add_ps(_mm256_permute2f128_ps(u0, u1, 0x20), _mm256_permute2f128_ps(u0, u1, 0x31));
+        }
+
+        // Computes the outputs i through i+7 of float_interleaved_filter().  The eight
+        // accumulators are spelled out so they stay in registers.
+        DLIB_TARGET_AVX inline __m256 float_interleaved_sums(const float* const* rows, long i, long stride, const float* filter, long num_rows, long filter_size)
+        {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps(), acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+            __m256 acc4 = _mm256_setzero_ps(), acc5 = _mm256_setzero_ps(), acc6 = _mm256_setzero_ps(), acc7 = _mm256_setzero_ps();
+            for (long m = 0; m < num_rows; ++m)
+            {
+                const float* in = rows[m] + i*stride;
+                const float* f = filter + m*filter_size;
+                for (long n = 0; n < filter_size; n += 8)
+                {
+                    const __m256 fv = _mm256_loadu_ps(f+n);
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(in+n), fv));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(in+stride+n), fv));
+                    acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(_mm256_loadu_ps(in+2*stride+n), fv));
+                    acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(_mm256_loadu_ps(in+3*stride+n), fv));
+                    acc4 = _mm256_add_ps(acc4, _mm256_mul_ps(_mm256_loadu_ps(in+4*stride+n), fv));
+                    acc5 = _mm256_add_ps(acc5, _mm256_mul_ps(_mm256_loadu_ps(in+5*stride+n), fv));
+                    acc6 = _mm256_add_ps(acc6, _mm256_mul_ps(_mm256_loadu_ps(in+6*stride+n), fv));
+                    acc7 = _mm256_add_ps(acc7, _mm256_mul_ps(_mm256_loadu_ps(in+7*stride+n), fv));
+                }
+            }
+            return horizontal_sums(acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7);
+        }
+
+        DLIB_TARGET_AVX inline void float_interleaved_filter(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to)
+        {
+            if (num < 8)
+                return simd_kernels_sse2::float_interleaved_filter(rows, out, num, stride, filter, num_rows, filter_size, add_to);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m256 sums = float_interleaved_sums(rows, i, stride, filter, num_rows, filter_size);
+                if (add_to)
+                    sums = _mm256_add_ps(sums, _mm256_loadu_ps(out+i));
+                _mm256_storeu_ps(out+i, sums);
+            }
+            if (i < num)
+            {
+                float sums[8];
+                _mm256_storeu_ps(sums, float_interleaved_sums(rows, num-8, stride, filter, num_rows, filter_size));
+                for (long j = i-(num-8); i < num; ++i, ++j)
+                    out[i] = add_to ? out[i] + sums[j] : sums[j];
+            }
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+//                                  AVX2 kernels
+// ----------------------------------------------------------------------------------------
+
+    namespace simd_kernels_avx2
+    {
+        DLIB_TARGET_AVX2 inline void float_row_filter(const float* in, float* out, long num, const float* filter, long filter_size)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256 acc0 = _mm256_setzero_ps();
+                __m256 acc1 = _mm256_setzero_ps();
+                for (long n = 0; n < filter_size; ++n)
+                {
+                    const __m256 f = _mm256_set1_ps(filter[n]);
+                    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(in+i+n), f, acc0);
+                    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(in+i+n+8), f, acc1);
+                }
+                _mm256_storeu_ps(out+i, acc0);
+                _mm256_storeu_ps(out+i+8, acc1);
+            }
+            simd_kernels_sse2::float_row_filter(in+i, out+i, num-i, filter, filter_size);
+        }
+
+        DLIB_TARGET_AVX2 inline void float_col_filter(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256 acc0 = _mm256_setzero_ps();
+                __m256 acc1 = _mm256_setzero_ps();
+                for (long m = 0; m < filter_size; ++m)
+                {
+                    const __m256 f = _mm256_set1_ps(filter[m]);
+                    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(rows[m]+i), f, acc0);
+                    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(rows[m]+i+8), f, acc1);
+                }
+                if (add_to)
+                {
+                    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(out+i));
+                    acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(out+i+8));
+                }
+                _mm256_storeu_ps(out+i, acc0);
+                _mm256_storeu_ps(out+i+8, acc1);
+            }
+            for (; i < num; ++i)
+            {
+                float temp = 0;
+                for (long m = 0; m < filter_size; ++m)
+                    temp += rows[m][i]*filter[m];
+                if (add_to)
+                    out[i] += temp;
+                else
+                    out[i] = temp;
+            }
+        }
+
+        DLIB_TARGET_AVX2 inline void fhog_gradient_stream(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                          long step, float* grad_x, float* grad_y, float* len, long num)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m256i l = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(row+i-step)));
+                const __m256i r = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(row+i+step)));
+                const __m256i t = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(above+i)));
+                const __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(below+i)));
+                const __m256i gx = _mm256_sub_epi16(r,l);
+                const __m256i gy = _mm256_sub_epi16(b,t);
+
+                const __m256 gx0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(gx)));
+                const __m256 gx1 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(gx,1)));
+                const __m256 gy0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(gy)));
+                const __m256 gy1 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(gy,1)));
+
+                _mm256_storeu_ps(grad_x+i,   gx0);
+                _mm256_storeu_ps(grad_x+i+8, gx1);
+                _mm256_storeu_ps(grad_y+i,   gy0);
+                _mm256_storeu_ps(grad_y+i+8, gy1);
+                // These are small integers so the float math is exact.
+                _mm256_storeu_ps(len+i,   _mm256_fmadd_ps(gx0,gx0,_mm256_mul_ps(gy0,gy0)));
+                _mm256_storeu_ps(len+i+8, _mm256_fmadd_ps(gx1,gx1,_mm256_mul_ps(gy1,gy1)));
+            }
+            simd_kernels_sse2::fhog_gradient_stream(above+i, row+i, below+i, step, grad_x+i, grad_y+i, len+i, num-i);
+        }
+
+        DLIB_TARGET_AVX2 inline void fhog_gradient_gray(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                        float* grad_x, float* grad_y, float* len, long num)
+        {
+            fhog_gradient_stream(above, row, below, 1, grad_x, grad_y, len, num);
+        }
+
+        inline void fhog_gradient_rgb(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                      float* grad_x, float* grad_y, float* len, long num)
+        {
+            impl::fhog_gradient_rgb_chunked<fhog_gradient_stream>(above, row, below, grad_x, grad_y, len, num);
+        }
+
+        DLIB_TARGET_AVX2 inline void blend_rows(const unsigned char* top, const unsigned char* bottom, unsigned short* out, long num, int frac)
+        {
+            const __m256i f = _mm256_set1_epi16((short)frac);
+            const __m256i inv_f = _mm256_set1_epi16((short)(256-frac));
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m256i t = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(top+i)));
+                const __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(bottom+i)));
+                _mm256_storeu_si256((__m256i*)(out+i), _mm256_add_epi16(_mm256_mullo_epi16(t, inv_f),
+                                                                          _mm256_mullo_epi16(b, f)));
+            }
+            simd_kernels_sse2::blend_rows(top+i, bottom+i, out+i, num-i, frac);
+        }
+
+        // Same as the AVX version, with FMA.
+        DLIB_TARGET_AVX2 inline __m256 float_interleaved_sums(const float* const* rows, long i, long stride, const float* filter, long num_rows, long filter_size)
+        {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps(), acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+            __m256 acc4 = _mm256_setzero_ps(), acc5 = _mm256_setzero_ps(), acc6 = _mm256_setzero_ps(), acc7 = _mm256_setzero_ps();
+            for (long m = 0; m < num_rows; ++m)
+            {
+                const float* in = rows[m] + i*stride;
+                const float* f = filter + m*filter_size;
+                for (long n = 0; n < filter_size; n += 8)
+                {
+                    const __m256 fv = _mm256_loadu_ps(f+n);
+                    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(in+n), fv, acc0);
+                    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(in+stride+n), fv, acc1);
+                    acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(in+2*stride+n), fv, acc2);
+                    acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(in+3*stride+n), fv, acc3);
+                    acc4 = _mm256_fmadd_ps(_mm256_loadu_ps(in+4*stride+n), fv, acc4);
+                    acc5 = _mm256_fmadd_ps(_mm256_loadu_ps(in+5*stride+n), fv, acc5);
+                    acc6 = _mm256_fmadd_ps(_mm256_loadu_ps(in+6*stride+n), fv, acc6);
+                    acc7 = _mm256_fmadd_ps(_mm256_loadu_ps(in+7*stride+n), fv, acc7);
+                }
+            }
+            return simd_kernels_avx::horizontal_sums(acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7);
+        }
+
+        DLIB_TARGET_AVX2 inline void float_interleaved_filter(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to)
+        {
+            if (num < 8)
+                return simd_kernels_sse2::float_interleaved_filter(rows, out, num, stride, filter, num_rows, filter_size, add_to);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m256 sums = float_interleaved_sums(rows, i, stride, filter, num_rows, filter_size);
+                if (add_to)
+                    sums = _mm256_add_ps(sums, _mm256_loadu_ps(out+i));
+                _mm256_storeu_ps(out+i, sums);
+            }
+            if (i < num)
+            {
+                float sums[8];
+                _mm256_storeu_ps(sums, float_interleaved_sums(rows, num-8, stride, filter, num_rows, filter_size));
+                for (long j = i-(num-8); i < num; ++i, ++j)
+                    out[i] = add_to ? out[i] + sums[j] : sums[j];
+            }
+        }
+
+        // Computes the sums for outputs i through i+15, 0-7 in acc0 and 8-15 in acc1.
+        DLIB_TARGET_AVX2 inline void int16_pair_sums(const int* const* pairs, long i, const int* filter, long num_pairs, __m256i& acc0, __m256i& acc1)
+        {
+            acc0 = _mm256_setzero_si256();
+            acc1 = _mm256_setzero_si256();
+            for (long k = 0; k < num_pairs; ++k)
+            {
+                const __m256i f = _mm256_set1_epi32(filter[k]);
+                const int* p = pairs[k]+i;
+                acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)p), f));
+                acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)(p+8)), f));
+            }
+        }
+
+        // Same as the SSE2 version, with 16 outputs per block.
+        DLIB_TARGET_AVX2 inline long int16_pair_tail(const int* const* pairs, long i, long num, const int* filter, long num_pairs, int* sums)
+        {
+            __m256i acc0, acc1;
+            int16_pair_sums(pairs, num-16, filter, num_pairs, acc0, acc1);
+            _mm256_storeu_si256((__m256i*)sums, acc0);
+            _mm256_storeu_si256((__m256i*)(sums+8), acc1);
+            return i-(num-16);
+        }
+
+        DLIB_TARGET_AVX2 inline void int16_pair_filter_add(const int* const* pairs, int* out, long num, const int* filter, long num_pairs)
+        {
+            if (num < 16)
+                return simd_kernels_sse2::int16_pair_filter_add(pairs, out, num, filter, num_pairs);
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                _mm256_storeu_si256((__m256i*)(out+i),   _mm256_add_epi32(acc0, _mm256_loadu_si256((const __m256i*)(out+i))));
+                _mm256_storeu_si256((__m256i*)(out+i+8), _mm256_add_epi32(acc1, _mm256_loadu_si256((const __m256i*)(out+i+8))));
+            }
+            if (i < num)
+            {
+                int sums[16];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                    out[i] += sums[j];
+            }
+        }
+
+        DLIB_TARGET_AVX2 inline void int16_pair_filter_shift(const int* const* pairs, short* out, long num, const int* filter, long num_pairs, int shift)
+        {
+            if (num < 16)
+                return simd_kernels_sse2::int16_pair_filter_shift(pairs, out, num, filter, num_pairs, shift);
+            const __m256i round = _mm256_set1_epi32(shift > 0 ? 1<<(shift-1) : 0);
+            const __m128i count = _mm_cvtsi32_si128(shift);
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                acc0 = _mm256_sra_epi32(_mm256_add_epi32(acc0, round), count);
+                acc1 = _mm256_sra_epi32(_mm256_add_epi32(acc1, round), count);
+                // packs works within 128 bit lanes, so put the quadwords back in order.
+                _mm256_storeu_si256((__m256i*)(out+i), _mm256_permute4x64_epi64(_mm256_packs_epi32(acc0, acc1), 0xD8));
+            }
+            if (i < num)
+            {
+                int sums[16];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                    out[i] = simd_kernels_scalar::int16_round_shift(sums[j], shift);
+            }
+        }
+
+        DLIB_TARGET_AVX2 inline void int16_pair_filter(const int* const* pairs, float* out, long num, const int* filter, long num_pairs, float scale, bool add_to)
+        {
+            if (num < 16)
+                return simd_kernels_sse2::int16_pair_filter(pairs, out, num, filter, num_pairs, scale, add_to);
+            const __m256 s = _mm256_set1_ps(scale);
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                __m256i acc0, acc1;
+                int16_pair_sums(pairs, i, filter, num_pairs, acc0, acc1);
+                __m256 r0 = _mm256_mul_ps(_mm256_cvtepi32_ps(acc0), s);
+                __m256 r1 = _mm256_mul_ps(_mm256_cvtepi32_ps(acc1), s);
+                if (add_to)
+                {
+                    r0 = _mm256_add_ps(r0, _mm256_loadu_ps(out+i));
+                    r1 = _mm256_add_ps(r1, _mm256_loadu_ps(out+i+8));
+                }
+                _mm256_storeu_ps(out+i, r0);
+                _mm256_storeu_ps(out+i+8, r1);
+            }
+            if (i < num)
+            {
+                int sums[16];
+                for (long j = int16_pair_tail(pairs, i, num, filter, num_pairs, sums); i < num; ++i, ++j)
+                {
+                    if (add_to)
+                        out[i] += sums[j]*scale;
+                    else
+                        out[i] = sums[j]*scale;
+                }
+            }
+        }
+
+        DLIB_TARGET_AVX2 inline void complex_radix4(double* const* re, double* const* im, long num, const double* w, bool inverse)
+        {
+            const __m256d w1r = _mm256_set1_pd(w[0]), w1i = _mm256_set1_pd(w[1]);
+            const __m256d w2r = _mm256_set1_pd(w[2]), w2i = _mm256_set1_pd(w[3]);
+            const __m256d sign = _mm256_set1_pd(inverse ? -1.0 : 1.0);
+            long i = 0;
+            for (; i + 4 <= num; i += 4)
+            {
+                const __m256d a1r = _mm256_loadu_pd(re[1]+i), a1i = _mm256_loadu_pd(im[1]+i);
+                const __m256d a3r = _mm256_loadu_pd(re[3]+i), a3i = _mm256_loadu_pd(im[3]+i);
+                const __m256d t1r = _mm256_fmsub_pd(w2r, a1r, _mm256_mul_pd(w2i, a1i));
+                const __m256d t1i = _mm256_fmadd_pd(w2r, a1i, _mm256_mul_pd(w2i, a1r));
+                const __m256d t3r = _mm256_fmsub_pd(w2r, a3r, _mm256_mul_pd(w2i, a3i));
+                const __m256d t3i = _mm256_fmadd_pd(w2r, a3i, _mm256_mul_pd(w2i, a3r));
+                const __m256d a0r = _mm256_loadu_pd(re[0]+i), a0i = _mm256_loadu_pd(im[0]+i);
+                const __m256d a2r = _mm256_loadu_pd(re[2]+i), a2i = _mm256_loadu_pd(im[2]+i);
+                const __m256d d0r = _mm256_add_pd(a0r, t1r), d0i = _mm256_add_pd(a0i, t1i);
+                const __m256d d1r = _mm256_sub_pd(a0r, t1r), d1i = _mm256_sub_pd(a0i, t1i);
+                const __m256d c0r = _mm256_add_pd(a2r, t3r), c0i = _mm256_add_pd(a2i, t3i);
+                const __m256d c1r = _mm256_sub_pd(a2r, t3r), c1i = _mm256_sub_pd(a2i, t3i);
+                const __m256d u0r = _mm256_fmsub_pd(w1r, c0r, _mm256_mul_pd(w1i, c0i));
+                const __m256d u0i = _mm256_fmadd_pd(w1r, c0i, _mm256_mul_pd(w1i, c0r));
+                const __m256d v1r = _mm256_fmsub_pd(w1r, c1r, _mm256_mul_pd(w1i, c1i));
+                const __m256d v1i = _mm256_fmadd_pd(w1r, c1i, _mm256_mul_pd(w1i, c1r));
+                const __m256d u1r = _mm256_mul_pd(sign, v1i);
+                const __m256d u1i = _mm256_sub_pd(_mm256_setzero_pd(), _mm256_mul_pd(sign, v1r));
+                _mm256_storeu_pd(re[0]+i, _mm256_add_pd(d0r, u0r)); _mm256_storeu_pd(im[0]+i, _mm256_add_pd(d0i, u0i));
+                _mm256_storeu_pd(re[2]+i, _mm256_sub_pd(d0r, u0r)); _mm256_storeu_pd(im[2]+i, _mm256_sub_pd(d0i, u0i));
+                _mm256_storeu_pd(re[1]+i, _mm256_add_pd(d1r, u1r)); _mm256_storeu_pd(im[1]+i, _mm256_add_pd(d1i, u1i));
+                _mm256_storeu_pd(re[3]+i, _mm256_sub_pd(d1r, u1r)); _mm256_storeu_pd(im[3]+i, _mm256_sub_pd(d1i, u1i));
+            }
+            if (i < num)
+            {
+                double* const r[4] = { re[0]+i, re[1]+i, re[2]+i, re[3]+i };
+                double* const m[4] = { im[0]+i, im[1]+i, im[2]+i, im[3]+i };
+                simd_kernels_sse2::complex_radix4(r, m, num-i, w, inverse);
+            }
+        }
+
+        DLIB_TARGET_AVX2 inline void bilinear_row(const unsigned char* top, const unsigned char* bottom, float* out, long num, const float* weights)
+        {
+            const __m256 w0 = _mm256_set1_ps(weights[0]), w1 = _mm256_set1_ps(weights[1]);
+            const __m256 w2 = _mm256_set1_ps(weights[2]), w3 = _mm256_set1_ps(weights[3]);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                const __m256 t0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(top+i))));
+                const __m256 t1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(top+i+1))));
+                const __m256 b0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(bottom+i))));
+                const __m256 b1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(bottom+i+1))));
+                _mm256_storeu_ps(out+i, _mm256_add_ps(_mm256_fmadd_ps(w1, t1, _mm256_mul_ps(w0, t0)),
+                                                      _mm256_fmadd_ps(w3, b1, _mm256_mul_ps(w2, b0))));
+            }
+            simd_kernels_sse2::bilinear_row(top+i, bottom+i, out+i, num-i, weights);
+        }
+
+        DLIB_TARGET_AVX2 inline void patch_mismatch(const float* a, const float* b, const float* grad_x, const float* grad_y, long num, float* sums)
+        {
+            __m256 sx = _mm256_setzero_ps();
+            __m256 sy = _mm256_setzero_ps();
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                const __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i));
+                sx = _mm256_fmadd_ps(d, _mm256_loadu_ps(grad_x+i), sx);
+                sy = _mm256_fmadd_ps(d, _mm256_loadu_ps(grad_y+i), sy);
+            }
+            float temp[8];
+            simd_kernels_sse2::patch_mismatch(a+i, b+i, grad_x+i, grad_y+i, num-i, sums);
+            _mm256_storeu_ps(temp, sx);
+            sums[0] += ((temp[0]+temp[1]) + (temp[2]+temp[3])) + ((temp[4]+temp[5]) + (temp[6]+temp[7]));
+            _mm256_storeu_ps(temp, sy);
+            sums[1] += ((temp[0]+temp[1]) + (temp[2]+temp[3])) + ((temp[4]+temp[5]) + (temp[6]+temp[7]));
+        }
+
+        DLIB_TARGET_AVX2 inline void grouped_abs_diff(const unsigned char* a, const unsigned char* b, unsigned int* sums, long num_groups)
+        {
+            long g = 0;
+            for (; g + 4 <= num_groups; g += 4)
+            {
+                const __m256i sad = _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(a+8*g)), _mm256_loadu_si256((const __m256i*)(b+8*g)));
+                const __m128i lo = _mm256_castsi256_si128(sad);
+                const __m128i hi = _mm256_extracti128_si256(sad, 1);
+                sums[g] += _mm_cvtsi128_si32(lo);
+                sums[g+1] += _mm_cvtsi128_si32(_mm_srli_si128(lo, 8));
+                sums[g+2] += _mm_cvtsi128_si32(hi);
+                sums[g+3] += _mm_cvtsi128_si32(_mm_srli_si128(hi, 8));
+            }
+            simd_kernels_sse2::grouped_abs_diff(a+8*g, b+8*g, sums+g, num_groups-g);
+        }
+    }
+
+// ----------------------------------------------------------------------------------------
+//                                  AVX-512 kernels
+// ----------------------------------------------------------------------------------------
+
+    namespace simd_kernels_avx512
+    {
+        // Only AVX512F is assumed, which has no 16 bit integer instructions.  So the
+        // integer kernels widen their bytes to 32 bits, 16 pixels at a time, and the
+        // float kernels use masked loads and stores to handle the ends of rows.
+
+        DLIB_TARGET_AVX512 inline void float_row_filter(const float* in, float* out, long num, const float* filter, long filter_size)
+        {
+            long i = 0;
+            for (; i + 32 <= num; i += 32)
+            {
+                __m512 acc0 = _mm512_setzero_ps();
+                __m512 acc1 = _mm512_setzero_ps();
+                for (long n = 0; n < filter_size; ++n)
+                {
+                    const __m512 f = _mm512_set1_ps(filter[n]);
+                    acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(in+i+n), f, acc0);
+                    acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(in+i+n+16), f, acc1);
+                }
+                _mm512_storeu_ps(out+i, acc0);
+                _mm512_storeu_ps(out+i+16, acc1);
+            }
+            for (; i < num; i += 16)
+            {
+                const __mmask16 mask = (num-i >= 16) ? (__mmask16)0xffff : (__mmask16)((1u<<(num-i))-1);
+                __m512 acc = _mm512_setzero_ps();
+                for (long n = 0; n < filter_size; ++n)
+                    acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, in+i+n), _mm512_set1_ps(filter[n]), acc);
+                _mm512_mask_storeu_ps(out+i, mask, acc);
+            }
+        }
+
+        DLIB_TARGET_AVX512 inline void float_col_filter(const float* const* rows, float* out, long num, const float* filter, long filter_size, bool add_to)
+        {
+            for (long i = 0; i < num; i += 16)
+            {
+                const __mmask16 mask = (num-i >= 16) ? (__mmask16)0xffff : (__mmask16)((1u<<(num-i))-1);
+                __m512 acc = _mm512_setzero_ps();
+                for (long m = 0; m < filter_size; ++m)
+                    acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, rows[m]+i), _mm512_set1_ps(filter[m]), acc);
+                if (add_to)
+                    acc = _mm512_add_ps(acc, _mm512_maskz_loadu_ps(mask, out+i));
+                _mm512_mask_storeu_ps(out+i, mask, acc);
+            }
+        }
+
+        DLIB_TARGET_AVX512 inline void add_to(float* dest, const float* src, long num)
+        {
+            for (long i = 0; i < num; i += 16)
+            {
+                const __mmask16 mask = (num-i >= 16) ? (__mmask16)0xffff : (__mmask16)((1u<<(num-i))-1);
+                _mm512_mask_storeu_ps(dest+i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, dest+i), _mm512_maskz_loadu_ps(mask, src+i)));
+            }
+        }
+
+        // Folds the two 256 bit halves of a together.  Extracting a float half would need
+        // AVX512DQ, so it goes through the double version.
+        DLIB_TARGET_AVX512 inline __m256 fold_halves(__m512 a)
+        {
+            return _mm256_add_ps(_mm512_castps512_ps256(a), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a), 1)));
+        }
+
+        DLIB_TARGET_AVX512 inline __m256 float_interleaved_sums(const float* const* rows, long i, long stride, const float* filter, long num_rows, long filter_size)
+        {
+            __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps(), acc2 = _mm512_setzero_ps(), acc3 = _mm512_setzero_ps();
+            __m512 acc4 = _mm512_setzero_ps(), acc5 = _mm512_setzero_ps(), acc6 = _mm512_setzero_ps(), acc7 = _mm512_setzero_ps();
+            for (long m = 0; m < num_rows; ++m)
+            {
+                const float* in = rows[m] + i*stride;
+                const float* f = filter + m*filter_size;
+                for (long n = 0; n < filter_size; n += 16)
+                {
+                    const __m512 fv = _mm512_loadu_ps(f+n);
+                    acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(in+n), fv, acc0);
+                    acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(in+stride+n), fv, acc1);
+                    acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(in+2*stride+n), fv, acc2);
+                    acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(in+3*stride+n), fv, acc3);
+                    acc4 = _mm512_fmadd_ps(_mm512_loadu_ps(in+4*stride+n), fv, acc4);
+                    acc5 = _mm512_fmadd_ps(_mm512_loadu_ps(in+5*stride+n), fv, acc5);
+                    acc6 = _mm512_fmadd_ps(_mm512_loadu_ps(in+6*stride+n), fv, acc6);
+                    acc7 = _mm512_fmadd_ps(_mm512_loadu_ps(in+7*stride+n), fv, acc7);
+                }
+            }
+            return simd_kernels_avx::horizontal_sums(fold_halves(acc0), fold_halves(acc1), fold_halves(acc2), fold_halves(acc3),
+                                                     fold_halves(acc4), fold_halves(acc5), fold_halves(acc6), fold_halves(acc7));
+        }
+
+        DLIB_TARGET_AVX512 inline void float_interleaved_filter(const float* const* rows, float* out, long num, long stride, const float* filter, long num_rows, long filter_size, bool add_to)
+        {
+            if (num < 8)
+                return simd_kernels_sse2::float_interleaved_filter(rows, out, num, stride, filter, num_rows, filter_size, add_to);
+            long i = 0;
+            for (; i + 8 <= num; i += 8)
+            {
+                __m256 sums = float_interleaved_sums(rows, i, stride, filter, num_rows, filter_size);
+                if (add_to)
+                    sums = _mm256_add_ps(sums, _mm256_loadu_ps(out+i));
+                _mm256_storeu_ps(out+i, sums);
+            }
+            if (i < num)
+            {
+                float sums[8];
+                _mm256_storeu_ps(sums, float_interleaved_sums(rows, num-8, stride, filter, num_rows, filter_size));
+                for (long j = i-(num-8); i < num; ++i, ++j)
+                    out[i] = add_to ? out[i] + sums[j] : sums[j];
+            }
+        }
+        DLIB_TARGET_AVX512 inline void fhog_gradient_stream(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                            long step, float* grad_x, float* grad_y, float* len, long num)
+        {
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m512i l = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(row+i-step)));
+                const __m512i r = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(row+i+step)));
+                const __m512i t = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(above+i)));
+                const __m512i b = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(below+i)));
+                const __m512 gx = _mm512_cvtepi32_ps(_mm512_sub_epi32(r,l));
+                const __m512 gy = _mm512_cvtepi32_ps(_mm512_sub_epi32(b,t));
+                _mm512_storeu_ps(grad_x+i, gx);
+                _mm512_storeu_ps(grad_y+i, gy);
+                // These are small integers so the float math is exact.
+                _mm512_storeu_ps(len+i, _mm512_fmadd_ps(gx,gx,_mm512_mul_ps(gy,gy)));
+            }
+            simd_kernels_avx2::fhog_gradient_stream(above+i, row+i, below+i, step, grad_x+i, grad_y+i, len+i, num-i);
+        }
+
+        DLIB_TARGET_AVX512 inline void fhog_gradient_gray(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                                          float* grad_x, float* grad_y, float* len, long num)
+        {
+            fhog_gradient_stream(above, row, below, 1, grad_x, grad_y, len, num);
+        }
+
+        inline void fhog_gradient_rgb(const unsigned char* above, const unsigned char* row, const unsigned char* below,
+                                      float* grad_x, float* grad_y, float* len, long num)
+        {
+            impl::fhog_gradient_rgb_chunked<fhog_gradient_stream>(above, row, below, grad_x, grad_y, len, num);
+        }
+
+        DLIB_TARGET_AVX512 inline void blend_rows(const unsigned char* top, const unsigned char* bottom, unsigned short* out, long num, int frac)
+        {
+            const __m512i f = _mm512_set1_epi32(frac);
+            const __m512i inv_f = _mm512_set1_epi32(256-frac);
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m512i t = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(top+i)));
+                const __m512i b = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(bottom+i)));
+                // The blend fits in 16 bits, so vpmovdw just drops the zero high halves.
+                _mm256_storeu_si256((__m256i*)(out+i), _mm512_cvtepi32_epi16(_mm512_add_epi32(_mm512_mullo_epi32(t, inv_f),
+                                                                                              _mm512_mullo_epi32(b, f))));
+            }
+            simd_kernels_avx2::blend_rows(top+i, bottom+i, out+i, num-i, frac);
+        }
+
+        DLIB_TARGET_AVX512 inline void bilinear_row(const unsigned char* top, const unsigned char* bottom, float* out, long num, const float* weights)
+        {
+            const __m512 w0 = _mm512_set1_ps(weights[0]), w1 = _mm512_set1_ps(weights[1]);
+            const __m512 w2 = _mm512_set1_ps(weights[2]), w3 = _mm512_set1_ps(weights[3]);
+            long i = 0;
+            for (; i + 16 <= num; i += 16)
+            {
+                const __m512 t0 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(top+i))));
+                const __m512 t1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(top+i+1))));
+                const __m512 b0 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(bottom+i))));
+                const __m512 b1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(bottom+i+1))));
+                _mm512_storeu_ps(out+i, _mm512_add_ps(_mm512_fmadd_ps(w1, t1, _mm512_mul_ps(w0, t0)),
+                                                      _mm512_fmadd_ps(w3, b1, _mm512_mul_ps(w2, b0))));
+            }
+            simd_kernels_avx2::bilinear_row(top+i, bottom+i, out+i, num-i, weights);
+        }
+    }
+
+#endif // DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+
+// ----------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        inline simd_kernels make_simd_kernels (
+            simd_instruction_set isa
+        )
+        {
+            simd_kernels k;
+            k.instruction_set    = simd_scalar;
+            k.float_row_filter   = simd_kernels_scalar::float_row_filter;
+            k.float_col_filter   = simd_kernels_scalar::float_col_filter;
+            k.fhog_gradient_gray = simd_kernels_scalar::fhog_gradient_gray;
+            k.fhog_gradient_rgb  = fhog_gradient_rgb_chunked<simd_kernels_scalar::fhog_gradient_stream>;
+            k.blend_rows         = simd_kernels_scalar::blend_rows;
+            k.add_to             = simd_kernels_scalar::add_to;
+            k.float_interleaved_filter = simd_kernels_scalar::float_interleaved_filter;
+            k.int16_interleave   = simd_kernels_scalar::int16_interleave;
+            k.int16_pair_filter_add = simd_kernels_scalar::int16_pair_filter_add;
+            k.int16_pair_filter_shift = simd_kernels_scalar::int16_pair_filter_shift;
+            k.int16_pair_filter  = simd_kernels_scalar::int16_pair_filter;
+            k.complex_radix4     = simd_kernels_scalar::complex_radix4<double>;
+            k.bilinear_row       = simd_kernels_scalar::bilinear_row;
+            k.patch_mismatch     = simd_kernels_scalar::patch_mismatch;
+            k.grouped_abs_diff   = simd_kernels_scalar::grouped_abs_diff;
+
+#ifdef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+            if (isa >= simd_sse2)
+            {
+                // SSE4.1 has nothing these kernels can use that SSE2 doesn't, so CPUs
+                // stopping at SSE4.1 run the SSE2 versions.
+                k.instruction_set    = isa >= simd_sse41 ? simd_sse41 : simd_sse2;
+                k.float_row_filter   = simd_kernels_sse2::float_row_filter;
+                k.float_col_filter   = simd_kernels_sse2::float_col_filter;
+                k.fhog_gradient_gray = simd_kernels_sse2::fhog_gradient_gray;
+                k.fhog_gradient_rgb  = simd_kernels_sse2::fhog_gradient_rgb;
+                k.blend_rows         = simd_kernels_sse2::blend_rows;
+                k.add_to             = simd_kernels_sse2::add_to;
+                k.float_interleaved_filter = simd_kernels_sse2::float_interleaved_filter;
+                k.int16_interleave   = simd_kernels_sse2::int16_interleave;
+                k.int16_pair_filter_add = simd_kernels_sse2::int16_pair_filter_add;
+                k.int16_pair_filter_shift = simd_kernels_sse2::int16_pair_filter_shift;
+                k.int16_pair_filter  = simd_kernels_sse2::int16_pair_filter;
+                k.complex_radix4     = simd_kernels_sse2::complex_radix4;
+                k.bilinear_row       = simd_kernels_sse2::bilinear_row;
+                k.patch_mismatch     = simd_kernels_sse2::patch_mismatch;
+                k.grouped_abs_diff   = simd_kernels_sse2::grouped_abs_diff;
+            }
+            if (isa >= simd_avx)
+            {
+                k.instruction_set    = simd_avx;
+                k.float_row_filter   = simd_kernels_avx::float_row_filter;
+                k.float_col_filter   = simd_kernels_avx::float_col_filter;
+                k.add_to             = simd_kernels_avx::add_to;
+                k.float_interleaved_filter = simd_kernels_avx::float_interleaved_filter;
+            }
+            if (isa >= simd_avx2)
+            {
+                k.instruction_set    = simd_avx2;
+                k.float_row_filter   = simd_kernels_avx2::float_row_filter;
+                k.float_col_filter   = simd_kernels_avx2::float_col_filter;
+                k.fhog_gradient_gray = simd_kernels_avx2::fhog_gradient_gray;
+                k.fhog_gradient_rgb  = simd_kernels_avx2::fhog_gradient_rgb;
+                k.blend_rows         = simd_kernels_avx2::blend_rows;
+                k.float_interleaved_filter = simd_kernels_avx2::float_interleaved_filter;
+                k.int16_pair_filter_add = simd_kernels_avx2::int16_pair_filter_add;
+                k.int16_pair_filter_shift = simd_kernels_avx2::int16_pair_filter_shift;
+                k.int16_pair_filter  = simd_kernels_avx2::int16_pair_filter;
+                k.complex_radix4     = simd_kernels_avx2::complex_radix4;
+                k.bilinear_row       = simd_kernels_avx2::bilinear_row;
+                k.patch_mismatch     = simd_kernels_avx2::patch_mismatch;
+                k.grouped_abs_diff   = simd_kernels_avx2::grouped_abs_diff;
+            }
+            if (isa >= simd_avx512)
+            {
+                k.instruction_set    = simd_avx512;
+                k.float_row_filter   = simd_kernels_avx512::float_row_filter;
+                k.float_col_filter   = simd_kernels_avx512::float_col_filter;
+                k.fhog_gradient_gray = simd_kernels_avx512::fhog_gradient_gray;
+                k.fhog_gradient_rgb  = simd_kernels_avx512::fhog_gradient_rgb;
+                k.blend_rows         = simd_kernels_avx512::blend_rows;
+                k.add_to             = simd_kernels_avx512::add_to;
+                k.float_interleaved_filter = simd_kernels_avx512::float_interleaved_filter;
+                k.bilinear_row       = simd_kernels_avx512::bilinear_row;
+            }
+#endif
+            return k;
+        }
+    }
+
+    inline simd_kernels get_simd_kernels (
+        simd_instruction_set isa
+    )
+    /*!
+        ensures
+            - returns the kernels for the given instruction set, or for the best one below
+              it that has kernels.  The caller is responsible for only asking for
+              instruction sets the CPU supports.  This is mostly useful for checking the
+              optimized kernels against the simpler ones.
+    !*/
+    {
+        return impl::make_simd_kernels(isa);
+    }
+
+    inline const simd_kernels& get_simd_kernels (
+    )
+    /*!
+        ensures
+            - returns the fastest kernels this CPU can run.  The choice is made once, the
+              first time this function is called.
+    !*/
+    {
+        static const simd_kernels kernels = impl::make_simd_kernels(get_cpu_features().best_instruction_set());
+        return kernels;
+    }
+
+// ----------------------------------------------------------------------------------------
+
+}
+
+#endif // DLIB_SIMD_CPU_DISPATCH_Hh_
+
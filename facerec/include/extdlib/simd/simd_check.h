@@ -52,6 +52,17 @@
             #endif
         #endif
     #endif
+
+    // Independently of what the compiler has been told to target, on x86 we can build
+    // extra copies of the hot kernels for newer instruction sets and pick one at runtime
+    // based on what the CPU reports.  See dlib/simd/cpu_dispatch.h.
+    #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        #if defined(_MSC_VER) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || defined(__clang__)
+            #ifndef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+                #define DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+            #endif
+        #endif
+    #endif
 #endif
 
  
@@ -76,6 +87,9 @@
     #include <immintrin.h> // AVX
 //    #include <avx2intrin.h>
 #endif
+#ifdef DLIB_HAVE_RUNTIME_SIMD_DISPATCH
+    #include <immintrin.h> // all x86 intrinsics, used by the runtime dispatched kernels
+#endif
 
 #endif // DLIB_SIMd_CHECK_Hh_
 
@@ -1,6 +1,9 @@
 #include <assert.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
 #include <unistd.h>
 
 #define EXTENSION_NAME Facerec
@@ -16,6 +19,18 @@
 #include <extdlib/image_processing/frontal_face_detector.h>
 #include <extdlib/image_processing/render_face_detections.h>
 #include <extdlib/image_processing.h>
+#include <extdlib/lz4_stream.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
 //#include <extdlib/image_io.h>
 //#include <extdlib/image_saver/image_saver.h>
 #include <iostream>
@@ -26,62 +41,978 @@
 // Example face landmark code
 // http://dlib.net/face_landmark_detection_ex.cpp.html
 
-// http://stackoverflow.com/a/13059195
-// Have to create a buffer stream manually, because c++...
-#include <streambuf>
-#include <istream>
+// A landmark model and the face detector built for it. An analysis holds a reference
+// to the model it started with, so swapping models never changes one under it
+struct FacerecModel
+{
+    dlib::frontal_face_detector   m_Detector;
+    dlib::shape_predictor         m_Predictor;
+    // Keeps the Lua buffer the model was loaded from alive, since a flat model is used
+    // in place. LUA_NOREF for models mapped from a file
+    int                           m_DataLuaRef;
+};
+
+// Everything needed to load a model, read from the Lua arguments on the main thread
+struct FacerecModelRequest
+{
+    std::string     m_Path;
+    const uint8_t*  m_Data;
+    uint32_t        m_DataSize;
+    int             m_DataLuaRef;
+    unsigned long   m_MapFlags;
+    // Score detection windows with 16 bit features and filters
+    bool            m_Quantized;
+    // Only scan for local maxima and keep at most this many of them (0 keeps all)
+    int             m_MaxCandidates;
+    // Separable filter components kept per plane (0 keeps all) and the smallest
+    // singular value kept, relative to the largest one of each plane
+    int             m_MaxFilterRank;
+    double          m_MinSingularValue;
+};
+
+// The landmarks of a face in the last frame, kept unrounded so that following them
+// with optical flow doesn't drift
+struct FacerecFlowFace
+{
+    dlib::rectangle             m_Rect;
+    std::vector<dlib::dpoint>   m_Parts;
+    int                         m_FramesUntilPrediction;
+    // Frames since the face was first seen, and since its landmarks were last found
+    int                         m_Age;
+    int                         m_FramesSinceRefresh;
+};
+
+// Measures how long the stages of analysis take and adjusts the downscale, the
+// detection interval and the landmark cascade depth to stay within a time budget
+struct FacerecGovernor
+{
+    FacerecGovernor()
+    : m_Budget(0), m_IngestTime(0), m_DetectTime(0), m_LandmarkTime(0)
+    , m_NumSamples(0), m_FramesUnderBudget(0), m_BaseDetectInterval(1), m_BaseDownscale(0)
+    {
+    }
+
+    // Milliseconds per analyzed frame, or 0 to leave the settings alone
+    double  m_Budget;
+    // Smoothed milliseconds per frame spent converting the camera frame, finding faces
+    // and finding landmarks, since the last change
+    double  m_IngestTime;
+    double  m_DetectTime;
+    double  m_LandmarkTime;
+    int     m_NumSamples;
+    int     m_FramesUnderBudget;
+    // The detect_interval option, which the governor never goes below
+    int     m_BaseDetectInterval;
+    // The downscale analysis starts at, which frames are shrunk at most one step past
+    int     m_BaseDownscale;
+};
+
+typedef std::chrono::steady_clock FacerecClock;
+
+// Layouts of camera frames. The YUV 4:2:0 layouts all start with the luma plane, top
+// row first, which is all that analysis needs of them
+enum FacerecFormat
+{
+    FACEREC_FORMAT_RGB,     // Bottom-up interleaved RGB
+    FACEREC_FORMAT_NV12,    // Luma plane, then interleaved U and V at half resolution
+    FACEREC_FORMAT_NV21,    // Luma plane, then interleaved V and U at half resolution
+    FACEREC_FORMAT_I420,    // Luma plane, then U and V planes at half resolution
+    FACEREC_FORMAT_YV12,    // Luma plane, then V and U planes at half resolution
+};
+
+// A camera frame on its way through analysis, and what was found in it
+struct FacerecFrame
+{
+    std::shared_ptr<FacerecModel>   m_Model;
+    // The camera pixels, which point into m_Copy in the pipeline
+    const uint8_t*                  m_Data;
+    std::vector<uint8_t>            m_Copy;
+    FacerecFormat                   m_Format;
+    int                             m_Width;
+    int                             m_Height;
+    int                             m_Downscale;
+    // Whether faces are found in m_Gray rather than m_Image
+    bool                            m_Grayscale;
+    // Whether anything moved, and where to look for new faces
+    bool                            m_Moved;
+    dlib::rectangle                 m_Area;
+    dlib::array2d<dlib::rgb_pixel>  m_Image;
+    dlib::array2d<unsigned char>    m_Gray;
+    std::vector<dlib::rectangle>    m_Faces;
+    std::vector<dlib::full_object_detection> m_Shapes;
+    // The downscale of the image the landmarks were found in
+    int                             m_ShapeDownscale;
+    // When the frame was handed to analysis, and when each stage was done with it
+    FacerecClock::time_point        m_Submitted;
+    FacerecClock::time_point        m_Ingested;
+    FacerecClock::time_point        m_Detected;
+    FacerecClock::time_point        m_Finished;
+};
+
+// A bounded queue of frames between two pipeline stages, each on its own thread
+class FacerecQueue
+{
+public:
+    FacerecQueue() : m_Capacity(1), m_Closed(true) {}
+
+    void Open(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Frames.clear();
+        m_Capacity = capacity;
+        m_Closed = false;
+    }
+
+    // Drops the frames and wakes up both threads, whose Push() and Pop() return false
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Frames.clear();
+        m_Closed = true;
+        m_NotEmpty.notify_all();
+        m_NotFull.notify_all();
+    }
+
+    // Waits for room for the frame
+    bool Push(std::unique_ptr<FacerecFrame>& frame)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotFull.wait(lock, [this]() { return m_Closed || m_Frames.size() < m_Capacity; });
+        if (m_Closed)
+            return false;
+        m_Frames.push_back(std::move(frame));
+        m_NotEmpty.notify_one();
+        return true;
+    }
+
+    // Waits for a frame
+    bool Pop(std::unique_ptr<FacerecFrame>& frame)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this]() { return m_Closed || !m_Frames.empty(); });
+        return PopLocked(frame);
+    }
+
+    bool TryPop(std::unique_ptr<FacerecFrame>& frame)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return PopLocked(frame);
+    }
+
+private:
+    bool PopLocked(std::unique_ptr<FacerecFrame>& frame)
+    {
+        if (m_Frames.empty())
+            return false;
+        frame = std::move(m_Frames.front());
+        m_Frames.pop_front();
+        m_NotFull.notify_one();
+        return true;
+    }
+
+    std::mutex                                  m_Mutex;
+    std::condition_variable                     m_NotEmpty;
+    std::condition_variable                     m_NotFull;
+    std::deque<std::unique_ptr<FacerecFrame> >  m_Frames;
+    size_t                                      m_Capacity;
+    bool                                        m_Closed;
+};
 
-namespace {
-    struct membuf: std::streambuf {
-        membuf(char const* base, size_t size) {
-            char* p(const_cast<char*>(base));
-            this->setg(p, p, p + size);
+// Worker threads for FacerecParallelFor, one per core but the one calling it. They are
+// started with the model and wait for work in between, so that spreading the trackers
+// over the cores doesn't start and join threads on every frame
+class FacerecWorkers
+{
+public:
+    FacerecWorkers()
+    : m_NumThreads(0), m_Call(0), m_Function(0), m_Count(0), m_Next(0), m_Active(0), m_Generation(0), m_Stop(false)
+    {
+    }
+
+    // Starts the threads unless they are running. Fewer are started if threads can't
+    // be had, and the calling thread does all the work if none can
+    void Start()
+    {
+        if (!m_Threads.empty())
+            return;
+        const unsigned int num_threads = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            try
+            {
+                m_Threads.push_back(std::thread(&FacerecWorkers::Run, this, m_Generation));
+            }
+            catch (std::system_error&)
+            {
+                break;
+            }
         }
-    };
-    struct imemstream: virtual membuf, std::istream {
-        imemstream(char const* base, size_t size)
-            : membuf(base, size)
-            , std::istream(static_cast<std::streambuf*>(this)) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_NumThreads = m_Threads.size();
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
         }
-    };
-}
+        m_Wake.notify_all();
+        for (size_t i = 0; i < m_Threads.size(); ++i)
+            m_Threads[i].join();
+        m_Threads.clear();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_NumThreads = 0;
+        m_Stop = false;
+    }
 
-struct Facerec
+    // Calls fn(i) for every i in [0, count) on the workers and the calling thread, and
+    // returns when all the calls are done. Only one thread may call this at a time
+    template <typename Function>
+    void ParallelFor(unsigned long count, const Function& fn)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (m_NumThreads == 0 || m_Stop || count < 2)
+        {
+            lock.unlock();
+            for (unsigned long i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+        m_Call = &FacerecWorkers::Call<Function>;
+        m_Function = &fn;
+        m_Count = count;
+        m_Next = 0;
+        m_Active = m_NumThreads;
+        ++m_Generation;
+        lock.unlock();
+        m_Wake.notify_all();
+
+        Work();
+
+        lock.lock();
+        m_Done.wait(lock, [this]() { return m_Active == 0; });
+        m_Function = 0;
+    }
+
+private:
+    template <typename Function>
+    static void Call(const void* fn, unsigned long i)
+    {
+        (*(const Function*)fn)(i);
+    }
+
+    void Work()
+    {
+        for (unsigned long i = m_Next++; i < m_Count; i = m_Next++)
+            m_Call(m_Function, i);
+    }
+
+    // generation is the work last handed out, which the new worker takes no part in
+    void Run(unsigned long generation)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        for (;;)
+        {
+            m_Wake.wait(lock, [this, generation]() { return m_Stop || m_Generation != generation; });
+            // Work handed out before Stop() is still done, the caller waits for it
+            if (m_Generation == generation)
+                return;
+            generation = m_Generation;
+            lock.unlock();
+            Work();
+            lock.lock();
+            if (--m_Active == 0)
+                m_Done.notify_all();
+        }
+    }
+
+    // Only touched by Start() and Stop(). ParallelFor() reads m_NumThreads instead
+    std::vector<std::thread>    m_Threads;
+    std::mutex                  m_Mutex;
+    size_t                      m_NumThreads;
+    std::condition_variable     m_Wake;
+    std::condition_variable     m_Done;
+    // The work handed out, set under m_Mutex before m_Generation changes
+    void                        (*m_Call)(const void*, unsigned long);
+    const void*                 m_Function;
+    unsigned long               m_Count;
+    std::atomic<unsigned long>  m_Next;
+    // Workers that haven't finished their share of the current work yet
+    size_t                      m_Active;
+    unsigned long               m_Generation;
+    bool                        m_Stop;
+};
+
+// Runs ingest, detection and landmarks on three threads, so that up to three frames
+// are analyzed at once. Each stage keeps the state of its own part of the analysis
+struct FacerecPipeline
 {
-    int m_TrainingDataLuaRef;
+    FacerecQueue                m_ToIngest;
+    FacerecQueue                m_ToDetect;
+    FacerecQueue                m_ToLandmarks;
+    FacerecQueue                m_Finished;
+    std::vector<std::thread>    m_Threads;
+    // Frames handed to the pipeline and not yet taken back, and how many there can be
+    int                         m_InFlight;
+    int                         m_MaxInFlight;
+    // Frames taken back, kept so that the next frames reuse their buffers
+    std::vector<std::unique_ptr<FacerecFrame> > m_FreeFrames;
+    // The faces of the newest frame finished
+    std::vector<dlib::full_object_detection> m_Shapes;
+    int                         m_Downscale;
+    int                         m_Height;
+};
 
-    dmBuffer::HBuffer m_TrainingData;
+// Smoothed times of the frames analyzed, in milliseconds
+struct FacerecStats
+{
+    FacerecStats()
+    : m_Latency(0), m_Interval(0), m_Ingest(0), m_Detect(0), m_Landmarks(0)
+    , m_Frames(0), m_MovedFrames(0), m_Dropped(0)
+    {
+    }
 
-    dlib::frontal_face_detector   m_Detector;
-    dlib::shape_predictor         m_Predictor;
+    // From handing a frame to analyze() to its faces being found
+    double                      m_Latency;
+    // Between frames being finished, the inverse of throughput
+    double                      m_Interval;
+    // Per stage, on frames where something moved
+    double                      m_Ingest;
+    double                      m_Detect;
+    double                      m_Landmarks;
+    unsigned long               m_Frames;
+    unsigned long               m_MovedFrames;
+    // Frames not analyzed because the pipeline was full
+    unsigned long               m_Dropped;
+    FacerecClock::time_point    m_LastFinished;
+};
+
+struct Facerec
+{
+    // The installed model, read and replaced with atomic shared_ptr operations
+    std::shared_ptr<FacerecModel> m_Model;
+    // Models replaced while still in use, released on the main thread once the last
+    // analysis using them is done
+    std::vector<std::shared_ptr<FacerecModel> > m_Retired;
+
+    // Run detection and landmarks on a luminance image instead of RGB
+    bool m_Grayscale;
+
+    // Follow detected faces with one correlation tracker each, and only run the
+    // detector every m_DetectInterval frames or when a track is lost. The trackers are
+    // kept between detections so their buffers are reused
+    bool                                m_Track;
+    int                                 m_DetectInterval;
+    // The peak to side lobe ratio below which a track is considered lost
+    double                              m_MinTrackConfidence;
+    // Also score each tracked face with the detector's filters and call it lost when
+    // the detector no longer sees a face there
+    bool                                m_VerifyTracks;
+    std::vector<dlib::correlation_tracker> m_Trackers;
+    unsigned long                       m_NumTracks;
+    int                                 m_FramesUntilDetection;
+
+    // Carry the landmarks of the faces in the last frame over with optical flow, and
+    // only run the shape predictor on a face every m_LandmarkInterval frames or when
+    // one of its landmarks is lost
+    bool                                m_Flow;
+    int                                 m_LandmarkInterval;
+    // The forward-backward error in pixels above which a landmark is considered lost
+    double                              m_MaxFlowError;
+    dlib::landmark_flow                 m_LandmarkFlow;
+    std::vector<FacerecFlowFace>        m_FlowFaces;
+
+    // Find landmarks for at most this many faces per frame, all of them when 0. The
+    // faces of the last frame are kept in m_FlowFaces for this too
+    unsigned long                       m_MaxLandmarkFaces;
+    // Give the faces seen the longest the first landmark slots, instead of the largest
+    bool                                m_LandmarkPriorityAge;
+
+    // Compare a small luminance thumbnail of each frame with the one of the last frame
+    // analyzed. Frames where no tile of it changed get the results of that frame again,
+    // and otherwise faces are only searched for around the tiles that did change
+    bool                                m_MotionGate;
+    // The mean absolute difference of the thumbnail pixels of a tile above which the
+    // tile has changed
+    double                              m_MotionThreshold;
+    std::vector<uint8_t>                m_Thumbnail;
+    std::vector<uint8_t>                m_NewThumbnail;
+    int                                 m_ThumbnailWidth;
+    std::vector<dlib::full_object_detection> m_LastShapes;
+    std::vector<dlib::rectangle>        m_LastFaces;
+    // Set when a new model is installed, so that the results of the old one aren't
+    // handed out again
+    std::atomic<bool>                   m_ModelChanged;
+
+    // How much the camera frame is shrunk before analysis, as a shift. The detector
+    // window is 80 pixels, so this also sets the smallest face found
+    int                                 m_Downscale;
+    // Find landmarks in the camera frame itself instead of the shrunk one
+    bool                                m_FullResolutionLandmarks;
+    // Run the detector on images wider or taller than this in tiles of this size, one
+    // tile at a time on every core, so that large stills don't need the image pyramid
+    // and features of the whole image at once. Never when 0
+    unsigned long                       m_DetectTileSize;
+    int                                 m_LastDownscale;
+    // The number of shape predictor cascade levels to run, all of them when 0
+    unsigned long                       m_LandmarkCascades;
+    FacerecGovernor                     m_Governor;
+
+    FacerecPipeline                     m_Pipeline;
+    FacerecWorkers                      m_Workers;
+    FacerecStats                        m_Stats;
+
+    // Background model loading for swap(). Only the latest request is loaded, and a
+    // loaded model waits in m_Loaded until the next frame installs it
+    std::thread                     m_Loader;
+    std::mutex                      m_LoaderMutex;
+    std::condition_variable         m_LoaderCondition;
+    bool                            m_LoaderStop;
+    bool                            m_HasRequest;
+    FacerecModelRequest             m_Request;
+    std::shared_ptr<FacerecModel>   m_Loaded;
+    // Models that were loaded but superseded, or failed to load, along with the Lua
+    // buffers they hold on to. Only the main thread may release those
+    std::vector<std::shared_ptr<FacerecModel> > m_Discarded;
+    std::vector<std::string>        m_LoadErrors;
 };
 
 Facerec g_Facerec;
 
 
+// The scanner of a detector can't be changed in place, so rebuild the detector around
+// a copy of it with the detection settings of the request. With max_candidates only
+// local maxima are scanned for, and at most max_candidates of them are kept per filter
+// and in total. Most of the rest would be removed by non-max suppression anyway, but
+// at low thresholds the cap drops some windows. The filter banks are reused as is.
+static dlib::frontal_face_detector FacerecConfigureDetector(const dlib::frontal_face_detector& detector, bool quantized, int max_candidates)
+{
+    dlib::frontal_face_detector::image_scanner_type scanner;
+    scanner.copy_configuration(detector.get_scanner());
+    scanner.set_quantized_detection(quantized);
+    if (max_candidates > 0)
+    {
+        scanner.set_local_max_detection(true);
+        scanner.set_max_detections(max_candidates);
+    }
+
+    std::vector<dlib::processed_weight_vector<dlib::frontal_face_detector::image_scanner_type> > w;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+    {
+        w.push_back(detector.get_processed_w(i));
+    }
+    dlib::frontal_face_detector configured(scanner, detector.get_overlap_tester(), w);
+    if (max_candidates > 0)
+    {
+        configured.set_max_candidates(max_candidates);
+    }
+    return configured;
+}
+
+// Reads the model argument and the model options of start() and swap()
+static void FacerecReadModelRequest(lua_State* L, FacerecModelRequest& request)
+{
+    // A file name is only used for flat models, which are mapped rather than loaded
+    dmScript::LuaHBuffer* buffer = 0;
+    if (lua_type(L, 1) == LUA_TSTRING)
+    {
+        request.m_Path = lua_tostring(L, 1);
+    }
+    else
+    {
+        buffer = dmScript::CheckBuffer(L, 1);
+    }
+
+    request.m_Data = 0;
+    request.m_DataSize = 0;
+    request.m_DataLuaRef = LUA_NOREF;
+    request.m_MapFlags = 0;
+    request.m_Quantized = false;
+    request.m_MaxCandidates = 0;
+    request.m_MaxFilterRank = 0;
+    request.m_MinSingularValue = 0;
+    if (lua_istable(L, 2))
+    {
+        lua_getfield(L, 2, "quantized");
+        request.m_Quantized = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "max_candidates");
+        request.m_MaxCandidates = lua_isnumber(L, -1) ? (int)lua_tointeger(L, -1) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "max_filter_rank");
+        request.m_MaxFilterRank = lua_isnumber(L, -1) ? (int)lua_tointeger(L, -1) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "min_singular_value");
+        request.m_MinSingularValue = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "populate");
+        request.m_MapFlags |= lua_toboolean(L, -1) ? dlib::mapped_file::populate : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "huge_pages");
+        request.m_MapFlags |= lua_toboolean(L, -1) ? dlib::mapped_file::huge_pages : 0;
+        lua_pop(L, 1);
+    }
+
+    if (buffer)
+    {
+        dmScript::PushBuffer(L, *buffer);
+        request.m_DataLuaRef = dmScript::Ref(L, LUA_REGISTRYINDEX);
+        uint8_t* data = 0;
+        dmBuffer::GetBytes(buffer->m_Buffer, (void**)&data, &request.m_DataSize);
+        request.m_Data = data;
+    }
+}
+
+// Builds the detector and loads the landmark model of a request. Doesn't touch Lua,
+// so it runs on the loader thread as well as the main thread
+static std::shared_ptr<FacerecModel> FacerecLoadModel(const FacerecModelRequest& request)
+{
+    std::shared_ptr<FacerecModel> model = std::make_shared<FacerecModel>();
+    model->m_DataLuaRef = request.m_DataLuaRef;
+
+    model->m_Detector = dlib::get_frontal_face_detector();
+    if (request.m_MaxFilterRank > 0 || request.m_MinSingularValue > 0)
+    {
+        unsigned long max_rank = request.m_MaxFilterRank > 0 ? (unsigned long)request.m_MaxFilterRank : ~0UL;
+        double thresh = std::min(std::max(request.m_MinSingularValue, 0.0), 1.0);
+        model->m_Detector = dlib::truncate_separable_filters(model->m_Detector, max_rank, thresh);
+    }
+    model->m_Detector = FacerecConfigureDetector(model->m_Detector, request.m_Quantized, request.m_MaxCandidates);
+
+    const char* data = (const char*)request.m_Data;
+    size_t datasize = (size_t)request.m_DataSize;
+    if (!request.m_Path.empty())
+    {
+        // Flat models written by tools/convert_model.cpp --flat are evaluated straight
+        // out of a shared mapping of the file, so every process and context running
+        // the same model shares one copy of it in memory
+        dlib::map_flat_shape_predictor(model->m_Predictor, request.m_Path, request.m_MapFlags);
+    }
+    else if (dlib::is_flat_shape_predictor(data, datasize))
+    {
+        // The buffer is kept alive by the model's reference to it, so the model is used
+        // in place when it is aligned, and copied once when it isn't
+        if (((uintptr_t)data % sizeof(uint64_t)) == 0)
+        {
+            dlib::deserialize_flat(model->m_Predictor, data, datasize);
+        }
+        else
+        {
+            std::shared_ptr<std::vector<uint64_t> > copy = std::make_shared<std::vector<uint64_t> >((datasize + 7) / 8);
+            memcpy(&(*copy)[0], data, datasize);
+            dlib::deserialize_flat(model->m_Predictor, (const char*)&(*copy)[0], datasize, copy);
+        }
+    }
+    else if (dlib::is_lz4_stream(data, datasize))
+    {
+        // Compressed with tools/convert_model.cpp --lz4, blocks are decompressed on
+        // background threads ahead of the parser
+        dlib::lz4_istreambuf lz4buf(data, datasize);
+        std::istream lz4stream(&lz4buf);
+        dlib::deserialize(model->m_Predictor, lz4stream);
+    }
+    else
+    {
+        // Models converted with tools/convert_model.cpp have their cascades parsed in
+        // parallel straight out of the buffer
+        dlib::deserialize(model->m_Predictor, data, datasize);
+    }
+    return model;
+}
+
+// Releases the retired models no analysis uses any more, along with their buffers
+static void FacerecReleaseModels(lua_State* L)
+{
+    for (size_t i = 0; i < g_Facerec.m_Retired.size();)
+    {
+        if (g_Facerec.m_Retired[i].use_count() == 1)
+        {
+            // A flat model may point into the buffer, so let go of it first
+            int ref = g_Facerec.m_Retired[i]->m_DataLuaRef;
+            g_Facerec.m_Retired.erase(g_Facerec.m_Retired.begin() + i);
+            dmScript::Unref(L, LUA_REGISTRYINDEX, ref); // We want it destroyed by the GC
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+// Installs a model, or none, and retires the previous one
+static void FacerecInstallModel(lua_State* L, const std::shared_ptr<FacerecModel>& model)
+{
+    {
+        std::shared_ptr<FacerecModel> old = std::atomic_exchange(&g_Facerec.m_Model, model);
+        if (old)
+        {
+            g_Facerec.m_Retired.push_back(old);
+        }
+    }
+    FacerecReleaseModels(L);
+}
+
+// Installs a model the loader has finished, between frames
+static void FacerecUpdateModel(lua_State* L)
+{
+    std::shared_ptr<FacerecModel> loaded;
+    std::vector<std::string> errors;
+    {
+        std::lock_guard<std::mutex> lock(g_Facerec.m_LoaderMutex);
+        loaded.swap(g_Facerec.m_Loaded);
+        errors.swap(g_Facerec.m_LoadErrors);
+        g_Facerec.m_Retired.insert(g_Facerec.m_Retired.end(), g_Facerec.m_Discarded.begin(), g_Facerec.m_Discarded.end());
+        g_Facerec.m_Discarded.clear();
+    }
+    for (size_t i = 0; i < errors.size(); ++i)
+    {
+        dmLogError("Unable to swap the model: %s", errors[i].c_str());
+    }
+    if (loaded)
+    {
+        FacerecInstallModel(L, loaded);
+        g_Facerec.m_ModelChanged = true;
+    }
+    else
+    {
+        FacerecReleaseModels(L);
+    }
+}
+
+static void FacerecLoaderThread()
+{
+    std::unique_lock<std::mutex> lock(g_Facerec.m_LoaderMutex);
+    for (;;)
+    {
+        g_Facerec.m_LoaderCondition.wait(lock, []{ return g_Facerec.m_LoaderStop || g_Facerec.m_HasRequest; });
+        if (g_Facerec.m_LoaderStop)
+        {
+            return;
+        }
+        FacerecModelRequest request = g_Facerec.m_Request;
+        g_Facerec.m_HasRequest = false;
+        lock.unlock();
+
+        std::shared_ptr<FacerecModel> model;
+        std::string error;
+        try
+        {
+            model = FacerecLoadModel(request);
+        }
+        catch (std::exception& e)
+        {
+            error = e.what();
+        }
+
+        lock.lock();
+        if (!model)
+        {
+            // Hand the buffer reference back to the main thread in an empty model
+            std::shared_ptr<FacerecModel> failed = std::make_shared<FacerecModel>();
+            failed->m_DataLuaRef = request.m_DataLuaRef;
+            g_Facerec.m_Discarded.push_back(failed);
+            g_Facerec.m_LoadErrors.push_back(error);
+        }
+        else
+        {
+            if (g_Facerec.m_Loaded)
+            {
+                g_Facerec.m_Discarded.push_back(g_Facerec.m_Loaded);
+            }
+            g_Facerec.m_Loaded = model;
+        }
+    }
+}
+
+static void FacerecStopLoader(lua_State* L)
+{
+    if (g_Facerec.m_Loader.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_Facerec.m_LoaderMutex);
+            g_Facerec.m_LoaderStop = true;
+        }
+        g_Facerec.m_LoaderCondition.notify_all();
+        g_Facerec.m_Loader.join();
+    }
+    g_Facerec.m_LoaderStop = false;
+    if (g_Facerec.m_HasRequest)
+    {
+        g_Facerec.m_HasRequest = false;
+        dmScript::Unref(L, LUA_REGISTRYINDEX, g_Facerec.m_Request.m_DataLuaRef);
+    }
+    // Drops a model loaded after the last frame, it is never installed
+    if (g_Facerec.m_Loaded)
+    {
+        g_Facerec.m_Discarded.push_back(g_Facerec.m_Loaded);
+        g_Facerec.m_Loaded.reset();
+    }
+    FacerecUpdateModel(L);
+}
+
+static bool FacerecParseFormat(const char* name, FacerecFormat& format)
+{
+    static const char* names[] = { "rgb", "nv12", "nv21", "i420", "yv12" };
+    for (size_t i = 0; i < sizeof(names)/sizeof(names[0]); ++i)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            format = (FacerecFormat)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The bytes in a frame, in 64 bits so that it can't overflow. The pixels are addressed
+// with int offsets, so frames over INT_MAX bytes can't be analyzed
+static uint64_t FacerecFrameSize(FacerecFormat format, int width, int height)
+{
+    const uint64_t w = (uint64_t)width;
+    const uint64_t h = (uint64_t)height;
+    if (format == FACEREC_FORMAT_RGB)
+        return w*h*3;
+    return w*h + 2*((w+1)/2)*((h+1)/2);
+}
+
+static void FacerecStartPipeline(int depth);
+static void FacerecStopPipeline();
+
+// The camera frame as a dlib image, top row first, without copying it. The buffer is
+// bottom-up, so its rows are a negative step apart
+struct FacerecCameraImage
+{
+    const uint8_t*  m_Data;
+    long            m_Width;
+    long            m_Height;
+};
+
+// The luma plane of a YUV camera frame as a dlib grayscale image
+struct FacerecLumaImage
+{
+    const uint8_t*  m_Data;
+    long            m_Width;
+    long            m_Height;
+};
+
+namespace dlib
+{
+    template <>
+    struct image_traits<FacerecCameraImage>
+    {
+        typedef rgb_pixel pixel_type;
+    };
+
+    template <>
+    struct image_traits<FacerecLumaImage>
+    {
+        typedef unsigned char pixel_type;
+    };
+}
+
+static inline long num_rows(const FacerecCameraImage& img) { return img.m_Height; }
+static inline long num_columns(const FacerecCameraImage& img) { return img.m_Width; }
+static inline const void* image_data(const FacerecCameraImage& img) { return img.m_Data + (img.m_Height-1)*img.m_Width*3; }
+static inline long width_step(const FacerecCameraImage& img) { return -img.m_Width*3; }
+
+static inline long num_rows(const FacerecLumaImage& img) { return img.m_Height; }
+static inline long num_columns(const FacerecLumaImage& img) { return img.m_Width; }
+static inline const void* image_data(const FacerecLumaImage& img) { return img.m_Data; }
+static inline long width_step(const FacerecLumaImage& img) { return img.m_Width; }
+
+// Forgets the faces of earlier frames, for when new frames can't be compared with them
+static void FacerecForgetFaces()
+{
+    g_Facerec.m_NumTracks = 0;
+    g_Facerec.m_FramesUntilDetection = 0;
+    g_Facerec.m_LandmarkFlow.clear();
+    g_Facerec.m_FlowFaces.clear();
+    g_Facerec.m_Thumbnail.clear();
+    g_Facerec.m_LastShapes.clear();
+    g_Facerec.m_LastFaces.clear();
+}
+
 static int FacerecStart(lua_State* L)
 {
     DM_LUA_STACK_CHECK(L, 0);
-    dmScript::LuaHBuffer* buffer = dmScript::CheckBuffer(L, 1);
-
-    dmScript::PushBuffer(L, *buffer);
-    g_Facerec.m_TrainingDataLuaRef = dmScript::Ref(L, LUA_REGISTRYINDEX);
 
-    g_Facerec.m_Detector = dlib::get_frontal_face_detector();
+    FacerecModelRequest request;
+    FacerecReadModelRequest(L, request);
+
+    // The stages read the options below. A pending swap() is cancelled, so that its model
+    // can't replace the one loaded here
+    FacerecStopPipeline();
+    FacerecStopLoader(L);
+    g_Facerec.m_Grayscale = false;
+    g_Facerec.m_Track = false;
+    g_Facerec.m_DetectInterval = 10;
+    g_Facerec.m_MinTrackConfidence = 7;
+    g_Facerec.m_VerifyTracks = false;
+    g_Facerec.m_Flow = false;
+    g_Facerec.m_LandmarkInterval = 5;
+    g_Facerec.m_MaxFlowError = 1;
+    g_Facerec.m_MotionGate = false;
+    g_Facerec.m_MotionThreshold = 3;
+    g_Facerec.m_MaxLandmarkFaces = 0;
+    g_Facerec.m_LandmarkPriorityAge = false;
+    g_Facerec.m_FullResolutionLandmarks = false;
+    g_Facerec.m_DetectTileSize = 0;
+    double budget = 0;
+    int pipeline_depth = 0;
+    if (lua_istable(L, 2))
+    {
+        lua_getfield(L, 2, "grayscale");
+        g_Facerec.m_Grayscale = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "track");
+        g_Facerec.m_Track = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "detect_interval");
+        g_Facerec.m_DetectInterval = lua_isnumber(L, -1) ? std::max((int)lua_tointeger(L, -1), 1) : 10;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "min_track_confidence");
+        g_Facerec.m_MinTrackConfidence = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : 7;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "verify_tracks");
+        g_Facerec.m_VerifyTracks = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "landmark_flow");
+        g_Facerec.m_Flow = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "landmark_interval");
+        g_Facerec.m_LandmarkInterval = lua_isnumber(L, -1) ? std::max((int)lua_tointeger(L, -1), 1) : 5;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "max_flow_error");
+        g_Facerec.m_MaxFlowError = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : 1;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "motion_gate");
+        g_Facerec.m_MotionGate = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "motion_threshold");
+        g_Facerec.m_MotionThreshold = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : 3;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "max_landmark_faces");
+        g_Facerec.m_MaxLandmarkFaces = lua_isnumber(L, -1) ? std::max((int)lua_tointeger(L, -1), 0) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "landmark_priority");
+        g_Facerec.m_LandmarkPriorityAge = lua_isstring(L, -1) && strcmp(lua_tostring(L, -1), "age") == 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "full_resolution_landmarks");
+        g_Facerec.m_FullResolutionLandmarks = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "detect_tile_size");
+        g_Facerec.m_DetectTileSize = lua_isnumber(L, -1) ? std::max((int)lua_tointeger(L, -1), 0) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "frame_budget");
+        budget = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : 0;
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "pipeline");
+        if (lua_toboolean(L, -1))
+        {
+            pipeline_depth = 3;
+        }
+        lua_pop(L, 1);
+        lua_getfield(L, 2, "pipeline_depth");
+        if (pipeline_depth && lua_isnumber(L, -1))
+        {
+            pipeline_depth = std::max((int)lua_tointeger(L, -1), 1);
+        }
+        lua_pop(L, 1);
+    }
+    g_Facerec.m_Downscale = g_Facerec.m_FullResolutionLandmarks ? 2 : 1;
+    g_Facerec.m_LastDownscale = g_Facerec.m_Downscale;
+    g_Facerec.m_LandmarkCascades = 0;
+    g_Facerec.m_Governor = FacerecGovernor();
+    g_Facerec.m_Governor.m_Budget = budget;
+    g_Facerec.m_Governor.m_BaseDetectInterval = g_Facerec.m_DetectInterval;
+    g_Facerec.m_Governor.m_BaseDownscale = g_Facerec.m_Downscale;
+    g_Facerec.m_Stats = FacerecStats();
+    FacerecForgetFaces();
+
+    std::shared_ptr<FacerecModel> model;
+    char error[256] = {0};
+    try
+    {
+        model = FacerecLoadModel(request);
+    }
+    catch (std::exception& e)
+    {
+        snprintf(error, sizeof(error), "%s", e.what());
+    }
+    if (!model)
+    {
+        dmScript::Unref(L, LUA_REGISTRYINDEX, request.m_DataLuaRef);
+        return DM_LUA_ERROR("Unable to load the model: %s", error);
+    }
+    FacerecInstallModel(L, model);
+    g_Facerec.m_Workers.Start();
+    if (pipeline_depth)
+    {
+        FacerecStartPipeline(pipeline_depth);
+    }
+    return 0;
+}
 
-    uint8_t* data = 0;
-    uint32_t datasize = 0;
-    dmBuffer::GetBytes(buffer->m_Buffer, (void**)&data, &datasize);
+// Loads a new model in the background and installs it at the start of the first
+// analyze() after it is done. Analyses keep using the current model until then
+static int FacerecSwap(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 0);
 
-    imemstream stream( (char const*)data, (size_t)datasize );
-    dlib::deserialize(g_Facerec.m_Predictor, stream);
+    FacerecModelRequest request;
+    FacerecReadModelRequest(L, request);
 
+    std::unique_lock<std::mutex> lock(g_Facerec.m_LoaderMutex);
+    if (g_Facerec.m_HasRequest)
+    {
+        // Superseded before the loader got to it
+        dmScript::Unref(L, LUA_REGISTRYINDEX, g_Facerec.m_Request.m_DataLuaRef);
+    }
+    g_Facerec.m_Request = request;
+    g_Facerec.m_HasRequest = true;
+    if (!g_Facerec.m_Loader.joinable())
+    {
+        try
+        {
+            g_Facerec.m_Loader = std::thread(FacerecLoaderThread);
+        }
+        catch (std::system_error&)
+        {
+            // No threads to be had, so load it here instead
+            g_Facerec.m_HasRequest = false;
+            lock.unlock();
+            std::shared_ptr<FacerecModel> model;
+            char error[256] = {0};
+            try
+            {
+                model = FacerecLoadModel(request);
+            }
+            catch (std::exception& e)
+            {
+                snprintf(error, sizeof(error), "%s", e.what());
+            }
+            if (!model)
+            {
+                dmScript::Unref(L, LUA_REGISTRYINDEX, request.m_DataLuaRef);
+                return DM_LUA_ERROR("Unable to load the model: %s", error);
+            }
+            FacerecInstallModel(L, model);
+            return 0;
+        }
+    }
+    g_Facerec.m_LoaderCondition.notify_all();
     return 0;
 }
 
 static int FacerecStop(lua_State* L)
 {
-    dmScript::Unref(L, LUA_REGISTRYINDEX, g_Facerec.m_TrainingDataLuaRef); // We want it destroyed by the GC
+    FacerecStopPipeline();
+    FacerecStopLoader(L);
+    g_Facerec.m_Workers.Stop();
+    FacerecInstallModel(L, std::shared_ptr<FacerecModel>());
+    g_Facerec.m_Trackers.clear();
+    FacerecForgetFaces();
     return 0;
 }
 
@@ -98,70 +1029,409 @@ static void FaceRecPushPoint(lua_State* L, int index, int x, int y)
     lua_rawset(L, -3);
 }
 
-static int FacerecAnalyze(lua_State* L)
+// Rec. 601 luma in 8 bit fixed point
+static inline uint8_t FacerecLuminance(const uint8_t* rgb)
+{
+    return (uint8_t)((77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8);
+}
+
+// Camera pixels per thumbnail pixel, and thumbnail pixels per tile, for motion gating
+static const int FACEREC_THUMBNAIL_SCALE = 8;
+static const int FACEREC_TILE_SIZE = 8;
+
+// Makes the luminance thumbnail of a frame. Each pixel is the average of every other
+// pixel of every other row of its block, which is plenty to smooth out sensor noise.
+// Rows are padded to whole tiles
+static void FacerecMakeThumbnail(const FacerecFrame& frame, std::vector<uint8_t>& thumbnail, int& thumbnail_width)
+{
+    const uint8_t* data = frame.m_Data;
+    const int width = frame.m_Width;
+    const int height = frame.m_Height;
+    const bool rgb = frame.m_Format == FACEREC_FORMAT_RGB;
+    const int scale = FACEREC_THUMBNAIL_SCALE;
+    const int rows = height / scale;
+    const int cols = width / scale;
+    thumbnail_width = (cols + FACEREC_TILE_SIZE - 1) / FACEREC_TILE_SIZE * FACEREC_TILE_SIZE;
+    thumbnail.assign(thumbnail_width * rows, 0);
+    for (int ty = 0; ty < rows; ++ty)
+    {
+        for (int tx = 0; tx < cols; ++tx)
+        {
+            int sum = 0;
+            for (int y = ty*scale; y < (ty+1)*scale; y += 2)
+            {
+                for (int x = tx*scale; x < (tx+1)*scale; x += 2)
+                {
+                    sum += rgb ? FacerecLuminance(&data[y*width*3 + x*3]) : data[y*width + x];
+                }
+            }
+            thumbnail[ty*thumbnail_width + tx] = (uint8_t)(sum / ((scale/2)*(scale/2)));
+        }
+    }
+}
+
+// Finds the part of the analyzed image that changed since the last frame analyzed, in
+// whole tiles. Returns the whole image when there is nothing to compare with, and an
+// empty rectangle when no tile changed. The thumbnail is only replaced when something
+// changed, so slow changes add up until they count
+static dlib::rectangle FacerecFindMotion(const FacerecFrame& frame)
+{
+    const int height = frame.m_Height;
+    const int downscale = frame.m_Downscale;
+    const dlib::rectangle all(0, 0, (frame.m_Width>>downscale)-1, (height>>downscale)-1);
+    int thumbnail_width = 0;
+    FacerecMakeThumbnail(frame, g_Facerec.m_NewThumbnail, thumbnail_width);
+    if (g_Facerec.m_Thumbnail.size() != g_Facerec.m_NewThumbnail.size() || g_Facerec.m_ThumbnailWidth != thumbnail_width)
+    {
+        g_Facerec.m_Thumbnail.swap(g_Facerec.m_NewThumbnail);
+        g_Facerec.m_ThumbnailWidth = thumbnail_width;
+        return all;
+    }
+
+    const int rows = height / FACEREC_THUMBNAIL_SCALE;
+    const int cols = frame.m_Width / FACEREC_THUMBNAIL_SCALE;
+    const int tiles_x = thumbnail_width / FACEREC_TILE_SIZE;
+    const int tiles_y = (rows + FACEREC_TILE_SIZE - 1) / FACEREC_TILE_SIZE;
+    std::vector<unsigned int> sums(tiles_x * tiles_y, 0);
+    const dlib::simd_kernels& kernels = dlib::get_simd_kernels();
+    for (int y = 0; y < rows; ++y)
+    {
+        kernels.grouped_abs_diff(&g_Facerec.m_NewThumbnail[y*thumbnail_width], &g_Facerec.m_Thumbnail[y*thumbnail_width],
+                                 &sums[(y/FACEREC_TILE_SIZE)*tiles_x], tiles_x);
+    }
+
+    // The changed tiles in camera pixels. The tiles at the bottom and right edges can be
+    // partial, and their padding never differs, so they are averaged over the thumbnail
+    // pixels they do cover
+    const int tile_pixels = FACEREC_THUMBNAIL_SCALE * FACEREC_TILE_SIZE;
+    dlib::rectangle changed;
+    for (int ty = 0; ty < tiles_y; ++ty)
+    {
+        const int tile_rows = std::min(FACEREC_TILE_SIZE, rows - ty*FACEREC_TILE_SIZE);
+        for (int tx = 0; tx < tiles_x; ++tx)
+        {
+            const int tile_cols = std::min(FACEREC_TILE_SIZE, cols - tx*FACEREC_TILE_SIZE);
+            if (sums[ty*tiles_x + tx] > g_Facerec.m_MotionThreshold * tile_cols * tile_rows)
+            {
+                changed += dlib::rectangle(tx*tile_pixels, ty*tile_pixels, (tx+1)*tile_pixels-1, (ty+1)*tile_pixels-1);
+            }
+        }
+    }
+    if (changed.is_empty())
+    {
+        return changed;
+    }
+    g_Facerec.m_Thumbnail.swap(g_Facerec.m_NewThumbnail);
+
+    // The analyzed image is downscaled, and upside down from RGB frames
+    if (frame.m_Format == FACEREC_FORMAT_RGB)
+    {
+        changed = dlib::rectangle(changed.left(), height-1-changed.bottom(), changed.right(), height-1-changed.top());
+    }
+    dlib::rectangle area(changed.left()>>downscale, changed.top()>>downscale, changed.right()>>downscale, changed.bottom()>>downscale);
+    return area.intersect(all);
+}
+
+// Calls fn(i) for every i in [0, count), spread over the CPU cores
+template <typename Function>
+static void FacerecParallelFor(unsigned long count, const Function& fn)
+{
+    g_Facerec.m_Workers.ParallelFor(count, fn);
+}
+
+// Runs the detector on the whole image, in tiles if it is larger than detect_tile_size
+template <typename image_type>
+static std::vector<dlib::rectangle> FacerecRunDetector(FacerecModel& model, const image_type& img)
+{
+    const unsigned long tile_size = g_Facerec.m_DetectTileSize;
+    const dlib::rectangle all = dlib::get_rect(img);
+    if (tile_size == 0 || (all.width() <= tile_size && all.height() <= tile_size))
+    {
+        return model.m_Detector(img);
+    }
+    std::vector<dlib::rect_detection> dets;
+    dlib::detect_objects_in_tiles(model.m_Detector, img, dets, tile_size);
+    std::vector<dlib::rectangle> faces(dets.size());
+    for (size_t i = 0; i < dets.size(); ++i)
+    {
+        faces[i] = dets[i].rect;
+    }
+    return faces;
+}
+
+// Runs the detector on the part of the image that changed, and keeps the faces of the
+// last frame analyzed that are away from it
+template <typename image_type>
+static void FacerecDetect(FacerecModel& model, const image_type& img, dlib::rectangle area, std::vector<dlib::rectangle>& faces)
+{
+    if (area == dlib::get_rect(img))
+    {
+        faces = FacerecRunDetector(model, img);
+        return;
+    }
+
+    // A face partly in the changed area is searched for again as a whole, with room
+    // around it to have moved, and so is any face that room touches
+    std::vector<bool> kept(g_Facerec.m_LastFaces.size(), true);
+    for (bool grown = true; grown;)
+    {
+        grown = false;
+        for (size_t i = 0; i < kept.size(); ++i)
+        {
+            const dlib::rectangle& rect = g_Facerec.m_LastFaces[i];
+            if (kept[i] && !area.intersect(rect).is_empty())
+            {
+                area += dlib::grow_rect(rect, rect.width()/4);
+                kept[i] = false;
+                grown = true;
+            }
+        }
+    }
+    // Also leave room for a detection window to fit around new faces
+    area = dlib::grow_rect(area, 40).intersect(dlib::get_rect(img));
+
+    faces.clear();
+    for (size_t i = 0; i < kept.size(); ++i)
+    {
+        if (kept[i])
+            faces.push_back(g_Facerec.m_LastFaces[i]);
+    }
+    std::vector<dlib::rectangle> found = FacerecRunDetector(model, dlib::sub_image(img, area));
+    for (size_t i = 0; i < found.size(); ++i)
+    {
+        faces.push_back(dlib::translate_rect(found[i], area.tl_corner()));
+    }
+}
+
+// Finds the faces in a frame, either with the detector or by following the faces it
+// found earlier with the trackers. Without trackers, the detector only searches the
+// given area of the image for new faces
+template <typename image_type>
+static void FacerecFindFaces(FacerecModel& model, const image_type& img, const dlib::rectangle& area, std::vector<dlib::rectangle>& faces)
+{
+    faces.clear();
+    if (!g_Facerec.m_Track)
+    {
+        FacerecDetect(model, img, area, faces);
+        return;
+    }
+
+    bool detect = g_Facerec.m_FramesUntilDetection <= 0;
+    if (!detect)
+    {
+        std::vector<double> confidences(g_Facerec.m_NumTracks);
+        FacerecParallelFor(g_Facerec.m_NumTracks, [&](unsigned long i) {
+            confidences[i] = g_Facerec.m_Trackers[i].update(img);
+            if (g_Facerec.m_VerifyTracks && confidences[i] >= g_Facerec.m_MinTrackConfidence)
+            {
+                // Only the window of the tracked face is scored, which is a small
+                // fraction of the work of a full detection
+                std::vector<dlib::rect_detection> scores;
+                dlib::score_detection_window(model.m_Detector, img, g_Facerec.m_Trackers[i].get_position(), scores, 1);
+                bool found = false;
+                for (size_t j = 0; j < scores.size(); ++j)
+                    found = found || scores[j].detection_confidence >= 0;
+                if (!found)
+                    confidences[i] = -1;
+            }
+        });
+        for (unsigned long i = 0; i < g_Facerec.m_NumTracks; ++i)
+        {
+            detect = detect || confidences[i] < g_Facerec.m_MinTrackConfidence;
+            faces.push_back(g_Facerec.m_Trackers[i].get_position());
+        }
+    }
+    if (!detect)
+    {
+        --g_Facerec.m_FramesUntilDetection;
+        return;
+    }
+
+    // Start over from the faces the detector finds, reusing the trackers we have
+    faces = FacerecRunDetector(model, img);
+    if (g_Facerec.m_Trackers.size() < faces.size())
+    {
+        g_Facerec.m_Trackers.resize(faces.size());
+    }
+    FacerecParallelFor(faces.size(), [&](unsigned long i) {
+        g_Facerec.m_Trackers[i].start_track(img, faces[i]);
+    });
+    g_Facerec.m_NumTracks = faces.size();
+    g_Facerec.m_FramesUntilDetection = g_Facerec.m_DetectInterval - 1;
+}
+
+// Matches the faces to the faces of the last frame, one to one. Of the pairs that overlap
+// by more than half, the ones that overlap the most are matched first. Faces left
+// without a match are new
+static void FacerecMatchFaces(const std::vector<dlib::rectangle>& faces, std::vector<const FacerecFlowFace*>& prevs)
+{
+    struct Match
+    {
+        double          m_Overlap;
+        unsigned long   m_Face;
+        unsigned long   m_Prev;
+    };
+    const std::vector<FacerecFlowFace>& flow_faces = g_Facerec.m_FlowFaces;
+    std::vector<Match> matches;
+    for (unsigned long f = 0; f < faces.size(); ++f)
+    {
+        for (unsigned long p = 0; p < flow_faces.size(); ++p)
+        {
+            const dlib::rectangle& prev = flow_faces[p].m_Rect;
+            const double inner = faces[f].intersect(prev).area();
+            const double overlap = inner / (faces[f].area() + prev.area() - inner);
+            if (overlap > 0.5)
+            {
+                Match match = { overlap, f, p };
+                matches.push_back(match);
+            }
+        }
+    }
+    std::stable_sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+        return a.m_Overlap > b.m_Overlap;
+    });
+
+    prevs.assign(faces.size(), 0);
+    std::vector<bool> taken(flow_faces.size(), false);
+    for (size_t i = 0; i < matches.size(); ++i)
+    {
+        if (prevs[matches[i].m_Face] || taken[matches[i].m_Prev])
+            continue;
+        prevs[matches[i].m_Face] = &flow_faces[matches[i].m_Prev];
+        taken[matches[i].m_Prev] = true;
+    }
+}
+
+template <typename image_type>
+static dlib::full_object_detection FacerecPredict(FacerecModel& model, const image_type& img, const dlib::rectangle& face)
 {
-    DM_LUA_STACK_CHECK(L, 1);
-
-    int width = luaL_checkint(L, 1);
-    int height = luaL_checkint(L, 2);
-    dmScript::LuaHBuffer* buffer = dmScript::CheckBuffer(L, 3);
+    if (g_Facerec.m_LandmarkCascades == 0)
+        return model.m_Predictor(img, face);
+    return model.m_Predictor(img, face, g_Facerec.m_LandmarkCascades);
+}
 
-    uint8_t* data = 0;
-    uint32_t datasize = 0;
-    dmBuffer::GetBytes(buffer->m_Buffer, (void**)&data, &datasize);
+// Picks the faces to find landmarks for when there are more than max_landmark_faces of
+// them. New faces have no landmarks to carry over, so they always get them, even beyond
+// the budget. Of the slots left, all but one go to the faces that matter most, the
+// largest or the ones seen the longest, and the last slot goes round-robin to the other
+// face whose landmarks are the oldest
+static void FacerecScheduleLandmarks(const std::vector<dlib::rectangle>& faces, const std::vector<const FacerecFlowFace*>& prevs, std::vector<bool>& refresh)
+{
+    refresh.assign(faces.size(), false);
+    std::vector<unsigned long> order;
+    for (unsigned long f = 0; f < faces.size(); ++f)
+    {
+        if (prevs[f])
+            order.push_back(f);
+        else
+            refresh[f] = true;
+    }
+    const unsigned long num_new = faces.size() - order.size();
+    if (num_new >= g_Facerec.m_MaxLandmarkFaces)
+        return;
+
+    std::stable_sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) {
+        if (g_Facerec.m_LandmarkPriorityAge)
+            return prevs[a]->m_Age > prevs[b]->m_Age;
+        return faces[a].area() > faces[b].area();
+    });
+
+    // There are more faces than slots, so the faces seen before outnumber the slots left
+    const unsigned long first = g_Facerec.m_MaxLandmarkFaces - num_new - 1;
+    for (unsigned long i = 0; i < first; ++i)
+        refresh[order[i]] = true;
+    unsigned long oldest = order[first];
+    for (unsigned long i = first; i < order.size(); ++i)
+    {
+        if (prevs[order[i]]->m_FramesSinceRefresh > prevs[oldest]->m_FramesSinceRefresh)
+            oldest = order[i];
+    }
+    refresh[oldest] = true;
+}
 
-    dlib::array2d<dlib::rgb_pixel> img;
+// Finds the landmarks of the faces, either with the shape predictor or by following
+// the landmarks of the same faces in the last frame with optical flow. Faces left out
+// by the landmark budget get their last landmarks again, moved along with the face
+template <typename image_type>
+static void FacerecFindLandmarks(FacerecModel& model, const image_type& img, const std::vector<dlib::rectangle>& faces, std::vector<dlib::full_object_detection>& shapes)
+{
+    shapes.clear();
+    if (!g_Facerec.m_Flow && g_Facerec.m_MaxLandmarkFaces == 0)
+    {
+        for (unsigned long f = 0; f < faces.size(); ++f)
+            shapes.push_back(FacerecPredict(model, img, faces[f]));
+        return;
+    }
 
-    /*
-    // yes...
-    img.set_size(height, width);
-    for( int y = 0; y < height; ++y)
+    if (g_Facerec.m_Flow)
+        g_Facerec.m_LandmarkFlow.next_frame(img);
+    std::vector<const FacerecFlowFace*> prevs;
+    FacerecMatchFaces(faces, prevs);
+    std::vector<bool> refresh(faces.size(), true);
+    if (g_Facerec.m_MaxLandmarkFaces > 0 && faces.size() > g_Facerec.m_MaxLandmarkFaces)
+        FacerecScheduleLandmarks(faces, prevs, refresh);
+
+    std::vector<FacerecFlowFace> next;
+    next.reserve(faces.size());
+    std::vector<double> errors;
+    for (unsigned long f = 0; f < faces.size(); ++f)
     {
-        for( int x = 0; x < width; ++x)
+        const FacerecFlowFace* prev = prevs[f];
+        if (!refresh[f])
         {
-            dlib::rgb_pixel p;
-            p.red   = data[y*width*3 + x*3 + 0];
-            p.green = data[y*width*3 + x*3 + 1];
-            p.blue  = data[y*width*3 + x*3 + 2];
-            dlib::assign_pixel(img[height-y-1][x],p);
+            // Only faces seen before are left out by the budget
+            next.push_back(*prev);
+            FacerecFlowFace& face = next.back();
+            face.m_Rect = faces[f];
+            ++face.m_Age;
+            ++face.m_FramesSinceRefresh;
+            const double scale = (double)faces[f].width() / prev->m_Rect.width();
+            for (size_t i = 0; i < face.m_Parts.size(); ++i)
+                face.m_Parts[i] = dlib::dcenter(faces[f]) + (prev->m_Parts[i] - dlib::dcenter(prev->m_Rect)) * scale;
+            shapes.push_back(dlib::full_object_detection(faces[f], std::vector<dlib::point>(face.m_Parts.begin(), face.m_Parts.end())));
+            continue;
         }
-    }*/
 
-    // Poor mans' downscale
-    int downscale = 1;
-    img.set_size(height>>downscale, width>>downscale);
-    for( int y = 0; y < height; ++y)
-    {
-        for( int x = 0; x < width; ++x)
+        next.push_back(FacerecFlowFace());
+        FacerecFlowFace& face = next.back();
+        face.m_Rect = faces[f];
+        face.m_Age = prev ? prev->m_Age + 1 : 0;
+        face.m_FramesSinceRefresh = 0;
+        bool predict = !g_Facerec.m_Flow || !prev || prev->m_FramesUntilPrediction <= 0 || !g_Facerec.m_LandmarkFlow.has_previous_frame();
+        if (!predict)
         {
-            dlib::rgb_pixel p;
-            p.red   = data[y*width*3 + x*3 + 0];
-            p.green = data[y*width*3 + x*3 + 1];
-            p.blue  = data[y*width*3 + x*3 + 2];
-            int ty = (height-y-1)>>downscale;
-            int tx = x >> downscale;
-            dlib::assign_pixel(img[ty][tx],p);
+            // A lost landmark usually means the face turned or was covered, which the
+            // shape predictor handles and flow doesn't
+            g_Facerec.m_LandmarkFlow.track_points(prev->m_Parts, face.m_Parts, errors);
+            for (size_t i = 0; i < errors.size(); ++i)
+                predict = predict || errors[i] > g_Facerec.m_MaxFlowError;
+            face.m_FramesUntilPrediction = prev->m_FramesUntilPrediction - 1;
         }
-    }
-
-    // static int count = 0;
-    // count++;
-    // if ( count == 5 )
-    // {
-    //     std::ofstream myfile;
-    //     const char* path = "/Users/mathiaswesterdahl/work/test.bmp";
-    //     myfile.open(path);
-    //     dlib::save_bmp(img, myfile);
-    //     printf("\n\nSAVED FILE: %s\n\n", path);
-    // }
 
-    std::vector<dlib::rectangle> faces = g_Facerec.m_Detector(img);
+        if (predict)
+        {
+            shapes.push_back(FacerecPredict(model, img, faces[f]));
+            face.m_Parts.assign(shapes.back().num_parts(), dlib::dpoint());
+            for (unsigned long i = 0; i < shapes.back().num_parts(); ++i)
+                face.m_Parts[i] = shapes.back().part(i);
+            face.m_FramesUntilPrediction = g_Facerec.m_LandmarkInterval - 1;
+        }
+        else
+        {
+            shapes.push_back(dlib::full_object_detection(faces[f], std::vector<dlib::point>(face.m_Parts.begin(), face.m_Parts.end())));
+        }
+    }
+    g_Facerec.m_FlowFaces.swap(next);
+}
 
+// Pushes a table with the landmarks of each face, in camera coordinates
+static void FacerecPushShapes(lua_State* L, const std::vector<dlib::full_object_detection>& shapes, int downscale, int height)
+{
     lua_newtable(L);
 
-    for(unsigned long f = 0; f < faces.size(); ++f)
+    for(unsigned long f = 0; f < shapes.size(); ++f)
     {
-        dlib::full_object_detection shape = g_Facerec.m_Predictor(img, faces[f]);
+        const dlib::full_object_detection& shape = shapes[f];
 
         lua_pushnumber(L, f + 1);
         lua_newtable(L);
@@ -257,8 +1527,558 @@ static int FacerecAnalyze(lua_State* L)
         // face
         lua_rawset(L, -3);
     }
+}
+
+// Pipeline stage 1: converts the camera frame for the detector, unless motion gating
+// finds that nothing moved
+static void FacerecIngestStage(FacerecFrame& frame)
+{
+    const uint8_t* data = frame.m_Data;
+    const int width = frame.m_Width;
+    const int height = frame.m_Height;
+    const int downscale = frame.m_Downscale;
+    dlib::array2d<dlib::rgb_pixel>& img = frame.m_Image;
+    dlib::array2d<unsigned char>& gray = frame.m_Gray;
+
+    /*
+    // yes...
+    img.set_size(height, width);
+    for( int y = 0; y < height; ++y)
+    {
+        for( int x = 0; x < width; ++x)
+        {
+            dlib::rgb_pixel p;
+            p.red   = data[y*width*3 + x*3 + 0];
+            p.green = data[y*width*3 + x*3 + 1];
+            p.blue  = data[y*width*3 + x*3 + 2];
+            dlib::assign_pixel(img[height-y-1][x],p);
+        }
+    }*/
+
+    // Skip frames where nothing moved since the last frame analyzed, and otherwise only
+    // look for new faces where something did. Don't let motion gating hand out the
+    // results of a model that was replaced
+    frame.m_Area = dlib::rectangle(0, 0, (width>>downscale)-1, (height>>downscale)-1);
+    frame.m_Moved = true;
+    frame.m_Grayscale = g_Facerec.m_Grayscale || frame.m_Format != FACEREC_FORMAT_RGB;
+    if (g_Facerec.m_ModelChanged.exchange(false))
+    {
+        g_Facerec.m_Thumbnail.clear();
+    }
+    if (g_Facerec.m_MotionGate)
+    {
+        frame.m_Area = FacerecFindMotion(frame);
+        frame.m_Moved = !frame.m_Area.is_empty();
+    }
+
+    if (!frame.m_Moved)
+    {
+    }
+    else if (frame.m_Format != FACEREC_FORMAT_RGB)
+    {
+        // The luma plane already is the grayscale image, only shrink it
+        gray.set_size(height>>downscale, width>>downscale);
+        for (long ty = 0; ty < gray.nr(); ++ty)
+        {
+            const uint8_t* row = &data[(ty<<downscale)*width];
+            if (downscale == 0)
+            {
+                memcpy(&gray[ty][0], row, width);
+                continue;
+            }
+            for (long tx = 0; tx < gray.nc(); ++tx)
+            {
+                gray[ty][tx] = row[tx<<downscale];
+            }
+        }
+    }
+    else if (g_Facerec.m_Grayscale)
+    {
+        // Convert to luminance once, so the pyramid and the HOG features only have one channel to process
+        gray.set_size(height>>downscale, width>>downscale);
+        for( int y = 0; y < height; ++y)
+        {
+            for( int x = 0; x < width; ++x)
+            {
+                int ty = (height-y-1)>>downscale;
+                int tx = x >> downscale;
+                gray[ty][tx] = FacerecLuminance(&data[y*width*3 + x*3]);
+            }
+        }
+    }
+    else
+    {
+        img.set_size(height>>downscale, width>>downscale);
+        for( int y = 0; y < height; ++y)
+        {
+            for( int x = 0; x < width; ++x)
+            {
+                dlib::rgb_pixel p;
+                p.red   = data[y*width*3 + x*3 + 0];
+                p.green = data[y*width*3 + x*3 + 1];
+                p.blue  = data[y*width*3 + x*3 + 2];
+                int ty = (height-y-1)>>downscale;
+                int tx = x >> downscale;
+                dlib::assign_pixel(img[ty][tx],p);
+            }
+        }
+    }
+
+    // static int count = 0;
+    // count++;
+    // if ( count == 5 )
+    // {
+    //     std::ofstream myfile;
+    //     const char* path = "/Users/mathiaswesterdahl/work/test.bmp";
+    //     myfile.open(path);
+    //     dlib::save_bmp(img, myfile);
+    //     printf("\n\nSAVED FILE: %s\n\n", path);
+    // }
+
+    frame.m_Ingested = FacerecClock::now();
+}
+
+// Pipeline stage 2: finds the faces
+static void FacerecDetectStage(FacerecFrame& frame)
+{
+    if (!frame.m_Moved)
+    {
+    }
+    else if (frame.m_Grayscale)
+    {
+        FacerecFindFaces(*frame.m_Model, frame.m_Gray, frame.m_Area, frame.m_Faces);
+    }
+    else
+    {
+        FacerecFindFaces(*frame.m_Model, frame.m_Image, frame.m_Area, frame.m_Faces);
+    }
+    if (frame.m_Moved && g_Facerec.m_MotionGate)
+    {
+        g_Facerec.m_LastFaces = frame.m_Faces;
+    }
+    frame.m_Detected = FacerecClock::now();
+}
+
+// Pipeline stage 3: finds the landmarks of the faces, or hands out the last ones again
+// when nothing moved
+static void FacerecLandmarkStage(FacerecFrame& frame)
+{
+    frame.m_ShapeDownscale = g_Facerec.m_FullResolutionLandmarks ? 0 : frame.m_Downscale;
+    if (!frame.m_Moved)
+    {
+        frame.m_Shapes = g_Facerec.m_LastShapes;
+    }
+    else if (g_Facerec.m_FullResolutionLandmarks)
+    {
+        // The shape predictor only reads a few hundred pixels per face, so it can read
+        // them from the camera frame as is, where they are the most precise
+        const int downscale = frame.m_Downscale;
+        std::vector<dlib::rectangle> faces(frame.m_Faces.size());
+        for (size_t i = 0; i < faces.size(); ++i)
+        {
+            const dlib::rectangle& face = frame.m_Faces[i];
+            faces[i] = dlib::rectangle(face.left()<<downscale, face.top()<<downscale, ((face.right()+1)<<downscale)-1, ((face.bottom()+1)<<downscale)-1);
+        }
+        if (frame.m_Format == FACEREC_FORMAT_RGB)
+        {
+            const FacerecCameraImage camera = { frame.m_Data, frame.m_Width, frame.m_Height };
+            FacerecFindLandmarks(*frame.m_Model, camera, faces, frame.m_Shapes);
+        }
+        else
+        {
+            const FacerecLumaImage luma = { frame.m_Data, frame.m_Width, frame.m_Height };
+            FacerecFindLandmarks(*frame.m_Model, luma, faces, frame.m_Shapes);
+        }
+    }
+    else if (frame.m_Grayscale)
+    {
+        FacerecFindLandmarks(*frame.m_Model, frame.m_Gray, frame.m_Faces, frame.m_Shapes);
+    }
+    else
+    {
+        FacerecFindLandmarks(*frame.m_Model, frame.m_Image, frame.m_Faces, frame.m_Shapes);
+    }
+    if (g_Facerec.m_MotionGate)
+    {
+        g_Facerec.m_LastShapes = frame.m_Shapes;
+    }
+    frame.m_Finished = FacerecClock::now();
+}
+
+// Adds a finished frame to the statistics. Frames skipped by motion gating count
+// toward the latency and the rate of results but not toward the stage times
+static void FacerecAccount(const FacerecFrame& frame)
+{
+    typedef std::chrono::duration<double, std::milli> ms;
+    FacerecStats& stats = g_Facerec.m_Stats;
+    const double rate = stats.m_Frames == 0 ? 1 : 0.1;
+    stats.m_Latency += rate * (ms(frame.m_Finished - frame.m_Submitted).count() - stats.m_Latency);
+    if (stats.m_Frames != 0)
+    {
+        const double interval = ms(frame.m_Finished - stats.m_LastFinished).count();
+        stats.m_Interval += (stats.m_Frames == 1 ? 1 : 0.1) * (interval - stats.m_Interval);
+    }
+    stats.m_LastFinished = frame.m_Finished;
+    if (frame.m_Moved)
+    {
+        const double moved_rate = stats.m_MovedFrames == 0 ? 1 : 0.1;
+        stats.m_Ingest += moved_rate * (ms(frame.m_Ingested - frame.m_Submitted).count() - stats.m_Ingest);
+        stats.m_Detect += moved_rate * (ms(frame.m_Detected - frame.m_Ingested).count() - stats.m_Detect);
+        stats.m_Landmarks += moved_rate * (ms(frame.m_Finished - frame.m_Detected).count() - stats.m_Landmarks);
+        ++stats.m_MovedFrames;
+    }
+    ++stats.m_Frames;
+}
+
+// Runs a pipeline stage on the frames of one queue and hands them to the next
+static void FacerecStageThread(FacerecQueue* in, FacerecQueue* out, void (*stage)(FacerecFrame&))
+{
+    std::unique_ptr<FacerecFrame> frame;
+    while (in->Pop(frame))
+    {
+        stage(*frame);
+        if (!out->Push(frame))
+            break;
+    }
+}
+
+static void FacerecStopPipeline()
+{
+    FacerecPipeline& pipeline = g_Facerec.m_Pipeline;
+    pipeline.m_ToIngest.Close();
+    pipeline.m_ToDetect.Close();
+    pipeline.m_ToLandmarks.Close();
+    pipeline.m_Finished.Close();
+    for (size_t i = 0; i < pipeline.m_Threads.size(); ++i)
+        pipeline.m_Threads[i].join();
+    pipeline.m_Threads.clear();
+    pipeline.m_InFlight = 0;
+    pipeline.m_FreeFrames.clear();
+    pipeline.m_Shapes.clear();
+}
+
+// Runs the stages of analysis on their own threads, with at most depth frames between
+// them. Falls back to analyzing frames on the calling thread if threads can't be made
+static void FacerecStartPipeline(int depth)
+{
+    FacerecPipeline& pipeline = g_Facerec.m_Pipeline;
+    pipeline.m_MaxInFlight = depth;
+    pipeline.m_ToIngest.Open(depth);
+    pipeline.m_ToDetect.Open(depth);
+    pipeline.m_ToLandmarks.Open(depth);
+    pipeline.m_Finished.Open(depth);
+    try
+    {
+        pipeline.m_Threads.push_back(std::thread(FacerecStageThread, &pipeline.m_ToIngest, &pipeline.m_ToDetect, FacerecIngestStage));
+        pipeline.m_Threads.push_back(std::thread(FacerecStageThread, &pipeline.m_ToDetect, &pipeline.m_ToLandmarks, FacerecDetectStage));
+        pipeline.m_Threads.push_back(std::thread(FacerecStageThread, &pipeline.m_ToLandmarks, &pipeline.m_Finished, FacerecLandmarkStage));
+    }
+    catch (std::system_error& e)
+    {
+        dmLogWarning("Unable to start the analysis pipeline: %s", e.what());
+        FacerecStopPipeline();
+    }
+}
+
+// Hands a frame to the pipeline and pushes the faces of the newest frame it finished,
+// which is a few frames behind. The frame is dropped when the pipeline is full, so that
+// analyze() never waits for it
+static void FacerecAnalyzePipelined(lua_State* L, const std::shared_ptr<FacerecModel>& model, const uint8_t* data, FacerecFormat format, int width, int height)
+{
+    FacerecPipeline& pipeline = g_Facerec.m_Pipeline;
+    std::unique_ptr<FacerecFrame> frame;
+    while (pipeline.m_Finished.TryPop(frame))
+    {
+        --pipeline.m_InFlight;
+        FacerecAccount(*frame);
+        pipeline.m_Shapes.swap(frame->m_Shapes);
+        pipeline.m_Downscale = frame->m_ShapeDownscale;
+        pipeline.m_Height = frame->m_Height;
+        // A frame must not keep a replaced model from being released
+        frame->m_Model.reset();
+        pipeline.m_FreeFrames.push_back(std::move(frame));
+    }
+
+    if (pipeline.m_InFlight < pipeline.m_MaxInFlight)
+    {
+        if (pipeline.m_FreeFrames.empty())
+        {
+            frame.reset(new FacerecFrame());
+        }
+        else
+        {
+            frame = std::move(pipeline.m_FreeFrames.back());
+            pipeline.m_FreeFrames.pop_back();
+            frame->m_Faces.clear();
+        }
+        frame->m_Model = model;
+        // Only the luma plane of YUV frames is needed. A reused frame has room for it
+        // unless the camera resolution went up
+        frame->m_Copy.assign(data, data + (format == FACEREC_FORMAT_RGB ? width*height*3 : width*height));
+        frame->m_Data = &frame->m_Copy[0];
+        frame->m_Format = format;
+        frame->m_Width = width;
+        frame->m_Height = height;
+        frame->m_Downscale = g_Facerec.m_Downscale;
+        frame->m_Submitted = FacerecClock::now();
+        if (pipeline.m_ToIngest.Push(frame))
+            ++pipeline.m_InFlight;
+    }
+    else
+    {
+        ++g_Facerec.m_Stats.m_Dropped;
+    }
+
+    FacerecPushShapes(L, pipeline.m_Shapes, pipeline.m_Downscale, pipeline.m_Height);
+}
+
+// Frames measured after a change before judging it, and frames well under budget in a
+// row before undoing a change
+static const int FACEREC_GOVERNOR_SETTLE = 30;
+static const int FACEREC_GOVERNOR_PATIENCE = 90;
+// A change is only undone when the time it is predicted to add leaves this much of the
+// budget, so that it doesn't have to be made again right away
+static const double FACEREC_GOVERNOR_HEADROOM = 0.8;
+static const int FACEREC_MAX_EXTRA_DOWNSCALE = 1;
+static const int FACEREC_MAX_DETECT_INTERVAL_FACTOR = 8;
+
+// Feeds the governor the stage times of an analyzed frame, in milliseconds. Moves one
+// setting at a time, when the frames have been over budget since the last change or
+// well under it for long
+static void FacerecGovern(FacerecModel& model, double ingest, double detect, double landmarks)
+{
+    FacerecGovernor& governor = g_Facerec.m_Governor;
+    if (governor.m_Budget <= 0)
+    {
+        return;
+    }
+
+    // Moving averages, started over after each change
+    const double rate = governor.m_NumSamples == 0 ? 1 : 0.1;
+    governor.m_IngestTime += rate * (ingest - governor.m_IngestTime);
+    governor.m_DetectTime += rate * (detect - governor.m_DetectTime);
+    governor.m_LandmarkTime += rate * (landmarks - governor.m_LandmarkTime);
+    if (++governor.m_NumSamples < FACEREC_GOVERNOR_SETTLE)
+    {
+        return;
+    }
+
+    ingest = governor.m_IngestTime;
+    detect = governor.m_DetectTime;
+    landmarks = governor.m_LandmarkTime;
+    const double total = ingest + detect + landmarks;
+    const double limit = FACEREC_GOVERNOR_HEADROOM * governor.m_Budget;
+    const unsigned long all_cascades = model.m_Predictor.num_cascades();
+    const unsigned long cascades = g_Facerec.m_LandmarkCascades == 0 ? all_cascades : std::min(g_Facerec.m_LandmarkCascades, all_cascades);
+    const unsigned long min_cascades = (all_cascades + 1) / 2;
+    const int max_interval = governor.m_BaseDetectInterval * FACEREC_MAX_DETECT_INTERVAL_FACTOR;
+    governor.m_FramesUnderBudget = total < limit ? governor.m_FramesUnderBudget + 1 : 0;
+
+    bool changed = true;
+    if (total > governor.m_Budget)
+    {
+        // Cut down the stage that takes the longest. Detection gets cheaper by leaving
+        // more frames to the trackers, and then by shrinking the frame, which makes
+        // converting it cheaper too but misses the smallest faces
+        if (landmarks > ingest + detect && cascades > min_cascades)
+            g_Facerec.m_LandmarkCascades = cascades - 1;
+        else if (g_Facerec.m_Track && g_Facerec.m_DetectInterval < max_interval)
+            g_Facerec.m_DetectInterval = std::min(g_Facerec.m_DetectInterval * 2, max_interval);
+        else if (g_Facerec.m_Downscale < governor.m_BaseDownscale + FACEREC_MAX_EXTRA_DOWNSCALE)
+            ++g_Facerec.m_Downscale;
+        else if (cascades > min_cascades)
+            g_Facerec.m_LandmarkCascades = cascades - 1;
+        else
+            changed = false;
+    }
+    else if (governor.m_FramesUnderBudget >= FACEREC_GOVERNOR_PATIENCE)
+    {
+        // Give back in the opposite order, predicting what each step costs. Detection
+        // on a frame twice the size takes about four times as long
+        if (cascades < all_cascades && total + landmarks / cascades <= limit)
+            g_Facerec.m_LandmarkCascades = cascades + 1 == all_cascades ? 0 : cascades + 1;
+        else if (g_Facerec.m_DetectInterval > governor.m_BaseDetectInterval && total + detect <= limit)
+            g_Facerec.m_DetectInterval = std::max(g_Facerec.m_DetectInterval / 2, governor.m_BaseDetectInterval);
+        else if (g_Facerec.m_Downscale > 0 && total + 3 * detect <= limit)
+            --g_Facerec.m_Downscale;
+        else
+            changed = false;
+    }
+    else
+    {
+        changed = false;
+    }
+
+    if (changed)
+    {
+        governor.m_NumSamples = 0;
+        governor.m_FramesUnderBudget = 0;
+    }
+}
+
+static int FacerecAnalyze(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 1);
+
+    int width = luaL_checkint(L, 1);
+    int height = luaL_checkint(L, 2);
+    dmScript::LuaHBuffer* buffer = dmScript::CheckBuffer(L, 3);
+
+    uint8_t* data = 0;
+    uint32_t datasize = 0;
+    dmBuffer::GetBytes(buffer->m_Buffer, (void**)&data, &datasize);
+
+    FacerecFormat format = FACEREC_FORMAT_RGB;
+    const char* format_name = luaL_optstring(L, 4, "rgb");
+    if (!FacerecParseFormat(format_name, format))
+    {
+        return DM_LUA_ERROR("Unknown frame format '%s'", format_name);
+    }
+    if (width <= 0 || height <= 0 || FacerecFrameSize(format, width, height) > INT_MAX)
+    {
+        return DM_LUA_ERROR("Unsupported frame size %dx%d", width, height);
+    }
+    if (datasize < FacerecFrameSize(format, width, height))
+    {
+        return DM_LUA_ERROR("The buffer is too small for a %dx%d %s frame", width, height, format_name);
+    }
+
+    // Swap in a model loaded in the background, then use the same model for the whole
+    // frame even if another one is installed meanwhile
+    FacerecUpdateModel(L);
+    std::shared_ptr<FacerecModel> model = std::atomic_load(&g_Facerec.m_Model);
+    if (!model)
+    {
+        return DM_LUA_ERROR("facerec.start() must be called before facerec.analyze()");
+    }
+
+    if (!g_Facerec.m_Pipeline.m_Threads.empty())
+    {
+        FacerecAnalyzePipelined(L, model, data, format, width, height);
+        return 1;
+    }
+
+    // Poor mans' downscale, which the governor changes to fit frame_budget. Earlier
+    // faces are in the coordinates of the last frame analyzed
+    const int downscale = g_Facerec.m_Downscale;
+    if (downscale != g_Facerec.m_LastDownscale)
+    {
+        FacerecForgetFaces();
+        g_Facerec.m_LastDownscale = downscale;
+    }
+
+    FacerecFrame frame;
+    frame.m_Model = model;
+    frame.m_Data = data;
+    frame.m_Format = format;
+    frame.m_Width = width;
+    frame.m_Height = height;
+    frame.m_Downscale = downscale;
+    frame.m_Submitted = FacerecClock::now();
+    FacerecIngestStage(frame);
+    FacerecDetectStage(frame);
+    FacerecLandmarkStage(frame);
+    FacerecAccount(frame);
+    if (frame.m_Moved)
+    {
+        typedef std::chrono::duration<double, std::milli> ms;
+        FacerecGovern(*model, ms(frame.m_Ingested - frame.m_Submitted).count(), ms(frame.m_Detected - frame.m_Ingested).count(),
+                      ms(frame.m_Finished - frame.m_Detected).count());
+    }
 
+    FacerecPushShapes(L, frame.m_Shapes, frame.m_ShapeDownscale, height);
+    return 1;
+}
+
+static inline uint8_t FacerecClamp(int value)
+{
+    return (uint8_t)std::min(std::max(value, 0), 255);
+}
+
+// Converts a YUV frame to the RGB layout that facerec.analyze() takes, for showing it.
+// Analysis itself only needs the luma plane, so convert frames only when needed
+static int FacerecToRgb(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 0);
+
+    int width = luaL_checkint(L, 1);
+    int height = luaL_checkint(L, 2);
+    dmScript::LuaHBuffer* source = dmScript::CheckBuffer(L, 3);
+    dmScript::LuaHBuffer* target = dmScript::CheckBuffer(L, 4);
+    const char* format_name = luaL_checkstring(L, 5);
+    FacerecFormat format = FACEREC_FORMAT_RGB;
+    if (!FacerecParseFormat(format_name, format) || format == FACEREC_FORMAT_RGB)
+    {
+        return DM_LUA_ERROR("Unknown YUV frame format '%s'", format_name);
+    }
+
+    uint8_t* yuv = 0;
+    uint32_t yuvsize = 0;
+    dmBuffer::GetBytes(source->m_Buffer, (void**)&yuv, &yuvsize);
+    uint8_t* rgb = 0;
+    uint32_t rgbsize = 0;
+    dmBuffer::GetBytes(target->m_Buffer, (void**)&rgb, &rgbsize);
+    // The RGB frame is the larger one
+    if (width <= 0 || height <= 0 || FacerecFrameSize(FACEREC_FORMAT_RGB, width, height) > INT_MAX)
+    {
+        return DM_LUA_ERROR("Unsupported frame size %dx%d", width, height);
+    }
+    if (yuvsize < FacerecFrameSize(format, width, height) || rgbsize < FacerecFrameSize(FACEREC_FORMAT_RGB, width, height))
+    {
+        return DM_LUA_ERROR("The buffers are too small for a %dx%d frame", width, height);
+    }
+
+    // Where the chroma samples of each format are
+    const int chroma_width = (width+1)/2;
+    const int chroma_height = (height+1)/2;
+    const uint8_t* chroma = yuv + width*height;
+    const bool planar = format == FACEREC_FORMAT_I420 || format == FACEREC_FORMAT_YV12;
+    const int step = planar ? 1 : 2;
+    const int stride = planar ? chroma_width : 2*chroma_width;
+    const uint8_t* first = chroma;
+    const uint8_t* second = planar ? chroma + chroma_width*chroma_height : chroma + 1;
+    const bool u_first = format == FACEREC_FORMAT_NV12 || format == FACEREC_FORMAT_I420;
+    const uint8_t* u = u_first ? first : second;
+    const uint8_t* v = u_first ? second : first;
+
+    // BT.601 with video range, in 8 bit fixed point
+    for (int y = 0; y < height; ++y)
+    {
+        uint8_t* out = rgb + (height-y-1)*width*3;
+        for (int x = 0; x < width; ++x)
+        {
+            const int chroma_index = (y/2)*stride + (x/2)*step;
+            const int c = 298 * (yuv[y*width + x] - 16) + 128;
+            const int d = u[chroma_index] - 128;
+            const int e = v[chroma_index] - 128;
+            out[x*3 + 0] = FacerecClamp((c + 409*e) >> 8);
+            out[x*3 + 1] = FacerecClamp((c - 100*d - 208*e) >> 8);
+            out[x*3 + 2] = FacerecClamp((c + 516*d) >> 8);
+        }
+    }
+    return 0;
+}
+
+static void FacerecPushStat(lua_State* L, const char* name, double value)
+{
+    lua_pushstring(L, name);
+    lua_pushnumber(L, value);
+    lua_rawset(L, -3);
+}
 
+static int FacerecGetStats(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 1);
+    const FacerecStats& stats = g_Facerec.m_Stats;
+    lua_newtable(L);
+    FacerecPushStat(L, "latency", stats.m_Latency);
+    FacerecPushStat(L, "throughput", stats.m_Interval > 0 ? 1000 / stats.m_Interval : 0);
+    FacerecPushStat(L, "ingest", stats.m_Ingest);
+    FacerecPushStat(L, "detect", stats.m_Detect);
+    FacerecPushStat(L, "landmarks", stats.m_Landmarks);
+    FacerecPushStat(L, "frames", stats.m_Frames);
+    FacerecPushStat(L, "dropped", stats.m_Dropped);
+    FacerecPushStat(L, "in_flight", g_Facerec.m_Pipeline.m_InFlight);
     return 1;
 }
 
@@ -266,7 +2086,10 @@ static const luaL_reg Module_methods[] =
 {
     {"start", FacerecStart},
     {"stop", FacerecStop},
+    {"swap", FacerecSwap},
     {"analyze", FacerecAnalyze},
+    {"stats", FacerecGetStats},
+    {"to_rgb", FacerecToRgb},
     {0, 0}
 };
 
@@ -298,6 +2121,11 @@ dmExtension::Result AppFinalizeExtension(dmExtension::AppParams* params)
 
 dmExtension::Result FinalizeExtension(dmExtension::Params* params)
 {
+    // The pipeline, loader and worker threads must be joined before they are
+    // destroyed, and the pipeline first, since its stages use the workers
+    FacerecStopPipeline();
+    FacerecStopLoader(params->m_L);
+    g_Facerec.m_Workers.Stop();
     return dmExtension::RESULT_OK;
 }
 
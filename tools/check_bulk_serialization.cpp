@@ -0,0 +1,356 @@
+// Checks the bulk serialization format from set_bulk_serialization() against the element
+// by element format it stands in for, and prints what it finds:
+//
+//   - std::vector, row major dlib::matrix and dlib::array2d objects of every kind of
+//     value are written in both formats and read back, and must come back unchanged.
+//     Empty objects and objects of a type with no bulk format are included.
+//   - bulk blocks are read into values of a different size of the same kind, a block is
+//     rewritten in the other byte order, and values that don't fit in the type being
+//     read must throw serialization_error.
+//   - a synthetic shape_predictor and the frontal face detector are written in both
+//     formats, read back, and must predict the same landmarks and find the same faces.
+//     The frontal face detector is compared with a deserialized copy, not the one built
+//     from its static tables, whose separable filters can differ by a rounding error.
+//
+// Build it against the same headers as the extension and dlib's all/source.cpp, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -Ifacerec/include tools/check_bulk_serialization.cpp
+//       path/to/dlib/all/source.cpp -llapack -lblas -lpthread -o check_bulk_serialization
+//   ./check_bulk_serialization
+//
+// It returns 1 if any of the checks fails.
+
+#include <extdlib/image_processing/shape_predictor.h>
+#include <extdlib/image_processing/frontal_face_detector.h>
+#include <extdlib/serialize.h>
+#include <extdlib/matrix.h>
+#include <extdlib/array2d.h>
+#include <extdlib/rand.h>
+#include "synthetic_faces.h"
+#include "random_shape_predictor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace dlib;
+
+static long num_failed = 0;
+
+static void report (
+    const char* name,
+    bool ok
+)
+{
+    std::printf("%-44s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++num_failed;
+}
+
+template <typename T>
+static std::string write (
+    const T& item,
+    bool bulk
+)
+{
+    std::ostringstream sout;
+    set_bulk_serialization(sout, bulk);
+    serialize(item, sout);
+    return sout.str();
+}
+
+template <typename T>
+static bool read (
+    const std::string& data,
+    T& item
+)
+{
+    std::istringstream sin(data);
+    try
+    {
+        deserialize(item, sin);
+    }
+    catch (serialization_error&)
+    {
+        return false;
+    }
+    return sin.rdbuf()->sgetc() == std::char_traits<char>::eof();
+}
+
+// ----------------------------------------------------------------------------------------
+
+template <typename T>
+static T random_value (
+    dlib::rand& rnd
+)
+{
+    if (std::numeric_limits<T>::is_integer)
+        return static_cast<T>(rnd.get_random_64bit_number());
+    return static_cast<T>(rnd.get_random_gaussian()*1e3);
+}
+
+template <typename T>
+static void fill (dlib::rand& rnd, std::vector<T>& item, long n)
+{
+    item.resize(n);
+    for (long i = 0; i < n; ++i)
+        item[i] = random_value<T>(rnd);
+}
+
+template <typename T>
+static void fill (dlib::rand& rnd, matrix<T>& item, long n)
+{
+    item.set_size(n, n ? n/3+1 : 0);
+    for (long r = 0; r < item.nr(); ++r)
+        for (long c = 0; c < item.nc(); ++c)
+            item(r,c) = random_value<T>(rnd);
+}
+
+template <typename T>
+static void fill (dlib::rand& rnd, array2d<T>& item, long n)
+{
+    item.set_size(n ? n/2+1 : 0, n);
+    for (long r = 0; r < item.nr(); ++r)
+        for (long c = 0; c < item.nc(); ++c)
+            item[r][c] = random_value<T>(rnd);
+}
+
+template <typename T>
+static bool same (const std::vector<T>& a, const std::vector<T>& b) { return a == b; }
+
+template <typename T>
+static bool same (const matrix<T>& a, const matrix<T>& b)
+{
+    return a.nr() == b.nr() && a.nc() == b.nc() && (a.size() == 0 || a == b);
+}
+
+template <typename T>
+static bool same (const array2d<T>& a, const array2d<T>& b)
+{
+    if (a.nr() != b.nr() || a.nc() != b.nc())
+        return false;
+    for (long r = 0; r < a.nr(); ++r)
+        for (long c = 0; c < a.nc(); ++c)
+            if (a[r][c] != b[r][c])
+                return false;
+    return true;
+}
+
+// Writes item in both formats and reads each back.  Only types with a bulk format must
+// start with the bulk marker when it is enabled.
+template <typename container>
+static bool round_trips (
+    const container& item,
+    bool has_bulk_format
+)
+{
+    for (int bulk = 0; bulk < 2; ++bulk)
+    {
+        const std::string data = write(item, bulk != 0);
+        const bool marked = !data.empty() && (unsigned char)data[0] == 0x7E;
+        const bool expect_marker = bulk && has_bulk_format && item.size() != 0;
+        container result;
+        if (marked != expect_marker || !read(data, result) || !same(item, result))
+            return false;
+    }
+    return true;
+}
+
+template <typename container>
+static void check_round_trips (
+    dlib::rand& rnd,
+    const char* type_name,
+    bool has_bulk_format = true
+)
+{
+    bool ok = true;
+    const long sizes[] = { 0, 1, 7, 64, 1000 };
+    for (long n : sizes)
+    {
+        container item;
+        fill(rnd, item, n);
+        ok = ok && round_trips(item, has_bulk_format);
+    }
+    report((std::string("round trip ") + type_name).c_str(), ok);
+}
+
+// ----------------------------------------------------------------------------------------
+
+template <typename S, typename T>
+static bool converts (
+    const std::vector<S>& values
+)
+{
+    std::vector<T> result;
+    if (!read(write(values, true), result) || result.size() != values.size())
+        return false;
+    for (unsigned long i = 0; i < values.size(); ++i)
+        if (result[i] != static_cast<T>(values[i]))
+            return false;
+    return true;
+}
+
+template <typename S, typename T>
+static bool throws_on_overflow (
+    const std::vector<S>& values
+)
+{
+    std::vector<T> result;
+    return !read(write(values, true), result);
+}
+
+// Rewrites a bulk block of a std::vector as a host of the other byte order would have
+// written it: the endian tag is flipped and so is every value, which are at the end.
+template <typename T>
+static std::string swap_byte_order (
+    std::string data,
+    unsigned long num
+)
+{
+    data[2] = data[2] ? 0 : 1;
+    const unsigned long start = data.size() - num*sizeof(T);
+    for (unsigned long i = 0; i < num; ++i)
+        std::reverse(&data[start + i*sizeof(T)], &data[start + (i+1)*sizeof(T)]);
+    return data;
+}
+
+template <typename T>
+static bool reads_other_byte_order (
+    dlib::rand& rnd
+)
+{
+    std::vector<T> values, result;
+    fill(rnd, values, 100);
+    return read(swap_byte_order<T>(write(values, true), values.size()), result) && result == values;
+}
+
+static void check_conversions (
+    dlib::rand& rnd
+)
+{
+    std::vector<int16> small_ints;
+    std::vector<uint16> shorts;
+    std::vector<double> doubles;
+    std::vector<float> floats;
+    fill(rnd, small_ints, 500);
+    fill(rnd, shorts, 500);
+    fill(rnd, doubles, 500);
+    fill(rnd, floats, 500);
+    report("int16 block read as int64", converts<int16,int64>(small_ints));
+    report("uint16 block read as uint32", converts<uint16,uint32>(shorts));
+    report("double block read as float", converts<double,float>(doubles));
+    report("float block read as double", converts<float,double>(floats));
+
+    report("int64 too large for int32 throws", throws_on_overflow<int64,int32>(std::vector<int64>(3, 1LL<<40)));
+    report("negative int32 read as int64", converts<int32,int64>(std::vector<int32>(3, -5)));
+    report("int16 too large for signed char throws", throws_on_overflow<int16,signed char>(std::vector<int16>(3, 300)));
+    report("uint32 above int32 range throws", throws_on_overflow<uint32,int32>(std::vector<uint32>(3, 0x80000000u)));
+    report("float block read as int32 throws", throws_on_overflow<float,int32>(floats));
+
+    report("other byte order int16", reads_other_byte_order<int16>(rnd));
+    report("other byte order uint32", reads_other_byte_order<uint32>(rnd));
+    report("other byte order float", reads_other_byte_order<float>(rnd));
+    report("other byte order double", reads_other_byte_order<double>(rnd));
+    report("other byte order int64", reads_other_byte_order<int64>(rnd));
+}
+
+// ----------------------------------------------------------------------------------------
+
+static void check_shape_predictor (
+    dlib::rand& rnd,
+    const array2d<rgb_pixel>& img
+)
+{
+    const shape_predictor sp = make_random_shape_predictor(rnd);
+    shape_predictor regular, bulk;
+    const std::string bulk_data = write(sp, true);
+    bool ok = read(write(sp, false), regular) && read(bulk_data, bulk);
+    std::printf("\nshape_predictor is %lu bytes in the bulk format, %lu in the regular one\n",
+                (unsigned long)bulk_data.size(), (unsigned long)write(sp, false).size());
+
+    for (int i = 0; ok && i < 20; ++i)
+    {
+        const rectangle face = centered_rect(point(img.nc()/2 + (long)rnd.get_double_in_range(-100,100),
+                                                   img.nr()/2 + (long)rnd.get_double_in_range(-100,100)),
+                                             (unsigned long)rnd.get_double_in_range(60,200),
+                                             (unsigned long)rnd.get_double_in_range(60,200));
+        const full_object_detection expected = sp(img, face);
+        const full_object_detection a = regular(img, face), b = bulk(img, face);
+        for (unsigned long k = 0; k < expected.num_parts(); ++k)
+            ok = ok && a.part(k) == expected.part(k) && b.part(k) == expected.part(k);
+    }
+    report("shape_predictor landmarks in both formats", ok);
+}
+
+static void check_face_detector (
+    const dlib::array<array2d<rgb_pixel> >& images
+)
+{
+    // The detector get_frontal_face_detector() builds from its static tables can score a
+    // window a rounding error away from one that was deserialized, since the separable
+    // filters of the latter are computed at load time.  So the bulk detector is compared
+    // with the regular one, which must match exactly, and the built in one is only
+    // reported.
+    frontal_face_detector detector = get_frontal_face_detector();
+    frontal_face_detector regular, bulk;
+    bool ok = read(write(detector, false), regular) && read(write(detector, true), bulk);
+
+    unsigned long num_faces = 0;
+    double max_builtin_diff = 0;
+    for (unsigned long i = 0; ok && i < images.size(); ++i)
+    {
+        std::vector<rect_detection> builtin, expected, dets;
+        detector(images[i], builtin);
+        regular(images[i], expected);
+        bulk(images[i], dets);
+        ok = dets.size() == expected.size();
+        for (unsigned long k = 0; ok && k < expected.size(); ++k)
+        {
+            ok = dets[k].rect == expected[k].rect &&
+                 dets[k].detection_confidence == expected[k].detection_confidence;
+        }
+        for (unsigned long k = 0; k < builtin.size() && k < expected.size(); ++k)
+            max_builtin_diff = std::max(max_builtin_diff, std::abs(builtin[k].detection_confidence - expected[k].detection_confidence));
+        num_faces += expected.size();
+    }
+    std::printf("the face detector found %lu faces in %lu images, scores at most %g from the built in one\n",
+                num_faces, (unsigned long)images.size(), max_builtin_diff);
+    report("face detector detections in both formats", ok && num_faces != 0);
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main()
+{
+    dlib::rand rnd;
+
+    check_round_trips<std::vector<float> >(rnd, "vector<float>");
+    check_round_trips<std::vector<double> >(rnd, "vector<double>");
+    check_round_trips<std::vector<int16> >(rnd, "vector<int16>");
+    check_round_trips<std::vector<uint16> >(rnd, "vector<uint16>");
+    check_round_trips<std::vector<int32> >(rnd, "vector<int32>");
+    check_round_trips<std::vector<uint32> >(rnd, "vector<uint32>");
+    check_round_trips<std::vector<int64> >(rnd, "vector<int64>");
+    check_round_trips<std::vector<uint64> >(rnd, "vector<uint64>");
+    check_round_trips<std::vector<char> >(rnd, "vector<char>", false);
+    check_round_trips<matrix<float> >(rnd, "matrix<float>");
+    check_round_trips<matrix<double> >(rnd, "matrix<double>");
+    check_round_trips<matrix<int32> >(rnd, "matrix<int32>");
+    check_round_trips<array2d<float> >(rnd, "array2d<float>");
+    check_round_trips<array2d<int16> >(rnd, "array2d<int16>");
+    // unsigned char images are already written as raw bytes, see serialize_pixel_overloads.h
+    check_round_trips<array2d<unsigned char> >(rnd, "array2d<unsigned char>", false);
+    std::printf("\n");
+    check_conversions(rnd);
+
+    dlib::array<array2d<rgb_pixel> > images;
+    make_synthetic_images(images, 4, 4);
+    check_shape_predictor(rnd, images[0]);
+    check_face_detector(images);
+
+    std::printf("\n%s\n", num_failed == 0 ? "OK" : "FAILED");
+    return num_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,292 @@
+// Checks the fast paths for 8bit images against the code they replace, on a fixed set of
+// synthetic images, and prints the largest differences found:
+//
+//   - resize_image() with bilinear interpolation, which resizes unsigned char and
+//     rgb_pixel images in 8.8 fixed point (impl::resize_image_bilinear_bytes_impl), is
+//     compared with the float path that unsigned short and bgr_pixel images still take,
+//     and with the exact bilinear value computed in double precision.
+//   - extract_fhog_features(), which looks the orientation bins of 8bit images up in a
+//     table, is compared with the same image stored as floats, which computes them with
+//     the 9 dot products per pixel.  Every entry of the table is also checked against
+//     the dot products.
+//
+// Build it against the same headers as the extension, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -Ifacerec/include tools/check_byte_paths.cpp -lpthread -o check_byte_paths
+//   ./check_byte_paths
+//
+// It returns 1 if a resized pixel differs from the float path by more than two grey levels
+// or from the exact value by one and a half, if the FHOG features differ by more than a
+// rounding error, or if any table entry is wrong.
+
+#include <extdlib/image_transforms/interpolation.h>
+#include <extdlib/image_transforms/fhog.h>
+#include <extdlib/array2d.h>
+#include <extdlib/rand.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace dlib;
+
+struct resize_case
+{
+    long in_nr, in_nc;
+    long out_nr, out_nc;
+};
+
+// ----------------------------------------------------------------------------------------
+
+template <typename pixel_type>
+static void make_test_image (
+    dlib::rand& rnd,
+    long nr,
+    long nc,
+    array2d<pixel_type>& img
+)
+{
+    // Smooth ramps with blobs and a bit of noise on top, so there are both flat areas and
+    // strong edges in every orientation.
+    img.set_size(nr, nc);
+    for (long r = 0; r < nr; ++r)
+    {
+        for (long c = 0; c < nc; ++c)
+        {
+            unsigned char v[3];
+            for (int k = 0; k < 3; ++k)
+            {
+                double x = 128 + 100*std::sin(0.05*(k+1)*c + 0.03*r) + 20*std::cos(0.2*r*(k+1) - 0.1*c);
+                x += rnd.get_random_gaussian()*8;
+                if (((r/16) + (c/16)) % 3 == k)
+                    x = 255 - x;
+                v[k] = (unsigned char)std::max(0.0, std::min(255.0, x));
+            }
+            assign_pixel(img[r][c], rgb_pixel(v[0], v[1], v[2]));
+        }
+    }
+}
+
+// Returns the exact bilinear value of the output pixel (r,c), channel k, the way
+// resize_image() defines it.
+static double exact_bilinear (
+    const array2d<rgb_pixel>& img,
+    long out_nr,
+    long out_nc,
+    long r,
+    long c,
+    int k
+)
+{
+    const double x_scale = (img.nc()-1)/(double)std::max<long>(out_nc-1,1);
+    const double y_scale = (img.nr()-1)/(double)std::max<long>(out_nr-1,1);
+    const double x = c*x_scale, y = r*y_scale;
+    const long left = std::min((long)std::floor(x), img.nc()-1), top = std::min((long)std::floor(y), img.nr()-1);
+    const long right = std::min(left+1, img.nc()-1), bottom = std::min(top+1, img.nr()-1);
+    const double fx = x - left, fy = y - top;
+    const unsigned char* p[4] = { &img[top][left].red, &img[top][right].red, &img[bottom][left].red, &img[bottom][right].red };
+    return (1-fy)*((1-fx)*p[0][k] + fx*p[1][k]) + fy*((1-fx)*p[2][k] + fx*p[3][k]);
+}
+
+// ----------------------------------------------------------------------------------------
+
+struct diff_stats
+{
+    diff_stats() : max_vs_float(0), num_vs_float(0), max_vs_exact(0), num(0) {}
+    long max_vs_float;
+    long num_vs_float;
+    double max_vs_exact;
+    long num;
+
+    void add (long fixed, long old_float, double exact)
+    {
+        const long d = std::abs(fixed - old_float);
+        max_vs_float = std::max(max_vs_float, d);
+        num_vs_float += d != 0;
+        max_vs_exact = std::max(max_vs_exact, std::abs(fixed - exact));
+        ++num;
+    }
+};
+
+static bool check_resize (
+    dlib::rand& rnd
+)
+{
+    const resize_case cases[] = {
+        {480, 640, 400, 533},       // pyramid_down<6> steps
+        {400, 533, 333, 444},
+        {720, 1280, 600, 1066},
+        {77, 101, 64, 84},
+        {1000, 37, 833, 30},
+        {480, 640, 240, 320},       // halving
+        {240, 320, 480, 640},       // upscaling
+        {13, 17, 4, 5},
+        {3, 300, 2, 299},
+        {1080, 1920, 270, 480}
+    };
+
+    std::printf("bilinear resize, fixed point against float path and exact value\n");
+    std::printf("%12s %12s %8s %10s %10s %10s\n", "input", "output", "type", "max diff", "differ", "max exact");
+    bool ok = true;
+    for (unsigned long i = 0; i < sizeof(cases)/sizeof(cases[0]); ++i)
+    {
+        const resize_case& t = cases[i];
+        array2d<rgb_pixel> rgb;
+        make_test_image(rnd, t.in_nr, t.in_nc, rgb);
+
+        array2d<unsigned char> gray;
+        array2d<unsigned short> gray16;
+        array2d<bgr_pixel> bgr;
+        assign_image(gray, rgb);
+        assign_image(gray16, gray);
+        assign_image(bgr, rgb);
+
+        array2d<unsigned char> gray_out(t.out_nr, t.out_nc);
+        array2d<unsigned short> gray16_out(t.out_nr, t.out_nc);
+        array2d<rgb_pixel> rgb_out(t.out_nr, t.out_nc);
+        array2d<bgr_pixel> bgr_out(t.out_nr, t.out_nc);
+        resize_image(gray, gray_out, interpolate_bilinear());
+        resize_image(gray16, gray16_out, interpolate_bilinear());
+        resize_image(rgb, rgb_out, interpolate_bilinear());
+        resize_image(bgr, bgr_out, interpolate_bilinear());
+
+        array2d<rgb_pixel> gray_rgb;
+        assign_image(gray_rgb, gray);
+
+        diff_stats gs, cs;
+        for (long r = 0; r < t.out_nr; ++r)
+        {
+            for (long c = 0; c < t.out_nc; ++c)
+            {
+                gs.add(gray_out[r][c], gray16_out[r][c], exact_bilinear(gray_rgb, t.out_nr, t.out_nc, r, c, 0));
+                cs.add(rgb_out[r][c].red, bgr_out[r][c].red, exact_bilinear(rgb, t.out_nr, t.out_nc, r, c, 0));
+                cs.add(rgb_out[r][c].green, bgr_out[r][c].green, exact_bilinear(rgb, t.out_nr, t.out_nc, r, c, 1));
+                cs.add(rgb_out[r][c].blue, bgr_out[r][c].blue, exact_bilinear(rgb, t.out_nr, t.out_nc, r, c, 2));
+            }
+        }
+
+        const diff_stats* stats[2] = { &gs, &cs };
+        const char* names[2] = { "gray", "rgb" };
+        for (int k = 0; k < 2; ++k)
+        {
+            char in[32], out[32];
+            std::sprintf(in, "%ldx%ld", t.in_nc, t.in_nr);
+            std::sprintf(out, "%ldx%ld", t.out_nc, t.out_nr);
+            std::printf("%12s %12s %8s %10ld %9.3f%% %10.3f\n", in, out, names[k], stats[k]->max_vs_float,
+                100.0*stats[k]->num_vs_float/std::max<long>(stats[k]->num,1), stats[k]->max_vs_exact);
+            // Rounding costs up to half a level, and rounding the weights to 1/256 up to
+            // half a level per axis across the strongest edges.  The float path truncates,
+            // which puts it up to a level below the exact value.
+            if (stats[k]->max_vs_float > 2 || stats[k]->max_vs_exact > 1.5)
+                ok = false;
+        }
+    }
+    return ok;
+}
+
+// ----------------------------------------------------------------------------------------
+
+static double max_fhog_difference (
+    const array2d<unsigned char>& bytes
+)
+{
+    array2d<matrix<float,31,1> > table_hog, direct_hog;
+    extract_fhog_features(bytes, table_hog);
+
+    // The same pixel values as floats take the direct computation.
+    array2d<float> floats;
+    assign_image(floats, bytes);
+    extract_fhog_features(floats, direct_hog);
+
+    double max_diff = 0;
+    for (long r = 0; r < table_hog.nr(); ++r)
+        for (long c = 0; c < table_hog.nc(); ++c)
+            max_diff = std::max<double>(max_diff, max(abs(table_hog[r][c] - direct_hog[r][c])));
+    return max_diff;
+}
+
+// RGB images always have byte gradients, so there is no direct path to compare them with
+// end to end.  They pick the strongest channel before binning, exactly like the direct
+// code, so instead every entry of the orientation table is checked against the 9 dot
+// products, done as in the vectorized loop of extract_fhog_features().
+static long count_table_mismatches (
+)
+{
+    matrix<float,2,1> directions[9];
+    directions[0] =  1.0000, 0.0000; 
+    directions[1] =  0.9397, 0.3420;
+    directions[2] =  0.7660, 0.6428;
+    directions[3] =  0.500,  0.8660;
+    directions[4] =  0.1736, 0.9848;
+    directions[5] = -0.1736, 0.9848;
+    directions[6] = -0.5000, 0.8660;
+    directions[7] = -0.7660, 0.6428;
+    directions[8] = -0.9397, 0.3420;
+    const impl_fhog::orientation_table& table = impl_fhog::get_orientation_table(directions);
+
+    long mismatches = 0;
+    for (int gy = -255; gy <= 255; ++gy)
+    {
+        for (int gx = -255; gx <= 255; gx += 8)
+        {
+            const simd8f grad_x(gx, gx+1, gx+2, gx+3, gx+4, gx+5, gx+6, gx+7);
+            const simd8f grad_y(gy);
+            simd8f best_dot = 0;
+            simd8f best_o = 0;
+            for (int o = 0; o < 9; o++)
+            {
+                simd8f dot = grad_x*directions[o](0) + grad_y*directions[o](1);
+                simd8f_bool cmp = dot>best_dot;
+                best_dot = select(cmp, dot, best_dot);
+                dot *= -1;
+                best_o = select(cmp, o, best_o);
+
+                cmp = dot > best_dot;
+                best_dot = select(cmp, dot, best_dot);
+                best_o = select(cmp, o + 9, best_o);
+            }
+            int32 direct[8];
+            simd8i(best_o).store(direct);
+            for (int i = 0; i < 8 && gx+i <= 255; ++i)
+                mismatches += table(gx+i, gy) != direct[i];
+        }
+    }
+    return mismatches;
+}
+
+static bool check_fhog (
+    dlib::rand& rnd
+)
+{
+    const long sizes[][2] = { {480, 640}, {77, 101}, {64, 64}, {333, 17}, {720, 1280} };
+
+    std::printf("\nFHOG orientation table against the direct computation\n");
+    std::printf("%12s %14s\n", "image", "max diff");
+    bool ok = true;
+    for (unsigned long i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i)
+    {
+        array2d<unsigned char> gray;
+        make_test_image(rnd, sizes[i][0], sizes[i][1], gray);
+
+        const double d = max_fhog_difference(gray);
+        char name[32];
+        std::sprintf(name, "%ldx%ld", sizes[i][1], sizes[i][0]);
+        std::printf("%12s %14g\n", name, d);
+        if (d > 1e-5)
+            ok = false;
+    }
+
+    const long mismatches = count_table_mismatches();
+    std::printf("%ld of %d table entries differ from the dot products\n", mismatches, 511*511);
+    return ok && mismatches == 0;
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main()
+{
+    dlib::rand rnd;
+    const bool resize_ok = check_resize(rnd);
+    const bool fhog_ok = check_fhog(rnd);
+    std::printf("\n%s\n", resize_ok && fhog_ok ? "OK" : "FAILED");
+    return resize_ok && fhog_ok ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+// Checks a shape_predictor evaluated in place from the flat format of serialize_flat()
+// against the same predictor parsed from the regular format, and prints what it finds:
+//
+//   - deserialize_flat() over a buffer and map_flat_shape_predictor() over a file must
+//     give the same number of parts, features and cascades, the same landmarks, the same
+//     leaf features and the same landmarks when stopping after fewer cascades, on RGB and
+//     grayscale images.
+//   - serializing the flat predictor in the regular format must write the same bytes as
+//     the predictor it was made from, and a copy must keep working after the original
+//     and the buffer handle are gone.
+//   - truncated data, data that isn't 8 byte aligned and data with random bytes changed
+//     must either throw serialization_error or give a predictor that can be evaluated,
+//     which is most useful in a build with -fsanitize=address.
+//
+// Build it against the same headers as the extension and dlib's all/source.cpp, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -Ifacerec/include tools/check_flat_shape_predictor.cpp
+//       path/to/dlib/all/source.cpp -llapack -lblas -lpthread -o check_flat_shape_predictor
+//   ./check_flat_shape_predictor
+//
+// It writes a temporary file in the current directory and returns 1 if any of the checks
+// fails.
+
+#include <extdlib/image_processing/shape_predictor.h>
+#include <extdlib/mapped_file.h>
+#include <extdlib/image_transforms/assign_image.h>
+#include <extdlib/rand.h>
+#include "random_shape_predictor.h"
+#include "synthetic_faces.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace dlib;
+
+static long num_failed = 0;
+
+static void report (
+    const char* name,
+    bool ok
+)
+{
+    std::printf("%-52s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++num_failed;
+}
+
+// An 8 byte aligned copy of some flat model data, which keeps itself alive through the
+// owner handle deserialize_flat() takes.
+struct flat_buffer
+{
+    explicit flat_buffer (const std::string& bytes) : size(bytes.size())
+    {
+        std::shared_ptr<std::vector<uint64> > words(new std::vector<uint64>(bytes.size()/8 + 1));
+        std::memcpy(&(*words)[0], bytes.data(), bytes.size());
+        data = reinterpret_cast<const char*>(&(*words)[0]);
+        owner = words;
+    }
+
+    const char* data;
+    size_t size;
+    std::shared_ptr<const void> owner;
+};
+
+static std::string regular_bytes (
+    const shape_predictor& sp
+)
+{
+    std::ostringstream sout;
+    serialize(sp, sout);
+    return sout.str();
+}
+
+// ----------------------------------------------------------------------------------------
+
+template <typename image_type>
+static bool same_predictions (
+    dlib::rand& rnd,
+    const shape_predictor& expected,
+    const shape_predictor& sp,
+    const image_type& img
+)
+{
+    if (sp.num_parts() != expected.num_parts() || sp.num_features() != expected.num_features() ||
+        sp.num_cascades() != expected.num_cascades())
+        return false;
+
+    for (int i = 0; i < 50; ++i)
+    {
+        const rectangle face = centered_rect(point(rnd.get_random_32bit_number()%num_columns(img),
+                                                   rnd.get_random_32bit_number()%num_rows(img)),
+                                             40 + rnd.get_random_32bit_number()%300,
+                                             40 + rnd.get_random_32bit_number()%300);
+        std::vector<std::pair<unsigned long,float> > expected_feats, feats;
+        const full_object_detection a = expected(img, face, expected_feats);
+        const full_object_detection b = sp(img, face, feats);
+        if (feats != expected_feats)
+            return false;
+        for (unsigned long k = 0; k < a.num_parts(); ++k)
+            if (a.part(k) != b.part(k))
+                return false;
+
+        const unsigned long max_cascades = rnd.get_random_32bit_number()%(expected.num_cascades()+2);
+        const full_object_detection c = expected(img, face, max_cascades);
+        const full_object_detection d = sp(img, face, max_cascades);
+        for (unsigned long k = 0; k < c.num_parts(); ++k)
+            if (c.part(k) != d.part(k))
+                return false;
+    }
+    return true;
+}
+
+static void check_equivalence (
+    dlib::rand& rnd,
+    const shape_predictor& sp,
+    const std::string& flat,
+    const array2d<rgb_pixel>& img,
+    const array2d<unsigned char>& gray
+)
+{
+    shape_predictor from_buffer;
+    {
+        flat_buffer buf(flat);
+        deserialize_flat(from_buffer, buf.data, buf.size, buf.owner);
+    }
+    report("deserialize_flat() landmarks on RGB", same_predictions(rnd, sp, from_buffer, img));
+    report("deserialize_flat() landmarks on grayscale", same_predictions(rnd, sp, from_buffer, gray));
+    report("deserialize_flat() writes the same regular format", regular_bytes(from_buffer) == regular_bytes(sp));
+
+    shape_predictor copy;
+    {
+        shape_predictor temp;
+        flat_buffer buf(flat);
+        deserialize_flat(temp, buf.data, buf.size, buf.owner);
+        copy = temp;
+    }
+    report("copy outlives the original and the buffer handle", same_predictions(rnd, sp, copy, img));
+
+    const char* filename = "check_flat_shape_predictor.tmp";
+    {
+        std::ofstream fout(filename, std::ios::binary);
+        fout.write(flat.data(), flat.size());
+    }
+    const unsigned long flags[] = { 0, mapped_file::populate, mapped_file::populate | mapped_file::huge_pages };
+    for (unsigned long f : flags)
+    {
+        shape_predictor mapped;
+        map_flat_shape_predictor(mapped, filename, f);
+        char name[64];
+        std::sprintf(name, "map_flat_shape_predictor() landmarks, flags %lu", f);
+        report(name, same_predictions(rnd, sp, mapped, img));
+    }
+    std::remove(filename);
+}
+
+// ----------------------------------------------------------------------------------------
+
+// Returns false if the data throws serialization_error.  Otherwise the predictor it gives
+// is evaluated, which must neither crash nor read outside of the data.
+static bool loads_and_evaluates (
+    const char* data,
+    size_t size,
+    const array2d<rgb_pixel>& img
+)
+{
+    shape_predictor sp;
+    try
+    {
+        deserialize_flat(sp, data, size);
+    }
+    catch (serialization_error&)
+    {
+        return false;
+    }
+    sp(img, rectangle(100, 100, 299, 299));
+    return true;
+}
+
+static void check_corruption (
+    dlib::rand& rnd,
+    const std::string& flat,
+    const array2d<rgb_pixel>& img
+)
+{
+    flat_buffer buf(flat);
+    shape_predictor sp;
+
+    bool truncated_throws = true;
+    const size_t lengths[] = { 0, 7, 64, flat.size()/2, flat.size()-1 };
+    for (size_t n : lengths)
+    {
+        try
+        {
+            deserialize_flat(sp, buf.data, n);
+            truncated_throws = false;
+        }
+        catch (serialization_error&)
+        {
+        }
+    }
+    report("truncated data throws", truncated_throws);
+
+    bool misaligned_throws = false;
+    std::vector<uint64> shifted((flat.size()+15)/8);
+    std::memcpy(reinterpret_cast<char*>(&shifted[0]) + 4, flat.data(), flat.size());
+    try
+    {
+        deserialize_flat(sp, reinterpret_cast<const char*>(&shifted[0]) + 4, flat.size());
+    }
+    catch (serialization_error&)
+    {
+        misaligned_throws = true;
+    }
+    report("misaligned data throws", misaligned_throws);
+
+    // Most of the file is leaf values, which aren't checked, so changes are made mostly to
+    // the header, offsets, splits and pixel indices in the first few kilobytes.
+    long num_rejected = 0;
+    const int num_trials = 2000;
+    for (int i = 0; i < num_trials; ++i)
+    {
+        std::string corrupt = flat;
+        const int num_changes = 1 + rnd.get_random_32bit_number()%4;
+        for (int k = 0; k < num_changes; ++k)
+        {
+            const size_t limit = rnd.get_random_32bit_number()%4 == 0 ? corrupt.size() : std::min<size_t>(corrupt.size(), 4096);
+            corrupt[rnd.get_random_32bit_number()%limit] = (char)rnd.get_random_8bit_number();
+        }
+        flat_buffer corrupt_buf(corrupt);
+        if (!loads_and_evaluates(corrupt_buf.data, corrupt_buf.size, img))
+            ++num_rejected;
+    }
+    std::printf("%ld of %d randomly changed models were rejected, the rest were evaluated\n", num_rejected, num_trials);
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main()
+{
+    dlib::rand rnd;
+    dlib::array<array2d<rgb_pixel> > images;
+    make_synthetic_images(images, 1, 4);
+    array2d<unsigned char> gray;
+    assign_image(gray, images[0]);
+
+    const unsigned long shapes[][3] = { {68, 5, 50}, {5, 10, 20}, {1, 1, 1} };
+    for (const unsigned long* shape : shapes)
+    {
+        const shape_predictor sp = make_random_shape_predictor(rnd, shape[0], shape[1], shape[2]);
+        std::ostringstream sout;
+        serialize_flat(sp, sout);
+        const std::string flat = sout.str();
+        const std::string regular = regular_bytes(sp);
+        std::printf("\n%lu parts, %lu cascades of %lu trees: %lu bytes flat, %lu regular\n",
+                    shape[0], shape[1], shape[2], (unsigned long)flat.size(), (unsigned long)regular.size());
+        report("is_flat_shape_predictor()", is_flat_shape_predictor(flat.data(), flat.size()) &&
+               !is_flat_shape_predictor(regular.data(), regular.size()));
+        check_equivalence(rnd, sp, flat, images[0], gray);
+        check_corruption(rnd, flat, images[0]);
+    }
+
+    std::printf("\n%s\n", num_failed == 0 ? "OK" : "FAILED");
+    return num_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,245 @@
+// Checks scan_fhog_pyramid::score_window(), which scores single windows for verifying
+// tracked faces, against a full scan of the same image with the frontal face detector's
+// filters, and prints what it finds:
+//
+//   - the 50 best scoring windows of a full scan of each image and 50 others are scored
+//     on their own with score_window(), and must get the same rectangle and exactly the
+//     same score, for grayscale and RGB images.
+//   - score_window() of a rectangle that isn't a detection window must equal that of
+//     get_best_matching_rect() of it.
+//   - with a search radius, the score must be the best full scan score of the same level
+//     within that many cells, and the rectangle returned must be a window with that score.
+//     This is only checked for windows whose neighbors lie inside the image, since the
+//     windows of a level are told apart by their size.
+//   - with set_quantized_detection(true) the scores must be the float ones.
+//
+// It also prints the average time of scoring one window and of a full scan.  Build it
+// against the same headers as the extension and dlib's all/source.cpp, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -Ifacerec/include tools/check_score_window.cpp
+//       path/to/dlib/all/source.cpp -llapack -lblas -lpthread -o check_score_window
+//   ./check_score_window
+//
+// It returns 1 if any of the checks fails.
+
+#include <extdlib/image_processing/frontal_face_detector.h>
+#include <extdlib/image_transforms/assign_image.h>
+#include <extdlib/rand.h>
+#include "synthetic_faces.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+using namespace dlib;
+
+typedef scan_fhog_pyramid<pyramid_down<6> > scanner_type;
+typedef scanner_type::fhog_filterbank fhog_filterbank;
+typedef std::vector<std::pair<double, rectangle> > window_scores;
+
+static long num_failed = 0;
+
+static void report (
+    const char* name,
+    bool ok
+)
+{
+    std::printf("%-52s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++num_failed;
+}
+
+static double elapsed_ms (
+    const std::chrono::steady_clock::time_point& start
+)
+{
+    return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Windows of the same pyramid level have the same size, give or take the rounding of
+// mapping them back to the image.  That isn't so for windows that stick out of the image,
+// which can come back stretched in one direction, so this is only used inside the image.
+static bool same_level (
+    const rectangle& a,
+    const rectangle& b
+)
+{
+    return std::abs((long)a.width() - (long)b.width()) <= 2 && std::abs((long)a.height() - (long)b.height()) <= 2;
+}
+
+// Returns the distance between the centers of neighboring windows of the level of rect,
+// measured on the windows of the full scan, or 0 if rect has no neighbor in its row.
+static long grid_step (
+    const window_scores& all,
+    const rectangle& rect
+)
+{
+    long step = 0;
+    for (unsigned long i = 0; i < all.size(); ++i)
+    {
+        const point d = center(all[i].second) - center(rect);
+        if (same_level(all[i].second, rect) && d.y() == 0 && d.x() != 0)
+            step = step == 0 ? std::abs(d.x()) : std::min(step, std::abs(d.x()));
+    }
+    return step;
+}
+
+// ----------------------------------------------------------------------------------------
+
+struct results
+{
+    results() : num_windows(0), num_rect_mismatches(0), max_diff(0), num_radius_windows(0),
+        num_radius_mismatches(0), num_off_grid_mismatches(0), window_ms(0), scan_ms(0) {}
+
+    long num_windows;
+    long num_rect_mismatches;
+    double max_diff;
+    long num_radius_windows;
+    long num_radius_mismatches;
+    long num_off_grid_mismatches;
+    double window_ms;
+    double scan_ms;
+};
+
+template <typename image_type>
+static void check_image (
+    dlib::rand& rnd,
+    const scanner_type& scanner,
+    const scanner_type& scored_scanner,
+    const fhog_filterbank& fb,
+    const image_type& img,
+    results& res
+)
+{
+    scanner_type full;
+    full.copy_configuration(scanner);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    full.load(img);
+    window_scores all;
+    full.detect(fb, all, -std::numeric_limits<double>::infinity());
+    res.scan_ms += elapsed_ms(start);
+
+    const std::vector<const fhog_filterbank*> w(1, &fb);
+    window_scores scores;
+    long num_timed = 0;
+    double timed_ms = 0;
+    // The best scoring windows, which are the ones on and around faces where tracked faces
+    // are checked, and a random sample of the rest.
+    std::sort(all.begin(), all.end(), std::greater<std::pair<double, rectangle> >());
+    std::vector<unsigned long> sample;
+    for (unsigned long i = 0; i < all.size() && i < 50; ++i)
+        sample.push_back(i);
+    for (unsigned long i = 0; i < 50 && all.size() > 50; ++i)
+        sample.push_back(50 + rnd.get_random_32bit_number()%(all.size()-50));
+
+    for (unsigned long i : sample)
+    {
+        const rectangle& rect = all[i].second;
+
+        start = std::chrono::steady_clock::now();
+        scored_scanner.score_window(img, rect, w, scores);
+        timed_ms += elapsed_ms(start);
+        ++num_timed;
+
+        ++res.num_windows;
+        if (scores[0].second != rect)
+            ++res.num_rect_mismatches;
+        res.max_diff = std::max(res.max_diff, std::abs(scores[0].first - all[i].first));
+
+        // A rectangle a little off the window must be scored as the window it matches.
+        const rectangle off_grid = translate_rect(rect, point(rnd.get_random_32bit_number()%7, rnd.get_random_32bit_number()%7) - point(3,3));
+        window_scores matched, off;
+        scored_scanner.score_window(img, scored_scanner.get_best_matching_rect(off_grid), w, matched);
+        scored_scanner.score_window(img, off_grid, w, off);
+        if (off[0] != matched[0])
+            ++res.num_off_grid_mismatches;
+
+        // With a search radius the best window of the same level within that many cells
+        // is found, which the full scan can find too.  The windows searched must lie
+        // inside the image so they can be told apart by their size.
+        const unsigned long radius = 1 + rnd.get_random_32bit_number()%3;
+        const long step = grid_step(all, rect);
+        if (step != 0 && get_rect(img).contains(grow_rect(rect, (radius+1)*step)))
+        {
+            const point c = center(rect);
+            double best = -std::numeric_limits<double>::infinity();
+            for (unsigned long j = 0; j < all.size(); ++j)
+            {
+                const point d = center(all[j].second) - c;
+                if (same_level(all[j].second, rect) &&
+                    std::abs(d.x()) <= (radius+0.5)*step && std::abs(d.y()) <= (radius+0.5)*step)
+                    best = std::max(best, all[j].first);
+            }
+            scored_scanner.score_window(img, rect, w, scores, radius);
+            window_scores at_best;
+            scored_scanner.score_window(img, scores[0].second, w, at_best);
+            ++res.num_radius_windows;
+            if (scores[0].first != best || at_best[0].first != scores[0].first)
+                ++res.num_radius_mismatches;
+        }
+    }
+    res.window_ms += timed_ms/std::max(1L, num_timed);
+}
+
+static void check_mode (
+    dlib::rand& rnd,
+    const frontal_face_detector& detector,
+    const dlib::array<array2d<rgb_pixel> >& images,
+    bool grayscale,
+    bool quantized
+)
+{
+    const scanner_type& scanner = detector.get_scanner();
+    const fhog_filterbank fb = scanner.build_fhog_filterbank(detector.get_w(0));
+    scanner_type scored_scanner;
+    scored_scanner.copy_configuration(scanner);
+    scored_scanner.set_quantized_detection(quantized);
+
+    results res;
+    for (unsigned long i = 0; i < images.size(); ++i)
+    {
+        if (grayscale)
+        {
+            array2d<unsigned char> gray;
+            assign_image(gray, images[i]);
+            check_image(rnd, scanner, scored_scanner, fb, gray, res);
+        }
+        else
+        {
+            check_image(rnd, scanner, scored_scanner, fb, images[i], res);
+        }
+    }
+
+    std::printf("\n%s%s: %ld windows, %ld with a search radius, max score diff %g, one window %.3f ms, full scan %.1f ms\n",
+                grayscale ? "grayscale" : "rgb", quantized ? " quantized" : "", res.num_windows,
+                res.num_radius_windows, res.max_diff, res.window_ms/images.size(), res.scan_ms/images.size());
+    const bool rects_ok = res.num_rect_mismatches == 0;
+    const bool scores_ok = res.max_diff == 0;
+    const bool off_grid_ok = res.num_off_grid_mismatches == 0;
+    const bool radius_ok = res.num_radius_mismatches == 0;
+    report("  rectangles match the full scan", rects_ok);
+    report("  scores match the full scan", scores_ok);
+    report("  off grid rectangles use the best matching window", off_grid_ok);
+    report("  search radius finds the best nearby window", radius_ok);
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main()
+{
+    dlib::rand rnd;
+    dlib::array<array2d<rgb_pixel> > images;
+    make_synthetic_images(images, 4, 4);
+    frontal_face_detector detector = get_frontal_face_detector();
+
+    check_mode(rnd, detector, images, true, false);
+    check_mode(rnd, detector, images, false, false);
+    check_mode(rnd, detector, images, true, true);
+    check_mode(rnd, detector, images, false, true);
+
+    std::printf("\n%s\n", num_failed == 0 ? "OK" : "FAILED");
+    return num_failed == 0 ? 0 : 1;
+}
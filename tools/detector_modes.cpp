@@ -0,0 +1,244 @@
+// Compares the detection modes of the extension with the float RGB detector they stand in
+// for, so the accuracy given up for speed is known before one is turned on:
+//
+//   - rgb float          the reference, dlib's detector on the RGB frame
+//   - gray float         grayscale = true, the frame converted to Rec. 601 luminance
+//   - rgb int16          quantized = true, 16 bit fixed point features and filters
+//   - rgb interleaved    fhog_interleaved_layout, all the planes filtered in one pass
+//   - gray int16         both grayscale and quantized
+//
+// For every mode it prints the average detection time per image, the number of
+// detections, how many of them match a detection of the reference (intersection over
+// union above 0.5, one to one), the reference detections it missed and the largest score
+// difference of the matched ones.  Given a labeled image set in dlib's imglab XML format,
+// e.g. the faces in dlib's examples/faces/testing.xml, it also prints the precision,
+// recall and average precision of each mode.  Without one it runs on a fixed set of
+// synthetic RGB images with drawn faces, which only shows the agreement with the
+// reference.  Build it against the same headers as the extension and dlib's
+// all/source.cpp with image loading enabled, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -DDLIB_JPEG_SUPPORT -DDLIB_PNG_SUPPORT -Ifacerec/include
+//       tools/detector_modes.cpp path/to/dlib/all/source.cpp
+//       -ljpeg -lpng -llapack -lblas -lpthread -o detector_modes
+//   ./detector_modes testing.xml
+//
+// An optional second argument is added to the detection threshold of every mode, e.g.
+// ./detector_modes testing.xml -0.5, where - in place of the data set picks the
+// synthetic images.
+
+#include <extdlib/image_processing/frontal_face_detector.h>
+#include <extdlib/data_io.h>
+#include <extdlib/svm.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "synthetic_faces.h"
+
+using namespace dlib;
+
+typedef scan_fhog_pyramid<pyramid_down<6>, default_fhog_feature_extractor, fhog_interleaved_layout> interleaved_scanner_type;
+typedef object_detector<interleaved_scanner_type> interleaved_face_detector;
+
+struct mode_result
+{
+    std::string name;
+    double ms;
+    std::vector<std::vector<rect_detection> > dets;
+    matrix<double,1,3> accuracy;
+};
+
+// ----------------------------------------------------------------------------------------
+
+// The luminance the extension computes for grayscale = true
+static void to_luminance (
+    const array2d<rgb_pixel>& rgb,
+    array2d<unsigned char>& gray
+)
+{
+    gray.set_size(rgb.nr(), rgb.nc());
+    for (long r = 0; r < rgb.nr(); ++r)
+    {
+        for (long c = 0; c < rgb.nc(); ++c)
+        {
+            const rgb_pixel& p = rgb[r][c];
+            gray[r][c] = (unsigned char)((77*p.red + 150*p.green + 29*p.blue) >> 8);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------------------
+
+// A detector equal to the frontal face detector, but scanning interleaved features
+static interleaved_face_detector make_interleaved_detector (
+    const frontal_face_detector& detector
+)
+{
+    const frontal_face_detector::image_scanner_type& s = detector.get_scanner();
+    interleaved_scanner_type scanner;
+    scanner.set_detection_window_size(s.get_detection_window_width(), s.get_detection_window_height());
+    scanner.set_padding(s.get_padding());
+    scanner.set_cell_size(s.get_cell_size());
+    scanner.set_max_pyramid_levels(s.get_max_pyramid_levels());
+    scanner.set_min_pyramid_layer_size(s.get_min_pyramid_layer_width(), s.get_min_pyramid_layer_height());
+    scanner.set_nuclear_norm_regularization_strength(s.get_nuclear_norm_regularization_strength());
+
+    std::vector<interleaved_face_detector::feature_vector_type> w;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+        w.push_back(detector.get_w(i));
+    return interleaved_face_detector(scanner, detector.get_overlap_tester(), w);
+}
+
+// The frontal face detector with quantized detection switched on, the way the extension
+// builds it
+static frontal_face_detector make_quantized_detector (
+    const frontal_face_detector& detector
+)
+{
+    frontal_face_detector::image_scanner_type scanner;
+    scanner.copy_configuration(detector.get_scanner());
+    scanner.set_quantized_detection(true);
+
+    std::vector<processed_weight_vector<frontal_face_detector::image_scanner_type> > w;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+        w.push_back(detector.get_processed_w(i));
+    return frontal_face_detector(scanner, detector.get_overlap_tester(), w);
+}
+
+// ----------------------------------------------------------------------------------------
+
+template <typename detector_type, typename image_array_type>
+static mode_result run_mode (
+    const std::string& name,
+    detector_type& detector,
+    const image_array_type& images,
+    const std::vector<std::vector<rectangle> >& boxes,
+    const std::vector<std::vector<rectangle> >& ignore,
+    const double adjust_threshold
+)
+{
+    mode_result res;
+    res.name = name;
+    res.dets.resize(images.size());
+
+    // Time the detector on its own, since test_object_detection_function() also does
+    // the matching against the truth boxes.
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < images.size(); ++i)
+        detector(images[i], res.dets[i], adjust_threshold);
+    res.ms = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count() /
+        std::max<unsigned long>(images.size(), 1);
+
+    res.accuracy = 0;
+    if (boxes.size() != 0)
+        res.accuracy = test_object_detection_function(detector, images, boxes, ignore, test_box_overlap(), adjust_threshold);
+    return res;
+}
+
+static double overlap (
+    const rectangle& a,
+    const rectangle& b
+)
+{
+    const double inner = a.intersect(b).area();
+    return inner/(a.area() + b.area() - inner);
+}
+
+static void print_mode (
+    const mode_result& res,
+    const mode_result& reference,
+    bool with_accuracy
+)
+{
+    unsigned long num = 0, matched = 0, missed = 0;
+    double max_diff = 0;
+    for (unsigned long i = 0; i < res.dets.size(); ++i)
+    {
+        const std::vector<rect_detection>& ref = reference.dets[i];
+        const std::vector<rect_detection>& dets = res.dets[i];
+        std::vector<bool> used(dets.size(), false);
+        num += dets.size();
+        for (unsigned long j = 0; j < ref.size(); ++j)
+        {
+            unsigned long best = dets.size();
+            double best_overlap = 0.5;
+            for (unsigned long k = 0; k < dets.size(); ++k)
+            {
+                if (!used[k] && overlap(ref[j].rect, dets[k].rect) > best_overlap)
+                {
+                    best_overlap = overlap(ref[j].rect, dets[k].rect);
+                    best = k;
+                }
+            }
+            if (best == dets.size())
+            {
+                ++missed;
+                continue;
+            }
+            used[best] = true;
+            ++matched;
+            max_diff = std::max(max_diff, std::abs(dets[best].detection_confidence - ref[j].detection_confidence));
+        }
+    }
+
+    std::printf("%-16s %10.2f %8lu %8lu %8lu %8lu %10.4f", res.name.c_str(), res.ms, num, matched,
+        missed, num - matched, max_diff);
+    if (with_accuracy)
+        std::printf(" %10.4f %10.4f %10.4f", res.accuracy(0), res.accuracy(1), res.accuracy(2));
+    std::printf("\n");
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        dlib::array<array2d<rgb_pixel> > images;
+        std::vector<std::vector<rectangle> > boxes, ignore;
+        if (argc > 1 && std::string(argv[1]) != "-")
+        {
+            ignore = load_image_dataset(images, boxes, argv[1]);
+            std::cout << "loaded " << images.size() << " images from " << argv[1] << "\n\n";
+        }
+        else
+        {
+            make_synthetic_images(images, 12, 4);
+            std::cout << "generated " << images.size() << " synthetic images\n\n";
+        }
+        const double adjust_threshold = argc > 2 ? std::atof(argv[2]) : 0;
+
+        dlib::array<array2d<unsigned char> > gray(images.size());
+        for (unsigned long i = 0; i < images.size(); ++i)
+            to_luminance(images[i], gray[i]);
+
+        frontal_face_detector detector = get_frontal_face_detector();
+        frontal_face_detector quantized = make_quantized_detector(detector);
+        interleaved_face_detector interleaved = make_interleaved_detector(detector);
+
+        std::vector<mode_result> results;
+        results.push_back(run_mode("rgb float", detector, images, boxes, ignore, adjust_threshold));
+        results.push_back(run_mode("gray float", detector, gray, boxes, ignore, adjust_threshold));
+        results.push_back(run_mode("rgb int16", quantized, images, boxes, ignore, adjust_threshold));
+        results.push_back(run_mode("rgb interleaved", interleaved, images, boxes, ignore, adjust_threshold));
+        results.push_back(run_mode("gray int16", quantized, gray, boxes, ignore, adjust_threshold));
+
+        std::printf("%-16s %10s %8s %8s %8s %8s %10s", "mode", "ms/image", "dets", "matched", "missed",
+            "extra", "max diff");
+        if (boxes.size() != 0)
+            std::printf(" %10s %10s %10s", "precision", "recall", "AP");
+        std::printf("\n");
+        for (unsigned long i = 0; i < results.size(); ++i)
+            print_mode(results[i], results[0], boxes.size() != 0);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
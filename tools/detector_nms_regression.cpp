@@ -0,0 +1,261 @@
+// Checks that the shortcuts the extension takes in non-max suppression give the same faces
+// as dlib's original detector, and how much time they save.  It compares
+//
+//   - before   every window above the threshold, sorted and suppressed by checking each
+//              against all the boxes kept so far, the way dlib 19.2 does it
+//   - grid     the frontal face detector as it is, which suppresses with
+//              impl::box_overlap_grid and must keep exactly the same boxes as before
+//   - facerec  the detector as the extension configures it with max_candidates = 256:
+//              only local maxima of each pyramid level are scanned for, and at most 256
+//              windows are kept per filter and in total
+//
+// at a few detection thresholds.  For every one it prints the time per image of each
+// method, the detections of each, the number of images where grid and before differ, and
+// for facerec the detections that match one of before (intersection over union above
+// 0.5, one to one), the ones of before it missed and the largest score difference.  Given
+// a labeled image set in dlib's imglab XML format it also prints the precision, recall and
+// average precision of grid and facerec.  Without one it runs on a fixed set of synthetic
+// images with many drawn faces.  Build it against the same headers as the extension and
+// dlib's all/source.cpp with image loading enabled, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -DDLIB_JPEG_SUPPORT -DDLIB_PNG_SUPPORT -Ifacerec/include
+//       tools/detector_nms_regression.cpp path/to/dlib/all/source.cpp
+//       -ljpeg -lpng -llapack -lblas -lpthread -o detector_nms_regression
+//   ./detector_nms_regression testing.xml
+//
+// Extra arguments replace the default thresholds, which are added to the detector's own,
+// e.g. ./detector_nms_regression testing.xml 0 -0.5, where - in place of the data set
+// picks the synthetic images.  It returns 1 if grid and before ever differ.
+
+#include <extdlib/image_processing/frontal_face_detector.h>
+#include <extdlib/data_io.h>
+#include <extdlib/svm.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "synthetic_faces.h"
+
+using namespace dlib;
+
+// ----------------------------------------------------------------------------------------
+
+// The detector as FacerecConfigureDetector() in facerec.cpp builds it for max_candidates
+static frontal_face_detector make_facerec_detector (
+    const frontal_face_detector& detector,
+    unsigned long max_candidates
+)
+{
+    frontal_face_detector::image_scanner_type scanner;
+    scanner.copy_configuration(detector.get_scanner());
+    scanner.set_local_max_detection(true);
+    scanner.set_max_detections(max_candidates);
+
+    std::vector<processed_weight_vector<frontal_face_detector::image_scanner_type> > w;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+        w.push_back(detector.get_processed_w(i));
+    frontal_face_detector configured(scanner, detector.get_overlap_tester(), w);
+    configured.set_max_candidates(max_candidates);
+    return configured;
+}
+
+// What object_detector::operator() did before the grid, the local maxima and the cap
+static void detect_before (
+    const frontal_face_detector& detector,
+    frontal_face_detector::image_scanner_type& scanner,
+    const array2d<rgb_pixel>& img,
+    std::vector<rect_detection>& final_dets,
+    const double adjust_threshold
+)
+{
+    scanner.load(img);
+    std::vector<std::pair<double, rectangle> > dets;
+    std::vector<rect_detection> dets_accum;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+    {
+        const processed_weight_vector<frontal_face_detector::image_scanner_type>& pw = detector.get_processed_w(i);
+        const double thresh = pw.w(scanner.get_num_dimensions());
+        scanner.detect(pw.get_detect_argument(), dets, thresh + adjust_threshold);
+        for (unsigned long j = 0; j < dets.size(); ++j)
+        {
+            rect_detection temp;
+            temp.detection_confidence = dets[j].first-thresh;
+            temp.weight_index = i;
+            temp.rect = dets[j].second;
+            dets_accum.push_back(temp);
+        }
+    }
+
+    std::sort(dets_accum.rbegin(), dets_accum.rend());
+    final_dets.clear();
+    std::vector<rectangle> kept;
+    for (unsigned long i = 0; i < dets_accum.size(); ++i)
+    {
+        if (overlaps_any_box(detector.get_overlap_tester(), kept, dets_accum[i].rect))
+            continue;
+
+        kept.push_back(dets_accum[i].rect);
+        final_dets.push_back(dets_accum[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------------------
+
+static double overlap (
+    const rectangle& a,
+    const rectangle& b
+)
+{
+    const double inner = a.intersect(b).area();
+    return inner/(a.area() + b.area() - inner);
+}
+
+static bool same_detections (
+    const std::vector<rect_detection>& a,
+    const std::vector<rect_detection>& b
+)
+{
+    if (a.size() != b.size())
+        return false;
+    for (unsigned long i = 0; i < a.size(); ++i)
+    {
+        if (a[i].rect != b[i].rect || a[i].detection_confidence != b[i].detection_confidence)
+            return false;
+    }
+    return true;
+}
+
+// Matches dets one to one against the reference, best overlap first, and returns the
+// number matched.  missed counts the reference detections left over.
+static unsigned long match_detections (
+    const std::vector<rect_detection>& ref,
+    const std::vector<rect_detection>& dets,
+    unsigned long& missed,
+    double& max_diff
+)
+{
+    std::vector<bool> used(dets.size(), false);
+    unsigned long matched = 0;
+    for (unsigned long j = 0; j < ref.size(); ++j)
+    {
+        unsigned long best = dets.size();
+        double best_overlap = 0.5;
+        for (unsigned long k = 0; k < dets.size(); ++k)
+        {
+            if (!used[k] && overlap(ref[j].rect, dets[k].rect) > best_overlap)
+            {
+                best_overlap = overlap(ref[j].rect, dets[k].rect);
+                best = k;
+            }
+        }
+        if (best == dets.size())
+        {
+            ++missed;
+            continue;
+        }
+        used[best] = true;
+        ++matched;
+        max_diff = std::max(max_diff, std::abs(dets[best].detection_confidence - ref[j].detection_confidence));
+    }
+    return matched;
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    std::vector<double> thresholds;
+    for (int i = 2; i < argc; ++i)
+        thresholds.push_back(std::atof(argv[i]));
+    if (thresholds.size() == 0)
+    {
+        const double defaults[] = { 0, -0.5, -1, -1.5, -2 };
+        thresholds.assign(defaults, defaults + sizeof(defaults)/sizeof(defaults[0]));
+    }
+
+    try
+    {
+        dlib::array<array2d<rgb_pixel> > images;
+        std::vector<std::vector<rectangle> > boxes, ignore;
+        if (argc > 1 && std::string(argv[1]) != "-")
+        {
+            ignore = load_image_dataset(images, boxes, argv[1]);
+            std::cout << "loaded " << images.size() << " images from " << argv[1] << "\n\n";
+        }
+        else
+        {
+            make_synthetic_images(images, 8, 12);
+            std::cout << "generated " << images.size() << " synthetic images\n\n";
+        }
+        const double num_images = std::max<unsigned long>(images.size(), 1);
+
+        frontal_face_detector grid = get_frontal_face_detector();
+        frontal_face_detector facerec = make_facerec_detector(grid, 256);
+        frontal_face_detector::image_scanner_type scanner;
+        scanner.copy_configuration(grid.get_scanner());
+
+        std::printf("%7s %10s %10s %10s %7s %7s %7s %7s %7s %7s %9s", "thresh", "ms before", "ms grid",
+            "ms facerec", "before", "grid", "differ", "facerec", "matched", "missed", "max diff");
+        if (boxes.size() != 0)
+            std::printf(" %8s %8s %8s %8s", "grid AP", "recall", "facerec AP", "recall");
+        std::printf("\n");
+
+        bool ok = true;
+        for (unsigned long t = 0; t < thresholds.size(); ++t)
+        {
+            const double adjust = thresholds[t];
+            std::vector<std::vector<rect_detection> > before(images.size()), after_grid(images.size()), after_facerec(images.size());
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (unsigned long i = 0; i < images.size(); ++i)
+                detect_before(grid, scanner, images[i], before[i], adjust);
+            const double ms_before = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (unsigned long i = 0; i < images.size(); ++i)
+                grid(images[i], after_grid[i], adjust);
+            const double ms_grid = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (unsigned long i = 0; i < images.size(); ++i)
+                facerec(images[i], after_facerec[i], adjust);
+            const double ms_facerec = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            unsigned long num_before = 0, num_grid = 0, num_facerec = 0, differ = 0, matched = 0, missed = 0;
+            double max_diff = 0;
+            for (unsigned long i = 0; i < images.size(); ++i)
+            {
+                num_before += before[i].size();
+                num_grid += after_grid[i].size();
+                num_facerec += after_facerec[i].size();
+                differ += !same_detections(before[i], after_grid[i]);
+                matched += match_detections(before[i], after_facerec[i], missed, max_diff);
+            }
+            ok = ok && differ == 0;
+
+            std::printf("%7.2f %10.2f %10.2f %10.2f %7lu %7lu %7lu %7lu %7lu %7lu %9.4f", adjust, ms_before/num_images,
+                ms_grid/num_images, ms_facerec/num_images, num_before, num_grid, differ, num_facerec, matched,
+                missed, max_diff);
+            if (boxes.size() != 0)
+            {
+                const matrix<double,1,3> res_grid = test_object_detection_function(grid, images, boxes, ignore,
+                    test_box_overlap(), adjust);
+                const matrix<double,1,3> res_facerec = test_object_detection_function(facerec, images, boxes, ignore,
+                    test_box_overlap(), adjust);
+                std::printf(" %8.4f %8.4f %8.4f %8.4f", res_grid(2), res_grid(1), res_facerec(2), res_facerec(1));
+            }
+            std::printf("\n");
+        }
+        std::printf("\n%s\n", ok ? "OK" : "FAILED: grid non-max suppression differs from the original");
+        return ok ? 0 : 1;
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,110 @@
+// Reports how the frontal face detector's speed and accuracy trade off when its filters
+// are truncated with truncate_separable_filters(), so max_filter_rank and
+// min_singular_value can be picked to fit the CPU budget of a device class.
+//
+// For every setting it prints the number of separable filters left, the average
+// detection time per image, and the precision, recall and average precision against a
+// labeled image set in dlib's imglab XML format, e.g. the faces in dlib's
+// examples/faces/testing.xml.  Build it against the same headers as the extension and
+// dlib's all/source.cpp with image loading enabled, e.g.
+//
+//   g++ -std=c++11 -O2 -DNDEBUG -DDLIB_JPEG_SUPPORT -DDLIB_PNG_SUPPORT -Ifacerec/include
+//       tools/detector_rank_ap.cpp path/to/dlib/all/source.cpp
+//       -ljpeg -lpng -llapack -lblas -lpthread -o detector_rank_ap
+//   ./detector_rank_ap testing.xml
+//
+// Extra arguments replace the default settings, written as rank or rank:thresh, where
+// rank 0 keeps all the components, e.g. ./detector_rank_ap testing.xml 0 4 2 0:0.2
+
+#include <extdlib/image_processing/frontal_face_detector.h>
+#include <extdlib/data_io.h>
+#include <extdlib/svm.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace dlib;
+
+struct truncation_setting
+{
+    unsigned long rank;
+    double thresh;
+};
+
+// ----------------------------------------------------------------------------------------
+
+static unsigned long total_separable_filters (
+    const frontal_face_detector& detector
+)
+{
+    unsigned long num = 0;
+    for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+        num += detector.get_processed_w(i).get_detect_argument().num_separable_filters();
+    return num;
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " dataset.xml [rank[:thresh] ...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<truncation_setting> settings;
+    for (int i = 2; i < argc; ++i)
+    {
+        truncation_setting s;
+        char* end;
+        s.rank = std::strtoul(argv[i], &end, 10);
+        s.thresh = *end == ':' ? std::atof(end+1) : 0;
+        settings.push_back(s);
+    }
+    if (settings.size() == 0)
+    {
+        const truncation_setting defaults[] = {
+            {0, 0}, {6, 0}, {4, 0}, {3, 0}, {2, 0}, {1, 0},
+            {0, 0.05}, {0, 0.1}, {0, 0.2}, {0, 0.3}
+        };
+        settings.assign(defaults, defaults + sizeof(defaults)/sizeof(defaults[0]));
+    }
+
+    try
+    {
+        dlib::array<array2d<unsigned char> > images;
+        std::vector<std::vector<rectangle> > boxes;
+        const std::vector<std::vector<rectangle> > ignore = load_image_dataset(images, boxes, argv[1]);
+        std::cout << "loaded " << images.size() << " images from " << argv[1] << "\n\n";
+
+        const frontal_face_detector full = get_frontal_face_detector();
+
+        std::printf("%6s %8s %10s %10s %10s %10s %10s\n", "rank", "thresh", "filters", "ms/image", "precision", "recall", "AP");
+        for (unsigned long i = 0; i < settings.size(); ++i)
+        {
+            const unsigned long max_rank = settings[i].rank != 0 ? settings[i].rank : ~0UL;
+            frontal_face_detector detector = truncate_separable_filters(full, max_rank, settings[i].thresh);
+
+            // Time the detector on its own, since test_object_detection_function() also
+            // does the matching against the truth boxes.
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (unsigned long j = 0; j < images.size(); ++j)
+                detector(images[j]);
+            const double ms = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            const matrix<double,1,3> res = test_object_detection_function(detector, images, boxes, ignore);
+            std::printf("%6lu %8.3f %10lu %10.2f %10.4f %10.4f %10.4f\n", settings[i].rank, settings[i].thresh,
+                total_separable_filters(detector), ms/std::max<unsigned long>(images.size(), 1), res(0), res(1), res(2));
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
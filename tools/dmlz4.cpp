@@ -0,0 +1,48 @@
+// The dmLZ4 functions from the Defold SDK, implemented on top of the reference LZ4
+// library, for building the tools in this directory outside of the engine.  Link it with
+// -llz4.  Like dmLZ4 it uses LZ4's raw block format without any framing.
+
+#include <extdlib/lz4.h>
+#include <lz4.h>
+
+namespace dmLZ4
+{
+    Result DecompressBuffer(const void* buffer, uint32_t buffer_size, void* decompressed_buffer, uint32_t max_output, int* decompressed_size)
+    {
+        if (max_output > DMLZ4_MAX_OUTPUT_SIZE)
+            return RESULT_OUTPUT_SIZE_TOO_LARGE;
+        const int r = LZ4_decompress_safe((const char*)buffer, (char*)decompressed_buffer, (int)buffer_size, (int)max_output);
+        if (r < 0)
+            return RESULT_OUTBUFFER_TOO_SMALL;
+        *decompressed_size = r;
+        return RESULT_OK;
+    }
+
+    Result DecompressBufferFast(const void* buffer, uint32_t buffer_size, void* decompressed_buffer, uint32_t decompressed_size)
+    {
+        int size = 0;
+        Result r = DecompressBuffer(buffer, buffer_size, decompressed_buffer, decompressed_size, &size);
+        if (r == RESULT_OK && (uint32_t)size != decompressed_size)
+            return RESULT_OUTBUFFER_TOO_SMALL;
+        return r;
+    }
+
+    Result CompressBuffer(const void* buffer, uint32_t buffer_size, void* compressed_buffer, int* compressed_size)
+    {
+        if (buffer_size > LZ4_MAX_INPUT_SIZE)
+            return RESULT_INPUT_SIZE_TOO_LARGE;
+        const int r = LZ4_compress_default((const char*)buffer, (char*)compressed_buffer, (int)buffer_size, LZ4_compressBound((int)buffer_size));
+        if (r <= 0)
+            return RESULT_COMPRESSION_FAILED;
+        *compressed_size = r;
+        return RESULT_OK;
+    }
+
+    Result MaxCompressedSize(int uncompressed_size, int* max_compressed_size)
+    {
+        if (uncompressed_size < 0 || uncompressed_size > LZ4_MAX_INPUT_SIZE)
+            return RESULT_INPUT_SIZE_TOO_LARGE;
+        *max_compressed_size = LZ4_compressBound(uncompressed_size);
+        return RESULT_OK;
+    }
+}
@@ -0,0 +1,145 @@
+// Converts a serialized frontal_face_detector into the precompiled tables in
+// facerec/include/extdlib/image_processing/frontal_face_detector_tables.h
+//
+// The detector is deserialized exactly the way get_frontal_face_detector() used to do
+// it, so the separable row/column filters written out are the ones the SVD in
+// scan_fhog_pyramid::build_fhog_filterbank() produces.  Build it against the same
+// headers as the extension and dlib's all/source.cpp, e.g.
+//
+//   g++ -std=c++11 -O2 -Ifacerec/include tools/generate_detector_tables.cpp
+//       path/to/dlib/all/source.cpp -llapack -lblas -lpthread -o generate_detector_tables
+//   ./generate_detector_tables object_detector.dat
+//       > facerec/include/extdlib/image_processing/frontal_face_detector_tables.h
+
+#include <extdlib/image_processing/object_detector.h>
+#include <extdlib/image_processing/scan_fhog_pyramid.h>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using namespace dlib;
+
+typedef scan_fhog_pyramid<pyramid_down<6> > image_scanner_type;
+typedef object_detector<image_scanner_type> detector_type;
+typedef image_scanner_type::fhog_filterbank fhog_filterbank;
+
+// ----------------------------------------------------------------------------------------
+
+static void print_floats (
+    const char* name,
+    const std::vector<float>& values
+)
+{
+    // 9 significant digits round trip any float exactly.
+    std::printf("        static const float DM_ALIGNED(32) %s[%lu] = {", name, (unsigned long)values.size());
+    for (unsigned long i = 0; i < values.size(); ++i)
+    {
+        if (i%6 == 0)
+            std::printf("\n           ");
+        std::printf(" %16.8ef,", values[i]);
+    }
+    std::printf("\n        };\n\n");
+}
+
+// ----------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::cerr << "usage: " << argv[0] << " object_detector.dat > frontal_face_detector_tables.h" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        std::ifstream fin(argv[1], std::ios::binary);
+        if (!fin)
+        {
+            std::cerr << "unable to open " << argv[1] << std::endl;
+            return 1;
+        }
+        detector_type detector;
+        deserialize(detector, fin);
+
+        const image_scanner_type& scanner = detector.get_scanner();
+        const test_box_overlap& overlap = detector.get_overlap_tester();
+        const long num_planes = detector.get_processed_w(0).get_detect_argument().filters.size();
+        const long filter_rows = detector.get_processed_w(0).get_detect_argument().filters[0].nr();
+        const long filter_cols = detector.get_processed_w(0).get_detect_argument().filters[0].nc();
+
+        std::vector<double> biases;
+        std::vector<float> filters, row_filters, col_filters;
+        std::vector<unsigned long> num_separable_filters;
+        for (unsigned long i = 0; i < detector.num_detectors(); ++i)
+        {
+            const fhog_filterbank& fb = detector.get_processed_w(i).get_detect_argument();
+            biases.push_back(detector.get_w(i)(scanner.get_num_dimensions()));
+            for (long p = 0; p < num_planes; ++p)
+            {
+                filters.insert(filters.end(), &fb.filters[p](0,0), &fb.filters[p](0,0) + filter_rows*filter_cols);
+                num_separable_filters.push_back(fb.row_filters[p].size());
+                for (unsigned long k = 0; k < fb.row_filters[p].size(); ++k)
+                {
+                    row_filters.insert(row_filters.end(), &fb.row_filters[p][k](0), &fb.row_filters[p][k](0) + filter_cols);
+                    col_filters.insert(col_filters.end(), &fb.col_filters[p][k](0), &fb.col_filters[p][k](0) + filter_rows);
+                }
+            }
+        }
+
+        std::printf("// Generated by tools/generate_detector_tables.cpp from %s.  Do not edit.\n", argv[1]);
+        std::printf("#ifndef DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_\n");
+        std::printf("#define DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_\n\n");
+        std::printf("#include \"../align.h\"\n\n");
+        std::printf("namespace dlib\n{\n");
+        std::printf("    namespace frontal_face_tables\n    {\n");
+        std::printf("        const unsigned long num_detectors = %lu;\n", detector.num_detectors());
+        std::printf("        const long num_planes = %ld;\n", num_planes);
+        std::printf("        const long filter_rows = %ld;\n", filter_rows);
+        std::printf("        const long filter_cols = %ld;\n\n", filter_cols);
+        std::printf("        const unsigned long cell_size = %lu;\n", scanner.get_cell_size());
+        std::printf("        const unsigned long padding = %lu;\n", scanner.get_padding());
+        std::printf("        const unsigned long window_width = %lu;\n", scanner.get_detection_window_width());
+        std::printf("        const unsigned long window_height = %lu;\n", scanner.get_detection_window_height());
+        std::printf("        const unsigned long max_pyramid_levels = %lu;\n", scanner.get_max_pyramid_levels());
+        std::printf("        const unsigned long min_pyramid_layer_width = %lu;\n", scanner.get_min_pyramid_layer_width());
+        std::printf("        const unsigned long min_pyramid_layer_height = %lu;\n", scanner.get_min_pyramid_layer_height());
+        std::printf("        const double nuclear_norm_regularization_strength = %.17g;\n\n", scanner.get_nuclear_norm_regularization_strength());
+        std::printf("        const double iou_thresh = %.17g;\n", overlap.get_iou_thresh());
+        std::printf("        const double percent_covered_thresh = %.17g;\n\n", overlap.get_percent_covered_thresh());
+
+        std::printf("        // The detection threshold of each detector.\n");
+        std::printf("        static const double biases[%lu] = {", (unsigned long)biases.size());
+        for (unsigned long i = 0; i < biases.size(); ++i)
+            std::printf("%s%.17g", i == 0 ? "" : ", ", biases[i]);
+        std::printf("};\n\n");
+
+        std::printf("        // How many separable filters each plane of each detector was decomposed into.\n");
+        std::printf("        static const unsigned char num_separable_filters[%lu] = {", (unsigned long)num_separable_filters.size());
+        for (unsigned long i = 0; i < num_separable_filters.size(); ++i)
+        {
+            if (i%num_planes == 0)
+                std::printf("\n           ");
+            std::printf(" %lu,", num_separable_filters[i]);
+        }
+        std::printf("\n        };\n\n");
+
+        std::printf("        // The full filter of each plane of each detector, stored row major.\n");
+        print_floats("filters", filters);
+        std::printf("        // The row and column parts of the separable filters, in the same order as\n");
+        std::printf("        // num_separable_filters.\n");
+        print_floats("row_filters", row_filters);
+        print_floats("col_filters", col_filters);
+
+        std::printf("    }\n}\n\n");
+        std::printf("#endif // DLIB_FRONTAL_FACE_DETECTOR_TABLEs_Hh_\n\n");
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
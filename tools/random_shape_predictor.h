@@ -0,0 +1,50 @@
+// A shape_predictor made of random trees, for the tools that check a way of storing or
+// evaluating a landmark model against the regular one.  Its landmarks are meaningless, but
+// every split and leaf is used, so any difference between two ways of evaluating the same
+// trees shows up in the landmarks.
+#ifndef FACEREC_TOOLS_RANDOM_SHAPE_PREDICTOR_H
+#define FACEREC_TOOLS_RANDOM_SHAPE_PREDICTOR_H
+
+#include <extdlib/image_processing/shape_predictor.h>
+#include <extdlib/rand.h>
+#include <vector>
+
+// Makes a shape_predictor with the given number of parts, cascades and trees per cascade,
+// each tree 4 levels deep, sized by default a bit like a small landmark model.
+inline dlib::shape_predictor make_random_shape_predictor (
+    dlib::rand& rnd,
+    unsigned long num_parts = 68,
+    unsigned long num_cascades = 5,
+    unsigned long num_trees = 50
+)
+{
+    using namespace dlib;
+    const unsigned long num_pixels = 200;
+    std::vector<std::vector<impl::regression_tree> > forests(num_cascades);
+    std::vector<std::vector<dlib::vector<float,2> > > pixel_coordinates(num_cascades);
+    for (unsigned long i = 0; i < forests.size(); ++i)
+    {
+        pixel_coordinates[i].resize(num_pixels);
+        for (unsigned long j = 0; j < num_pixels; ++j)
+            pixel_coordinates[i][j] = dlib::vector<float,2>(rnd.get_random_gaussian()*0.2, rnd.get_random_gaussian()*0.2);
+
+        forests[i].resize(num_trees);
+        for (impl::regression_tree& tree : forests[i])
+        {
+            tree.splits.resize(15);
+            for (impl::split_feature& split : tree.splits)
+            {
+                split.idx1 = rnd.get_random_32bit_number()%num_pixels;
+                split.idx2 = rnd.get_random_32bit_number()%num_pixels;
+                split.thresh = rnd.get_random_gaussian()*20;
+            }
+            tree.leaf_values.resize(16);
+            for (matrix<float,0,1>& leaf : tree.leaf_values)
+                leaf = matrix_cast<float>(randm(num_parts*2, 1, rnd)*0.02 - 0.01);
+        }
+    }
+    const matrix<float,0,1> initial_shape = matrix_cast<float>(randm(num_parts*2, 1, rnd) - 0.5);
+    return shape_predictor(initial_shape, forests, pixel_coordinates);
+}
+
+#endif
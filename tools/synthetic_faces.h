@@ -0,0 +1,97 @@
+// The fixed set of synthetic face images the tools fall back on when no labeled image set
+// is given.  The faces are drawn shapes the frontal face detector picks up, not real
+// faces, so they only show whether two ways of detecting agree, not how well either
+// finds real faces.
+#ifndef FACEREC_TOOLS_SYNTHETIC_FACES_H
+#define FACEREC_TOOLS_SYNTHETIC_FACES_H
+
+#include <extdlib/array.h>
+#include <extdlib/array2d.h>
+#include <extdlib/pixel.h>
+#include <extdlib/rand.h>
+#include <algorithm>
+#include <cmath>
+
+// Draws a shaded oval face with eyes, brows, nose and mouth centered at (cx,cy), with a
+// skin tone that sets it apart from the background more in some channels than others.
+inline void draw_face (
+    dlib::array2d<dlib::rgb_pixel>& img,
+    double cx,
+    double cy,
+    double size,
+    const double tone[3]
+)
+{
+    const long top = std::max(0L, (long)(cy-size)), bottom = std::min(img.nr(), (long)(cy+size));
+    const long left = std::max(0L, (long)(cx-size)), right = std::min(img.nc(), (long)(cx+size));
+    for (long r = top; r < bottom; ++r)
+    {
+        for (long c = left; c < right; ++c)
+        {
+            const double x = (c-cx)/size, y = (r-cy)/size;
+            const double e = x*x/0.45 + y*y/0.75;
+            if (e > 1)
+                continue;
+
+            // dark blobs for the features: x, y, radius x, radius y, depth
+            const double blobs[][5] = {
+                {-0.3, -0.15, 0.14, 0.07, 130}, {0.3, -0.15, 0.14, 0.07, 130},
+                {-0.3, -0.32, 0.2, 0.04, 90}, {0.3, -0.32, 0.2, 0.04, 90},
+                {0, 0.1, 0.08, 0.2, 40}, {0, 0.42, 0.28, 0.06, 110}
+            };
+            double v = 190 - 40*e;
+            for (unsigned long i = 0; i < sizeof(blobs)/sizeof(blobs[0]); ++i)
+            {
+                const double dx = (x-blobs[i][0])/blobs[i][2], dy = (y-blobs[i][1])/blobs[i][3];
+                const double q = dx*dx + dy*dy;
+                if (q < 1)
+                    v -= blobs[i][4]*(1-q);
+            }
+            unsigned char ch[3];
+            for (int k = 0; k < 3; ++k)
+                ch[k] = (unsigned char)std::max(0.0, std::min(255.0, v*tone[k]));
+            img[r][c] = dlib::rgb_pixel(ch[0], ch[1], ch[2]);
+        }
+    }
+}
+
+inline void make_synthetic_images (
+    dlib::array<dlib::array2d<dlib::rgb_pixel> >& images,
+    unsigned long num_images,
+    int faces_per_image
+)
+{
+    const double tones[][3] = {
+        {1.0, 0.8, 0.65}, {0.85, 0.62, 0.45}, {0.55, 0.4, 0.3}, {1.05, 0.9, 0.8}
+    };
+
+    dlib::rand rnd;
+    images.resize(num_images);
+    for (unsigned long i = 0; i < images.size(); ++i)
+    {
+        dlib::array2d<dlib::rgb_pixel>& img = images[i];
+        img.set_size(480, 640);
+        const double hue = rnd.get_random_double()*6.28;
+        for (long r = 0; r < img.nr(); ++r)
+        {
+            for (long c = 0; c < img.nc(); ++c)
+            {
+                unsigned char ch[3];
+                for (int k = 0; k < 3; ++k)
+                {
+                    const double v = 100 + 50*std::sin(hue + 2.1*k + r*0.01) *
+                        std::cos(c*0.008 + k) + rnd.get_random_gaussian()*4;
+                    ch[k] = (unsigned char)std::max(0.0, std::min(255.0, v));
+                }
+                img[r][c] = dlib::rgb_pixel(ch[0], ch[1], ch[2]);
+            }
+        }
+        for (int j = 0; j < faces_per_image; ++j)
+        {
+            draw_face(img, 80 + rnd.get_random_double()*480, 80 + rnd.get_random_double()*320,
+                50 + rnd.get_random_double()*110, tones[rnd.get_random_32bit_number()%4]);
+        }
+    }
+}
+
+#endif